@@ -192,7 +192,7 @@ $(eval $(call SetupHostCommand,which,Please install 'which', \
 
 $(STAGING_DIR_HOST)/bin/mkhash: $(SCRIPT_DIR)/mkhash.c
 	mkdir -p $(dir $@)
-	$(CC) -O2 -I$(TOPDIR)/tools/include -o $@ $<
+	$(CC) -O2 -I$(TOPDIR)/tools/include -o $@ $< -lpthread
 
 prereq: $(STAGING_DIR_HOST)/bin/mkhash
 
@@ -0,0 +1,11 @@
+# SPDX-License-Identifier: GPL-2.0-only
+#
+# Copyright (C) 2006-2020 OpenWrt.org
+
+# Read after a package or target Makefile while scan.mk dumps its info.
+# Lists the makefiles it included outside of rules.mk and include/, e.g. a
+# feed's luci.mk, so that scan.mk can tell when its cached dump is stale.
+
+ifneq ($(SCAN_MAKEFILES),)
+  $(shell printf '%s\n' $(filter-out $(TOPDIR)/rules.mk $(TOPDIR)/include/%,$(abspath $(MAKEFILE_LIST))) > $(SCAN_MAKEFILES))
+endif
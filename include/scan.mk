@@ -10,6 +10,10 @@ SCAN_DIR ?= package
 TARGET_STAMP:=$(TMP_DIR)/info/.files-$(SCAN_TARGET).stamp
 FILELIST:=$(TMP_DIR)/info/.files-$(SCAN_TARGET)-$(SCAN_COOKIE)
 OVERRIDELIST:=$(TMP_DIR)/info/.overrides-$(SCAN_TARGET)-$(SCAN_COOKIE)
+SCAN_CACHE:=$(TMP_DIR)/info/.cache-$(SCAN_TARGET)
+SCAN_TIMES:=$(TMP_DIR)/info/.times-$(SCAN_TARGET)
+# cached dumps that were not used for this many days are deleted
+SCAN_CACHE_DAYS ?= 30
 
 export PATH:=$(TOPDIR)/staging_dir/host/bin:$(PATH)
 
@@ -26,6 +30,15 @@ ifneq ($(call feedname,$(SCAN_DIR)),)
 endif
 endif
 
+# Dump results are cached by the contents of the package Makefile, its scan
+# dependencies and the common include files, so that a rescan triggered by a
+# mere timestamp change (e.g. switching branches) does not run make again.
+# Makefiles included from elsewhere (e.g. feeds/luci/luci.mk) are recorded
+# by scan-makefiles.mk during the dump; next to each cached result, the
+# .deps file keeps the hash of their contents followed by their paths, and
+# the result is only reused while that hash still matches.
+SCAN_CACHE_SALT:=$(shell cat $(TOPDIR)/rules.mk $(wildcard $(TOPDIR)/include/*.mk) | $(MKHASH) md5)
+
 ifeq ($(IS_TTY),1)
   ifneq ($(strip $(NO_COLOR)),1)
     define progress
@@ -45,18 +58,36 @@ endif
 define PackageDir
   $(TMP_DIR)/.$(SCAN_TARGET): $(TMP_DIR)/info/.$(SCAN_TARGET)-$(1)
   $(TMP_DIR)/info/.$(SCAN_TARGET)-$(1): $(SCAN_DIR)/$(2)/Makefile $(foreach DEP,$(DEPS_$(SCAN_DIR)/$(2)/Makefile) $(SCAN_DEPS),$(wildcard $(if $(filter /%,$(DEP)),$(DEP),$(SCAN_DIR)/$(2)/$(DEP))))
-	{ \
-		$$(call progress,Collecting $(SCAN_NAME) info: $(SCAN_DIR)/$(2)) \
-		echo Source-Makefile: $(SCAN_DIR)/$(2)/Makefile; \
-		$(if $(3),echo Override: $(3),true); \
-		$(NO_TRACE_MAKE) --no-print-dir -r DUMP=1 FEED="$(call feedname,$(2))" -C $(SCAN_DIR)/$(2) $(SCAN_MAKEOPTS) 2>/dev/null || { \
-			mkdir -p "$(TOPDIR)/logs/$(SCAN_DIR)/$(2)"; \
-			$(NO_TRACE_MAKE) --no-print-dir -r DUMP=1 FEED="$(call feedname,$(2))" -C $(SCAN_DIR)/$(2) $(SCAN_MAKEOPTS) > $(TOPDIR)/logs/$(SCAN_DIR)/$(2)/dump.txt 2>&1; \
-			$$(call progress,ERROR: please fix $(SCAN_DIR)/$(2)/Makefile - see logs/$(SCAN_DIR)/$(2)/dump.txt for details\n) \
-			rm -f $$@; \
+	scan_start=$$$${EPOCHREALTIME:-$$$$(date +%s)}; \
+	scan_cache="$(SCAN_CACHE)/$$$$({ echo "$(SCAN_CACHE_SALT) $(SCAN_DIR)/$(2) $(3) $(SCAN_MAKEOPTS)"; cat $$^; } | $(MKHASH) md5)"; \
+	if [ -f "$$$$scan_cache" -a -f "$$$$scan_cache.deps" ] && \
+	   [ "$$$$(sed 1d "$$$$scan_cache.deps" | xargs -r cat 2>/dev/null | $(MKHASH) md5)" = "$$$$(head -n 1 "$$$$scan_cache.deps")" ]; then \
+		touch "$$$$scan_cache" "$$$$scan_cache.deps"; \
+		cp "$$$$scan_cache" $$@.tmp; \
+	else \
+		{ \
+			$$(call progress,Collecting $(SCAN_NAME) info: $(SCAN_DIR)/$(2)) \
+			echo Source-Makefile: $(SCAN_DIR)/$(2)/Makefile; \
+			$(if $(3),echo Override: $(3),true); \
+			$(NO_TRACE_MAKE) --no-print-dir -r DUMP=1 FEED="$(call feedname,$(2))" -C $(SCAN_DIR)/$(2) -f Makefile -f $(TOPDIR)/include/scan-makefiles.mk SCAN_MAKEFILES=$$@.makefiles $(SCAN_MAKEOPTS) 2>/dev/null || { \
+				mkdir -p "$(TOPDIR)/logs/$(SCAN_DIR)/$(2)"; \
+				$(NO_TRACE_MAKE) --no-print-dir -r DUMP=1 FEED="$(call feedname,$(2))" -C $(SCAN_DIR)/$(2) $(SCAN_MAKEOPTS) > $(TOPDIR)/logs/$(SCAN_DIR)/$(2)/dump.txt 2>&1; \
+				$$(call progress,ERROR: please fix $(SCAN_DIR)/$(2)/Makefile - see logs/$(SCAN_DIR)/$(2)/dump.txt for details\n) \
+				scan_cache=; \
+				rm -f $$@; \
+			}; \
+			echo; \
+		} > $$@.tmp; \
+		[ -z "$$$$scan_cache" -o ! -f $$@.makefiles ] || { \
+			mkdir -p $(SCAN_CACHE); \
+			{ xargs -r cat < $$@.makefiles | $(MKHASH) md5; cat $$@.makefiles; } > "$$$$scan_cache.deps.tmp" && \
+			cp $$@.tmp "$$$$scan_cache.tmp" && \
+			mv "$$$$scan_cache.deps.tmp" "$$$$scan_cache.deps" && \
+			mv "$$$$scan_cache.tmp" "$$$$scan_cache"; \
 		}; \
-		echo; \
-	} > $$@.tmp
+		rm -f $$@.makefiles; \
+	fi; \
+	echo "$$$$scan_start $$$${EPOCHREALTIME:-$$$$(date +%s)} $(SCAN_DIR)/$(2)" >> $(SCAN_TIMES).new
 	mv $$@.tmp $$@
 endef
 
@@ -112,9 +143,13 @@ $(TARGET_STAMP)::
 $(TMP_DIR)/.$(SCAN_TARGET): $(TARGET_STAMP)
 	$(call progress,Collecting $(SCAN_NAME) info: merging...)
 	-cat $(FILELIST) | awk '{gsub(/\//, "_", $$0);print "$(TMP_DIR)/info/.$(SCAN_TARGET)-" $$0}' | xargs cat > $@ 2>/dev/null
+	-[ ! -f $(SCAN_TIMES).new ] || { \
+		awk '{ printf "%.3f %s\n", $$2 - $$1, $$3 }' $(SCAN_TIMES).new | sort -rn > $(SCAN_TIMES); \
+		rm -f $(SCAN_TIMES).new; \
+	}
+	-[ ! -d $(SCAN_CACHE) ] || find $(SCAN_CACHE) -type f -mtime +$(SCAN_CACHE_DAYS) -delete
 	$(call progress,Collecting $(SCAN_NAME) info: done)
 	echo
 
 FORCE:
 .PHONY: FORCE
-.NOTPARALLEL:
@@ -0,0 +1,222 @@
+/*
+	Aho-Corasick automaton used to match all host/request url features
+	in one pass over the url string.
+*/
+#include <linux/init.h>
+#include <linux/module.h>
+#include <linux/types.h>
+#include <linux/kernel.h>
+#include <linux/string.h>
+#include <linux/slab.h>
+#include <linux/vmalloc.h>
+#include <linux/ktime.h>
+#include "app_filter.h"
+#include "af_ac.h"
+#include "af_log.h"
+
+int af_ac_init(af_ac_t *ac, int total_len, int pattern_num)
+{
+	memset(ac, 0x0, sizeof(af_ac_t));
+	// root + one state per pattern byte in the worst case
+	ac->max_state = total_len + 1;
+	ac->max_out = pattern_num > 0 ? pattern_num : 1;
+	ac->states = vzalloc(sizeof(af_ac_state_t) * ac->max_state);
+	ac->outs = vzalloc(sizeof(af_ac_out_t) * ac->max_out);
+	if (!ac->states || !ac->outs) {
+		AF_ERROR("alloc ac automaton failed, states = %u\n", ac->max_state);
+		af_ac_free(ac);
+		return -1;
+	}
+	ac->state_num = 1;
+	ac->states[0].out = -1;
+	return 0;
+}
+
+void af_ac_free(af_ac_t *ac)
+{
+	if (ac->states)
+		vfree(ac->states);
+	if (ac->outs)
+		vfree(ac->outs);
+	memset(ac, 0x0, sizeof(af_ac_t));
+}
+
+static inline u_int32_t af_ac_find_child(af_ac_t *ac, u_int32_t s, unsigned char c)
+{
+	u_int32_t i;
+	for (i = ac->states[s].child; i; i = ac->states[i].sibling) {
+		if (ac->states[i].ch == c)
+			return i;
+	}
+	return 0;
+}
+
+static inline u_int32_t af_ac_goto(af_ac_t *ac, u_int32_t s, unsigned char c)
+{
+	if (s == 0)
+		return ac->root_next[c];
+	return af_ac_find_child(ac, s, c);
+}
+
+int af_ac_add(af_ac_t *ac, const char *pattern, int len, u_int32_t id)
+{
+	int i;
+	u_int32_t s = 0;
+	u_int32_t next;
+	af_ac_state_t *st;
+
+	if (!ac->states || len <= 0)
+		return -1;
+	if (ac->out_num >= ac->max_out) {
+		AF_ERROR("ac output table full\n");
+		return -1;
+	}
+	for (i = 0; i < len; i++) {
+		next = af_ac_find_child(ac, s, (unsigned char)pattern[i]);
+		if (!next) {
+			if (ac->state_num >= ac->max_state) {
+				AF_ERROR("ac state table full\n");
+				return -1;
+			}
+			next = ac->state_num++;
+			st = &ac->states[next];
+			st->ch = (unsigned char)pattern[i];
+			st->out = -1;
+			st->sibling = ac->states[s].child;
+			ac->states[s].child = next;
+		}
+		s = next;
+	}
+	ac->outs[ac->out_num].id = id;
+	ac->outs[ac->out_num].next = ac->states[s].out;
+	ac->states[s].out = ac->out_num++;
+	return 0;
+}
+
+int af_ac_compile(af_ac_t *ac)
+{
+	u_int32_t *queue = NULL;
+	u_int32_t head = 0;
+	u_int32_t tail = 0;
+	u_int32_t r, s, t, f;
+	unsigned char c;
+
+	if (!ac->states)
+		return -1;
+	queue = vmalloc(sizeof(u_int32_t) * ac->state_num);
+	if (!queue) {
+		AF_ERROR("alloc ac queue failed\n");
+		return -1;
+	}
+	memset(ac->root_next, 0x0, sizeof(ac->root_next));
+	for (s = ac->states[0].child; s; s = ac->states[s].sibling) {
+		ac->root_next[ac->states[s].ch] = s;
+		ac->states[s].fail = 0;
+		ac->states[s].dict = 0;
+		queue[tail++] = s;
+	}
+	// bfs, parents are always resolved before their children
+	while (head < tail) {
+		r = queue[head++];
+		for (s = ac->states[r].child; s; s = ac->states[s].sibling) {
+			c = ac->states[s].ch;
+			f = ac->states[r].fail;
+			while (1) {
+				t = af_ac_goto(ac, f, c);
+				if (t || f == 0)
+					break;
+				f = ac->states[f].fail;
+			}
+			ac->states[s].fail = t;
+			if (ac->states[t].out >= 0)
+				ac->states[s].dict = t;
+			else
+				ac->states[s].dict = ac->states[t].dict;
+			queue[tail++] = s;
+		}
+	}
+	vfree(queue);
+	return 0;
+}
+
+/*
+	return value:
+		-1		more than max_ids hits, caller must fall back
+		>= 0	number of ids stored, may contain duplicates
+*/
+int af_ac_search(af_ac_t *ac, const char *text, int len, u_int32_t *ids, int max_ids)
+{
+	int i;
+	int num = 0;
+	int o;
+	u_int32_t s = 0;
+	u_int32_t t;
+	u_int32_t d;
+	unsigned char c;
+
+	if (!ac->states || ac->out_num == 0)
+		return 0;
+	for (i = 0; i < len; i++) {
+		c = (unsigned char)text[i];
+		while (1) {
+			t = af_ac_goto(ac, s, c);
+			if (t || s == 0)
+				break;
+			s = ac->states[s].fail;
+		}
+		s = t;
+		for (d = s; d; d = ac->states[d].dict) {
+			for (o = ac->states[d].out; o >= 0; o = ac->outs[o].next) {
+				if (num >= max_ids)
+					return -1;
+				ids[num++] = ac->outs[o].id;
+			}
+		}
+	}
+	return num;
+}
+
+#ifdef CONFIG_KERNEL_FUNC_TEST
+#define AC_TEST_LOOKUP_NUM 100000
+static void TEST_ac_bench_one(int feature_num)
+{
+	af_ac_t ac;
+	char pattern[32];
+	u_int32_t ids[32];
+	static const char *hosts[] = {
+		"www.baidu.com", "v.qq.com", "api.weibo.cn", "host4999.example.com",
+	};
+	int i, len;
+	int total = 0;
+	int hits = 0;
+	u64 start, cost;
+
+	for (i = 0; i < feature_num; i++)
+		total += snprintf(pattern, sizeof(pattern), "host%d.example", i);
+	if (af_ac_init(&ac, total, feature_num) < 0)
+		return;
+	for (i = 0; i < feature_num; i++) {
+		len = snprintf(pattern, sizeof(pattern), "host%d.example", i);
+		af_ac_add(&ac, pattern, len, i);
+	}
+	af_ac_compile(&ac);
+	start = ktime_get_ns();
+	for (i = 0; i < AC_TEST_LOOKUP_NUM; i++) {
+		const char *h = hosts[i % ARRAY_SIZE(hosts)];
+		if (af_ac_search(&ac, h, strlen(h), ids, ARRAY_SIZE(ids)) != 0)
+			hits++;
+	}
+	cost = ktime_get_ns() - start;
+	printk("[ac bench] features = %d, states = %u, %d lookups in %llu us, %llu lookups/s, hits = %d\n",
+		feature_num, ac.state_num, AC_TEST_LOOKUP_NUM, cost / 1000,
+		cost ? (u64)AC_TEST_LOOKUP_NUM * NSEC_PER_SEC / cost : 0, hits);
+	af_ac_free(&ac);
+}
+
+void TEST_ac_bench(void)
+{
+	TEST_ac_bench_one(100);
+	TEST_ac_bench_one(1000);
+	TEST_ac_bench_one(10000);
+}
+#endif
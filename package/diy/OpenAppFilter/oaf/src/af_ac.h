@@ -0,0 +1,43 @@
+#ifndef __AF_AC_H__
+#define __AF_AC_H__
+
+/*
+	Aho-Corasick multi-pattern matcher, built once when the feature
+	file is loaded and searched read-only from the packet path.
+*/
+#define AF_AC_ALPHABET_SIZE 256
+
+typedef struct af_ac_state{
+	u_int32_t child;	// first child, 0 = none (root is never a child)
+	u_int32_t sibling;	// next child of the same parent
+	u_int32_t fail;
+	u_int32_t dict;		// nearest suffix state that has outputs
+	int out;			// first output index, -1 = none
+	unsigned char ch;
+}af_ac_state_t;
+
+typedef struct af_ac_out{
+	u_int32_t id;
+	int next;
+}af_ac_out_t;
+
+typedef struct af_ac{
+	af_ac_state_t *states;
+	u_int32_t state_num;
+	u_int32_t max_state;
+	af_ac_out_t *outs;
+	u_int32_t out_num;
+	u_int32_t max_out;
+	u_int32_t root_next[AF_AC_ALPHABET_SIZE];
+}af_ac_t;
+
+int af_ac_init(af_ac_t *ac, int total_len, int pattern_num);
+int af_ac_add(af_ac_t *ac, const char *pattern, int len, u_int32_t id);
+int af_ac_compile(af_ac_t *ac);
+int af_ac_search(af_ac_t *ac, const char *text, int len, u_int32_t *ids, int max_ids);
+void af_ac_free(af_ac_t *ac);
+#ifdef CONFIG_KERNEL_FUNC_TEST
+void TEST_ac_bench(void);
+#endif
+
+#endif
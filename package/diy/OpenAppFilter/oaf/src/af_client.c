@@ -17,6 +17,11 @@
 #include <linux/cdev.h>
 #include <linux/device.h>
 #include <linux/list.h>
+#include <linux/rculist.h>
+#include <linux/rculist_nulls.h>
+#include <linux/jhash.h>
+#include <linux/random.h>
+#include <linux/netfilter_ipv6.h>
 
 #include "af_client.h"
 #include "af_client_fs.h"
@@ -25,10 +30,13 @@
 #include "app_filter.h"
 #include "cJSON.h"
 
-DEFINE_RWLOCK(af_client_lock);            
+DEFINE_SPINLOCK(af_client_lock);
 
 u32 total_client = 0;
+// clients hashed by mac, and by ipv4 address for the filter lookups
 struct list_head af_client_list_table[MAX_AF_CLIENT_HASH_SIZE];
+struct hlist_nulls_head af_client_ip_table[MAX_AF_CLIENT_HASH_SIZE];
+static u32 af_client_hash_seed __read_mostly;
 
 int af_send_msg_to_user(char *pbuf, uint16_t len);
 
@@ -36,9 +44,11 @@ static void
 nf_client_list_init(void)
 {
 	int i;
+	get_random_bytes(&af_client_hash_seed, sizeof(af_client_hash_seed));
 	AF_CLIENT_LOCK_W();
 	for(i = 0; i < MAX_AF_CLIENT_HASH_SIZE; i ++){
         INIT_LIST_HEAD(&af_client_list_table[i]);
+        INIT_HLIST_NULLS_HEAD(&af_client_ip_table[i], i);
     }
 	AF_CLIENT_UNLOCK_W();
 	AF_INFO("client list init......ok\n");
@@ -59,8 +69,10 @@ nf_client_list_clear(void)
 			memset(mac_str, 0x0, sizeof(mac_str));
 			sprintf(mac_str, MAC_FMT, MAC_ARRAY(p->mac));
 			AF_DEBUG("clean mac:%s\n", mac_str);
-			list_del(&(p->hlist));
-			kfree(p);
+			list_del_rcu(&(p->hlist));
+			if (!hlist_nulls_unhashed(&p->ip_hlist))
+				hlist_nulls_del_init_rcu(&p->ip_hlist);
+			kfree_rcu(p, rcu);
 		}
 	}
 	AF_CLIENT_UNLOCK_W();
@@ -71,16 +83,22 @@ int get_mac_hash_code(unsigned char *mac)
 	if (!mac)
 		return 0;
 	else
-		return mac[5] & (MAX_AF_CLIENT_HASH_SIZE - 1);
+		return jhash(mac, MAC_ADDR_LEN, af_client_hash_seed) & (MAX_AF_CLIENT_HASH_SIZE - 1);
 }
 
+static inline int get_ip_hash_code(unsigned int ip)
+{
+	return jhash_1word(ip, af_client_hash_seed) & (MAX_AF_CLIENT_HASH_SIZE - 1);
+}
+
+// caller holds rcu_read_lock or the client lock
 af_client_info_t * find_af_client(unsigned char *mac)
 {
     af_client_info_t *node;
     unsigned int index;
 
     index = get_mac_hash_code(mac);
-    list_for_each_entry(node, &af_client_list_table[index], hlist){
+    list_for_each_entry_rcu(node, &af_client_list_table[index], hlist){
     	if (0 == memcmp(node->mac, mac, 6)){
 			node->update_jiffies = jiffies;
 			return node;
@@ -89,22 +107,41 @@ af_client_info_t * find_af_client(unsigned char *mac)
     return NULL;
 }
 
+// caller holds rcu_read_lock or the client lock
 af_client_info_t *find_af_client_by_ip(unsigned int ip)
 {
     af_client_info_t *node;
-	int i;
-	
-	for(i = 0; i < MAX_AF_CLIENT_HASH_SIZE; i++){
-	    list_for_each_entry(node, &af_client_list_table[i], hlist){
-	    	if (node->ip == ip){
-				AF_LMT_DEBUG("match node->ip=%pI4, ip=%pI4\n", &node->ip, &ip);
-				return node;
-	    	}
-	    }
-	}
+    struct hlist_nulls_node *n;
+    unsigned int index;
+
+    index = get_ip_hash_code(ip);
+begin:
+    hlist_nulls_for_each_entry_rcu(node, n, &af_client_ip_table[index], ip_hlist){
+    	if (READ_ONCE(node->ip) == ip){
+			AF_LMT_DEBUG("match node->ip=%pI4, ip=%pI4\n", &node->ip, &ip);
+			return node;
+    	}
+    }
+    // a client moved to another chain while we walked it took us along
+    if (get_nulls_value(n) != index)
+    	goto begin;
     return NULL;
 }
 
+/*
+	move the client to the chain of its new ip in place. a reader standing
+	on the node follows it onto the new chain, the nulls marker at the end
+	of that chain tells find_af_client_by_ip() to walk its own chain again.
+	caller holds the client lock.
+*/
+static void nf_client_set_ip(af_client_info_t *node, unsigned int ip)
+{
+	if (!hlist_nulls_unhashed(&node->ip_hlist))
+		hlist_nulls_del_rcu(&node->ip_hlist);
+	WRITE_ONCE(node->ip, ip);
+	hlist_nulls_add_head_rcu(&node->ip_hlist, &af_client_ip_table[get_ip_hash_code(ip)]);
+}
+
 static af_client_info_t *
 nf_client_add(unsigned char *mac)
 {
@@ -126,7 +163,7 @@ nf_client_add(unsigned char *mac)
 	
 	AF_LMT_INFO("new client mac="MAC_FMT"\n", MAC_ARRAY(node->mac));
 	total_client++;
-	list_add(&(node->hlist), &af_client_list_table[index]);
+	list_add_rcu(&(node->hlist), &af_client_list_table[index]);
     return node;
 }
 
@@ -141,8 +178,10 @@ void check_client_expire(void)
 				node->update_jiffies, (jiffies - node->update_jiffies) / HZ);
 			if (jiffies > (node->update_jiffies + MAX_CLIENT_ACTIVE_TIME * HZ)) {
 				AF_INFO("del client:"MAC_FMT"\n", MAC_ARRAY(node->mac));
-				list_del(&(node->hlist));
-				kfree(node);
+				list_del_rcu(&(node->hlist));
+				if (!hlist_nulls_unhashed(&node->ip_hlist))
+					hlist_nulls_del_init_rcu(&node->ip_hlist);
+				kfree_rcu(node, rcu);
 				AF_CLIENT_UNLOCK_W();
 				return;
 			}
@@ -250,7 +289,7 @@ void af_visit_info_timer_handle(void){
 }
 static inline int get_packet_dir(struct net_device *in)
 {
-	if (0 == strncmp(in->name, "br", 2)){
+	if (af_is_lan_dev(in)){
 		return PKT_DIR_UP;
 	}
 	else{
@@ -308,11 +347,34 @@ static u_int32_t nfclient_hook(unsigned int hook,
         memcpy(smac, &skb->cb[40], ETH_ALEN);
     }
 
+	// ipv6 packets only refresh the client, the ip stays the ipv4 one
+	if (skb->protocol == htons(ETH_P_IPV6)) {
+		rcu_read_lock();
+		nfc = find_af_client(smac);
+		rcu_read_unlock();
+		if (nfc)
+			return NF_ACCEPT;
+		AF_CLIENT_LOCK_W();
+		if (!find_af_client(smac))
+			nf_client_add(smac);
+		AF_CLIENT_UNLOCK_W();
+		return NF_ACCEPT;
+	}
+
 	iph = ip_hdr(skb);
 	if (!iph) {
 		return NF_ACCEPT;
 	}
 
+	// known client with an unchanged ip, nothing to update
+	rcu_read_lock();
+	nfc = find_af_client(smac);
+	if (nfc && nfc->ip == iph->saddr) {
+		rcu_read_unlock();
+		return NF_ACCEPT;
+	}
+	rcu_read_unlock();
+
 	AF_CLIENT_LOCK_W();
 	nfc = find_af_client(smac);
 	if (!nfc){
@@ -323,7 +385,7 @@ static u_int32_t nfclient_hook(unsigned int hook,
 	}
 	if(nfc && nfc->ip != iph->saddr){
 		AF_DEBUG("update node "MAC_FMT" ip %pI4--->%pI4\n", MAC_ARRAY(nfc->mac), &nfc->ip, &iph->saddr);
-		nfc->ip = iph->saddr;
+		nf_client_set_ip(nfc, iph->saddr);
 	}
 	AF_CLIENT_UNLOCK_W();
 
@@ -339,6 +401,12 @@ static struct nf_hook_ops af_client_ops[] = {
 		.hooknum	= NF_INET_FORWARD,
 		.priority	= NF_IP_PRI_FIRST + 1,
 	},
+	{
+		.hook		= nfclient_hook,
+		.pf			= PF_INET6,
+		.hooknum	= NF_INET_FORWARD,
+		.priority	= NF_IP6_PRI_FIRST + 1,
+	},
 };
 #else
 static struct nf_hook_ops af_client_ops[] = {
@@ -349,6 +417,13 @@ static struct nf_hook_ops af_client_ops[] = {
 		.hooknum	= NF_INET_FORWARD,
 		.priority	= NF_IP_PRI_FIRST + 1,
 	},
+	{
+		.hook		= nfclient_hook,
+		.owner		= THIS_MODULE,
+		.pf			= PF_INET6,
+		.hooknum	= NF_INET_FORWARD,
+		.priority	= NF_IP6_PRI_FIRST + 1,
+	},
 };
 #endif
 
@@ -1,20 +1,25 @@
 #ifndef __AF_CLIENT_H__
 #define __AF_CLIENT_H__
+#include <linux/list_nulls.h>
 #include "app_filter.h"
 
-extern rwlock_t af_client_lock;  
+extern spinlock_t af_client_lock;
 
 extern u32 nfc_debug_level;
 	
-#define MAX_AF_CLIENT_HASH_SIZE 64
+#define MAX_AF_CLIENT_HASH_SIZE 256
 #define NF_CLIENT_TIMER_EXPIRE  1
 #define MAX_CLIENT_ACTIVE_TIME  90
 
 
-#define AF_CLIENT_LOCK_R() 		read_lock_bh(&af_client_lock);
-#define AF_CLIENT_UNLOCK_R() 	read_unlock_bh(&af_client_lock);
-#define AF_CLIENT_LOCK_W() 		write_lock_bh(&af_client_lock);
-#define AF_CLIENT_UNLOCK_W()	write_unlock_bh(&af_client_lock);
+/*
+	client lookups from the packet path are done under rcu, the lock only
+	serialises changes of the tables and of the visit info, and the dumps.
+*/
+#define AF_CLIENT_LOCK_R() 		spin_lock_bh(&af_client_lock);
+#define AF_CLIENT_UNLOCK_R() 	spin_unlock_bh(&af_client_lock);
+#define AF_CLIENT_LOCK_W() 		spin_lock_bh(&af_client_lock);
+#define AF_CLIENT_UNLOCK_W()	spin_unlock_bh(&af_client_lock);
 
 #define NIPQUAD(addr) \
 	((unsigned char *)&addr)[0], \
@@ -47,6 +52,8 @@ typedef struct app_visit_info{
 
 typedef struct af_client_info {
     struct list_head   hlist;
+    struct hlist_nulls_node ip_hlist;
+    struct rcu_head    rcu;
     unsigned char      mac[MAC_ADDR_LEN];
 	unsigned int 	   ip;
     unsigned long      create_jiffies;
@@ -63,6 +70,7 @@ int af_client_init(void);
 
 void af_client_exit(void);
 af_client_info_t * find_af_client_by_ip(unsigned int ip);
+af_client_info_t * find_af_client(unsigned char *mac);
 
 void check_client_expire(void);
 
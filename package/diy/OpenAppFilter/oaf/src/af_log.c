@@ -6,6 +6,7 @@
 #include <linux/sysctl.h>
 
 #include "af_log.h"
+#include "af_utils.h"
 int af_log_lvl = 1;
 int af_test_mode = 0;
 // todo: rename af_log.c
@@ -36,6 +37,13 @@ static struct ctl_table oaf_table[] = {
 		.mode		= 0666,
 		.proc_handler	= proc_dointvec,
 	},
+	{
+		.procname	= "lan_ifname",
+		.data		= af_lan_ifname,
+		.maxlen 	= AF_LAN_IFNAME_LEN,
+		.mode		= 0644,
+		.proc_handler	= proc_dostring,
+	},
 	{
 	}
 };
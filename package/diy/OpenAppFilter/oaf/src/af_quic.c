@@ -0,0 +1,721 @@
+/*
+	QUIC Initial packet SNI extraction (RFC 9000/9001, RFC 9369)
+	Initial packets are protected with keys derived from the destination
+	connection id only, so the ClientHello can be read without any state.
+	The AEAD tag is not checked, the payload is only peeked at. A ClientHello
+	spread over several Initial packets is reassembled in a small table
+	keyed by that connection id.
+*/
+#include <linux/init.h>
+#include <linux/module.h>
+#include <linux/version.h>
+#include <linux/types.h>
+#include <linux/kernel.h>
+#include <linux/string.h>
+#include <linux/percpu.h>
+#include <linux/spinlock.h>
+#include <linux/jiffies.h>
+#include <linux/vmalloc.h>
+#include <linux/slab.h>
+#include <linux/ktime.h>
+#include <asm/unaligned.h>
+
+#include "app_filter.h"
+#include "af_log.h"
+#include "af_quic.h"
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5,4,0) && \
+	IS_ENABLED(CONFIG_CRYPTO_LIB_AES) && IS_ENABLED(CONFIG_CRYPTO_LIB_SHA256)
+#define AF_QUIC_SUPPORT 1
+#endif
+
+#ifdef AF_QUIC_SUPPORT
+#include <crypto/aes.h>
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5,11,0)
+#include <crypto/sha2.h>
+#else
+#include <crypto/sha.h>
+#endif
+
+#define QUIC_MAX_CID_LEN 20
+#define QUIC_SAMPLE_LEN 16
+#define QUIC_TAG_LEN 16
+#define QUIC_SECRET_LEN 32
+#define QUIC_KEY_LEN 16
+#define QUIC_IV_LEN 12
+#define QUIC_MAX_PAYLOAD_LEN 1536
+#define QUIC_MAX_CRYPTO_LEN 4096
+#define QUIC_MAX_CRYPTO_FRAME 32
+#define QUIC_PENDING_NUM 16
+#define QUIC_PENDING_TIMEOUT (2 * HZ)
+#define QUIC_PARSE_MORE -2
+
+#define QUIC_FRAME_PADDING 0x00
+#define QUIC_FRAME_PING 0x01
+#define QUIC_FRAME_ACK 0x02
+#define QUIC_FRAME_ACK_ECN 0x03
+#define QUIC_FRAME_CRYPTO 0x06
+
+typedef struct af_quic_version{
+	u_int32_t version;
+	u_int8_t initial_type;
+	const char *key_label;
+	const char *iv_label;
+	const char *hp_label;
+	u_int8_t salt[20];
+}af_quic_version_t;
+
+static const af_quic_version_t af_quic_versions[] = {
+	{
+		.version = 0x00000001,
+		.initial_type = 0,
+		.key_label = "quic key",
+		.iv_label = "quic iv",
+		.hp_label = "quic hp",
+		.salt = {0x38, 0x76, 0x2c, 0xf7, 0xf5, 0x59, 0x34, 0xb3, 0x4d, 0x17,
+			0x9a, 0xe6, 0xa4, 0xc8, 0x0c, 0xad, 0xcc, 0xbb, 0x7f, 0x0a},
+	},
+	{
+		.version = 0x6b3343cf,
+		.initial_type = 1,
+		.key_label = "quicv2 key",
+		.iv_label = "quicv2 iv",
+		.hp_label = "quicv2 hp",
+		.salt = {0x0d, 0xed, 0xe3, 0xde, 0xf7, 0x00, 0xa6, 0xdb, 0x81, 0x93,
+			0x81, 0xbe, 0x6e, 0x26, 0x9d, 0xcb, 0xf9, 0xbd, 0x2e, 0xd9},
+	},
+};
+
+typedef struct af_quic_frame{
+	u_int32_t offset;
+	u_int32_t len;
+}af_quic_frame_t;
+
+typedef struct af_quic_stream{
+	u_int8_t data[QUIC_MAX_CRYPTO_LEN];
+	af_quic_frame_t frames[QUIC_MAX_CRYPTO_FRAME];
+	int frame_num;
+}af_quic_stream_t;
+
+// per cpu scratch space, the hook runs with bh disabled
+typedef struct af_quic_buf{
+	u_int8_t payload[QUIC_MAX_PAYLOAD_LEN];
+	af_quic_stream_t stream;
+}af_quic_buf_t;
+
+/*
+	a ClientHello larger than one Initial packet (e.g. with a post-quantum
+	key share) is kept here until the rest of its CRYPTO stream arrives,
+	the client sends all of them with the same destination connection id.
+*/
+typedef struct af_quic_pending{
+	u_int8_t dcid[QUIC_MAX_CID_LEN];
+	u_int8_t dcid_len;
+	unsigned long expires;
+	af_quic_stream_t stream;
+}af_quic_pending_t;
+
+static af_quic_buf_t __percpu *af_quic_bufs = NULL;
+static af_quic_pending_t *af_quic_pendings = NULL;
+static DEFINE_SPINLOCK(af_quic_pending_lock);
+
+static void af_hmac_sha256(const u8 *key, int key_len, const u8 *data, int data_len, u8 *out)
+{
+	struct sha256_state sctx;
+	u8 pad[SHA256_BLOCK_SIZE];
+	u8 inner[SHA256_DIGEST_SIZE];
+	int i;
+
+	// keys used here are never longer than one block
+	memset(pad, 0x0, sizeof(pad));
+	memcpy(pad, key, key_len);
+	for (i = 0; i < SHA256_BLOCK_SIZE; i++)
+		pad[i] ^= 0x36;
+	sha256_init(&sctx);
+	sha256_update(&sctx, pad, SHA256_BLOCK_SIZE);
+	sha256_update(&sctx, data, data_len);
+	sha256_final(&sctx, inner);
+
+	for (i = 0; i < SHA256_BLOCK_SIZE; i++)
+		pad[i] ^= 0x36 ^ 0x5c;
+	sha256_init(&sctx);
+	sha256_update(&sctx, pad, SHA256_BLOCK_SIZE);
+	sha256_update(&sctx, inner, SHA256_DIGEST_SIZE);
+	sha256_final(&sctx, out);
+}
+
+// HKDF-Expand-Label with an empty context, out_len <= SHA256_DIGEST_SIZE
+static void af_hkdf_expand_label(const u8 *secret, const char *label, u8 *out, int out_len)
+{
+	u8 info[64];
+	u8 t[SHA256_DIGEST_SIZE];
+	int label_len = strlen(label);
+	int n = 0;
+
+	info[n++] = 0;
+	info[n++] = out_len;
+	info[n++] = 6 + label_len;
+	memcpy(info + n, "tls13 ", 6);
+	n += 6;
+	memcpy(info + n, label, label_len);
+	n += label_len;
+	info[n++] = 0;
+	info[n++] = 0x01;
+	af_hmac_sha256(secret, QUIC_SECRET_LEN, info, n, t);
+	memcpy(out, t, out_len);
+}
+
+static void af_quic_initial_keys(const af_quic_version_t *ver, const u8 *dcid, int dcid_len,
+			u8 *key, u8 *iv, u8 *hp)
+{
+	u8 secret[QUIC_SECRET_LEN];
+	u8 client_secret[QUIC_SECRET_LEN];
+
+	af_hmac_sha256(ver->salt, sizeof(ver->salt), dcid, dcid_len, secret);
+	af_hkdf_expand_label(secret, "client in", client_secret, QUIC_SECRET_LEN);
+	af_hkdf_expand_label(client_secret, ver->key_label, key, QUIC_KEY_LEN);
+	af_hkdf_expand_label(client_secret, ver->iv_label, iv, QUIC_IV_LEN);
+	af_hkdf_expand_label(client_secret, ver->hp_label, hp, QUIC_KEY_LEN);
+}
+
+static int af_quic_varint(const u8 *p, int len, int *pos, u64 *val)
+{
+	int i;
+	int n;
+
+	if (*pos >= len)
+		return -1;
+	n = 1 << (p[*pos] >> 6);
+	if (*pos + n > len)
+		return -1;
+	*val = p[*pos] & 0x3f;
+	for (i = 1; i < n; i++)
+		*val = (*val << 8) | p[*pos + i];
+	*pos += n;
+	return 0;
+}
+
+// AES-GCM payload decryption without tag check is plain CTR from counter 2
+static void af_quic_decrypt(struct crypto_aes_ctx *aes, const u8 *nonce,
+			const u8 *in, u8 *out, int len)
+{
+	u8 ctr[AES_BLOCK_SIZE];
+	u8 stream[AES_BLOCK_SIZE];
+	u32 counter = 2;
+	int i, n;
+
+	memcpy(ctr, nonce, QUIC_IV_LEN);
+	while (len > 0) {
+		put_unaligned_be32(counter++, ctr + QUIC_IV_LEN);
+		aes_encrypt(aes, stream, ctr);
+		n = len < AES_BLOCK_SIZE ? len : AES_BLOCK_SIZE;
+		for (i = 0; i < n; i++)
+			out[i] = in[i] ^ stream[i];
+		in += n;
+		out += n;
+		len -= n;
+	}
+}
+
+static void af_quic_stream_add(af_quic_stream_t *stream, u64 offset, const u8 *data, u64 len)
+{
+	if (offset + len > QUIC_MAX_CRYPTO_LEN || stream->frame_num >= QUIC_MAX_CRYPTO_FRAME)
+		return;
+	memcpy(stream->data + offset, data, len);
+	stream->frames[stream->frame_num].offset = offset;
+	stream->frames[stream->frame_num].len = len;
+	stream->frame_num++;
+}
+
+// collect the CRYPTO frames of the payload, they may be split and reordered
+static void af_quic_collect_frames(const u8 *p, int len, af_quic_stream_t *stream)
+{
+	int pos = 0;
+	u64 type, offset, length, count, v;
+
+	while (pos < len) {
+		if (af_quic_varint(p, len, &pos, &type) < 0)
+			break;
+		if (type == QUIC_FRAME_PADDING || type == QUIC_FRAME_PING)
+			continue;
+		if (type == QUIC_FRAME_ACK || type == QUIC_FRAME_ACK_ECN) {
+			// largest acknowledged, ack delay, range count, first range
+			if (af_quic_varint(p, len, &pos, &v) < 0 ||
+				af_quic_varint(p, len, &pos, &v) < 0 ||
+				af_quic_varint(p, len, &pos, &count) < 0 ||
+				af_quic_varint(p, len, &pos, &v) < 0)
+				break;
+			// gap and length per range, then the ecn counts
+			count = count * 2 + (type == QUIC_FRAME_ACK_ECN ? 3 : 0);
+			while (count-- > 0) {
+				if (af_quic_varint(p, len, &pos, &v) < 0)
+					return;
+			}
+			continue;
+		}
+		if (type != QUIC_FRAME_CRYPTO)
+			break;
+		if (af_quic_varint(p, len, &pos, &offset) < 0 ||
+			af_quic_varint(p, len, &pos, &length) < 0 ||
+			length > len - pos)
+			break;
+		af_quic_stream_add(stream, offset, p + pos, length);
+		pos += length;
+	}
+}
+
+/*
+	parse the ClientHello from the contiguous part of the crypto stream that
+	starts at offset 0. return QUIC_PARSE_MORE if the server name may be in
+	a part of the message that has not been seen yet.
+*/
+static int af_quic_stream_sni(af_quic_stream_t *stream, char *sni, int sni_size)
+{
+	u8 *p = stream->data;
+	u32 contig = 0;
+	u32 hello_len;
+	int i, changed;
+	char *name = NULL;
+	int name_len = 0;
+
+	do {
+		changed = 0;
+		for (i = 0; i < stream->frame_num; i++) {
+			if (stream->frames[i].offset <= contig &&
+				stream->frames[i].offset + stream->frames[i].len > contig) {
+				contig = stream->frames[i].offset + stream->frames[i].len;
+				changed = 1;
+			}
+		}
+	} while (changed);
+
+	if (contig == 0)
+		return stream->frame_num > 0 ? QUIC_PARSE_MORE : -1;
+	if (af_parse_client_hello(p, contig, &name, &name_len) < 0) {
+		if (contig < TLS_HANDSHAKE_HEADER_LEN)
+			return QUIC_PARSE_MORE;
+		hello_len = TLS_HANDSHAKE_HEADER_LEN + ((p[1] << 16) | (p[2] << 8) | p[3]);
+		if (p[0] == TLS_HANDSHAKE_CLIENT_HELLO && contig < hello_len &&
+			hello_len <= QUIC_MAX_CRYPTO_LEN)
+			return QUIC_PARSE_MORE;
+		return -1;
+	}
+	if (name_len >= sni_size)
+		name_len = sni_size - 1;
+	memcpy(sni, name, name_len);
+	sni[name_len] = '\0';
+	return name_len;
+}
+
+// merge the crypto stream of this packet into the ones seen before with the same dcid
+static int af_quic_pending_sni(const u8 *dcid, int dcid_len, af_quic_stream_t *stream,
+			char *sni, int sni_size)
+{
+	af_quic_pending_t *pending = NULL;
+	af_quic_pending_t *victim = NULL;
+	af_quic_pending_t *p;
+	int i, ret;
+
+	spin_lock_bh(&af_quic_pending_lock);
+	for (i = 0; i < QUIC_PENDING_NUM; i++) {
+		p = &af_quic_pendings[i];
+		if (p->dcid_len && time_after(jiffies, p->expires))
+			p->dcid_len = 0;
+		if (p->dcid_len == dcid_len && !memcmp(p->dcid, dcid, dcid_len)) {
+			pending = p;
+			break;
+		}
+		// reuse a free slot, or the one closest to expire
+		if (!victim || !p->dcid_len ||
+			(victim->dcid_len && time_before(p->expires, victim->expires)))
+			victim = p;
+	}
+	if (!pending) {
+		pending = victim;
+		memcpy(pending->dcid, dcid, dcid_len);
+		pending->dcid_len = dcid_len;
+		pending->stream.frame_num = 0;
+	}
+	for (i = 0; i < stream->frame_num; i++)
+		af_quic_stream_add(&pending->stream, stream->frames[i].offset,
+			stream->data + stream->frames[i].offset, stream->frames[i].len);
+	ret = af_quic_stream_sni(&pending->stream, sni, sni_size);
+	if (ret == QUIC_PARSE_MORE)
+		pending->expires = jiffies + QUIC_PENDING_TIMEOUT;
+	else
+		pending->dcid_len = 0;
+	spin_unlock_bh(&af_quic_pending_lock);
+	return ret;
+}
+
+int af_parse_quic_sni(unsigned char *data, int len, char *sni, int sni_size)
+{
+	const af_quic_version_t *ver = NULL;
+	struct crypto_aes_ctx aes;
+	af_quic_buf_t *buf;
+	u8 key[QUIC_KEY_LEN];
+	u8 iv[QUIC_IV_LEN];
+	u8 hp[QUIC_KEY_LEN];
+	u8 mask[AES_BLOCK_SIZE];
+	u8 *dcid;
+	u32 version;
+	u64 token_len;
+	u64 length;
+	u64 pn = 0;
+	int pos, pn_offset, pn_len, payload_len;
+	int dcid_len, scid_len;
+	int i, ret;
+
+	if (!af_quic_bufs || !af_quic_pendings || !data || len < QUIC_MIN_INITIAL_LEN)
+		return -1;
+	// long header with the fixed bit set
+	if ((data[0] & 0xc0) != 0xc0)
+		return -1;
+	version = get_unaligned_be32(data + 1);
+	for (i = 0; i < ARRAY_SIZE(af_quic_versions); i++) {
+		if (af_quic_versions[i].version == version) {
+			ver = &af_quic_versions[i];
+			break;
+		}
+	}
+	if (!ver || ((data[0] & 0x30) >> 4) != ver->initial_type)
+		return -1;
+
+	pos = 5;
+	dcid_len = data[pos++];
+	if (dcid_len == 0 || dcid_len > QUIC_MAX_CID_LEN)
+		return -1;
+	dcid = data + pos;
+	pos += dcid_len;
+	scid_len = data[pos++];
+	if (scid_len > QUIC_MAX_CID_LEN)
+		return -1;
+	pos += scid_len;
+	if (af_quic_varint(data, len, &pos, &token_len) < 0 || token_len > len - pos)
+		return -1;
+	pos += token_len;
+	if (af_quic_varint(data, len, &pos, &length) < 0 || length > len - pos)
+		return -1;
+	// the sample is taken 4 bytes after the start of the packet number
+	if (length < 4 + QUIC_SAMPLE_LEN)
+		return -1;
+	pn_offset = pos;
+
+	af_quic_initial_keys(ver, dcid, dcid_len, key, iv, hp);
+
+	// remove header protection on a copy, the skb is left untouched
+	if (aes_expandkey(&aes, hp, QUIC_KEY_LEN) < 0)
+		return -1;
+	aes_encrypt(&aes, mask, data + pn_offset + 4);
+	pn_len = ((data[0] ^ mask[0]) & 0x03) + 1;
+	for (i = 0; i < pn_len; i++)
+		pn = (pn << 8) | (data[pn_offset + i] ^ mask[1 + i]);
+	payload_len = length - pn_len - QUIC_TAG_LEN;
+	if (payload_len <= 0 || payload_len > QUIC_MAX_PAYLOAD_LEN)
+		return -1;
+	for (i = 0; i < 8; i++)
+		iv[QUIC_IV_LEN - 1 - i] ^= (pn >> (8 * i)) & 0xff;
+
+	if (aes_expandkey(&aes, key, QUIC_KEY_LEN) < 0)
+		return -1;
+	buf = get_cpu_ptr(af_quic_bufs);
+	af_quic_decrypt(&aes, iv, data + pn_offset + pn_len, buf->payload, payload_len);
+	buf->stream.frame_num = 0;
+	af_quic_collect_frames(buf->payload, payload_len, &buf->stream);
+	ret = af_quic_stream_sni(&buf->stream, sni, sni_size);
+	if (ret == QUIC_PARSE_MORE)
+		ret = af_quic_pending_sni(dcid, dcid_len, &buf->stream, sni, sni_size);
+	put_cpu_ptr(af_quic_bufs);
+	return ret < 0 ? -1 : ret;
+}
+
+int af_quic_init(void)
+{
+	af_quic_bufs = alloc_percpu(af_quic_buf_t);
+	if (!af_quic_bufs) {
+		AF_ERROR("alloc quic buffer failed\n");
+		return -1;
+	}
+	af_quic_pendings = vzalloc(QUIC_PENDING_NUM * sizeof(af_quic_pending_t));
+	if (!af_quic_pendings) {
+		AF_ERROR("alloc quic pending table failed\n");
+		free_percpu(af_quic_bufs);
+		af_quic_bufs = NULL;
+		return -1;
+	}
+	return 0;
+}
+
+void af_quic_exit(void)
+{
+	if (af_quic_bufs)
+		free_percpu(af_quic_bufs);
+	af_quic_bufs = NULL;
+	vfree(af_quic_pendings);
+	af_quic_pendings = NULL;
+}
+
+#ifdef CONFIG_KERNEL_FUNC_TEST
+#define QUIC_TEST_FUZZ_NUM 200000
+#define QUIC_TEST_BENCH_NUM 20000
+#define QUIC_TEST_HOST "www.quic-sni-test.example"
+#define QUIC_TEST_BUF_LEN 2048
+
+static u32 quic_test_seed = 0x2545f491;
+
+// xorshift32, the same sequence on every run
+static u32 quic_test_rand(void)
+{
+	quic_test_seed ^= quic_test_seed << 13;
+	quic_test_seed ^= quic_test_seed >> 17;
+	quic_test_seed ^= quic_test_seed << 5;
+	return quic_test_seed;
+}
+
+// ClientHello with a pad_len dummy extension, like a large key share, before server_name
+static int quic_test_client_hello(u8 *p, int pad_len)
+{
+	int host_len = strlen(QUIC_TEST_HOST);
+	int n = TLS_HANDSHAKE_HEADER_LEN;
+	int ext_start;
+
+	p[n++] = 0x03;
+	p[n++] = 0x03;
+	memset(p + n, 0x5a, TLS_RANDOM_LEN);
+	n += TLS_RANDOM_LEN;
+	p[n++] = 0;	// session id
+	put_unaligned_be16(2, p + n);
+	put_unaligned_be16(0x1301, p + n + 2);
+	n += 4;
+	p[n++] = 1;	// compression methods
+	p[n++] = 0;
+	ext_start = n;
+	n += 2;
+	put_unaligned_be16(0xfe00, p + n);
+	put_unaligned_be16(pad_len, p + n + 2);
+	memset(p + n + 4, 0xa5, pad_len);
+	n += 4 + pad_len;
+	put_unaligned_be16(TLS_EXT_SERVER_NAME, p + n);
+	put_unaligned_be16(host_len + 5, p + n + 2);
+	put_unaligned_be16(host_len + 3, p + n + 4);
+	p[n + 6] = TLS_SNI_HOST_NAME;
+	put_unaligned_be16(host_len, p + n + 7);
+	memcpy(p + n + 9, QUIC_TEST_HOST, host_len);
+	n += 9 + host_len;
+	put_unaligned_be16(n - ext_start - 2, p + ext_start);
+	p[0] = TLS_HANDSHAKE_CLIENT_HELLO;
+	p[1] = 0;
+	put_unaligned_be16(n - TLS_HANDSHAKE_HEADER_LEN, p + 2);
+	return n;
+}
+
+// protect a client Initial packet carrying crypto[offset, offset + len), padded to the minimum size
+static int quic_test_seal(const af_quic_version_t *ver, const u8 *dcid, int dcid_len, u16 pn,
+			const u8 *crypto, int offset, int len, u8 *out)
+{
+	struct crypto_aes_ctx aes;
+	u8 key[QUIC_KEY_LEN];
+	u8 iv[QUIC_IV_LEN];
+	u8 hp[QUIC_KEY_LEN];
+	u8 mask[AES_BLOCK_SIZE];
+	u8 *payload;
+	int n = 0;
+	int pn_offset, payload_len;
+
+	out[n++] = 0xc0 | (ver->initial_type << 4) | 0x01;	// 2 bytes packet number
+	put_unaligned_be32(ver->version, out + n);
+	n += 4;
+	out[n++] = dcid_len;
+	memcpy(out + n, dcid, dcid_len);
+	n += dcid_len;
+	out[n++] = 0;	// source connection id
+	out[n++] = 0;	// token
+	payload_len = QUIC_MIN_INITIAL_LEN - (n + 2 + 2 + QUIC_TAG_LEN);
+	if (payload_len < 5 + len)
+		payload_len = 5 + len;
+	put_unaligned_be16(0x4000 | (2 + payload_len + QUIC_TAG_LEN), out + n);
+	n += 2;
+	pn_offset = n;
+	put_unaligned_be16(pn, out + n);
+	n += 2;
+
+	payload = out + n;
+	payload[0] = QUIC_FRAME_CRYPTO;
+	put_unaligned_be16(0x4000 | offset, payload + 1);
+	put_unaligned_be16(0x4000 | len, payload + 3);
+	memcpy(payload + 5, crypto + offset, len);
+	memset(payload + 5 + len, QUIC_FRAME_PADDING, payload_len - 5 - len);
+
+	af_quic_initial_keys(ver, dcid, dcid_len, key, iv, hp);
+	iv[QUIC_IV_LEN - 2] ^= pn >> 8;
+	iv[QUIC_IV_LEN - 1] ^= pn & 0xff;
+	aes_expandkey(&aes, key, QUIC_KEY_LEN);
+	// CTR mode is its own inverse
+	af_quic_decrypt(&aes, iv, payload, payload, payload_len);
+	n += payload_len;
+	memset(out + n, 0x0, QUIC_TAG_LEN);
+	n += QUIC_TAG_LEN;
+
+	aes_expandkey(&aes, hp, QUIC_KEY_LEN);
+	aes_encrypt(&aes, mask, out + pn_offset + 4);
+	out[0] ^= mask[0] & 0x0f;
+	out[pn_offset] ^= mask[1];
+	out[pn_offset + 1] ^= mask[2];
+	return n;
+}
+
+static int quic_test_expect(const char *what, int ret, const char *sni, const char *host)
+{
+	int ok = host ? (ret == strlen(host) && !strcmp(sni, host)) : (ret < 0);
+
+	printk("[quic test] %-36s %s\n", what, ok ? "ok" : "FAILED");
+	return ok ? 0 : 1;
+}
+
+/*
+	known answer checks (RFC 9001 appendix A.1, single and split ClientHello
+	for v1 and v2), a mutation fuzz of the QUIC and TLS parsers, and the parse
+	cost per packet. run it with KASAN to catch out of bounds reads.
+*/
+void TEST_quic_sni(void)
+{
+	static const u8 rfc_dcid[] = {0x83, 0x94, 0xc8, 0xf0, 0x3e, 0x51, 0x57, 0x08};
+	static const u8 rfc_key[QUIC_KEY_LEN] = {0x1f, 0x36, 0x96, 0x13, 0xdd, 0x76, 0xd5, 0x46,
+		0x77, 0x30, 0xef, 0xcb, 0xe3, 0xb1, 0xa2, 0x2d};
+	static const u8 rfc_iv[QUIC_IV_LEN] = {0xfa, 0x04, 0x4b, 0x2f, 0x42, 0xa3, 0xfd, 0x3b,
+		0x46, 0xfb, 0x25, 0x5c};
+	static const u8 rfc_hp[QUIC_KEY_LEN] = {0x9f, 0x50, 0x44, 0x9e, 0x04, 0xa0, 0xe8, 0x10,
+		0x28, 0x3a, 0x1e, 0x99, 0x33, 0xad, 0xed, 0xd2};
+	u8 key[QUIC_KEY_LEN];
+	u8 iv[QUIC_IV_LEN];
+	u8 hp[QUIC_KEY_LEN];
+	u8 dcid[8];
+	char sni[MAX_URL_MATCH_LEN];
+	char *name;
+	u8 *hello, *pkt1, *pkt2, *fuzz;
+	int hello_len, len1, len2, len, ret, i, j, v;
+	int fail = 0;
+	int found = 0;
+	u64 start, cost;
+
+	hello = kmalloc(QUIC_MAX_CRYPTO_LEN, GFP_KERNEL);
+	pkt1 = kmalloc(QUIC_TEST_BUF_LEN, GFP_KERNEL);
+	pkt2 = kmalloc(QUIC_TEST_BUF_LEN, GFP_KERNEL);
+	fuzz = kmalloc(QUIC_TEST_BUF_LEN, GFP_KERNEL);
+	if (!hello || !pkt1 || !pkt2 || !fuzz)
+		goto out;
+
+	af_quic_initial_keys(&af_quic_versions[0], rfc_dcid, sizeof(rfc_dcid), key, iv, hp);
+	ret = (!memcmp(key, rfc_key, QUIC_KEY_LEN) && !memcmp(iv, rfc_iv, QUIC_IV_LEN) &&
+		!memcmp(hp, rfc_hp, QUIC_KEY_LEN)) ? 0 : -1;
+	fail += quic_test_expect("rfc9001 initial keys", ret, "", "");
+
+	for (v = 0; v < ARRAY_SIZE(af_quic_versions); v++) {
+		const af_quic_version_t *ver = &af_quic_versions[v];
+
+		printk("[quic test] version 0x%08x\n", ver->version);
+		hello_len = quic_test_client_hello(hello, 200);
+		len1 = quic_test_seal(ver, rfc_dcid, sizeof(rfc_dcid), 0, hello, 0, hello_len, pkt1);
+		ret = af_parse_quic_sni(pkt1, len1, sni, sizeof(sni));
+		fail += quic_test_expect("single packet", ret, sni, QUIC_TEST_HOST);
+
+		// the server name is in the second packet
+		hello_len = quic_test_client_hello(hello, 1800);
+		len1 = quic_test_seal(ver, rfc_dcid, sizeof(rfc_dcid), 0, hello, 0, 1100, pkt1);
+		len2 = quic_test_seal(ver, rfc_dcid, sizeof(rfc_dcid), 1, hello, 1100, hello_len - 1100, pkt2);
+		ret = af_parse_quic_sni(pkt1, len1, sni, sizeof(sni));
+		fail += quic_test_expect("split, first packet", ret, sni, NULL);
+		ret = af_parse_quic_sni(pkt2, len2, sni, sizeof(sni));
+		fail += quic_test_expect("split, second packet", ret, sni, QUIC_TEST_HOST);
+		ret = af_parse_quic_sni(pkt2, len2, sni, sizeof(sni));
+		fail += quic_test_expect("split, reordered second packet", ret, sni, NULL);
+		ret = af_parse_quic_sni(pkt1, len1, sni, sizeof(sni));
+		fail += quic_test_expect("split, reordered first packet", ret, sni, QUIC_TEST_HOST);
+		ret = af_parse_quic_sni(pkt1, len1 - 1, sni, sizeof(sni));
+		fail += quic_test_expect("short packet", ret, sni, NULL);
+	}
+
+	hello_len = quic_test_client_hello(hello, 200);
+	ret = af_parse_client_hello(hello, hello_len, &name, &len);
+	if (ret == 0) {
+		memcpy(sni, name, len);
+		sni[len] = '\0';
+		ret = len;
+	}
+	fail += quic_test_expect("tls client hello", ret, sni, QUIC_TEST_HOST);
+	ret = af_parse_client_hello(hello, hello_len - strlen(QUIC_TEST_HOST) - 9, &name, &len);
+	fail += quic_test_expect("tls client hello without sni", ret, sni, NULL);
+
+	// mutate the ClientHello before sealing, or the sealed packet
+	hello_len = quic_test_client_hello(hello, 1800);
+	for (i = 0; i < QUIC_TEST_FUZZ_NUM; i++) {
+		for (j = 0; j < sizeof(dcid); j++)
+			dcid[j] = quic_test_rand();
+		len = hello_len;
+		memcpy(fuzz, hello, len);
+		if (i & 1) {
+			for (j = quic_test_rand() % 8; j >= 0; j--)
+				fuzz[quic_test_rand() % len] = quic_test_rand();
+			j = quic_test_rand() % 1400;
+			len1 = quic_test_seal(&af_quic_versions[(i >> 1) & 1], dcid, sizeof(dcid), i,
+				fuzz, j, min(len - j, 1400), pkt1);
+		}
+		else {
+			len1 = quic_test_seal(&af_quic_versions[0], dcid, sizeof(dcid), i, hello, 0, 1100, pkt1);
+			for (j = quic_test_rand() % 8; j >= 0; j--)
+				pkt1[quic_test_rand() % len1] = quic_test_rand();
+		}
+		len1 -= quic_test_rand() % 64;
+		if (af_parse_quic_sni(pkt1, len1, sni, sizeof(sni)) >= 0)
+			found++;
+		if (af_parse_client_hello(fuzz, quic_test_rand() % (len + 1), &name, &len2) == 0)
+			found++;
+	}
+	printk("[quic test] fuzz %d packets, %d parsed\n", QUIC_TEST_FUZZ_NUM, found);
+
+	hello_len = quic_test_client_hello(hello, 200);
+	len1 = quic_test_seal(&af_quic_versions[0], rfc_dcid, sizeof(rfc_dcid), 0, hello, 0, hello_len, pkt1);
+	start = ktime_get_ns();
+	for (i = 0; i < QUIC_TEST_BENCH_NUM; i++)
+		af_parse_quic_sni(pkt1, len1, sni, sizeof(sni));
+	cost = ktime_get_ns() - start;
+	printk("[quic bench] quic initial: %llu ns/packet\n", cost / QUIC_TEST_BENCH_NUM);
+	start = ktime_get_ns();
+	for (i = 0; i < QUIC_TEST_BENCH_NUM; i++)
+		af_parse_client_hello(hello, hello_len, &name, &len);
+	cost = ktime_get_ns() - start;
+	printk("[quic bench] tls client hello: %llu ns/packet\n", cost / QUIC_TEST_BENCH_NUM);
+	printk("[quic test] %d failed\n", fail);
+out:
+	kfree(hello);
+	kfree(pkt1);
+	kfree(pkt2);
+	kfree(fuzz);
+}
+#endif
+
+#else
+
+int af_parse_quic_sni(unsigned char *data, int len, char *sni, int sni_size)
+{
+	return -1;
+}
+
+int af_quic_init(void)
+{
+	AF_INFO("quic sni parsing needs the kernel aes and sha256 library\n");
+	return 0;
+}
+
+void af_quic_exit(void)
+{
+}
+
+#ifdef CONFIG_KERNEL_FUNC_TEST
+void TEST_quic_sni(void)
+{
+	printk("[quic test] quic sni parsing is not built\n");
+}
+#endif
+
+#endif
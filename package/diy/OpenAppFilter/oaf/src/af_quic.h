@@ -0,0 +1,17 @@
+#ifndef __AF_QUIC_H__
+#define __AF_QUIC_H__
+
+#define QUIC_MIN_INITIAL_LEN 1200
+
+int af_quic_init(void);
+void af_quic_exit(void);
+/*
+	decrypt a QUIC client Initial packet and copy the server name of the
+	ClientHello it carries into sni, return the name length or -1.
+*/
+int af_parse_quic_sni(unsigned char *data, int len, char *sni, int sni_size);
+#ifdef CONFIG_KERNEL_FUNC_TEST
+void TEST_quic_sni(void);
+#endif
+
+#endif
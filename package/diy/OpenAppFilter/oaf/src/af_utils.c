@@ -5,7 +5,33 @@
 #include <linux/ctype.h>
 #include <linux/string.h>
 #include <linux/version.h>
+#include <linux/netdevice.h>
 #include "af_utils.h"
+
+#if LINUX_VERSION_CODE < KERNEL_VERSION(4,4,0)
+#define netif_is_bridge_master(dev) ((dev)->priv_flags & IFF_EBRIDGE)
+#endif
+
+/*
+	space separated LAN devices which are not bridges, set by the init
+	script through /proc/sys/oaf/lan_ifname
+*/
+char af_lan_ifname[AF_LAN_IFNAME_LEN];
+
+int af_is_lan_dev(const struct net_device *dev)
+{
+	const char *p = af_lan_ifname;
+	int len = strlen(dev->name);
+
+	if (netif_is_bridge_master(dev))
+		return 1;
+	while ((p = strstr(p, dev->name)) != NULL) {
+		if ((p == af_lan_ifname || p[-1] == ' ') && (p[len] == '\0' || p[len] == ' '))
+			return 1;
+		p += len;
+	}
+	return 0;
+}
 u_int32_t af_get_timestamp_sec(void)
 {
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(4,17,0)
@@ -4,6 +4,12 @@ u_int32_t af_get_timestamp_sec(void);
 
 int check_local_network_ip(unsigned int ip);
 
+struct net_device;
+
+#define AF_LAN_IFNAME_LEN 128
+extern char af_lan_ifname[AF_LAN_IFNAME_LEN];
+int af_is_lan_dev(const struct net_device *dev);
+
 void dump_str(char *name, unsigned char *p, int len);
 
 void dump_hex(char *name, unsigned char *p, int len);
@@ -12,6 +12,8 @@
 #include <net/netfilter/nf_conntrack_acct.h>
 #include <linux/skbuff.h>
 #include <net/ip.h>
+#include <net/ipv6.h>
+#include <linux/netfilter_ipv6.h>
 #include <linux/types.h>
 #include <net/sock.h>
 #include <linux/etherdevice.h>
@@ -23,6 +25,8 @@
 #include "af_log.h"
 #include "af_client.h"
 #include "af_client_fs.h"
+#include "af_ac.h"
+#include "af_quic.h"
 
 MODULE_LICENSE("GPL");
 MODULE_AUTHOR("destan19@126.com");
@@ -38,8 +42,59 @@ DEFINE_RWLOCK(af_feature_lock);
 #define feature_list_write_unlock()		write_unlock_bh(&af_feature_lock);
 
 
-#define SET_APPID(mark, appid) (mark = appid)
-#define GET_APPID(mark) (mark)
+#define SET_APPID(mark, appid) (mark = ((mark) & ~APP_FILTER_APPID_MASK) | ((appid) & APP_FILTER_APPID_MASK))
+#define GET_APPID(mark) ((mark) & APP_FILTER_APPID_MASK)
+
+#define AF_REGEXP_META_CHARS "\\.^$*+?["
+
+typedef struct af_url_matcher{
+	af_ac_t host_ac;
+	af_ac_t request_ac;
+}af_url_matcher_t;
+
+static af_url_matcher_t af_url_matcher;
+
+#define AF_FEATURE_BUCKET_HASH_SIZE 64
+#define AF_POS_TABLE_SIZE 256
+#define AF_MAX_CANDIDATE_LIST 4
+
+/*
+	features are dispatched by l4 protocol and destination port, port 0 is
+	the wildcard bucket of a protocol. Position-only features with a rule on
+	the first payload byte are kept in a table indexed by that byte value,
+	all other features of the bucket are in nodes[]. Every list is sorted by
+	seq, so merging them keeps the first-match order of the feature list.
+*/
+typedef struct af_feature_bucket_stat{
+	unsigned long lookup;
+	unsigned long match;
+}af_feature_bucket_stat_t;
+
+typedef struct af_feature_bucket{
+	struct hlist_node hlist;
+	u_int32_t proto;
+	u_int32_t dport;
+	af_feature_node_t **nodes;
+	u_int32_t node_num;
+	af_feature_node_t **pos_nodes;
+	u_int32_t pos_num;
+	u_int32_t pos_index[AF_POS_TABLE_SIZE + 1];
+	// statistics only, per CPU so the packet path does not share a line
+	af_feature_bucket_stat_t __percpu *stat;
+}af_feature_bucket_t;
+
+typedef struct af_feature_index{
+	struct hlist_head hash[AF_FEATURE_BUCKET_HASH_SIZE];
+	u_int32_t bucket_num;
+}af_feature_index_t;
+
+static af_feature_index_t af_feature_index;
+
+typedef struct af_candidate_list{
+	af_feature_node_t **cur;
+	af_feature_node_t **end;
+	af_feature_bucket_t *bucket;
+}af_candidate_list_t;
 
 #if 0
 static void show_feature_list(void)
@@ -86,6 +141,94 @@ static af_feature_node_t* af_find_feature(char *app_id)
 
 
 
+static int af_is_regexp_meta(char c)
+{
+	return c != '\0' && strchr(AF_REGEXP_META_CHARS, c) != NULL;
+}
+
+/*
+	find the longest run of plain characters that every string matched
+	by the pattern has to contain, it is used as the automaton key
+*/
+static char *af_url_literal(char *pattern, int *lit_len)
+{
+	char *p = pattern;
+	char *begin = NULL;
+	char *best = NULL;
+	int best_len = 0;
+
+	while (*p) {
+		if (*p == '[') {
+			begin = NULL;
+			while (*p && *p != ']')
+				p++;
+			if (*p)
+				p++;
+			continue;
+		}
+		if (*p == '\\') {
+			begin = NULL;
+			p++;
+			if (*p)
+				p++;
+			continue;
+		}
+		// optional chars can not be part of the key
+		if (af_is_regexp_meta(*p) || p[1] == '*' || p[1] == '?') {
+			begin = NULL;
+			p++;
+			continue;
+		}
+		if (!begin)
+			begin = p;
+		if (p + 1 - begin > best_len) {
+			best = begin;
+			best_len = p + 1 - begin;
+		}
+		if (p[1] == '+')
+			begin = NULL;
+		p++;
+	}
+	*lit_len = best_len;
+	return best;
+}
+
+static int af_init_url_match(char *pattern, struct RE **re)
+{
+	char *p;
+	int lit_len = 0;
+
+	*re = NULL;
+	if (strlen(pattern) == 0)
+		return AF_URL_MATCH_NONE;
+	for (p = pattern; *p; p++) {
+		if (af_is_regexp_meta(*p))
+			break;
+	}
+	if (*p == '\0')
+		return AF_URL_MATCH_LITERAL;
+
+	*re = regexp_compile(pattern);
+	if (!*re) {
+		AF_ERROR("invalid url feature: %s\n", pattern);
+		return AF_URL_MATCH_NONE;
+	}
+	af_url_literal(pattern, &lit_len);
+	return lit_len > 0 ? AF_URL_MATCH_VERIFY : AF_URL_MATCH_REGEXP;
+}
+
+static char *af_url_key(char *pattern, int type, int *len)
+{
+	*len = 0;
+	if (type == AF_URL_MATCH_LITERAL) {
+		*len = strlen(pattern);
+		return pattern;
+	}
+	if (type == AF_URL_MATCH_VERIFY)
+		return af_url_literal(pattern, len);
+	return NULL;
+}
+
 int __add_app_feature(int appid,
 					char *name,
 					int proto,
@@ -114,6 +257,8 @@ int __add_app_feature(int appid,
 		node->sport = src_port;
 		strcpy(node->host_url, host_url);
 		strcpy(node->request_url, request_url);
+		node->host_match_type = af_init_url_match(node->host_url, &node->host_re);
+		node->request_match_type = af_init_url_match(node->request_url, &node->request_re);
 		// 00:0a-01:11
 		p = dict;
 		begin = dict;
@@ -311,6 +456,232 @@ void load_feature_buf_from_file(char **config_buf)
 	filp_close(fp, NULL);
 }
 
+/*
+	compile the url features of all nodes into the host and request
+	automatons, runs once after the feature file is loaded and before
+	the hooks are registered, so the list is not changing under us.
+*/
+static int af_build_url_matcher(void)
+{
+	af_feature_node_t *node;
+	char *key;
+	int key_len;
+	int host_len = 0;
+	int host_num = 0;
+	int request_len = 0;
+	int request_num = 0;
+	u_int32_t seq = 0;
+
+	list_for_each_entry(node, &af_feature_head, head) {
+		node->seq = seq++;
+		if (af_url_key(node->host_url, node->host_match_type, &key_len)) {
+			host_len += key_len;
+			host_num++;
+		}
+		if (af_url_key(node->request_url, node->request_match_type, &key_len)) {
+			request_len += key_len;
+			request_num++;
+		}
+	}
+	if (af_ac_init(&af_url_matcher.host_ac, host_len, host_num) < 0)
+		return -1;
+	if (af_ac_init(&af_url_matcher.request_ac, request_len, request_num) < 0) {
+		af_ac_free(&af_url_matcher.host_ac);
+		return -1;
+	}
+
+	list_for_each_entry(node, &af_feature_head, head) {
+		key = af_url_key(node->host_url, node->host_match_type, &key_len);
+		if (key)
+			af_ac_add(&af_url_matcher.host_ac, key, key_len, node->seq);
+		key = af_url_key(node->request_url, node->request_match_type, &key_len);
+		if (key)
+			af_ac_add(&af_url_matcher.request_ac, key, key_len, node->seq);
+	}
+	af_ac_compile(&af_url_matcher.host_ac);
+	af_ac_compile(&af_url_matcher.request_ac);
+	AF_INFO("build url matcher ok, features = %u, host states = %u, request states = %u\n",
+		seq, af_url_matcher.host_ac.state_num, af_url_matcher.request_ac.state_num);
+	return 0;
+}
+
+static void af_free_url_matcher(void)
+{
+	af_ac_free(&af_url_matcher.host_ac);
+	af_ac_free(&af_url_matcher.request_ac);
+}
+
+static inline u_int32_t af_feature_bucket_hash(u_int32_t proto, u_int32_t dport)
+{
+	return (dport ^ (dport >> 6) ^ proto) & (AF_FEATURE_BUCKET_HASH_SIZE - 1);
+}
+
+static af_feature_bucket_t *af_find_feature_bucket(u_int32_t proto, u_int32_t dport)
+{
+	af_feature_bucket_t *bucket;
+	u_int32_t index = af_feature_bucket_hash(proto, dport);
+
+	hlist_for_each_entry(bucket, &af_feature_index.hash[index], hlist) {
+		if (bucket->proto == proto && bucket->dport == dport)
+			return bucket;
+	}
+	return NULL;
+}
+
+// value of the first payload byte the node requires, -1 if none
+static int af_feature_first_byte(af_feature_node_t *node)
+{
+	int i;
+	if (node->host_url[0] || node->request_url[0])
+		return -1;
+	for (i = 0; i < node->pos_num; i++) {
+		if (node->pos_info[i].pos == 0)
+			return node->pos_info[i].value;
+	}
+	return -1;
+}
+
+static void af_free_feature_index(void)
+{
+	int i;
+	af_feature_bucket_t *bucket;
+	struct hlist_node *n;
+
+	for (i = 0; i < AF_FEATURE_BUCKET_HASH_SIZE; i++) {
+		hlist_for_each_entry_safe(bucket, n, &af_feature_index.hash[i], hlist) {
+			hlist_del(&bucket->hlist);
+			kfree(bucket->nodes);
+			kfree(bucket->pos_nodes);
+			free_percpu(bucket->stat);
+			kfree(bucket);
+		}
+	}
+	af_feature_index.bucket_num = 0;
+}
+
+/*
+	build the protocol/port index, like af_build_url_matcher() it runs
+	before the hooks are registered.
+*/
+static int af_build_feature_index(void)
+{
+	int i;
+	int value;
+	af_feature_node_t *node;
+	af_feature_bucket_t *bucket;
+	u_int32_t index;
+	u_int32_t count;
+	u_int32_t sum;
+
+	for (i = 0; i < AF_FEATURE_BUCKET_HASH_SIZE; i++)
+		INIT_HLIST_HEAD(&af_feature_index.hash[i]);
+
+	// count nodes per bucket, pos_index[] temporarily holds the counts
+	list_for_each_entry(node, &af_feature_head, head) {
+		bucket = af_find_feature_bucket(node->proto, node->dport);
+		if (!bucket) {
+			bucket = kzalloc(sizeof(af_feature_bucket_t), GFP_KERNEL);
+			if (!bucket)
+				goto FAIL;
+			bucket->stat = alloc_percpu(af_feature_bucket_stat_t);
+			if (!bucket->stat) {
+				kfree(bucket);
+				goto FAIL;
+			}
+			bucket->proto = node->proto;
+			bucket->dport = node->dport;
+			index = af_feature_bucket_hash(node->proto, node->dport);
+			hlist_add_head(&bucket->hlist, &af_feature_index.hash[index]);
+			af_feature_index.bucket_num++;
+		}
+		value = af_feature_first_byte(node);
+		if (value >= 0) {
+			bucket->pos_index[value + 1]++;
+			bucket->pos_num++;
+		}
+		else {
+			bucket->node_num++;
+		}
+	}
+
+	for (i = 0; i < AF_FEATURE_BUCKET_HASH_SIZE; i++) {
+		hlist_for_each_entry(bucket, &af_feature_index.hash[i], hlist) {
+			if (bucket->node_num) {
+				bucket->nodes = kcalloc(bucket->node_num, sizeof(af_feature_node_t *), GFP_KERNEL);
+				if (!bucket->nodes)
+					goto FAIL;
+			}
+			if (bucket->pos_num) {
+				bucket->pos_nodes = kcalloc(bucket->pos_num, sizeof(af_feature_node_t *), GFP_KERNEL);
+				if (!bucket->pos_nodes)
+					goto FAIL;
+			}
+			for (value = 0, sum = 0; value <= AF_POS_TABLE_SIZE; value++) {
+				sum += bucket->pos_index[value];
+				bucket->pos_index[value] = sum;
+			}
+			bucket->node_num = 0;
+		}
+	}
+
+	// list order is seq order, so every slice ends up sorted by seq
+	list_for_each_entry(node, &af_feature_head, head) {
+		bucket = af_find_feature_bucket(node->proto, node->dport);
+		value = af_feature_first_byte(node);
+		if (value >= 0) {
+			count = bucket->pos_index[value]++;
+			bucket->pos_nodes[count] = node;
+		}
+		else {
+			bucket->nodes[bucket->node_num++] = node;
+		}
+	}
+	// pos_index[v] now points at the end of slice v, shift it back
+	for (i = 0; i < AF_FEATURE_BUCKET_HASH_SIZE; i++) {
+		hlist_for_each_entry(bucket, &af_feature_index.hash[i], hlist) {
+			for (value = AF_POS_TABLE_SIZE; value > 0; value--)
+				bucket->pos_index[value] = bucket->pos_index[value - 1];
+			bucket->pos_index[0] = 0;
+		}
+	}
+	AF_INFO("build feature index ok, bucket num = %u\n", af_feature_index.bucket_num);
+	return 0;
+FAIL:
+	AF_ERROR("alloc feature index failed\n");
+	af_free_feature_index();
+	return -1;
+}
+
+int af_dump_feature_index(char *buf, int size)
+{
+	int i;
+	int cpu;
+	int len = 0;
+	unsigned long lookup;
+	unsigned long match;
+	af_feature_bucket_t *bucket;
+
+	len += scnprintf(buf + len, size - len, "%-6s%-8s%-8s%-8s%-12s%-12s\n",
+		"proto", "dport", "nodes", "pos", "lookup", "match");
+	feature_list_read_lock();
+	for (i = 0; i < AF_FEATURE_BUCKET_HASH_SIZE; i++) {
+		hlist_for_each_entry(bucket, &af_feature_index.hash[i], hlist) {
+			lookup = 0;
+			match = 0;
+			for_each_possible_cpu(cpu) {
+				lookup += per_cpu_ptr(bucket->stat, cpu)->lookup;
+				match += per_cpu_ptr(bucket->stat, cpu)->match;
+			}
+			len += scnprintf(buf + len, size - len, "%-6s%-8u%-8u%-8u%-12lu%-12lu\n",
+				bucket->proto == IPPROTO_TCP ? "tcp" : "udp",
+				bucket->dport, bucket->node_num, bucket->pos_num,
+				lookup, match);
+		}
+	}
+	feature_list_read_unlock();
+	return len;
+}
+
 int load_feature_config(void)
 {
 	char *feature_buf = NULL;
@@ -339,16 +710,18 @@ int load_feature_config(void)
 		}
 	}
 	if (p != begin) {
-		if (p - begin < MIN_FEATURE_LINE_LEN || p - begin > MAX_FEATURE_LINE_LEN ) 
-			return 0;
-		memset(line, 0x0, sizeof(line));
-		strncpy(line, begin, p - begin);
-		af_init_feature(line);
+		if (p - begin >= MIN_FEATURE_LINE_LEN && p - begin <= MAX_FEATURE_LINE_LEN) {
+			memset(line, 0x0, sizeof(line));
+			strncpy(line, begin, p - begin);
+			af_init_feature(line);
+		}
 		begin = p + 1;
 	}
 	if (feature_buf)
 		kfree(feature_buf);
-	return 0;
+	if (af_build_url_matcher() < 0)
+		return -1;
+	return af_build_feature_index();
 }
 
 static void af_clean_feature_list(void)
@@ -358,12 +731,73 @@ static void af_clean_feature_list(void)
 	while(!list_empty(&af_feature_head)) {
 		node = list_first_entry(&af_feature_head, af_feature_node_t, head);
 		list_del(&(node->head));
+		if (node->host_re)
+			regexp_release(node->host_re);
+		if (node->request_re)
+			regexp_release(node->request_re);
 		kfree(node);
 	}
+	af_free_feature_index();
 	feature_list_write_unlock();
+	af_free_url_matcher();
 }
 
 
+static int parse_flow_base_ipv6(struct sk_buff *skb, flow_info_t *flow)
+{
+	struct tcphdr * tcph = NULL;
+	struct udphdr * udph = NULL;
+	struct ipv6hdr *ip6h = NULL;
+	u_int8_t nexthdr;
+	__be16 frag_off = 0;
+	int offset;
+	int payload_end;
+
+	ip6h = ipv6_hdr(skb);
+	if (!ip6h) {
+		return -1;
+	}
+	nexthdr = ip6h->nexthdr;
+	offset = ipv6_skip_exthdr(skb, sizeof(struct ipv6hdr), &nexthdr, &frag_off);
+	// only the first fragment carries the l4 header
+	if (offset < 0 || (frag_off & htons(~0x7)) != 0) {
+		return -1;
+	}
+	flow->family = AF_INET6;
+	flow->src6 = ip6h->saddr;
+	flow->dst6 = ip6h->daddr;
+	flow->l4_protocol = nexthdr;
+	payload_end = sizeof(struct ipv6hdr) + ntohs(ip6h->payload_len);
+	switch (nexthdr) {
+		case IPPROTO_TCP:
+			if (offset + sizeof(struct tcphdr) > skb_headlen(skb))
+				return -1;
+			tcph = (struct tcphdr *)(skb->data + offset);
+			flow->l4_data = skb->data + offset + tcph->doff * 4;
+			flow->l4_len = payload_end - offset - tcph->doff * 4;
+			flow->dport = htons(tcph->dest);
+			flow->sport = htons(tcph->source);
+			break;
+		case IPPROTO_UDP:
+			if (offset + sizeof(struct udphdr) > skb_headlen(skb))
+				return -1;
+			udph = (struct udphdr *)(skb->data + offset);
+			flow->l4_data = skb->data + offset + 8;
+			flow->l4_len = payload_end - offset - 8;
+			flow->dport = htons(udph->dest);
+			flow->sport = htons(udph->source);
+			break;
+		default:
+			return -1;
+	}
+	// the payload parsers only look at the linear part
+	if (flow->l4_len > skb_tail_pointer(skb) - flow->l4_data)
+		flow->l4_len = skb_tail_pointer(skb) - flow->l4_data;
+	if (flow->l4_len < 0)
+		flow->l4_len = 0;
+	return 0;
+}
+
 int parse_flow_base(struct sk_buff *skb, flow_info_t *flow) 
 {
 	struct tcphdr * tcph = NULL;
@@ -382,11 +816,20 @@ int parse_flow_base(struct sk_buff *skb, flow_info_t *flow)
 	if (!ct) {
 		return -1;
 	}
+	flow->ct = ct;
+	// ipv6 clients are looked up by the mac they are sending from
+	if (skb->dev && af_is_lan_dev(skb->dev) && skb_mac_header_was_set(skb)) {
+		memcpy(flow->smac, eth_hdr(skb)->h_source, MAC_ADDR_LEN);
+		flow->smac_valid = AF_TRUE;
+	}
+	if (skb->protocol == htons(ETH_P_IPV6))
+		return parse_flow_base_ipv6(skb, flow);
+
 	iph = ip_hdr(skb);
 	if (!iph) {
 		return -1;
 	}
-	flow->ct = ct;
+	flow->family = AF_INET;
 	flow->src = iph->saddr;
 	flow->dst = iph->daddr;
 	flow->l4_protocol = iph->protocol;
@@ -397,62 +840,125 @@ int parse_flow_base(struct sk_buff *skb, flow_info_t *flow)
 			flow->l4_len =  ntohs(iph->tot_len) - iph->ihl * 4 - tcph->doff * 4;
 			flow->dport = htons(tcph->dest);
 			flow->sport = htons(tcph->source);
-			return 0;
+			break;
 		case IPPROTO_UDP:
 			udph = (struct udphdr *)(iph + 1);
 			flow->l4_data = skb->data + iph->ihl * 4 + 8;
 			flow->l4_len = ntohs(udph->len) - 8;
 			flow->dport = htons(udph->dest);
 			flow->sport = htons(udph->source);
-			return 0;
-		case IPPROTO_ICMP:
 			break;
+		case IPPROTO_ICMP:
+			return -1;
 		default:
 			return -1;
 	}
-	return -1;
+	if (flow->l4_len > skb_tail_pointer(skb) - flow->l4_data)
+		flow->l4_len = skb_tail_pointer(skb) - flow->l4_data;
+	if (flow->l4_len < 0)
+		flow->l4_len = 0;
+	return 0;
 }
 
+static inline u_int16_t af_get_u16(unsigned char *p)
+{
+	return (p[0] << 8) | p[1];
+}
+
+/*
+	walk a TLS ClientHello handshake message by its length fields and
+	return the host name of the server_name extension. p starts at the
+	handshake type, len may be shorter than the message when it is split
+	over several segments.
+*/
+int af_parse_client_hello(unsigned char *p, int len, char **sni, int *sni_len)
+{
+	int pos;
+	int ext_end;
+	int ext_type;
+	int ext_len;
+	int name_len;
+
+	if (len < TLS_HANDSHAKE_HEADER_LEN || p[0] != TLS_HANDSHAKE_CLIENT_HELLO)
+		return -1;
+	pos = TLS_HANDSHAKE_HEADER_LEN + TLS_CLIENT_VERSION_LEN + TLS_RANDOM_LEN;
+	// session id
+	if (pos + 1 > len)
+		return -1;
+	pos += 1 + p[pos];
+	// cipher suites
+	if (pos + 2 > len)
+		return -1;
+	pos += 2 + af_get_u16(p + pos);
+	// compression methods
+	if (pos + 1 > len)
+		return -1;
+	pos += 1 + p[pos];
+	if (pos + 2 > len)
+		return -1;
+	ext_end = pos + 2 + af_get_u16(p + pos);
+	pos += 2;
+	if (ext_end > len)
+		ext_end = len;
+
+	while (pos + 4 <= ext_end) {
+		ext_type = af_get_u16(p + pos);
+		ext_len = af_get_u16(p + pos + 2);
+		pos += 4;
+		if (pos + ext_len > ext_end)
+			return -1;
+		if (ext_type == TLS_EXT_SERVER_NAME) {
+			// list length(2) + name type(1) + name length(2)
+			if (ext_len < 5 || p[pos + 2] != TLS_SNI_HOST_NAME)
+				return -1;
+			name_len = af_get_u16(p + pos + 3);
+			if (name_len == 0 || 5 + name_len > ext_len)
+				return -1;
+			*sni = (char *)p + pos + 5;
+			*sni_len = name_len;
+			return 0;
+		}
+		pos += ext_len;
+	}
+	return -1;
+}
 
 int parse_https_proto(flow_info_t *flow) {
-	int i ;
-	short url_len = 0 ;
-	char * p = flow->l4_data;
-	int data_len = flow->l4_len;
-	
+	unsigned char *p = NULL;
+	int data_len = 0;
+	int record_len = 0;
+	char *sni = NULL;
+	int sni_len = 0;
+
 	if (NULL == flow) {
 		AF_ERROR("flow is NULL\n");
 		return -1;
 	}
-	if (NULL == p || data_len == 0) {
+	p = flow->l4_data;
+	data_len = flow->l4_len;
+	if (NULL == p || data_len < TLS_RECORD_HEADER_LEN) {
 		return -1;
 	}
-	if (!(p[0] == 0x16 && p[1] == 0x03 && p[2] == 0x01))
-		return -1;
-	
-	for(i = 0; i < data_len; i++) {
-		if(i + HTTPS_URL_OFFSET >= data_len) {
+	if (flow->l4_protocol == IPPROTO_UDP) {
+		sni_len = af_parse_quic_sni(p, data_len, flow->sni_buf, sizeof(flow->sni_buf));
+		if (sni_len <= 0)
 			return -1;
-		}
-		
-		if(p[i] == 0x0 && p[i + 1] == 0x0 && p[i + 2] == 0x0 && p[i + 3] != 0x0) {
-			// 2 bytes
-			memcpy(&url_len , p + i + HTTPS_LEN_OFFSET, 2);
-			if(ntohs(url_len) <= 0 || ntohs(url_len) > data_len) {
-				continue ;
-			}
-			
-			if(i + HTTPS_URL_OFFSET + ntohs(url_len) < data_len) {
-				//dump_hex("https hex", p, data_len);
-				flow->https.match = AF_TRUE;
-				flow->https.url_pos = p + i + HTTPS_URL_OFFSET;
-			//	dump_str("https url2", flow->https.url_pos, ntohs(url_len));
-				flow->https.url_len = ntohs(url_len);
-				return 0;              
-			}
-		}
+		sni = flow->sni_buf;
 	}
-	return -1;
+	else {
+		// handshake record, ssl 3.0 up to tls 1.3 record versions
+		if (p[0] != TLS_CONTENT_TYPE_HANDSHAKE || p[1] != 0x03 || p[2] > 0x04)
+			return -1;
+		record_len = af_get_u16(p + 3);
+		if (record_len > data_len - TLS_RECORD_HEADER_LEN)
+			record_len = data_len - TLS_RECORD_HEADER_LEN;
+		if (af_parse_client_hello(p + TLS_RECORD_HEADER_LEN, record_len, &sni, &sni_len) < 0)
+			return -1;
+	}
+	flow->https.match = AF_TRUE;
+	flow->https.url_pos = sni;
+	flow->https.url_len = sni_len;
+	return 0;
 }
 
 
@@ -601,45 +1107,117 @@ int af_match_by_pos(flow_info_t *flow, af_feature_node_t *node)
 	return AF_FALSE;
 }
 
-int af_match_by_url(flow_info_t *flow, af_feature_node_t *node)
+static void af_copy_url(char *buf, char *pos, int len)
 {
-	char reg_url_buf[MAX_URL_MATCH_LEN] = {0};
+	if (len >= MAX_URL_MATCH_LEN)
+		strncpy(buf, pos, MAX_URL_MATCH_LEN - 1);
+	else
+		strncpy(buf, pos, len);
+}
 
-	if (!flow || !node)
-		return AF_FALSE;
+static void af_url_search(af_ac_t *ac, char *text, af_url_hits_t *hits)
+{
+	int i, j, num;
+	u_int32_t id;
+
+	hits->num = 0;
+	if (text[0] == '\0')
+		return;
+	num = af_ac_search(ac, text, strlen(text), hits->ids, MAX_URL_HIT_NUM);
+	if (num <= 0) {
+		hits->num = num;
+		return;
+	}
+	// sort and unique the hits so that each node can bsearch them
+	for (i = 1; i < num; i++) {
+		id = hits->ids[i];
+		for (j = i; j > 0 && hits->ids[j - 1] > id; j--)
+			hits->ids[j] = hits->ids[j - 1];
+		hits->ids[j] = id;
+	}
+	for (i = 1, j = 0; i < num; i++) {
+		if (hits->ids[i] != hits->ids[j])
+			hits->ids[++j] = hits->ids[i];
+	}
+	hits->num = j + 1;
+}
+
+/*
+	extract the host and request url once per packet and run them through
+	the automatons, af_match_by_url() then only looks up the hit list.
+*/
+static void af_prepare_url_match(flow_info_t *flow)
+{
 	// match host or https url
-	if (flow->https.match == AF_TRUE && flow->https.url_pos) {
-		if (flow->https.url_len >= MAX_URL_MATCH_LEN)
-			strncpy(reg_url_buf, flow->https.url_pos, MAX_URL_MATCH_LEN - 1);
+	if (flow->https.match == AF_TRUE && flow->https.url_pos)
+		af_copy_url(flow->host_buf, flow->https.url_pos, flow->https.url_len);
+	else if (flow->http.match == AF_TRUE && flow->http.host_pos)
+		af_copy_url(flow->host_buf, flow->http.host_pos, flow->http.host_len);
+	// match request url
+	if (flow->http.match == AF_TRUE && flow->http.url_pos)
+		af_copy_url(flow->url_buf, flow->http.url_pos, flow->http.url_len);
+
+	af_url_search(&af_url_matcher.host_ac, flow->host_buf, &flow->host_hits);
+	af_url_search(&af_url_matcher.request_ac, flow->url_buf, &flow->url_hits);
+}
+
+static int af_url_hit(af_url_hits_t *hits, u_int32_t seq)
+{
+	int low = 0;
+	int high = hits->num - 1;
+	int mid;
+
+	while (low <= high) {
+		mid = (low + high) / 2;
+		if (hits->ids[mid] == seq)
+			return AF_TRUE;
+		if (hits->ids[mid] < seq)
+			low = mid + 1;
 		else
-			strncpy(reg_url_buf, flow->https.url_pos, flow->https.url_len);
+			high = mid - 1;
 	}
-	else if (flow->http.match == AF_TRUE && flow->http.host_pos) {
-		if (flow->http.host_len >= MAX_URL_MATCH_LEN)
-			strncpy(reg_url_buf, flow->http.host_pos, MAX_URL_MATCH_LEN - 1);
-		else
-			strncpy(reg_url_buf, flow->http.host_pos, flow->http.host_len);
+	return AF_FALSE;
+}
+
+static int af_match_url_pattern(af_url_hits_t *hits, char *text,
+			char *pattern, int type, struct RE *re, u_int32_t seq)
+{
+	if (text[0] == '\0')
+		return AF_FALSE;
+
+	switch (type) {
+	case AF_URL_MATCH_LITERAL:
+		if (hits->num < 0)
+			return strstr(text, pattern) != NULL;
+		return af_url_hit(hits, seq);
+	case AF_URL_MATCH_VERIFY:
+		if (hits->num >= 0 && !af_url_hit(hits, seq))
+			return AF_FALSE;
+		return regexp_exec(re, text);
+	case AF_URL_MATCH_REGEXP:
+		return regexp_exec(re, text);
+	default:
+		return AF_FALSE;
 	}
-	if (strlen(reg_url_buf) > 0 && strlen(node->host_url) > 0 
-				&& regexp_match(node->host_url, reg_url_buf)){
+}
+
+int af_match_by_url(flow_info_t *flow, af_feature_node_t *node)
+{
+	if (!flow || !node)
+		return AF_FALSE;
+
+	if (af_match_url_pattern(&flow->host_hits, flow->host_buf, node->host_url,
+			node->host_match_type, node->host_re, node->seq)){
 		AF_DEBUG("match url:%s	 reg = %s, appid=%d\n", 
-			reg_url_buf, node->host_url, node->app_id);
+			flow->host_buf, node->host_url, node->app_id);
 		return AF_TRUE;
 	}
-	
-	// match request url
-	if (flow->http.match == AF_TRUE && flow->http.url_pos) {
-		memset(reg_url_buf, 0x0, sizeof(reg_url_buf));
-		if (flow->http.url_len >= MAX_URL_MATCH_LEN)
-			strncpy(reg_url_buf, flow->http.url_pos, MAX_URL_MATCH_LEN - 1);
-		else
-			strncpy(reg_url_buf, flow->http.url_pos, flow->http.url_len);
-		if(strlen(reg_url_buf) > 0 && strlen(node->request_url)
-				&& regexp_match(node->request_url, reg_url_buf)){
-			AF_DEBUG("match request:%s   reg:%s appid=%d\n",
-						reg_url_buf, node->request_url, node->app_id);
-			return AF_TRUE;
-		}
+
+	if (af_match_url_pattern(&flow->url_hits, flow->url_buf, node->request_url,
+			node->request_match_type, node->request_re, node->seq)){
+		AF_DEBUG("match request:%s   reg:%s appid=%d\n",
+					flow->url_buf, node->request_url, node->app_id);
+		return AF_TRUE;
 	}
 	return AF_FALSE;
 }
@@ -678,44 +1256,140 @@ int af_match_one(flow_info_t *flow, af_feature_node_t *node)
 	return ret;
 }
 
-int app_filter_match(flow_info_t *flow)
+static af_client_info_t *af_find_src_client(int family, u_int32_t src,
+			unsigned char *smac, u_int8_t smac_valid)
+{
+	if (family == AF_INET6)
+		return smac_valid ? find_af_client(smac) : NULL;
+	return find_af_client_by_ip(src);
+}
+
+static af_client_info_t *af_find_flow_client(flow_info_t *flow)
+{
+	return af_find_src_client(flow->family, flow->src, flow->smac, flow->smac_valid);
+}
+
+/*
+	apply the user/app rules to an identified flow, this is cheap and is
+	also run for flows whose app id comes from the conntrack cache so that
+	rule changes still take effect on established flows.
+*/
+static int af_match_app_rule(flow_info_t *flow)
 {
-	af_feature_node_t *n,*node;
 	af_client_info_t *client = NULL;
+
+	flow->drop = AF_FALSE;
+	rcu_read_lock();
+	client = af_find_flow_client(flow);
+	if (!client) {
+		rcu_read_unlock();
+		return AF_FALSE;
+	}
+	if (is_user_match_enable() && !find_af_mac(client->mac)){
+		AF_DEBUG("not match mac:"MAC_FMT"\n", MAC_ARRAY(client->mac));
+		rcu_read_unlock();
+		return AF_FALSE;
+	}
+	rcu_read_unlock();
+	if (af_get_app_status(flow->app_id)){
+		flow->drop = AF_TRUE;
+		return AF_TRUE;
+	}
+	return AF_FALSE;
+}
+
+static int af_add_candidate_bucket(flow_info_t *flow, af_feature_bucket_t *bucket,
+			af_candidate_list_t *list)
+{
+	int num = 0;
+	unsigned char value;
+
+	if (!bucket)
+		return 0;
+	this_cpu_inc(bucket->stat->lookup);
+	if (bucket->node_num) {
+		list[num].cur = bucket->nodes;
+		list[num].end = bucket->nodes + bucket->node_num;
+		list[num].bucket = bucket;
+		num++;
+	}
+	value = flow->l4_data[0];
+	if (bucket->pos_index[value] != bucket->pos_index[value + 1]) {
+		list[num].cur = bucket->pos_nodes + bucket->pos_index[value];
+		list[num].end = bucket->pos_nodes + bucket->pos_index[value + 1];
+		list[num].bucket = bucket;
+		num++;
+	}
+	return num;
+}
+
+// pop the candidate with the lowest seq from the sorted lists
+static af_feature_node_t *af_next_candidate(af_candidate_list_t *list, int num,
+			af_feature_bucket_t **bucket)
+{
+	int i;
+	af_candidate_list_t *min = NULL;
+
+	for (i = 0; i < num; i++) {
+		if (list[i].cur == list[i].end)
+			continue;
+		if (!min || (*list[i].cur)->seq < (*min->cur)->seq)
+			min = &list[i];
+	}
+	if (!min)
+		return NULL;
+	*bucket = min->bucket;
+	return *min->cur++;
+}
+
+int app_filter_match(flow_info_t *flow)
+{
+	af_feature_node_t *node;
+	af_feature_bucket_t *bucket = NULL;
+	af_candidate_list_t list[AF_MAX_CANDIDATE_LIST];
+	int num = 0;
+
+	flow->drop = AF_FALSE;
+	if (flow->l4_len == 0)
+		return AF_FALSE;
 	feature_list_read_lock();
-	if(!list_empty(&af_feature_head)) { 
-		list_for_each_entry_safe(node, n, &af_feature_head, head) {
-			if(af_match_one(flow, node)) 
-			{
-				flow->app_id = node->app_id;
-				strncpy(flow->app_name, node->app_name, sizeof(flow->app_name) - 1);
-				client = find_af_client_by_ip(flow->src);
-				if (!client){
-					goto EXIT;
-				}
-				if (is_user_match_enable() && !find_af_mac(client->mac)){
-					AF_DEBUG("not match mac:"MAC_FMT"\n", MAC_ARRAY(client->mac));
-					goto EXIT;
-				}
-				if (af_get_app_status(node->app_id)){
-					flow->drop = AF_TRUE;
-					feature_list_read_unlock();
-					return AF_TRUE;
-				}
-				else {
-					goto EXIT;
-				}
-			}
-			
+	af_prepare_url_match(flow);
+	num += af_add_candidate_bucket(flow,
+		af_find_feature_bucket(flow->l4_protocol, flow->dport), list + num);
+	if (flow->dport != 0)
+		num += af_add_candidate_bucket(flow,
+			af_find_feature_bucket(flow->l4_protocol, 0), list + num);
+
+	while ((node = af_next_candidate(list, num, &bucket)) != NULL) {
+		if(af_match_one(flow, node)) 
+		{
+			this_cpu_inc(bucket->stat->match);
+			flow->app_id = node->app_id;
+			strncpy(flow->app_name, node->app_name, sizeof(flow->app_name) - 1);
+			feature_list_read_unlock();
+			return af_match_app_rule(flow);
 		}
 	}
-EXIT:
-	flow->drop = AF_FALSE;
 	feature_list_read_unlock();
 	return AF_FALSE;
 }
 
+/*
+	ct->mark layout used to cache the classification of a flow:
+	bit 31       drop verdict
+	bit 30       classification finished, skip the dpi for this flow
+	bits 24-29   number of payload packets inspected so far
+	bits 0-15    app id
+*/
 #define APP_FILTER_DROP_BITS 0x80000000
+#define APP_FILTER_DONE_BITS 0x40000000
+#define APP_FILTER_PKT_SHIFT 24
+#define APP_FILTER_PKT_MASK 0x3f000000
+#define APP_FILTER_APPID_MASK 0x0000ffff
+
+#define GET_PARSE_PKT_NUM(mark) (((mark) & APP_FILTER_PKT_MASK) >> APP_FILTER_PKT_SHIFT)
+#define SET_PARSE_PKT_NUM(mark, num) \
+	(mark = ((mark) & ~APP_FILTER_PKT_MASK) | (((num) << APP_FILTER_PKT_SHIFT) & APP_FILTER_PKT_MASK))
 
 
 
@@ -731,36 +1405,28 @@ static int af_get_visit_index(af_client_info_t *node, int app_id){
 }
 
 
-int __af_update_client_app_info(flow_info_t *flow, af_client_info_t *node)
+static int __af_update_client_app_info(af_client_info_t *node, u_int32_t app_id,
+			u_int8_t drop, u_int32_t pkts, u_int32_t bytes)
 {
-	int i;
 	int index = -1;
 	if(!node)
 		return -1;
-	if(!flow)
-		return -1;
-	int found = 0;
-	index = af_get_visit_index(node, flow->app_id);
+	index = af_get_visit_index(node, app_id);
 
 	if(index < 0 || index >= MAX_RECORD_APP_NUM){
 		AF_ERROR("invalid index:%d\n\n", index);
 		return 0;
 	}
 	// todo: up bytes
-	node->visit_info[index].total_down_bytes += flow->l4_len + 66;
-	//AF_ERROR("%s %pI4(%d)--> %pI4(%d) len = %d\n ", IPPROTO_TCP == flow->l4_protocol ? "tcp" :"udp",
-	//	&flow->src, flow->sport, &flow->dst, flow->dport,  flow->l4_len);
-//	AF_ERROR("index = %d, appid:%d, total:%d KB, cur len=%d\n",index,
-	///	flow->app_id, node->visit_info[index].total_down_bytes / 1024, flow->l4_len);
-	//}
-	node->visit_info[index].total_num++;
-	if(flow->drop)
-		node->visit_info[index].drop_num++;
+	node->visit_info[index].total_down_bytes += bytes;
+	node->visit_info[index].total_num += pkts;
+	if(drop)
+		node->visit_info[index].drop_num += pkts;
 	
-	node->visit_info[index].app_id = flow->app_id;
+	node->visit_info[index].app_id = app_id;
 	node->visit_info[index].latest_time = af_get_timestamp_sec();
-	node->visit_info[index].latest_action = flow->drop;
-	AF_INFO("[%d] %pI4 visit %s(%d), time=%d action=%s, %d/%d\n", index, &node->ip, flow->app_name, flow->app_id, 
+	node->visit_info[index].latest_action = drop;
+	AF_INFO("[%d] %pI4 visit %d, time=%d action=%s, %d/%d\n", index, &node->ip, app_id,
 		node->visit_info[index].latest_time, node->visit_info[index].latest_action ? "Drop" : "Accept",
 		node->visit_info[index].drop_num, node->visit_info[index].total_num);
 	// todo: history
@@ -769,26 +1435,160 @@ int __af_update_client_app_info(flow_info_t *flow, af_client_info_t *node)
 
 void af_update_client_app_info(flow_info_t *flow)
 {
-	int i;
-	int index = 0;
 	af_client_info_t *node = NULL;
 	if(!flow)
 		return;
 	if(flow->app_id <= 0)
 		return;
 	AF_CLIENT_LOCK_W();
-	node = find_af_client_by_ip(flow->src);
+	node = af_find_flow_client(flow);
 	if(node){
-		__af_update_client_app_info(flow, node);
+		__af_update_client_app_info(node, flow->app_id, flow->drop, 1, flow->l4_len + 66);
 	}
 	AF_CLIENT_UNLOCK_W();
 }
 
+#define AF_VISIT_BATCH_PKTS 16
+
+/*
+	packets of flows classified before are accounted per CPU and added to
+	the client in one go, so the client write lock is taken once per
+	AF_VISIT_BATCH_PKTS packets or once a second for a busy flow instead of
+	for every packet. A batch is flushed early when a packet of another
+	client or app comes in on the same CPU.
+*/
+typedef struct af_visit_batch{
+	int family;
+	u_int32_t src;
+	unsigned char smac[MAC_ADDR_LEN];
+	u_int8_t smac_valid;
+	u_int32_t app_id;
+	u_int32_t pkts;
+	u_int32_t bytes;
+	unsigned long start;
+}af_visit_batch_t;
+
+static DEFINE_PER_CPU(af_visit_batch_t, af_visit_batch);
+
+static void af_flush_visit_batch(af_visit_batch_t *batch)
+{
+	af_client_info_t *node = NULL;
+
+	if (batch->pkts == 0)
+		return;
+	AF_CLIENT_LOCK_W();
+	node = af_find_src_client(batch->family, batch->src, batch->smac, batch->smac_valid);
+	if (node)
+		__af_update_client_app_info(node, batch->app_id, AF_FALSE, batch->pkts, batch->bytes);
+	AF_CLIENT_UNLOCK_W();
+	batch->pkts = 0;
+	batch->bytes = 0;
+}
+
+/* called with BH disabled, see af_flow_scratch */
+static void af_batch_client_app_info(flow_info_t *flow)
+{
+	af_visit_batch_t *batch = this_cpu_ptr(&af_visit_batch);
+
+	if (batch->pkts == 0 || batch->app_id != flow->app_id || batch->family != flow->family ||
+		(flow->family == AF_INET6 ? (batch->smac_valid != flow->smac_valid ||
+			memcmp(batch->smac, flow->smac, MAC_ADDR_LEN)) : batch->src != flow->src)) {
+		af_flush_visit_batch(batch);
+		batch->family = flow->family;
+		batch->src = flow->src;
+		memcpy(batch->smac, flow->smac, MAC_ADDR_LEN);
+		batch->smac_valid = flow->smac_valid;
+		batch->app_id = flow->app_id;
+		batch->start = jiffies;
+	}
+	batch->pkts++;
+	batch->bytes += flow->l4_len + 66;
+	if (batch->pkts >= AF_VISIT_BATCH_PKTS || time_after(jiffies, batch->start + HZ)) {
+		af_flush_visit_batch(batch);
+		batch->start = jiffies;
+	}
+}
+
 
 
 int af_send_msg_to_user(char *pbuf, uint16_t len);
 
 
+/*
+	flow_info_t is too big for the softirq stack of small targets, every CPU
+	has one scratch flow instead. The caller disables BH, so the flow is not
+	reused before the verdict.
+*/
+static DEFINE_PER_CPU(flow_info_t, af_flow_scratch);
+
+static u_int32_t af_filter_flow(struct sk_buff *skb, struct nf_conn *ct, flow_info_t *flow)
+{
+	int parse_pkt_num = 0;
+	int account = 1;
+
+	memset((char *)flow, 0x0, sizeof(flow_info_t));
+	if(parse_flow_base(skb, flow) < 0){
+		return NF_ACCEPT;
+	}
+
+#if defined(CONFIG_NF_CONNTRACK_MARK)
+	if (ct->mark & APP_FILTER_DONE_BITS) {
+		// classified before, only the rules need to be checked again.
+		// the visit is accounted in per-CPU batches, a flow newly
+		// dropped by a changed rule is accounted at once.
+		flow->app_id = GET_APPID(ct->mark);
+		if (flow->app_id == 0)
+			return NF_ACCEPT;
+		af_match_app_rule(flow);
+		account = 0;
+		goto VERDICT;
+	}
+	if (flow->l4_len > 0) {
+		parse_pkt_num = GET_PARSE_PKT_NUM(ct->mark) + 1;
+		SET_PARSE_PKT_NUM(ct->mark, parse_pkt_num);
+	}
+#endif
+
+	parse_http_proto(flow);
+	parse_https_proto(flow);
+	if (TEST_MODE())
+		dump_flow_info(flow);
+	app_filter_match(flow);
+
+#if defined(CONFIG_NF_CONNTRACK_MARK)
+	if (flow->app_id != 0) {
+		SET_APPID(ct->mark, flow->app_id);
+		ct->mark |= APP_FILTER_DONE_BITS;
+	}
+	else if (parse_pkt_num >= MAX_PARSE_PKT_NUM) {
+		ct->mark |= APP_FILTER_DONE_BITS;
+	}
+VERDICT:
+#endif
+	if (flow->app_id != 0){
+		if (flow->app_id > 1000 && flow->app_id <= 8999){
+			if (account || flow->drop)
+				af_update_client_app_info(flow);
+			else
+				af_batch_client_app_info(flow);
+			if (flow->family == AF_INET6)
+				AF_LMT_INFO("match %s %pI6c(%d)--> %pI6c(%d) len = %d, %d\n ",  IPPROTO_TCP == flow->l4_protocol ? "tcp" :"udp",
+						&flow->src6, flow->sport, &flow->dst6, flow->dport, skb->len, flow->app_id);
+			else
+				AF_LMT_INFO("match %s %pI4(%d)--> %pI4(%d) len = %d, %d\n ",  IPPROTO_TCP == flow->l4_protocol ? "tcp" :"udp",
+						&flow->src, flow->sport, &flow->dst, flow->dport, skb->len, flow->app_id);
+		}
+	}
+	if(flow->drop){
+#if defined(CONFIG_NF_CONNTRACK_MARK)
+		ct->mark |= APP_FILTER_DROP_BITS;
+#endif
+		AF_LMT_INFO("##Drop app %s flow, appid is %d\n", flow->app_name, flow->app_id);
+		return NF_DROP;
+	}
+	return NF_ACCEPT;
+}
+
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(4,4,0)
 static u_int32_t app_filter_hook(void *priv,
 			       struct sk_buff *skb,
@@ -800,9 +1600,7 @@ static u_int32_t app_filter_hook(unsigned int hook,
 					           const struct net_device *out,
 					           int (*okfn)(struct sk_buff *)){
 #endif
-	static int bytes1 = 0;
-	unsigned long long total_packets = 0;
-	flow_info_t flow;
+	u_int32_t verdict;
 // 4.10-->4.11 nfct-->_nfct
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(4,11,0)
 	struct nf_conn *ct = (struct nf_conn *)skb->_nfct;
@@ -828,60 +1626,11 @@ static u_int32_t app_filter_hook(unsigned int hook,
 	}
 }
 #endif
-#if 0
-// 3.12.74-->3.13-rc1
-#if LINUX_VERSION_CODE >= KERNEL_VERSION(3,13,0)
-	struct nf_conn_acct *acct;
-	acct = nf_conn_acct_find(ct);
-	if(!acct)
-		return NF_ACCEPT;
-	total_packets = (unsigned long long)atomic64_read(&acct->counter[IP_CT_DIR_ORIGINAL].packets) 
-		+ (unsigned long long)atomic64_read(&acct->counter[IP_CT_DIR_REPLY].packets);
-#else
-
-	struct nf_conn_counter *counter;
-	counter = nf_conn_acct_find(ct);
-
-	if (!counter)
-		return NF_ACCEPT;	
-
-	total_packets = (unsigned long long)atomic64_read(&counter[IP_CT_DIR_ORIGINAL].packets) 
-		+ (unsigned long long)atomic64_read(&counter[IP_CT_DIR_REPLY].packets);
-
-#endif
-	if(total_packets > MAX_PARSE_PKT_NUM){
-		return NF_ACCEPT;
-	}
-
-#endif
-	memset((char *)&flow, 0x0, sizeof(flow_info_t));
-	if(parse_flow_base(skb, &flow) < 0){
-		return NF_ACCEPT;
-	}
-
-//	int appid = GET_APPID(ct->mark);
-	parse_http_proto(&flow);
-	parse_https_proto(&flow);
-	if (TEST_MODE())
-		dump_flow_info(&flow);
-	app_filter_match(&flow);
-
-	if (flow.app_id != 0){
-		//SET_APPID(ct->mark, flow.app_id);
-		if (flow.app_id > 1000 && flow.app_id <= 8999){
-			af_update_client_app_info(&flow);
-			AF_LMT_INFO("match %s %pI4(%d)--> %pI4(%d) len = %d, %d\n ",  IPPROTO_TCP == flow.l4_protocol ? "tcp" :"udp",
-						&flow.src, flow.sport, &flow.dst, flow.dport, skb->len, flow.app_id);
-		}
-	}
-	if(flow.drop){
-#if defined(CONFIG_NF_CONNTRACK_MARK)
-		ct->mark |= APP_FILTER_DROP_BITS;
-#endif
-		AF_LMT_INFO("##Drop app %s flow, appid is %d\n", flow.app_name, flow.app_id);
-		return NF_DROP;
-	}
-	return NF_ACCEPT;
+	/* the flow lives in the per-CPU scratch buffer until the verdict */
+	local_bh_disable();
+	verdict = af_filter_flow(skb, ct, this_cpu_ptr(&af_flow_scratch));
+	local_bh_enable();
+	return verdict;
 }
 
 
@@ -893,6 +1642,12 @@ static struct nf_hook_ops app_filter_ops[] __read_mostly = {
 		.hooknum	= NF_INET_FORWARD,
 		.priority	= NF_IP_PRI_MANGLE + 1,
 	},
+	{
+		.hook		= app_filter_hook,
+		.pf			= PF_INET6,
+		.hooknum	= NF_INET_FORWARD,
+		.priority	= NF_IP6_PRI_MANGLE + 1,
+	},
 };
 #else
 static struct nf_hook_ops app_filter_ops[] __read_mostly = {
@@ -903,6 +1658,13 @@ static struct nf_hook_ops app_filter_ops[] __read_mostly = {
 		.hooknum	= NF_INET_FORWARD,
 		.priority	= NF_IP_PRI_MANGLE + 1,
 	},
+	{
+		.hook		= app_filter_hook,
+		.owner		= THIS_MODULE,
+		.pf			= PF_INET6,
+		.hooknum	= NF_INET_FORWARD,
+		.priority	= NF_IP6_PRI_MANGLE + 1,
+	},
 };
 #endif
 
@@ -1046,6 +1808,7 @@ static int __init app_filter_init(void)
 		return -1;
 	}
 
+	af_quic_init();
 	netlink_oaf_init();
 	af_log_init();
 	af_register_dev();
@@ -1054,6 +1817,10 @@ static int __init app_filter_init(void)
 
 	init_af_client_procfs();
 //	show_feature_list();
+#ifdef CONFIG_KERNEL_FUNC_TEST
+	TEST_ac_bench();
+	TEST_quic_sni();
+#endif
 	af_client_init();
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(4,13,0)
     nf_register_net_hooks(&init_net, app_filter_ops, ARRAY_SIZE(app_filter_ops));
@@ -1078,6 +1845,7 @@ static void app_filter_fini(void)
 #endif
 
 	af_clean_feature_list();
+	af_quic_exit();
 	af_mac_list_clear();
 	af_unregister_dev();
 	af_log_exit();
@@ -1,5 +1,6 @@
 #ifndef APP_FILTER_H
 #define APP_FILTER_H
+#include <linux/in6.h>
 
 #define AF_VERSION "5.0.1"
 #define AF_FEATURE_CONFIG_FILE "/etc/appfilter/feature.cfg"
@@ -17,6 +18,7 @@
 #define MAX_FEATURE_LINE_LEN 256
 #define MIN_FEATURE_LINE_LEN 16
 #define MAX_URL_MATCH_LEN 64
+#define MAX_URL_HIT_NUM 32
 
 //#define CONFIG_KERNEL_FUNC_TEST 1
 
@@ -39,8 +41,14 @@
 #define AF_APP_ID(a) (a) % 1000
 #define MAC_ADDR_LEN      		6
 
-#define HTTPS_URL_OFFSET		9
-#define HTTPS_LEN_OFFSET		7
+#define TLS_RECORD_HEADER_LEN		5
+#define TLS_HANDSHAKE_HEADER_LEN	4
+#define TLS_CLIENT_VERSION_LEN		2
+#define TLS_RANDOM_LEN				32
+#define TLS_CONTENT_TYPE_HANDSHAKE	0x16
+#define TLS_HANDSHAKE_CLIENT_HELLO	0x01
+#define TLS_EXT_SERVER_NAME			0x0000
+#define TLS_SNI_HOST_NAME			0x00
 
 enum AF_FEATURE_PARAM_INDEX{
 	AF_PROTO_PARAM_INDEX,
@@ -72,10 +80,20 @@ typedef struct https_proto{
 	int url_len;
 }https_proto_t;
 
+typedef struct af_url_hits{
+	int num;	// -1: automaton overflowed, verify every url feature
+	u_int32_t ids[MAX_URL_HIT_NUM];
+}af_url_hits_t;
+
 typedef struct flow_info{
 	struct nf_conn *ct; // Ӹָ
+	int family;
 	u_int32_t src; 
 	u_int32_t dst;
+	struct in6_addr src6;
+	struct in6_addr dst6;
+	unsigned char smac[MAC_ADDR_LEN];
+	u_int8_t smac_valid;
 	int l4_protocol;
 	u_int16_t sport;
 	u_int16_t dport;
@@ -88,6 +106,11 @@ typedef struct flow_info{
 	u_int8_t drop;
 	u_int8_t dir;
 	u_int16_t total_len;
+	char host_buf[MAX_URL_MATCH_LEN];
+	char url_buf[MAX_URL_MATCH_LEN];
+	char sni_buf[MAX_URL_MATCH_LEN];
+	af_url_hits_t host_hits;
+	af_url_hits_t url_hits;
 }flow_info_t;
 
 
@@ -97,8 +120,18 @@ typedef struct af_pos_info{
 	unsigned char value;
 }af_pos_info_t;
 
+enum AF_URL_MATCH_TYPE{
+	AF_URL_MATCH_NONE,
+	AF_URL_MATCH_LITERAL,	// automaton hit is a match
+	AF_URL_MATCH_VERIFY,	// automaton hit must be confirmed by the regexp
+	AF_URL_MATCH_REGEXP,	// no literal to index, always run the regexp
+};
+
+struct RE;
+
 typedef struct af_feature_node{
 	struct list_head  		head;
+	u_int32_t seq;
 	u_int32_t app_id;
 	char app_name[MAX_APP_NAME_LEN];
 	char feature_str[MAX_FEATURE_NUM_PER_APP][MAX_FEATURE_STR_LEN];
@@ -109,6 +142,10 @@ typedef struct af_feature_node{
 	char request_url[MAX_REQUEST_URL_LEN];
 	int pos_num;
 	af_pos_info_t pos_info[MAX_POS_INFO_PER_FEATURE];
+	u_int8_t host_match_type;
+	u_int8_t request_match_type;
+	struct RE *host_re;
+	struct RE *request_re;
 }af_feature_node_t;
 
 typedef struct af_mac_info {
@@ -120,7 +157,12 @@ int af_register_dev(void);
 void af_unregister_dev(void);
 void af_init_app_status(void);
 int af_get_app_status(int appid);
+int af_parse_client_hello(unsigned char *p, int len, char **sni, int *sni_len);
 int regexp_match(char *reg, char *text);
+struct RE *regexp_compile(char *reg);
+int regexp_exec(struct RE *regexp, char *text);
+void regexp_release(struct RE *regexp);
+int af_dump_feature_index(char *buf, int size);
 void af_mac_list_init(void);
 void af_mac_list_clear(void);
 af_mac_info_t * find_af_mac(unsigned char *mac);
@@ -38,6 +38,7 @@ struct af_config_dev g_af_dev;
 
 struct af_cdev_file {
     size_t size;
+    size_t read_size;
     char buf[256 << 10];
 };
 	
@@ -341,16 +342,25 @@ static int af_cdev_open(struct inode *inode, struct file *filp)
     return 0;
 }
 
+/*
+	cat /dev/appfilter
+	dump the feature index buckets and their hit counts
+*/
 static ssize_t af_cdev_read(struct file *filp, char *buf, size_t count, loff_t *off)
 {
-    return 0;
+    struct af_cdev_file *file = filp->private_data;
+    if (*off == 0)
+        file->read_size = af_dump_feature_index(file->buf, sizeof(file->buf));
+    return simple_read_from_buffer(buf, count, off, file->buf, file->read_size);
 }
 
 static int af_cdev_release(struct inode *inode, struct file *filp)
 {
     struct af_cdev_file *file = filp->private_data;
-    AF_DEBUG("config size: %d,data = %s\n", (int)file->size, file->buf);
-	af_config_handle(file->buf, file->size);
+    if (file->size > 0) {
+        AF_DEBUG("config size: %d,data = %s\n", (int)file->size, file->buf);
+        af_config_handle(file->buf, file->size);
+    }
     filp->private_data = NULL;
     mutex_unlock(&af_cdev_mutex);
     vfree(file);
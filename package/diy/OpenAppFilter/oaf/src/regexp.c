@@ -241,38 +241,56 @@ static int matchhere(RE *regexp, char *text)
 	return 0;
 }
 
+struct RE *regexp_compile(char *reg)
+{
+	return compile(reg);
+}
+
+void regexp_release(struct RE *regexp)
+{
+	regexp_free(regexp);
+}
+
 /* 
+ * match text against a pattern compiled by regexp_compile()
  * return value:
- *		-1		error
  *		0		not match
  *		1		matched
  */
-int regexp_match(char *reg, char *text)
+int regexp_exec(struct RE *regexp, char *text)
 {
-	int ret;
-	RE *regexp = compile(reg);
+	int ret = 0;
 	if(regexp == NULL)
-		return -1;
+		return 0;
 
 	if(regexp->type == BEGIN)
-	{
-		ret = matchhere(regexp->next, text);
-		goto out;
-	}
+		return matchhere(regexp->next, text);
 
 	do{
 		if(ret = matchhere(regexp, text))
-		{
-			goto out;
-		}
+			return ret;
 	}while(*text++ != '\0');
+	return ret;
+}
+
+/* 
+ * return value:
+ *		-1		error
+ *		0		not match
+ *		1		matched
+ */
+int regexp_match(char *reg, char *text)
+{
+	int ret;
+	RE *regexp = compile(reg);
+	if(regexp == NULL)
+		return -1;
 
-out:
+	ret = regexp_exec(regexp, text);
 	regexp_free(regexp);
 	return ret;
 }
 
-
 void TEST_reg_func(char *reg, char * str, int ret)
 {
 	
@@ -15,6 +15,8 @@
  * OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include <linux/skbuff.h>
+#include <linux/version.h>
 
 /*
  * The following are debug macros used throughout the SFE.
@@ -112,3 +114,21 @@ int sfe_ipv6_register_flow_cookie_cb(sfe_ipv6_flow_cookie_set_func_t cb);
 int sfe_ipv6_unregister_flow_cookie_cb(sfe_ipv6_flow_cookie_set_func_t cb);
 
 #endif /*CONFIG_NF_FLOW_COOKIE*/
+
+/*
+ * sfe_exceeds_mtu()
+ *	Is the packet too big for the transmit interface?  A GSO packet is
+ *	segmented on transmit, so each of its segments has to fit instead.
+ */
+static inline bool sfe_exceeds_mtu(struct sk_buff *skb, unsigned int len, unsigned int mtu)
+{
+	if (!skb_is_gso(skb)) {
+		return len > mtu;
+	}
+
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(4, 16, 0))
+	return !skb_gso_validate_network_len(skb, mtu);
+#else
+	return !skb_gso_validate_mtu(skb, mtu);
+#endif
+}
@@ -22,6 +22,10 @@
 #include <net/tcp.h>
 #include <linux/etherdevice.h>
 #include <linux/version.h>
+#include <linux/jhash.h>
+#include <linux/u64_stats_sync.h>
+#include <linux/random.h>
+#include <linux/vmalloc.h>
 
 #include "sfe.h"
 #include "sfe_cm.h"
@@ -209,8 +213,7 @@ struct sfe_ipv6_connection_match {
 	/*
 	 * References to other objects.
 	 */
-	struct sfe_ipv6_connection_match *next;
-	struct sfe_ipv6_connection_match *prev;
+	struct hlist_node hnode;	/* Entry in the connection match hash chain */
 	struct sfe_ipv6_connection *connection;
 	struct sfe_ipv6_connection_match *counter_match;
 					/* Matches the flow in the opposite direction as the one in connection */
@@ -247,10 +250,11 @@ struct sfe_ipv6_connection_match {
 	} protocol_state;
 	/*
 	 * Stats recorded in a sync period. These stats will be added to
-	 * rx_packet_count64/rx_byte_count64 after a sync period.
+	 * rx_packet_count64/rx_byte_count64 after a sync period.  They are
+	 * updated from the fast path without holding the lock.
 	 */
-	u32 rx_packet_count;
-	u32 rx_byte_count;
+	atomic_t rx_packet_count;
+	atomic_t rx_byte_count;
 
 	/*
 	 * Packet translation information.
@@ -319,6 +323,8 @@ struct sfe_ipv6_connection {
 					/* Pointer to the previous entry in the list of all connections */
 	u32 mark;			/* mark for outgoing packet */
 	u32 debug_read_seq;		/* sequence number for debug dump */
+	bool removed;			/* Unlinked from the hash tables, awaiting free */
+	struct rcu_head rcu;		/* Used to free the connection after a grace period */
 };
 
 /*
@@ -328,6 +334,20 @@ struct sfe_ipv6_connection {
 #define SFE_IPV6_CONNECTION_HASH_SIZE (1 << SFE_IPV6_CONNECTION_HASH_SHIFT)
 #define SFE_IPV6_CONNECTION_HASH_MASK (SFE_IPV6_CONNECTION_HASH_SIZE - 1)
 
+/*
+ * Connection match hash table size information.  The number of buckets is
+ * set by the conn_match_hash_shift module parameter and can be changed while
+ * the module is running.
+ */
+#define SFE_IPV6_CONNECTION_MATCH_HASH_SHIFT_MIN 8
+#define SFE_IPV6_CONNECTION_MATCH_HASH_SHIFT_MAX 20
+
+struct sfe_ipv6_connection_match_hash {
+	unsigned int shift;		/* Log2 of the number of buckets */
+	u32 seed;			/* Random seed for the bucket hash */
+	struct hlist_head heads[0];	/* Hash chains, walked under RCU by the fast path */
+};
+
 #ifdef CONFIG_NF_FLOW_COOKIE
 #define SFE_FLOW_COOKIE_SIZE 2048
 #define SFE_FLOW_COOKIE_MASK 0x7ff
@@ -421,6 +441,19 @@ static char *sfe_ipv6_exception_events_string[SFE_IPV6_EXCEPTION_EVENT_LAST] = {
 	"CLONED_SKB_UNSHARE_ERROR"
 };
 
+/*
+ * Per-CPU statistics, updated from the packet path without taking the lock.
+ */
+struct sfe_ipv6_stats {
+	u64 connection_match_hash_hits64;
+					/* Number of IPv6 connection match hash hits */
+	u64 packets_forwarded64;	/* Number of IPv6 packets forwarded */
+	u64 packets_not_forwarded64;
+					/* Number of IPv6 packets not forwarded */
+	u64 exception_events64[SFE_IPV6_EXCEPTION_EVENT_LAST];
+	struct u64_stats_sync syncp;	/* Lets 32-bit readers see whole counters */
+};
+
 /*
  * Per-module structure.
  */
@@ -440,7 +473,7 @@ struct sfe_ipv6 {
 					/* Callback function registered by a connection manager for stats syncing */
 	struct sfe_ipv6_connection *conn_hash[SFE_IPV6_CONNECTION_HASH_SIZE];
 					/* Connection hash table */
-	struct sfe_ipv6_connection_match *conn_match_hash[SFE_IPV6_CONNECTION_HASH_SIZE];
+	struct sfe_ipv6_connection_match_hash __rcu *conn_match_hash;
 					/* Connection match hash table */
 #ifdef CONFIG_NF_FLOW_COOKIE
 	struct sfe_ipv6_flow_cookie_entry sfe_flow_cookie_table[SFE_FLOW_COOKIE_SIZE];
@@ -463,14 +496,7 @@ struct sfe_ipv6 {
 					/* Number of IPv6 connection destroy requests */
 	u32 connection_destroy_misses;
 					/* Number of IPv6 connection destroy requests that missed our hash table */
-	u32 connection_match_hash_hits;
-					/* Number of IPv6 connection match hash hits */
-	u32 connection_match_hash_reorders;
-					/* Number of IPv6 connection match hash reorders */
 	u32 connection_flushes;		/* Number of IPv6 connection flushes */
-	u32 packets_forwarded;		/* Number of IPv6 packets forwarded */
-	u32 packets_not_forwarded;	/* Number of IPv6 packets not forwarded */
-	u32 exception_events[SFE_IPV6_EXCEPTION_EVENT_LAST];
 
 	/*
 	 * Summary statistics.
@@ -483,15 +509,14 @@ struct sfe_ipv6 {
 					/* Number of IPv6 connection destroy requests */
 	u64 connection_destroy_misses64;
 					/* Number of IPv6 connection destroy requests that missed our hash table */
-	u64 connection_match_hash_hits64;
-					/* Number of IPv6 connection match hash hits */
-	u64 connection_match_hash_reorders64;
-					/* Number of IPv6 connection match hash reorders */
 	u64 connection_flushes64;	/* Number of IPv6 connection flushes */
-	u64 packets_forwarded64;	/* Number of IPv6 packets forwarded */
-	u64 packets_not_forwarded64;
-					/* Number of IPv6 packets not forwarded */
-	u64 exception_events64[SFE_IPV6_EXCEPTION_EVENT_LAST];
+
+	struct sfe_ipv6_stats __percpu *stats_pcpu;
+					/* Per-CPU packet path statistics */
+	u64 packets_forwarded_cleared64;
+	u64 packets_not_forwarded_cleared64;
+	u64 connection_match_hash_hits_cleared64;
+					/* Per-CPU totals when the stats were last reset */
 
 	/*
 	 * Control state.
@@ -531,6 +556,70 @@ typedef bool (*sfe_ipv6_debug_xml_write_method_t)(struct sfe_ipv6 *si, char *buf
 
 static struct sfe_ipv6 __si6;
 
+/*
+ * sfe_ipv6_stats_inc()
+ *	Count an event in this CPU's packet path statistics.
+ *
+ * The update sequence lets a 32-bit reader see both halves of a counter change together.
+ */
+#define sfe_ipv6_stats_inc(si, field) \
+	do { \
+		struct sfe_ipv6_stats *__stats = this_cpu_ptr((si)->stats_pcpu); \
+		u64_stats_update_begin(&__stats->syncp); \
+		__stats->field++; \
+		u64_stats_update_end(&__stats->syncp); \
+	} while (0)
+
+/*
+ * sfe_ipv6_exception_stats_inc()
+ *	Count an exception event and the packet that was not forwarded because of it.
+ */
+static inline void sfe_ipv6_exception_stats_inc(struct sfe_ipv6 *si, enum sfe_ipv6_exception_events reason)
+{
+	struct sfe_ipv6_stats *stats = this_cpu_ptr(si->stats_pcpu);
+
+	u64_stats_update_begin(&stats->syncp);
+	stats->exception_events64[reason]++;
+	stats->packets_not_forwarded64++;
+	u64_stats_update_end(&stats->syncp);
+}
+
+/*
+ * The counters are written from softirq context, so before 6.2 a 32-bit UP reader
+ * needs the _irq fetch to keep the writer out while it reads both halves.
+ */
+#if (LINUX_VERSION_CODE < KERNEL_VERSION(6, 2, 0))
+#define sfe_ipv6_stats_fetch_begin u64_stats_fetch_begin_irq
+#define sfe_ipv6_stats_fetch_retry u64_stats_fetch_retry_irq
+#else
+#define sfe_ipv6_stats_fetch_begin u64_stats_fetch_begin
+#define sfe_ipv6_stats_fetch_retry u64_stats_fetch_retry
+#endif
+
+/*
+ * sfe_ipv6_stats_sum()
+ *	Sum a packet path counter, at offset bytes into struct sfe_ipv6_stats, over all CPUs.
+ */
+static u64 sfe_ipv6_stats_sum(struct sfe_ipv6 *si, size_t offset)
+{
+	u64 sum = 0;
+	int cpu;
+
+	for_each_possible_cpu(cpu) {
+		const struct sfe_ipv6_stats *s = per_cpu_ptr(si->stats_pcpu, cpu);
+		unsigned int start;
+		u64 val;
+
+		do {
+			start = sfe_ipv6_stats_fetch_begin(&s->syncp);
+			val = *(const u64 *)((const char *)s + offset);
+		} while (sfe_ipv6_stats_fetch_retry(&s->syncp, start));
+		sum += val;
+	}
+
+	return sum;
+}
+
 /*
  * sfe_ipv6_get_debug_dev()
  */
@@ -571,106 +660,73 @@ static inline void sfe_ipv6_change_dsfield(struct sfe_ipv6_ip_hdr *iph, u8 dscp)
  * sfe_ipv6_get_connection_match_hash()
  *	Generate the hash used in connection match lookups.
  */
-static inline unsigned int sfe_ipv6_get_connection_match_hash(struct net_device *dev, u8 protocol,
+static inline unsigned int sfe_ipv6_get_connection_match_hash(struct sfe_ipv6_connection_match_hash *h,
+							      struct net_device *dev, u8 protocol,
 							      struct sfe_ipv6_addr *src_ip, __be16 src_port,
 							      struct sfe_ipv6_addr *dest_ip, __be16 dest_port)
 {
-	u32 idx, hash = 0;
-	size_t dev_addr = (size_t)dev;
+	u32 hash = jhash_3words(((__force u32)src_port << 16) | (__force u32)dest_port,
+				protocol, dev->ifindex, h->seed);
 
-	for (idx = 0; idx < 4; idx++) {
-		hash ^= src_ip->addr[idx] ^ dest_ip->addr[idx];
-	}
-	hash = ((u32)dev_addr) ^ hash ^ protocol ^ ntohs(src_port ^ dest_port);
-	return ((hash >> SFE_IPV6_CONNECTION_HASH_SHIFT) ^ hash) & SFE_IPV6_CONNECTION_HASH_MASK;
+	hash = jhash2((__force u32 *)src_ip->addr, 4, hash);
+	hash = jhash2((__force u32 *)dest_ip->addr, 4, hash);
+	return hash & ((1 << h->shift) - 1);
 }
 
 /*
  * sfe_ipv6_find_connection_match()
  *	Get the IPv6 flow match info that corresponds to a particular 5-tuple.
  *
- * On entry we must be holding the lock that protects the hash table.
+ * On entry we must be in an RCU read-side critical section.  The chain is not
+ * reordered on a hit so that lookups can run concurrently on all CPUs.
  */
 static struct sfe_ipv6_connection_match *
 sfe_ipv6_find_connection_match(struct sfe_ipv6 *si, struct net_device *dev, u8 protocol,
 					struct sfe_ipv6_addr *src_ip, __be16 src_port,
 					struct sfe_ipv6_addr *dest_ip, __be16 dest_port)
 {
+	struct sfe_ipv6_connection_match_hash *h = rcu_dereference(si->conn_match_hash);
 	struct sfe_ipv6_connection_match *cm;
-	struct sfe_ipv6_connection_match *head;
 	unsigned int conn_match_idx;
 
-	conn_match_idx = sfe_ipv6_get_connection_match_hash(dev, protocol, src_ip, src_port, dest_ip, dest_port);
-	cm = si->conn_match_hash[conn_match_idx];
-
-	/*
-	 * If we don't have anything in this chain then bail.
-	 */
-	if (unlikely(!cm)) {
-		return NULL;
-	}
-
-	/*
-	 * Hopefully the first entry is the one we want.
-	 */
-	if ((cm->match_src_port == src_port)
-	    && (cm->match_dest_port == dest_port)
-	    && (sfe_ipv6_addr_equal(cm->match_src_ip, src_ip))
-	    && (sfe_ipv6_addr_equal(cm->match_dest_ip, dest_ip))
-	    && (cm->match_protocol == protocol)
-	    && (cm->match_dev == dev)) {
-		si->connection_match_hash_hits++;
-		return cm;
-	}
-
-	/*
-	 * Unfortunately we didn't find it at head, so we search it in chain and
-	 * move matching entry to the top of the hash chain. We presume that this
-	 * will be reused again very quickly.
-	 */
-	head = cm;
-	do {
-		cm = cm->next;
-	} while (cm && (cm->match_src_port != src_port
-		 || cm->match_dest_port != dest_port
-		 || !sfe_ipv6_addr_equal(cm->match_src_ip, src_ip)
-		 || !sfe_ipv6_addr_equal(cm->match_dest_ip, dest_ip)
-		 || cm->match_protocol != protocol
-		 || cm->match_dev != dev));
-
-	/*
-	 * Not found then we're done.
-	 */
-	if (unlikely(!cm)) {
-		return NULL;
-	}
-
-	/*
-	 * We found a match so move it.
-	 */
-	if (cm->next) {
-		cm->next->prev = cm->prev;
+	conn_match_idx = sfe_ipv6_get_connection_match_hash(h, dev, protocol, src_ip, src_port, dest_ip, dest_port);
+	hlist_for_each_entry_rcu(cm, &h->heads[conn_match_idx], hnode) {
+		if ((cm->match_src_port == src_port)
+		    && (cm->match_dest_port == dest_port)
+		    && (sfe_ipv6_addr_equal(cm->match_src_ip, src_ip))
+		    && (sfe_ipv6_addr_equal(cm->match_dest_ip, dest_ip))
+		    && (cm->match_protocol == protocol)
+		    && (cm->match_dev == dev)) {
+			sfe_ipv6_stats_inc(si, connection_match_hash_hits64);
+			return cm;
+		}
 	}
-	cm->prev->next = cm->next;
-	cm->prev = NULL;
-	cm->next = head;
-	head->prev = cm;
-	si->conn_match_hash[conn_match_idx] = cm;
-	si->connection_match_hash_reorders++;
 
-	return cm;
+	return NULL;
 }
 
 /*
  * sfe_ipv6_connection_match_update_summary_stats()
  *	Update the summary stats for a connection match entry.
  */
-static inline void sfe_ipv6_connection_match_update_summary_stats(struct sfe_ipv6_connection_match *cm)
+static inline void sfe_ipv6_connection_match_update_summary_stats(struct sfe_ipv6_connection_match *cm,
+								   u32 *packets, u32 *bytes)
 {
-	cm->rx_packet_count64 += cm->rx_packet_count;
-	cm->rx_packet_count = 0;
-	cm->rx_byte_count64 += cm->rx_byte_count;
-	cm->rx_byte_count = 0;
+	u32 packet_count, byte_count;
+
+	/*
+	 * The fast path keeps adding to the counters while we read them, so
+	 * only subtract what we have accounted for.
+	 */
+	packet_count = atomic_read(&cm->rx_packet_count);
+	atomic_sub(packet_count, &cm->rx_packet_count);
+	byte_count = atomic_read(&cm->rx_byte_count);
+	atomic_sub(byte_count, &cm->rx_byte_count);
+
+	cm->rx_packet_count64 += packet_count;
+	cm->rx_byte_count64 += byte_count;
+	*packets = packet_count;
+	*bytes = byte_count;
 }
 
 /*
@@ -781,8 +837,6 @@ static void sfe_ipv6_connection_match_compute_translations(struct sfe_ipv6_conne
  */
 static void sfe_ipv6_update_summary_stats(struct sfe_ipv6 *si)
 {
-	int i;
-
 	si->connection_create_requests64 += si->connection_create_requests;
 	si->connection_create_requests = 0;
 	si->connection_create_collisions64 += si->connection_create_collisions;
@@ -791,21 +845,8 @@ static void sfe_ipv6_update_summary_stats(struct sfe_ipv6 *si)
 	si->connection_destroy_requests = 0;
 	si->connection_destroy_misses64 += si->connection_destroy_misses;
 	si->connection_destroy_misses = 0;
-	si->connection_match_hash_hits64 += si->connection_match_hash_hits;
-	si->connection_match_hash_hits = 0;
-	si->connection_match_hash_reorders64 += si->connection_match_hash_reorders;
-	si->connection_match_hash_reorders = 0;
 	si->connection_flushes64 += si->connection_flushes;
 	si->connection_flushes = 0;
-	si->packets_forwarded64 += si->packets_forwarded;
-	si->packets_forwarded = 0;
-	si->packets_not_forwarded64 += si->packets_not_forwarded;
-	si->packets_not_forwarded = 0;
-
-	for (i = 0; i < SFE_IPV6_EXCEPTION_EVENT_LAST; i++) {
-		si->exception_events64[i] += si->exception_events[i];
-		si->exception_events[i] = 0;
-	}
 }
 
 /*
@@ -817,22 +858,13 @@ static void sfe_ipv6_update_summary_stats(struct sfe_ipv6 *si)
 static inline void sfe_ipv6_insert_connection_match(struct sfe_ipv6 *si,
 						    struct sfe_ipv6_connection_match *cm)
 {
-	struct sfe_ipv6_connection_match **hash_head;
-	struct sfe_ipv6_connection_match *prev_head;
+	struct sfe_ipv6_connection_match_hash *h = rcu_dereference_protected(si->conn_match_hash, lockdep_is_held(&si->lock));
 	unsigned int conn_match_idx
-		= sfe_ipv6_get_connection_match_hash(cm->match_dev, cm->match_protocol,
+		= sfe_ipv6_get_connection_match_hash(h, cm->match_dev, cm->match_protocol,
 						     cm->match_src_ip, cm->match_src_port,
 						     cm->match_dest_ip, cm->match_dest_port);
 
-	hash_head = &si->conn_match_hash[conn_match_idx];
-	prev_head = *hash_head;
-	cm->prev = NULL;
-	if (prev_head) {
-		prev_head->prev = cm;
-	}
-
-	cm->next = prev_head;
-	*hash_head = cm;
+	hlist_add_head_rcu(&cm->hnode, &h->heads[conn_match_idx]);
 
 #ifdef CONFIG_NF_FLOW_COOKIE
 	if (!si->flow_cookie_enable || !(cm->flags & (SFE_IPV6_CONNECTION_MATCH_FLAG_XLATE_SRC | SFE_IPV6_CONNECTION_MATCH_FLAG_XLATE_DEST)))
@@ -856,7 +888,7 @@ static inline void sfe_ipv6_insert_connection_match(struct sfe_ipv6 *si,
 					entry->match = cm;
 					cm->flow_cookie = conn_match_idx;
 				} else {
-					si->exception_events[SFE_IPV6_EXCEPTION_EVENT_FLOW_COOKIE_ADD_FAIL]++;
+					sfe_ipv6_stats_inc(si, exception_events64[SFE_IPV6_EXCEPTION_EVENT_FLOW_COOKIE_ADD_FAIL]);
 				}
 			}
 			rcu_read_unlock();
@@ -872,6 +904,7 @@ static inline void sfe_ipv6_insert_connection_match(struct sfe_ipv6 *si,
  *	Remove a connection match object from the hash.
  *
  * On entry we must be holding the lock that protects the hash table.
+ * The object must not be freed until an RCU grace period has elapsed.
  */
 static inline void sfe_ipv6_remove_connection_match(struct sfe_ipv6 *si, struct sfe_ipv6_connection_match *cm)
 {
@@ -906,21 +939,10 @@ static inline void sfe_ipv6_remove_connection_match(struct sfe_ipv6 *si, struct
 #endif
 
 	/*
-	 * Unlink the connection match entry from the hash.
+	 * Unlink the connection match entry from the hash.  Readers that are
+	 * already on this entry can still follow its chain.
 	 */
-	if (cm->prev) {
-		cm->prev->next = cm->next;
-	} else {
-		unsigned int conn_match_idx
-			= sfe_ipv6_get_connection_match_hash(cm->match_dev, cm->match_protocol,
-							     cm->match_src_ip, cm->match_src_port,
-							     cm->match_dest_ip, cm->match_dest_port);
-		si->conn_match_hash[conn_match_idx] = cm->next;
-	}
-
-	if (cm->next) {
-		cm->next->prev = cm->prev;
-	}
+	hlist_del_init_rcu(&cm->hnode);
 
 	/*
 	 * If the connection match entry is in the active list remove it.
@@ -1089,8 +1111,16 @@ static void sfe_ipv6_insert_connection(struct sfe_ipv6 *si, struct sfe_ipv6_conn
  *
  * On entry we must be holding the lock that protects the hash table.
  */
-static void sfe_ipv6_remove_connection(struct sfe_ipv6 *si, struct sfe_ipv6_connection *c)
+static bool sfe_ipv6_remove_connection(struct sfe_ipv6 *si, struct sfe_ipv6_connection *c)
 {
+	/*
+	 * Packets being processed on other CPUs can still see a connection
+	 * that has been removed, only the first caller gets to remove it.
+	 */
+	if (c->removed) {
+		return false;
+	}
+
 	/*
 	 * Remove the connection match objects.
 	 */
@@ -1127,7 +1157,9 @@ static void sfe_ipv6_remove_connection(struct sfe_ipv6 *si, struct sfe_ipv6_conn
 		si->all_connections_tail = c->all_connections_prev;
 	}
 
+	c->removed = true;
 	si->num_connections--;
+	return true;
 }
 
 /*
@@ -1167,13 +1199,10 @@ static void sfe_ipv6_gen_sync_connection(struct sfe_ipv6 *si, struct sfe_ipv6_co
 	sis->dest_td_end = reply_cm->protocol_state.tcp.end;
 	sis->dest_td_max_end = reply_cm->protocol_state.tcp.max_end;
 
-	sis->src_new_packet_count = original_cm->rx_packet_count;
-	sis->src_new_byte_count = original_cm->rx_byte_count;
-	sis->dest_new_packet_count = reply_cm->rx_packet_count;
-	sis->dest_new_byte_count = reply_cm->rx_byte_count;
-
-	sfe_ipv6_connection_match_update_summary_stats(original_cm);
-	sfe_ipv6_connection_match_update_summary_stats(reply_cm);
+	sfe_ipv6_connection_match_update_summary_stats(original_cm, &sis->src_new_packet_count,
+						       &sis->src_new_byte_count);
+	sfe_ipv6_connection_match_update_summary_stats(reply_cm, &sis->dest_new_packet_count,
+						       &sis->dest_new_byte_count);
 
 	sis->src_dev = original_cm->match_dev;
 	sis->src_packet_count = original_cm->rx_packet_count64;
@@ -1192,6 +1221,22 @@ static void sfe_ipv6_gen_sync_connection(struct sfe_ipv6 *si, struct sfe_ipv6_co
 	c->last_sync_jiffies = now_jiffies;
 }
 
+/*
+ * sfe_ipv6_free_connection_rcu()
+ *	Release our hold of the source and dest devices and free the memory
+ *	for our connection objects.
+ */
+static void sfe_ipv6_free_connection_rcu(struct rcu_head *head)
+{
+	struct sfe_ipv6_connection *c = container_of(head, struct sfe_ipv6_connection, rcu);
+
+	dev_put(c->original_dev);
+	dev_put(c->reply_dev);
+	kfree(c->original_match);
+	kfree(c->reply_match);
+	kfree(c);
+}
+
 /*
  * sfe_ipv6_flush_connection()
  *	Flush a connection and free all associated resources.
@@ -1227,14 +1272,187 @@ static void sfe_ipv6_flush_connection(struct sfe_ipv6 *si,
 	rcu_read_unlock();
 
 	/*
-	 * Release our hold of the source and dest devices and free the memory
-	 * for our connection objects.
+	 * The fast path may still be using the connection, so release it
+	 * once all RCU readers are done.
 	 */
-	dev_put(c->original_dev);
-	dev_put(c->reply_dev);
-	kfree(c->original_match);
-	kfree(c->reply_match);
-	kfree(c);
+	call_rcu(&c->rcu, sfe_ipv6_free_connection_rcu);
+}
+
+/*
+ * Transmit batching.  When enabled, forwarded packets for the same transmit
+ * queue are held until the end of the receive softirq, or until the batch is
+ * full, and are then handed to the driver back to back with xmit_more set on
+ * all but the last one so that it only writes its doorbell once.  Batched
+ * packets bypass the qdisc of the transmit device.
+ */
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(5, 2, 0))
+#define SFE_IPV6_XMIT_BATCH_MAX 32
+
+struct sfe_ipv6_xmit_batch {
+	struct sk_buff_head queue;	/* Packets waiting to be sent */
+	struct net_device *dev;		/* Device the queued packets are sent on, held while in use */
+	struct netdev_queue *txq;	/* Transmit queue the queued packets are sent on */
+	struct tasklet_struct tasklet;	/* Sends the batch once the receive softirq is done */
+};
+
+static DEFINE_PER_CPU(struct sfe_ipv6_xmit_batch, sfe_ipv6_xmit_batch);
+
+static bool sfe_ipv6_xmit_batch_enable;
+module_param_named(xmit_batch, sfe_ipv6_xmit_batch_enable, bool, 0644);
+MODULE_PARM_DESC(xmit_batch, "Send forwarded packets to the driver in batches, bypassing the qdisc");
+
+/*
+ * sfe_ipv6_xmit_batch_flush()
+ *	Hand all packets in a transmit batch to the driver.
+ */
+static void sfe_ipv6_xmit_batch_flush(struct sfe_ipv6_xmit_batch *xb)
+{
+	struct net_device *dev = xb->dev;
+	struct netdev_queue *txq = xb->txq;
+	struct sk_buff_head list;
+	struct sk_buff *skb;
+
+	if (!dev) {
+		return;
+	}
+
+	__skb_queue_head_init(&list);
+	skb_queue_splice_init(&xb->queue, &list);
+	xb->dev = NULL;
+	xb->txq = NULL;
+
+	HARD_TX_LOCK(dev, txq, smp_processor_id());
+	while ((skb = __skb_dequeue(&list))) {
+		if (netif_xmit_frozen_or_drv_stopped(txq)
+		    || !dev_xmit_complete(netdev_start_xmit(skb, dev, txq, !skb_queue_empty(&list)))) {
+			__skb_queue_head(&list, skb);
+			break;
+		}
+	}
+	HARD_TX_UNLOCK(dev, txq);
+
+	/*
+	 * If the driver stopped the queue then leave the rest to the qdisc,
+	 * which will send them once the queue is woken again.
+	 */
+	while ((skb = __skb_dequeue(&list))) {
+		dev_queue_xmit(skb);
+	}
+
+	dev_put(dev);
+}
+
+/*
+ * sfe_ipv6_xmit_batch_tasklet()
+ *	Send whatever has been batched on this CPU during the receive softirq.
+ */
+static void sfe_ipv6_xmit_batch_tasklet(unsigned long data)
+{
+	sfe_ipv6_xmit_batch_flush((struct sfe_ipv6_xmit_batch *)data);
+}
+
+/*
+ * sfe_ipv6_xmit_batch_add()
+ *	Add a forwarded packet to this CPU's transmit batch.
+ */
+static void sfe_ipv6_xmit_batch_add(struct sk_buff *skb)
+{
+	struct sfe_ipv6_xmit_batch *xb = this_cpu_ptr(&sfe_ipv6_xmit_batch);
+	struct net_device *dev = skb->dev;
+	struct netdev_queue *txq;
+	struct sk_buff *next;
+	bool again = false;
+
+	/*
+	 * GSO packets are sent as they are if the device can segment them,
+	 * otherwise the stack has to do it for us.
+	 */
+	if (unlikely(skb_is_gso(skb) && netif_needs_gso(skb, netif_skb_features(skb)))) {
+		sfe_ipv6_xmit_batch_flush(xb);
+		dev_queue_xmit(skb);
+		return;
+	}
+
+	txq = netdev_core_pick_tx(dev, skb, NULL);
+	if ((xb->dev != dev) || (xb->txq != txq)) {
+		sfe_ipv6_xmit_batch_flush(xb);
+		dev_hold(dev);
+		xb->dev = dev;
+		xb->txq = txq;
+	}
+
+	/*
+	 * Do the checksum and VLAN work the device can't, as the stack would
+	 * on its way to the driver.
+	 */
+	skb = validate_xmit_skb_list(skb, dev, &again);
+	while (skb) {
+		next = skb->next;
+		skb_mark_not_on_list(skb);
+		__skb_queue_tail(&xb->queue, skb);
+		skb = next;
+	}
+
+	if (skb_queue_len(&xb->queue) >= SFE_IPV6_XMIT_BATCH_MAX) {
+		sfe_ipv6_xmit_batch_flush(xb);
+		return;
+	}
+
+	tasklet_schedule(&xb->tasklet);
+}
+
+/*
+ * sfe_ipv6_xmit_batch_init()
+ *	Set up the per-CPU transmit batches.
+ */
+static void sfe_ipv6_xmit_batch_init(void)
+{
+	int cpu;
+
+	for_each_possible_cpu(cpu) {
+		struct sfe_ipv6_xmit_batch *xb = per_cpu_ptr(&sfe_ipv6_xmit_batch, cpu);
+
+		__skb_queue_head_init(&xb->queue);
+		tasklet_init(&xb->tasklet, sfe_ipv6_xmit_batch_tasklet, (unsigned long)xb);
+	}
+}
+
+/*
+ * sfe_ipv6_xmit_batch_exit()
+ *	Wait for any batches that are still pending to be sent.
+ */
+static void sfe_ipv6_xmit_batch_exit(void)
+{
+	int cpu;
+
+	for_each_possible_cpu(cpu) {
+		tasklet_kill(&per_cpu_ptr(&sfe_ipv6_xmit_batch, cpu)->tasklet);
+	}
+}
+#else
+static inline void sfe_ipv6_xmit_batch_init(void)
+{
+}
+
+static inline void sfe_ipv6_xmit_batch_exit(void)
+{
+}
+#endif /*KERNEL_VERSION(5, 2, 0)*/
+
+/*
+ * sfe_ipv6_xmit()
+ *	Send a forwarded packet on its way.
+ */
+static inline void sfe_ipv6_xmit(struct sk_buff *skb)
+{
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(5, 2, 0))
+	if (sfe_ipv6_xmit_batch_enable) {
+		sfe_ipv6_xmit_batch_add(skb);
+		return;
+	}
+#endif /*KERNEL_VERSION(5, 2, 0)*/
+
+	dev_queue_xmit(skb);
 }
 
 /*
@@ -1256,10 +1474,7 @@ static int sfe_ipv6_recv_udp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 	 * Is our packet too short to contain a valid UDP header?
 	 */
 	if (!pskb_may_pull(skb, (sizeof(struct sfe_ipv6_udp_hdr) + ihl))) {
-		spin_lock_bh(&si->lock);
-		si->exception_events[SFE_IPV6_EXCEPTION_EVENT_UDP_HEADER_INCOMPLETE]++;
-		si->packets_not_forwarded++;
-		spin_unlock_bh(&si->lock);
+		sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_UDP_HEADER_INCOMPLETE);
 
 		DEBUG_TRACE("packet too short for UDP header\n");
 		return 0;
@@ -1277,8 +1492,6 @@ static int sfe_ipv6_recv_udp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 	src_port = udph->source;
 	dest_port = udph->dest;
 
-	spin_lock_bh(&si->lock);
-
 	/*
 	 * Look for a connection match.
 	 */
@@ -1291,9 +1504,7 @@ static int sfe_ipv6_recv_udp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 	cm = sfe_ipv6_find_connection_match(si, dev, IPPROTO_UDP, src_ip, src_port, dest_ip, dest_port);
 #endif
 	if (unlikely(!cm)) {
-		si->exception_events[SFE_IPV6_EXCEPTION_EVENT_UDP_NO_CONNECTION]++;
-		si->packets_not_forwarded++;
-		spin_unlock_bh(&si->lock);
+		sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_UDP_NO_CONNECTION);
 
 		DEBUG_TRACE("no connection found\n");
 		return 0;
@@ -1306,13 +1517,17 @@ static int sfe_ipv6_recv_udp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 	 */
 	if (unlikely(flush_on_find)) {
 		struct sfe_ipv6_connection *c = cm->connection;
-		sfe_ipv6_remove_connection(si, c);
-		si->exception_events[SFE_IPV6_EXCEPTION_EVENT_UDP_IP_OPTIONS_OR_INITIAL_FRAGMENT]++;
-		si->packets_not_forwarded++;
+		bool ret;
+
+		spin_lock_bh(&si->lock);
+		ret = sfe_ipv6_remove_connection(si, c);
 		spin_unlock_bh(&si->lock);
 
 		DEBUG_TRACE("flush on find\n");
-		sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+		if (ret) {
+			sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+		}
+		sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_UDP_IP_OPTIONS_OR_INITIAL_FRAGMENT);
 		return 0;
 	}
 
@@ -1322,8 +1537,7 @@ static int sfe_ipv6_recv_udp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 	 * through the slow path.
 	 */
 	if (unlikely(!cm->flow_accel)) {
-		si->packets_not_forwarded++;
-		spin_unlock_bh(&si->lock);
+		sfe_ipv6_stats_inc(si, packets_not_forwarded64);
 		return 0;
 	}
 #endif
@@ -1333,29 +1547,37 @@ static int sfe_ipv6_recv_udp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 	 */
 	if (unlikely(iph->hop_limit < 2)) {
 		struct sfe_ipv6_connection *c = cm->connection;
-		sfe_ipv6_remove_connection(si, c);
-		si->exception_events[SFE_IPV6_EXCEPTION_EVENT_UDP_SMALL_TTL]++;
-		si->packets_not_forwarded++;
+		bool ret;
+
+		spin_lock_bh(&si->lock);
+		ret = sfe_ipv6_remove_connection(si, c);
 		spin_unlock_bh(&si->lock);
 
 		DEBUG_TRACE("hop_limit too low\n");
-		sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+		if (ret) {
+			sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+		}
+		sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_UDP_SMALL_TTL);
 		return 0;
 	}
 
 	/*
 	 * If our packet is larger than the MTU of the transmit interface then
-	 * we can't forward it easily.
+	 * we can't forward it easily.  GSO packets are checked per segment.
 	 */
-	if (unlikely(len > cm->xmit_dev_mtu)) {
+	if (unlikely(sfe_exceeds_mtu(skb, len, cm->xmit_dev_mtu))) {
 		struct sfe_ipv6_connection *c = cm->connection;
-		sfe_ipv6_remove_connection(si, c);
-		si->exception_events[SFE_IPV6_EXCEPTION_EVENT_UDP_NEEDS_FRAGMENTATION]++;
-		si->packets_not_forwarded++;
+		bool ret;
+
+		spin_lock_bh(&si->lock);
+		ret = sfe_ipv6_remove_connection(si, c);
 		spin_unlock_bh(&si->lock);
 
 		DEBUG_TRACE("larger than mtu\n");
-		sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+		if (ret) {
+			sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+		}
+		sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_UDP_NEEDS_FRAGMENTATION);
 		return 0;
 	}
 
@@ -1373,9 +1595,7 @@ static int sfe_ipv6_recv_udp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 		skb = skb_unshare(skb, GFP_ATOMIC);
                 if (!skb) {
 			DEBUG_WARN("Failed to unshare the cloned skb\n");
-			si->exception_events[SFE_IPV6_EXCEPTION_EVENT_CLONED_SKB_UNSHARE_ERROR]++;
-			si->packets_not_forwarded++;
-			spin_unlock_bh(&si->lock);
+			sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_CLONED_SKB_UNSHARE_ERROR);
 
 			return 0;
 		}
@@ -1444,22 +1664,27 @@ static int sfe_ipv6_recv_udp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 	/*
 	 * Update traffic stats.
 	 */
-	cm->rx_packet_count++;
-	cm->rx_byte_count += len;
+	atomic_inc(&cm->rx_packet_count);
+	atomic_add(len, &cm->rx_byte_count);
 
 	/*
 	 * If we're not already on the active list then insert ourselves at the tail
-	 * of the current list.
+	 * of the current list.  This happens at most once per sync of the
+	 * connection so it is the only time the fast path takes the lock.
 	 */
-	if (unlikely(!cm->active)) {
-		cm->active = true;
-		cm->active_prev = si->active_tail;
-		if (likely(si->active_tail)) {
-			si->active_tail->active_next = cm;
-		} else {
-			si->active_head = cm;
+	if (unlikely(!READ_ONCE(cm->active))) {
+		spin_lock_bh(&si->lock);
+		if (!cm->active && !cm->connection->removed) {
+			cm->active = true;
+			cm->active_prev = si->active_tail;
+			if (likely(si->active_tail)) {
+				si->active_tail->active_next = cm;
+			} else {
+				si->active_head = cm;
+			}
+			si->active_tail = cm;
 		}
-		si->active_tail = cm;
+		spin_unlock_bh(&si->lock);
 	}
 
 	xmit_dev = cm->xmit_dev;
@@ -1502,8 +1727,7 @@ static int sfe_ipv6_recv_udp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 		DEBUG_TRACE("SKB MARK is NON ZERO %x\n", skb->mark);
 	}
 
-	si->packets_forwarded++;
-	spin_unlock_bh(&si->lock);
+	sfe_ipv6_stats_inc(si, packets_forwarded64);
 
 	/*
 	 * We're going to check for GSO flags when we transmit the packet so
@@ -1519,7 +1743,7 @@ static int sfe_ipv6_recv_udp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 	/*
 	 * Send the packet on its way.
 	 */
-	dev_queue_xmit(skb);
+	sfe_ipv6_xmit(skb);
 
 	return 1;
 }
@@ -1625,10 +1849,7 @@ static int sfe_ipv6_recv_tcp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 	 * Is our packet too short to contain a valid UDP header?
 	 */
 	if (!pskb_may_pull(skb, (sizeof(struct sfe_ipv6_tcp_hdr) + ihl))) {
-		spin_lock_bh(&si->lock);
-		si->exception_events[SFE_IPV6_EXCEPTION_EVENT_TCP_HEADER_INCOMPLETE]++;
-		si->packets_not_forwarded++;
-		spin_unlock_bh(&si->lock);
+		sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_TCP_HEADER_INCOMPLETE);
 
 		DEBUG_TRACE("packet too short for TCP header\n");
 		return 0;
@@ -1647,8 +1868,6 @@ static int sfe_ipv6_recv_tcp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 	dest_port = tcph->dest;
 	flags = tcp_flag_word(tcph);
 
-	spin_lock_bh(&si->lock);
-
 	/*
 	 * Look for a connection match.
 	 */
@@ -1667,16 +1886,12 @@ static int sfe_ipv6_recv_tcp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 		 * For diagnostic purposes we differentiate this here.
 		 */
 		if (likely((flags & (TCP_FLAG_SYN | TCP_FLAG_RST | TCP_FLAG_FIN | TCP_FLAG_ACK)) == TCP_FLAG_ACK)) {
-			si->exception_events[SFE_IPV6_EXCEPTION_EVENT_TCP_NO_CONNECTION_FAST_FLAGS]++;
-			si->packets_not_forwarded++;
-			spin_unlock_bh(&si->lock);
+			sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_TCP_NO_CONNECTION_FAST_FLAGS);
 
 			DEBUG_TRACE("no connection found - fast flags\n");
 			return 0;
 		}
-		si->exception_events[SFE_IPV6_EXCEPTION_EVENT_TCP_NO_CONNECTION_SLOW_FLAGS]++;
-		si->packets_not_forwarded++;
-		spin_unlock_bh(&si->lock);
+		sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_TCP_NO_CONNECTION_SLOW_FLAGS);
 
 		DEBUG_TRACE("no connection found - slow flags: 0x%x\n",
 			    flags & (TCP_FLAG_SYN | TCP_FLAG_RST | TCP_FLAG_FIN | TCP_FLAG_ACK));
@@ -1690,13 +1905,17 @@ static int sfe_ipv6_recv_tcp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 	 */
 	if (unlikely(flush_on_find)) {
 		struct sfe_ipv6_connection *c = cm->connection;
-		sfe_ipv6_remove_connection(si, c);
-		si->exception_events[SFE_IPV6_EXCEPTION_EVENT_TCP_IP_OPTIONS_OR_INITIAL_FRAGMENT]++;
-		si->packets_not_forwarded++;
+		bool ret;
+
+		spin_lock_bh(&si->lock);
+		ret = sfe_ipv6_remove_connection(si, c);
 		spin_unlock_bh(&si->lock);
 
 		DEBUG_TRACE("flush on find\n");
-		sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+		if (ret) {
+			sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+		}
+		sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_TCP_IP_OPTIONS_OR_INITIAL_FRAGMENT);
 		return 0;
 	}
 
@@ -1706,8 +1925,7 @@ static int sfe_ipv6_recv_tcp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 	 * through the slow path.
 	 */
 	if (unlikely(!cm->flow_accel)) {
-		si->packets_not_forwarded++;
-		spin_unlock_bh(&si->lock);
+		sfe_ipv6_stats_inc(si, packets_not_forwarded64);
 		return 0;
 	}
 #endif
@@ -1717,29 +1935,37 @@ static int sfe_ipv6_recv_tcp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 	 */
 	if (unlikely(iph->hop_limit < 2)) {
 		struct sfe_ipv6_connection *c = cm->connection;
-		sfe_ipv6_remove_connection(si, c);
-		si->exception_events[SFE_IPV6_EXCEPTION_EVENT_TCP_SMALL_TTL]++;
-		si->packets_not_forwarded++;
+		bool ret;
+
+		spin_lock_bh(&si->lock);
+		ret = sfe_ipv6_remove_connection(si, c);
 		spin_unlock_bh(&si->lock);
 
 		DEBUG_TRACE("hop_limit too low\n");
-		sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+		if (ret) {
+			sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+		}
+		sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_TCP_SMALL_TTL);
 		return 0;
 	}
 
 	/*
 	 * If our packet is larger than the MTU of the transmit interface then
-	 * we can't forward it easily.
+	 * we can't forward it easily.  GSO packets are checked per segment.
 	 */
-	if (unlikely((len > cm->xmit_dev_mtu) && !skb_is_gso(skb))) {
+	if (unlikely(sfe_exceeds_mtu(skb, len, cm->xmit_dev_mtu))) {
 		struct sfe_ipv6_connection *c = cm->connection;
-		sfe_ipv6_remove_connection(si, c);
-		si->exception_events[SFE_IPV6_EXCEPTION_EVENT_TCP_NEEDS_FRAGMENTATION]++;
-		si->packets_not_forwarded++;
+		bool ret;
+
+		spin_lock_bh(&si->lock);
+		ret = sfe_ipv6_remove_connection(si, c);
 		spin_unlock_bh(&si->lock);
 
 		DEBUG_TRACE("larger than mtu\n");
-		sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+		if (ret) {
+			sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+		}
+		sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_TCP_NEEDS_FRAGMENTATION);
 		return 0;
 	}
 
@@ -1749,14 +1975,18 @@ static int sfe_ipv6_recv_tcp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 	 */
 	if (unlikely((flags & (TCP_FLAG_SYN | TCP_FLAG_RST | TCP_FLAG_FIN | TCP_FLAG_ACK)) != TCP_FLAG_ACK)) {
 		struct sfe_ipv6_connection *c = cm->connection;
-		sfe_ipv6_remove_connection(si, c);
-		si->exception_events[SFE_IPV6_EXCEPTION_EVENT_TCP_FLAGS]++;
-		si->packets_not_forwarded++;
+		bool ret;
+
+		spin_lock_bh(&si->lock);
+		ret = sfe_ipv6_remove_connection(si, c);
 		spin_unlock_bh(&si->lock);
 
 		DEBUG_TRACE("TCP flags: 0x%x are not fast\n",
 			    flags & (TCP_FLAG_SYN | TCP_FLAG_RST | TCP_FLAG_FIN | TCP_FLAG_ACK));
-		sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+		if (ret) {
+			sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+		}
+		sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_TCP_FLAGS);
 		return 0;
 	}
 
@@ -1764,6 +1994,11 @@ static int sfe_ipv6_recv_tcp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 
 	/*
 	 * Are we doing sequence number checking?
+	 *
+	 * This is done without the lock.  Each match entry's end and max_win
+	 * are only written by packets in its own direction and max_end only by
+	 * packets in the other one, so a race can only leave a window check
+	 * briefly stale, which the tracking already tolerates.
 	 */
 	if (likely(!(cm->flags & SFE_IPV6_CONNECTION_MATCH_FLAG_NO_SEQ_CHECK))) {
 		u32 seq;
@@ -1781,14 +2016,18 @@ static int sfe_ipv6_recv_tcp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 		seq = ntohl(tcph->seq);
 		if (unlikely((s32)(seq - (cm->protocol_state.tcp.max_end + 1)) > 0)) {
 			struct sfe_ipv6_connection *c = cm->connection;
-			sfe_ipv6_remove_connection(si, c);
-			si->exception_events[SFE_IPV6_EXCEPTION_EVENT_TCP_SEQ_EXCEEDS_RIGHT_EDGE]++;
-			si->packets_not_forwarded++;
+			bool ret;
+
+			spin_lock_bh(&si->lock);
+			ret = sfe_ipv6_remove_connection(si, c);
 			spin_unlock_bh(&si->lock);
 
 			DEBUG_TRACE("seq: %u exceeds right edge: %u\n",
 				    seq, cm->protocol_state.tcp.max_end + 1);
-			sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+			if (ret) {
+				sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+			}
+			sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_TCP_SEQ_EXCEEDS_RIGHT_EDGE);
 			return 0;
 		}
 
@@ -1798,13 +2037,17 @@ static int sfe_ipv6_recv_tcp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 		data_offs = tcph->doff << 2;
 		if (unlikely(data_offs < sizeof(struct sfe_ipv6_tcp_hdr))) {
 			struct sfe_ipv6_connection *c = cm->connection;
-			sfe_ipv6_remove_connection(si, c);
-			si->exception_events[SFE_IPV6_EXCEPTION_EVENT_TCP_SMALL_DATA_OFFS]++;
-			si->packets_not_forwarded++;
+			bool ret;
+
+			spin_lock_bh(&si->lock);
+			ret = sfe_ipv6_remove_connection(si, c);
 			spin_unlock_bh(&si->lock);
 
 			DEBUG_TRACE("TCP data offset: %u, too small\n", data_offs);
-			sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+			if (ret) {
+				sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+			}
+			sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_TCP_SMALL_DATA_OFFS);
 			return 0;
 		}
 
@@ -1815,13 +2058,17 @@ static int sfe_ipv6_recv_tcp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 		sack = ack;
 		if (unlikely(!sfe_ipv6_process_tcp_option_sack(tcph, data_offs, &sack))) {
 			struct sfe_ipv6_connection *c = cm->connection;
-			sfe_ipv6_remove_connection(si, c);
-			si->exception_events[SFE_IPV6_EXCEPTION_EVENT_TCP_BAD_SACK]++;
-			si->packets_not_forwarded++;
+			bool ret;
+
+			spin_lock_bh(&si->lock);
+			ret = sfe_ipv6_remove_connection(si, c);
 			spin_unlock_bh(&si->lock);
 
 			DEBUG_TRACE("TCP option SACK size is wrong\n");
-			sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+			if (ret) {
+				sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+			}
+			sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_TCP_BAD_SACK);
 			return 0;
 		}
 
@@ -1831,14 +2078,18 @@ static int sfe_ipv6_recv_tcp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 		data_offs += sizeof(struct sfe_ipv6_ip_hdr);
 		if (unlikely(len < data_offs)) {
 			struct sfe_ipv6_connection *c = cm->connection;
-			sfe_ipv6_remove_connection(si, c);
-			si->exception_events[SFE_IPV6_EXCEPTION_EVENT_TCP_BIG_DATA_OFFS]++;
-			si->packets_not_forwarded++;
+			bool ret;
+
+			spin_lock_bh(&si->lock);
+			ret = sfe_ipv6_remove_connection(si, c);
 			spin_unlock_bh(&si->lock);
 
 			DEBUG_TRACE("TCP data offset: %u, past end of packet: %u\n",
 				    data_offs, len);
-			sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+			if (ret) {
+				sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+			}
+			sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_TCP_BIG_DATA_OFFS);
 			return 0;
 		}
 
@@ -1850,14 +2101,18 @@ static int sfe_ipv6_recv_tcp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 		if (unlikely((s32)(end - (cm->protocol_state.tcp.end
 						- counter_cm->protocol_state.tcp.max_win - 1)) < 0)) {
 			struct sfe_ipv6_connection *c = cm->connection;
-			sfe_ipv6_remove_connection(si, c);
-			si->exception_events[SFE_IPV6_EXCEPTION_EVENT_TCP_SEQ_BEFORE_LEFT_EDGE]++;
-			si->packets_not_forwarded++;
+			bool ret;
+
+			spin_lock_bh(&si->lock);
+			ret = sfe_ipv6_remove_connection(si, c);
 			spin_unlock_bh(&si->lock);
 
 			DEBUG_TRACE("seq: %u before left edge: %u\n",
 				    end, cm->protocol_state.tcp.end - counter_cm->protocol_state.tcp.max_win - 1);
-			sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+			if (ret) {
+				sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+			}
+			sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_TCP_SEQ_BEFORE_LEFT_EDGE);
 			return 0;
 		}
 
@@ -1866,14 +2121,18 @@ static int sfe_ipv6_recv_tcp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 		 */
 		if (unlikely((s32)(sack - (counter_cm->protocol_state.tcp.end + 1)) > 0)) {
 			struct sfe_ipv6_connection *c = cm->connection;
-			sfe_ipv6_remove_connection(si, c);
-			si->exception_events[SFE_IPV6_EXCEPTION_EVENT_TCP_ACK_EXCEEDS_RIGHT_EDGE]++;
-			si->packets_not_forwarded++;
+			bool ret;
+
+			spin_lock_bh(&si->lock);
+			ret = sfe_ipv6_remove_connection(si, c);
 			spin_unlock_bh(&si->lock);
 
 			DEBUG_TRACE("ack: %u exceeds right edge: %u\n",
 				    sack, counter_cm->protocol_state.tcp.end + 1);
-			sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+			if (ret) {
+				sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+			}
+			sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_TCP_ACK_EXCEEDS_RIGHT_EDGE);
 			return 0;
 		}
 
@@ -1886,13 +2145,17 @@ static int sfe_ipv6_recv_tcp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 			    - 1;
 		if (unlikely((s32)(sack - left_edge) < 0)) {
 			struct sfe_ipv6_connection *c = cm->connection;
-			sfe_ipv6_remove_connection(si, c);
-			si->exception_events[SFE_IPV6_EXCEPTION_EVENT_TCP_ACK_BEFORE_LEFT_EDGE]++;
-			si->packets_not_forwarded++;
+			bool ret;
+
+			spin_lock_bh(&si->lock);
+			ret = sfe_ipv6_remove_connection(si, c);
 			spin_unlock_bh(&si->lock);
 
 			DEBUG_TRACE("ack: %u before left edge: %u\n", sack, left_edge);
-			sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+			if (ret) {
+				sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+			}
+			sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_TCP_ACK_BEFORE_LEFT_EDGE);
 			return 0;
 		}
 
@@ -1933,9 +2196,7 @@ static int sfe_ipv6_recv_tcp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 		skb = skb_unshare(skb, GFP_ATOMIC);
                 if (!skb) {
 			DEBUG_WARN("Failed to unshare the cloned skb\n");
-			si->exception_events[SFE_IPV6_EXCEPTION_EVENT_CLONED_SKB_UNSHARE_ERROR]++;
-			si->packets_not_forwarded++;
-			spin_unlock_bh(&si->lock);
+			sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_CLONED_SKB_UNSHARE_ERROR);
 
 			return 0;
 		}
@@ -2002,22 +2263,27 @@ static int sfe_ipv6_recv_tcp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 	/*
 	 * Update traffic stats.
 	 */
-	cm->rx_packet_count++;
-	cm->rx_byte_count += len;
+	atomic_inc(&cm->rx_packet_count);
+	atomic_add(len, &cm->rx_byte_count);
 
 	/*
 	 * If we're not already on the active list then insert ourselves at the tail
-	 * of the current list.
+	 * of the current list.  This happens at most once per sync of the
+	 * connection so it is the only time the fast path takes the lock.
 	 */
-	if (unlikely(!cm->active)) {
-		cm->active = true;
-		cm->active_prev = si->active_tail;
-		if (likely(si->active_tail)) {
-			si->active_tail->active_next = cm;
-		} else {
-			si->active_head = cm;
+	if (unlikely(!READ_ONCE(cm->active))) {
+		spin_lock_bh(&si->lock);
+		if (!cm->active && !cm->connection->removed) {
+			cm->active = true;
+			cm->active_prev = si->active_tail;
+			if (likely(si->active_tail)) {
+				si->active_tail->active_next = cm;
+			} else {
+				si->active_head = cm;
+			}
+			si->active_tail = cm;
 		}
-		si->active_tail = cm;
+		spin_unlock_bh(&si->lock);
 	}
 
 	xmit_dev = cm->xmit_dev;
@@ -2060,8 +2326,7 @@ static int sfe_ipv6_recv_tcp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 		DEBUG_TRACE("SKB MARK is NON ZERO %x\n", skb->mark);
 	}
 
-	si->packets_forwarded++;
-	spin_unlock_bh(&si->lock);
+	sfe_ipv6_stats_inc(si, packets_forwarded64);
 
 	/*
 	 * We're going to check for GSO flags when we transmit the packet so
@@ -2077,7 +2342,7 @@ static int sfe_ipv6_recv_tcp(struct sfe_ipv6 *si, struct sk_buff *skb, struct ne
 	/*
 	 * Send the packet on its way.
 	 */
-	dev_queue_xmit(skb);
+	sfe_ipv6_xmit(skb);
 
 	return 1;
 }
@@ -2105,6 +2370,7 @@ static int sfe_ipv6_recv_icmp(struct sfe_ipv6 *si, struct sk_buff *skb, struct n
 	__be16 dest_port;
 	struct sfe_ipv6_connection_match *cm;
 	struct sfe_ipv6_connection *c;
+	bool ret;
 	u8 next_hdr;
 
 	/*
@@ -2112,10 +2378,7 @@ static int sfe_ipv6_recv_icmp(struct sfe_ipv6 *si, struct sk_buff *skb, struct n
 	 */
 	len -= ihl;
 	if (!pskb_may_pull(skb, ihl + sizeof(struct icmp6hdr))) {
-		spin_lock_bh(&si->lock);
-		si->exception_events[SFE_IPV6_EXCEPTION_EVENT_ICMP_HEADER_INCOMPLETE]++;
-		si->packets_not_forwarded++;
-		spin_unlock_bh(&si->lock);
+		sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_ICMP_HEADER_INCOMPLETE);
 
 		DEBUG_TRACE("packet too short for ICMP header\n");
 		return 0;
@@ -2127,10 +2390,7 @@ static int sfe_ipv6_recv_icmp(struct sfe_ipv6 *si, struct sk_buff *skb, struct n
 	icmph = (struct icmp6hdr *)(skb->data + ihl);
 	if ((icmph->icmp6_type != ICMPV6_DEST_UNREACH)
 	    && (icmph->icmp6_type != ICMPV6_TIME_EXCEED)) {
-		spin_lock_bh(&si->lock);
-		si->exception_events[SFE_IPV6_EXCEPTION_EVENT_ICMP_UNHANDLED_TYPE]++;
-		si->packets_not_forwarded++;
-		spin_unlock_bh(&si->lock);
+		sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_ICMP_UNHANDLED_TYPE);
 
 		DEBUG_TRACE("unhandled ICMP type: 0x%x\n", icmph->icmp6_type);
 		return 0;
@@ -2144,10 +2404,7 @@ static int sfe_ipv6_recv_icmp(struct sfe_ipv6 *si, struct sk_buff *skb, struct n
 	len -= sizeof(struct icmp6hdr);
 	ihl += sizeof(struct icmp6hdr);
 	if (!pskb_may_pull(skb, ihl + sizeof(struct sfe_ipv6_ip_hdr) + sizeof(struct sfe_ipv6_ext_hdr))) {
-		spin_lock_bh(&si->lock);
-		si->exception_events[SFE_IPV6_EXCEPTION_EVENT_ICMP_IPV6_HEADER_INCOMPLETE]++;
-		si->packets_not_forwarded++;
-		spin_unlock_bh(&si->lock);
+		sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_ICMP_IPV6_HEADER_INCOMPLETE);
 
 		DEBUG_TRACE("Embedded IP header not complete\n");
 		return 0;
@@ -2158,10 +2415,7 @@ static int sfe_ipv6_recv_icmp(struct sfe_ipv6 *si, struct sk_buff *skb, struct n
 	 */
 	icmp_iph = (struct sfe_ipv6_ip_hdr *)(icmph + 1);
 	if (unlikely(icmp_iph->version != 6)) {
-		spin_lock_bh(&si->lock);
-		si->exception_events[SFE_IPV6_EXCEPTION_EVENT_ICMP_IPV6_NON_V6]++;
-		si->packets_not_forwarded++;
-		spin_unlock_bh(&si->lock);
+		sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_ICMP_IPV6_NON_V6);
 
 		DEBUG_TRACE("IP version: %u\n", icmp_iph->version);
 		return 0;
@@ -2180,10 +2434,7 @@ static int sfe_ipv6_recv_icmp(struct sfe_ipv6 *si, struct sk_buff *skb, struct n
 			unsigned int frag_off = ntohs(frag_hdr->frag_off);
 
 			if (frag_off & SFE_IPV6_FRAG_OFFSET) {
-				spin_lock_bh(&si->lock);
-				si->exception_events[SFE_IPV6_EXCEPTION_EVENT_NON_INITIAL_FRAGMENT]++;
-				si->packets_not_forwarded++;
-				spin_unlock_bh(&si->lock);
+				sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_NON_INITIAL_FRAGMENT);
 
 				DEBUG_TRACE("non-initial fragment\n");
 				return 0;
@@ -2200,10 +2451,7 @@ static int sfe_ipv6_recv_icmp(struct sfe_ipv6 *si, struct sk_buff *skb, struct n
 		 * the connection.
 		 */
 		if (!pskb_may_pull(skb, ihl + sizeof(struct sfe_ipv6_ext_hdr))) {
-			spin_lock_bh(&si->lock);
-			si->exception_events[SFE_IPV6_EXCEPTION_EVENT_HEADER_INCOMPLETE]++;
-			si->packets_not_forwarded++;
-			spin_unlock_bh(&si->lock);
+			sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_HEADER_INCOMPLETE);
 
 			DEBUG_TRACE("extension header %d not completed\n", next_hdr);
 			return 0;
@@ -2229,10 +2477,7 @@ static int sfe_ipv6_recv_icmp(struct sfe_ipv6 *si, struct sk_buff *skb, struct n
 		break;
 
 	default:
-		spin_lock_bh(&si->lock);
-		si->exception_events[SFE_IPV6_EXCEPTION_EVENT_ICMP_IPV6_UNHANDLED_PROTOCOL]++;
-		si->packets_not_forwarded++;
-		spin_unlock_bh(&si->lock);
+		sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_ICMP_IPV6_UNHANDLED_PROTOCOL);
 
 		DEBUG_TRACE("Unhandled embedded IP protocol: %u\n", next_hdr);
 		return 0;
@@ -2241,8 +2486,6 @@ static int sfe_ipv6_recv_icmp(struct sfe_ipv6 *si, struct sk_buff *skb, struct n
 	src_ip = &icmp_iph->saddr;
 	dest_ip = &icmp_iph->daddr;
 
-	spin_lock_bh(&si->lock);
-
 	/*
 	 * Look for a connection match.  Note that we reverse the source and destination
 	 * here because our embedded message contains a packet that was sent in the
@@ -2252,9 +2495,7 @@ static int sfe_ipv6_recv_icmp(struct sfe_ipv6 *si, struct sk_buff *skb, struct n
 	 */
 	cm = sfe_ipv6_find_connection_match(si, dev, icmp_iph->nexthdr, dest_ip, dest_port, src_ip, src_port);
 	if (unlikely(!cm)) {
-		si->exception_events[SFE_IPV6_EXCEPTION_EVENT_ICMP_NO_CONNECTION]++;
-		si->packets_not_forwarded++;
-		spin_unlock_bh(&si->lock);
+		sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_ICMP_NO_CONNECTION);
 
 		DEBUG_TRACE("no connection found\n");
 		return 0;
@@ -2265,12 +2506,14 @@ static int sfe_ipv6_recv_icmp(struct sfe_ipv6 *si, struct sk_buff *skb, struct n
 	 * its state.
 	 */
 	c = cm->connection;
-	sfe_ipv6_remove_connection(si, c);
-	si->exception_events[SFE_IPV6_EXCEPTION_EVENT_ICMP_FLUSHED_CONNECTION]++;
-	si->packets_not_forwarded++;
+	spin_lock_bh(&si->lock);
+	ret = sfe_ipv6_remove_connection(si, c);
 	spin_unlock_bh(&si->lock);
 
-	sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+	if (ret) {
+		sfe_ipv6_flush_connection(si, c, SFE_SYNC_REASON_FLUSH);
+	}
+	sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_ICMP_FLUSHED_CONNECTION);
 	return 0;
 }
 
@@ -2279,10 +2522,14 @@ static int sfe_ipv6_recv_icmp(struct sfe_ipv6 *si, struct sk_buff *skb, struct n
  *	Handle packet receives and forwaring.
  *
  * Returns 1 if the packet is forwarded or 0 if it isn't.
+ *
+ * Connection lookups are done under RCU, the lock is only taken when a
+ * connection has to be flushed or joins the active list.
  */
 int sfe_ipv6_recv(struct net_device *dev, struct sk_buff *skb)
 {
 	struct sfe_ipv6 *si = &__si6;
+	int ret;
 	unsigned int len;
 	unsigned int payload_len;
 	unsigned int ihl = sizeof(struct sfe_ipv6_ip_hdr);
@@ -2295,10 +2542,7 @@ int sfe_ipv6_recv(struct net_device *dev, struct sk_buff *skb)
 	 */
 	len = skb->len;
 	if (!pskb_may_pull(skb, ihl + sizeof(struct sfe_ipv6_ext_hdr))) {
-		spin_lock_bh(&si->lock);
-		si->exception_events[SFE_IPV6_EXCEPTION_EVENT_HEADER_INCOMPLETE]++;
-		si->packets_not_forwarded++;
-		spin_unlock_bh(&si->lock);
+		sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_HEADER_INCOMPLETE);
 
 		DEBUG_TRACE("len: %u is too short\n", len);
 		return 0;
@@ -2309,10 +2553,7 @@ int sfe_ipv6_recv(struct net_device *dev, struct sk_buff *skb)
 	 */
 	iph = (struct sfe_ipv6_ip_hdr *)skb->data;
 	if (unlikely(iph->version != 6)) {
-		spin_lock_bh(&si->lock);
-		si->exception_events[SFE_IPV6_EXCEPTION_EVENT_NON_V6]++;
-		si->packets_not_forwarded++;
-		spin_unlock_bh(&si->lock);
+		sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_NON_V6);
 
 		DEBUG_TRACE("IP version: %u\n", iph->version);
 		return 0;
@@ -2323,10 +2564,7 @@ int sfe_ipv6_recv(struct net_device *dev, struct sk_buff *skb)
 	 */
 	payload_len = ntohs(iph->payload_len);
 	if (unlikely(payload_len > (len - ihl))) {
-		spin_lock_bh(&si->lock);
-		si->exception_events[SFE_IPV6_EXCEPTION_EVENT_DATAGRAM_INCOMPLETE]++;
-		si->packets_not_forwarded++;
-		spin_unlock_bh(&si->lock);
+		sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_DATAGRAM_INCOMPLETE);
 
 		DEBUG_TRACE("payload_len: %u, exceeds len: %u\n", payload_len, (len - sizeof(struct sfe_ipv6_ip_hdr)));
 		return 0;
@@ -2343,10 +2581,7 @@ int sfe_ipv6_recv(struct net_device *dev, struct sk_buff *skb)
 			unsigned int frag_off = ntohs(frag_hdr->frag_off);
 
 			if (frag_off & SFE_IPV6_FRAG_OFFSET) {
-				spin_lock_bh(&si->lock);
-				si->exception_events[SFE_IPV6_EXCEPTION_EVENT_NON_INITIAL_FRAGMENT]++;
-				si->packets_not_forwarded++;
-				spin_unlock_bh(&si->lock);
+				sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_NON_INITIAL_FRAGMENT);
 
 				DEBUG_TRACE("non-initial fragment\n");
 				return 0;
@@ -2358,10 +2593,7 @@ int sfe_ipv6_recv(struct net_device *dev, struct sk_buff *skb)
 		ext_hdr_len += sizeof(struct sfe_ipv6_ext_hdr);
 		ihl += ext_hdr_len;
 		if (!pskb_may_pull(skb, ihl + sizeof(struct sfe_ipv6_ext_hdr))) {
-			spin_lock_bh(&si->lock);
-			si->exception_events[SFE_IPV6_EXCEPTION_EVENT_HEADER_INCOMPLETE]++;
-			si->packets_not_forwarded++;
-			spin_unlock_bh(&si->lock);
+			sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_HEADER_INCOMPLETE);
 
 			DEBUG_TRACE("extension header %d not completed\n", next_hdr);
 			return 0;
@@ -2372,21 +2604,27 @@ int sfe_ipv6_recv(struct net_device *dev, struct sk_buff *skb)
 	}
 
 	if (IPPROTO_UDP == next_hdr) {
-		return sfe_ipv6_recv_udp(si, skb, dev, len, iph, ihl, flush_on_find);
+		rcu_read_lock();
+		ret = sfe_ipv6_recv_udp(si, skb, dev, len, iph, ihl, flush_on_find);
+		rcu_read_unlock();
+		return ret;
 	}
 
 	if (IPPROTO_TCP == next_hdr) {
-		return sfe_ipv6_recv_tcp(si, skb, dev, len, iph, ihl, flush_on_find);
+		rcu_read_lock();
+		ret = sfe_ipv6_recv_tcp(si, skb, dev, len, iph, ihl, flush_on_find);
+		rcu_read_unlock();
+		return ret;
 	}
 
 	if (IPPROTO_ICMPV6 == next_hdr) {
-		return sfe_ipv6_recv_icmp(si, skb, dev, len, iph, ihl);
+		rcu_read_lock();
+		ret = sfe_ipv6_recv_icmp(si, skb, dev, len, iph, ihl);
+		rcu_read_unlock();
+		return ret;
 	}
 
-	spin_lock_bh(&si->lock);
-	si->exception_events[SFE_IPV6_EXCEPTION_EVENT_UNHANDLED_PROTOCOL]++;
-	si->packets_not_forwarded++;
-	spin_unlock_bh(&si->lock);
+	sfe_ipv6_exception_stats_inc(si, SFE_IPV6_EXCEPTION_EVENT_UNHANDLED_PROTOCOL);
 
 	DEBUG_TRACE("not UDP, TCP or ICMP: %u\n", next_hdr);
 	return 0;
@@ -2573,9 +2811,9 @@ int sfe_ipv6_create_rule(struct sfe_connection_create *sic)
 	original_cm->xlate_src_port = sic->src_port_xlate;
 	original_cm->xlate_dest_ip[0] = sic->dest_ip_xlate.ip6[0];
 	original_cm->xlate_dest_port = sic->dest_port_xlate;
-	original_cm->rx_packet_count = 0;
+	atomic_set(&original_cm->rx_packet_count, 0);
 	original_cm->rx_packet_count64 = 0;
-	original_cm->rx_byte_count = 0;
+	atomic_set(&original_cm->rx_byte_count, 0);
 	original_cm->rx_byte_count64 = 0;
 	original_cm->xmit_dev = dest_dev;
 	original_cm->xmit_dev_mtu = sic->dest_mtu;
@@ -2632,9 +2870,9 @@ int sfe_ipv6_create_rule(struct sfe_connection_create *sic)
 	reply_cm->xlate_src_port = sic->dest_port;
 	reply_cm->xlate_dest_ip[0] = sic->src_ip.ip6[0];
 	reply_cm->xlate_dest_port = sic->src_port;
-	reply_cm->rx_packet_count = 0;
+	atomic_set(&reply_cm->rx_packet_count, 0);
 	reply_cm->rx_packet_count64 = 0;
-	reply_cm->rx_byte_count = 0;
+	atomic_set(&reply_cm->rx_byte_count, 0);
 	reply_cm->rx_byte_count64 = 0;
 	reply_cm->xmit_dev = src_dev;
 	reply_cm->xmit_dev_mtu = sic->src_mtu;
@@ -2705,6 +2943,7 @@ int sfe_ipv6_create_rule(struct sfe_connection_create *sic)
 	c->mark = sic->mark;
 	c->debug_read_seq = 0;
 	c->last_sync_jiffies = get_jiffies_64();
+	c->removed = false;
 
 	/*
 	 * Take hold of our source and dest devices for the duration of the connection.
@@ -3042,6 +3281,7 @@ static bool sfe_ipv6_debug_dev_read_connections_connection(struct sfe_ipv6 *si,
 	u64 dest_rx_bytes;
 	u64 last_sync_jiffies;
 	u32 mark, src_priority, dest_priority, src_dscp, dest_dscp;
+	u32 new_packets, new_bytes;
 #ifdef CONFIG_NF_FLOW_COOKIE
 	int src_flow_cookie, dst_flow_cookie;
 #endif
@@ -3076,8 +3316,8 @@ static bool sfe_ipv6_debug_dev_read_connections_connection(struct sfe_ipv6 *si,
 	src_priority = original_cm->priority;
 	src_dscp = original_cm->dscp >> SFE_IPV6_DSCP_SHIFT;
 
-	sfe_ipv6_connection_match_update_summary_stats(original_cm);
-	sfe_ipv6_connection_match_update_summary_stats(reply_cm);
+	sfe_ipv6_connection_match_update_summary_stats(original_cm, &new_packets, &new_bytes);
+	sfe_ipv6_connection_match_update_summary_stats(reply_cm, &new_packets, &new_bytes);
 
 	src_rx_packets = original_cm->rx_packet_count64;
 	src_rx_bytes = original_cm->rx_byte_count64;
@@ -3192,9 +3432,8 @@ static bool sfe_ipv6_debug_dev_read_exceptions_exception(struct sfe_ipv6 *si, ch
 {
 	u64 ct;
 
-	spin_lock_bh(&si->lock);
-	ct = si->exception_events64[ws->iter_exception];
-	spin_unlock_bh(&si->lock);
+	ct = sfe_ipv6_stats_sum(si, offsetof(struct sfe_ipv6_stats, exception_events64) +
+				ws->iter_exception * sizeof(u64));
 
 	if (ct) {
 		int bytes_read;
@@ -3258,30 +3497,68 @@ static bool sfe_ipv6_debug_dev_read_stats(struct sfe_ipv6 *si, char *buffer, cha
 	u64 connection_destroy_misses;
 	u64 connection_flushes;
 	u64 connection_match_hash_hits;
-	u64 connection_match_hash_reorders;
+	struct sfe_ipv6_connection_match_hash *h;
+	unsigned int hash_size;
+	unsigned int hash_used = 0;
+	unsigned int hash_entries = 0;
+	unsigned int hash_max_chain = 0;
+	unsigned int hash_avg_chain;
+	unsigned int i;
 
 	spin_lock_bh(&si->lock);
 	sfe_ipv6_update_summary_stats(si);
 
+	/*
+	 * Measure the connection match hash chains.
+	 */
+	h = rcu_dereference_protected(si->conn_match_hash, lockdep_is_held(&si->lock));
+	hash_size = 1 << h->shift;
+	for (i = 0; i < hash_size; i++) {
+		struct hlist_node *node;
+		unsigned int len = 0;
+
+		hlist_for_each(node, &h->heads[i]) {
+			len++;
+		}
+
+		if (!len) {
+			continue;
+		}
+
+		hash_used++;
+		hash_entries += len;
+		if (len > hash_max_chain) {
+			hash_max_chain = len;
+		}
+	}
+
 	num_connections = si->num_connections;
-	packets_forwarded = si->packets_forwarded64;
-	packets_not_forwarded = si->packets_not_forwarded64;
 	connection_create_requests = si->connection_create_requests64;
 	connection_create_collisions = si->connection_create_collisions64;
 	connection_destroy_requests = si->connection_destroy_requests64;
 	connection_destroy_misses = si->connection_destroy_misses64;
 	connection_flushes = si->connection_flushes64;
-	connection_match_hash_hits = si->connection_match_hash_hits64;
-	connection_match_hash_reorders = si->connection_match_hash_reorders64;
+	packets_forwarded = sfe_ipv6_stats_sum(si, offsetof(struct sfe_ipv6_stats, packets_forwarded64)) -
+			    si->packets_forwarded_cleared64;
+	packets_not_forwarded = sfe_ipv6_stats_sum(si, offsetof(struct sfe_ipv6_stats, packets_not_forwarded64)) -
+				si->packets_not_forwarded_cleared64;
+	connection_match_hash_hits = sfe_ipv6_stats_sum(si, offsetof(struct sfe_ipv6_stats, connection_match_hash_hits64)) -
+				     si->connection_match_hash_hits_cleared64;
 	spin_unlock_bh(&si->lock);
 
+	/*
+	 * Average length of the chains that are in use, in hundredths.
+	 */
+	hash_avg_chain = hash_used ? (hash_entries * 100) / hash_used : 0;
+
 	bytes_read = snprintf(msg, CHAR_DEV_MSG_SIZE, "\t<stats "
 			      "num_connections=\"%u\" "
 			      "pkts_forwarded=\"%llu\" pkts_not_forwarded=\"%llu\" "
 			      "create_requests=\"%llu\" create_collisions=\"%llu\" "
 			      "destroy_requests=\"%llu\" destroy_misses=\"%llu\" "
 			      "flushes=\"%llu\" "
-			      "hash_hits=\"%llu\" hash_reorders=\"%llu\" />\n",
+			      "hash_hits=\"%llu\" hash_size=\"%u\" "
+			      "hash_max_chain=\"%u\" hash_avg_chain=\"%u.%02u\" />\n",
 			      num_connections,
 			      packets_forwarded,
 			      packets_not_forwarded,
@@ -3291,7 +3568,9 @@ static bool sfe_ipv6_debug_dev_read_stats(struct sfe_ipv6 *si, char *buffer, cha
 			      connection_destroy_misses,
 			      connection_flushes,
 			      connection_match_hash_hits,
-			      connection_match_hash_reorders);
+			      hash_size,
+			      hash_max_chain,
+			      hash_avg_chain / 100, hash_avg_chain % 100);
 	if (copy_to_user(buffer + *total_read, msg, CHAR_DEV_MSG_SIZE)) {
 		return false;
 	}
@@ -3372,15 +3651,19 @@ static ssize_t sfe_ipv6_debug_dev_write(struct file *filp, const char *buffer, s
 	spin_lock_bh(&si->lock);
 	sfe_ipv6_update_summary_stats(si);
 
-	si->packets_forwarded64 = 0;
-	si->packets_not_forwarded64 = 0;
 	si->connection_create_requests64 = 0;
 	si->connection_create_collisions64 = 0;
 	si->connection_destroy_requests64 = 0;
 	si->connection_destroy_misses64 = 0;
 	si->connection_flushes64 = 0;
-	si->connection_match_hash_hits64 = 0;
-	si->connection_match_hash_reorders64 = 0;
+
+	/*
+	 * Only the CPU owning a per-CPU counter may write it, so remember the
+	 * totals instead of clearing them.
+	 */
+	si->packets_forwarded_cleared64 = sfe_ipv6_stats_sum(si, offsetof(struct sfe_ipv6_stats, packets_forwarded64));
+	si->packets_not_forwarded_cleared64 = sfe_ipv6_stats_sum(si, offsetof(struct sfe_ipv6_stats, packets_not_forwarded64));
+	si->connection_match_hash_hits_cleared64 = sfe_ipv6_stats_sum(si, offsetof(struct sfe_ipv6_stats, connection_match_hash_hits64));
 	spin_unlock_bh(&si->lock);
 
 	return length;
@@ -3505,6 +3788,129 @@ static const struct device_attribute sfe_ipv6_flow_cookie_attr =
 	__ATTR(flow_cookie_enable, S_IWUSR | S_IRUGO, sfe_ipv6_get_flow_cookie, sfe_ipv6_set_flow_cookie);
 #endif /*CONFIG_NF_FLOW_COOKIE*/
 
+/*
+ * sfe_ipv6_alloc_connection_match_hash()
+ *	Allocate an empty connection match hash table with 1 << shift buckets.
+ */
+static struct sfe_ipv6_connection_match_hash *sfe_ipv6_alloc_connection_match_hash(unsigned int shift)
+{
+	struct sfe_ipv6_connection_match_hash *h;
+
+	h = vzalloc(sizeof(*h) + (sizeof(struct hlist_head) << shift));
+	if (!h) {
+		return NULL;
+	}
+
+	h->shift = shift;
+	get_random_bytes(&h->seed, sizeof(h->seed));
+	return h;
+}
+
+/*
+ * sfe_ipv6_move_connection_match()
+ *	Move a connection match object to the same chain of a new hash table.
+ *
+ * On entry we must be holding the lock that protects the hash table.
+ */
+static inline void sfe_ipv6_move_connection_match(struct sfe_ipv6_connection_match_hash *h, struct sfe_ipv6_connection_match *cm)
+{
+	unsigned int conn_match_idx
+		= sfe_ipv6_get_connection_match_hash(h, cm->match_dev, cm->match_protocol,
+						     cm->match_src_ip, cm->match_src_port,
+						     cm->match_dest_ip, cm->match_dest_port);
+
+	/*
+	 * This is not a safe RCU move: a reader that is on this entry carries on
+	 * down the new chain, so it can miss the rest of the old one.  That is
+	 * fine here because the chain still ends in NULL, a hit still compares
+	 * the whole 5-tuple, and a miss only sends the packet through the Linux
+	 * stack, which is what happens before a rule is created.  Copying every
+	 * entry instead would mean freeing each one after a grace period.
+	 */
+	hlist_del_rcu(&cm->hnode);
+	hlist_add_head_rcu(&cm->hnode, &h->heads[conn_match_idx]);
+}
+
+/*
+ * sfe_ipv6_resize_connection_match_hash()
+ *	Rehash all connection match objects into a table with 1 << shift buckets.
+ *
+ * Packets that miss an entry while it is being moved are simply passed to the
+ * Linux stack, the connection itself is not affected.
+ */
+static int sfe_ipv6_resize_connection_match_hash(struct sfe_ipv6 *si, unsigned int shift)
+{
+	struct sfe_ipv6_connection_match_hash *old_h;
+	struct sfe_ipv6_connection_match_hash *new_h;
+	struct sfe_ipv6_connection *c;
+
+	new_h = sfe_ipv6_alloc_connection_match_hash(shift);
+	if (!new_h) {
+		return -ENOMEM;
+	}
+
+	spin_lock_bh(&si->lock);
+	old_h = rcu_dereference_protected(si->conn_match_hash, lockdep_is_held(&si->lock));
+	for (c = si->all_connections_head; c; c = c->all_connections_next) {
+		sfe_ipv6_move_connection_match(new_h, c->original_match);
+		sfe_ipv6_move_connection_match(new_h, c->reply_match);
+	}
+	rcu_assign_pointer(si->conn_match_hash, new_h);
+	spin_unlock_bh(&si->lock);
+
+	DEBUG_INFO("IPv6 connection match hash resized from %u to %u buckets\n",
+		   1 << old_h->shift, 1 << shift);
+
+	synchronize_rcu();
+	vfree(old_h);
+	return 0;
+}
+
+/*
+ * Log2 of the number of connection match hash buckets.
+ */
+static unsigned int sfe_ipv6_conn_match_hash_shift = SFE_IPV6_CONNECTION_HASH_SHIFT;
+
+/*
+ * sfe_ipv6_set_conn_match_hash_shift()
+ *	Resize the connection match hash table when the module parameter is written.
+ */
+static int sfe_ipv6_set_conn_match_hash_shift(const char *val, const struct kernel_param *kp)
+{
+	struct sfe_ipv6 *si = &__si6;
+	unsigned int shift;
+	int result;
+
+	result = kstrtouint(val, 0, &shift);
+	if (result) {
+		return result;
+	}
+
+	if ((shift < SFE_IPV6_CONNECTION_MATCH_HASH_SHIFT_MIN) || (shift > SFE_IPV6_CONNECTION_MATCH_HASH_SHIFT_MAX)) {
+		return -EINVAL;
+	}
+
+	/*
+	 * Before the module is initialised we only record the size to use.
+	 */
+	if (rcu_access_pointer(si->conn_match_hash)) {
+		result = sfe_ipv6_resize_connection_match_hash(si, shift);
+		if (result) {
+			return result;
+		}
+	}
+
+	sfe_ipv6_conn_match_hash_shift = shift;
+	return 0;
+}
+
+static const struct kernel_param_ops sfe_ipv6_conn_match_hash_shift_ops = {
+	.set = sfe_ipv6_set_conn_match_hash_shift,
+	.get = param_get_uint,
+};
+module_param_cb(conn_match_hash_shift, &sfe_ipv6_conn_match_hash_shift_ops, &sfe_ipv6_conn_match_hash_shift, 0644);
+MODULE_PARM_DESC(conn_match_hash_shift, "Log2 of the number of connection match hash buckets");
+
 /*
  * sfe_ipv6_init()
  */
@@ -3512,9 +3918,30 @@ static int __init sfe_ipv6_init(void)
 {
 	struct sfe_ipv6 *si = &__si6;
 	int result = -1;
+	int cpu;
 
 	DEBUG_INFO("SFE IPv6 init\n");
 
+	si->stats_pcpu = alloc_percpu(struct sfe_ipv6_stats);
+	if (!si->stats_pcpu) {
+		DEBUG_ERROR("failed to allocate stats memory for sfe_ipv6\n");
+		result = -ENOMEM;
+		goto exit0;
+	}
+
+	for_each_possible_cpu(cpu) {
+		u64_stats_init(&per_cpu_ptr(si->stats_pcpu, cpu)->syncp);
+	}
+
+	si->conn_match_hash = sfe_ipv6_alloc_connection_match_hash(sfe_ipv6_conn_match_hash_shift);
+	if (!si->conn_match_hash) {
+		DEBUG_ERROR("failed to allocate connection match hash for sfe_ipv6\n");
+		result = -ENOMEM;
+		goto exit1;
+	}
+
+	sfe_ipv6_xmit_batch_init();
+
 	/*
 	 * Create sys/sfe_ipv6
 	 */
@@ -3579,6 +4006,11 @@ exit2:
 	kobject_put(si->sys_sfe_ipv6);
 
 exit1:
+	vfree(rcu_dereference_protected(si->conn_match_hash, true));
+	RCU_INIT_POINTER(si->conn_match_hash, NULL);
+	free_percpu(si->stats_pcpu);
+
+exit0:
 	return result;
 }
 
@@ -3598,6 +4030,21 @@ static void __exit sfe_ipv6_exit(void)
 
 	del_timer_sync(&si->timer);
 
+	sfe_ipv6_xmit_batch_exit();
+
+	/*
+	 * Wait for the connections to be freed.
+	 */
+	rcu_barrier();
+
+	/*
+	 * Keep the hash table from being resized while we free it.
+	 */
+	kernel_param_lock(THIS_MODULE);
+	vfree(rcu_dereference_protected(si->conn_match_hash, true));
+	RCU_INIT_POINTER(si->conn_match_hash, NULL);
+	kernel_param_unlock(THIS_MODULE);
+
 	unregister_chrdev(si->debug_dev, "sfe_ipv6");
 
 #ifdef CONFIG_NF_FLOW_COOKIE
@@ -3606,6 +4053,8 @@ static void __exit sfe_ipv6_exit(void)
 	sysfs_remove_file(si->sys_sfe_ipv6, &sfe_ipv6_debug_dev_attr.attr);
 
 	kobject_put(si->sys_sfe_ipv6);
+
+	free_percpu(si->stats_pcpu);
 }
 
 module_init(sfe_ipv6_init)
@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ * swconfig-dummy.c: software switch without hardware, for testing swconfig
+ *
+ * Registers a switch with the given number of ports. Every port reports
+ * the given number of mib counters, by default more than
+ * SWITCH_PORT_MIBS_MAX so the 'mibs' dump has to grow its buffer. The
+ * counters advance by the port number plus one on every read.
+ *
+ *   insmod swconfig-dummy ports=5 mibs=80
+ *   swconfig dev switch-dummy mibs
+ */
+
+#include <linux/kernel.h>
+#include <linux/module.h>
+#include <linux/slab.h>
+#include <linux/switch.h>
+
+static int ports = 5;
+module_param(ports, int, 0444);
+MODULE_PARM_DESC(ports, "number of switch ports");
+
+static int mibs = SWITCH_PORT_MIBS_MAX + 16;
+module_param(mibs, int, 0444);
+MODULE_PARM_DESC(mibs, "number of mib counters per port");
+
+struct swconfig_dummy {
+	struct switch_dev dev;
+	struct mutex lock;
+	char (*names)[16];
+	u64 *values;
+};
+
+static struct swconfig_dummy *dummy;
+
+static int
+swconfig_dummy_get_port_mibs(struct switch_dev *dev, int port,
+			     struct switch_port_mib *out, int n_mibs)
+{
+	struct swconfig_dummy *priv = container_of(dev, struct swconfig_dummy, dev);
+	u64 *values;
+	int i;
+
+	if (port >= dev->ports)
+		return -EINVAL;
+
+	mutex_lock(&priv->lock);
+	values = &priv->values[port * mibs];
+	for (i = 0; i < mibs; i++) {
+		values[i] += port + 1;
+		if (i < n_mibs) {
+			out[i].name = priv->names[i];
+			out[i].value = values[i];
+		}
+	}
+	mutex_unlock(&priv->lock);
+
+	return mibs;
+}
+
+static int
+swconfig_dummy_get_port_link(struct switch_dev *dev, int port,
+			     struct switch_port_link *link)
+{
+	if (port >= dev->ports)
+		return -EINVAL;
+
+	link->link = true;
+	link->duplex = true;
+	link->speed = SWITCH_PORT_SPEED_1000;
+
+	return 0;
+}
+
+static const struct switch_dev_ops swconfig_dummy_ops = {
+	.get_port_link = swconfig_dummy_get_port_link,
+	.get_port_mibs = swconfig_dummy_get_port_mibs,
+};
+
+static int __init swconfig_dummy_init(void)
+{
+	int err = -ENOMEM;
+	int i;
+
+	if (ports <= 0 || mibs <= 0)
+		return -EINVAL;
+
+	dummy = kzalloc(sizeof(*dummy), GFP_KERNEL);
+	if (!dummy)
+		return -ENOMEM;
+
+	dummy->names = kcalloc(mibs, sizeof(*dummy->names), GFP_KERNEL);
+	dummy->values = kcalloc(ports * mibs, sizeof(*dummy->values), GFP_KERNEL);
+	if (!dummy->names || !dummy->values)
+		goto error;
+
+	for (i = 0; i < mibs; i++)
+		snprintf(dummy->names[i], sizeof(dummy->names[i]), "Counter%d", i);
+
+	mutex_init(&dummy->lock);
+	dummy->dev.name = "dummy";
+	dummy->dev.alias = "switch-dummy";
+	dummy->dev.ops = &swconfig_dummy_ops;
+	dummy->dev.ports = ports;
+	dummy->dev.cpu_port = 0;
+
+	err = register_switch(&dummy->dev, NULL);
+	if (err)
+		goto error;
+
+	return 0;
+
+error:
+	kfree(dummy->values);
+	kfree(dummy->names);
+	kfree(dummy);
+	return err;
+}
+
+static void __exit swconfig_dummy_exit(void)
+{
+	unregister_switch(&dummy->dev);
+	kfree(dummy->values);
+	kfree(dummy->names);
+	kfree(dummy);
+}
+
+module_init(swconfig_dummy_init);
+module_exit(swconfig_dummy_exit);
+
+MODULE_DESCRIPTION("Software switch for testing swconfig");
+MODULE_LICENSE("GPL v2");
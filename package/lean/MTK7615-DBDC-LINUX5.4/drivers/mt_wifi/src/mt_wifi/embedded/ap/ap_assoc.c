@@ -384,6 +384,10 @@ static USHORT update_associated_mac_entry(
 	}
 
 #endif /*HOSTAPD_SUPPORT*/
+#ifdef IGMP_SNOOP_SUPPORT
+	/* static group memberships set before the station associated */
+	IgmpGroupAddPendingMembers(pAd, pEntry->Addr, wdev, pEntry->wcid);
+#endif /* IGMP_SNOOP_SUPPORT */
 	return MLME_SUCCESS;
 }
 
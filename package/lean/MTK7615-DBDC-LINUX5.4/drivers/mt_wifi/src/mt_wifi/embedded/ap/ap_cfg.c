@@ -856,7 +856,7 @@ static INT show_starv_info_proc(
 static struct {
 	RTMP_STRING *name;
 	INT (*set_proc)(PRTMP_ADAPTER pAdapter, RTMP_STRING *arg);
-} *PRTMP_PRIVATE_SET_PROC, RTMP_PRIVATE_SUPPORT_PROC[] = {
+} RTMP_PRIVATE_SUPPORT_PROC[] = {
 	{"RateAlg",						Set_RateAlg_Proc},
 #ifdef NEW_RATE_ADAPT_SUPPORT
 	{"PerThrdAdj",					Set_PerThrdAdj_Proc},
@@ -2384,6 +2384,64 @@ static struct {
 	{NULL,}
 };
 
+/*
+	Case insensitive hash over RTMP_PRIVATE_SUPPORT_PROC, built on the first
+	set ioctl. Chains keep the table order so that the first of duplicated
+	names still wins, like the linear search did. Ioctls are serialized by
+	the rtnl lock, which also covers building the index.
+*/
+#define PRIV_SET_PROC_HASH_SIZE	1024
+
+static SHORT priv_set_proc_hash[PRIV_SET_PROC_HASH_SIZE];
+static SHORT priv_set_proc_next[ARRAY_SIZE(RTMP_PRIVATE_SUPPORT_PROC)];
+static BOOLEAN priv_set_proc_hashed;
+
+static UINT32 priv_set_proc_hash_key(RTMP_STRING *name)
+{
+	UINT32 hash = 5381;
+
+	while (*name)
+		hash = (hash * 33) ^ (UCHAR)tolower(*name++);
+
+	return hash & (PRIV_SET_PROC_HASH_SIZE - 1);
+}
+
+static VOID priv_set_proc_hash_init(VOID)
+{
+	UINT32 hash;
+	INT i;
+
+	for (i = 0; i < PRIV_SET_PROC_HASH_SIZE; i++)
+		priv_set_proc_hash[i] = -1;
+
+	/* insert backwards so that each chain ends up in table order */
+	for (i = ARRAY_SIZE(RTMP_PRIVATE_SUPPORT_PROC) - 1; i >= 0; i--) {
+		if (RTMP_PRIVATE_SUPPORT_PROC[i].name == NULL)
+			continue;
+
+		hash = priv_set_proc_hash_key(RTMP_PRIVATE_SUPPORT_PROC[i].name);
+		priv_set_proc_next[i] = priv_set_proc_hash[hash];
+		priv_set_proc_hash[hash] = i;
+	}
+
+	priv_set_proc_hashed = TRUE;
+}
+
+static INT priv_set_proc_lookup(RTMP_STRING *name)
+{
+	INT i;
+
+	if (!priv_set_proc_hashed)
+		priv_set_proc_hash_init();
+
+	for (i = priv_set_proc_hash[priv_set_proc_hash_key(name)]; i >= 0; i = priv_set_proc_next[i]) {
+		if (!strcasecmp(name, RTMP_PRIVATE_SUPPORT_PROC[i].name))
+			return i;
+	}
+
+	return -1;
+}
+
 /**
  * @addtogroup embedded_ioctl
  * @{
@@ -2408,6 +2466,7 @@ INT RTMPAPPrivIoctlSet(
 {
 	RTMP_STRING *this_char, *value;
 	INT Status = NDIS_STATUS_SUCCESS;
+	INT idx;
 
 	UCHAR *tmp = NULL, *buf = NULL;
 
@@ -2425,6 +2484,12 @@ INT RTMPAPPrivIoctlSet(
 	/* Use tmp to parse string, because strsep() would change it */
 	tmp = buf;
 
+	/*
+		"set k1=v1,k2=v2,..." applies all pairs in one call, beacon IE
+		changes made by the handlers are sent to the hardware once at the end.
+	*/
+	UpdateBeaconDefer(pAd, TRUE);
+
 	while ((this_char = strsep((char **)&tmp, ",")) != NULL) {
 
 		if (!*this_char)
@@ -2452,25 +2517,26 @@ INT RTMPAPPrivIoctlSet(
 		   )
 			continue;
 
-		for (PRTMP_PRIVATE_SET_PROC = RTMP_PRIVATE_SUPPORT_PROC; PRTMP_PRIVATE_SET_PROC->name; PRTMP_PRIVATE_SET_PROC++) {
-			if (!strcasecmp(this_char, PRTMP_PRIVATE_SET_PROC->name)) {
-				if (!PRTMP_PRIVATE_SET_PROC->set_proc(pAd, value)) {
-					/*FALSE:Set private failed then return Invalid argument */
-					Status = -EINVAL;
-				}
+		idx = priv_set_proc_lookup(this_char);
 
-				break;  /*Exit for loop. */
-			}
+		if (idx < 0) {
+			/*
+				Not found argument, keys that only exist with some build
+				options must not stop the other pairs of the same call
+			*/
+			Status = -EINVAL;
+			MTWF_LOG(DBG_CAT_CFG, DBG_SUBCAT_ALL, DBG_LVL_ERROR, ("IOCTL::(iwpriv) Command not Support [%s=%s]\n", this_char,
+					 value));
+			continue;
 		}
 
-		if (PRTMP_PRIVATE_SET_PROC->name == NULL) {
-			/*Not found argument */
+		if (!RTMP_PRIVATE_SUPPORT_PROC[idx].set_proc(pAd, value)) {
+			/*FALSE:Set private failed then return Invalid argument */
 			Status = -EINVAL;
-			MTWF_LOG(DBG_CAT_CFG, DBG_SUBCAT_ALL, DBG_LVL_TRACE, ("IOCTL::(iwpriv) Command not Support [%s=%s]\n", this_char,
-					 value));
-			break;
 		}
 	}
+
+	UpdateBeaconDefer(pAd, FALSE);
 	os_free_mem(buf);
 
 	return Status;
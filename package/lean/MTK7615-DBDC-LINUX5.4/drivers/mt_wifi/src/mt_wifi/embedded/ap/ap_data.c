@@ -616,14 +616,19 @@ INT ap_send_data_pkt(RTMP_ADAPTER *pAd, struct wifi_dev *wdev, PNDIS_PACKET pkt)
 	else {
 #ifdef IGMP_SNOOP_SUPPORT
 		if (wdev->IgmpSnoopEnable) {
+			/* the group entry is found and used without the table lock */
+			RTMP_RCU_READ_LOCK();
+
 			if (IgmpPktInfoQuery(pAd, pkt_va, pkt, wdev,
-						&InIgmpGroup, &pGroupEntry) != NDIS_STATUS_SUCCESS)
+						&InIgmpGroup, &pGroupEntry) != NDIS_STATUS_SUCCESS) {
+				RTMP_RCU_READ_UNLOCK();
 				return NDIS_STATUS_FAILURE;
+			}
 
 			/* if it's a mcast packet in igmp gourp. ucast clone it for all members in the gourp. */
 			if ((InIgmpGroup == IGMP_IN_GROUP)
 				 && pGroupEntry
-				 && (IgmpMemberCnt(&pGroupEntry->MemberList) > 0)) {
+				 && (IgmpMemberCnt(pGroupEntry) > 0)) {
 
 				NDIS_STATUS PktCloneResult = IgmpPktClone(pAd, wdev, pkt, InIgmpGroup, pGroupEntry,
 								q_idx, user_prio, GET_OS_PKT_NETDEV(pkt));
@@ -631,11 +636,13 @@ INT ap_send_data_pkt(RTMP_ADAPTER *pAd, struct wifi_dev *wdev, PNDIS_PACKET pkt)
 				if (PktCloneResult != NDIS_STATUS_MORE_PROCESSING_REQUIRED)
 #endif /* IGMP_TVM_SUPPORT */
 				{
+				RTMP_RCU_READ_UNLOCK();
 				RELEASE_NDIS_PACKET(pAd, pkt, NDIS_STATUS_SUCCESS);
 				return PktCloneResult;
 			}
 			}
 
+			RTMP_RCU_READ_UNLOCK();
 			RTMP_SET_PACKET_TXTYPE(pkt, TX_MCAST_FRAME);
 		} else
 #endif /* IGMP_SNOOP_SUPPORT */
@@ -222,6 +222,12 @@ VOID APMlmePeriodicExec(
 			a4_proxy_maintain(pAd, mbss_idx);
 		pAd->a4_need_refresh = FALSE;
 #endif /* A4_CONN */
+#ifdef IGMP_SNOOP_SUPPORT
+		MulticastFilterTableAgeOut(pAd);
+#endif /* IGMP_SNOOP_SUPPORT */
+#ifdef MAT_SUPPORT
+		MATEngineAgeOut(pAd);
+#endif /* MAT_SUPPORT */
 
 #ifdef WIFI_DIAG
 		DiagApMlmeOneSecProc(pAd);
@@ -1535,6 +1535,12 @@ VOID UpdateBeaconHandler(
 		goto end;
 	}
 
+	if ((BCN_UPDATE_REASON == BCN_UPDATE_IE_CHG) && (wdev != NULL) &&
+		(pAd->BcnUpdateDeferOwner == (VOID *)current)) {
+		wdev->bcn_buf.bBcnUpdPending = TRUE;
+		goto end;
+	}
+
 	if ((BCN_UPDATE_REASON == BCN_UPDATE_INIT) && (wdev != NULL)) {
 		MTWF_LOG(DBG_CAT_CFG, DBG_SUBCAT_ALL, DBG_LVL_OFF, ("%s, BCN_UPDATE_INIT, OmacIdx = %x\n",
 				 __func__, wdev->OmacIdx));
@@ -1573,6 +1579,44 @@ end:
 	return;
 }
 
+/*
+	While deferred, IE change updates made by the calling task only mark
+	their wdev. Ending the deferral sends one update for every marked wdev,
+	so a batch of settings that touch the same BSS rebuilds its beacon once.
+	Updates from MLME, timers or the command thread are never held back,
+	and only the task that started the deferral (ioctls run under the
+	rtnl lock) marks or flushes anything.
+*/
+VOID UpdateBeaconDefer(
+	RTMP_ADAPTER *pAd,
+	BOOLEAN bDefer)
+{
+	struct wifi_dev *wdev;
+	INT i;
+
+	if (bDefer) {
+		if (pAd->BcnUpdateDeferOwner == NULL)
+			pAd->BcnUpdateDeferOwner = (VOID *)current;
+
+		return;
+	}
+
+	if (pAd->BcnUpdateDeferOwner != (VOID *)current)
+		return;
+
+	pAd->BcnUpdateDeferOwner = NULL;
+
+	for (i = 0; i < WDEV_NUM_MAX; i++) {
+		wdev = pAd->wdev_list[i];
+
+		if ((wdev == NULL) || !wdev->bcn_buf.bBcnUpdPending)
+			continue;
+
+		wdev->bcn_buf.bBcnUpdPending = FALSE;
+		UpdateBeaconHandler(pAd, wdev, BCN_UPDATE_IE_CHG);
+	}
+}
+
 BOOLEAN UpdateBeaconProc(
 	RTMP_ADAPTER *pAd,
 	struct wifi_dev *wdev,
@@ -45,18 +45,15 @@ extern MATProtoOps MATProtoIPv6Handle;
 extern UCHAR SNAP_802_1H[];
 extern UCHAR SNAP_BRIDGE_TUNNEL[];
 
-#define MAX_MAT_NODE_ENTRY_NUM	128	/* We support maximum 128 node entry for our system */
-#define MAT_NODE_ENTRY_SIZE	40 /*28	// bytes   //change to 40 for IPv6Mac Table */
-
-typedef struct _MATNodeEntry {
-	UCHAR data[MAT_NODE_ENTRY_SIZE];
-	struct _MATNodeEntry *next;
-} MATNodeEntry, *PMATNodeEntry;
-
-
-#ifdef KMALLOC_BATCH
-/*static MATNodeEntry *MATNodeEntryPoll = NULL; */
-#endif
+#define MAT_DB_KEY_EQUAL(_pEntry, _type, _pKey, _keyLen)	\
+	(((_pEntry)->type == (_type)) && ((_pEntry)->keyLen == (_keyLen)) && NdisEqualMemory((_pEntry)->key, (_pKey), (_keyLen)))
+
+static const ULONG MATDBAgeOutTime[MAT_DB_TYPE_MAX] = {
+	MAT_TB_ENTRY_AGEOUT_TIME,			/* MAT_DB_TYPE_IPV4 */
+	MAT_TB_ENTRY_AGEOUT_TIME,			/* MAT_DB_TYPE_IPV6 */
+	MAT_PPPOE_SES_ENTRY_AGEOUT_TIME,	/* MAT_DB_TYPE_PPPOE_SES */
+	MAT_TB_ENTRY_AGEOUT_TIME,			/* MAT_DB_TYPE_PPPOE_UID */
+};
 
 static MATProtoTable MATProtoTb[] = {
 	{ETH_P_IP,			&MATProtoIPHandle},			/* IP handler */
@@ -69,45 +66,351 @@ static MATProtoTable MATProtoTb[] = {
 #define MAX_MAT_SUPPORT_PROTO_NUM (sizeof(MATProtoTb)/sizeof(MATProtoTable))
 
 
-/* --------------------------------- Public Function-------------------------------- */
-NDIS_STATUS MATDBEntryFree(
-	IN MAT_STRUCT * pMatStruct,
-	IN PUCHAR		NodeEntry)
+static inline UINT32 MATDBHashIndex(
+	IN MAT_TABLE	*pTable,
+	IN UCHAR		type,
+	IN PUCHAR		pKey,
+	IN UCHAR		keyLen)
+{
+	UINT32 hash = type;
+
+	while (keyLen--)
+		hash = (hash * 31) + *pKey++;
+
+	hash ^= (hash >> 16);
+	return hash & (pTable->HashSize - 1);
+}
+
+static VOID MATDBEntryRcuFree(
+	IN RTMP_OS_RCU_HEAD *pRcu)
 {
-#ifdef KMALLOC_BATCH
-	MATNodeEntry *pPtr, *pMATNodeEntryPoll;
-	pMATNodeEntryPoll = (MATNodeEntry *)pAd->MatCfg.MATNodeEntryPoll;
-	pPtr = (MATNodeEntry *)NodeEntry;
-	NdisZeroMemory(pPtr, sizeof(MATNodeEntry));
-
-	if (pMATNodeEntryPoll->next) {
-		pPtr->next = pMATNodeEntryPoll->next;
-		pMATNodeEntryPoll->next = pPtr;
-	} else
-		pMATNodeEntryPoll->next = pPtr;
-
-#else
-	os_free_mem(NodeEntry);
-#endif
+	os_free_mem(container_of(pRcu, MAT_DB_ENTRY, rcu));
+}
+
+/* Called with MATDBLock held, readers still walking the entry keep its pNext until a grace period passed. */
+static VOID MATDBEntryUnlink(
+	IN MAT_STRUCT		*pMatCfg,
+	IN PMAT_DB_ENTRY	*ppLink,
+	IN PMAT_DB_ENTRY	pEntry)
+{
+	RTMP_RCU_ASSIGN_POINTER(*ppLink, pEntry->pNext);
+	pMatCfg->MatTableSet.EntryCnt[pEntry->type]--;
+	pMatCfg->nodeCount--;
+	RTMP_CALL_RCU(&pEntry->rcu, MATDBEntryRcuFree);
+}
+
+static NDIS_STATUS MATDBInit(
+	IN MAT_STRUCT *pMatCfg)
+{
+	MAT_TABLE *pTable = &pMatCfg->MatTableSet;
+	UINT32 hashSize = pMatCfg->DBHashSize;
+
+	if (hashSize == 0)
+		hashSize = MAT_DB_HASH_SIZE_DEFAULT;
+	else if ((hashSize < MAT_DB_HASH_SIZE_MIN) || (hashSize > MAT_DB_HASH_SIZE_MAX) || (hashSize & (hashSize - 1))) {
+		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_ERROR, ("%s(): invalid hash size %u, use %u\n",
+				 __func__, hashSize, MAT_DB_HASH_SIZE_DEFAULT));
+		hashSize = MAT_DB_HASH_SIZE_DEFAULT;
+	}
+
+	os_alloc_mem_suspend(NULL, (UCHAR **)&pTable->Hash, sizeof(PMAT_DB_ENTRY) * hashSize);
+
+	if (pTable->Hash == NULL) {
+		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_ERROR, ("%s(): Allocate memory for MAT hash failed!\n", __func__));
+		return FALSE;
+	}
+
+	pTable->pStat = RTMP_OS_PERCPU_ALLOC(sizeof(MAT_DB_STAT) * MAT_DB_TYPE_MAX);
+
+	if (pTable->pStat == NULL) {
+		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_ERROR, ("%s(): Allocate memory for MAT stat failed!\n", __func__));
+		os_free_mem(pTable->Hash);
+		pTable->Hash = NULL;
+		return FALSE;
+	}
+
+	NdisZeroMemory(pTable->Hash, sizeof(PMAT_DB_ENTRY) * hashSize);
+	NdisZeroMemory(pTable->EntryCnt, sizeof(pTable->EntryCnt));
+	pTable->HashSize = hashSize;
+	pMatCfg->nodeCount = 0;
 	return TRUE;
 }
 
-PUCHAR MATDBEntryAlloc(IN MAT_STRUCT * pMatStruct, IN UINT32 size)
+/* The engine must be out of MAT_ENGINE_STAT_INITED already, so no new reader or writer shows up. */
+static VOID MATDBExit(
+	IN MAT_STRUCT *pMatCfg)
+{
+	MAT_TABLE *pTable = &pMatCfg->MatTableSet;
+	PMAT_DB_ENTRY pEntry;
+	UINT32 i;
+
+	if (pTable->Hash == NULL)
+		return;
+
+	RTMP_SYNCHRONIZE_RCU();
+
+	for (i = 0; i < pTable->HashSize; i++) {
+		while ((pEntry = pTable->Hash[i]) != NULL) {
+			pTable->Hash[i] = pEntry->pNext;
+			os_free_mem(pEntry);
+		}
+	}
+
+	/* entries unlinked before the exit are freed by call_rcu */
+	RTMP_RCU_BARRIER();
+	RTMP_OS_PERCPU_FREE(pTable->pStat);
+	pTable->pStat = NULL;
+	os_free_mem(pTable->Hash);
+	pTable->Hash = NULL;
+	pTable->HashSize = 0;
+	pMatCfg->nodeCount = 0;
+}
+
+
+/* --------------------------------- Public Function-------------------------------- */
+/*
+	========================================================================
+	Routine	Description:
+		Find the entry of an upper layer address in the MAT database.
+
+	Arguments:
+		pMatCfg	=>Pointer to the MAT engine
+		type	=>MAT_DB_TYPE of the key
+		pKey	=>upper layer address, keyLen bytes
+
+	Return Value:
+		The entry if found, else NULL.
+
+	Note:
+		Lock-free, the caller must be inside RTMP_RCU_READ_LOCK() and the
+		entry can only be used until the read lock is dropped.
+	========================================================================
+ */
+PMAT_DB_ENTRY MATDBLookup(
+	IN MAT_STRUCT	*pMatCfg,
+	IN UCHAR		type,
+	IN PUCHAR		pKey,
+	IN UCHAR		keyLen)
 {
-#ifdef KMALLOC_BATCH
-	MATNodeEntry *pPtr = NULL, *pMATNodeEntryPoll;
-	pMATNodeEntryPoll = (MATNodeEntry *)pMatStruct->pMATNodeEntryPoll;
+	MAT_TABLE *pTable = &pMatCfg->MatTableSet;
+	PMAT_DB_ENTRY pEntry;
 
-	if (pMATNodeEntryPoll->next) {
-		pPtr = pMATNodeEntryPoll->next;
-		pMATNodeEntryPoll->next = pPtr->next;
+	if ((pTable->Hash == NULL) || (keyLen > MAT_DB_KEY_MAX_LEN))
+		return NULL;
+
+	pEntry = RTMP_RCU_DEREFERENCE(pTable->Hash[MATDBHashIndex(pTable, type, pKey, keyLen)]);
+
+	while (pEntry) {
+		if (MAT_DB_KEY_EQUAL(pEntry, type, pKey, keyLen)) {
+			/*Update the lastTime to prevent the aging before pDA processed! */
+			NdisGetSystemUpTime(&pEntry->lastTime);
+			RTMP_OS_PERCPU_INC(pTable->pStat[type].Hit);
+			return pEntry;
+		}
+
+		pEntry = RTMP_RCU_DEREFERENCE(pEntry->pNext);
 	}
 
-#else
-	UCHAR *pPtr = NULL;
-	os_alloc_mem(NULL, (PUCHAR *)&pPtr, size);
-#endif
-	return (PUCHAR)pPtr;
+	RTMP_OS_PERCPU_INC(pTable->pStat[type].Miss);
+	return NULL;
+}
+
+
+/*
+	========================================================================
+	Routine	Description:
+		Add or refresh the mapping of an upper layer address to a MAC address.
+		Aged entries found on the same hash chain are removed on the way,
+		the rest of the table is left to MATDBAgeOut().
+
+	Arguments:
+		pMatCfg		=>Pointer to the MAT engine
+		type		=>MAT_DB_TYPE of the key
+		pKey		=>upper layer address, keyLen bytes
+		pMacAddr	=>MAC address mapped to the key
+		flags		=>private data of the protocol handler
+
+	Return Value:
+		The entry of the key, or NULL if out of memory.
+
+	Note:
+		The caller must be inside RTMP_RCU_READ_LOCK() to use the returned entry.
+		A changed MAC or flags replaces the entry, readers never see it half written.
+	========================================================================
+ */
+PMAT_DB_ENTRY MATDBUpdate(
+	IN MAT_STRUCT	*pMatCfg,
+	IN UCHAR		type,
+	IN PUCHAR		pKey,
+	IN UCHAR		keyLen,
+	IN PUCHAR		pMacAddr,
+	IN UCHAR		flags)
+{
+	MAT_TABLE *pTable = &pMatCfg->MatTableSet;
+	PMAT_DB_ENTRY pEntry, pNewEntry = NULL, *ppLink;
+	UINT32 hashIdx;
+	ULONG now;
+
+	if ((pTable->Hash == NULL) || (keyLen > MAT_DB_KEY_MAX_LEN))
+		return NULL;
+
+	hashIdx = MATDBHashIndex(pTable, type, pKey, keyLen);
+	NdisGetSystemUpTime(&now);
+	RTMP_SEM_LOCK(&pMatCfg->MATDBLock);
+	ppLink = &pTable->Hash[hashIdx];
+
+	while ((pEntry = *ppLink) != NULL) {
+		if (MAT_DB_KEY_EQUAL(pEntry, type, pKey, keyLen)) {
+			if (MAC_ADDR_EQUAL(pEntry->macAddr, pMacAddr) && (pEntry->flags == flags)) {
+				pEntry->lastTime = now;
+				pNewEntry = pEntry;
+				break;
+			}
+
+			MATDBEntryUnlink(pMatCfg, ppLink, pEntry);
+		} else if (RTMP_TIME_AFTER(now, pEntry->lastTime + MATDBAgeOutTime[pEntry->type]))
+			MATDBEntryUnlink(pMatCfg, ppLink, pEntry);
+		else
+			ppLink = &pEntry->pNext;
+	}
+
+	if (pNewEntry == NULL) {
+		os_alloc_mem(NULL, (UCHAR **)&pNewEntry, sizeof(MAT_DB_ENTRY));
+
+		if (pNewEntry != NULL) {
+			NdisZeroMemory(pNewEntry, sizeof(MAT_DB_ENTRY));
+			pNewEntry->type = type;
+			pNewEntry->keyLen = keyLen;
+			pNewEntry->flags = flags;
+			NdisMoveMemory(pNewEntry->key, pKey, keyLen);
+			NdisMoveMemory(pNewEntry->macAddr, pMacAddr, MAC_ADDR_LEN);
+			pNewEntry->lastTime = now;
+			/* Ok, we insert the new entry into the root of hash[hashIdx] */
+			pNewEntry->pNext = pTable->Hash[hashIdx];
+			RTMP_RCU_ASSIGN_POINTER(pTable->Hash[hashIdx], pNewEntry);
+			pTable->EntryCnt[type]++;
+			pMatCfg->nodeCount++;
+		} else
+			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_ERROR, ("%s(): Insertion failed!\n", __func__));
+	}
+
+	RTMP_SEM_UNLOCK(&pMatCfg->MATDBLock);
+	return pNewEntry;
+}
+
+
+/* Drop the aged entries of every chain. The caller is inside RTMP_RCU_READ_LOCK() with the engine up, see MATEngineAgeOut(). */
+VOID MATDBAgeOut(
+	IN MAT_STRUCT	*pMatCfg)
+{
+	MAT_TABLE *pTable = &pMatCfg->MatTableSet;
+	PMAT_DB_ENTRY pEntry, *ppLink;
+	UINT32 i;
+	ULONG now;
+
+	if ((pTable->Hash == NULL) || (pMatCfg->nodeCount == 0))
+		return;
+
+	NdisGetSystemUpTime(&now);
+	RTMP_SEM_LOCK(&pMatCfg->MATDBLock);
+
+	for (i = 0; (i < pTable->HashSize) && (pMatCfg->nodeCount != 0); i++) {
+		ppLink = &pTable->Hash[i];
+
+		while ((pEntry = *ppLink) != NULL) {
+			if (RTMP_TIME_AFTER(now, pEntry->lastTime + MATDBAgeOutTime[pEntry->type]))
+				MATDBEntryUnlink(pMatCfg, ppLink, pEntry);
+			else
+				ppLink = &pEntry->pNext;
+		}
+	}
+
+	RTMP_SEM_UNLOCK(&pMatCfg->MATDBLock);
+}
+
+
+/* Count a unicast Rx of the given type that was sent to broadcast because its key missed. */
+VOID MATDBStatBcastFallback(
+	IN MAT_STRUCT	*pMatCfg,
+	IN UCHAR		type)
+{
+	MAT_TABLE *pTable = &pMatCfg->MatTableSet;
+
+	if (pTable->pStat != NULL)
+		RTMP_OS_PERCPU_INC(pTable->pStat[type].BcastFallback);
+}
+
+
+/* Sum the per-CPU lookup counters of one type. */
+VOID MATDBStatGet(
+	IN MAT_STRUCT	*pMatCfg,
+	IN UCHAR		type,
+	OUT MAT_DB_STAT	*pSum)
+{
+	MAT_TABLE *pTable = &pMatCfg->MatTableSet;
+	MAT_DB_STAT *pStat;
+	INT cpu;
+
+	NdisZeroMemory(pSum, sizeof(MAT_DB_STAT));
+
+	if (pTable->pStat == NULL)
+		return;
+
+	RTMP_OS_FOR_EACH_CPU(cpu) {
+		pStat = RTMP_OS_PERCPU_PTR(pTable->pStat, cpu) + type;
+		pSum->Hit += pStat->Hit;
+		pSum->Miss += pStat->Miss;
+		pSum->BcastFallback += pStat->BcastFallback;
+	}
+}
+
+
+/* Clear the lookup counters, a CPU counting at the same time may keep its last increment. */
+VOID MATDBStatClear(
+	IN MAT_STRUCT	*pMatCfg)
+{
+	MAT_TABLE *pTable = &pMatCfg->MatTableSet;
+	INT cpu;
+
+	if (pTable->pStat == NULL)
+		return;
+
+	RTMP_OS_FOR_EACH_CPU(cpu)
+		NdisZeroMemory(RTMP_OS_PERCPU_PTR(pTable->pStat, cpu), sizeof(MAT_DB_STAT) * MAT_DB_TYPE_MAX);
+}
+
+
+/* Walk the entries of one type for display, hashIdx < 0 for all hash chains. */
+VOID MATDBDump(
+	IN MAT_STRUCT	*pMatCfg,
+	IN UCHAR		type,
+	IN INT			hashIdx,
+	IN VOID (*show)(PMAT_DB_ENTRY pEntry, VOID *pCookie),
+	IN VOID			*pCookie)
+{
+	MAT_TABLE *pTable = &pMatCfg->MatTableSet;
+	PMAT_DB_ENTRY pEntry;
+	UINT32 i;
+
+	RTMP_RCU_READ_LOCK();
+
+	if ((pMatCfg->status == MAT_ENGINE_STAT_INITED) && (pTable->Hash != NULL)) {
+		for (i = 0; i < pTable->HashSize; i++) {
+			if ((hashIdx >= 0) && (i != (UINT32)hashIdx))
+				continue;
+
+			pEntry = RTMP_RCU_DEREFERENCE(pTable->Hash[i]);
+
+			while (pEntry) {
+				if (pEntry->type == type)
+					show(pEntry, pCookie);
+
+				pEntry = RTMP_RCU_DEREFERENCE(pEntry->pNext);
+			}
+		}
+	}
+
+	RTMP_RCU_READ_UNLOCK();
 }
 
 
@@ -212,9 +515,13 @@ PUCHAR MATEngineTxHandle(
 #endif /* APCLI_SUPPORT */
 #endif /* CONFIG_AP_SUPPORT */
 
-			if (pHandle->tx != NULL)
+			/* MAT database entries used by the handler stay valid until the read lock is dropped */
+			RTMP_RCU_READ_LOCK();
+
+			if ((pHandle->tx != NULL) && (pAd->MatCfg.status == MAT_ENGINE_STAT_INITED))
 				retSkb = pHandle->tx((PVOID)&pAd->MatCfg, RTPKT_TO_OSPKT(pPkt), pLayerHdr, pMacAddr);
 
+			RTMP_RCU_READ_UNLOCK();
 			return retSkb;
 		}
 	}
@@ -281,19 +588,20 @@ PUCHAR MATEngineRxHandle(
 	for (i = 0; i < MAX_MAT_SUPPORT_PROTO_NUM; i++) {
 		if (protoType == MATProtoTb[i].protocol) {
 			pHandle = MATProtoTb[i].pHandle;	/* the pHandle must not be null! */
+			/* the returned address may point into a MAT database entry, copy it before dropping the read lock */
+			RTMP_RCU_READ_LOCK();
 
-			/*			RTMP_SEM_LOCK(&MATDBLock); */
-			if (pHandle->rx != NULL)
+			if ((pHandle->rx != NULL) && (pAd->MatCfg.status == MAT_ENGINE_STAT_INITED))
 				pMacAddr = pHandle->rx((PVOID)&pAd->MatCfg, RTPKT_TO_OSPKT(pPkt), pLayerHdr, NULL);
 
-			/*			RTMP_SEM_UNLOCK(&MATDBLock); */
+			if (pMacAddr)
+				NdisMoveMemory(pPktHdr, pMacAddr, MAC_ADDR_LEN);
+
+			RTMP_RCU_READ_UNLOCK();
 			break;
 		}
 	}
 
-	if (pMacAddr)
-		NdisMoveMemory(pPktHdr, pMacAddr, MAC_ADDR_LEN);
-
 	return NULL;
 }
 
@@ -330,15 +638,36 @@ BOOLEAN MATPktRxNeedConvert(
 }
 
 
+/*
+	Called from the one-second MLME tick, which is only halted after MATEngineExit().
+	The read lock makes the RTMP_SYNCHRONIZE_RCU() of MATDBExit() wait for a sweep
+	that saw the engine up.
+*/
+VOID MATEngineAgeOut(
+	IN RTMP_ADAPTER * pAd)
+{
+	RTMP_RCU_READ_LOCK();
+
+	if (pAd->MatCfg.status == MAT_ENGINE_STAT_INITED)
+		MATDBAgeOut(&pAd->MatCfg);
+
+	RTMP_RCU_READ_UNLOCK();
+}
+
+
 NDIS_STATUS MATEngineExit(
 	IN RTMP_ADAPTER * pAd)
 {
 	struct _MATProtoOps *pHandle = NULL;
 	int i;
 
-	if (pAd->MatCfg.status == MAT_ENGINE_STAT_EXITED)
+	if (pAd->MatCfg.status != MAT_ENGINE_STAT_INITED)
 		return TRUE;
 
+	/* Stop the Tx/Rx handlers first, MATDBExit() waits for the ones still running. */
+	pAd->MatCfg.status = MAT_ENGINE_STAT_EXITED;
+	RTMP_OS_MAT_PROC_REMOVE(pAd);
+
 	/* For each registered protocol, we call it's exit handler. */
 	for (i = 0; i < MAX_MAT_SUPPORT_PROTO_NUM; i++) {
 		pHandle = MATProtoTb[i].pHandle;
@@ -347,16 +676,8 @@ NDIS_STATUS MATEngineExit(
 			pHandle->exit(&pAd->MatCfg);
 	}
 
-#ifdef KMALLOC_BATCH
-
-	/* Free the memory used to store node entries. */
-	if (pAd->MatCfg.pMATNodeEntryPoll) {
-		os_free_mem(pAd->MatCfg.pMATNodeEntryPoll);
-		pAd->MatCfg.pMATNodeEntryPoll = NULL;
-	}
-
-#endif
-	pAd->MatCfg.status = MAT_ENGINE_STAT_EXITED;
+	MATDBExit(&pAd->MatCfg);
+	NdisFreeSpinLock(&pAd->MatCfg.MATDBLock);
 	return TRUE;
 }
 
@@ -370,25 +691,12 @@ NDIS_STATUS MATEngineInit(
 	if (pAd->MatCfg.status == MAT_ENGINE_STAT_INITED)
 		return TRUE;
 
-#ifdef KMALLOC_BATCH
-	/* Allocate memory for node entry, we totally allocate 128 entries and link them together. */
-	os_alloc_mem_suspend(NULL, (UCHAR **)&(pAd->MatCfg.pMATNodeEntryPoll), sizeof(MATNodeEntry) * MAX_MAT_NODE_ENTRY_NUM);
-
-	if (pAd->MatCfg.pMATNodeEntryPoll != NULL) {
-		MATNodeEntry *pPtr = NULL;
-		NdisZeroMemory(pAd->MatCfg.pMATNodeEntryPoll, sizeof(MATNodeEntry) * MAX_MAT_NODE_ENTRY_NUM);
-		pPtr = pAd->MatCfg.pMATNodeEntryPoll;
-
-		for (i = 0; i < (MAX_MAT_NODE_ENTRY_NUM - 1); i++) {
-			pPtr->next = (MATNodeEntry *)(pPtr + 1);
-			pPtr = pPtr->next;
-		}
+	NdisAllocateSpinLock(pAd, &pAd->MatCfg.MATDBLock);
 
-		pPtr->next = NULL;
-	} else
+	if (MATDBInit(&pAd->MatCfg) == FALSE) {
+		NdisFreeSpinLock(&pAd->MatCfg.MATDBLock);
 		return FALSE;
-
-#endif
+	}
 
 	/* For each specific protocol, call it's init function. */
 	for (i = 0; i < MAX_MAT_SUPPORT_PROTO_NUM; i++) {
@@ -407,12 +715,12 @@ NDIS_STATUS MATEngineInit(
 		}
 	}
 
-	NdisAllocateSpinLock(pAd, &pAd->MatCfg.MATDBLock);
 #ifdef MAC_REPEATER_SUPPORT
 	pAd->MatCfg.bMACRepeaterEn = FALSE;
 #endif /* MAC_REPEATER_SUPPORT */
 	pAd->MatCfg.pPriv = (VOID *)pAd;
 	pAd->MatCfg.status = MAT_ENGINE_STAT_INITED;
+	RTMP_OS_MAT_PROC_CREATE(pAd);
 	return TRUE;
 init_failed:
 
@@ -429,13 +737,8 @@ init_failed:
 		}
 	}
 
-#ifdef KMALLOC_BATCH
-
-	if (pAd->MatCfg.pMATNodeEntryPoll)
-		os_free_mem(pAd->MatCfg.pMATNodeEntryPoll);
-
-	pAd->MatCfg.status = MAT_ENGINE_STAT_EXITED;
-#endif /* KMALLOC_BATCH */
+	MATDBExit(&pAd->MatCfg);
+	NdisFreeSpinLock(&pAd->MatCfg.MATDBLock);
 	return FALSE;
 }
 
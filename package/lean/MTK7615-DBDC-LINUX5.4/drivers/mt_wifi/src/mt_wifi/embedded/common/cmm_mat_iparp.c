@@ -31,13 +31,9 @@
 
 #include "rt_config.h"
 
-static NDIS_STATUS MATProto_IP_Init(MAT_STRUCT *pMatCfg);
-static NDIS_STATUS MATProto_IP_Exit(MAT_STRUCT *pMatCfg);
 static PUCHAR MATProto_IP_Rx(MAT_STRUCT *pMatCfg, PNDIS_PACKET pSkb, PUCHAR pLayerHdr, PUCHAR pMacAddr);
 static PUCHAR MATProto_IP_Tx(MAT_STRUCT *pMatCfg, PNDIS_PACKET pSkb, PUCHAR pLayerHdr, PUCHAR pMacAddr);
 
-static NDIS_STATUS MATProto_ARP_Init(MAT_STRUCT *pMatCfg);
-static NDIS_STATUS MATProto_ARP_Exit(MAT_STRUCT *pMatCfg);
 static PUCHAR MATProto_ARP_Rx(MAT_STRUCT *pMatCfg, PNDIS_PACKET pSkb, PUCHAR pLayerHdr, PUCHAR pMacAddr);
 static PUCHAR MATProto_ARP_Tx(MAT_STRUCT *pMatCfg, PNDIS_PACKET pSkb, PUCHAR pLayerHdr, PUCHAR pMacAddr);
 
@@ -46,77 +42,33 @@ static PUCHAR MATProto_ARP_Tx(MAT_STRUCT *pMatCfg, PNDIS_PACKET pSkb, PUCHAR pLa
 #define NEED_UPDATE_IPMAC_TB(Mac, IP) (IS_UCAST_MAC(Mac) && IS_GOOD_IP(IP))
 
 
-typedef struct _IPMacMappingEntry {
-	UINT	ipAddr;	/* In network order */
-	UCHAR	macAddr[MAC_ADDR_LEN];
-	ULONG	lastTime;
-	struct _IPMacMappingEntry *pNext;
-} IPMacMappingEntry, *PIPMacMappingEntry;
-
-
-typedef struct _IPMacMappingTable {
-	BOOLEAN			valid;
-	IPMacMappingEntry * hash[MAT_MAX_HASH_ENTRY_SUPPORT + 1]; /*0~63 for specific station, 64 for broadcast MacAddress */
-	UCHAR			curMcastAddr[MAC_ADDR_LEN]; /* The multicast mac addr for currecnt received packet destined to ipv4 multicast addr */
-} IPMacMappingTable;
-
-
 struct _MATProtoOps MATProtoIPHandle = {
-	.init = MATProto_IP_Init,
 	.tx = MATProto_IP_Tx,
 	.rx = MATProto_IP_Rx,
-	.exit = MATProto_IP_Exit,
 };
 
 struct _MATProtoOps MATProtoARPHandle = {
-	.init = MATProto_ARP_Init,
 	.tx = MATProto_ARP_Tx,
 	.rx = MATProto_ARP_Rx,
-	.exit  = MATProto_ARP_Exit,
 };
 
 
+static VOID dumpIPMacEntry(
+	IN PMAT_DB_ENTRY	pEntry,
+	IN VOID				*pCookie)
+{
+	MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("\t:IP=%d.%d.%d.%d,Mac=%02x:%02x:%02x:%02x:%02x:%02x, lastTime=0x%lx\n",
+			 pEntry->key[0], pEntry->key[1], pEntry->key[2], pEntry->key[3],
+			 pEntry->macAddr[0], pEntry->macAddr[1], pEntry->macAddr[2],
+			 pEntry->macAddr[3], pEntry->macAddr[4], pEntry->macAddr[5], pEntry->lastTime));
+}
+
 VOID dumpIPMacTb(
 	IN MAT_STRUCT	*pMatCfg,
 	IN int			index)
 {
-	IPMacMappingTable *pIPMacTable;
-	IPMacMappingEntry *pHead;
-	int startIdx, endIdx;
-	pIPMacTable = (IPMacMappingTable *)pMatCfg->MatTableSet.IPMacTable;
-
-	if (!pIPMacTable)
-		return;
-
-	if (!pIPMacTable->valid) {
-		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("%s():IPMacTable not init yet, so cannot do dump!\n", __func__));
-		return;
-	}
-
-	if (index < 0) {
-		/* dump all. */
-		startIdx = 0;
-		endIdx = MAT_MAX_HASH_ENTRY_SUPPORT;
-	} else {
-		/* dump specific hash index. */
-		startIdx = endIdx = index;
-	}
-
 	MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("%s():\n", __func__));
-
-	for (; startIdx <=  endIdx; startIdx++) {
-		pHead = pIPMacTable->hash[startIdx];
-
-		while (pHead) {
-			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("IPMac[%d]:\n", startIdx));
-			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("\t:IP=0x%x,Mac=%02x:%02x:%02x:%02x:%02x:%02x, lastTime=0x%lx, next=%p\n",
-					 pHead->ipAddr, pHead->macAddr[0], pHead->macAddr[1], pHead->macAddr[2],
-					 pHead->macAddr[3], pHead->macAddr[4], pHead->macAddr[5], pHead->lastTime,
-					 pHead->pNext));
-			pHead = pHead->pNext;
-		}
-	}
-
+	MATDBDump(pMatCfg, MAT_DB_TYPE_IPV4, index, dumpIPMacEntry, NULL);
 	MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("\t----EndOfDump!\n"));
 }
 
@@ -150,211 +102,44 @@ static NDIS_STATUS IPMacTableUpdate(
 	IN PUCHAR			pMacAddr,
 	IN UINT				ipAddr)
 {
-	UINT				hashIdx;
-	IPMacMappingTable *pIPMacTable;
-	IPMacMappingEntry	*pEntry = NULL, *pPrev = NULL, *pNewEntry  = NULL;
-	ULONG			now;
-	pIPMacTable = (IPMacMappingTable *)pMatCfg->MatTableSet.IPMacTable;
-
-	if (!pIPMacTable)
-		return FALSE;
-
-	if (!pIPMacTable->valid)
-		return FALSE;
-
-	hashIdx = MAT_IP_ADDR_HASH_INDEX(ipAddr);
-	pEntry = pPrev = pIPMacTable->hash[hashIdx];
-
-	while (pEntry) {
-		NdisGetSystemUpTime(&now);
-
-		/* Find a existed IP-MAC Mapping entry */
-		if (ipAddr == pEntry->ipAddr) {
-			/*	MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_TRACE, ("%s(): Got the Mac(%02x:%02x:%02x:%02x:%02x:%02x) of mapped IP(%d.%d.%d.%d)\n",
-						__func__, pEntry->macAddr[0],pEntry->macAddr[1],pEntry->macAddr[2], pEntry->macAddr[3],pEntry->macAddr[4],
-						pEntry->macAddr[5], (ipAddr>>24) & 0xff, (ipAddr>>16) & 0xff, (ipAddr>>8) & 0xff, ipAddr & 0xff));
-			*/
-			/* compare is useless. So we directly copy it into the entry. */
-			NdisMoveMemory(pEntry->macAddr, pMacAddr, 6);
-			pEntry->lastTime = now;
-			return TRUE;
-		} else {
-			/* handle the age-out situation */
-			/*if ((Now - pEntry->lastTime) > MAT_TB_ENTRY_AGEOUT_TIME) */
-			if (RTMP_TIME_AFTER(now, pEntry->lastTime + MAT_TB_ENTRY_AGEOUT_TIME)) {
-				/* Remove the aged entry */
-				if (pEntry == pIPMacTable->hash[hashIdx]) {
-					pIPMacTable->hash[hashIdx] =  pEntry->pNext;
-					pPrev = pIPMacTable->hash[hashIdx];
-				} else
-					pPrev->pNext = pEntry->pNext;
-
-				MATDBEntryFree(pMatCfg, (PUCHAR)pEntry);
-				pEntry = (pPrev == NULL ? NULL :  pPrev->pNext);
-				pMatCfg->nodeCount--;
-			} else {
-				pPrev = pEntry;
-				pEntry = pEntry->pNext;
-			}
-		}
-	}
-
-	/* Allocate a new IPMacMapping entry and insert into the hash */
-	pNewEntry = (IPMacMappingEntry *)MATDBEntryAlloc(pMatCfg, sizeof(IPMacMappingEntry));
-
-	if (pNewEntry != NULL) {
-		pNewEntry->ipAddr = ipAddr;
-		NdisMoveMemory(pNewEntry->macAddr, pMacAddr, 6);
-		pNewEntry->pNext = NULL;
-		NdisGetSystemUpTime(&pNewEntry->lastTime);
-
-		if (pIPMacTable->hash[hashIdx] == NULL) {
-			/* Hash list is empty, directly assign it. */
-			pIPMacTable->hash[hashIdx] = pNewEntry;
-		} else {
-			/* Ok, we insert the new entry into the root of hash[hashIdx] */
-			pNewEntry->pNext = pIPMacTable->hash[hashIdx];
-			pIPMacTable->hash[hashIdx] = pNewEntry;
-		}
-
-		/*dumpIPMacTb(pMatCfg, hashIdx); //for debug */
-		pMatCfg->nodeCount++;
-		return TRUE;
-	}
-
-	return FALSE;
+	return (MATDBUpdate(pMatCfg, MAT_DB_TYPE_IPV4, (PUCHAR)&ipAddr, IPV4_ADDR_LEN, pMacAddr, 0) != NULL) ? TRUE : FALSE;
 }
 
 
+/*
+	Called inside the RCU read lock of the MAT engine. A multicast ipAddr is
+	converted into pGroupMacAddr, which is then returned.
+*/
 static PUCHAR IPMacTableLookUp(
 	IN MAT_STRUCT	*pMatCfg,
-	IN UINT			ipAddr)
+	IN UINT			ipAddr,
+	IN PUCHAR		pGroupMacAddr)
 {
-	IPMacMappingTable *pIPMacTable;
-	UINT				hashIdx, ip;
-	IPMacMappingEntry	*pEntry = NULL;
-	PUCHAR				pGroupMacAddr;
-	pIPMacTable = (IPMacMappingTable *)pMatCfg->MatTableSet.IPMacTable;
-
-	if (!pIPMacTable)
-		return NULL;
-
-	if (!pIPMacTable->valid)
-		return NULL;
+	PMAT_DB_ENTRY pEntry;
+	UINT ip;
 
 	/*if multicast ip, need converting multicast group address to ethernet address. */
 	ip = ntohl(ipAddr);
 
 	if (IS_MULTICAST_IP(ip)) {
-		pGroupMacAddr = (PUCHAR)(&pIPMacTable->curMcastAddr);
 		ConvertMulticastIP2MAC((PUCHAR) &ipAddr, (UCHAR **)(&pGroupMacAddr), ETH_P_IP);
-		return pIPMacTable->curMcastAddr;
+		return pGroupMacAddr;
 	}
 
-	/* Use hash to find out the location of that entry and get the Mac address. */
-	hashIdx = MAT_IP_ADDR_HASH_INDEX(ipAddr);
-	/*	spin_lock_irqsave(&IPMacTabLock, irqFlag); */
-	pEntry = pIPMacTable->hash[hashIdx];
-
-	while (pEntry) {
-		if (pEntry->ipAddr == ipAddr) {
-			/*			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_TRACE, ("%s(): dstMac=%02x:%02x:%02x:%02x:%02x:%02x for mapped dstIP(%d.%d.%d.%d)\n",
-								__func__, pEntry->macAddr[0],pEntry->macAddr[1],pEntry->macAddr[2],
-								pEntry->macAddr[3],pEntry->macAddr[4],pEntry->macAddr[5],
-								(ipAddr>>24) & 0xff, (ipAddr>>16) & 0xff, (ipAddr>>8) & 0xff, ipAddr & 0xff));
-			*/
-			/*Update the lastTime to prevent the aging before pDA processed! */
-			NdisGetSystemUpTime(&pEntry->lastTime);
-			return pEntry->macAddr;
-		} else
-			pEntry = pEntry->pNext;
-	}
+	pEntry = MATDBLookup(pMatCfg, MAT_DB_TYPE_IPV4, (PUCHAR)&ipAddr, IPV4_ADDR_LEN);
+
+	if (pEntry)
+		return pEntry->macAddr;
 
 	/*
 		We didn't find any matched Mac address, our policy is treat it as
 		broadcast packet and send to all.
 	*/
-	return pIPMacTable->hash[IPMAC_TB_HASH_INDEX_OF_BCAST]->macAddr;
-}
-
-
-static NDIS_STATUS IPMacTable_RemoveAll(
-	IN MAT_STRUCT *pMatCfg)
-{
-	IPMacMappingEntry *pEntry;
-	IPMacMappingTable *pIPMacTable;
-	INT		i;
-	pIPMacTable = (IPMacMappingTable *)pMatCfg->MatTableSet.IPMacTable;
-
-	if (!pIPMacTable)
-		return TRUE;
-
-	if (pIPMacTable->valid) {
-		pIPMacTable->valid = FALSE;
-
-		for (i = 0; i < IPMAC_TB_HASH_ENTRY_NUM; i++) {
-			while ((pEntry = pIPMacTable->hash[i]) != NULL) {
-				pIPMacTable->hash[i] = pEntry->pNext;
-				MATDBEntryFree(pMatCfg, (PUCHAR)pEntry);
-			}
-		}
-	}
-
-	os_free_mem(pIPMacTable);
-	pMatCfg->MatTableSet.IPMacTable = NULL;
-	return TRUE;
+	MATDBStatBcastFallback(pMatCfg, MAT_DB_TYPE_IPV4);
+	return &BROADCAST_ADDR[0];
 }
 
 
-static NDIS_STATUS IPMacTable_init(
-	IN MAT_STRUCT *pMatCfg)
-{
-	IPMacMappingTable *pIPMacTable;
-	IPMacMappingEntry *pEntry = NULL;
-
-	if (pMatCfg->MatTableSet.IPMacTable != NULL)
-		pIPMacTable = (IPMacMappingTable *)pMatCfg->MatTableSet.IPMacTable;
-	else {
-		os_alloc_mem_suspend(NULL, (UCHAR **)&(pMatCfg->MatTableSet.IPMacTable), sizeof(IPMacMappingTable));
-
-		if (pMatCfg->MatTableSet.IPMacTable) {
-			pIPMacTable = (IPMacMappingTable *)pMatCfg->MatTableSet.IPMacTable;
-			NdisZeroMemory(pIPMacTable, sizeof(IPMacMappingTable));
-		} else {
-			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_ERROR, ("IPMacTable_init(): Allocate memory for IPMacTable failed!\n"));
-			return FALSE;
-		}
-	}
-
-	if (pIPMacTable->valid == FALSE) {
-		/*Set the last hash entry (hash[64]) as our default broadcast Mac address */
-		pEntry = (IPMacMappingEntry *)MATDBEntryAlloc(pMatCfg, sizeof(IPMacMappingEntry));
-
-		if (!pEntry) {
-			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_ERROR, ("IPMacTable_init(): Allocate memory for IPMacTable broadcast entry failed!\n"));
-			return FALSE;
-		}
-
-		NdisZeroMemory(pEntry, sizeof(IPMacMappingEntry));
-		NdisMoveMemory(&pEntry->macAddr[0], &BROADCAST_ADDR[0], 6);
-		pEntry->pNext = NULL;
-		pIPMacTable->hash[IPMAC_TB_HASH_INDEX_OF_BCAST] = pEntry;
-		pIPMacTable->valid = TRUE;
-	} else
-		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_TRACE, ("%s(): IPMacTable already inited!\n", __func__));
-
-	return TRUE;
-}
-
-
-static NDIS_STATUS MATProto_ARP_Exit(
-	IN MAT_STRUCT *pMatCfg)
-{
-	INT status;
-	status = IPMacTable_RemoveAll(pMatCfg);
-	return status;
-}
-
 static PUCHAR MATProto_ARP_Rx(
 	IN MAT_STRUCT		*pMatCfg,
 	IN PNDIS_PACKET		pSkb,
@@ -376,7 +161,7 @@ static PUCHAR MATProto_ARP_Rx(
 	isGoodIP = (*(UINT *)tgtIP != 0);
 
 	if (isUcastMac && isGoodIP)
-		pRealMac = IPMacTableLookUp(pMatCfg, *(UINT *)tgtIP);
+		pRealMac = IPMacTableLookUp(pMatCfg, *(UINT *)tgtIP, tgtMac);
 
 	/*
 		For need replaced mac, we need to replace the targetMAC as correct one to make
@@ -388,7 +173,6 @@ static PUCHAR MATProto_ARP_Rx(
 	if (pRealMac == NULL)
 		pRealMac = &BROADCAST_ADDR[0];
 
-	/*		pRealMac = pIPMacTable->hash[IPMAC_TB_HASH_INDEX_OF_BCAST]->macAddr; */
 	return pRealMac;
 }
 
@@ -453,24 +237,6 @@ static PUCHAR MATProto_ARP_Tx(
 }
 
 
-static NDIS_STATUS MATProto_ARP_Init(
-	IN MAT_STRUCT	*pMatCfg)
-{
-	BOOLEAN status = FALSE;
-	status = IPMacTable_init(pMatCfg);
-	return status;
-}
-
-
-static NDIS_STATUS MATProto_IP_Exit(
-	IN MAT_STRUCT	*pMatCfg)
-{
-	INT status;
-	status = IPMacTable_RemoveAll(pMatCfg);
-	return status;
-}
-
-
 static PUCHAR MATProto_IP_Rx(
 	IN MAT_STRUCT		*pMatCfg,
 	IN PNDIS_PACKET		pSkb,
@@ -487,7 +253,8 @@ static PUCHAR MATProto_IP_Rx(
 	UINT  	dstIP = 0;
 	/* Fetch the IP addres from the packet header. */
 	getDstIPFromIpPkt(pLayerHdr, &dstIP);
-	pMacAddr = IPMacTableLookUp(pMatCfg, dstIP);
+	/* a multicast group address is converted in place */
+	pMacAddr = IPMacTableLookUp(pMatCfg, dstIP, GET_OS_PKT_DATAPTR(pSkb));
 #ifdef MAC_REPEATER_SUPPORT
 
 	if (pAd == NULL) {
@@ -698,15 +465,6 @@ static PUCHAR MATProto_IP_Tx(
 }
 
 
-static NDIS_STATUS MATProto_IP_Init(
-	IN MAT_STRUCT *pMatCfg)
-{
-	BOOLEAN status;
-	status = IPMacTable_init(pMatCfg);
-	return status;
-}
-
-
 static inline void IPintToIPstr(int ipint, char Ipstr[20], ULONG BufLen)
 {
 	int temp = 0;
@@ -721,44 +479,34 @@ static inline void IPintToIPstr(int ipint, char Ipstr[20], ULONG BufLen)
 }
 
 
-VOID getIPMacTbInfo(
-	IN MAT_STRUCT *pMatCfg,
-	IN char *pOutBuf,
-	IN ULONG BufLen)
+static VOID getIPMacEntryInfo(
+	IN PMAT_DB_ENTRY	pEntry,
+	IN VOID				*pCookie)
 {
-	IPMacMappingTable *pIPMacTable;
-	IPMacMappingEntry *pHead;
-	int startIdx, endIdx;
+	char *pOutBuf = (char *)pCookie;
 	char Ipstr[20] = {0};
-	pIPMacTable = (IPMacMappingTable *)pMatCfg->MatTableSet.IPMacTable;
+	UINT ipAddr;
 
-	if ((!pIPMacTable) || (!pIPMacTable->valid)) {
-		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_TRACE, ("%s():IPMacTable not init yet!\n", __func__));
+	/*	if (strlen(pOutBuf) > (IW_PRIV_SIZE_MASK - 30)) */
+	if (RtmpOsCmdDisplayLenCheck(strlen(pOutBuf), 30) == FALSE)
 		return;
-	}
-
-	/* dump all. */
-	startIdx = 0;
-	endIdx = MAT_MAX_HASH_ENTRY_SUPPORT;
-	sprintf(pOutBuf, "\n");
-	sprintf(pOutBuf + strlen(pOutBuf), "%-18s%-20s\n", "IP", "MAC");
 
-	for (; startIdx <  endIdx; startIdx++) {
-		pHead = pIPMacTable->hash[startIdx];
+	NdisMoveMemory(&ipAddr, pEntry->key, IPV4_ADDR_LEN);
+	IPintToIPstr(ipAddr, Ipstr, sizeof(Ipstr));
+	sprintf(pOutBuf + strlen(pOutBuf), "%-18s%02x:%02x:%02x:%02x:%02x:%02x\n",
+			Ipstr, pEntry->macAddr[0], pEntry->macAddr[1], pEntry->macAddr[2],
+			pEntry->macAddr[3], pEntry->macAddr[4], pEntry->macAddr[5]);
+}
 
-		while (pHead) {
-			/*			if (strlen(pOutBuf) > (IW_PRIV_SIZE_MASK - 30)) */
-			if (RtmpOsCmdDisplayLenCheck(strlen(pOutBuf), 30) == FALSE)
-				break;
 
-			NdisZeroMemory(Ipstr, 20);
-			IPintToIPstr(pHead->ipAddr, Ipstr, sizeof(Ipstr));
-			sprintf(pOutBuf + strlen(pOutBuf), "%-18s%02x:%02x:%02x:%02x:%02x:%02x\n",
-					Ipstr, pHead->macAddr[0], pHead->macAddr[1], pHead->macAddr[2],
-					pHead->macAddr[3], pHead->macAddr[4], pHead->macAddr[5]);
-			pHead = pHead->pNext;
-		}
-	}
+VOID getIPMacTbInfo(
+	IN MAT_STRUCT *pMatCfg,
+	IN char *pOutBuf,
+	IN ULONG BufLen)
+{
+	sprintf(pOutBuf, "\n");
+	sprintf(pOutBuf + strlen(pOutBuf), "%-18s%-20s\n", "IP", "MAC");
+	MATDBDump(pMatCfg, MAT_DB_TYPE_IPV4, -1, getIPMacEntryInfo, pOutBuf);
 }
 
 #endif /* MAT_SUPPORT */
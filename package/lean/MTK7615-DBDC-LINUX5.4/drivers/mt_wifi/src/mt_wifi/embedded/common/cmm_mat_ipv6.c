@@ -37,33 +37,14 @@
 
 const UCHAR IPV6_LOOPBACKADDR[] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1};
 
-static NDIS_STATUS MATProto_IPv6_Init(MAT_STRUCT *pMatCfg);
-static NDIS_STATUS MATProto_IPv6_Exit(MAT_STRUCT *pMatCfg);
 static PUCHAR MATProto_IPv6_Rx(MAT_STRUCT *pMatCfg, PNDIS_PACKET pSkb, PUCHAR pLayerHdr, PUCHAR pDevMacAdr);
 static PUCHAR MATProto_IPv6_Tx(MAT_STRUCT *pMatCfg, PNDIS_PACKET pSkb, PUCHAR pLayerHdr, PUCHAR pDevMacAdr);
 
 #define RT_UDP_HDR_LEN	8
 
-typedef struct _IPv6MacMappingEntry {
-	UCHAR ipv6Addr[16];	/* In network order */
-	UCHAR macAddr[MAC_ADDR_LEN];
-	ULONG lastTime;
-	struct _IPv6MacMappingEntry *pNext;
-} IPv6MacMappingEntry, *PIPv6MacMappingEntry;
-
-
-typedef struct _IPv6MacMappingTable {
-	BOOLEAN			valid;
-	IPv6MacMappingEntry * hash[MAT_MAX_HASH_ENTRY_SUPPORT + 1]; /*0~63 for specific station, 64 for broadcast MacAddress */
-	UCHAR			curMcastAddr[MAC_ADDR_LEN];	/* The multicast mac addr for currecnt received packet destined to ipv6 multicast addr */
-} IPv6MacMappingTable;
-
-
 struct _MATProtoOps MATProtoIPv6Handle = {
-	.init = MATProto_IPv6_Init,
 	.tx = MATProto_IPv6_Tx,
 	.rx = MATProto_IPv6_Rx,
-	.exit = MATProto_IPv6_Exit,
 };
 
 static inline BOOLEAN needUpdateIPv6MacTB(
@@ -131,173 +112,71 @@ ICMPv6 Format:
 	+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
 */
 
+static VOID dumpIPv6MacEntry(
+	IN PMAT_DB_ENTRY	pEntry,
+	IN VOID				*pCookie)
+{
+	MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("\t:IPv6=%04x:%04x:%04x:%04x:%04x:%04x:%04x:%04x,Mac=%02x:%02x:%02x:%02x:%02x:%02x, lastTime=0x%lx\n"
+			, OS_NTOHS((*((RT_IPV6_ADDR *)(&pEntry->key[0]))).ipv6_addr16[0])
+			, OS_NTOHS((*((RT_IPV6_ADDR *)(&pEntry->key[0]))).ipv6_addr16[1])
+			, OS_NTOHS((*((RT_IPV6_ADDR *)(&pEntry->key[0]))).ipv6_addr16[2])
+			, OS_NTOHS((*((RT_IPV6_ADDR *)(&pEntry->key[0]))).ipv6_addr16[3])
+			, OS_NTOHS((*((RT_IPV6_ADDR *)(&pEntry->key[0]))).ipv6_addr16[4])
+			, OS_NTOHS((*((RT_IPV6_ADDR *)(&pEntry->key[0]))).ipv6_addr16[5])
+			, OS_NTOHS((*((RT_IPV6_ADDR *)(&pEntry->key[0]))).ipv6_addr16[6])
+			, OS_NTOHS((*((RT_IPV6_ADDR *)(&pEntry->key[0]))).ipv6_addr16[7])
+			, pEntry->macAddr[0], pEntry->macAddr[1], pEntry->macAddr[2]
+			, pEntry->macAddr[3], pEntry->macAddr[4], pEntry->macAddr[5], pEntry->lastTime));
+}
+
 NDIS_STATUS  dumpIPv6MacTb(
 	IN MAT_STRUCT *pMatCfg,
 	IN int index)
 {
-	IPv6MacMappingTable *pIPv6MacTable;
-	IPv6MacMappingEntry *pHead;
-	int startIdx, endIdx;
-
-	pIPv6MacTable = (IPv6MacMappingTable *)pMatCfg->MatTableSet.IPv6MacTable;
-
-	if ((!pIPv6MacTable) || (!pIPv6MacTable->valid)) {
-		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("%s():IPv6MacTable not init yet, so cannot do dump!\n", __func__));
-		return FALSE;
-	}
-
-	if (index < 0) {
-		/* dump all. */
-		startIdx = 0;
-		endIdx = MAT_MAX_HASH_ENTRY_SUPPORT;
-	} else {
-		/* dump specific hash index. */
-		startIdx = endIdx = index;
-	}
-
 	MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("%s():\n", __func__));
-
-	for (; startIdx <= endIdx; startIdx++) {
-		pHead = pIPv6MacTable->hash[startIdx];
-
-		while (pHead) {
-			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("IPv6Mac[%d]:\n", startIdx));
-			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("\t:IPv6=%04x:%04x:%04x:%04x:%04x:%04x:%04x:%04x,Mac=%02x:%02x:%02x:%02x:%02x:%02x, lastTime=0x%lx, next=%p\n"
-					, OS_NTOHS((*((RT_IPV6_ADDR *)(&pHead->ipv6Addr[0]))).ipv6_addr16[0])
-					, OS_NTOHS((*((RT_IPV6_ADDR *)(&pHead->ipv6Addr[0]))).ipv6_addr16[1])
-					, OS_NTOHS((*((RT_IPV6_ADDR *)(&pHead->ipv6Addr[0]))).ipv6_addr16[2])
-					, OS_NTOHS((*((RT_IPV6_ADDR *)(&pHead->ipv6Addr[0]))).ipv6_addr16[3])
-					, OS_NTOHS((*((RT_IPV6_ADDR *)(&pHead->ipv6Addr[0]))).ipv6_addr16[4])
-					, OS_NTOHS((*((RT_IPV6_ADDR *)(&pHead->ipv6Addr[0]))).ipv6_addr16[5])
-					, OS_NTOHS((*((RT_IPV6_ADDR *)(&pHead->ipv6Addr[0]))).ipv6_addr16[6])
-					, OS_NTOHS((*((RT_IPV6_ADDR *)(&pHead->ipv6Addr[0]))).ipv6_addr16[7])
-					, pHead->macAddr[0], pHead->macAddr[1], pHead->macAddr[2]
-					, pHead->macAddr[3], pHead->macAddr[4], pHead->macAddr[5], pHead->lastTime, pHead->pNext));
-			pHead = pHead->pNext;
-		}
-	}
-
+	MATDBDump(pMatCfg, MAT_DB_TYPE_IPV6, index, dumpIPv6MacEntry, NULL);
 	MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("\t----EndOfDump!\n"));
 	return TRUE;
 }
 
 
-
 static NDIS_STATUS IPv6MacTableUpdate(
 	IN MAT_STRUCT		*pMatCfg,
 	IN PUCHAR			pMacAddr,
 	IN PCHAR			pIPv6Addr)
 {
-	UINT				hashIdx;
-	IPv6MacMappingTable	*pIPv6MacTable;
-	IPv6MacMappingEntry	*pEntry = NULL, *pPrev = NULL, *pNewEntry = NULL;
-	ULONG				now;
-
-	pIPv6MacTable = (IPv6MacMappingTable *)pMatCfg->MatTableSet.IPv6MacTable;
-
-	if ((!pIPv6MacTable) || (!pIPv6MacTable->valid))
-		return FALSE;
-
-	hashIdx = MAT_IPV6_ADDR_HASH_INDEX(pIPv6Addr);
-	pEntry = pPrev = pIPv6MacTable->hash[hashIdx];
-
-	while (pEntry) {
-		NdisGetSystemUpTime(&now);
-
-		/* Find a existed IP-MAC Mapping entry */
-		if (NdisEqualMemory(pIPv6Addr, pEntry->ipv6Addr, IPV6_ADDR_LEN)) {
-			/* comparison is useless. So we directly copy it into the entry. */
-			NdisMoveMemory(pEntry->macAddr, pMacAddr, 6);
-			NdisGetSystemUpTime(&pEntry->lastTime);
-			return TRUE;
-		} else {
-			/* handle the aging-out situation */
-			if (RTMP_TIME_AFTER(now, (pEntry->lastTime + MAT_TB_ENTRY_AGEOUT_TIME))) {
-				/* Remove the aged entry */
-				if (pEntry == pIPv6MacTable->hash[hashIdx]) {
-					pIPv6MacTable->hash[hashIdx] = pEntry->pNext;
-					pPrev = pIPv6MacTable->hash[hashIdx];
-				} else
-					pPrev->pNext = pEntry->pNext;
-
-				MATDBEntryFree(pMatCfg, (PUCHAR)pEntry);
-				pEntry = (pPrev == NULL ? NULL : pPrev->pNext);
-				pMatCfg->nodeCount--;
-			} else {
-				pPrev = pEntry;
-				pEntry = pEntry->pNext;
-			}
-		}
-	}
-
-	/* Allocate a new IPv6MacMapping entry and insert into the hash */
-	pNewEntry = (IPv6MacMappingEntry *)MATDBEntryAlloc(pMatCfg, sizeof(IPv6MacMappingEntry));
-
-	if (pNewEntry != NULL) {
-		NdisMoveMemory(pNewEntry->ipv6Addr, pIPv6Addr, IPV6_ADDR_LEN);
-		NdisMoveMemory(pNewEntry->macAddr, pMacAddr, 6);
-		pNewEntry->pNext = NULL;
-		NdisGetSystemUpTime(&pNewEntry->lastTime);
-
-		if (pIPv6MacTable->hash[hashIdx] == NULL) {
-			/* Hash list is empty, directly assign it. */
-			pIPv6MacTable->hash[hashIdx] = pNewEntry;
-		} else {
-			/* Ok, we insert the new entry into the root of hash[hashIdx] */
-			pNewEntry->pNext = pIPv6MacTable->hash[hashIdx];
-			pIPv6MacTable->hash[hashIdx] = pNewEntry;
-		}
-
-		/*dumpIPv6MacTb(pMatCfg, hashIdx); //for debug */
-		pMatCfg->nodeCount++;
-		return TRUE;
-	}
-
-	MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_ERROR, ("IPv6MacTableUpdate():Insertion failed!\n"));
-	return FALSE;
+	return (MATDBUpdate(pMatCfg, MAT_DB_TYPE_IPV6, (PUCHAR)pIPv6Addr, IPV6_ADDR_LEN, pMacAddr, 0) != NULL) ? TRUE : FALSE;
 }
 
 
+/*
+	Called inside the RCU read lock of the MAT engine. A multicast pIPv6Addr is
+	converted into pGroupMacAddr, which is then returned.
+*/
 static PUCHAR IPv6MacTableLookUp(
 	IN	MAT_STRUCT		*pMatCfg,
-	IN	PUCHAR			pIPv6Addr)
+	IN	PUCHAR			pIPv6Addr,
+	IN	PUCHAR			pGroupMacAddr)
 {
-	UINT				hashIdx;
-	IPv6MacMappingTable	*pIPv6MacTable;
-	IPv6MacMappingEntry	*pEntry = NULL;
-	PUCHAR				pGroupMacAddr;
-
-	pIPv6MacTable = (IPv6MacMappingTable *)pMatCfg->MatTableSet.IPv6MacTable;
-
-	if ((!pIPv6MacTable) || (!pIPv6MacTable->valid))
-		return NULL;
+	PMAT_DB_ENTRY pEntry;
 
 	/*if IPV6 multicast address, need converting multicast group address to ethernet address. */
 	if (IS_MULTICAST_IPV6_ADDR(*(RT_IPV6_ADDR *)pIPv6Addr)) {
-		pGroupMacAddr = (PUCHAR)&pIPv6MacTable->curMcastAddr;
 		ConvertMulticastIP2MAC(pIPv6Addr, (UCHAR **)(&pGroupMacAddr), ETH_P_IPV6);
-		return pIPv6MacTable->curMcastAddr;
+		return pGroupMacAddr;
 	}
 
-	/* Use hash to find out the location of that entry and get the Mac address. */
-	hashIdx = MAT_IPV6_ADDR_HASH_INDEX(pIPv6Addr);
-	/*	spin_lock_irqsave(&IPMacTabLock, irqFlag); */
-	pEntry = pIPv6MacTable->hash[hashIdx];
-
-	while (pEntry) {
-		if (NdisEqualMemory(pEntry->ipv6Addr, pIPv6Addr, IPV6_ADDR_LEN)) {
-			/*Update the lastTime to prevent the aging before pDA processed! */
-			NdisGetSystemUpTime(&pEntry->lastTime);
-			return pEntry->macAddr;
-		} else
-			pEntry = pEntry->pNext;
-	}
+	pEntry = MATDBLookup(pMatCfg, MAT_DB_TYPE_IPV6, pIPv6Addr, IPV6_ADDR_LEN);
+
+	if (pEntry)
+		return pEntry->macAddr;
 
 	/*
 		We didn't find any matched Mac address, our policy is treat it as
 		broadcast packet and send to all.
 	*/
-	return pIPv6MacTable->hash[IPV6MAC_TB_HASH_INDEX_OF_BCAST]->macAddr;
+	MATDBStatBcastFallback(pMatCfg, MAT_DB_TYPE_IPV6);
+	return &BROADCAST_ADDR[0];
 }
 
 
@@ -364,7 +243,8 @@ static PUCHAR MATProto_IPv6_Rx(
 	PUCHAR pDstIPv6Addr;
 	/* Fetch the IPv6 addres from the packet header. */
 	pDstIPv6Addr = (UCHAR *)(&((RT_IPV6_HDR *)pLayerHdr)->dstAddr);
-	pMacAddr = IPv6MacTableLookUp(pMatCfg, pDstIPv6Addr);
+	/* a multicast group address is converted in place */
+	pMacAddr = IPv6MacTableLookUp(pMatCfg, pDstIPv6Addr, GET_OS_PKT_DATAPTR(pSkb));
 	return pMacAddr;
 }
 
@@ -378,6 +258,7 @@ static PNDIS_PACKET ICMPv6_Handle_Tx(
 	RT_IPV6_HDR			*pIPv6Hdr;
 	RT_ICMPV6_HDR			*pICMPv6Hdr;
 	RT_ICMPV6_OPTION_HDR	*pOptHdr;
+	RT_IPV6_ADDR			*pTgtAddr;
 	USHORT payloadLen;
 	UINT32 ICMPOffset = 0, ICMPMsgLen = 0;
 	INT32 leftLen;
@@ -461,6 +342,10 @@ static PNDIS_PACKET ICMPv6_Handle_Tx(
 					break;  /* discard it, because it's invalid. */
 
 				if (pOptHdr->type == TYPE_SRC_LL_ADDR) {
+					/* learn the sender from its link-layer address before we replace it. */
+					if (needUpdateIPv6MacTB(&pOptHdr->octet[0], &pIPv6Hdr->srcAddr))
+						IPv6MacTableUpdate(pMatSrtuct, &pOptHdr->octet[0], (PCHAR)&pIPv6Hdr->srcAddr);
+
 					/*replace the src link-layer address as ours. */
 					needModify = TRUE;
 					offset += 2;	/* 2 = "type, len" fields. Here indicate to the place of src mac. */
@@ -488,6 +373,12 @@ static PNDIS_PACKET ICMPv6_Handle_Tx(
 					break;  /* discard it, because it's invalid. */
 
 				if (pOptHdr->type == TYPE_TGT_LL_ADDR) {
+					/* the target address is owned by the sender, learn it before the first packet from it. */
+					pTgtAddr = (RT_IPV6_ADDR *)(pLayerHdr + ICMPOffset + 8);
+
+					if (needUpdateIPv6MacTB(&pOptHdr->octet[0], pTgtAddr))
+						IPv6MacTableUpdate(pMatSrtuct, &pOptHdr->octet[0], (PCHAR)pTgtAddr);
+
 					/*replace the src link-layer address as ours. */
 					needModify = TRUE;
 					offset += 2;	/* 2 = "type, len" fields. */
@@ -618,144 +509,40 @@ static PUCHAR MATProto_IPv6_Tx(
 
 
 
-static NDIS_STATUS IPv6MacTable_RemoveAll(
-	IN MAT_STRUCT *pMatCfg)
+static VOID getIPv6MacEntryInfo(
+	IN PMAT_DB_ENTRY	pEntry,
+	IN VOID				*pCookie)
 {
-	IPv6MacMappingTable	*pIPv6MacTable;
-	IPv6MacMappingEntry	*pEntry;
-	UINT32				i;
-
-	pIPv6MacTable = (IPv6MacMappingTable *)pMatCfg->MatTableSet.IPv6MacTable;
-
-	if (!pIPv6MacTable)
-		return TRUE;
-
-	if (pIPv6MacTable->valid) {
-		pIPv6MacTable->valid = FALSE;
-
-		for (i = 0; i < IPV6MAC_TB_HASH_ENTRY_NUM; i++) {
-			while ((pEntry = pIPv6MacTable->hash[i]) != NULL) {
-				pIPv6MacTable->hash[i] = pEntry->pNext;
-				MATDBEntryFree(pMatCfg, (PUCHAR)pEntry);
-			}
-		}
-	}
-
-	os_free_mem(pIPv6MacTable);
-	pMatCfg->MatTableSet.IPv6MacTable = NULL;
-	return TRUE;
-}
-
-
-static NDIS_STATUS IPv6MacTable_init(
-	IN MAT_STRUCT *pMatCfg)
-{
-	IPv6MacMappingEntry *pEntry = NULL;
-	IPv6MacMappingTable	*pIPv6MacTable;
-
-	if (pMatCfg->MatTableSet.IPv6MacTable != NULL)
-		pIPv6MacTable = (IPv6MacMappingTable *)pMatCfg->MatTableSet.IPv6MacTable;
-	else {
-		os_alloc_mem_suspend(NULL, (UCHAR **)&(pMatCfg->MatTableSet.IPv6MacTable), sizeof(IPv6MacMappingTable));
-
-		if (pMatCfg->MatTableSet.IPv6MacTable) {
-			pIPv6MacTable = (IPv6MacMappingTable *)pMatCfg->MatTableSet.IPv6MacTable;
-			NdisZeroMemory(pIPv6MacTable, sizeof(IPv6MacMappingTable));
-		} else {
-			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_ERROR, ("IPMacTable_init(): Allocate memory for IPv6MacTable failed!\n"));
-			return FALSE;
-		}
-	}
-
-	if (pIPv6MacTable->valid == FALSE) {
-		/*Set the last hash entry (hash[64]) as our default broadcast Mac address */
-		pEntry = (IPv6MacMappingEntry *)MATDBEntryAlloc(pMatCfg, sizeof(IPv6MacMappingEntry));
-
-		if (!pEntry) {
-			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_ERROR, ("IPMacTable_init(): Allocate memory for IPMacTable broadcast entry failed!\n"));
-			return FALSE;
-		}
-
-		NdisZeroMemory(pEntry, sizeof(IPv6MacMappingEntry));
-		NdisMoveMemory(pEntry->macAddr, BROADCAST_ADDR, MAC_ADDR_LEN);
-		pEntry->pNext = NULL;
-		pIPv6MacTable->hash[IPV6MAC_TB_HASH_INDEX_OF_BCAST] = pEntry;
-		pIPv6MacTable->valid = TRUE;
-	} else
-		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_TRACE, ("%s(): IPv6MacTable already inited!\n", __func__));
-
-	return TRUE;
-}
-
-
-static NDIS_STATUS MATProto_IPv6_Exit(
-	IN MAT_STRUCT	*pMatCfg)
-{
-	INT status;
-
-	status = IPv6MacTable_RemoveAll(pMatCfg);
-	return status;
-}
-
+	char *pOutBuf = (char *)pCookie;
+	char Ipv6str[40] = {0};
 
-static NDIS_STATUS MATProto_IPv6_Init(
-	IN MAT_STRUCT	*pMatCfg)
-{
-	BOOLEAN status = FALSE;
+	/*	    if (strlen(pOutBuf) > (IW_PRIV_SIZE_MASK - 30)) */
+	if (RtmpOsCmdDisplayLenCheck(strlen(pOutBuf), 30) == FALSE)
+		return;
 
-	status = IPv6MacTable_init(pMatCfg);
-	return status;
+	sprintf(Ipv6str, "%04x:%04x:%04x:%04x:%04x:%04x:%04x:%04x"
+			, OS_NTOHS((*((RT_IPV6_ADDR *)(&pEntry->key[0]))).ipv6_addr16[0])
+			, OS_NTOHS((*((RT_IPV6_ADDR *)(&pEntry->key[0]))).ipv6_addr16[1])
+			, OS_NTOHS((*((RT_IPV6_ADDR *)(&pEntry->key[0]))).ipv6_addr16[2])
+			, OS_NTOHS((*((RT_IPV6_ADDR *)(&pEntry->key[0]))).ipv6_addr16[3])
+			, OS_NTOHS((*((RT_IPV6_ADDR *)(&pEntry->key[0]))).ipv6_addr16[4])
+			, OS_NTOHS((*((RT_IPV6_ADDR *)(&pEntry->key[0]))).ipv6_addr16[5])
+			, OS_NTOHS((*((RT_IPV6_ADDR *)(&pEntry->key[0]))).ipv6_addr16[6])
+			, OS_NTOHS((*((RT_IPV6_ADDR *)(&pEntry->key[0]))).ipv6_addr16[7]));
+	sprintf(pOutBuf + strlen(pOutBuf), "%-40s%02x:%02x:%02x:%02x:%02x:%02x\n",
+			Ipv6str, pEntry->macAddr[0], pEntry->macAddr[1], pEntry->macAddr[2],
+			pEntry->macAddr[3], pEntry->macAddr[4], pEntry->macAddr[5]);
 }
 
 
-
 VOID getIPv6MacTbInfo(
 	IN MAT_STRUCT *pMatCfg,
 	IN char *pOutBuf,
 	IN ULONG BufLen)
 {
-	IPv6MacMappingTable *pIPv6MacTable;
-	IPv6MacMappingEntry *pHead;
-	int startIdx, endIdx;
-	char Ipv6str[40] = {0};
-
-	pIPv6MacTable = (IPv6MacMappingTable *)pMatCfg->MatTableSet.IPv6MacTable;
-
-	if ((!pIPv6MacTable) || (!pIPv6MacTable->valid)) {
-		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_TRACE, ("%s():IPv6MacTable not init yet!\n", __func__));
-		return;
-	}
-
-	/* dump all. */
-	startIdx = 0;
-	endIdx = MAT_MAX_HASH_ENTRY_SUPPORT;
 	sprintf(pOutBuf, "\n");
 	sprintf(pOutBuf + strlen(pOutBuf), "%-40s%-20s\n", "IP", "MAC");
-
-	for (; startIdx < endIdx; startIdx++) {
-		pHead = pIPv6MacTable->hash[startIdx];
-
-		while (pHead) {
-			/*	    if (strlen(pOutBuf) > (IW_PRIV_SIZE_MASK - 30)) */
-			if (RtmpOsCmdDisplayLenCheck(strlen(pOutBuf), 30) == FALSE)
-				break;
-
-			NdisZeroMemory(Ipv6str, 40);
-			sprintf(Ipv6str, "%04x:%04x:%04x:%04x:%04x:%04x:%04x:%04x"
-					, OS_NTOHS((*((RT_IPV6_ADDR *)(&pHead->ipv6Addr[0]))).ipv6_addr16[0])
-					, OS_NTOHS((*((RT_IPV6_ADDR *)(&pHead->ipv6Addr[0]))).ipv6_addr16[1])
-					, OS_NTOHS((*((RT_IPV6_ADDR *)(&pHead->ipv6Addr[0]))).ipv6_addr16[2])
-					, OS_NTOHS((*((RT_IPV6_ADDR *)(&pHead->ipv6Addr[0]))).ipv6_addr16[3])
-					, OS_NTOHS((*((RT_IPV6_ADDR *)(&pHead->ipv6Addr[0]))).ipv6_addr16[4])
-					, OS_NTOHS((*((RT_IPV6_ADDR *)(&pHead->ipv6Addr[0]))).ipv6_addr16[5])
-					, OS_NTOHS((*((RT_IPV6_ADDR *)(&pHead->ipv6Addr[0]))).ipv6_addr16[6])
-					, OS_NTOHS((*((RT_IPV6_ADDR *)(&pHead->ipv6Addr[0]))).ipv6_addr16[7]));
-			sprintf(pOutBuf + strlen(pOutBuf), "%-40s%02x:%02x:%02x:%02x:%02x:%02x\n",
-					Ipv6str, pHead->macAddr[0], pHead->macAddr[1], pHead->macAddr[2],
-					pHead->macAddr[3], pHead->macAddr[4], pHead->macAddr[5]);
-			pHead = pHead->pNext;
-		}
-	}
+	MATDBDump(pMatCfg, MAT_DB_TYPE_IPV6, -1, getIPv6MacEntryInfo, pOutBuf);
 }
 
 #endif /* MAT_SUPPORT */
@@ -33,13 +33,9 @@
 
 #include "rt_config.h"
 
-static NDIS_STATUS MATProto_PPPoEDis_Init(MAT_STRUCT *pMatStruct);
-static NDIS_STATUS MATProto_PPPoEDis_Exit(MAT_STRUCT *pMatStruct);
 static PUCHAR MATProto_PPPoEDis_Rx(MAT_STRUCT *pMatStruct, PNDIS_PACKET pSkb, PUCHAR pLayerHdr, PUCHAR pDevMacAdr);
 static PUCHAR MATProto_PPPoEDis_Tx(MAT_STRUCT *pMatStruct, PNDIS_PACKET pSkb, PUCHAR pLayerHdr, PUCHAR pDevMacAdr);
 
-static NDIS_STATUS MATProto_PPPoESes_Init(MAT_STRUCT *pMatStruct);
-static NDIS_STATUS MATProto_PPPoESes_Exit(MAT_STRUCT *pMatStruct);
 static PUCHAR MATProto_PPPoESes_Rx(MAT_STRUCT *pMatStruct, PNDIS_PACKET pSkb, PUCHAR pLayerHdr, PUCHAR pDevMacAdr);
 static PUCHAR MATProto_PPPoESes_Tx(MAT_STRUCT *pMatStruct, PNDIS_PACKET pSkb, PUCHAR pLayerHdr, PUCHAR pDevMacAdr);
 
@@ -111,201 +107,81 @@ PPPoE Session Stage(Ethernet protocol type = 0x8864):
 #define PPPOE_TAG_ID_HOST_UNIQ	0x0103
 #define PPPOE_TAG_ID_AC_COOKIE	0x0104
 
-#define PPPoE_SES_ENTRY_AGEOUT_TIME 3000
-
 /* Data structure used for PPPoE discovery stage */
 #define PPPOE_DIS_UID_LEN		6
-typedef struct _UidMacMappingEntry {
-	UCHAR isServer;
-	UCHAR uIDAddByUs;				 /* If the host-uniq or AC-cookie is add by our driver, set it as 1, else set as 0. */
-	UCHAR uIDStr[PPPOE_DIS_UID_LEN]; /* String used for identify who sent this pppoe packet in discovery stage. */
-	UCHAR macAddr[MAC_ADDR_LEN];	 /* Mac address associated to this uid string. */
-	ULONG lastTime;
-	struct _UidMacMappingEntry *pNext;	/*Pointer to next entry in link-list of Uid hash table. */
-} UidMacMappingEntry, *PUidMacMappingEntry;
-
-typedef struct _UidMacMappingTable {
-	BOOLEAN valid;
-	UidMacMappingEntry * uidHash[MAT_MAX_HASH_ENTRY_SUPPORT];
-} UidMacMappingTable;
-
-/* "Host-Uniq <-> Mac Address" Mapping table used for PPPoE Discovery stage */
-
-/* Data struct used for PPPoE session stage */
-typedef struct _SesMacMappingEntry {
-	UINT16	sessionID;	/* In network order */
-	UCHAR	outMacAddr[MAC_ADDR_LEN];
-	UCHAR	inMacAddr[MAC_ADDR_LEN];
-	ULONG	lastTime;
-	struct	_SesMacMappingEntry *pNext;
-} SesMacMappingEntry, *PSesMacMappingEntry;
-
-typedef struct _SesMacMappingTable {
-	BOOLEAN valid;
-	SesMacMappingEntry * sesHash[MAT_MAX_HASH_ENTRY_SUPPORT];
-} SesMacMappingTable;
+
+/*
+	"Host-Uniq <-> Mac Address" Mapping used for PPPoE Discovery stage, the key of the
+	MAT_DB_TYPE_PPPOE_UID entry is the string used for identify who sent this pppoe packet.
+*/
+#define PPPOE_UID_FLAG_SERVER		0x01
+#define PPPOE_UID_FLAG_ADD_BY_US	0x02	/* the host-uniq or AC-cookie is add by our driver */
+
+/* Data struct used for PPPoE session stage, the key of the MAT_DB_TYPE_PPPOE_SES entry */
+#define PPPOE_SES_KEY_LEN		(2 + MAC_ADDR_LEN)	/* sessionID + outMacAddr */
 
 /* Declaration of protocol handler for PPPoE Discovery stage */
 struct _MATProtoOps MATProtoPPPoEDisHandle = {
-	.init = MATProto_PPPoEDis_Init,
 	.tx = MATProto_PPPoEDis_Tx,
 	.rx = MATProto_PPPoEDis_Rx,
-	.exit = MATProto_PPPoEDis_Exit,
 };
 
 /* Declaration of protocol handler for PPPoE Session stage */
 struct _MATProtoOps MATProtoPPPoESesHandle = {
-	.init = MATProto_PPPoESes_Init,
 	.tx = MATProto_PPPoESes_Tx,
 	.rx = MATProto_PPPoESes_Rx,
-	.exit = MATProto_PPPoESes_Exit,
 };
 
 
-NDIS_STATUS dumpSesMacTb(
-	IN MAT_STRUCT *pMatCfg,
-	IN int hashIdx)
+static VOID dumpSesMacEntry(
+	IN PMAT_DB_ENTRY	pEntry,
+	IN VOID				*pCookie)
 {
-	SesMacMappingTable *pSesMacTable;
-	SesMacMappingEntry *pHead;
-	int startIdx, endIdx;
-	pSesMacTable = (SesMacMappingTable *)pMatCfg->MatTableSet.SesMacTable;
-
-	if ((!pSesMacTable) || (!pSesMacTable->valid)) {
-		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("SesMacTable not init yet, so cannot do dump!\n"));
-		return FALSE;
-	}
-
-	if (hashIdx < 0) {
-		/* dump all. */
-		startIdx = 0;
-		endIdx = MAT_MAX_HASH_ENTRY_SUPPORT - 1;
-	} else {
-		/* dump specific hash index. */
-		startIdx = endIdx = hashIdx;
-	}
-
-	MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("%s():\n", __func__));
-
-	for (; startIdx <= endIdx; startIdx++) {
-		pHead = pSesMacTable->sesHash[startIdx];
-
-		while (pHead) {
-			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("SesMac[%d]:\n", startIdx));
-			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("\tsesID=%d,inMac=%02x:%02x:%02x:%02x:%02x:%02x,outMac=%02x:%02x:%02x:%02x:%02x:%02x,lastTime=0x%lx, pNext=%p\n",
-					 pHead->sessionID, PRINT_MAC(pHead->inMacAddr), PRINT_MAC(pHead->outMacAddr), pHead->lastTime, pHead->pNext));
-			pHead = pHead->pNext;
-		}
-	}
+	UINT16 sesID;
 
-	MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("\t----EndOfDump!\n"));
-	return TRUE;
+	NdisMoveMemory(&sesID, pEntry->key, 2);
+	MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("\tsesID=%d,inMac=%02x:%02x:%02x:%02x:%02x:%02x,outMac=%02x:%02x:%02x:%02x:%02x:%02x,lastTime=0x%lx\n",
+			 sesID, PRINT_MAC(pEntry->macAddr), PRINT_MAC(&pEntry->key[2]), pEntry->lastTime));
 }
 
-
-NDIS_STATUS dumpUidMacTb(MAT_STRUCT *pMatCfg, int hashIdx)
+NDIS_STATUS dumpSesMacTb(
+	IN MAT_STRUCT *pMatCfg,
+	IN int hashIdx)
 {
-	UidMacMappingTable *pUidMacTable;
-	UidMacMappingEntry *pHead;
-	int i;
-	int startIdx, endIdx;
-	pUidMacTable = (UidMacMappingTable *)pMatCfg->MatTableSet.UidMacTable;
-
-	if ((!pUidMacTable) || (!pUidMacTable->valid)) {
-		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("UidMacTable not init yet, so cannot do dump!\n"));
-		return FALSE;
-	}
-
-	if (hashIdx < 0) {
-		/* dump all. */
-		startIdx = 0;
-		endIdx = MAT_MAX_HASH_ENTRY_SUPPORT - 1;
-	} else {
-		/* dump specific hash index. */
-		startIdx = endIdx = hashIdx;
-	}
-
 	MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("%s():\n", __func__));
-
-	for (; startIdx <= endIdx; startIdx++) {
-		pHead = pUidMacTable->uidHash[startIdx];
-
-		while (pHead) {
-			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("UidMac[%d]:\n", startIdx));
-			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("\tisSrv=%d, uIDAddbyUs=%d, Mac=%02x:%02x:%02x:%02x:%02x:%02x, lastTime=0x%lx, pNext=%p\n",
-					 pHead->isServer, pHead->uIDAddByUs, PRINT_MAC(pHead->macAddr), pHead->lastTime, pHead->pNext));
-			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("\tuIDStr="));
-
-			for (i = 0; i < PPPOE_DIS_UID_LEN; i++)
-				MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("%02x", pHead->uIDStr[i]));
-
-			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("\n"));
-			pHead = pHead->pNext;
-		}
-	}
-
+	MATDBDump(pMatCfg, MAT_DB_TYPE_PPPOE_SES, hashIdx, dumpSesMacEntry, NULL);
 	MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("\t----EndOfDump!\n"));
 	return TRUE;
 }
 
 
-static NDIS_STATUS UidMacTable_RemoveAll(
-	IN MAT_STRUCT *pMatCfg)
+static VOID dumpUidMacEntry(
+	IN PMAT_DB_ENTRY	pEntry,
+	IN VOID				*pCookie)
 {
-	UidMacMappingTable *pUidMacTable;
-	UidMacMappingEntry *pEntry;
-	INT             i;
-	pUidMacTable = (UidMacMappingTable *)pMatCfg->MatTableSet.UidMacTable;
-
-	if (!pUidMacTable)
-		return TRUE;
+	int i;
 
-	if (pUidMacTable->valid) {
-		pUidMacTable->valid = FALSE;
+	MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("\tisSrv=%d, uIDAddbyUs=%d, Mac=%02x:%02x:%02x:%02x:%02x:%02x, lastTime=0x%lx\n",
+			 (pEntry->flags & PPPOE_UID_FLAG_SERVER) ? 1 : 0, (pEntry->flags & PPPOE_UID_FLAG_ADD_BY_US) ? 1 : 0,
+			 PRINT_MAC(pEntry->macAddr), pEntry->lastTime));
+	MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("\tuIDStr="));
 
-		for (i = 0; i < MAT_MAX_HASH_ENTRY_SUPPORT; i++) {
-			while ((pEntry = pUidMacTable->uidHash[i]) != NULL) {
-				pUidMacTable->uidHash[i] = pEntry->pNext;
-				MATDBEntryFree(pMatCfg, (PUCHAR)pEntry);
-			}
-		}
-	}
+	for (i = 0; i < pEntry->keyLen; i++)
+		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("%02x", pEntry->key[i]));
 
-	os_free_mem(pMatCfg->MatTableSet.UidMacTable);
-	pMatCfg->MatTableSet.UidMacTable = NULL;
-	return TRUE;
+	MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("\n"));
 }
 
-
-static NDIS_STATUS SesMacTable_RemoveAll(
-	IN MAT_STRUCT *pMatCfg)
+NDIS_STATUS dumpUidMacTb(MAT_STRUCT *pMatCfg, int hashIdx)
 {
-	SesMacMappingTable *pSesMacTable;
-	SesMacMappingEntry *pEntry;
-	INT             i;
-	pSesMacTable = (SesMacMappingTable *)pMatCfg->MatTableSet.SesMacTable;
-
-	if (!pSesMacTable)
-		return TRUE;
-
-	if (pSesMacTable->valid) {
-		pSesMacTable->valid = FALSE;
-
-		for (i = 0; i < MAT_MAX_HASH_ENTRY_SUPPORT; i++) {
-			while ((pEntry = pSesMacTable->sesHash[i]) != NULL) {
-				pSesMacTable->sesHash[i] = pEntry->pNext;
-				MATDBEntryFree(pMatCfg, (PUCHAR)pEntry);
-			}
-		}
-	}
-
-	os_free_mem(pMatCfg->MatTableSet.SesMacTable);
-	pMatCfg->MatTableSet.SesMacTable = NULL;
+	MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("%s():\n", __func__));
+	MATDBDump(pMatCfg, MAT_DB_TYPE_PPPOE_UID, hashIdx, dumpUidMacEntry, NULL);
+	MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_OFF, ("\t----EndOfDump!\n"));
 	return TRUE;
 }
 
 
-static PUidMacMappingEntry UidMacTableUpdate(
+static PMAT_DB_ENTRY UidMacTableUpdate(
 	IN MAT_STRUCT		*pMatCfg,
 	IN PUCHAR			pInMac,
 	IN PUCHAR			pOutMac,
@@ -313,20 +189,11 @@ static PUidMacMappingEntry UidMacTableUpdate(
 	IN UINT16			tagLen,
 	IN UINT16			isServer)
 {
-	UINT				hashIdx, i = 0, uIDAddByUs = 0;
-	UidMacMappingTable	*pUidMacTable;
-	UidMacMappingEntry	*pEntry = NULL, *pPrev = NULL, *pNewEntry = NULL;
-	UCHAR				hashVal = 0;
+	UCHAR				flags = 0;
 	PUCHAR				pUIDStr = NULL;
-	ULONG				now;
-	pUidMacTable = (UidMacMappingTable *)pMatCfg->MatTableSet.UidMacTable;
-
-	if ((!pUidMacTable) || (!pUidMacTable->valid))
-		return NULL;
 
 	if (pTagInfo && tagLen > 0) {
 		pUIDStr = pTagInfo;
-		uIDAddByUs = 0;
 		tagLen = (tagLen > PPPOE_DIS_UID_LEN ? PPPOE_DIS_UID_LEN : tagLen);
 	} else {
 		/*
@@ -336,121 +203,22 @@ static PUidMacMappingEntry UidMacTableUpdate(
 		*/
 		pUIDStr = isServer ? pOutMac : pInMac;
 		tagLen = MAC_ADDR_LEN;
-		uIDAddByUs = 1;
-	}
-
-	for (i = 0; i < tagLen; i++)
-		hashVal ^= (pUIDStr[i] & 0xff);
-
-	hashIdx = hashVal % MAT_MAX_HASH_ENTRY_SUPPORT;
-
-	/*First, check if the hashIdx exists */
-	if (hashIdx < MAT_MAX_HASH_ENTRY_SUPPORT) {
-		pEntry = pPrev = pUidMacTable->uidHash[hashIdx];
-
-		while (pEntry) {
-			NdisGetSystemUpTime(&now);
-
-			/* Find the existed UidMac Mapping entry */
-			if (NdisEqualMemory(pUIDStr, pEntry->uIDStr, tagLen) && IS_EQUAL_MAC(pEntry->macAddr, pInMac)) {
-				/* Update info of this entry */
-				pEntry->isServer = isServer;
-				pEntry->uIDAddByUs = uIDAddByUs;
-				pEntry->lastTime = now;
-				return pEntry;
-			} else {
-				/* handle the age-out situation */
-				if (RTMP_TIME_AFTER(now, (pEntry->lastTime + MAT_TB_ENTRY_AGEOUT_TIME))) {
-					/* Remove the aged entry from the uidHash */
-					if (pEntry == pUidMacTable->uidHash[hashIdx]) {
-						pUidMacTable->uidHash[hashIdx] = pEntry->pNext;
-						pPrev = pUidMacTable->uidHash[hashIdx];
-					} else
-						pPrev->pNext = pEntry->pNext;
-
-					/*After remove this entry from macHash list and uidHash list, now free it! */
-					MATDBEntryFree(pMatCfg, (PUCHAR)pEntry);
-					pMatCfg->nodeCount--;
-					pEntry = (pPrev == NULL ? NULL : pPrev->pNext);
-				} else {
-					pPrev = pEntry;
-					pEntry = pEntry->pNext;
-				}
-			}
-		}
+		flags |= PPPOE_UID_FLAG_ADD_BY_US;
 	}
 
-	/* Allocate a new UidMacMapping entry and insert into the double-hash */
-	pNewEntry = (UidMacMappingEntry *)MATDBEntryAlloc(pMatCfg, sizeof(UidMacMappingEntry));
-
-	if (pNewEntry) {
-		NdisZeroMemory(pNewEntry, sizeof(UidMacMappingEntry));
-		pNewEntry->isServer = isServer;
-		pNewEntry->uIDAddByUs = uIDAddByUs;
-		NdisMoveMemory(pNewEntry->macAddr, pInMac, MAC_ADDR_LEN);
-		NdisMoveMemory(pNewEntry->uIDStr, pUIDStr, tagLen);
-		pNewEntry->pNext = NULL;
-		NdisGetSystemUpTime(&pNewEntry->lastTime);
-
-		/* Update mac-side hash link list */
-		if (pUidMacTable->uidHash[hashIdx] == NULL) {
-			/* Hash list is empty, directly assign it. */
-			pUidMacTable->uidHash[hashIdx] = pNewEntry;
-		} else {
-			/* Ok, we insert the new entry into the root of uidHash[hashIdx] */
-			pNewEntry->pNext = pUidMacTable->uidHash[hashIdx];
-			pUidMacTable->uidHash[hashIdx] = pNewEntry;
-		}
-
-		/*dumpUidMacTb(pMatCfg, hashIdx); //for debug */
-		pMatCfg->nodeCount++;
-		return pNewEntry;
-	}
+	if (isServer)
+		flags |= PPPOE_UID_FLAG_SERVER;
 
-	return NULL;
+	return MATDBUpdate(pMatCfg, MAT_DB_TYPE_PPPOE_UID, pUIDStr, (UCHAR)tagLen, pInMac, flags);
 }
 
 
-static PUidMacMappingEntry UidMacTableLookUp(
+static PMAT_DB_ENTRY UidMacTableLookUp(
 	IN MAT_STRUCT		*pMatCfg,
 	IN PUCHAR			pTagInfo,
 	IN UINT16			tagLen)
 {
-	UINT				hashIdx;
-	UINT16				len;
-	UCHAR				hashValue = 0;
-	UidMacMappingEntry	*pEntry = NULL;
-	UidMacMappingTable *pUidMacTable;
-	pUidMacTable = (UidMacMappingTable *)pMatCfg->MatTableSet.UidMacTable;
-
-	if ((!pUidMacTable) || (!pUidMacTable->valid))
-		return NULL;
-
-	/* Use hash to find out the location of that entry and get the Mac address. */
-	len = tagLen;
-
-	while (len)
-		hashValue ^= pTagInfo[--len];
-
-	hashIdx = hashValue % MAT_MAX_HASH_ENTRY_SUPPORT;
-	pEntry = pUidMacTable->uidHash[hashIdx];
-
-	while (pEntry) {
-		if (NdisEqualMemory(pEntry->uIDStr, pTagInfo, tagLen)) {
-			/*			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_TRACE,("%s(): dstMac=%02x:%02x:%02x:%02x:%02x:%02x for mapped dstIP(%d.%d.%d.%d)\n",
-								__func__, pEntry->macAddr[0],pEntry->macAddr[1],pEntry->macAddr[2],
-								pEntry->macAddr[3],pEntry->macAddr[4],pEntry->macAddr[5],
-								(ipAddr>>24) & 0xff, (ipAddr>>16) & 0xff, (ipAddr>>8) & 0xff, ipAddr & 0xff));
-			*/
-			/*Update the lastTime to prevent the aging before pDA processed! */
-			NdisGetSystemUpTime(&pEntry->lastTime);
-			return pEntry;
-		} else
-			pEntry = pEntry->pNext;
-	}
-
-	/* We didn't find any matched Mac address. */
-	return NULL;
+	return MATDBLookup(pMatCfg, MAT_DB_TYPE_PPPOE_UID, pTagInfo, (UCHAR)tagLen);
 }
 
 
@@ -459,28 +227,17 @@ static PUCHAR getInMacByOutMacFromSesMacTb(
 	IN PUCHAR outMac,
 	IN UINT16 sesID)
 {
-	UINT16				hashIdx;
-	SesMacMappingEntry *pEntry = NULL;
-	SesMacMappingTable *pSesMacTable;
-	pSesMacTable = (SesMacMappingTable *)pMatCfg->MatTableSet.SesMacTable;
+	PMAT_DB_ENTRY pEntry;
+	UCHAR key[PPPOE_SES_KEY_LEN];
 
-	if (!pSesMacTable->valid)
-		return NULL;
+	NdisMoveMemory(&key[0], &sesID, 2);
+	NdisMoveMemory(&key[2], outMac, MAC_ADDR_LEN);
+	pEntry = MATDBLookup(pMatCfg, MAT_DB_TYPE_PPPOE_SES, key, PPPOE_SES_KEY_LEN);
 
-	/* Use hash to find out the location of that entry and get the Mac address. */
-	hashIdx = sesID % MAT_MAX_HASH_ENTRY_SUPPORT;
-	pEntry = pSesMacTable->sesHash[hashIdx];
-
-	while (pEntry) {
-		if ((pEntry->sessionID == sesID) &&  IS_EQUAL_MAC(pEntry->outMacAddr, outMac)) {
-			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_TRACE, ("%s(): find it! dstMac=%02x:%02x:%02x:%02x:%02x:%02x\n",
-					 __func__, pEntry->inMacAddr[0], pEntry->inMacAddr[1], pEntry->inMacAddr[2],
-					 pEntry->inMacAddr[3], pEntry->inMacAddr[4], pEntry->inMacAddr[5]));
-			/*Update the lastTime to prevent the aging before pDA processed! */
-			NdisGetSystemUpTime(&pEntry->lastTime);
-			return pEntry->inMacAddr;
-		} else
-			pEntry = pEntry->pNext;
+	if (pEntry) {
+		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_TRACE, ("%s(): find it! dstMac=%02x:%02x:%02x:%02x:%02x:%02x\n",
+				 __func__, PRINT_MAC(pEntry->macAddr)));
+		return pEntry->macAddr;
 	}
 
 	/* We didn't find any matched Mac address, just return and didn't do any modification */
@@ -497,79 +254,11 @@ static NDIS_STATUS SesMacTableUpdate(
 	IN UINT16		sesID,
 	IN PUCHAR		outMacAddr)
 {
-	UINT16 hashIdx;
-	SesMacMappingEntry *pEntry, *pPrev, *pNewEntry;
-	SesMacMappingTable *pSesMacTable;
-	ULONG	now;
-	pSesMacTable = (SesMacMappingTable *)pMatCfg->MatTableSet.SesMacTable;
-
-	if ((!pSesMacTable) || (!pSesMacTable->valid))
-		return FALSE;
-
-	hashIdx = sesID % MAT_MAX_HASH_ENTRY_SUPPORT;
-	/*
-		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_TRACE,("%s():sesID=0x%04x,inMac=%02x%02x:%02x:%02x:%02x:%02x,
-				outMac=%02x:%02x:%02x:%02x:%02x:%02x\n", __func__, sesID,
-				inMacAddr[0],inMacAddr[1],inMacAddr[2],inMacAddr[3],inMacAddr[4],inMacAddr[5],
-				outMacAddr[0],outMacAddr[1],outMacAddr[2],outMacAddr[3],outMacAddr[4],outMacAddr[5]));
-	*/
-	pEntry = pPrev = pSesMacTable->sesHash[hashIdx];
-
-	while (pEntry) {
-		NdisGetSystemUpTime(&now);
-
-		/* Find a existed IP-MAC Mapping entry */
-		if ((sesID == pEntry->sessionID) &&
-			IS_EQUAL_MAC(pEntry->inMacAddr, inMacAddr) &&
-			IS_EQUAL_MAC(pEntry->outMacAddr, outMacAddr)) {
-			/* compare is useless. So we directly copy it into the entry. */
-			pEntry->lastTime = now;
-			return TRUE;
-		} else {
-			/* handle the age-out situation */
-			if (RTMP_TIME_AFTER(now, (pEntry->lastTime + PPPoE_SES_ENTRY_AGEOUT_TIME))) {
-				/* Remove the aged entry */
-				if (pEntry == pSesMacTable->sesHash[hashIdx]) {
-					pSesMacTable->sesHash[hashIdx] = pEntry->pNext;
-					pPrev = pSesMacTable->sesHash[hashIdx];
-				} else
-					pPrev->pNext = pEntry->pNext;
-
-				MATDBEntryFree(pMatCfg, (PUCHAR)pEntry);
-				pMatCfg->nodeCount--;
-				pEntry = (pPrev == NULL ? NULL : pPrev->pNext);
-			} else {
-				pPrev = pEntry;
-				pEntry = pEntry->pNext;
-			}
-		}
-	}
-
-	/* Allocate a new IPMacMapping entry and insert into the hash */
-	pNewEntry = (SesMacMappingEntry *)MATDBEntryAlloc(pMatCfg, sizeof(SesMacMappingEntry));
-
-	if (pNewEntry != NULL) {
-		pNewEntry->sessionID = sesID;
-		NdisMoveMemory(pNewEntry->inMacAddr, inMacAddr, MAC_ADDR_LEN);
-		NdisMoveMemory(pNewEntry->outMacAddr, outMacAddr, MAC_ADDR_LEN);
-		pNewEntry->pNext = NULL;
-		NdisGetSystemUpTime(&pNewEntry->lastTime);
-
-		if (pSesMacTable->sesHash[hashIdx] == NULL) {
-			/* Hash list is empty, directly assign it. */
-			pSesMacTable->sesHash[hashIdx] = pNewEntry;
-		} else {
-			/* Ok, we insert the new entry into the root of hash[hashIdx] */
-			pNewEntry->pNext = pSesMacTable->sesHash[hashIdx];
-			pSesMacTable->sesHash[hashIdx] = pNewEntry;
-		}
+	UCHAR key[PPPOE_SES_KEY_LEN];
 
-		/*dumpSesMacTb(pMatCfg, hashIdx); */
-		pMatCfg->nodeCount++;
-		return TRUE;
-	}
-
-	return FALSE;
+	NdisMoveMemory(&key[0], &sesID, 2);
+	NdisMoveMemory(&key[2], outMacAddr, MAC_ADDR_LEN);
+	return (MATDBUpdate(pMatCfg, MAT_DB_TYPE_PPPOE_SES, key, PPPOE_SES_KEY_LEN, inMacAddr, 0) != NULL) ? TRUE : FALSE;
 }
 
 
@@ -588,7 +277,7 @@ static PUCHAR MATProto_PPPoEDis_Rx(
 	UINT16 tagID, tagLen = 0;
 	UINT16 needUpdateSesTb = 0, sesID = 0, isPADT = 0;
 	UINT16 findTag = 0;
-	PUidMacMappingEntry pEntry = NULL;
+	PMAT_DB_ENTRY pEntry = NULL;
 	pData = pLayerHdr;
 
 	if (*(pData) != 0x11)
@@ -670,7 +359,7 @@ static PUCHAR MATProto_PPPoEDis_Rx(
 
 		/* Remove the AC-Cookie or host-uniq if we ever add the field for this session. */
 		if (pEntry) {
-			if (pEntry->uIDAddByUs) {
+			if (pEntry->flags & PPPOE_UID_FLAG_ADD_BY_US) {
 				PUCHAR tagHead, nextTagHead;
 				UINT removedTagLen, tailLen;
 				removedTagLen = 4 + tagLen; 	/*The total length tag ID/info we want to remove. */
@@ -724,7 +413,7 @@ static PUCHAR MATProto_PPPoEDis_Tx(
 	UINT16 tagID, tagLen = 0;
 	UINT16 isServer = 0, needUpdateSesTb = 0, sesID = 0;
 	UINT16 findTag = 0;
-	PUidMacMappingEntry pEntry = NULL;
+	PMAT_DB_ENTRY pEntry = NULL;
 	PUCHAR pPktHdr;
 	PNDIS_PACKET pModSkb = NULL;
 	pPktHdr = GET_OS_PKT_DATAPTR(pSkb);
@@ -829,14 +518,14 @@ static PUCHAR MATProto_PPPoEDis_Tx(
 			if (tailHead > pPPPPoETail)
 				tailHead = pPPPPoETail;
 
-			if (pEntry->isServer) {
+			if (pEntry->flags & PPPOE_UID_FLAG_SERVER) {
 				/*Append the AC-Cookie tag info in the tail of the pppoe packet. */
 				tailHead[0] = 0x01;
 				tailHead[1] = 0x04;
 				tailHead[2] = 0x00;
 				tailHead[3] = PPPOE_DIS_UID_LEN;
 				tailHead += 4;
-				NdisMoveMemory(tailHead, pEntry->uIDStr, PPPOE_DIS_UID_LEN);
+				NdisMoveMemory(tailHead, pEntry->key, PPPOE_DIS_UID_LEN);
 			} else {
 				/*Append the host-uniq tag info in the tail of the pppoe packet. */
 				tailHead[0] = 0x01;
@@ -844,7 +533,7 @@ static PUCHAR MATProto_PPPoEDis_Tx(
 				tailHead[2] = 0x00;
 				tailHead[3] = PPPOE_DIS_UID_LEN;
 				tailHead += 4;
-				NdisMoveMemory(tailHead, pEntry->uIDStr, PPPOE_DIS_UID_LEN);
+				NdisMoveMemory(tailHead, pEntry->key, PPPOE_DIS_UID_LEN);
 			}
 
 			*(UINT16 *)pPayloadLen = OS_HTONS(payloadLen + 4 + PPPOE_DIS_UID_LEN);
@@ -858,56 +547,6 @@ static PUCHAR MATProto_PPPoEDis_Tx(
 }
 
 
-/* PPPoE discovery stage init function */
-static NDIS_STATUS MATProto_PPPoEDis_Init(
-	IN MAT_STRUCT	*pMatCfg)
-{
-	UidMacMappingTable *pUidMacTable;
-	SesMacMappingTable *pSesMacTable;
-	pUidMacTable = (UidMacMappingTable *)pMatCfg->MatTableSet.UidMacTable;
-
-	if (!pUidMacTable) {
-		os_alloc_mem_suspend(NULL, (UCHAR **)&(pMatCfg->MatTableSet.UidMacTable), sizeof(UidMacMappingTable));
-
-		if (pMatCfg->MatTableSet.UidMacTable) {
-			pUidMacTable = (UidMacMappingTable *)pMatCfg->MatTableSet.UidMacTable;
-			NdisZeroMemory(pUidMacTable, sizeof(UidMacMappingTable));
-		} else {
-			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_ERROR, ("MATProto_PPPoEDis_Init(): Allocate memory for UidMacTable failed!\n"));
-			return FALSE;
-		}
-	}
-
-	pUidMacTable->valid = TRUE;
-	pSesMacTable = (SesMacMappingTable *)pMatCfg->MatTableSet.SesMacTable;
-
-	if (!pSesMacTable) {
-		os_alloc_mem_suspend(NULL, (UCHAR **)&(pMatCfg->MatTableSet.SesMacTable), sizeof(SesMacMappingTable));
-
-		if (pMatCfg->MatTableSet.SesMacTable) {
-			pSesMacTable = (SesMacMappingTable *)pMatCfg->MatTableSet.SesMacTable;
-			NdisZeroMemory(pSesMacTable, sizeof(SesMacMappingTable));
-		} else {
-			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_ERROR, ("MATProto_PPPoEDis_Init(): Allocate memory for SesMacTable failed!\n"));
-			return FALSE;
-		}
-	}
-
-	pSesMacTable->valid = TRUE;
-	return TRUE;
-}
-
-
-/* PPPoE discovery stage exit function */
-static NDIS_STATUS MATProto_PPPoEDis_Exit(
-	IN MAT_STRUCT *pMatCfg)
-{
-	UidMacTable_RemoveAll(pMatCfg);
-	SesMacTable_RemoveAll(pMatCfg);
-	return TRUE;
-}
-
-
 /* PPPoE Session stage Rx handler
 	When we receive a ppp pakcet, first check if the srcMac is a PPPoE server or not.
 		if it's a server, check the session ID of specific PPPoEServeryEntry and find out the
@@ -948,19 +587,5 @@ static PUCHAR MATProto_PPPoESes_Tx(
 }
 
 
-/* PPPoE session stage init function */
-static NDIS_STATUS MATProto_PPPoESes_Init(
-	IN MAT_STRUCT	*pMatStruct)
-{
-	return TRUE;
-}
-
-/* PPPoE session stage exit function */
-static NDIS_STATUS MATProto_PPPoESes_Exit(
-	IN MAT_STRUCT	*pMatStruct)
-{
-	return TRUE;
-}
-
 #endif /* MAT_SUPPORT */
 
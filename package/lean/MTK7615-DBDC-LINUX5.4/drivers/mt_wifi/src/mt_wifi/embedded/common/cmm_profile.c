@@ -537,6 +537,199 @@ RTMP_STRING *RTMPFindSection(RTMP_STRING *buffer)
 		return NULL;
 }
 
+/*
+	Key index of the profile that is being applied. RTMPSetProfileParameters
+	and the readers it calls look up several hundred keys in one immutable
+	buffer, so the buffer is parsed once into a hash of its key lines instead
+	of scanning it again for every key. Lookups in any other buffer still go
+	through the plain string search.
+*/
+#define PROFILE_INDEX_HASH_SIZE	256
+
+typedef struct _PROFILE_INDEX_ENTRY {
+	UINT32 nl;		/* offset of the '\n' that starts the line */
+	UINT32 key;		/* offset of the key */
+	UINT32 value;	/* offset of the value behind the '=' */
+	UINT32 value_len;
+	UINT32 key_len;
+	INT next;		/* next key in the same hash bucket */
+	INT dup;		/* next line with the same key */
+} PROFILE_INDEX_ENTRY;
+
+typedef struct _PROFILE_INDEX {
+	RTMP_STRING *buffer;
+	UINT32 base;	/* offset of the section the lookups start at */
+	INT entry_num;
+	PROFILE_INDEX_ENTRY *entry;
+	INT bucket[PROFILE_INDEX_HASH_SIZE];
+} PROFILE_INDEX;
+
+static PROFILE_INDEX profile_index;
+
+static UINT32 profile_index_hash(RTMP_STRING *key, UINT32 len)
+{
+	UINT32 hash = 5381;
+
+	while (len--)
+		hash = (hash * 33) ^ (UCHAR)*key++;
+
+	return hash & (PROFILE_INDEX_HASH_SIZE - 1);
+}
+
+static INT profile_index_find(PROFILE_INDEX *idx, RTMP_STRING *key, UINT32 len)
+{
+	PROFILE_INDEX_ENTRY *e;
+	INT i;
+
+	for (i = idx->bucket[profile_index_hash(key, len)]; i >= 0; i = e->next) {
+		e = &idx->entry[i];
+
+		if (e->key_len == len && !memcmp(idx->buffer + e->key, key, len))
+			return i;
+	}
+
+	return -1;
+}
+
+static VOID profile_copy_value(
+	RTMP_STRING *dest,
+	INT destsize,
+	RTMP_STRING *value,
+	UINT32 len,
+	BOOLEAN bTrimSpace)
+{
+	/*trim special characters, i.e.,  TAB or space*/
+	while (len > 0 && (((*value == ' ') && bTrimSpace) || (*value == '\t'))) {
+		value++;
+		len--;
+	}
+
+	memset(dest, 0x00, destsize);
+	NdisMoveMemory(dest, value, (len >= destsize) ? destsize : len);
+}
+
+/*
+    ========================================================================
+
+    Routine Description:
+	Build the key index for a profile buffer.
+
+    Arguments:
+	buffer		Pointer to the profile, it must not be modified until
+			RTMPProfileIndexRelease is called
+
+    Return Value:
+	None
+
+    Note:
+	Profiles are applied one at a time from the interface open path. If
+	another profile is still indexed, or memory is short, nothing is done
+	and lookups fall back to scanning the buffer.
+    ========================================================================
+*/
+VOID RTMPProfileIndexBuild(RTMP_STRING *buffer)
+{
+	PROFILE_INDEX *idx = &profile_index;
+	PROFILE_INDEX_ENTRY *e;
+	RTMP_STRING *section, *ptr, *line, *end, *eq;
+	UINT32 hash;
+	INT num = 0, i;
+
+	if (idx->buffer != NULL)
+		return;
+
+	section = RTMPFindSection(buffer);
+
+	if (section == NULL)
+		return;
+
+	/* keys are only matched at the start of a line inside the section */
+	for (ptr = strchr(section, '\n'); ptr; ptr = strchr(ptr + 1, '\n'))
+		num++;
+
+	if (num == 0)
+		return;
+
+	os_alloc_mem(NULL, (UCHAR **)&idx->entry, num * sizeof(PROFILE_INDEX_ENTRY));
+
+	if (idx->entry == NULL)
+		return;
+
+	for (i = 0; i < PROFILE_INDEX_HASH_SIZE; i++)
+		idx->bucket[i] = -1;
+
+	idx->buffer = buffer;
+	idx->base = section - buffer;
+	idx->entry_num = 0;
+
+	for (ptr = strchr(section, '\n'); ptr; ptr = strchr(line, '\n')) {
+		line = ptr + 1;
+		end = strchr(line, '\n');
+
+		if (end == NULL)
+			end = line + strlen(line);
+
+		eq = memchr(line, '=', end - line);
+
+		if (eq == NULL)
+			continue;
+
+		e = &idx->entry[idx->entry_num];
+		e->nl = ptr - buffer;
+		e->key = line - buffer;
+		e->key_len = eq - line;
+		e->value = eq + 1 - buffer;
+		e->value_len = end - (eq + 1);
+		e->next = -1;
+		e->dup = -1;
+
+		/* a repeated key is chained behind its first line in file order */
+		i = profile_index_find(idx, line, e->key_len);
+
+		if (i >= 0) {
+			while (idx->entry[i].dup >= 0)
+				i = idx->entry[i].dup;
+
+			idx->entry[i].dup = idx->entry_num;
+		} else {
+			hash = profile_index_hash(line, e->key_len);
+			e->next = idx->bucket[hash];
+			idx->bucket[hash] = idx->entry_num;
+		}
+
+		idx->entry_num++;
+	}
+
+	MTWF_LOG(DBG_CAT_CFG, DBG_SUBCAT_ALL, DBG_LVL_TRACE,
+			 ("%s: %d profile keys indexed\n", __func__, idx->entry_num));
+}
+
+/*
+    ========================================================================
+
+    Routine Description:
+	Drop the key index built for a profile buffer.
+
+    Arguments:
+	buffer		Pointer to the profile passed to RTMPProfileIndexBuild
+
+    Return Value:
+	None
+    ========================================================================
+*/
+VOID RTMPProfileIndexRelease(RTMP_STRING *buffer)
+{
+	PROFILE_INDEX *idx = &profile_index;
+
+	if (buffer == NULL || idx->buffer != buffer)
+		return;
+
+	idx->buffer = NULL;
+	os_free_mem(idx->entry);
+	idx->entry = NULL;
+	idx->entry_num = 0;
+}
+
 /*
     ========================================================================
 
@@ -572,6 +765,19 @@ INT RTMPGetKeyParameter(
 	RTMP_STRING *offset = NULL;
 	INT  len, keyLen;
 	keyLen = strlen(key);
+
+	if (buffer == profile_index.buffer) {
+		PROFILE_INDEX_ENTRY *e;
+		INT i = profile_index_find(&profile_index, key, keyLen);
+
+		if (i < 0)
+			return FALSE;
+
+		e = &profile_index.entry[i];
+		profile_copy_value(dest, destsize, buffer + e->value, e->value_len, bTrimSpace);
+		return TRUE;
+	}
+
 	os_alloc_mem(NULL, (PUCHAR *)&pMemBuf, MAX_PARAM_BUFFER_SIZE  * 2);
 
 	if (pMemBuf == NULL)
@@ -665,6 +871,7 @@ INT RTMPAddKeyParameter(
 {
 	UINT len = strlen(buffer);
 	CHAR *ptr = buffer + len;
+	RTMPProfileIndexRelease(buffer);
 	snprintf(ptr, 300, "%s=%s\n", key, value);
 	return TRUE;
 }
@@ -707,6 +914,7 @@ INT RTMPSetKeyParameter(
 	INT len;
 	keyLen = strlen(key);
 	temp_buf1 = buf;
+	RTMPProfileIndexRelease(buffer);
 
 	/*find section*/
 	offset = RTMPFindSection(buffer);
@@ -787,6 +995,27 @@ INT RTMPGetKeyParameterWithOffset(
 	if (*end_offset >= MAX_INI_BUFFER_SIZE)
 		return FALSE;
 
+	/* lines in front of the indexed section still need the plain search */
+	if (buffer == profile_index.buffer &&
+		(*end_offset == 0 || *end_offset >= profile_index.base)) {
+		PROFILE_INDEX_ENTRY *e = NULL;
+		INT i = profile_index_find(&profile_index, key, strlen(key));
+
+		for (; i >= 0; i = profile_index.entry[i].dup) {
+			if (profile_index.entry[i].nl >= *end_offset) {
+				e = &profile_index.entry[i];
+				break;
+			}
+		}
+
+		if (e == NULL)
+			return FALSE;
+
+		*end_offset = e->value + e->value_len;
+		profile_copy_value(dest, destsize, buffer + e->value, e->value_len, bTrimSpace);
+		return TRUE;
+	}
+
 	os_alloc_mem(NULL, (PUCHAR *)&temp_buf1, MAX_PARAM_BUFFER_SIZE);
 
 	if (temp_buf1 == NULL)
@@ -3447,7 +3676,7 @@ NDIS_STATUS	RTMPSetPreProfileParameters(
 	return NDIS_STATUS_SUCCESS;
 }
 
-NDIS_STATUS	RTMPSetProfileParameters(
+static NDIS_STATUS	rtmp_set_profile_parameters(
 	IN RTMP_ADAPTER *pAd,
 	IN RTMP_STRING *pBuffer)
 {
@@ -5724,6 +5953,15 @@ NDIS_STATUS	RTMPSetProfileParameters(
 #ifdef APCLI_SUPPORT
 			rtmp_read_ap_client_from_file(pAd, tmpbuf, pBuffer);
 #endif /* APCLI_SUPPORT */
+#ifdef MAT_SUPPORT
+
+			/* MatHashSize, buckets of the MAT address table, power of 2 */
+			if (RTMPGetKeyParameter("MatHashSize", tmpbuf, 10, pBuffer, TRUE)) {
+				pAd->MatCfg.DBHashSize = (UINT32)os_str_tol(tmpbuf, 0, 10);
+				MTWF_LOG(DBG_CAT_CFG, DBG_SUBCAT_ALL, DBG_LVL_TRACE, ("MatHashSize=%d\n", pAd->MatCfg.DBHashSize));
+			}
+
+#endif /* MAT_SUPPORT */
 #ifdef IGMP_SNOOP_SUPPORT
 			/* Igmp Snooping information*/
 			rtmp_read_igmp_snoop_from_file(pAd, tmpbuf, pBuffer);
@@ -6679,6 +6917,18 @@ NDIS_STATUS	RTMPSetProfileParameters(
 	return NDIS_STATUS_SUCCESS;
 }
 
+NDIS_STATUS	RTMPSetProfileParameters(
+	IN RTMP_ADAPTER *pAd,
+	IN RTMP_STRING *pBuffer)
+{
+	NDIS_STATUS status;
+
+	RTMPProfileIndexBuild(pBuffer);
+	status = rtmp_set_profile_parameters(pAd, pBuffer);
+	RTMPProfileIndexRelease(pBuffer);
+	return status;
+}
+
 #ifdef WSC_INCLUDED
 void rtmp_read_wsc_user_parms(
 	PWSC_CTRL pWscControl,
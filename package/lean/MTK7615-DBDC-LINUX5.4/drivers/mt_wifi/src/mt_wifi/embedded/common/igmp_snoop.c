@@ -15,62 +15,212 @@ UINT16 IPv6MulticastFilterExclued[] = {
 #define IPV6_MULTICAST_FILTER_EXCLUED_SIZE  \
 	(sizeof(IPv6MulticastFilterExclued) / sizeof(UINT16))
 
-static inline void initFreeEntryList(
+static VOID IGMPTableDisplay(
+	IN PRTMP_ADAPTER pAd);
+
+static BOOLEAN isIgmpMacAddr(
+	IN PUCHAR pMacAddr);
+
+static VOID InsertIgmpMember(
+	IN PMULTICAST_FILTER_TABLE_ENTRY pEntry,
+	IN UINT16 Wcid,
+	IN MulticastFilterEntryType type);
+
+static VOID DeleteIgmpMember(
+	IN PMULTICAST_FILTER_TABLE_ENTRY pEntry,
+	IN UINT16 Wcid);
+
+#ifdef A4_CONN
+/* Whether member is present on MWDS link */
+static BOOLEAN isMemberOnMWDSLink(
+	IN PMULTICAST_FILTER_TABLE_ENTRY pEntry,
+	IN UINT16 Wcid);
+#endif
+
+/*
+	The hash chains are read under RCU from the TX path, all changes are made
+	with MulticastFilterTabLock held. An unlinked entry keeps its pNext for
+	readers still walking it and its slot is not reused before a grace period.
+*/
+static VOID MulticastFilterEntryRcuFree(
+	IN RTMP_OS_RCU_HEAD *pRcu)
+{
+	PMULTICAST_FILTER_TABLE_ENTRY pEntry = container_of(pRcu, MULTICAST_FILTER_TABLE_ENTRY, rcu);
+
+	pEntry->Retired = FALSE;
+}
+
+/*
+	Static members set by iwpriv for a station that is not associated yet
+	have no WCID. They wait here, keyed by MAC, until the station associates
+	or their group goes away. All of these run with MulticastFilterTabLock held.
+*/
+static BOOLEAN MulticastFilterPendingMemberAdd(
 	IN PMULTICAST_FILTER_TABLE pMulticastFilterTable,
-	IN PLIST_HEADER pList)
+	IN PUCHAR pGrpId,
+	IN PNET_DEV dev,
+	IN PUCHAR pMemberAddr,
+	IN UINT8 type)
 {
-	int i;
+	PMULTICAST_FILTER_PENDING_MEMBER pPending, pFree = NULL;
+	INT i;
 
-	for (i = 0; i < FREE_MEMBER_POOL_SIZE; i++)
-		insertTailList(pList, (RT_LIST_ENTRY *)&(pMulticastFilterTable->freeMemberPool[i]));
+	for (i = 0; i < MULTICAST_PENDING_MEMBER_SIZE; i++) {
+		pPending = &pMulticastFilterTable->PendingMember[i];
 
-	return;
+		if (!pPending->Valid) {
+			if (pFree == NULL)
+				pFree = pPending;
+			continue;
+		}
+
+		if ((pPending->net_dev == dev)
+			&& MAC_ADDR_EQUAL(pPending->GrpId, pGrpId)
+			&& MAC_ADDR_EQUAL(pPending->MemberAddr, pMemberAddr)) {
+			pPending->type = type;
+			return TRUE;
+		}
+	}
+
+	if (pFree == NULL) {
+		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_ERROR, ("%s pending member list full. max-entries = %d\n",
+				 __func__, MULTICAST_PENDING_MEMBER_SIZE));
+		return FALSE;
+	}
+
+	COPY_MAC_ADDR(pFree->GrpId, pGrpId);
+	COPY_MAC_ADDR(pFree->MemberAddr, pMemberAddr);
+	pFree->net_dev = dev;
+	pFree->type = type;
+	pFree->Valid = TRUE;
+	MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_TRACE, ("%s Member=%02x:%02x:%02x:%02x:%02x:%02x waits for association\n",
+			 __func__, PRINT_MAC(pMemberAddr)));
+	return TRUE;
 }
 
-static inline PMEMBER_ENTRY AllocaGrpMemberEntry(
-	IN PMULTICAST_FILTER_TABLE pMulticastFilterTable)
+/* pMemberAddr NULL drops every pending member of the group */
+static VOID MulticastFilterPendingMemberDel(
+	IN PMULTICAST_FILTER_TABLE pMulticastFilterTable,
+	IN PUCHAR pGrpId,
+	IN PNET_DEV dev,
+	IN PUCHAR pMemberAddr)
 {
-	PMEMBER_ENTRY pMemberEntry;
-	RTMP_SEM_LOCK(&pMulticastFilterTable->FreeMemberPoolTabLock);
-	pMemberEntry = (PMEMBER_ENTRY)removeHeadList(&pMulticastFilterTable->freeEntryList);
-	RTMP_SEM_UNLOCK(&pMulticastFilterTable->FreeMemberPoolTabLock);
-	return (PMEMBER_ENTRY)pMemberEntry;
+	PMULTICAST_FILTER_PENDING_MEMBER pPending;
+	INT i;
+
+	for (i = 0; i < MULTICAST_PENDING_MEMBER_SIZE; i++) {
+		pPending = &pMulticastFilterTable->PendingMember[i];
+
+		if (pPending->Valid && (pPending->net_dev == dev)
+			&& MAC_ADDR_EQUAL(pPending->GrpId, pGrpId)
+			&& ((pMemberAddr == NULL) || MAC_ADDR_EQUAL(pPending->MemberAddr, pMemberAddr)))
+			pPending->Valid = FALSE;
+	}
 }
 
-static inline VOID FreeGrpMemberEntry(
+static UINT16 MulticastFilterPendingMemberCnt(
 	IN PMULTICAST_FILTER_TABLE pMulticastFilterTable,
-	IN PMEMBER_ENTRY pEntry)
+	IN PUCHAR pGrpId,
+	IN PNET_DEV dev)
 {
-	RTMP_SEM_LOCK(&pMulticastFilterTable->FreeMemberPoolTabLock);
-	insertTailList(&pMulticastFilterTable->freeEntryList, (RT_LIST_ENTRY *)pEntry);
-	RTMP_SEM_UNLOCK(&pMulticastFilterTable->FreeMemberPoolTabLock);
-}
+	PMULTICAST_FILTER_PENDING_MEMBER pPending;
+	UINT16 Cnt = 0;
+	INT i;
 
-static VOID IGMPTableDisplay(
-	IN PRTMP_ADAPTER pAd);
+	for (i = 0; i < MULTICAST_PENDING_MEMBER_SIZE; i++) {
+		pPending = &pMulticastFilterTable->PendingMember[i];
 
-static BOOLEAN isIgmpMacAddr(
-	IN PUCHAR pMacAddr);
+		if (pPending->Valid && (pPending->net_dev == dev)
+			&& MAC_ADDR_EQUAL(pPending->GrpId, pGrpId))
+			Cnt++;
+	}
 
-static VOID InsertIgmpMember(
-	IN PMULTICAST_FILTER_TABLE pMulticastFilterTable,
-	IN PLIST_HEADER pList,
+	return Cnt;
+}
+
+/* whether pMemberAddr is the station associated at Wcid, iwpriv passes 0 for one that is not */
+static inline BOOLEAN MulticastFilterMemberAssociated(
+	IN PRTMP_ADAPTER pAd,
 	IN PUCHAR pMemberAddr,
-	IN MulticastFilterEntryType type);
+	IN UINT16 Wcid)
+{
+	return (VALID_UCAST_ENTRY_WCID(pAd, Wcid)
+			&& IS_VALID_ENTRY(&pAd->MacTab.Content[Wcid])
+			&& MAC_ADDR_EQUAL(pAd->MacTab.Content[Wcid].Addr, pMemberAddr)) ? TRUE : FALSE;
+}
 
-static VOID DeleteIgmpMember(
+static VOID MulticastFilterEntryUnlink(
 	IN PMULTICAST_FILTER_TABLE pMulticastFilterTable,
-	IN PLIST_HEADER pList,
-	IN PUCHAR pMemberAddr);
+	IN PMULTICAST_FILTER_TABLE_ENTRY pEntry,
+	IN PMULTICAST_FILTER_TABLE_ENTRY pPrevEntry)
+{
+	USHORT HashIdx = MULTICAST_ADDR_HASH_INDEX(pEntry->Addr);
 
-static VOID DeleteIgmpMemberList(
+	if (pPrevEntry == NULL)
+		RTMP_RCU_ASSIGN_POINTER(pMulticastFilterTable->Hash[HashIdx], pEntry->pNext);
+	else
+		RTMP_RCU_ASSIGN_POINTER(pPrevEntry->pNext, pEntry->pNext);
+
+	pEntry->Valid = FALSE;
+	pEntry->Retired = TRUE;
+	pMulticastFilterTable->Size--;
+	MulticastFilterPendingMemberDel(pMulticastFilterTable, pEntry->Addr, pEntry->net_dev, NULL);
+	RTMP_CALL_RCU(&pEntry->rcu, MulticastFilterEntryRcuFree);
+}
+
+static inline BOOLEAN MulticastFilterEntryAged(
+	IN PMULTICAST_FILTER_TABLE_ENTRY pEntry,
+	IN ULONG Now)
+{
+	return ((pEntry->type == MCAT_FILTER_DYNAMIC)
+			&& RTMP_TIME_AFTER(Now, pEntry->lastTime +
+#ifdef IGMP_TVM_SUPPORT
+			pEntry->AgeOutTime
+#else
+			IGMPMAC_TB_ENTRY_AGEOUT_TIME
+#endif /* IGMP_TVM_SUPPORT */
+			)) ? TRUE : FALSE;
+}
+
+/* Find the group with MulticastFilterTabLock held, ppPrevEntry gets its hash predecessor */
+static PMULTICAST_FILTER_TABLE_ENTRY MulticastFilterEntryFind(
 	IN PMULTICAST_FILTER_TABLE pMulticastFilterTable,
-	IN PLIST_HEADER pList);
+	IN PUCHAR pAddr,
+	IN PNET_DEV dev,
+	OUT PMULTICAST_FILTER_TABLE_ENTRY *ppPrevEntry)
+{
+	PMULTICAST_FILTER_TABLE_ENTRY pEntry, pPrevEntry = NULL;
 
-#ifdef A4_CONN
-/* Whether member is present on MWDS link */
-BOOLEAN isMemberOnMWDSLink(VOID *prMemberEntry);
-#endif
+	pEntry = pMulticastFilterTable->Hash[MULTICAST_ADDR_HASH_INDEX(pAddr)];
+
+	while (pEntry) {
+		if ((pEntry->net_dev == dev)
+			&& MAC_ADDR_EQUAL(pEntry->Addr, pAddr))
+			break;
+
+		pPrevEntry = pEntry;
+		pEntry = pEntry->pNext;
+	}
+
+	if (ppPrevEntry)
+		*ppPrevEntry = pPrevEntry;
+
+	return pEntry;
+}
+
+#ifdef IGMP_TVM_SUPPORT
+static UINT8 MulticastFilterMemberTVMode(
+	IN PMULTICAST_FILTER_TABLE_ENTRY pEntry,
+	IN UINT16 Wcid)
+{
+	if (MCAST_MEMBER_TEST(pEntry->TVMEnableMap, Wcid))
+		return IGMP_TVM_IE_MODE_ENABLE;
+	else if (MCAST_MEMBER_TEST(pEntry->TVMAutoMap, Wcid))
+		return IGMP_TVM_IE_MODE_AUTO;
+
+	return IGMP_TVM_IE_MODE_DISABLE;
+}
+#endif /* IGMP_TVM_SUPPORT */
 
 
 /*
@@ -100,9 +250,6 @@ VOID MulticastFilterTableInit(
 
 	NdisZeroMemory(*ppMulticastFilterTable, sizeof(MULTICAST_FILTER_TABLE));
 	NdisAllocateSpinLock(pAd, &((*ppMulticastFilterTable)->MulticastFilterTabLock));
-	NdisAllocateSpinLock(pAd, &((*ppMulticastFilterTable)->FreeMemberPoolTabLock));
-	initList(&((*ppMulticastFilterTable)->freeEntryList));
-	initFreeEntryList(*ppMulticastFilterTable, &((*ppMulticastFilterTable)->freeEntryList));
 
 #ifdef IGMP_TVM_SUPPORT
 	for (i = 0; i < MAX_LEN_OF_MULTICAST_FILTER_TABLE; i++) {
@@ -121,19 +268,23 @@ VOID MulticastFilterTableInit(
 VOID MultiCastFilterTableReset(RTMP_ADAPTER *pAd,
 							   IN PMULTICAST_FILTER_TABLE * ppMulticastFilterTable)
 {
+	PMULTICAST_FILTER_TABLE pMulticastFilterTable = *ppMulticastFilterTable;
+
 	if (IS_ASIC_CAP(pAd, fASIC_CAP_MCU_OFFLOAD)) {
 		return;
 	}
 
-	if (*ppMulticastFilterTable == NULL) {
+	if (pMulticastFilterTable == NULL) {
 		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_ERROR, ("%s Multicase filter table is not ready.\n", __func__));
 		return;
 	}
 
-	NdisFreeSpinLock(&((*ppMulticastFilterTable)->FreeMemberPoolTabLock));
-	NdisFreeSpinLock(&((*ppMulticastFilterTable)->MulticastFilterTabLock));
-	os_free_mem(*ppMulticastFilterTable);
+	/* wait for lock-free readers and pending entry releases before freeing the table */
 	*ppMulticastFilterTable = NULL;
+	RTMP_SYNCHRONIZE_RCU();
+	RTMP_RCU_BARRIER();
+	NdisFreeSpinLock(&pMulticastFilterTable->MulticastFilterTabLock);
+	os_free_mem(pMulticastFilterTable);
 }
 
 /*
@@ -166,21 +317,30 @@ static VOID IGMPTableDisplay(
 	for (i = 0; i < MAX_LEN_OF_MULTICAST_FILTER_TABLE; i++) {
 		/* pick up the first available vacancy */
 		if (pMulticastFilterTable->Content[i].Valid == TRUE) {
-			PMEMBER_ENTRY pMemberEntry = NULL;
+			UINT16 Wcid;
 			pEntry = &pMulticastFilterTable->Content[i];
 			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_OFF, ("IF(%s) entry #%d, type=%s, GrpId=(%02x:%02x:%02x:%02x:%02x:%02x) memberCnt=%d\n",
 					 RTMP_OS_NETDEV_GET_DEVNAME(pEntry->net_dev), i, (pEntry->type == 0 ? "static" : "dynamic"),
-					 PRINT_MAC(pEntry->Addr), IgmpMemberCnt(&pEntry->MemberList)));
-			pMemberEntry = (PMEMBER_ENTRY)pEntry->MemberList.pHead;
+					 PRINT_MAC(pEntry->Addr), IgmpMemberCnt(pEntry)));
 
-			while (pMemberEntry) {
-				MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_OFF, ("member mac=(%02x:%02x:%02x:%02x:%02x:%02x)\n",
-						 PRINT_MAC(pMemberEntry->Addr)));
-				pMemberEntry = pMemberEntry->pNext;
+			for (Wcid = 0; Wcid < MAX_LEN_OF_MAC_TABLE; Wcid++) {
+				if (!MCAST_MEMBER_TEST(pEntry->MemberMap, Wcid))
+					continue;
+
+				MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_OFF, ("member wcid=%d mac=(%02x:%02x:%02x:%02x:%02x:%02x)\n",
+						 Wcid, PRINT_MAC(pAd->MacTab.Content[Wcid].Addr)));
 			}
 		}
 	}
 
+	for (i = 0; i < MULTICAST_PENDING_MEMBER_SIZE; i++) {
+		PMULTICAST_FILTER_PENDING_MEMBER pPending = &pMulticastFilterTable->PendingMember[i];
+
+		if (pPending->Valid)
+			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_OFF, ("IF(%s) GrpId=(%02x:%02x:%02x:%02x:%02x:%02x) pending member mac=(%02x:%02x:%02x:%02x:%02x:%02x)\n",
+					 RTMP_OS_NETDEV_GET_DEVNAME(pPending->net_dev), PRINT_MAC(pPending->GrpId), PRINT_MAC(pPending->MemberAddr)));
+	}
+
 	RTMP_SEM_UNLOCK(&pMulticastFilterTable->MulticastFilterTabLock);
 	return;
 }
@@ -202,8 +362,10 @@ BOOLEAN MulticastFilterTableInsertEntry(
 {
 	UCHAR HashIdx;
 	int i;
-	MULTICAST_FILTER_TABLE_ENTRY *pEntry = NULL, *pCurrEntry, *pPrevEntry;
-	PMEMBER_ENTRY pMemberEntry;
+	BOOLEAN Result = TRUE;
+	BOOLEAN bPending;
+	ULONG Now;
+	MULTICAST_FILTER_TABLE_ENTRY *pEntry = NULL, *pCurrEntry;
 	PMULTICAST_FILTER_TABLE pMulticastFilterTable = pAd->pMulticastFilterTable;
 #ifdef IGMP_TVM_SUPPORT
 	UINT32 AgeOutTime = IGMPMAC_TB_ENTRY_AGEOUT_TIME;
@@ -215,10 +377,16 @@ BOOLEAN MulticastFilterTableInsertEntry(
 		return FALSE;
 	}
 
-	/* if FULL, return */
-	if (pMulticastFilterTable->Size >= MAX_LEN_OF_MULTICAST_FILTER_TABLE) {
-		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_ERROR, ("%s Multicase filter table full. max-entries = %d\n",
-				 __func__, MAX_LEN_OF_MULTICAST_FILTER_TABLE));
+	/*
+		members are kept by WCID. A static member that is not associated yet
+		waits in the pending list, a dynamic one comes from an associated station.
+	*/
+	bPending = ((pMemberAddr != NULL)
+				&& ((type & GROUP_ENTRY_TYPE_BITMASK) == MCAT_FILTER_STATIC)
+				&& !MulticastFilterMemberAssociated(pAd, pMemberAddr, WlanIndex)) ? TRUE : FALSE;
+
+	if ((pMemberAddr != NULL) && !bPending && !VALID_UCAST_ENTRY_WCID(pAd, WlanIndex)) {
+		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_ERROR, ("%s: invalid member wcid(%d).\n", __func__, WlanIndex));
 		return FALSE;
 	}
 
@@ -229,122 +397,98 @@ BOOLEAN MulticastFilterTableInsertEntry(
 	}
 #endif /* IGMP_TVM_SUPPORT */
 
-	/* check the rule is in table already or not. */
-	pEntry = MulticastFilterTableLookup(pMulticastFilterTable, pGrpId, dev);
-	if (pEntry) {
-		/* doesn't indicate member mac address. */
-		if (pMemberAddr == NULL)
-			return FALSE;
+	NdisGetSystemUpTime(&Now);
+	RTMP_SEM_LOCK(&pMulticastFilterTable->MulticastFilterTabLock);
 
-		pMemberEntry = (PMEMBER_ENTRY)pEntry->MemberList.pHead;
+	do {
+		/* check the rule is in table already or not. */
+		pEntry = MulticastFilterEntryFind(pMulticastFilterTable, pGrpId, dev, NULL);
 
-		while (pMemberEntry) {
-			if (MAC_ADDR_EQUAL(pMemberAddr, pMemberEntry->Addr)) {
-				MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_TRACE, ("%s: already in Members list.\n", __func__));
-				return FALSE;
-			}
+		if (pEntry) {
+			pEntry->lastTime = Now;
 
-			pMemberEntry = pMemberEntry->pNext;
-		}
-	}
+			/* doesn't indicate member mac address. */
+			if (pMemberAddr == NULL) {
+				Result = FALSE;
+				break;
+			}
 
-	RTMP_SEM_LOCK(&pMulticastFilterTable->MulticastFilterTabLock);
+			if (bPending) {
+				Result = MulticastFilterPendingMemberAdd(pMulticastFilterTable, pGrpId, dev, pMemberAddr, type);
+				break;
+			}
 
-	do {
-		ULONG Now;
+			if (MCAST_MEMBER_TEST(pEntry->MemberMap, WlanIndex)) {
+				MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_TRACE, ("%s: already in Members list.\n", __func__));
+				Result = FALSE;
+				break;
+			}
 
-		/* the multicast entry already exist but doesn't include the member yet. */
-		if (pEntry != NULL && pMemberAddr != NULL) {
+			/* the multicast entry already exist but doesn't include the member yet. */
 #ifdef IGMP_TVM_SUPPORT
 			pEntry->AgeOutTime = AgeOutTime;
 #endif /* IGMP_TVM_SUPPORT */
-			InsertIgmpMember(pMulticastFilterTable, &pEntry->MemberList, pMemberAddr, type);
+			InsertIgmpMember(pEntry, WlanIndex, type);
 			break;
 		}
 
-		/* allocate one MAC entry */
+		/* if FULL, return */
+		if (pMulticastFilterTable->Size >= MAX_LEN_OF_MULTICAST_FILTER_TABLE) {
+			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_ERROR, ("%s Multicase filter table full. max-entries = %d\n",
+					 __func__, MAX_LEN_OF_MULTICAST_FILTER_TABLE));
+			Result = FALSE;
+			break;
+		}
+
+		/* pick up the first available vacancy, retired slots may still be seen by readers */
 		for (i = 0; i < MAX_LEN_OF_MULTICAST_FILTER_TABLE; i++) {
-			/* pick up the first available vacancy */
 			pEntry = &pMulticastFilterTable->Content[i];
-			NdisGetSystemUpTime(&Now);
 
-			if ((pEntry->Valid == TRUE) && (pEntry->type == MCAT_FILTER_DYNAMIC)
-				&& RTMP_TIME_AFTER(Now, pEntry->lastTime +
-#ifdef IGMP_TVM_SUPPORT
-				pEntry->AgeOutTime
-#else
-				IGMPMAC_TB_ENTRY_AGEOUT_TIME
-#endif /* IGMP_TVM_SUPPORT */
-				)) {
-				PMULTICAST_FILTER_TABLE_ENTRY pHashEntry;
-				HashIdx = MULTICAST_ADDR_HASH_INDEX(pEntry->Addr);
-				pHashEntry = pMulticastFilterTable->Hash[HashIdx];
-
-				if ((pEntry->net_dev == pHashEntry->net_dev)
-					&& MAC_ADDR_EQUAL(pEntry->Addr, pHashEntry->Addr)) {
-					pMulticastFilterTable->Hash[HashIdx] = pHashEntry->pNext;
-					pMulticastFilterTable->Size--;
-					MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_TRACE, ("MCastFilterTableDeleteEntry 1 - Total= %d\n", pMulticastFilterTable->Size));
-				} else {
-					while (pHashEntry->pNext) {
-						pPrevEntry = pHashEntry;
-						pHashEntry = pHashEntry->pNext;
-
-						if ((pEntry->net_dev == pHashEntry->net_dev)
-							&& MAC_ADDR_EQUAL(pEntry->Addr, pHashEntry->Addr)) {
-							pPrevEntry->pNext = pHashEntry->pNext;
-							pMulticastFilterTable->Size--;
-							MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_TRACE, ("MCastFilterTableDeleteEntry 2 - Total= %d\n", pMulticastFilterTable->Size));
-							break;
-						}
-					}
-				}
+			if ((pEntry->Valid == FALSE) && (pEntry->Retired == FALSE))
+				break;
+		}
 
-				pEntry->Valid = FALSE;
-				DeleteIgmpMemberList(pMulticastFilterTable, &pEntry->MemberList);
-			}
+		if (i == MAX_LEN_OF_MULTICAST_FILTER_TABLE) {
+			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_ERROR, ("%s no vacancy, deleted entries are not released yet.\n", __func__));
+			Result = FALSE;
+			break;
+		}
 
-			if (pEntry->Valid == FALSE) {
-				NdisZeroMemory(pEntry, sizeof(MULTICAST_FILTER_TABLE_ENTRY));
-				pEntry->Valid = TRUE;
-				COPY_MAC_ADDR(pEntry->Addr, pGrpId);
-				pEntry->net_dev = dev;
-				NdisGetSystemUpTime(&Now);
-				pEntry->lastTime = Now;
+		NdisZeroMemory(pEntry, sizeof(MULTICAST_FILTER_TABLE_ENTRY));
+		COPY_MAC_ADDR(pEntry->Addr, pGrpId);
+		pEntry->net_dev = dev;
+		pEntry->lastTime = Now;
 #ifdef IGMP_TVM_SUPPORT
-				pEntry->AgeOutTime = AgeOutTime;
+		pEntry->AgeOutTime = AgeOutTime;
 #endif /* IGMP_TVM_SUPPORT */
-				pEntry->type = (MulticastFilterEntryType)(((UINT8)type) & GROUP_ENTRY_TYPE_BITMASK); /* remove member detail*/
-				initList(&pEntry->MemberList);
+		pEntry->type = (MulticastFilterEntryType)(((UINT8)type) & GROUP_ENTRY_TYPE_BITMASK); /* remove member detail*/
 
-				if (pMemberAddr != NULL)
-					InsertIgmpMember(pMulticastFilterTable, &pEntry->MemberList, pMemberAddr, type);
+		if (bPending)
+			Result = MulticastFilterPendingMemberAdd(pMulticastFilterTable, pGrpId, dev, pMemberAddr, type);
+		else if (pMemberAddr != NULL)
+			InsertIgmpMember(pEntry, WlanIndex, type);
 
-				pMulticastFilterTable->Size++;
-				MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_TRACE, ("MulticastFilterTableInsertEntry -IF(%s) allocate entry #%d, Total= %d\n", RTMP_OS_NETDEV_GET_DEVNAME(dev), i, pMulticastFilterTable->Size));
-				break;
-			}
-		}
+		pEntry->Valid = TRUE;
+		pMulticastFilterTable->Size++;
+		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_TRACE, ("MulticastFilterTableInsertEntry -IF(%s) allocate entry #%d, Total= %d\n", RTMP_OS_NETDEV_GET_DEVNAME(dev), i, pMulticastFilterTable->Size));
 
-		/* add this MAC entry into HASH table */
-		if (pEntry) {
-			HashIdx = MULTICAST_ADDR_HASH_INDEX(pGrpId);
+		/* add this MAC entry into HASH table, it is published complete */
+		HashIdx = MULTICAST_ADDR_HASH_INDEX(pGrpId);
 
-			if (pMulticastFilterTable->Hash[HashIdx] == NULL)
-				pMulticastFilterTable->Hash[HashIdx] = pEntry;
-			else {
-				pCurrEntry = pMulticastFilterTable->Hash[HashIdx];
+		if (pMulticastFilterTable->Hash[HashIdx] == NULL)
+			RTMP_RCU_ASSIGN_POINTER(pMulticastFilterTable->Hash[HashIdx], pEntry);
+		else {
+			pCurrEntry = pMulticastFilterTable->Hash[HashIdx];
 
-				while (pCurrEntry->pNext != NULL)
-					pCurrEntry = pCurrEntry->pNext;
+			while (pCurrEntry->pNext != NULL)
+				pCurrEntry = pCurrEntry->pNext;
 
-				pCurrEntry->pNext = pEntry;
-			}
+			RTMP_RCU_ASSIGN_POINTER(pCurrEntry->pNext, pEntry);
 		}
 	} while (FALSE);
 
 	RTMP_SEM_UNLOCK(&pMulticastFilterTable->MulticastFilterTabLock);
-	return TRUE;
+	return Result;
 }
 
 
@@ -362,7 +506,6 @@ BOOLEAN MulticastFilterTableDeleteEntry(
 	IN PNET_DEV dev,
 	IN UINT8 WlanIndex)
 {
-	USHORT HashIdx;
 	MULTICAST_FILTER_TABLE_ENTRY *pEntry, *pPrevEntry;
 	PMULTICAST_FILTER_TABLE pMulticastFilterTable = pAd->pMulticastFilterTable;
 
@@ -374,43 +517,27 @@ BOOLEAN MulticastFilterTableDeleteEntry(
 	RTMP_SEM_LOCK(&pMulticastFilterTable->MulticastFilterTabLock);
 
 	do {
-		HashIdx = MULTICAST_ADDR_HASH_INDEX(pGrpId);
-		pPrevEntry = pEntry = pMulticastFilterTable->Hash[HashIdx];
+		pEntry = MulticastFilterEntryFind(pMulticastFilterTable, pGrpId, dev, &pPrevEntry);
 
-		while (pEntry && pEntry->Valid) {
-			if ((pEntry->net_dev ==  dev)
-				&& MAC_ADDR_EQUAL(pEntry->Addr, pGrpId))
-				break;
-			else {
-				pPrevEntry = pEntry;
-				pEntry = pEntry->pNext;
-			}
+		if (pEntry == NULL) {
+			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_ERROR, ("%s: the Group doesn't exist.\n", __func__));
+			break;
 		}
 
 		/* check the rule is in table already or not. */
-		if (pEntry && (pMemberAddr != NULL)) {
-			DeleteIgmpMember(pMulticastFilterTable, &pEntry->MemberList, pMemberAddr);
+		if (pMemberAddr != NULL) {
+			MulticastFilterPendingMemberDel(pMulticastFilterTable, pGrpId, dev, pMemberAddr);
+
+			if (VALID_UCAST_ENTRY_WCID(pAd, WlanIndex))
+				DeleteIgmpMember(pEntry, WlanIndex);
 
-			if (IgmpMemberCnt(&pEntry->MemberList) > 0)
+			if ((IgmpMemberCnt(pEntry) > 0)
+				|| (MulticastFilterPendingMemberCnt(pMulticastFilterTable, pGrpId, dev) > 0))
 				break;
 		}
 
-		if (pEntry) {
-			if (pEntry == pMulticastFilterTable->Hash[HashIdx]) {
-				pMulticastFilterTable->Hash[HashIdx] = pEntry->pNext;
-				DeleteIgmpMemberList(pMulticastFilterTable, &pEntry->MemberList);
-				NdisZeroMemory(pEntry, sizeof(MULTICAST_FILTER_TABLE_ENTRY));
-				pMulticastFilterTable->Size--;
-				MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_TRACE, ("MCastFilterTableDeleteEntry 1 - Total= %d\n", pMulticastFilterTable->Size));
-			} else {
-				pPrevEntry->pNext = pEntry->pNext;
-				DeleteIgmpMemberList(pMulticastFilterTable, &pEntry->MemberList);
-				NdisZeroMemory(pEntry, sizeof(MULTICAST_FILTER_TABLE_ENTRY));
-				pMulticastFilterTable->Size--;
-				MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_TRACE, ("MCastFilterTableDeleteEntry 2 - Total= %d\n", pMulticastFilterTable->Size));
-			}
-		} else
-			MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_ERROR, ("%s: the Group doesn't exist.\n", __func__));
+		MulticastFilterEntryUnlink(pMulticastFilterTable, pEntry, pPrevEntry);
+		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_TRACE, ("MCastFilterTableDeleteEntry - Total= %d\n", pMulticastFilterTable->Size));
 	} while (FALSE);
 
 	RTMP_SEM_UNLOCK(&pMulticastFilterTable->MulticastFilterTabLock);
@@ -421,6 +548,8 @@ BOOLEAN MulticastFilterTableDeleteEntry(
     ==========================================================================
     Description:
 	Look up the MAC address in the IGMP table. Return NULL if not found.
+	It takes no lock, the caller must be in a RCU read-side section
+	for as long as it uses the returned entry.
     Return:
 	pEntry - pointer to the MAC entry; NULL is not found
     ==========================================================================
@@ -430,61 +559,70 @@ PMULTICAST_FILTER_TABLE_ENTRY MulticastFilterTableLookup(
 	IN PUCHAR pAddr,
 	IN PNET_DEV dev)
 {
-	ULONG HashIdx, Now;
-	PMULTICAST_FILTER_TABLE_ENTRY pEntry = NULL, pPrev = NULL;
+	ULONG Now;
+	PMULTICAST_FILTER_TABLE_ENTRY pEntry = NULL;
 
 	if (pMulticastFilterTable == NULL) {
 		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_ERROR, ("%s Multicase filter table is not ready.\n", __func__));
 		return NULL;
 	}
 
-	RTMP_SEM_LOCK(&pMulticastFilterTable->MulticastFilterTabLock);
-	HashIdx = MULTICAST_ADDR_HASH_INDEX(pAddr);
-	pEntry = pPrev = pMulticastFilterTable->Hash[HashIdx];
+	pEntry = RTMP_RCU_DEREFERENCE(pMulticastFilterTable->Hash[MULTICAST_ADDR_HASH_INDEX(pAddr)]);
 
-	while (pEntry && pEntry->Valid) {
-		if ((pEntry->net_dev ==  dev)
+	while (pEntry) {
+		if ((pEntry->Valid == TRUE) && (pEntry->net_dev == dev)
 			&& MAC_ADDR_EQUAL(pEntry->Addr, pAddr)) {
 			NdisGetSystemUpTime(&Now);
 			pEntry->lastTime = Now;
 			break;
-		} else {
-			NdisGetSystemUpTime(&Now);
+		}
 
-			if ((pEntry->Valid == TRUE) && (pEntry->type == MCAT_FILTER_DYNAMIC)
-				&& RTMP_TIME_AFTER(Now, pEntry->lastTime +
-#ifdef IGMP_TVM_SUPPORT
-				pEntry->AgeOutTime
-#else
-				IGMPMAC_TB_ENTRY_AGEOUT_TIME
-#endif /* IGMP_TVM_SUPPORT */
-				)) {
-				/* Remove the aged entry */
-				if (pEntry == pMulticastFilterTable->Hash[HashIdx]) {
-					pMulticastFilterTable->Hash[HashIdx] = pEntry->pNext;
-					pPrev = pMulticastFilterTable->Hash[HashIdx];
-					DeleteIgmpMemberList(pMulticastFilterTable, &pEntry->MemberList);
-					NdisZeroMemory(pEntry, sizeof(MULTICAST_FILTER_TABLE_ENTRY));
-					pMulticastFilterTable->Size--;
-					pEntry = pPrev;
-					MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_TRACE, ("MCastFilterTableDeleteEntry 2 - Total= %d\n", pMulticastFilterTable->Size));
-				} else {
-					pPrev->pNext = pEntry->pNext;
-					DeleteIgmpMemberList(pMulticastFilterTable, &pEntry->MemberList);
-					NdisZeroMemory(pEntry, sizeof(MULTICAST_FILTER_TABLE_ENTRY));
-					pMulticastFilterTable->Size--;
-					pEntry = pPrev->pNext;
-					MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_TRACE, ("MCastFilterTableDeleteEntry 2 - Total= %d\n", pMulticastFilterTable->Size));
-				}
-			} else {
-				pPrev = pEntry;
-				pEntry = pEntry->pNext;
-			}
+		pEntry = RTMP_RCU_DEREFERENCE(pEntry->pNext);
+	}
+
+	return pEntry;
+}
+
+/*
+    ==========================================================================
+    Description:
+	Remove the aged dynamic groups. Called once a second from the AP
+	periodic routine, so the per-frame lookup never has to.
+    ==========================================================================
+ */
+VOID MulticastFilterTableAgeOut(
+	IN PRTMP_ADAPTER pAd)
+{
+	INT HashIdx;
+	ULONG Now;
+	PMULTICAST_FILTER_TABLE_ENTRY pEntry, pPrevEntry, pNextEntry;
+	PMULTICAST_FILTER_TABLE pMulticastFilterTable = pAd->pMulticastFilterTable;
+
+	if ((pMulticastFilterTable == NULL) || (pMulticastFilterTable->Size == 0))
+		return;
+
+	NdisGetSystemUpTime(&Now);
+	RTMP_SEM_LOCK(&pMulticastFilterTable->MulticastFilterTabLock);
+
+	for (HashIdx = 0; HashIdx < MAX_LEN_OF_MULTICAST_FILTER_HASH_TABLE; HashIdx++) {
+		pPrevEntry = NULL;
+		pEntry = pMulticastFilterTable->Hash[HashIdx];
+
+		while (pEntry) {
+			pNextEntry = pEntry->pNext;
+
+			if (MulticastFilterEntryAged(pEntry, Now)) {
+				MulticastFilterEntryUnlink(pMulticastFilterTable, pEntry, pPrevEntry);
+				MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_TRACE, ("%s: Group=%02x:%02x:%02x:%02x:%02x:%02x aged out - Total= %d\n",
+						 __func__, PRINT_MAC(pEntry->Addr), pMulticastFilterTable->Size));
+			} else
+				pPrevEntry = pEntry;
+
+			pEntry = pNextEntry;
 		}
 	}
 
 	RTMP_SEM_UNLOCK(&pMulticastFilterTable->MulticastFilterTabLock);
-	return pEntry;
 }
 
 #ifdef IGMP_TVM_SUPPORT
@@ -1456,7 +1594,8 @@ BOOLEAN MulticastFilterGetMcastTable(RTMP_ADAPTER *pAd, UINT8 ucOwnMacIdx, struc
 		for (GroupIdx = 0; GroupIdx < MAX_LEN_OF_MULTICAST_FILTER_TABLE; GroupIdx++) {
 			/* pick up the valid entry */
 			if (pMulticastFilterTable->Content[GroupIdx].Valid == TRUE) {
-				PMEMBER_ENTRY pMemberEntry = NULL;
+				UINT16 Wcid;
+				UINT8 TVMode;
 				pEntry = &pMulticastFilterTable->Content[GroupIdx];
 
 				MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_OFF,
@@ -1467,19 +1606,20 @@ BOOLEAN MulticastFilterGetMcastTable(RTMP_ADAPTER *pAd, UINT8 ucOwnMacIdx, struc
 									(GroupIdx+1), PRINT_MAC(pEntry->Addr),
 														(pEntry->AgeOutTime / OS_HZ)));
 
-				pMemberEntry = (PMEMBER_ENTRY)pEntry->MemberList.pHead;
-
 				MemberIdx = 0;
 
-				while (pMemberEntry) {
+				for (Wcid = 0; Wcid < MAX_LEN_OF_MAC_TABLE; Wcid++) {
+					if (!MCAST_MEMBER_TEST(pEntry->MemberMap, Wcid))
+						continue;
+
+					TVMode = MulticastFilterMemberTVMode(pEntry, Wcid);
 					MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_OFF, ("	%3u.%-2u							"
 						"%02X:%02X:%02X:%02X:%02X:%02X		 "
 						"%s\n",
 						(GroupIdx+1), (MemberIdx+1),
-						PRINT_MAC(pMemberEntry->Addr),
-						((pMemberEntry->TVMode == 0) ? "AUTO":((pMemberEntry->TVMode == 1) ? "ENABLE":"NO TVM IE"))));
+						PRINT_MAC(pAd->MacTab.Content[Wcid].Addr),
+						((TVMode == 0) ? "AUTO":((TVMode == 1) ? "ENABLE":"NO TVM IE"))));
 
-					pMemberEntry = pMemberEntry->pNext;
 					MemberIdx += 1;
 				}
 			}
@@ -1724,157 +1864,141 @@ BOOLEAN isIgmpPkt(
 }
 
 static VOID InsertIgmpMember(
-	IN PMULTICAST_FILTER_TABLE pMulticastFilterTable,
-	IN PLIST_HEADER pList,
-	IN PUCHAR pMemberAddr,
+	IN PMULTICAST_FILTER_TABLE_ENTRY pEntry,
+	IN UINT16 Wcid,
 	IN MulticastFilterEntryType type)
 {
-	PMEMBER_ENTRY pMemberEntry;
-
-	if (pList == NULL) {
-		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_ERROR, ("%s: membert list doesn't exist.\n", __func__));
-		return;
-	}
-
-	if (pMemberAddr == NULL) {
-		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_ERROR, ("%s: invalid member.\n", __func__));
-		return;
-	}
-
-	pMemberEntry = (PMEMBER_ENTRY)AllocaGrpMemberEntry(pMulticastFilterTable);
-	if (pMemberEntry != NULL) {
-		NdisZeroMemory(pMemberEntry, sizeof(MEMBER_ENTRY));
-		COPY_MAC_ADDR(pMemberEntry->Addr, pMemberAddr);
+	/* member details go first, lock-free readers test MemberMap before them */
 #ifdef IGMP_TVM_SUPPORT
-		if (type & MCAT_FILTER_TVM_ENABLE)
-			pMemberEntry->TVMode = IGMP_TVM_IE_MODE_ENABLE;
-		else if (type & MCAT_FILTER_TVM_AUTO)
-			pMemberEntry->TVMode = IGMP_TVM_IE_MODE_AUTO;
-		else
-			pMemberEntry->TVMode = IGMP_TVM_IE_MODE_DISABLE;
+	MCAST_MEMBER_CLEAR(pEntry->TVMEnableMap, Wcid);
+	MCAST_MEMBER_CLEAR(pEntry->TVMAutoMap, Wcid);
+
+	if (type & MCAT_FILTER_TVM_ENABLE)
+		MCAST_MEMBER_SET(pEntry->TVMEnableMap, Wcid);
+	else if (type & MCAT_FILTER_TVM_AUTO)
+		MCAST_MEMBER_SET(pEntry->TVMAutoMap, Wcid);
 #endif /* IGMP_TVM_SUPPORT */
 #ifdef A4_CONN
-			/* Extract detail regarding presence on MWDS link*/
-			if (type & MCAT_FILTER_MWDS_CLI) {
-				pMemberEntry->onMWDSLink = TRUE;
-			} else {
-				pMemberEntry->onMWDSLink = FALSE;
-			}
+	/* Extract detail regarding presence on MWDS link*/
+	if (type & MCAT_FILTER_MWDS_CLI)
+		MCAST_MEMBER_SET(pEntry->MWDSMap, Wcid);
+	else
+		MCAST_MEMBER_CLEAR(pEntry->MWDSMap, Wcid);
 #endif
-		insertTailList(pList, (RT_LIST_ENTRY *)pMemberEntry);
-		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_TRACE, ("%s Member Mac=%02x:%02x:%02x:%02x:%02x:%02x\n", __func__,
-				 pMemberEntry->Addr[0], pMemberEntry->Addr[1], pMemberEntry->Addr[2],
-				 pMemberEntry->Addr[3], pMemberEntry->Addr[4], pMemberEntry->Addr[5]));
+
+	if (!MCAST_MEMBER_TEST(pEntry->MemberMap, Wcid)) {
+		MCAST_MEMBER_SET(pEntry->MemberMap, Wcid);
+		pEntry->MemberCnt++;
 	}
 
-	return;
+	MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_TRACE, ("%s Member Wcid=%d\n", __func__, Wcid));
 }
 
 static VOID DeleteIgmpMember(
-	IN PMULTICAST_FILTER_TABLE pMulticastFilterTable,
-	IN PLIST_HEADER pList,
-	IN PUCHAR pMemberAddr)
+	IN PMULTICAST_FILTER_TABLE_ENTRY pEntry,
+	IN UINT16 Wcid)
 {
-	PMEMBER_ENTRY pCurEntry;
-
-	if (pList == NULL) {
-		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_ERROR, ("%s: membert list doesn't exist.\n", __func__));
-		return;
-	}
-
-	if (pList->pHead == NULL)
+	if (!MCAST_MEMBER_TEST(pEntry->MemberMap, Wcid))
 		return;
 
-	if (pMemberAddr == NULL) {
-		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_ERROR, ("%s: invalid member.\n", __func__));
-		return;
-	}
-
-	pCurEntry = (PMEMBER_ENTRY)pList->pHead;
-
-	while (pCurEntry) {
-		PMEMBER_ENTRY pCurEntryNext = pCurEntry->pNext;
+	MCAST_MEMBER_CLEAR(pEntry->MemberMap, Wcid);
+	pEntry->MemberCnt--;
+}
 
-		if (MAC_ADDR_EQUAL(pMemberAddr, pCurEntry->Addr)) {
-			delEntryList(pList, (RT_LIST_ENTRY *)pCurEntry);
-			FreeGrpMemberEntry(pMulticastFilterTable, pCurEntry);
-			break;
-		}
 
-		pCurEntry = pCurEntryNext;
+UINT16 IgmpMemberCnt(
+	IN PMULTICAST_FILTER_TABLE_ENTRY pEntry)
+{
+	if (pEntry == NULL) {
+		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_ERROR, ("%s: group entry doesn't exist.\n", __func__));
+		return 0;
 	}
 
-	return;
+	return pEntry->MemberCnt;
 }
 
-static VOID DeleteIgmpMemberList(
-	IN PMULTICAST_FILTER_TABLE pMulticastFilterTable,
-	IN PLIST_HEADER pList)
+VOID IgmpGroupDelMembers(
+	IN PRTMP_ADAPTER pAd,
+	IN PUCHAR pMemberAddr,
+	IN struct wifi_dev *wdev,
+	UINT8 Wcid)
 {
-	PMEMBER_ENTRY pCurEntry, pPrvEntry;
+	INT i;
+	BOOLEAN bEmpty;
+	MULTICAST_FILTER_TABLE_ENTRY *pEntry = NULL;
+	PMULTICAST_FILTER_TABLE pMulticastFilterTable = pAd->pMulticastFilterTable;
 
-	if (pList == NULL) {
-		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_ERROR, ("%s: membert list doesn't exist.\n", __func__));
+	if (IS_ASIC_CAP(pAd, fASIC_CAP_MCU_OFFLOAD))
 		return;
-	}
 
-	if (pList->pHead == NULL)
+	if ((pMulticastFilterTable == NULL) || !VALID_UCAST_ENTRY_WCID(pAd, Wcid))
 		return;
 
-	pPrvEntry = pCurEntry = (PMEMBER_ENTRY)pList->pHead;
+	for (i = 0; i < MAX_LEN_OF_MULTICAST_FILTER_TABLE; i++) {
+		/* pick up the first available vacancy */
+		pEntry = &pMulticastFilterTable->Content[i];
 
-	while (pCurEntry) {
-		delEntryList(pList, (RT_LIST_ENTRY *)pCurEntry);
-		pPrvEntry = pCurEntry;
-		pCurEntry = pCurEntry->pNext;
-		FreeGrpMemberEntry(pMulticastFilterTable, pPrvEntry);
-	}
+		if (pEntry->Valid == TRUE) {
+			RTMP_SEM_LOCK(&pMulticastFilterTable->MulticastFilterTabLock);
 
-	initList(pList);
-	return;
-}
+			if (pMemberAddr != NULL)
+				DeleteIgmpMember(pEntry, Wcid);
 
+			bEmpty = ((pEntry->Valid == TRUE)
+					  && (pEntry->type == MCAT_FILTER_DYNAMIC)
+					  && (IgmpMemberCnt(pEntry) == 0)) ? TRUE : FALSE;
+			RTMP_SEM_UNLOCK(&pMulticastFilterTable->MulticastFilterTabLock);
 
-UCHAR IgmpMemberCnt(
-	IN PLIST_HEADER pList)
-{
-	if (pList == NULL) {
-		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_IGMP, DBG_LVL_ERROR, ("%s: membert list doesn't exist.\n", __func__));
-		return 0;
+			if (bEmpty)
+				AsicMcastEntryDelete(pAd, pEntry->Addr, wdev->bss_info_argument.ucBssIndex, pMemberAddr, wdev->if_dev, Wcid);
+		}
 	}
-
-	return getListSize(pList);
 }
 
-VOID IgmpGroupDelMembers(
+/*
+    ==========================================================================
+    Description:
+	Turn the pending static memberships of a station that just associated
+	into members of their groups, now that it has a WCID.
+    ==========================================================================
+ */
+VOID IgmpGroupAddPendingMembers(
 	IN PRTMP_ADAPTER pAd,
 	IN PUCHAR pMemberAddr,
 	IN struct wifi_dev *wdev,
 	UINT8 Wcid)
 {
 	INT i;
-	MULTICAST_FILTER_TABLE_ENTRY *pEntry = NULL;
+	UCHAR Cnt = 0;
+	UCHAR GrpId[MULTICAST_PENDING_MEMBER_SIZE][MAC_ADDR_LEN];
+	UINT8 Type[MULTICAST_PENDING_MEMBER_SIZE];
+	PMULTICAST_FILTER_PENDING_MEMBER pPending;
 	PMULTICAST_FILTER_TABLE pMulticastFilterTable = pAd->pMulticastFilterTable;
 
 	if (IS_ASIC_CAP(pAd, fASIC_CAP_MCU_OFFLOAD))
 		return;
 
-	for (i = 0; i < MAX_LEN_OF_MULTICAST_FILTER_TABLE; i++) {
-		/* pick up the first available vacancy */
-		pEntry = &pMulticastFilterTable->Content[i];
+	if ((pMulticastFilterTable == NULL) || !VALID_UCAST_ENTRY_WCID(pAd, Wcid))
+		return;
 
-		if (pEntry->Valid == TRUE) {
-			if (pMemberAddr != NULL) {
-				RTMP_SEM_LOCK(&pMulticastFilterTable->MulticastFilterTabLock);
-				DeleteIgmpMember(pMulticastFilterTable, &pEntry->MemberList, pMemberAddr);
-				RTMP_SEM_UNLOCK(&pMulticastFilterTable->MulticastFilterTabLock);
-			}
+	RTMP_SEM_LOCK(&pMulticastFilterTable->MulticastFilterTabLock);
 
-			if ((pEntry->type == MCAT_FILTER_DYNAMIC)
-				&& (IgmpMemberCnt(&pEntry->MemberList) == 0))
-				AsicMcastEntryDelete(pAd, pEntry->Addr, wdev->bss_info_argument.ucBssIndex, pMemberAddr, wdev->if_dev, Wcid);
+	for (i = 0; i < MULTICAST_PENDING_MEMBER_SIZE; i++) {
+		pPending = &pMulticastFilterTable->PendingMember[i];
+
+		if (pPending->Valid && (pPending->net_dev == wdev->if_dev)
+			&& MAC_ADDR_EQUAL(pPending->MemberAddr, pMemberAddr)) {
+			COPY_MAC_ADDR(GrpId[Cnt], pPending->GrpId);
+			Type[Cnt++] = pPending->type;
+			pPending->Valid = FALSE;
 		}
 	}
+
+	RTMP_SEM_UNLOCK(&pMulticastFilterTable->MulticastFilterTabLock);
+
+	/* the insert takes the table lock itself */
+	for (i = 0; i < Cnt; i++)
+		AsicMcastEntryInsert(pAd, GrpId[i], wdev->bss_info_argument.ucBssIndex, Type[i], pMemberAddr, wdev->if_dev, Wcid);
 }
 
 INT Set_IgmpSn_Enable_Proc(RTMP_ADAPTER *pAd, RTMP_STRING *arg)
@@ -2014,6 +2138,7 @@ INT Set_IgmpSn_AddEntry_Proc(RTMP_ADAPTER *pAd, RTMP_STRING *arg)
 		}
 		/* Group-Member must be a UCAST address. */
 		else if ((bGroupId == 0) && !IS_MULTICAST_MAC_ADDR(Addr)) {
+			/* a station that is not associated yet joins when it associates. */
 			if (pEntry)
 				AsicMcastEntryInsert(pAd, GroupId, pAd->ApCfg.MBSSID[ifIndex].wdev.bss_info_argument.ucBssIndex, MCAT_FILTER_STATIC | mwds_type, Addr, pDev, pEntry->wcid);
 			else
@@ -2170,11 +2295,11 @@ void rtmp_read_igmp_snoop_from_file(
 
 #ifdef A4_CONN
 /* Indicate Whether specified member is present on MWDS link */
-BOOLEAN isMemberOnMWDSLink(VOID *prMemberEntry)
+static BOOLEAN isMemberOnMWDSLink(
+	IN PMULTICAST_FILTER_TABLE_ENTRY pEntry,
+	IN UINT16 Wcid)
 {
-	PMEMBER_ENTRY pMemberEntry = (PMEMBER_ENTRY) prMemberEntry;
-
-	if (pMemberEntry->onMWDSLink != FALSE)
+	if (MCAST_MEMBER_TEST(pEntry->MWDSMap, Wcid))
 		return TRUE;
 	else
 		return FALSE;
@@ -2264,6 +2389,7 @@ BOOLEAN ismDNS(
  * in the multicast filter table, if no match, drop the packet, else have two case
  * If the member-list of the matching entry is empty and AP just forwards packet to all stations
  * Else if AP will do the MC-to-UC conversation base one memberships
+ * The caller holds the RCU read lock until it is done with *ppGroupEntry.
  */
 NDIS_STATUS IgmpPktInfoQuery(
 	IN PRTMP_ADAPTER pAd,
@@ -2356,104 +2482,60 @@ NDIS_STATUS IgmpPktClone(
 #endif /* IGMP_TVM_SUPPORT*/
 	struct qm_ops *qm_ops = pAd->qm_ops;
 	PNDIS_PACKET pSkbClone = NULL;
-	PMEMBER_ENTRY pMemberEntry = NULL;
 	MAC_TABLE_ENTRY *pMacEntry = NULL;
 	STA_TR_ENTRY *tr_entry = NULL;
-	USHORT Aid;
-	SST Sst = SST_ASSOC;
-	UCHAR PsMode = PWR_ACTIVE;
-	UCHAR Rate;
-	BOOLEAN bContinue;
-	PUCHAR pMemberAddr = NULL;
-	bContinue = FALSE;
-
-	if ((IgmpPktInGroup == IGMP_IN_GROUP) && (pGroupEntry == NULL))
-		return NDIS_STATUS_FAILURE;
-
-	if (IgmpPktInGroup == IGMP_IN_GROUP) {
-		pMemberEntry = (PMEMBER_ENTRY)pGroupEntry->MemberList.pHead;
+	UINT32 MemberMap;
+	UINT16 Wcid;
+	INT i;
 
-		if (pMemberEntry) {
-			pMemberAddr = pMemberEntry->Addr;
-			pMacEntry = APSsPsInquiry(pAd, pMemberAddr, &Sst, &Aid, &PsMode, &Rate);
-			bContinue = TRUE;
-		}
-	} else
+	if ((IgmpPktInGroup != IGMP_IN_GROUP) || (pGroupEntry == NULL))
 		return NDIS_STATUS_FAILURE;
 
-	/* check all members of the IGMP group. */
-	while (bContinue == TRUE) {
+	/* check all members of the IGMP group, the bitmap gives their WCID directly. */
+	for (i = 0; i < MCAST_MEMBER_BITMAP_DWORD; i++) {
+		MemberMap = pGroupEntry->MemberMap[i];
 
-#ifdef IGMP_TVM_SUPPORT
-		/* If TV Mode is enabled in AP, then we need to send unicast packet to all connected STA's */
-		if (wdev->IsTVModeEnable &&
-			((wdev->TVModeType == IGMP_TVM_MODE_DISABLE) ||
-			((wdev->TVModeType == IGMP_TVM_MODE_AUTO) &&
-			(pMemberEntry->TVMode == IGMP_TVM_IE_MODE_DISABLE)))) {
+		while (MemberMap) {
+			Wcid = (i << MCAST_MEMBER_BITMAP_SHIFT) + (ffs(MemberMap) - 1);
+			MemberMap &= (MemberMap - 1);
 
-			nStatus = NDIS_STATUS_MORE_PROCESSING_REQUIRED;
+#ifdef IGMP_TVM_SUPPORT
+			/* If TV Mode is enabled in AP, then we need to send unicast packet to all connected STA's */
+			if (wdev->IsTVModeEnable &&
+				((wdev->TVModeType == IGMP_TVM_MODE_DISABLE) ||
+				((wdev->TVModeType == IGMP_TVM_MODE_AUTO) &&
+				(MulticastFilterMemberTVMode(pGroupEntry, Wcid) == IGMP_TVM_IE_MODE_DISABLE)))) {
+				nStatus = NDIS_STATUS_MORE_PROCESSING_REQUIRED;
+				continue;
+			}
+#endif /* IGMP_TVM_SUPPORT */
 
-			pMemberEntry = pMemberEntry->pNext;
+			pMacEntry = &pAd->MacTab.Content[Wcid];
+			tr_entry = &pAd->MacTab.tr_entry[Wcid];
 
-			if (pMemberEntry != NULL) {
-				pMemberAddr = pMemberEntry->Addr;
-				pMacEntry = APSsPsInquiry(pAd, pMemberAddr, &Sst, &Aid, &PsMode, &Rate);
+			if (!IS_VALID_ENTRY(pMacEntry) || (pMacEntry->Sst != SST_ASSOC) ||
+				(tr_entry->PortSecured != WPA_802_1X_PORT_SECURED))
 				continue;
-			} else
-				break;
-		}
-#endif /* IGMP_TVM_SUPPORT */
 
-		if (pMacEntry && (Sst == SST_ASSOC) &&
-			(pAd->MacTab.tr_entry[pMacEntry->wcid].PortSecured == WPA_802_1X_PORT_SECURED)) {
-			tr_entry = &pAd->MacTab.tr_entry[pMacEntry->wcid];
 			OS_PKT_CLONE(pAd, pPacket, pSkbClone, MEM_ALLOC_FLAG);
 
-			if ((pSkbClone)
-			   ) {
-				RTMP_SET_PACKET_WCID(pSkbClone, (UCHAR)pMacEntry->wcid);
+			if (pSkbClone == NULL)
+				continue;
+
+			RTMP_SET_PACKET_WCID(pSkbClone, (UCHAR)Wcid);
 
-				/*For MWDS member clone use DA from MPDU*/
+			/*For MWDS member clone use DA from MPDU*/
 #ifdef A4_CONN
-				if (!isMemberOnMWDSLink(pMemberEntry))
+			if (!isMemberOnMWDSLink(pGroupEntry, Wcid))
 #endif
-					RTMP_SET_PACKET_MCAST_CLONE(pSkbClone, 1);
-
-				RTMP_SET_PACKET_UP(pSkbClone, UserPriority);
-
-				qm_ops->enq_dataq_pkt(pAd, wdev, pSkbClone, QueIdx);
+				RTMP_SET_PACKET_MCAST_CLONE(pSkbClone, 1);
 
-			} else {
-				if (IgmpPktInGroup == IGMP_IN_GROUP) {
-					pMemberEntry = pMemberEntry->pNext;
-
-					if (pMemberEntry != NULL) {
-						pMemberAddr = pMemberEntry->Addr;
-						pMacEntry = APSsPsInquiry(pAd, pMemberAddr, &Sst, &Aid, &PsMode, &Rate);
-						bContinue = TRUE;
-					} else
-						bContinue = FALSE;
-				} else
-					bContinue = FALSE;
+			RTMP_SET_PACKET_UP(pSkbClone, UserPriority);
 
-				continue;
-			}
+			qm_ops->enq_dataq_pkt(pAd, wdev, pSkbClone, QueIdx);
 
 			ba_ori_session_start(pAd, tr_entry, UserPriority);
 		}
-
-
-		if (IgmpPktInGroup == IGMP_IN_GROUP) {
-			pMemberEntry = pMemberEntry->pNext;
-
-			if (pMemberEntry != NULL) {
-				pMemberAddr = pMemberEntry->Addr;
-				pMacEntry = APSsPsInquiry(pAd, pMemberAddr, &Sst, &Aid, &PsMode, &Rate);
-				bContinue = TRUE;
-			} else
-				bContinue = FALSE;
-		} else
-			bContinue = FALSE;
 	}
 
 #ifdef IGMP_TVM_SUPPORT
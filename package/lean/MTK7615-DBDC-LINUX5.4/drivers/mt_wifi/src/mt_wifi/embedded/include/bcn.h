@@ -101,6 +101,10 @@ VOID UpdateBeaconHandler(
 	struct wifi_dev *wdev,
 	UCHAR BCN_UPDATE_REASON);
 
+VOID UpdateBeaconDefer(
+	RTMP_ADAPTER *pAd,
+	BOOLEAN bDefer);
+
 BOOLEAN UpdateBeaconProc(
 	RTMP_ADAPTER *pAd,
 	struct wifi_dev *wdev,
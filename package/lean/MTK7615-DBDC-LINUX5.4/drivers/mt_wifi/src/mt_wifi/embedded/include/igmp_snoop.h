@@ -45,6 +45,11 @@
 
 #define MULTICAST_ADDR_HASH_INDEX(Addr)      (MAC_ADDR_HASH(Addr) & (MAX_LEN_OF_MULTICAST_FILTER_HASH_TABLE - 1))
 
+/* per-group member bitmaps, indexed by WCID */
+#define MCAST_MEMBER_TEST(_map, _wcid)	((_map)[(_wcid) >> MCAST_MEMBER_BITMAP_SHIFT] & (1U << ((_wcid) & MCAST_MEMBER_BITMAP_MASK)))
+#define MCAST_MEMBER_SET(_map, _wcid)	((_map)[(_wcid) >> MCAST_MEMBER_BITMAP_SHIFT] |= (1U << ((_wcid) & MCAST_MEMBER_BITMAP_MASK)))
+#define MCAST_MEMBER_CLEAR(_map, _wcid)	((_map)[(_wcid) >> MCAST_MEMBER_BITMAP_SHIFT] &= ~(1U << ((_wcid) & MCAST_MEMBER_BITMAP_MASK)))
+
 #define IS_IPV6_MULTICAST_MAC_ADDR(Addr)	((((Addr[0]) & 0x01) == 0x01) && ((Addr[0]) == 0x33))
 
 #define IGMP_NONE		0
@@ -89,6 +94,9 @@ PMULTICAST_FILTER_TABLE_ENTRY MulticastFilterTableLookup(
 	IN PUCHAR pAddr,
 	IN PNET_DEV dev);
 
+VOID MulticastFilterTableAgeOut(
+	IN PRTMP_ADAPTER pAd);
+
 BOOLEAN isIgmpPkt(
 	IN PUCHAR pDstMacAddr,
 	IN PUCHAR pIpHeader);
@@ -187,8 +195,8 @@ BOOLEAN isMLDquery(
 #endif
 
 
-UCHAR IgmpMemberCnt(
-	IN PLIST_HEADER pList);
+UINT16 IgmpMemberCnt(
+	IN PMULTICAST_FILTER_TABLE_ENTRY pEntry);
 
 VOID IgmpGroupDelMembers(
 	IN PRTMP_ADAPTER pAd,
@@ -196,6 +204,12 @@ VOID IgmpGroupDelMembers(
 	IN struct wifi_dev *wdev,
 	UINT8 Wcid);
 
+VOID IgmpGroupAddPendingMembers(
+	IN PRTMP_ADAPTER pAd,
+	IN PUCHAR pMemberAddr,
+	IN struct wifi_dev *wdev,
+	UINT8 Wcid);
+
 INT Set_IgmpSn_Enable_Proc(RTMP_ADAPTER *pAd, RTMP_STRING *arg);
 
 INT Set_IgmpSn_AddEntry_Proc(RTMP_ADAPTER *pAd, RTMP_STRING *arg);
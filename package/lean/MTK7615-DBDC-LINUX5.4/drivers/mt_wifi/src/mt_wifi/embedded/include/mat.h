@@ -102,6 +102,13 @@ typedef struct _NET_PRO_IP_HDR {
 /* MAT relate definition */
 #define MAT_MAX_HASH_ENTRY_SUPPORT		64
 #define MAT_TB_ENTRY_AGEOUT_TIME			(5 * 60 * OS_HZ)	/* 30000, 5min. MAT convert table entry age-out time interval. now set it as 5min. */
+#define MAT_PPPOE_SES_ENTRY_AGEOUT_TIME	3000
+
+/* MAT database, the hash size can be set by profile "MatHashSize" and must be a power of 2 */
+#define MAT_DB_HASH_SIZE_DEFAULT		256
+#define MAT_DB_HASH_SIZE_MIN			16
+#define MAT_DB_HASH_SIZE_MAX			4096
+#define MAT_DB_KEY_MAX_LEN				16		/* IPv6 address */
 
 
 /* 802.3 Ethernet related definition */
@@ -122,23 +129,10 @@ typedef struct _NET_PRO_IP_HDR {
 #define IS_VLAN_PACKET(pkt)		((((pkt)[12] << 8) | (pkt)[13]) == 0x8100)
 
 /* IPv4 related definition */
-#define IPMAC_TB_HASH_ENTRY_NUM			(MAT_MAX_HASH_ENTRY_SUPPORT+1)	/* One entry for broadcast address */
-#define IPMAC_TB_HASH_INDEX_OF_BCAST	MAT_MAX_HASH_ENTRY_SUPPORT		/* cause hash index start from 0. */
-
-#define MAT_IP_ADDR_HASH(Addr)		(((Addr>>24)&0xff)^((Addr>>16) & 0xff) ^ ((Addr>>8) & 0xff) ^ (Addr & 0xff))
-#define MAT_IP_ADDR_HASH_INDEX(Addr)	(MAT_IP_ADDR_HASH(Addr) % MAT_MAX_HASH_ENTRY_SUPPORT)
-
 #define IS_GOOD_IP(IP)	(IP != 0)
 #define IS_MULTICAST_IP(IP)	(((UINT32)(IP) & 0xf0000000) == 0xe0000000)
 
 /* IPv6 related definition */
-#define IPV6MAC_TB_HASH_ENTRY_NUM		(MAT_MAX_HASH_ENTRY_SUPPORT+1)	/* One entry for broadcast address */
-#define IPV6MAC_TB_HASH_INDEX_OF_BCAST	MAT_MAX_HASH_ENTRY_SUPPORT		/* cause hash index start from 0. */
-
-/*We just use byte 10,13,14,15 to calculate the IPv6 hash, because the byte 11,12 usually are 0xff, 0xfe for link-local address. */
-#define MAT_IPV6_ADDR_HASH(Addr)    ((Addr[10]&0xff) ^ (Addr[13] & 0xff) ^ (Addr[14] & 0xff) ^ (Addr[15] & 0xff))
-#define MAT_IPV6_ADDR_HASH_INDEX(Addr)	(MAT_IPV6_ADDR_HASH(Addr) % MAT_MAX_HASH_ENTRY_SUPPORT)
-
 #define IS_UNSPECIFIED_IPV6_ADDR(_addr)	\
 	(!((_addr).ipv6_addr32[0] | (_addr).ipv6_addr32[1] | (_addr).ipv6_addr32[2] | (_addr).ipv6_addr32[3]))
 
@@ -147,12 +141,45 @@ typedef struct _NET_PRO_IP_HDR {
 #define IS_MULTICAST_IPV6_ADDR(_addr) \
 	(((_addr).ipv6_addr[0] & 0xff) == 0xff)
 
-/* The MAT_TABLE used for MacAddress <-> UpperLayer Address Translation. */
+/* Upper layer address types kept in the MAT database */
+typedef enum _MAT_DB_TYPE_ {
+	MAT_DB_TYPE_IPV4 = 0,		/* IPv4 Address, Used for IP, ARP protocol */
+	MAT_DB_TYPE_IPV6,			/* IPv6 Address, Used for IPv6 related protocols */
+	MAT_DB_TYPE_PPPOE_SES,		/* PPPoE Session, session ID + server MAC */
+	MAT_DB_TYPE_PPPOE_UID,		/* PPPoE Discovery, host-uniq or AC-cookie */
+	MAT_DB_TYPE_MAX,
+} MAT_DB_TYPE;
+
+typedef struct _MAT_DB_ENTRY_ {
+	struct _MAT_DB_ENTRY_ *pNext;
+	UCHAR	type;
+	UCHAR	keyLen;
+	UCHAR	flags;		/* owned by the protocol handler of this type */
+	UCHAR	macAddr[MAC_ADDR_LEN];
+	UCHAR	key[MAT_DB_KEY_MAX_LEN];
+	ULONG	lastTime;
+	RTMP_OS_RCU_HEAD rcu;
+} MAT_DB_ENTRY, *PMAT_DB_ENTRY;
+
+/* Lookup counters of one type. Bumped per CPU from the data path, MATDBStatGet() sums them. */
+typedef struct _MAT_DB_STAT_ {
+	ULONG	Hit;
+	ULONG	Miss;
+	ULONG	BcastFallback;	/* unicast Rx sent to broadcast on a miss */
+} MAT_DB_STAT;
+
+/*
+	The MAT_TABLE used for MacAddress <-> UpperLayer Address Translation.
+	One hash holds the entries of every type. Lookups are lock-free under RCU,
+	updates are serialized by MATDBLock and entries are freed after a grace period.
+	Aged entries are dropped by MATDBUpdate() on the chain it walks and by the
+	MATDBAgeOut() sweep from the one-second MLME tick.
+*/
 typedef struct _MAT_TABLE_ {
-	VOID	*IPMacTable;		/* IPv4 Address, Used for IP, ARP protocol */
-	VOID	*IPv6MacTable;		/* IPv6 Address, Used for IPv6 related protocols */
-	VOID	*SesMacTable;		/* PPPoE Session */
-	VOID	*UidMacTable;		/* PPPoE Discovery */
+	MAT_DB_ENTRY	**Hash;
+	UINT32			HashSize;
+	UINT32			EntryCnt[MAT_DB_TYPE_MAX];	/* under MATDBLock */
+	MAT_DB_STAT		*pStat;		/* per CPU, MAT_DB_TYPE_MAX of them */
 } MAT_TABLE, *PMAT_TABLE;
 
 
@@ -167,9 +194,7 @@ typedef struct _MAT_STRUCT_ {
 	MAT_ENGINE_STATUS	status;
 	NDIS_SPIN_LOCK		MATDBLock;
 	MAT_TABLE			MatTableSet;
-#ifdef KMALLOC_BATCH
-	UCHAR				*pMATNodeEntryPoll;
-#endif
+	UINT32				DBHashSize;		/* from profile, 0 for default, used by the next init */
 #ifdef MAC_REPEATER_SUPPORT
 	BOOLEAN				bMACRepeaterEn;
 #endif /* MAC_REPEATER_SUPPORT */
@@ -194,15 +219,41 @@ typedef struct _MATProtoTable {
 
 VOID dumpPkt(PUCHAR pHeader, int len);
 
-/*#define KMALLOC_BATCH */
-
-PUCHAR MATDBEntryAlloc(
-	IN MAT_STRUCT * pMatStruct,
-	IN UINT32		size);
-
-NDIS_STATUS MATDBEntryFree(
-	IN MAT_STRUCT * pMatStruct,
-	IN PUCHAR		NodeEntry);
+PMAT_DB_ENTRY MATDBLookup(
+	IN MAT_STRUCT	*pMatCfg,
+	IN UCHAR		type,
+	IN PUCHAR		pKey,
+	IN UCHAR		keyLen);
+
+PMAT_DB_ENTRY MATDBUpdate(
+	IN MAT_STRUCT	*pMatCfg,
+	IN UCHAR		type,
+	IN PUCHAR		pKey,
+	IN UCHAR		keyLen,
+	IN PUCHAR		pMacAddr,
+	IN UCHAR		flags);
+
+VOID MATDBDump(
+	IN MAT_STRUCT	*pMatCfg,
+	IN UCHAR		type,
+	IN INT			hashIdx,
+	IN VOID (*show)(PMAT_DB_ENTRY pEntry, VOID *pCookie),
+	IN VOID			*pCookie);
+
+VOID MATDBAgeOut(
+	IN MAT_STRUCT	*pMatCfg);
+
+VOID MATDBStatBcastFallback(
+	IN MAT_STRUCT	*pMatCfg,
+	IN UCHAR		type);
+
+VOID MATDBStatGet(
+	IN MAT_STRUCT	*pMatCfg,
+	IN UCHAR		type,
+	OUT MAT_DB_STAT	*pSum);
+
+VOID MATDBStatClear(
+	IN MAT_STRUCT	*pMatCfg);
 
 
 #endif /* _MAT_H_ */
@@ -1578,6 +1578,7 @@ typedef struct _BCN_BUF_STRUCT {
 
 	NDIS_SPIN_LOCK BcnContentLock;
 	UCHAR BcnUpdateMethod;
+	BOOLEAN bBcnUpdPending; /* IE change held back by UpdateBeaconDefer */
 } BCN_BUF_STRUC;
 
 
@@ -4460,39 +4461,44 @@ typedef enum _MULTICAST_FILTER_ENTRY_TYPE {
 #endif
 } MulticastFilterEntryType;
 
-typedef struct _MEMBER_ENTRY {
-	struct _MEMBER_ENTRY *pNext;
-	UCHAR Addr[MAC_ADDR_LEN];
-#ifdef IGMP_TVM_SUPPORT
-	UINT8 TVMode;
-#endif /* IGMP_TVM_SUPPORT */
-#ifdef A4_CONN
-	BOOLEAN onMWDSLink; /*indicates whether this member is on MWDS link*/
-#endif
-	/*	USHORT Aid; */
-} MEMBER_ENTRY, *PMEMBER_ENTRY;
-
 typedef struct _MULTICAST_FILTER_TABLE_ENTRY {
 	BOOLEAN Valid;
+	BOOLEAN Retired;	/* unlinked, slot is reusable after the RCU grace period */
 	MulticastFilterEntryType type;	/* 0: static, 1: dynamic. */
 	ULONG lastTime;
 	UINT32 AgeOutTime;
 	PNET_DEV net_dev;
 	UCHAR Addr[MAC_ADDR_LEN];
-	LIST_HEADER MemberList;
+	UINT16 MemberCnt;
+	UINT32 MemberMap[MCAST_MEMBER_BITMAP_DWORD];	/* member stations, indexed by WCID */
+#ifdef IGMP_TVM_SUPPORT
+	UINT32 TVMEnableMap[MCAST_MEMBER_BITMAP_DWORD];
+	UINT32 TVMAutoMap[MCAST_MEMBER_BITMAP_DWORD];
+#endif /* IGMP_TVM_SUPPORT */
+#ifdef A4_CONN
+	UINT32 MWDSMap[MCAST_MEMBER_BITMAP_DWORD];	/* members on MWDS link */
+#endif
+	RTMP_OS_RCU_HEAD rcu;
 	struct _MULTICAST_FILTER_TABLE_ENTRY *pNext;
 } MULTICAST_FILTER_TABLE_ENTRY, *PMULTICAST_FILTER_TABLE_ENTRY;
 
+/* static member set by iwpriv before the station associated, kept by MAC until it does */
+typedef struct _MULTICAST_FILTER_PENDING_MEMBER {
+	BOOLEAN Valid;
+	UINT8 type;
+	PNET_DEV net_dev;
+	UCHAR GrpId[MAC_ADDR_LEN];
+	UCHAR MemberAddr[MAC_ADDR_LEN];
+} MULTICAST_FILTER_PENDING_MEMBER, *PMULTICAST_FILTER_PENDING_MEMBER;
+
 typedef struct _MULTICAST_FILTER_TABLE {
 	UCHAR Size;
 
 	PMULTICAST_FILTER_TABLE_ENTRY
 	Hash[MAX_LEN_OF_MULTICAST_FILTER_HASH_TABLE];
 	MULTICAST_FILTER_TABLE_ENTRY Content[MAX_LEN_OF_MULTICAST_FILTER_TABLE];
+	MULTICAST_FILTER_PENDING_MEMBER PendingMember[MULTICAST_PENDING_MEMBER_SIZE];
 	NDIS_SPIN_LOCK MulticastFilterTabLock;
-	NDIS_SPIN_LOCK FreeMemberPoolTabLock;
-	MEMBER_ENTRY freeMemberPool[FREE_MEMBER_POOL_SIZE];
-	LIST_HEADER freeEntryList;
 } MULTICAST_FILTER_TABLE, *PMULTICAST_FILTER_TABLE;
 #endif /* IGMP_SNOOP_SUPPORT */
 
@@ -5661,6 +5667,7 @@ struct _RTMP_ADAPTER {
 
 	NDIS_SPIN_LOCK WdevListLock;
 	struct wifi_dev *wdev_list[WDEV_NUM_MAX];
+	VOID *BcnUpdateDeferOwner;	/* task coalescing BCN_UPDATE_IE_CHG, see UpdateBeaconDefer */
 
 	/*About MacTab, the sta driver will use #0 and #1 for multicast and AP. */
 	MAC_TABLE MacTab;	/* ASIC on-chip WCID entry table.  At TX, ASIC always use key according to this on-chip table. */
@@ -7704,6 +7711,9 @@ INT RTMPGetKeyParameterWithOffset(
 	IN  RTMP_STRING *buffer,
 	IN	BOOLEAN	bTrimSpace);
 
+VOID RTMPProfileIndexBuild(RTMP_STRING *buffer);
+VOID RTMPProfileIndexRelease(RTMP_STRING *buffer);
+
 #ifdef MIN_PHY_RATE_SUPPORT
 VOID RTMPMinPhyDataRateCfg(
 	IN RTMP_ADAPTER *pAd,
@@ -11421,6 +11431,7 @@ VOID getIPMacTbInfo(MAT_STRUCT *pMatCfg, char *pOutBuf, ULONG BufLen);
 
 NDIS_STATUS MATEngineInit(RTMP_ADAPTER *pAd);
 NDIS_STATUS MATEngineExit(RTMP_ADAPTER *pAd);
+VOID MATEngineAgeOut(RTMP_ADAPTER *pAd);
 
 PUCHAR MATEngineRxHandle(RTMP_ADAPTER *pAd, PNDIS_PACKET pPkt, UINT infIdx);
 PUCHAR MATEngineTxHandle(RTMP_ADAPTER *pAd, PNDIS_PACKET pPkt, UINT infIdx, UCHAR OpMode);
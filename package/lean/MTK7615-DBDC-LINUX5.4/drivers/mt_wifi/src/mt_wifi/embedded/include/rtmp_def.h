@@ -175,6 +175,10 @@
 /* Size of hash tab must be power of 2. */
 #define MAX_LEN_OF_MULTICAST_FILTER_HASH_TABLE ((MAX_LEN_OF_MULTICAST_FILTER_TABLE) * 2)
 #define FREE_MEMBER_POOL_SIZE 64
+#define MCAST_MEMBER_BITMAP_SHIFT	(5)
+#define MCAST_MEMBER_BITMAP_MASK	(0x1F)
+#define MCAST_MEMBER_BITMAP_DWORD	((MAX_LEN_OF_MAC_TABLE + 31) / 32)
+#define MULTICAST_PENDING_MEMBER_SIZE	16
 #endif /* IGMP_SNOOP_SUPPORT */
 #endif /* CONFIG_AP_SUPPORT */
 
@@ -111,6 +111,13 @@ VOID ecc_point_mul_windowed(
 	IN struct __EC_GROUP_INFO_BI *ec_group_bi,
 	OUT BIG_INTEGER_EC_POINT * *ec_point_res);
 
+/* group 19 runs the fixed-width P-256 code, other groups ecc_point_mul_windowed */
+VOID ecc_point_mul(
+	IN BIG_INTEGER_EC_POINT * point,
+	IN SAE_BN *scalar,
+	IN struct __EC_GROUP_INFO_BI *ec_group_bi,
+	OUT BIG_INTEGER_EC_POINT * *ec_point_res);
+
 /* (x,y) => (x, p-y) */
 VOID ecc_point_inverse(
 	IN BIG_INTEGER_EC_POINT * point,
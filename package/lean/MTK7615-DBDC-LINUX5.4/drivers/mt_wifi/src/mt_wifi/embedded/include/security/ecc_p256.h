@@ -0,0 +1,39 @@
+#ifndef	__ECC_P256_H__
+#define	__ECC_P256_H__
+
+/*
+ * Fixed-width NIST P-256 (IKE group 19) arithmetic.
+ * All values are P256_LEN-byte big-endian octet strings, coordinates are affine.
+ */
+#define P256_LEN 32
+
+/* results of the point multiplications */
+#define P256_MUL_INFINITY	0
+#define P256_MUL_OK		1
+#define P256_MUL_NO_MEM		2
+
+/* (rx, ry) = scalar * (px, py), return one of P256_MUL_* */
+UCHAR p256_point_mul(
+	IN const UCHAR *scalar,
+	IN const UCHAR *px,
+	IN const UCHAR *py,
+	OUT UCHAR *rx,
+	OUT UCHAR *ry);
+
+/* (rx, ry) = scalar * G, return P256_MUL_OK or P256_MUL_INFINITY */
+UCHAR p256_point_mul_base(
+	IN const UCHAR *scalar,
+	OUT UCHAR *rx,
+	OUT UCHAR *ry);
+
+/* y^2 = x^3 - 3x + b, with 0 <= x, y < p */
+UCHAR p256_point_is_on_curve(
+	IN const UCHAR *px,
+	IN const UCHAR *py);
+
+/* return whether x^3 - 3x + b is a square, ry gets its root if not NULL */
+UCHAR p256_point_find_y(
+	IN const UCHAR *px,
+	OUT UCHAR *ry);
+
+#endif /* __ECC_P256_H__ */
@@ -134,7 +134,7 @@
 #define SAE_DEFAULT_GROUP_ECC 19
 #define SAE_DEFAULT_GROUP_FFC 5
 
-#define ECC_POINT_MUL(_point, _scalar, _ec_group_bi, _ec_point_res) ecc_point_mul_windowed(_point, _scalar, _ec_group_bi, _ec_point_res)
+#define ECC_POINT_MUL(_point, _scalar, _ec_group_bi, _ec_point_res) ecc_point_mul(_point, _scalar, _ec_group_bi, _ec_point_res)
 
 
 #define SET_NOTHING_STATE(_pSaeIns) \
@@ -1,6 +1,7 @@
 #include "rt_config.h"
 #include "security/sae_cmm.h"
 #include "security/ecc.h"
+#include "security/ecc_p256.h"
 
 EC_POINT_OP_TIME_RECORD ec_op_ti_rec;
 
@@ -676,7 +677,7 @@ VOID ecc_point_3d_to_2d(
 	SAE_BN *Z_1 = NULL;
 	SAE_BN *Z_2 = NULL;
 	SAE_BN *Z_3 = NULL;
-	SAE_BN *Z = ec_point_res->z;
+	SAE_BN *Z = NULL;
 	SAE_BN *res_x = NULL;
 	SAE_BN *res_y = NULL;
 	SAE_BN *res_z = NULL;
@@ -693,6 +694,8 @@ VOID ecc_point_3d_to_2d(
 		return;
 	}
 
+	Z = ec_point_res->z;
+
 	SAE_BN_INIT(&Z_1);
 	SAE_BN_INIT(&Z_2);
 	SAE_BN_INIT(&Z_3);
@@ -873,6 +876,86 @@ VOID ecc_point_mul_windowed(
 
 
 
+/* group 19 values fit in P256_LEN octets, anything longer is left to the generic code */
+static UCHAR ecc_bn_to_p256(
+	IN SAE_BN *bn,
+	OUT UCHAR *out)
+{
+	UINT32 len = P256_LEN;
+
+	if (bn == NULL || SAE_BN_GET_LEN(bn) > P256_LEN)
+		return FALSE;
+
+	SAE_BN_BI2BIN_WITH_PAD(bn, out, &len, P256_LEN);
+	return (len == P256_LEN);
+}
+
+/*
+ * fixed-width group 19 multiplication, FALSE if the generic path has to run
+ * instead, which includes running out of memory: a NULL result means infinity
+ */
+static UCHAR ecc_point_mul_p256(
+	IN BIG_INTEGER_EC_POINT *point,
+	IN SAE_BN *scalar,
+	IN EC_GROUP_INFO_BI *ec_group_bi,
+	OUT BIG_INTEGER_EC_POINT **ec_point_res)
+{
+	BIG_INTEGER_EC_POINT *affine = NULL;
+	UCHAR k[P256_LEN];
+	UCHAR x[P256_LEN];
+	UCHAR y[P256_LEN];
+	UCHAR res_x[P256_LEN];
+	UCHAR res_y[P256_LEN];
+	UCHAR res;
+	UCHAR ret = FALSE;
+
+	if (!point->z_is_one && point->z) {
+		ecc_point_copy(point, &affine);
+		SAE_ECC_3D_to_2D(ec_group_bi, affine);
+		point = affine;
+	}
+
+	if (ecc_bn_to_p256(scalar, k)
+		&& ecc_bn_to_p256(point->x, x)
+		&& ecc_bn_to_p256(point->y, y)) {
+		SAE_LOG_TIME_BEGIN(&ec_op_ti_rec.mul_op);
+
+		if (SAE_BN_UCMP(point->x, ec_group_bi->gx) == 0
+			&& SAE_BN_UCMP(point->y, ec_group_bi->gy) == 0)
+			res = p256_point_mul_base(k, res_x, res_y);
+		else
+			res = p256_point_mul(k, x, y, res_x, res_y);
+
+		if (res == P256_MUL_OK) {
+			ecc_point_init(ec_point_res);
+			SAE_BN_BIN2BI(res_x, P256_LEN, &(*ec_point_res)->x);
+			SAE_BN_BIN2BI(res_y, P256_LEN, &(*ec_point_res)->y);
+			SAE_ECC_SET_Z_TO_1(*ec_point_res);
+		} else if (res == P256_MUL_INFINITY)
+			ecc_point_free(ec_point_res);
+
+		SAE_LOG_TIME_END(&ec_op_ti_rec.mul_op);
+		ret = (res != P256_MUL_NO_MEM);
+	}
+
+	NdisZeroMemory(k, sizeof(k));
+	ecc_point_free(&affine);
+	return ret;
+}
+
+VOID ecc_point_mul(
+	IN BIG_INTEGER_EC_POINT *point,
+	IN SAE_BN *scalar,
+	IN EC_GROUP_INFO_BI *ec_group_bi,
+	OUT BIG_INTEGER_EC_POINT **ec_point_res)
+{
+	if (ec_group_bi->group_id == 19 && point
+		&& ecc_point_mul_p256(point, scalar, ec_group_bi, ec_point_res))
+		return;
+
+	ecc_point_mul_windowed(point, scalar, ec_group_bi, ec_point_res);
+}
+
 /* (x,y) => (x, p-y) */
 VOID ecc_point_inverse(
 	IN BIG_INTEGER_EC_POINT *point,
@@ -908,6 +991,22 @@ UCHAR ecc_point_is_on_curve(
 	MTWF_LOG(DBG_CAT_SEC, CATSEC_SAE, DBG_LVL_TRACE,
 			 ("==> %s()\n", __func__));
 
+	if (ec_group_bi->group_id == 19) {
+		UCHAR x[P256_LEN];
+		UCHAR y[P256_LEN];
+
+		/* coordinates have to be reduced, x or y >= p is rejected here */
+		if (!ecc_bn_to_p256(point->x, x) || !ecc_bn_to_p256(point->y, y))
+			return FALSE;
+
+		SAE_LOG_TIME_BEGIN(&ec_op_ti_rec.on_curve_check_op);
+		res = p256_point_is_on_curve(x, y);
+		SAE_LOG_TIME_END(&ec_op_ti_rec.on_curve_check_op);
+		MTWF_LOG(DBG_CAT_SEC, CATSEC_SAE, DBG_LVL_TRACE,
+				 ("%s(): res = %d\n", __func__, res));
+		return res;
+	}
+
 	POOL_COUNTER_CHECK_BEGIN(sae_expected_cnt[12]);
 	GET_BI_INS_FROM_POOL(right);
 	GET_BI_INS_FROM_POOL(left);
@@ -1021,6 +1120,22 @@ UCHAR ecc_point_find_by_x(
 	MTWF_LOG(DBG_CAT_SEC, CATSEC_SAE, DBG_LVL_INFO,
 			 ("==> %s()\n", __func__));
 
+	if (ec_group_bi->group_id == 19) {
+		UCHAR px[P256_LEN];
+		UCHAR py[P256_LEN];
+
+		if (ecc_bn_to_p256(x, px)) {
+			SAE_LOG_TIME_BEGIN(&ec_op_ti_rec.find_y_op);
+			has_y = p256_point_find_y(px, need_res_y ? py : NULL);
+
+			if (need_res_y && has_y)
+				SAE_BN_BIN2BI(py, P256_LEN, res_y);
+
+			SAE_LOG_TIME_END(&ec_op_ti_rec.find_y_op);
+			return has_y;
+		}
+	}
+
 	SAE_LOG_TIME_BEGIN(&ec_op_ti_rec.find_y_op);
 	SAE_BN_MOD_SQR(x, ec_group_bi->prime, &res); /* x^2 */
 	SAE_BN_MOD_ADD(res, ec_group_bi->a, ec_group_bi->prime, &res); /* X^2+a */
@@ -0,0 +1,744 @@
+#include "rt_config.h"
+#include "security/ecc_p256.h"
+
+/*
+ * NIST P-256 over eight 32-bit limbs, least significant limb first.
+ * Field elements are kept in Montgomery form (R = 2^256) and points in
+ * homogeneous projective coordinates, using the complete a = -3 formulas of
+ * Renes, Costello and Batina (eprint 2015/1060) so that doubling, infinity
+ * and P + P need no special case.  Nothing below branches on or indexes
+ * memory with secret data.
+ */
+#define P256_LIMBS 8
+
+typedef UINT32 P256_FE[P256_LIMBS];
+
+typedef struct _P256_POINT {
+	P256_FE x;
+	P256_FE y;
+	P256_FE z;
+} P256_POINT;
+
+static const P256_FE p256_p = {
+	0xffffffff, 0xffffffff, 0xffffffff, 0x00000000,
+	0x00000000, 0x00000000, 0x00000001, 0xffffffff
+};
+
+/* R mod p */
+static const P256_FE p256_one = {
+	0x00000001, 0x00000000, 0x00000000, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xfffffffe, 0x00000000
+};
+
+/* R^2 mod p */
+static const P256_FE p256_rr = {
+	0x00000003, 0x00000000, 0xffffffff, 0xfffffffb,
+	0xfffffffe, 0xffffffff, 0xfffffffd, 0x00000004
+};
+
+/* b * R mod p */
+static const P256_FE p256_b = {
+	0x29c4bddf, 0xd89cdf62, 0x78843090, 0xacf005cd,
+	0xf7212ed6, 0xe5a220ab, 0x04874834, 0xdc30061d
+};
+
+/*
+ * Comb table for the generator, affine and in Montgomery form:
+ * p256_base_comb[t][j - 1] = 2^(32t) * sum(2^(64i) * G for bit i set in j).
+ */
+static const P256_FE p256_base_comb[2][15][2] = {
+	{
+		{{0x18a9143c, 0x79e730d4, 0x5fedb601, 0x75ba95fc,
+		  0x77622510, 0x79fb732b, 0xa53755c6, 0x18905f76},
+		 {0xce95560a, 0xddf25357, 0xba19e45c, 0x8b4ab8e4,
+		  0xdd21f325, 0xd2e88688, 0x25885d85, 0x8571ff18}},
+		{{0x16a0d2bb, 0x4f922fc5, 0x1a623499, 0x0d5cc16c,
+		  0x57c62c8b, 0x9241cf3a, 0xfd1b667f, 0x2f5e6961},
+		 {0xf5a01797, 0x5c15c70b, 0x60956192, 0x3d20b44d,
+		  0x071fdb52, 0x04911b37, 0x8d6f0f7b, 0xf648f916}},
+		{{0xe137bbbc, 0x9e566847, 0x8a6a0bec, 0xe434469e,
+		  0x79d73463, 0xb1c42761, 0x133d0015, 0x5abe0285},
+		 {0xc04c7dab, 0x92aa837c, 0x43260c07, 0x573d9f4c,
+		  0x78e6cc37, 0x0c931562, 0x6b6f7383, 0x94bb725b}},
+		{{0xbfe20925, 0x62a8c244, 0x8fdce867, 0x91c19ac3,
+		  0xdd387063, 0x5a96a5d5, 0x21d324f6, 0x61d587d4},
+		 {0xa37173ea, 0xe87673a2, 0x53778b65, 0x23848008,
+		  0x05bab43e, 0x10f8441e, 0x4621efbe, 0xfa11fe12}},
+		{{0x2cb19ffd, 0x1c891f2b, 0xb1923c23, 0x01ba8d5b,
+		  0x8ac5ca8e, 0xb6d03d67, 0x1f13bedc, 0x586eb04c},
+		 {0x27e8ed09, 0x0c35c6e5, 0x1819ede2, 0x1e81a33c,
+		  0x56c652fa, 0x278fd6c0, 0x70864f11, 0x19d5ac08}},
+		{{0xd2b533d5, 0x62577734, 0xa1bdddc0, 0x673b8af6,
+		  0xa79ec293, 0x577e7c9a, 0xc3b266b1, 0xbb6de651},
+		 {0xb65259b3, 0xe7e9303a, 0xd03a7480, 0xd6a0afd3,
+		  0x9b3cfc27, 0xc5ac83d1, 0x5d18b99b, 0x60b4619a}},
+		{{0x1ae5aa1c, 0xbd6a38e1, 0x49e73658, 0xb8b7652b,
+		  0xee5f87ed, 0x0b130014, 0xaeebffcd, 0x9d0f27b2},
+		 {0x7a730a55, 0xca924631, 0xddbbc83a, 0x9c955b2f,
+		  0xac019a71, 0x07c1dfe0, 0x356ec48d, 0x244a566d}},
+		{{0xf4f8b16a, 0x56f8410e, 0xc47b266a, 0x97241afe,
+		  0x6d9c87c1, 0x0a406b8e, 0xcd42ab1b, 0x803f3e02},
+		 {0x04dbec69, 0x7f0309a8, 0x3bbad05f, 0xa83b85f7,
+		  0xad8e197f, 0xc6097273, 0x5067adc1, 0xc097440e}},
+		{{0xc379ab34, 0x846a56f2, 0x841df8d1, 0xa8ee068b,
+		  0x176c68ef, 0x20314459, 0x915f1f30, 0xf1af32d5},
+		 {0x5d75bd50, 0x99c37531, 0xf72f67bc, 0x837cffba,
+		  0x48d7723f, 0x0613a418, 0xe2d41c8b, 0x23d0f130}},
+		{{0xd5be5a2b, 0xed93e225, 0x5934f3c6, 0x6fe79983,
+		  0x22626ffc, 0x43140926, 0x7990216a, 0x50bbb4d9},
+		 {0xe57ec63e, 0x378191c6, 0x181dcdb2, 0x65422c40,
+		  0x0236e0f6, 0x41a8099b, 0x01fe49c3, 0x2b100118}},
+		{{0x9b391593, 0xfc68b5c5, 0x598270fc, 0xc385f5a2,
+		  0xd19adcbb, 0x7144f3aa, 0x83fbae0c, 0xdd558999},
+		 {0x74b82ff4, 0x93b88b8e, 0x71e734c9, 0xd2e03c40,
+		  0x43c0322a, 0x9a7a9eaf, 0x149d6041, 0xe6e4c551}},
+		{{0x80ec21fe, 0x5fe14bfe, 0xc255be82, 0xf6ce116a,
+		  0x2f4a5d67, 0x98bc5a07, 0xdb7e63af, 0xfad27148},
+		 {0x29ab05b3, 0x90c0b6ac, 0x4e251ae6, 0x37a9a83c,
+		  0xc2aade7d, 0x0a7dc875, 0x9f0e1a84, 0x77387de3}},
+		{{0xa56c0dd7, 0x1e9ecc49, 0x46086c74, 0xa5cffcd8,
+		  0xf505aece, 0x8f7a1408, 0xbef0c47e, 0xb37b85c0},
+		 {0xcc0e6a8f, 0x3596b6e4, 0x6b388f23, 0xfd6d4bbf,
+		  0xc39cef4e, 0xaba453fa, 0xf9f628d5, 0x9c135ac8}},
+		{{0x95c8f8be, 0x0a1c7294, 0x3bf362bf, 0x2961c480,
+		  0xdf63d4ac, 0x9e418403, 0x91ece900, 0xc109f9cb},
+		 {0x58945705, 0xc2d095d0, 0xddeb85c0, 0xb9083d96,
+		  0x7a40449b, 0x84692b8d, 0x2eee1ee1, 0x9bc3344f}},
+		{{0x42913074, 0x0d5ae356, 0x48a542b1, 0x55491b27,
+		  0xb310732a, 0x469ca665, 0x5f1a4cc1, 0x29591d52},
+		 {0xb84f983f, 0xe76f5b6b, 0x9f5f84e1, 0xbe7eef41,
+		  0x80baa189, 0x1200d496, 0x18ef332c, 0x6376551f}},
+	},
+	{
+		{{0x4147519a, 0x20288602, 0x26b372f0, 0xd0981eac,
+		  0xa785ebc8, 0xa9d4a7ca, 0xdbdf58e9, 0xd953c50d},
+		 {0xfd590f8f, 0x9d6361cc, 0x44e6c917, 0x72e9626b,
+		  0x22eb64cf, 0x7fd96110, 0x9eb288f3, 0x863ebb7e}},
+		{{0xb0e63d34, 0x4fe7ee31, 0xa9e54fab, 0xf4600572,
+		  0xd5e7b5a4, 0xc0493334, 0x06d54831, 0x8589fb92},
+		 {0x6583553a, 0xaa70f5cc, 0xe25649e5, 0x0879094a,
+		  0x10044652, 0xcc904507, 0x02541c4f, 0xebb0696d}},
+		{{0x3b89da99, 0xabbaa0c0, 0xb8284022, 0xa6f2d79e,
+		  0xb81c05e8, 0x27847862, 0x05e54d63, 0x337a4b59},
+		 {0x21f7794a, 0x3c67500d, 0x7d6d7f61, 0x207005b7,
+		  0x04cfd6e8, 0x0a5a3781, 0xf4c2fbd6, 0x0d65e0d5}},
+		{{0x6d3549cf, 0xd433e50f, 0xfacd665e, 0x6f33696f,
+		  0xce11fcb4, 0x695bfdac, 0xaf7c9860, 0x810ee252},
+		 {0x7159bb2c, 0x65450fe1, 0x758b357b, 0xf7dfbebe,
+		  0xd69fea72, 0x2b057e74, 0x92731745, 0xd485717a}},
+		{{0xe83f7669, 0xce1f69bb, 0x72877d6b, 0x09f8ae82,
+		  0x3244278d, 0x9548ae54, 0xe3c2c19c, 0x207755de},
+		 {0x6fef1945, 0x87bd61d9, 0xb12d28c3, 0x18813cef,
+		  0x72df64aa, 0x9fbcd1d6, 0x7154b00d, 0x48dc5ee5}},
+		{{0xf49a3154, 0xef0f469e, 0x6e2b2e9a, 0x3e85a595,
+		  0xaa924a9c, 0x45aaec1e, 0xa09e4719, 0xaa12dfc8},
+		 {0x4df69f1d, 0x26f27227, 0xa2ff5e73, 0xe0e4c82c,
+		  0xb7a9dd44, 0xb9d8ce73, 0xe48ca901, 0x6c036e73}},
+		{{0xa47153f0, 0xe1e421e1, 0x920418c9, 0xb86c3b79,
+		  0x705d7672, 0x93bdce87, 0xcab79a77, 0xf25ae793},
+		 {0x6d869d0c, 0x1f3194a3, 0x4986c264, 0x9d55c882,
+		  0x096e945e, 0x49fb5ea3, 0x13db0a3e, 0x39b8e653}},
+		{{0x35d0b34a, 0xe3417bc0, 0x8327c0a7, 0x440b386b,
+		  0xac0362d1, 0x8fb7262d, 0xe0cdf943, 0x2c41114c},
+		 {0xad95a0b1, 0x2ba5cef1, 0x67d54362, 0xc09b37a8,
+		  0x01e486c9, 0x26d6cdd2, 0x42ff9297, 0x20477abf}},
+		{{0xbc0a67d2, 0x0f121b41, 0x444d248a, 0x62d4760a,
+		  0x659b4737, 0x0e044f1d, 0x250bb4a8, 0x08fde365},
+		 {0x848bf287, 0xaceec3da, 0xd3369d6e, 0xc2a62182,
+		  0x92449482, 0x3582dfdc, 0x565d6cd7, 0x2f7e2fd2}},
+		{{0x178a876b, 0x0a0122b5, 0x085104b4, 0x51ff96ff,
+		  0x14f29f76, 0x050b31ab, 0x5f87d4e6, 0x84abb28b},
+		 {0x8270790a, 0xd5ed439f, 0x85e3f46b, 0x2d6cb59d,
+		  0x6c1e2212, 0x75f55c1b, 0x17655640, 0xe5436f67}},
+		{{0x9aeb596d, 0xc2965ecc, 0x023c92b4, 0x01ea03e7,
+		  0x2e013961, 0x4704b4b6, 0x905ea367, 0x0ca8fd3f},
+		 {0x551b2b61, 0x92523a42, 0x390fcd06, 0x1eb7a89c,
+		  0x0392a63e, 0xe7f1d2be, 0x4ddb0c33, 0x96dca264}},
+		{{0x15339848, 0x231c210e, 0x70778c8d, 0xe87a28e8,
+		  0x6956e170, 0x9d1de661, 0x2bb09c0b, 0x4ac3c938},
+		 {0x6998987d, 0x19be0551, 0xae09f4d6, 0x8b2376c4,
+		  0x1a3f933d, 0x1de0b765, 0xe39705f4, 0x380d94c7}},
+		{{0x8c31c31d, 0x3685954b, 0x5bf21a0c, 0x68533d00,
+		  0x75c79ec9, 0x0bd7626e, 0x42c69d54, 0xca177547},
+		 {0xf6d2dbb2, 0xcc6edaff, 0x174a9d18, 0xfd0d8cbd,
+		  0xaa4578e8, 0x875e8793, 0x9cab2ce6, 0xa976a713}},
+		{{0xb43ea1db, 0xce37ab11, 0x5259d292, 0x0a7ff1a9,
+		  0x8f84f186, 0x851b0221, 0xdefaad13, 0xa7222bea},
+		 {0x2b0a9144, 0xa2ac78ec, 0xf2fa59c5, 0x5a024051,
+		  0x6147ce38, 0x91d1eca5, 0xbc2ac690, 0xbe94d523}},
+		{{0x79ec1a0f, 0x2d8daefd, 0xceb39c97, 0x3bbcd6fd,
+		  0x58f61a95, 0xf5575ffc, 0xadf7b420, 0xdbd986c4},
+		 {0x15f39eb7, 0x81aa8814, 0xb98d976c, 0x6ee2fcf5,
+		  0xcf2f717d, 0x5465475d, 0x6860bbd0, 0x8e24d3c4}},
+	},
+};
+
+static inline UINT32 p256_ct_eq(UINT32 a, UINT32 b)
+{
+	UINT32 x = a ^ b;
+
+	/* all ones when a == b, zero otherwise */
+	return ((x | (0 - x)) >> 31) - 1;
+}
+
+static inline VOID p256_fe_copy(P256_FE r, const P256_FE a)
+{
+	INT i;
+
+	for (i = 0; i < P256_LIMBS; i++)
+		r[i] = a[i];
+}
+
+/* r = (carry:a) mod p, for (carry:a) < 2p */
+static VOID p256_fe_reduce_once(P256_FE r, const UINT32 *a, UINT32 carry)
+{
+	P256_FE t;
+	UINT64 d;
+	UINT32 borrow = 0;
+	UINT32 mask;
+	INT i;
+
+	for (i = 0; i < P256_LIMBS; i++) {
+		d = (UINT64)a[i] - p256_p[i] - borrow;
+		t[i] = (UINT32)d;
+		borrow = (UINT32)(d >> 32) & 1;
+	}
+
+	/* keep a only when it is below p */
+	mask = 0 - (borrow & (carry ^ 1));
+
+	for (i = 0; i < P256_LIMBS; i++)
+		r[i] = (a[i] & mask) | (t[i] & ~mask);
+}
+
+static VOID p256_fe_add(P256_FE r, const P256_FE a, const P256_FE b)
+{
+	P256_FE t;
+	UINT64 s;
+	UINT32 carry = 0;
+	INT i;
+
+	for (i = 0; i < P256_LIMBS; i++) {
+		s = (UINT64)a[i] + b[i] + carry;
+		t[i] = (UINT32)s;
+		carry = (UINT32)(s >> 32);
+	}
+
+	p256_fe_reduce_once(r, t, carry);
+}
+
+static VOID p256_fe_sub(P256_FE r, const P256_FE a, const P256_FE b)
+{
+	P256_FE t;
+	UINT64 d;
+	UINT32 borrow = 0;
+	UINT32 mask;
+	INT i;
+
+	for (i = 0; i < P256_LIMBS; i++) {
+		d = (UINT64)a[i] - b[i] - borrow;
+		t[i] = (UINT32)d;
+		borrow = (UINT32)(d >> 32) & 1;
+	}
+
+	/* add p back when a < b */
+	mask = 0 - borrow;
+	borrow = 0;
+
+	for (i = 0; i < P256_LIMBS; i++) {
+		d = (UINT64)t[i] + (p256_p[i] & mask) + borrow;
+		r[i] = (UINT32)d;
+		borrow = (UINT32)(d >> 32);
+	}
+}
+
+/*
+ * Montgomery product r = a * b / R mod p (CIOS).  -p^-1 mod 2^32 is 1 for
+ * this prime, so the per-word quotient is just the low word.
+ */
+static VOID p256_fe_mul(P256_FE r, const P256_FE a, const P256_FE b)
+{
+	UINT32 t[P256_LIMBS + 2] = {0};
+	UINT64 s;
+	UINT32 c;
+	UINT32 m;
+	INT i, j;
+
+	for (i = 0; i < P256_LIMBS; i++) {
+		c = 0;
+
+		for (j = 0; j < P256_LIMBS; j++) {
+			s = (UINT64)a[j] * b[i] + t[j] + c;
+			t[j] = (UINT32)s;
+			c = (UINT32)(s >> 32);
+		}
+
+		s = (UINT64)t[P256_LIMBS] + c;
+		t[P256_LIMBS] = (UINT32)s;
+		t[P256_LIMBS + 1] = (UINT32)(s >> 32);
+
+		m = t[0];
+		s = (UINT64)m * p256_p[0] + t[0];
+		c = (UINT32)(s >> 32);
+
+		for (j = 1; j < P256_LIMBS; j++) {
+			s = (UINT64)m * p256_p[j] + t[j] + c;
+			t[j - 1] = (UINT32)s;
+			c = (UINT32)(s >> 32);
+		}
+
+		s = (UINT64)t[P256_LIMBS] + c;
+		t[P256_LIMBS - 1] = (UINT32)s;
+		t[P256_LIMBS] = t[P256_LIMBS + 1] + (UINT32)(s >> 32);
+	}
+
+	p256_fe_reduce_once(r, t, t[P256_LIMBS]);
+}
+
+static inline VOID p256_fe_sqr(P256_FE r, const P256_FE a)
+{
+	p256_fe_mul(r, a, a);
+}
+
+static VOID p256_fe_sqr_n(P256_FE r, const P256_FE a, INT n)
+{
+	p256_fe_sqr(r, a);
+
+	while (--n > 0)
+		p256_fe_sqr(r, r);
+}
+
+static VOID p256_fe_to_mont(P256_FE r, const P256_FE a)
+{
+	p256_fe_mul(r, a, p256_rr);
+}
+
+static VOID p256_fe_from_mont(P256_FE r, const P256_FE a)
+{
+	static const P256_FE one = {1};
+
+	p256_fe_mul(r, a, one);
+}
+
+static UINT32 p256_fe_is_zero(const P256_FE a)
+{
+	UINT32 acc = 0;
+	INT i;
+
+	for (i = 0; i < P256_LIMBS; i++)
+		acc |= a[i];
+
+	return p256_ct_eq(acc, 0);
+}
+
+static UINT32 p256_fe_equal(const P256_FE a, const P256_FE b)
+{
+	UINT32 acc = 0;
+	INT i;
+
+	for (i = 0; i < P256_LIMBS; i++)
+		acc |= a[i] ^ b[i];
+
+	return p256_ct_eq(acc, 0);
+}
+
+static VOID p256_load(UINT32 *r, const UCHAR *in)
+{
+	const UCHAR *w;
+	INT i;
+
+	for (i = 0; i < P256_LIMBS; i++) {
+		w = in + (P256_LIMBS - 1 - i) * 4;
+		r[i] = ((UINT32)w[0] << 24) | ((UINT32)w[1] << 16) |
+			   ((UINT32)w[2] << 8) | w[3];
+	}
+}
+
+static VOID p256_store(UCHAR *out, const UINT32 *a)
+{
+	UCHAR *w;
+	INT i;
+
+	for (i = 0; i < P256_LIMBS; i++) {
+		w = out + (P256_LIMBS - 1 - i) * 4;
+		w[0] = (UCHAR)(a[i] >> 24);
+		w[1] = (UCHAR)(a[i] >> 16);
+		w[2] = (UCHAR)(a[i] >> 8);
+		w[3] = (UCHAR)a[i];
+	}
+}
+
+/* r = in mod p in Montgomery form, return whether in was already below p */
+static UCHAR p256_fe_from_bytes(P256_FE r, const UCHAR *in)
+{
+	P256_FE t;
+	UINT64 d;
+	UINT32 borrow = 0;
+	INT i;
+
+	p256_load(t, in);
+
+	for (i = 0; i < P256_LIMBS; i++) {
+		d = (UINT64)t[i] - p256_p[i] - borrow;
+		borrow = (UINT32)(d >> 32) & 1;
+	}
+
+	p256_fe_reduce_once(t, t, 0);
+	p256_fe_to_mont(r, t);
+	return borrow ? TRUE : FALSE;
+}
+
+static VOID p256_fe_to_bytes(UCHAR *out, const P256_FE a)
+{
+	P256_FE t;
+
+	p256_fe_from_mont(t, a);
+	p256_store(out, t);
+}
+
+/* r = a^(2^n - 1) helpers shared by inversion and square root */
+static VOID p256_fe_pow_x32(P256_FE x32, P256_FE x30, P256_FE x2, const P256_FE a)
+{
+	P256_FE x3, x6, x12, x15, t;
+
+	p256_fe_sqr(t, a);
+	p256_fe_mul(x2, t, a);
+	p256_fe_sqr(t, x2);
+	p256_fe_mul(x3, t, a);
+	p256_fe_sqr_n(t, x3, 3);
+	p256_fe_mul(x6, t, x3);
+	p256_fe_sqr_n(t, x6, 6);
+	p256_fe_mul(x12, t, x6);
+	p256_fe_sqr_n(t, x12, 3);
+	p256_fe_mul(x15, t, x3);
+	p256_fe_sqr_n(t, x15, 15);
+	p256_fe_mul(x30, t, x15);
+	p256_fe_sqr_n(t, x30, 2);
+	p256_fe_mul(x32, t, x2);
+}
+
+/* r = a^(p - 2) = a^-1, fixed addition chain */
+static VOID p256_fe_inv(P256_FE r, const P256_FE a)
+{
+	P256_FE x32, x30, x2, t;
+
+	p256_fe_pow_x32(x32, x30, x2, a);
+	p256_fe_sqr_n(t, x32, 32);
+	p256_fe_mul(t, t, a);
+	p256_fe_sqr_n(t, t, 128);
+	p256_fe_mul(t, t, x32);
+	p256_fe_sqr_n(t, t, 32);
+	p256_fe_mul(t, t, x32);
+	p256_fe_sqr_n(t, t, 30);
+	p256_fe_mul(t, t, x30);
+	p256_fe_sqr_n(t, t, 2);
+	p256_fe_mul(r, t, a);
+}
+
+/* r = a^((p + 1) / 4), a square root of a when one exists */
+static VOID p256_fe_sqrt(P256_FE r, const P256_FE a)
+{
+	P256_FE x32, x30, x2, t;
+
+	p256_fe_pow_x32(x32, x30, x2, a);
+	p256_fe_sqr_n(t, x32, 32);
+	p256_fe_mul(t, t, a);
+	p256_fe_sqr_n(t, t, 96);
+	p256_fe_mul(t, t, a);
+	p256_fe_sqr_n(r, t, 94);
+}
+
+/* r = x^3 - 3x + b */
+static VOID p256_curve_rhs(P256_FE r, const P256_FE x)
+{
+	P256_FE t, x3;
+
+	p256_fe_sqr(t, x);
+	p256_fe_mul(x3, t, x);
+	p256_fe_add(t, x, x);
+	p256_fe_add(t, t, x);
+	p256_fe_sub(x3, x3, t);
+	p256_fe_add(r, x3, p256_b);
+}
+
+static VOID p256_point_set_infinity(P256_POINT *r)
+{
+	NdisZeroMemory(r, sizeof(*r));
+	p256_fe_copy(r->y, p256_one);
+}
+
+/* complete addition, algorithm 4 of eprint 2015/1060 */
+static VOID p256_point_add(P256_POINT *r, const P256_POINT *a, const P256_POINT *b)
+{
+	P256_FE t0, t1, t2, t3, t4, x3, y3, z3;
+
+	p256_fe_mul(t0, a->x, b->x);
+	p256_fe_mul(t1, a->y, b->y);
+	p256_fe_mul(t2, a->z, b->z);
+	p256_fe_add(t3, a->x, a->y);
+	p256_fe_add(t4, b->x, b->y);
+	p256_fe_mul(t3, t3, t4);
+	p256_fe_add(t4, t0, t1);
+	p256_fe_sub(t3, t3, t4);
+	p256_fe_add(t4, a->y, a->z);
+	p256_fe_add(x3, b->y, b->z);
+	p256_fe_mul(t4, t4, x3);
+	p256_fe_add(x3, t1, t2);
+	p256_fe_sub(t4, t4, x3);
+	p256_fe_add(x3, a->x, a->z);
+	p256_fe_add(y3, b->x, b->z);
+	p256_fe_mul(x3, x3, y3);
+	p256_fe_add(y3, t0, t2);
+	p256_fe_sub(y3, x3, y3);
+	p256_fe_mul(z3, p256_b, t2);
+	p256_fe_sub(x3, y3, z3);
+	p256_fe_add(z3, x3, x3);
+	p256_fe_add(x3, x3, z3);
+	p256_fe_sub(z3, t1, x3);
+	p256_fe_add(x3, t1, x3);
+	p256_fe_mul(y3, p256_b, y3);
+	p256_fe_add(t1, t2, t2);
+	p256_fe_add(t2, t1, t2);
+	p256_fe_sub(y3, y3, t2);
+	p256_fe_sub(y3, y3, t0);
+	p256_fe_add(t1, y3, y3);
+	p256_fe_add(y3, t1, y3);
+	p256_fe_add(t1, t0, t0);
+	p256_fe_add(t0, t1, t0);
+	p256_fe_sub(t0, t0, t2);
+	p256_fe_mul(t1, t4, y3);
+	p256_fe_mul(t2, t0, y3);
+	p256_fe_mul(y3, x3, z3);
+	p256_fe_add(y3, y3, t2);
+	p256_fe_mul(x3, t3, x3);
+	p256_fe_sub(x3, x3, t1);
+	p256_fe_mul(z3, t4, z3);
+	p256_fe_mul(t1, t3, t0);
+	p256_fe_add(z3, z3, t1);
+
+	p256_fe_copy(r->x, x3);
+	p256_fe_copy(r->y, y3);
+	p256_fe_copy(r->z, z3);
+}
+
+/* doubling, algorithm 6 of eprint 2015/1060 */
+static VOID p256_point_double(P256_POINT *r, const P256_POINT *a)
+{
+	P256_FE t0, t1, t2, t3, x3, y3, z3;
+
+	p256_fe_sqr(t0, a->x);
+	p256_fe_sqr(t1, a->y);
+	p256_fe_sqr(t2, a->z);
+	p256_fe_mul(t3, a->x, a->y);
+	p256_fe_add(t3, t3, t3);
+	p256_fe_mul(z3, a->x, a->z);
+	p256_fe_add(z3, z3, z3);
+	p256_fe_mul(y3, p256_b, t2);
+	p256_fe_sub(y3, y3, z3);
+	p256_fe_add(x3, y3, y3);
+	p256_fe_add(y3, x3, y3);
+	p256_fe_sub(x3, t1, y3);
+	p256_fe_add(y3, t1, y3);
+	p256_fe_mul(y3, x3, y3);
+	p256_fe_mul(x3, x3, t3);
+	p256_fe_add(t3, t2, t2);
+	p256_fe_add(t2, t2, t3);
+	p256_fe_mul(z3, p256_b, z3);
+	p256_fe_sub(z3, z3, t2);
+	p256_fe_sub(z3, z3, t0);
+	p256_fe_add(t3, z3, z3);
+	p256_fe_add(z3, z3, t3);
+	p256_fe_add(t3, t0, t0);
+	p256_fe_add(t0, t3, t0);
+	p256_fe_sub(t0, t0, t2);
+	p256_fe_mul(t0, t0, z3);
+	p256_fe_add(y3, y3, t0);
+	p256_fe_mul(t0, a->y, a->z);
+	p256_fe_add(t0, t0, t0);
+	p256_fe_mul(z3, t0, z3);
+	p256_fe_sub(x3, x3, z3);
+	p256_fe_mul(z3, t0, t1);
+	p256_fe_add(z3, z3, z3);
+	p256_fe_add(z3, z3, z3);
+
+	p256_fe_copy(r->x, x3);
+	p256_fe_copy(r->y, y3);
+	p256_fe_copy(r->z, z3);
+}
+
+/* r = table[idx], reading every entry */
+static VOID p256_point_select(P256_POINT *r, const P256_POINT *table, UINT32 n, UINT32 idx)
+{
+	UINT32 mask;
+	UINT32 i;
+	INT j;
+
+	NdisZeroMemory(r, sizeof(*r));
+
+	for (i = 0; i < n; i++) {
+		mask = p256_ct_eq(i, idx);
+
+		for (j = 0; j < P256_LIMBS; j++) {
+			r->x[j] |= table[i].x[j] & mask;
+			r->y[j] |= table[i].y[j] & mask;
+			r->z[j] |= table[i].z[j] & mask;
+		}
+	}
+}
+
+/* r = p256_base_comb[t][idx - 1], or infinity for idx 0 */
+static VOID p256_point_select_base(P256_POINT *r, INT t, UINT32 idx)
+{
+	UINT32 mask;
+	UINT32 i;
+	INT j;
+
+	p256_point_set_infinity(r);
+
+	for (i = 1; i <= 15; i++) {
+		mask = p256_ct_eq(i, idx);
+
+		for (j = 0; j < P256_LIMBS; j++) {
+			r->x[j] |= p256_base_comb[t][i - 1][0][j] & mask;
+			r->y[j] = (r->y[j] & ~mask) | (p256_base_comb[t][i - 1][1][j] & mask);
+			r->z[j] |= p256_one[j] & mask;
+		}
+	}
+}
+
+static UCHAR p256_point_to_affine(const P256_POINT *a, UCHAR *rx, UCHAR *ry)
+{
+	P256_FE zinv, t;
+
+	if (p256_fe_is_zero(a->z))
+		return FALSE;
+
+	p256_fe_inv(zinv, a->z);
+	p256_fe_mul(t, a->x, zinv);
+	p256_fe_to_bytes(rx, t);
+	p256_fe_mul(t, a->y, zinv);
+	p256_fe_to_bytes(ry, t);
+	return TRUE;
+}
+
+static inline UINT32 p256_scalar_bit(const UINT32 *k, INT n)
+{
+	return (k[n >> 5] >> (n & 31)) & 1;
+}
+
+/* fixed 4-bit windows over a 16-entry table of multiples of the point */
+UCHAR p256_point_mul(
+	IN const UCHAR *scalar,
+	IN const UCHAR *px,
+	IN const UCHAR *py,
+	OUT UCHAR *rx,
+	OUT UCHAR *ry)
+{
+	P256_POINT *table = NULL;
+	P256_POINT r, t;
+	UINT32 k[P256_LIMBS];
+	UINT32 idx;
+	UCHAR res;
+	INT i;
+
+	os_alloc_mem(NULL, (UCHAR **)&table, sizeof(P256_POINT) * 16);
+
+	if (table == NULL)
+		return P256_MUL_NO_MEM;
+
+	p256_load(k, scalar);
+	p256_point_set_infinity(&table[0]);
+	p256_fe_from_bytes(table[1].x, px);
+	p256_fe_from_bytes(table[1].y, py);
+	p256_fe_copy(table[1].z, p256_one);
+
+	for (i = 2; i < 16; i++) {
+		if (i & 1)
+			p256_point_add(&table[i], &table[i - 1], &table[1]);
+		else
+			p256_point_double(&table[i], &table[i / 2]);
+	}
+
+	p256_point_set_infinity(&r);
+
+	for (i = P256_LIMBS * 8 - 1; i >= 0; i--) {
+		p256_point_double(&r, &r);
+		p256_point_double(&r, &r);
+		p256_point_double(&r, &r);
+		p256_point_double(&r, &r);
+		idx = (k[i >> 3] >> ((i & 7) * 4)) & 0xf;
+		p256_point_select(&t, table, 16, idx);
+		p256_point_add(&r, &r, &t);
+	}
+
+	res = p256_point_to_affine(&r, rx, ry) ? P256_MUL_OK : P256_MUL_INFINITY;
+	os_free_mem(table);
+	return res;
+}
+
+/* two-table comb, 32 doublings */
+UCHAR p256_point_mul_base(
+	IN const UCHAR *scalar,
+	OUT UCHAR *rx,
+	OUT UCHAR *ry)
+{
+	P256_POINT r, t;
+	UINT32 k[P256_LIMBS];
+	UINT32 idx;
+	INT i;
+
+	p256_load(k, scalar);
+	p256_point_set_infinity(&r);
+
+	for (i = 31; i >= 0; i--) {
+		p256_point_double(&r, &r);
+		idx = p256_scalar_bit(k, i + 32) |
+			  (p256_scalar_bit(k, i + 96) << 1) |
+			  (p256_scalar_bit(k, i + 160) << 2) |
+			  (p256_scalar_bit(k, i + 224) << 3);
+		p256_point_select_base(&t, 1, idx);
+		p256_point_add(&r, &r, &t);
+		idx = p256_scalar_bit(k, i) |
+			  (p256_scalar_bit(k, i + 64) << 1) |
+			  (p256_scalar_bit(k, i + 128) << 2) |
+			  (p256_scalar_bit(k, i + 192) << 3);
+		p256_point_select_base(&t, 0, idx);
+		p256_point_add(&r, &r, &t);
+	}
+
+	return p256_point_to_affine(&r, rx, ry) ? P256_MUL_OK : P256_MUL_INFINITY;
+}
+
+UCHAR p256_point_is_on_curve(
+	IN const UCHAR *px,
+	IN const UCHAR *py)
+{
+	P256_FE x, y, left, right;
+
+	if (!p256_fe_from_bytes(x, px) || !p256_fe_from_bytes(y, py))
+		return FALSE;
+
+	p256_fe_sqr(left, y);
+	p256_curve_rhs(right, x);
+	return p256_fe_equal(left, right) ? TRUE : FALSE;
+}
+
+UCHAR p256_point_find_y(
+	IN const UCHAR *px,
+	OUT UCHAR *ry)
+{
+	P256_FE x, y, rhs, t;
+
+	p256_fe_from_bytes(x, px);
+	p256_curve_rhs(rhs, x);
+	p256_fe_sqrt(y, rhs);
+	p256_fe_sqr(t, y);
+
+	if (!p256_fe_equal(t, rhs))
+		return FALSE;
+
+	if (ry)
+		p256_fe_to_bytes(ry, y);
+
+	return TRUE;
+}
@@ -0,0 +1,56 @@
+#!/bin/sh
+#
+# Helpers for the userspace checks under embedded/tools, sourced by their
+# run.sh. They cut driver functions out of a source file so they can be
+# built with a shim.h that stands in for the driver headers.
+#
+
+# build flags of the checks that run under ASan and UBSan
+SANITIZE="-g -O1 -fsanitize=address,undefined -fno-sanitize-recover=all"
+
+# extract_funcs <file.c> <function>...
+#
+# Print the definitions of the named functions, in file order. A prototype
+# ends with ");" before any "{" and is skipped. Fails, naming them, if any
+# function has no definition.
+extract_funcs() {
+	src="$1"
+	shift
+	awk -v funcs="$*" -v src="$src" '
+		BEGIN { n = split(funcs, f); for (i = 1; i <= n; i++) want[f[i]] = 1 }
+		!body && !head && match($0, /^[A-Za-z][^;=]*[ *][A-Za-z_0-9]+\(/) {
+			name = substr($0, 1, index($0, "(") - 1); sub(/.*[ *]/, "", name)
+			if (name in want) { head = 1; buf = $0 }
+			if (head && /\);$/) head = 0
+			if (head) next
+		}
+		head && /\);$/ { head = 0; next }
+		head && /^{$/ { head = 0; body = 1; found[name] = 1; print buf; print; next }
+		head { buf = buf "\n" $0; next }
+		body { print; if (/^}$/) body = 0 }
+		END {
+			for (i = 1; i <= n; i++)
+				if (!(f[i] in found)) { print f[i] " not found in " src > "/dev/stderr"; bad = 1 }
+			exit bad
+		}
+	' "$src"
+}
+
+# extract_range <file.c> <first function> <last function>
+#
+# Print everything from the definition of the first function to the end of
+# the definition of the last one, with the types and statics in between.
+extract_range() {
+	awk -v first="$2" -v last="$3" -v src="$1" '
+		!done && match($0, /^[A-Za-z][^;=]*[ *][A-Za-z_0-9]+\(/) && !/\);$/ {
+			name = substr($0, 1, index($0, "(") - 1); sub(/.*[ *]/, "", name)
+			if (name == first) on = 1
+			if (on && name == last) end = 1
+		}
+		on { print }
+		end && /^}$/ { done = 1; exit }
+		END {
+			if (!done) { print first " to " last " not found in " src > "/dev/stderr"; exit 1 }
+		}
+	' "$1"
+}
@@ -0,0 +1,32 @@
+#!/bin/sh
+#
+# Check the multicast filter table against a reference model.
+#
+# The table functions are cut out of embedded/common/igmp_snoop.c and built
+# in userspace with shim.h, under ASan and UBSan, then driven by test.c.
+#
+# Usage: run.sh [operations] [seed]
+#
+
+dir="$(cd "$(dirname "$0")" && pwd)"
+. "$dir/../harness.sh"
+src="$dir/../../common/igmp_snoop.c"
+
+work="$(mktemp -d)"
+trap 'rm -rf "$work"' EXIT
+
+funcs="MulticastFilterEntryRcuFree MulticastFilterPendingMemberAdd MulticastFilterPendingMemberDel
+	MulticastFilterPendingMemberCnt MulticastFilterMemberAssociated MulticastFilterEntryUnlink
+	MulticastFilterEntryAged MulticastFilterEntryFind MulticastFilterMemberTVMode
+	MulticastFilterTableInsertEntry MulticastFilterTableDeleteEntry MulticastFilterTableLookup
+	MulticastFilterTableAgeOut InsertIgmpMember DeleteIgmpMember IgmpMemberCnt
+	IgmpGroupDelMembers IgmpGroupAddPendingMembers isMemberOnMWDSLink IgmpPktClone"
+
+{
+	echo '#include "shim.h"'
+	extract_funcs "$src" $funcs || exit 1
+} > "$work/table.c" || exit 1
+
+cc $SANITIZE -w -I"$dir" \
+	-o "$work/test" "$dir/test.c" "$work/table.c" || exit 1
+"$work/test" "$@"
@@ -0,0 +1,198 @@
+/*
+ * Userspace stand-ins for the parts of the driver the multicast filter
+ * table in common/igmp_snoop.c uses. The table structures mirror
+ * include/rtmp.h, the lock asserts it is never taken twice and call_rcu
+ * callbacks wait in a list until the test runs a grace period.
+ */
+#ifndef __IGMP_SNOOP_SHIM_H__
+#define __IGMP_SNOOP_SHIM_H__
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <stddef.h>
+#include <assert.h>
+
+#define IGMP_TVM_SUPPORT
+#define A4_CONN
+
+typedef unsigned char UCHAR, UINT8, BOOLEAN, *PUCHAR;
+typedef unsigned short USHORT, UINT16;
+typedef unsigned int UINT32, UINT;
+typedef int INT, NDIS_STATUS;
+typedef unsigned long ULONG;
+typedef void VOID;
+
+#define IN
+#define OUT
+#define TRUE	1
+#define FALSE	0
+
+#define MTWF_LOG(...)
+#define PRINT_MAC(a)	a[0], a[1], a[2], a[3], a[4], a[5]
+#define RTMP_OS_NETDEV_GET_DEVNAME(d)	"ra0"
+
+#define MAC_ADDR_LEN	6
+#define MAC_ADDR_EQUAL(a, b)	(!memcmp(a, b, MAC_ADDR_LEN))
+#define COPY_MAC_ADDR(a, b)	memcpy(a, b, MAC_ADDR_LEN)
+#define NdisZeroMemory(p, n)	memset(p, 0, n)
+#define container_of(p, t, m)	((t *)((char *)(p) - offsetof(t, m)))
+
+/* include/rtmp_def.h */
+#define MAX_LEN_OF_MAC_TABLE	128
+#define MAX_LEN_OF_MULTICAST_FILTER_TABLE 64
+#define MAX_LEN_OF_MULTICAST_FILTER_HASH_TABLE ((MAX_LEN_OF_MULTICAST_FILTER_TABLE) * 2)
+#define MCAST_MEMBER_BITMAP_SHIFT	(5)
+#define MCAST_MEMBER_BITMAP_MASK	(0x1F)
+#define MCAST_MEMBER_BITMAP_DWORD	((MAX_LEN_OF_MAC_TABLE + 31) / 32)
+#define MULTICAST_PENDING_MEMBER_SIZE	16
+#define MCAST_MEMBER_TEST(_map, _wcid)	((_map)[(_wcid) >> MCAST_MEMBER_BITMAP_SHIFT] & (1U << ((_wcid) & MCAST_MEMBER_BITMAP_MASK)))
+#define MCAST_MEMBER_SET(_map, _wcid)	((_map)[(_wcid) >> MCAST_MEMBER_BITMAP_SHIFT] |= (1U << ((_wcid) & MCAST_MEMBER_BITMAP_MASK)))
+#define MCAST_MEMBER_CLEAR(_map, _wcid)	((_map)[(_wcid) >> MCAST_MEMBER_BITMAP_SHIFT] &= ~(1U << ((_wcid) & MCAST_MEMBER_BITMAP_MASK)))
+#define MAC_ADDR_HASH(Addr)	(Addr[0] ^ Addr[1] ^ Addr[2] ^ Addr[3] ^ Addr[4] ^ Addr[5])
+#define MULTICAST_ADDR_HASH_INDEX(Addr)	(MAC_ADDR_HASH(Addr) & (MAX_LEN_OF_MULTICAST_FILTER_HASH_TABLE - 1))
+
+#define OS_HZ	100
+#define IGMPMAC_TB_ENTRY_AGEOUT_TIME	(120 * OS_HZ)
+extern ULONG shim_jiffies;
+#define NdisGetSystemUpTime(p)	(*(p) = shim_jiffies)
+#define RTMP_TIME_AFTER(a, b)	((long)((b) - (a)) < 0)
+
+typedef int NDIS_SPIN_LOCK;
+extern int shim_locked;
+#define RTMP_SEM_LOCK(l)	do { assert(!shim_locked); shim_locked = 1; } while (0)
+#define RTMP_SEM_UNLOCK(l)	do { assert(shim_locked); shim_locked = 0; } while (0)
+
+typedef struct rcu_head {
+	struct rcu_head *next;
+	void (*func)(struct rcu_head *);
+} RTMP_OS_RCU_HEAD;
+extern struct rcu_head *shim_rcu_pending;
+#define RTMP_RCU_DEREFERENCE(p)		(p)
+#define RTMP_RCU_ASSIGN_POINTER(p, v)	((p) = (v))
+#define RTMP_CALL_RCU(h, f) \
+	do { (h)->func = (f); (h)->next = shim_rcu_pending; shim_rcu_pending = (h); } while (0)
+
+typedef void *PNET_DEV;
+
+/* include/rtmp.h */
+typedef enum _MulticastFilterEntryType {
+	MCAT_FILTER_STATIC = 0,
+	MCAT_FILTER_DYNAMIC,
+	GROUP_ENTRY_TYPE_BITMASK = 0x0F,
+	MCAT_FILTER_TVM_ENABLE = 0x10,
+	MCAT_FILTER_TVM_AUTO = 0x20,
+	MCAT_FILTER_MWDS_CLI = 0x80
+} MulticastFilterEntryType;
+
+enum { IGMP_TVM_IE_MODE_AUTO = 0, IGMP_TVM_IE_MODE_ENABLE, IGMP_TVM_IE_MODE_DISABLE };
+enum { IGMP_TVM_MODE_DISABLE = 0, IGMP_TVM_MODE_ENABLE, IGMP_TVM_MODE_AUTO };
+
+typedef struct _MULTICAST_FILTER_TABLE_ENTRY {
+	BOOLEAN Valid;
+	BOOLEAN Retired;
+	MulticastFilterEntryType type;
+	ULONG lastTime;
+	UINT32 AgeOutTime;
+	PNET_DEV net_dev;
+	UCHAR Addr[MAC_ADDR_LEN];
+	UINT16 MemberCnt;
+	UINT32 MemberMap[MCAST_MEMBER_BITMAP_DWORD];
+	UINT32 TVMEnableMap[MCAST_MEMBER_BITMAP_DWORD];
+	UINT32 TVMAutoMap[MCAST_MEMBER_BITMAP_DWORD];
+	UINT32 MWDSMap[MCAST_MEMBER_BITMAP_DWORD];
+	RTMP_OS_RCU_HEAD rcu;
+	struct _MULTICAST_FILTER_TABLE_ENTRY *pNext;
+} MULTICAST_FILTER_TABLE_ENTRY, *PMULTICAST_FILTER_TABLE_ENTRY;
+
+typedef struct _MULTICAST_FILTER_PENDING_MEMBER {
+	BOOLEAN Valid;
+	UINT8 type;
+	PNET_DEV net_dev;
+	UCHAR GrpId[MAC_ADDR_LEN];
+	UCHAR MemberAddr[MAC_ADDR_LEN];
+} MULTICAST_FILTER_PENDING_MEMBER, *PMULTICAST_FILTER_PENDING_MEMBER;
+
+typedef struct _MULTICAST_FILTER_TABLE {
+	UCHAR Size;
+	PMULTICAST_FILTER_TABLE_ENTRY Hash[MAX_LEN_OF_MULTICAST_FILTER_HASH_TABLE];
+	MULTICAST_FILTER_TABLE_ENTRY Content[MAX_LEN_OF_MULTICAST_FILTER_TABLE];
+	MULTICAST_FILTER_PENDING_MEMBER PendingMember[MULTICAST_PENDING_MEMBER_SIZE];
+	NDIS_SPIN_LOCK MulticastFilterTabLock;
+} MULTICAST_FILTER_TABLE, *PMULTICAST_FILTER_TABLE;
+
+struct wifi_dev {
+	struct {
+		UCHAR ucBssIndex;
+	} bss_info_argument;
+	PNET_DEV if_dev;
+	UINT8 IsTVModeEnable;
+	UINT8 TVModeType;
+	UINT32 u4AgeOutTime;
+};
+
+#define ENTRY_NONE	0
+#define SST_ASSOC	3
+#define WPA_802_1X_PORT_SECURED	2
+
+typedef struct _MAC_TABLE_ENTRY {
+	int EntryType;
+	int Sst;
+	UCHAR Addr[MAC_ADDR_LEN];
+	struct wifi_dev *wdev;
+} MAC_TABLE_ENTRY;
+
+typedef struct _STA_TR_ENTRY {
+	int PortSecured;
+} STA_TR_ENTRY;
+
+#define IS_VALID_ENTRY(_x)	(((_x) != NULL) && ((_x)->EntryType != ENTRY_NONE))
+
+typedef struct _SHIM_PACKET {
+	UINT16 Wcid;
+	int McastClone;
+} *PNDIS_PACKET;
+
+struct _RTMP_ADAPTER;
+struct qm_ops {
+	void (*enq_dataq_pkt)(struct _RTMP_ADAPTER *, struct wifi_dev *, PNDIS_PACKET, UCHAR);
+};
+
+typedef struct _RTMP_ADAPTER {
+	PMULTICAST_FILTER_TABLE pMulticastFilterTable;
+	struct {
+		MAC_TABLE_ENTRY Content[MAX_LEN_OF_MAC_TABLE];
+		STA_TR_ENTRY tr_entry[MAX_LEN_OF_MAC_TABLE];
+	} MacTab;
+	struct qm_ops *qm_ops;
+	int MaxStaNum;
+} RTMP_ADAPTER, *PRTMP_ADAPTER;
+
+#define VALID_UCAST_ENTRY_WCID(_pAd, _wcid)	((_wcid) < (_pAd)->MaxStaNum)
+#define IS_ASIC_CAP(_pAd, _cap)	0
+
+#define IGMP_IN_GROUP	2
+#define NDIS_STATUS_SUCCESS	0
+#define NDIS_STATUS_FAILURE	1
+#define NDIS_STATUS_MORE_PROCESSING_REQUIRED	2
+#define MEM_ALLOC_FLAG	0
+
+#define OS_PKT_CLONE(_pAd, _pkt, _clone, _flag)	((_clone) = calloc(1, sizeof(*(_clone))))
+#define RTMP_SET_PACKET_WCID(_pkt, _wcid)	((_pkt)->Wcid = (_wcid))
+#define RTMP_SET_PACKET_MCAST_CLONE(_pkt, _v)	((_pkt)->McastClone = (_v))
+#define RTMP_SET_PACKET_UP(_pkt, _up)
+#define ba_ori_session_start(_pAd, _tr, _up)
+
+/* the software table is the arch op on chips without multicast offload */
+BOOLEAN MulticastFilterTableInsertEntry(PRTMP_ADAPTER, PUCHAR, UINT8, UINT8, PUCHAR, PNET_DEV, UINT8);
+BOOLEAN MulticastFilterTableDeleteEntry(PRTMP_ADAPTER, PUCHAR, UINT8, PUCHAR, PNET_DEV, UINT8);
+#define AsicMcastEntryInsert	MulticastFilterTableInsertEntry
+#define AsicMcastEntryDelete	MulticastFilterTableDeleteEntry
+
+static VOID InsertIgmpMember(PMULTICAST_FILTER_TABLE_ENTRY, UINT16, MulticastFilterEntryType);
+static VOID DeleteIgmpMember(PMULTICAST_FILTER_TABLE_ENTRY, UINT16);
+static BOOLEAN isMemberOnMWDSLink(PMULTICAST_FILTER_TABLE_ENTRY, UINT16);
+UINT16 IgmpMemberCnt(PMULTICAST_FILTER_TABLE_ENTRY);
+
+#endif /* __IGMP_SNOOP_SHIM_H__ */
@@ -0,0 +1,399 @@
+/*
+ * Random operations on the multicast filter table, checked against a
+ * reference model after each one: snooped joins and leaves, iwpriv static
+ * members of stations that are associated or not yet, association,
+ * disassociation, aging and the per-frame lookup with its unicast clones.
+ *
+ * Usage: test [operations] [seed]
+ */
+#include "shim.h"
+
+ULONG shim_jiffies;
+int shim_locked;
+struct rcu_head *shim_rcu_pending;
+
+NDIS_STATUS IgmpPktClone(PRTMP_ADAPTER, struct wifi_dev *, PNDIS_PACKET, INT,
+			 PMULTICAST_FILTER_TABLE_ENTRY, UCHAR, UINT8, PNET_DEV);
+PMULTICAST_FILTER_TABLE_ENTRY MulticastFilterTableLookup(PMULTICAST_FILTER_TABLE, PUCHAR, PNET_DEV);
+VOID MulticastFilterTableAgeOut(PRTMP_ADAPTER);
+VOID IgmpGroupDelMembers(PRTMP_ADAPTER, PUCHAR, struct wifi_dev *, UINT8);
+VOID IgmpGroupAddPendingMembers(PRTMP_ADAPTER, PUCHAR, struct wifi_dev *, UINT8);
+
+#define NUM_GROUP	12
+#define NUM_STA		48	/* more stations than WCIDs, some never associate */
+#define MAX_STA_NUM	32	/* WCID 0 is the multicast WCID, stations use 1..31 */
+#define AGEOUT		IGMPMAC_TB_ENTRY_AGEOUT_TIME
+
+static RTMP_ADAPTER ad;
+static MULTICAST_FILTER_TABLE table;
+static struct wifi_dev wd;
+static PNET_DEV dev = (PNET_DEV)&wd;
+
+static UCHAR grp_addr[NUM_GROUP][MAC_ADDR_LEN];
+static UCHAR sta_addr[NUM_STA][MAC_ADDR_LEN];
+static int sta_wcid[NUM_STA];	/* 0 while not associated */
+
+/* the model */
+static struct {
+	int valid;
+	int type;
+	ULONG last;
+	int member[MAX_LEN_OF_MAC_TABLE];	/* 0, 1 or 2 on a MWDS link */
+	int pending[NUM_STA];
+} ref[NUM_GROUP];
+static int ref_pending_cnt;
+
+static int clones[MAX_LEN_OF_MAC_TABLE];
+static int mcast_clone[MAX_LEN_OF_MAC_TABLE];
+
+static void enq(struct _RTMP_ADAPTER *pAd, struct wifi_dev *wdev, PNDIS_PACKET pkt, UCHAR q)
+{
+	clones[pkt->Wcid]++;
+	mcast_clone[pkt->Wcid] = pkt->McastClone;
+	free(pkt);
+}
+
+static void grace_period(void)
+{
+	while (shim_rcu_pending) {
+		struct rcu_head *h = shim_rcu_pending;
+
+		shim_rcu_pending = h->next;
+		h->func(h);
+	}
+}
+
+static int ref_members(int g)
+{
+	int w, cnt = 0;
+
+	for (w = 0; w < MAX_LEN_OF_MAC_TABLE; w++)
+		cnt += !!ref[g].member[w];
+
+	return cnt;
+}
+
+static int ref_pendings(int g)
+{
+	int m, cnt = 0;
+
+	for (m = 0; m < NUM_STA; m++)
+		cnt += ref[g].pending[m];
+
+	return cnt;
+}
+
+static void ref_drop(int g)
+{
+	ref_pending_cnt -= ref_pendings(g);
+	memset(&ref[g], 0, sizeof(ref[g]));
+}
+
+static void ref_create(int g, int type)
+{
+	ref_drop(g);
+	ref[g].valid = 1;
+	ref[g].type = type;
+	ref[g].last = shim_jiffies;
+}
+
+static void ref_pending_add(int g, int m)
+{
+	if (ref[g].pending[m] || ref_pending_cnt >= MULTICAST_PENDING_MEMBER_SIZE)
+		return;
+
+	ref[g].pending[m] = 1;
+	ref_pending_cnt++;
+}
+
+static void ref_pending_del(int g, int m)
+{
+	if (ref[g].pending[m]) {
+		ref[g].pending[m] = 0;
+		ref_pending_cnt--;
+	}
+}
+
+static void join(int g, int w, int mwds)
+{
+	UCHAR sa[MAC_ADDR_LEN] = {0x0a, 0, 0, 0, rand() & 0xff, rand() & 0xff};
+	int m;
+
+	/* a client behind a MWDS link joins with its own address */
+	if (!mwds) {
+		for (m = 0; m < NUM_STA; m++)
+			if (sta_wcid[m] == w)
+				COPY_MAC_ADDR(sa, sta_addr[m]);
+	}
+
+	MulticastFilterTableInsertEntry(&ad, grp_addr[g], 0,
+					MCAT_FILTER_DYNAMIC | (mwds ? MCAT_FILTER_MWDS_CLI : 0), sa, dev, w);
+
+	if (!ref[g].valid)
+		ref_create(g, MCAT_FILTER_DYNAMIC);
+
+	ref[g].last = shim_jiffies;
+
+	if (!ref[g].member[w])
+		ref[g].member[w] = mwds ? 2 : 1;
+}
+
+/* MulticastFilterTableDeleteEntry for member m, w is its WCID or 0 */
+static void ref_delete(int g, int m, int w)
+{
+	if (!ref[g].valid)
+		return;
+
+	if (m >= 0)
+		ref_pending_del(g, m);
+
+	ref[g].member[w] = 0;
+
+	if (!ref_members(g) && !ref_pendings(g))
+		ref_drop(g);
+}
+
+static void leave(int g, int w)
+{
+	int m;
+
+	for (m = 0; m < NUM_STA; m++)
+		if (sta_wcid[m] == w)
+			break;
+
+	MulticastFilterTableDeleteEntry(&ad, grp_addr[g], 0, sta_addr[m], dev, w);
+	ref_delete(g, m, w);
+}
+
+/* Set_IgmpSn_AddEntry_Proc: the group, then the member */
+static void static_add(int g, int m)
+{
+	int w = sta_wcid[m];
+
+	MulticastFilterTableInsertEntry(&ad, grp_addr[g], 0, MCAT_FILTER_STATIC, NULL, dev, 0);
+
+	if (!ref[g].valid)
+		ref_create(g, MCAT_FILTER_STATIC);
+
+	ref[g].last = shim_jiffies;
+
+	MulticastFilterTableInsertEntry(&ad, grp_addr[g], 0, MCAT_FILTER_STATIC, sta_addr[m], dev, w);
+
+	if (w) {
+		if (!ref[g].member[w])
+			ref[g].member[w] = 1;
+	} else
+		ref_pending_add(g, m);
+}
+
+/* Set_IgmpSn_DelEntry_Proc */
+static void static_del(int g, int m)
+{
+	if (m < 0) {
+		MulticastFilterTableDeleteEntry(&ad, grp_addr[g], 0, NULL, dev, 0);
+
+		if (ref[g].valid)
+			ref_drop(g);
+
+		return;
+	}
+
+	MulticastFilterTableDeleteEntry(&ad, grp_addr[g], 0, sta_addr[m], dev, sta_wcid[m]);
+	ref_delete(g, m, sta_wcid[m]);
+}
+
+static void associate(int m)
+{
+	int g, w;
+
+	if (sta_wcid[m])
+		return;
+
+	for (w = 1; w < MAX_STA_NUM; w++)
+		if (!IS_VALID_ENTRY(&ad.MacTab.Content[w]))
+			break;
+
+	if (w == MAX_STA_NUM)
+		return;
+
+	ad.MacTab.Content[w].EntryType = 1;
+	ad.MacTab.Content[w].Sst = SST_ASSOC;
+	ad.MacTab.Content[w].wdev = &wd;
+	COPY_MAC_ADDR(ad.MacTab.Content[w].Addr, sta_addr[m]);
+	ad.MacTab.tr_entry[w].PortSecured = WPA_802_1X_PORT_SECURED;
+	sta_wcid[m] = w;
+
+	/* update_associated_mac_entry */
+	IgmpGroupAddPendingMembers(&ad, sta_addr[m], &wd, w);
+
+	for (g = 0; g < NUM_GROUP; g++) {
+		if (!ref[g].pending[m])
+			continue;
+
+		assert(ref[g].valid);
+		ref_pending_del(g, m);
+		ref[g].last = shim_jiffies;
+
+		if (!ref[g].member[w])
+			ref[g].member[w] = 1;
+	}
+}
+
+static void disassociate(int m)
+{
+	int g, w = sta_wcid[m];
+
+	if (!w)
+		return;
+
+	/* MacTableDeleteEntry */
+	IgmpGroupDelMembers(&ad, sta_addr[m], &wd, w);
+	memset(&ad.MacTab.Content[w], 0, sizeof(ad.MacTab.Content[w]));
+	ad.MacTab.tr_entry[w].PortSecured = 0;
+	sta_wcid[m] = 0;
+
+	for (g = 0; g < NUM_GROUP; g++) {
+		if (!ref[g].valid)
+			continue;
+
+		ref[g].member[w] = 0;
+
+		if ((ref[g].type == MCAT_FILTER_DYNAMIC) && !ref_members(g) && !ref_pendings(g))
+			ref_drop(g);
+	}
+}
+
+static void age_out(void)
+{
+	int g;
+
+	shim_jiffies += rand() % 3000;
+	MulticastFilterTableAgeOut(&ad);
+
+	for (g = 0; g < NUM_GROUP; g++)
+		if (ref[g].valid && (ref[g].type == MCAT_FILTER_DYNAMIC)
+			&& RTMP_TIME_AFTER(shim_jiffies, ref[g].last + AGEOUT))
+			ref_drop(g);
+
+	if (rand() % 2)
+		grace_period();
+}
+
+static void lookup(int g)
+{
+	PMULTICAST_FILTER_TABLE_ENTRY pEntry;
+	int w;
+
+	pEntry = MulticastFilterTableLookup(ad.pMulticastFilterTable, grp_addr[g], dev);
+	assert(!!pEntry == ref[g].valid);
+
+	if (!pEntry)
+		return;
+
+	ref[g].last = shim_jiffies;
+	memset(clones, 0, sizeof(clones));
+	IgmpPktClone(&ad, &wd, NULL, IGMP_IN_GROUP, pEntry, 0, 0, NULL);
+
+	for (w = 0; w < MAX_LEN_OF_MAC_TABLE; w++) {
+		assert(clones[w] == !!ref[g].member[w]);
+
+		if (clones[w])
+			assert(mcast_clone[w] == (ref[g].member[w] == 1));
+	}
+
+	assert(IgmpMemberCnt(pEntry) == ref_members(g));
+}
+
+static void check_table(void)
+{
+	PMULTICAST_FILTER_PENDING_MEMBER pPending;
+	int g, m, i, size = 0, found;
+
+	for (g = 0; g < NUM_GROUP; g++) {
+		size += ref[g].valid;
+
+		for (m = 0; m < NUM_STA; m++) {
+			for (found = 0, i = 0; i < MULTICAST_PENDING_MEMBER_SIZE; i++) {
+				pPending = &table.PendingMember[i];
+				found += pPending->Valid && MAC_ADDR_EQUAL(pPending->GrpId, grp_addr[g])
+					 && MAC_ADDR_EQUAL(pPending->MemberAddr, sta_addr[m]);
+			}
+
+			assert(found == ref[g].pending[m]);
+		}
+	}
+
+	assert(table.Size == size);
+	assert(!shim_locked);
+}
+
+int main(int argc, char **argv)
+{
+	static struct qm_ops qm = { enq };
+	int ops = (argc > 1) ? atoi(argv[1]) : 400000;
+	int i, g, m, op;
+	int counts[8] = {0};
+
+	srand((argc > 2) ? atoi(argv[2]) : 1);
+
+	ad.pMulticastFilterTable = &table;
+	ad.qm_ops = &qm;
+	ad.MaxStaNum = MAX_STA_NUM;
+	wd.if_dev = dev;
+	wd.u4AgeOutTime = AGEOUT;
+
+	for (g = 0; g < NUM_GROUP; g++) {
+		UCHAR addr[MAC_ADDR_LEN] = {0x01, 0x00, 0x5e, 0x00, (g & 1) ? 0x80 : 0x00, g * 8};
+
+		COPY_MAC_ADDR(grp_addr[g], addr);
+	}
+
+	for (m = 0; m < NUM_STA; m++) {
+		UCHAR addr[MAC_ADDR_LEN] = {0x02, 0x00, 0x00, 0x00, 0x01, m};
+
+		COPY_MAC_ADDR(sta_addr[m], addr);
+	}
+
+	for (i = 0; i < ops; i++) {
+		op = rand() % 100;
+		g = rand() % NUM_GROUP;
+		m = rand() % NUM_STA;
+		shim_jiffies += rand() % 50;
+
+		if (op < 25) {
+			if (sta_wcid[m])
+				join(g, sta_wcid[m], rand() % 4 == 0);
+			counts[0]++;
+		} else if (op < 35) {
+			if (sta_wcid[m])
+				leave(g, sta_wcid[m]);
+			counts[1]++;
+		} else if (op < 47) {
+			static_add(g, m);
+			counts[2]++;
+		} else if (op < 55) {
+			static_del(g, (rand() % 8) ? m : -1);
+			counts[3]++;
+		} else if (op < 65) {
+			associate(m);
+			counts[4]++;
+		} else if (op < 75) {
+			disassociate(m);
+			counts[5]++;
+		} else if (op < 80) {
+			age_out();
+			counts[6]++;
+		} else {
+			lookup(g);
+			counts[7]++;
+		}
+
+		check_table();
+	}
+
+	printf("%d operations: %d joins, %d leaves, %d static adds, %d static deletes, "
+	       "%d associations, %d disassociations, %d age-outs, %d lookups, all matched\n",
+	       ops, counts[0], counts[1], counts[2], counts[3], counts[4], counts[5],
+	       counts[6], counts[7]);
+	return 0;
+}
@@ -0,0 +1,29 @@
+#!/bin/sh
+#
+# Check the MAT database against a reference model.
+#
+# The database functions are cut out of embedded/common/cmm_mat.c and built
+# in userspace with shim.h, under ASan and UBSan, then driven by test.c.
+#
+# Usage: run.sh [operations] [seed]
+#
+
+dir="$(cd "$(dirname "$0")" && pwd)"
+. "$dir/../harness.sh"
+src="$dir/../../common/cmm_mat.c"
+
+work="$(mktemp -d)"
+trap 'rm -rf "$work"' EXIT
+
+funcs="MATDBHashIndex MATDBEntryRcuFree MATDBEntryUnlink MATDBInit MATDBExit MATDBLookup
+	MATDBUpdate MATDBAgeOut MATDBStatBcastFallback MATDBStatGet MATDBStatClear"
+
+# the key compare and age-out table, then the functions
+{
+	sed -n '/^#define MAT_DB_KEY_EQUAL/,/^};/p' "$src"
+	extract_funcs "$src" $funcs || exit 1
+} > "$work/table.c" || exit 1
+
+cc $SANITIZE -fno-strict-aliasing -w \
+	-I"$dir" -I"$work" -o "$work/test" "$dir/test.c" || exit 1
+"$work/test" "$@"
@@ -0,0 +1,82 @@
+/*
+ * Userspace stand-ins for the parts of the driver the MAT database in
+ * common/cmm_mat.c uses. The structures come from the real include/mat.h.
+ * The lock asserts it is never taken twice, call_rcu callbacks wait in a
+ * list until a grace period and per-CPU data is SHIM_NR_CPUS copies picked
+ * by shim_cpu.
+ */
+#ifndef __MAT_DB_SHIM_H__
+#define __MAT_DB_SHIM_H__
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <assert.h>
+
+typedef unsigned char UCHAR, UINT8, BOOLEAN, *PUCHAR;
+typedef unsigned short USHORT, UINT16;
+typedef unsigned int UINT32, UINT;
+typedef int INT, NDIS_STATUS;
+typedef unsigned long ULONG;
+typedef void VOID, *PNDIS_PACKET;
+typedef char RTMP_STRING;
+
+#define IN
+#define OUT
+#define TRUE	1
+#define FALSE	0
+
+#define MTWF_LOG(...)
+#define MAC_ADDR_LEN	6
+#define MAC_ADDR_EQUAL(a, b)	(!memcmp(a, b, MAC_ADDR_LEN))
+#define NdisZeroMemory(p, n)	memset(p, 0, n)
+#define NdisMoveMemory(d, s, n)	memcpy(d, s, n)
+#define NdisEqualMemory(a, b, n)	(!memcmp(a, b, n))
+#define container_of(p, t, m)	((t *)((char *)(p) - offsetof(t, m)))
+
+#define os_alloc_mem(a, pp, n)	(*(pp) = malloc(n))
+#define os_alloc_mem_suspend(a, pp, n)	(*(pp) = malloc(n))
+#define os_free_mem(p)	free(p)
+
+#define OS_HZ	100
+extern ULONG shim_jiffies;
+#define NdisGetSystemUpTime(p)	(*(p) = shim_jiffies)
+#define RTMP_TIME_AFTER(a, b)	((long)((b) - (a)) < 0)
+
+typedef int NDIS_SPIN_LOCK;
+extern int shim_locked;
+#define RTMP_SEM_LOCK(l)	do { assert(!shim_locked); shim_locked = 1; } while (0)
+#define RTMP_SEM_UNLOCK(l)	do { assert(shim_locked); shim_locked = 0; } while (0)
+
+typedef struct rcu_head {
+	struct rcu_head *next;
+	void (*func)(struct rcu_head *);
+} RTMP_OS_RCU_HEAD;
+extern struct rcu_head *shim_rcu_pending;
+extern int shim_rcu_readers;
+void shim_grace_period(void);
+#define RTMP_RCU_READ_LOCK()	(shim_rcu_readers++)
+#define RTMP_RCU_READ_UNLOCK()	(assert(shim_rcu_readers > 0), shim_rcu_readers--)
+#define RTMP_RCU_DEREFERENCE(p)		(p)
+#define RTMP_RCU_ASSIGN_POINTER(p, v)	((p) = (v))
+#define RTMP_CALL_RCU(h, f) \
+	do { (h)->func = (f); (h)->next = shim_rcu_pending; shim_rcu_pending = (h); } while (0)
+#define RTMP_SYNCHRONIZE_RCU()	(assert(!shim_rcu_readers), shim_grace_period())
+#define RTMP_RCU_BARRIER()	shim_grace_period()
+
+/* one allocation at a time, the copies are shim_percpu_size apart */
+#define SHIM_NR_CPUS	4
+extern int shim_cpu;
+extern size_t shim_percpu_size;
+extern size_t shim_percpu_fail;
+void *shim_percpu_alloc(size_t size);
+#define RTMP_OS_PERCPU_ALLOC(n)	shim_percpu_alloc(n)
+#define RTMP_OS_PERCPU_FREE(p)	free(p)
+#define RTMP_OS_PERCPU_PTR(p, cpu)	((__typeof__(p))((char *)(p) + (cpu) * shim_percpu_size))
+#define RTMP_OS_PERCPU_INC(v)	((*RTMP_OS_PERCPU_PTR(&(v), shim_cpu))++)
+#define RTMP_OS_FOR_EACH_CPU(cpu)	for ((cpu) = 0; (cpu) < SHIM_NR_CPUS; (cpu)++)
+
+#include "../../include/mat.h"
+
+#endif /* __MAT_DB_SHIM_H__ */
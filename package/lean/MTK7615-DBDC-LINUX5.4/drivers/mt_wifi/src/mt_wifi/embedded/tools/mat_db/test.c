@@ -0,0 +1,298 @@
+/*
+ * Random operations on the MAT database, checked against a reference model
+ * after each one: inserts and refreshes with their chain aging, lookups from
+ * several CPUs, broadcast fallbacks, the one-second aging sweep and the
+ * per-CPU counters with their clear. Jiffies wrap during the run.
+ *
+ * Usage: test [operations] [seed]
+ */
+#include "shim.h"
+#include "table.c"
+
+ULONG shim_jiffies;
+int shim_locked;
+struct rcu_head *shim_rcu_pending;
+int shim_rcu_readers;
+int shim_cpu;
+size_t shim_percpu_size;
+size_t shim_percpu_fail;
+
+void shim_grace_period(void)
+{
+	while (shim_rcu_pending) {
+		struct rcu_head *h = shim_rcu_pending;
+
+		shim_rcu_pending = h->next;
+		h->func(h);
+	}
+}
+
+void *shim_percpu_alloc(size_t size)
+{
+	if (size == shim_percpu_fail)
+		return NULL;
+
+	shim_percpu_size = size;
+	return calloc(SHIM_NR_CPUS, size);
+}
+
+#define NUM_KEY		96
+#define NUM_MAC		3
+#define HASH_SIZE	16	/* small, so chains are shared */
+
+static MAT_STRUCT mat;
+static UCHAR mac_addr[NUM_MAC][MAC_ADDR_LEN];
+
+/* the model */
+static struct {
+	int valid;
+	int mac;
+	UCHAR flags;
+	ULONG last;
+} ref[NUM_KEY];
+static MAT_DB_STAT ref_stat[MAT_DB_TYPE_MAX];
+
+static UCHAR key_type(int k)
+{
+	return k % MAT_DB_TYPE_MAX;
+}
+
+static UCHAR key_len(int k)
+{
+	return 1 + (k * 7) % MAT_DB_KEY_MAX_LEN;
+}
+
+static void key_bytes(int k, UCHAR *key)
+{
+	int i;
+
+	for (i = 0; i < MAT_DB_KEY_MAX_LEN; i++)
+		key[i] = (UCHAR)(k + i * 13);
+}
+
+static int key_find(PMAT_DB_ENTRY pEntry)
+{
+	UCHAR key[MAT_DB_KEY_MAX_LEN];
+	int k;
+
+	for (k = 0; k < NUM_KEY; k++) {
+		key_bytes(k, key);
+
+		if (MAT_DB_KEY_EQUAL(pEntry, key_type(k), key, key_len(k)))
+			return k;
+	}
+
+	return -1;
+}
+
+static int ref_aged(int k)
+{
+	return RTMP_TIME_AFTER(shim_jiffies, ref[k].last + MATDBAgeOutTime[key_type(k)]);
+}
+
+static UINT32 key_chain(int k)
+{
+	UCHAR key[MAT_DB_KEY_MAX_LEN];
+
+	key_bytes(k, key);
+	return MATDBHashIndex(&mat.MatTableSet, key_type(k), key, key_len(k));
+}
+
+#define CHECK(c) do { if (!(c)) { printf("op %lu: %s failed at line %d\n", op, #c, __LINE__); exit(1); } } while (0)
+
+static ULONG op;
+
+/*
+	Compare the table with the model. A model entry missing from the table
+	is accepted when lost_chain is not negative and the entry had aged on that
+	chain, MATDBUpdate() drops those on its way.
+*/
+static void check_table(int lost_chain)
+{
+	MAT_TABLE *pTable = &mat.MatTableSet;
+	PMAT_DB_ENTRY pEntry;
+	int found[NUM_KEY] = {0};
+	UINT32 cnt[MAT_DB_TYPE_MAX] = {0}, total = 0, i;
+	int k;
+
+	for (i = 0; i < pTable->HashSize; i++) {
+		for (pEntry = pTable->Hash[i]; pEntry; pEntry = pEntry->pNext) {
+			k = key_find(pEntry);
+			CHECK(k >= 0);
+			CHECK(!found[k]);
+			CHECK(key_chain(k) == i);
+			CHECK(ref[k].valid);
+			CHECK(MAC_ADDR_EQUAL(pEntry->macAddr, mac_addr[ref[k].mac]));
+			CHECK(pEntry->flags == ref[k].flags);
+			CHECK(pEntry->lastTime == ref[k].last);
+			found[k] = 1;
+		}
+	}
+
+	for (k = 0; k < NUM_KEY; k++) {
+		if (ref[k].valid && !found[k]) {
+			CHECK(lost_chain >= 0);
+			CHECK(key_chain(k) == (UINT32)lost_chain);
+			CHECK(ref_aged(k));
+			ref[k].valid = 0;
+		}
+
+		if (ref[k].valid) {
+			cnt[key_type(k)]++;
+			total++;
+		}
+	}
+
+	for (i = 0; i < MAT_DB_TYPE_MAX; i++)
+		CHECK(pTable->EntryCnt[i] == cnt[i]);
+
+	CHECK(mat.nodeCount == total);
+}
+
+static void check_stat(void)
+{
+	MAT_DB_STAT sum;
+	UCHAR type;
+
+	for (type = 0; type < MAT_DB_TYPE_MAX; type++) {
+		MATDBStatGet(&mat, type, &sum);
+		CHECK(sum.Hit == ref_stat[type].Hit);
+		CHECK(sum.Miss == ref_stat[type].Miss);
+		CHECK(sum.BcastFallback == ref_stat[type].BcastFallback);
+	}
+}
+
+static void do_update(int k)
+{
+	UCHAR key[MAT_DB_KEY_MAX_LEN];
+	PMAT_DB_ENTRY pEntry;
+	int m = rand() % NUM_MAC;
+	UCHAR flags = rand() & 1;
+
+	key_bytes(k, key);
+	RTMP_RCU_READ_LOCK();
+	pEntry = MATDBUpdate(&mat, key_type(k), key, key_len(k), mac_addr[m], flags);
+	CHECK(pEntry != NULL);
+	CHECK(key_find(pEntry) == k);
+	RTMP_RCU_READ_UNLOCK();
+	ref[k].valid = 1;
+	ref[k].mac = m;
+	ref[k].flags = flags;
+	ref[k].last = shim_jiffies;
+	check_table(key_chain(k));
+}
+
+static void do_lookup(int k)
+{
+	UCHAR key[MAT_DB_KEY_MAX_LEN];
+	PMAT_DB_ENTRY pEntry;
+
+	key_bytes(k, key);
+	RTMP_RCU_READ_LOCK();
+	pEntry = MATDBLookup(&mat, key_type(k), key, key_len(k));
+
+	if (ref[k].valid) {
+		CHECK(pEntry != NULL);
+		CHECK(MAC_ADDR_EQUAL(pEntry->macAddr, mac_addr[ref[k].mac]));
+		ref[k].last = shim_jiffies;
+		ref_stat[key_type(k)].Hit++;
+	} else {
+		CHECK(pEntry == NULL);
+		ref_stat[key_type(k)].Miss++;
+	}
+
+	RTMP_RCU_READ_UNLOCK();
+	check_table(-1);
+}
+
+static void do_ageout(void)
+{
+	int k;
+
+	RTMP_RCU_READ_LOCK();
+	MATDBAgeOut(&mat);
+	RTMP_RCU_READ_UNLOCK();
+
+	for (k = 0; k < NUM_KEY; k++) {
+		if (ref[k].valid && ref_aged(k))
+			ref[k].valid = 0;
+	}
+
+	check_table(-1);
+}
+
+/* the table must cope with a failed init, as with no init at all */
+static void test_init_fail(void)
+{
+	UCHAR key[MAT_DB_KEY_MAX_LEN] = {0};
+	MAT_DB_STAT sum;
+
+	mat.DBHashSize = HASH_SIZE;
+	shim_percpu_fail = sizeof(MAT_DB_STAT) * MAT_DB_TYPE_MAX;
+	CHECK(MATDBInit(&mat) == FALSE);
+	CHECK(mat.MatTableSet.Hash == NULL);
+	CHECK(mat.MatTableSet.pStat == NULL);
+	shim_percpu_fail = 0;
+	CHECK(MATDBLookup(&mat, 0, key, 4) == NULL);
+	CHECK(MATDBUpdate(&mat, 0, key, 4, mac_addr[0], 0) == NULL);
+	MATDBAgeOut(&mat);
+	MATDBStatBcastFallback(&mat, 0);
+	MATDBStatGet(&mat, 0, &sum);
+	CHECK(sum.Hit == 0 && sum.Miss == 0 && sum.BcastFallback == 0);
+	MATDBStatClear(&mat);
+	MATDBExit(&mat);
+}
+
+int main(int argc, char **argv)
+{
+	ULONG ops = (argc > 1) ? strtoul(argv[1], NULL, 0) : 200000;
+	unsigned int seed = (argc > 2) ? strtoul(argv[2], NULL, 0) : 1;
+	ULONG sweeps = 0, aged_hit = 0;
+	int k, r;
+
+	srand(seed);
+
+	for (k = 0; k < NUM_MAC; k++)
+		memcpy(mac_addr[k], (UCHAR[]){0x00, 0x0c, 0x43, 0x76, 0x15, k}, MAC_ADDR_LEN);
+
+	test_init_fail();
+	mat.DBHashSize = HASH_SIZE;
+	CHECK(MATDBInit(&mat) == TRUE);
+	CHECK(mat.MatTableSet.HashSize == HASH_SIZE);
+	/* wrap around halfway through a default run */
+	shim_jiffies = (ULONG)0 - ops * 15;
+
+	for (op = 0; op < ops; op++) {
+		shim_cpu = rand() % SHIM_NR_CPUS;
+		r = rand() % 100;
+		k = rand() % NUM_KEY;
+
+		if (r < 30)
+			do_update(k);
+		else if (r < 70) {
+			aged_hit += ref[k].valid && ref_aged(k);
+			do_lookup(k);
+		} else if (r < 75) {
+			MATDBStatBcastFallback(&mat, key_type(k));
+			ref_stat[key_type(k)].BcastFallback++;
+		} else if (r < 93)
+			shim_jiffies += rand() % 60;
+		else if (r < 96) {
+			do_ageout();
+			sweeps++;
+		} else if (r < 98)
+			check_stat();
+		else if (r < 99) {
+			MATDBStatClear(&mat);
+			memset(ref_stat, 0, sizeof(ref_stat));
+		} else
+			shim_grace_period();
+	}
+
+	check_stat();
+	MATDBExit(&mat);
+	CHECK(mat.MatTableSet.Hash == NULL && mat.MatTableSet.pStat == NULL);
+	printf("%lu operations, %lu sweeps, %lu lookups of aged entries before a sweep, seed %u: ok\n",
+		   ops, sweeps, aged_hit, seed);
+	return 0;
+}
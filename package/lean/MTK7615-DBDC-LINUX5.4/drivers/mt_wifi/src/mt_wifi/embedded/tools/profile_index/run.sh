@@ -0,0 +1,70 @@
+#!/bin/sh
+#
+# Check the profile key index against a reference parser and time it.
+#
+# The profile parser is cut out of embedded/common/cmm_profile.c and built
+# in userspace twice: as is, and as the reference with its symbols renamed
+# to ref_*. Without -r the reference is the same source, so lookups with
+# the index are compared with the plain scan; with -r it is another copy of
+# cmm_profile.c, e.g. one from before the index was added:
+#
+#   git show <rev>:<path>/cmm_profile.c > /tmp/cmm_profile.c
+#   ./run.sh -r /tmp/cmm_profile.c
+#
+# Usage: run.sh [-r reference cmm_profile.c] [profile.dat...]
+#
+
+dir="$(cd "$(dirname "$0")" && pwd)"
+. "$dir/../harness.sh"
+embedded="$dir/../.."
+driver="$embedded/../../.."
+src="$embedded/common/cmm_profile.c"
+ref="$src"
+
+if [ "$1" = "-r" ]; then
+	ref="$2"
+	shift 2
+fi
+
+# profiles only, the SKU tables have no Default section
+[ $# -gt 0 ] || set -- $(grep -l "^Default" $(find "$driver" -name "*.dat") | sort)
+
+work="$(mktemp -d)"
+trap 'rm -rf "$work"' EXIT
+
+# rtstrstr, then everything from RTMPFindSection to the end of
+# RTMPGetKeyParameterWithOffset
+extract() {
+	echo '#include "shim.h"'
+	extract_funcs "$1" rtstrstr || exit 1
+	extract_range "$1" RTMPFindSection RTMPGetKeyParameterWithOffset || exit 1
+}
+
+extract "$src" > "$work/profile.c" || exit 1
+extract "$ref" > "$work/ref.c" || exit 1
+
+# keys the driver reads, and the lookups of one RTMPSetProfileParameters call
+keys() {
+	grep -hoE 'RTMPGetKeyParameter(WithOffset)?\("[^"]*"' "$@" | sed 's/.*("//; s/"$//'
+}
+keys $(find "$embedded/.." -name "*.c") | sort -u > "$work/keys"
+keys "$src" > "$work/bringup"
+
+rename=""
+for sym in rtstrstr RTMPFindSection RTMPGetKeyParameter RTMPGetKeyParameterWithOffset \
+	   RTMPAddKeyParameter RTMPSetKeyParameter RTMPProfileIndexBuild RTMPProfileIndexRelease; do
+	rename="$rename -D$sym=ref_$sym"
+done
+
+cc -O2 -w -I"$dir" -c -o "$work/profile.o" "$work/profile.c" || exit 1
+cc -O2 -w -I"$dir" $rename -c -o "$work/ref.o" "$work/ref.c" || exit 1
+cc -O2 -I"$dir" -o "$work/test" "$dir/test.c" "$work/profile.o" "$work/ref.o" || exit 1
+
+echo "$(wc -l < "$work/keys") driver keys, $(wc -l < "$work/bringup") lookups per bring-up"
+
+ret=0
+for dat in "$@"; do
+	"$work/test" "$dat" "$work/keys" "$work/bringup" || ret=1
+done
+
+exit $ret
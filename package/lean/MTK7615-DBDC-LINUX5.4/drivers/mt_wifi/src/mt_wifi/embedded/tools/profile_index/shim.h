@@ -0,0 +1,34 @@
+/*
+ * Userspace stand-ins for the driver types and helpers used by the
+ * profile parser in embedded/common/cmm_profile.c.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+typedef char RTMP_STRING;
+typedef char CHAR;
+typedef unsigned char UCHAR, *PUCHAR;
+typedef unsigned short USHORT;
+typedef int INT;
+typedef unsigned int UINT, UINT32;
+typedef unsigned char BOOLEAN;
+typedef void VOID;
+typedef int NDIS_STATUS;
+
+#define IN
+#define OUT
+#define TRUE	1
+#define FALSE	0
+
+#define MAX_PARAM_BUFFER_SIZE	2048
+#define MAX_INI_BUFFER_SIZE	11000
+
+#define os_alloc_mem(a, p, s)	(*(p) = malloc(s))
+#define os_free_mem(p)		free(p)
+#define os_move_mem		memmove
+#define os_zero_mem(p, n)	memset(p, 0, n)
+#define NdisMoveMemory		memmove
+#define MTWF_LOG(...)
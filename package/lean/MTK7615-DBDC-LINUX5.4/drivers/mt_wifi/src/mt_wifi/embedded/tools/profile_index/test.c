@@ -0,0 +1,187 @@
+/*
+ * Check and time the profile key index of cmm_profile.c in userspace.
+ *
+ * Every key of the profile and every key the driver looks up is read
+ * with RTMPGetKeyParameter and RTMPGetKeyParameterWithOffset at several
+ * destination sizes, with and without trimming, and compared with the
+ * reference parser (ref_*), both without and with the index built. Then
+ * one bring-up worth of lookups is timed: the reference scan against
+ * building the index and serving the same keys from it.
+ *
+ * Built and run by run.sh.
+ */
+
+#include <time.h>
+#include "shim.h"
+
+INT RTMPGetKeyParameter(RTMP_STRING *key, RTMP_STRING *dest, INT destsize,
+			RTMP_STRING *buffer, BOOLEAN bTrimSpace);
+INT RTMPGetKeyParameterWithOffset(RTMP_STRING *key, RTMP_STRING *dest,
+			USHORT *end_offset, INT destsize, RTMP_STRING *buffer,
+			BOOLEAN bTrimSpace);
+VOID RTMPProfileIndexBuild(RTMP_STRING *buffer);
+VOID RTMPProfileIndexRelease(RTMP_STRING *buffer);
+
+INT ref_RTMPGetKeyParameter(RTMP_STRING *key, RTMP_STRING *dest, INT destsize,
+			RTMP_STRING *buffer, BOOLEAN bTrimSpace);
+INT ref_RTMPGetKeyParameterWithOffset(RTMP_STRING *key, RTMP_STRING *dest,
+			USHORT *end_offset, INT destsize, RTMP_STRING *buffer,
+			BOOLEAN bTrimSpace);
+
+#define MAX_KEYS	20000
+#define BENCH_LOOPS	200
+
+static char *keys[MAX_KEYS];
+static int key_num;
+
+static void add_key(const char *key)
+{
+	if (key_num < MAX_KEYS)
+		keys[key_num++] = strdup(key);
+}
+
+static void add_keys(const char *file)
+{
+	char line[4096];
+	FILE *f = fopen(file, "r");
+
+	if (!f) {
+		perror(file);
+		exit(1);
+	}
+
+	while (fgets(line, sizeof(line), f)) {
+		line[strcspn(line, "\n")] = 0;
+		add_key(line);
+	}
+
+	fclose(f);
+}
+
+static char *load_profile(const char *file)
+{
+	char *buf = calloc(1, MAX_INI_BUFFER_SIZE * 8);
+	FILE *f = fopen(file, "r");
+
+	if (!f || !buf) {
+		perror(file);
+		exit(1);
+	}
+
+	if (!fread(buf, 1, MAX_INI_BUFFER_SIZE * 8 - 1, f) && ferror(f)) {
+		perror(file);
+		exit(1);
+	}
+
+	fclose(f);
+	return buf;
+}
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv)
+{
+	char d1[4096], d2[4096], line[4096];
+	long checks = 0, mismatches = 0;
+	double t0, t1, t2;
+	char *buf, *p, *e, *q;
+	int pass, i, ds, trim, n, r1, r2;
+	USHORT o1, o2;
+
+	if (argc != 4) {
+		fprintf(stderr, "Usage: %s <profile> <driver keys> <bring-up keys>\n",
+			argv[0]);
+		return 1;
+	}
+
+	buf = load_profile(argv[1]);
+
+	/* every key of the profile, the driver keys and a few odd ones */
+	for (p = buf; p && *p; p = e ? e + 1 : NULL) {
+		e = strchr(p, '\n');
+		q = strchr(p, '=');
+
+		if (q && (!e || q < e) && q - p < (int)sizeof(line)) {
+			memcpy(line, p, q - p);
+			line[q - p] = 0;
+			add_key(line);
+		}
+	}
+
+	add_keys(argv[2]);
+	add_key("NoSuchKey");
+	add_key("Default");
+	add_key("");
+
+	for (pass = 0; pass < 2; pass++) {
+		if (pass)
+			RTMPProfileIndexBuild(buf);
+
+		for (i = 0; i < key_num; i++)
+		for (ds = 1; ds < 300; ds += 37)
+		for (trim = 0; trim < 2; trim++) {
+			memset(d1, 0x5a, sizeof(d1));
+			memset(d2, 0x5a, sizeof(d2));
+			r1 = ref_RTMPGetKeyParameter(keys[i], d1, ds, buf, trim);
+			r2 = RTMPGetKeyParameter(keys[i], d2, ds, buf, trim);
+			checks++;
+
+			if (r1 != r2 || memcmp(d1, d2, sizeof(d1))) {
+				if (mismatches++ < 5)
+					printf("mismatch: key '%s', destsize %d\n", keys[i], ds);
+			}
+
+			/* walk every occurrence like the RADIUS_* readers do */
+			for (o1 = o2 = 0, n = 0; n < 50; n++) {
+				memset(d1, 0x5a, sizeof(d1));
+				memset(d2, 0x5a, sizeof(d2));
+				r1 = ref_RTMPGetKeyParameterWithOffset(keys[i], d1, &o1, ds, buf, trim);
+				r2 = RTMPGetKeyParameterWithOffset(keys[i], d2, &o2, ds, buf, trim);
+				checks++;
+
+				if (r1 != r2 || o1 != o2 || memcmp(d1, d2, sizeof(d1))) {
+					if (mismatches++ < 5)
+						printf("mismatch: key '%s', offsets %u/%u\n",
+						       keys[i], o1, o2);
+					break;
+				}
+
+				if (!r1)
+					break;
+			}
+		}
+	}
+
+	RTMPProfileIndexRelease(buf);
+
+	/* one bring-up worth of lookups, as issued by RTMPSetProfileParameters */
+	key_num = 0;
+	add_keys(argv[3]);
+
+	t0 = now();
+	for (n = 0; n < BENCH_LOOPS; n++)
+		for (i = 0; i < key_num; i++)
+			ref_RTMPGetKeyParameter(keys[i], d1, MAX_PARAM_BUFFER_SIZE, buf, TRUE);
+
+	t1 = now();
+	for (n = 0; n < BENCH_LOOPS; n++) {
+		RTMPProfileIndexBuild(buf);
+		for (i = 0; i < key_num; i++)
+			RTMPGetKeyParameter(keys[i], d1, MAX_PARAM_BUFFER_SIZE, buf, TRUE);
+		RTMPProfileIndexRelease(buf);
+	}
+	t2 = now();
+
+	p = strrchr(argv[1], '/');
+	printf("%-16s %7ld checks, %ld mismatches; %d lookups: scan %7.1f us, index %5.1f us\n",
+	       p ? p + 1 : argv[1], checks, mismatches, key_num,
+	       (t1 - t0) / BENCH_LOOPS * 1e6, (t2 - t1) / BENCH_LOOPS * 1e6);
+
+	return mismatches != 0;
+}
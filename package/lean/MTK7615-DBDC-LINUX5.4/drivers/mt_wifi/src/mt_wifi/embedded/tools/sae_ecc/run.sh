@@ -0,0 +1,72 @@
+#!/bin/sh
+#
+# Check the SAE group 19 point operations against known answers and time
+# them.
+#
+# embedded/security/{bn_lib,crypt_bignum,ecc,ecc_p256}.c are built in
+# userspace with the stand-in headers under shim/. With -r the ECC code and
+# headers of another revision are built as well, e.g. one from before the
+# fixed-width P-256 code, and checked and timed next to the current tree:
+#
+#   ./run.sh -r HEAD~1
+#
+# The old generic ladder does not handle the edge scalars (0, n, ...), so
+# those are only checked on the current tree.
+#
+# Usage: run.sh [-r git revision] [benchmark iterations]
+#
+
+dir="$(cd "$(dirname "$0")" && pwd)"
+embedded="$(cd "$dir/../.." && pwd)"
+rev=""
+
+if [ "$1" = "-r" ]; then
+	rev="$2"
+	shift 2
+fi
+
+iterations="${1:-200}"
+
+work="$(mktemp -d)"
+trap 'rm -rf "$work"' EXIT
+
+CFLAGS="-O2 -w -fno-strict-aliasing -DLINUX -DDOT11_SAE_SUPPORT -DDOT11_SAE_OPENSSL_BN -DSAE_ECC_3D"
+
+# build <name> <embedded tree>
+build() {
+	srcs=""
+	for f in bn_lib crypt_bignum ecc ecc_p256; do
+		[ -f "$2/security/$f.c" ] && srcs="$srcs $2/security/$f.c"
+	done
+	cc $CFLAGS -I"$dir/shim" -I"$2/include" -I"$embedded/include" \
+		-o "$work/$1" "$dir/test.c" "$dir/stubs.c" $srcs || exit 1
+}
+
+build new "$embedded"
+
+if [ -n "$rev" ]; then
+	top="$(git -C "$embedded" rev-parse --show-toplevel)"
+	prefix="$(git -C "$embedded" rev-parse --show-prefix)"
+	mkdir -p "$work/ref/security" "$work/ref/include/security"
+	for f in $(git -C "$top" ls-tree --name-only "$rev" "$prefix"security/ "$prefix"include/security/); do
+		case "$f" in
+		*/include/security/*) git -C "$top" show "$rev:$f" > "$work/ref/include/security/${f##*/}" ;;
+		*) git -C "$top" show "$rev:$f" > "$work/ref/security/${f##*/}" ;;
+		esac
+	done
+	build old "$work/ref"
+fi
+
+ret=0
+
+echo "current tree:"
+"$work/new" || ret=1
+"$work/new" -b "$iterations"
+
+if [ -n "$rev" ]; then
+	echo "$rev:"
+	"$work/old" -s || ret=1
+	"$work/old" -b "$iterations"
+fi
+
+exit $ret
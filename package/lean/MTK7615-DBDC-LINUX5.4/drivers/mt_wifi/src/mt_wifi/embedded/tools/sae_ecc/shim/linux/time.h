@@ -0,0 +1 @@
+/* crypt_bignum.c includes the kernel header, nothing of it is needed here */
@@ -0,0 +1,57 @@
+/*
+ * Userspace stand-in for rt_config.h, enough to build the SAE bignum and
+ * ECC code (security/bn_lib.c, crypt_bignum.c, ecc.c, ecc_p256.c).
+ */
+#ifndef __SAE_ECC_SHIM_RT_CONFIG_H__
+#define __SAE_ECC_SHIM_RT_CONFIG_H__
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
+#include "rtmp_type.h"
+
+#define IN
+#define OUT
+#define INOUT
+#define TRUE	1
+#define FALSE	0
+
+#define MTWF_LOG(...)
+#define DBG_LVL_OFF	0
+#define DBG_LVL_ERROR	1
+#define DBG_LVL_INFO	3
+#define DBG_LVL_TRACE	4
+#define DBG_LVL_LOUD	5
+extern int DebugLevel;
+
+#define NdisZeroMemory(p, n)		memset(p, 0, n)
+#define NdisMoveMemory(d, s, n)		memcpy(d, s, n)
+#define NdisCopyMemory(d, s, n)		memcpy(d, s, n)
+#define NdisFillMemory(p, n, v)		memset(p, v, n)
+#define NdisCmpMemory(a, b, n)		memcmp(a, b, n)
+
+/* allocations of exactly this size fail, to test the out of memory paths */
+extern unsigned long shim_fail_alloc_size;
+
+static inline void os_alloc_mem(void *a, UCHAR **p, unsigned long n)
+{
+	(void)a;
+	*p = (n == shim_fail_alloc_size) ? NULL : malloc(n);
+}
+#define os_free_mem(p)	free(p)
+
+#define panic(...)		abort()
+#define jiffies			0
+#define jiffies_to_msecs(x)	(x)
+
+#define LFSR_MASK		0x80000057
+#define LEN_PMK			32
+#define MAC_ADDR_LEN		6
+#define MAX_LEN_OF_MAC_TABLE	128
+
+typedef struct { int x; } RALINK_TIMER_STRUCT;
+typedef struct { int x; } NDIS_SPIN_LOCK;
+
+#endif /* __SAE_ECC_SHIM_RT_CONFIG_H__ */
@@ -0,0 +1,26 @@
+/* driver functions the SAE ECC code calls, not needed in userspace */
+#include <stdlib.h>
+
+int DebugLevel;
+unsigned long shim_fail_alloc_size;
+
+void BigInteger_record_time_begin(void *rec)
+{
+	(void)rec;
+}
+
+void BigInteger_record_time_end(void *rec)
+{
+	(void)rec;
+}
+
+void NdisGetSystemUpTime(unsigned long *time)
+{
+	*time = (unsigned long)rand();
+}
+
+void ASSERT(int cond)
+{
+	if (!cond)
+		abort();
+}
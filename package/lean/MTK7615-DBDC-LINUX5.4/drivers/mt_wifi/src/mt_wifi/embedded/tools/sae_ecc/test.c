@@ -0,0 +1,398 @@
+/*
+ * Known answers and timings for the SAE group 19 (P-256) point operations,
+ * run through the driver's own ECC entry points. See run.sh.
+ *
+ * Usage: test [-s] [-b iterations]
+ *   -s  skip the edge scalars (0, n, n + 1, 2^256 - 1)
+ *   -b  time the operations instead of checking them
+ */
+#include "rt_config.h"
+#include "security/sae_cmm.h"
+#include "security/ecc.h"
+#include <time.h>
+#include <unistd.h>
+
+/* size of the table p256_point_mul allocates, 16 P256_POINTs */
+#define P256_TABLE_SIZE	(16 * 3 * 32)
+
+/* hex strings, x = y = NULL is infinity */
+struct ecc_kat {
+	const char *k;
+	const char *x;
+	const char *y;
+	int edge;
+};
+
+struct ecc_mul_kat {
+	const char *k;
+	const char *px;
+	const char *py;
+	const char *x;
+	const char *y;
+	int edge;
+};
+
+/* r * (s * P + E), the SAE commit element and k derivation */
+struct ecc_k_kat {
+	const char *s;
+	const char *r;
+	const char *px;
+	const char *py;
+	const char *ex;
+	const char *ey;
+	const char *x;
+	const char *y;
+};
+
+/* y is one root of x^3 - 3x + b, NULL if there is none */
+struct ecc_find_kat {
+	const char *x;
+	const char *y;
+};
+
+static const struct ecc_kat base_kats[] = {
+	{ "0000000000000000000000000000000000000000000000000000000000000001", "6b17d1f2e12c4247f8bce6e563a440f277037d812deb33a0f4a13945d898c296", "4fe342e2fe1a7f9b8ee7eb4a7c0f9e162bce33576b315ececbb6406837bf51f5", 0 },
+	{ "0000000000000000000000000000000000000000000000000000000000000002", "7cf27b188d034f7e8a52380304b51ac3c08969e277f21b35a60b48fc47669978", "07775510db8ed040293d9ac69f7430dbba7dade63ce982299e04b79d227873d1", 0 },
+	{ "0000000000000000000000000000000000000000000000000000000000000003", "5ecbe4d1a6330a44c8f7ef951d4bf165e6c6b721efada985fb41661bc6e7fd6c", "8734640c4998ff7e374b06ce1a64a2ecd82ab036384fb83d9a79b127a27d5032", 0 },
+	{ "000000000000000000000000000000000000000000000000018ebbb95eed0e13", "339150844ec15234807fe862a86be77977dbfb3ae3d96f4c22795513aeaab82f", "b1c14ddfdc8ec1b2583f51e85a5eb3a155840f2034730e9b5ada38b674336a21", 0 },
+	{ "ffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc632550", "6b17d1f2e12c4247f8bce6e563a440f277037d812deb33a0f4a13945d898c296", "b01cbd1c01e58065711814b583f061e9d431cca994cea1313449bf97c840ae0a", 0 },
+	{ "ffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc632551", NULL, NULL, 1 },
+	{ "0000000000000000000000000000000000000000000000000000000000000000", NULL, NULL, 1 },
+	{ "ffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc632552", "6b17d1f2e12c4247f8bce6e563a440f277037d812deb33a0f4a13945d898c296", "4fe342e2fe1a7f9b8ee7eb4a7c0f9e162bce33576b315ececbb6406837bf51f5", 1 },
+	{ "ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff", "f72cbd240e26c0d21b1023179586eb532c6102c49c3677cc1a3d132b9db9d31a", "43e4ca77e2a36621dc0dbd91bfe7a5d223250ef0cdca831ee453d93fa83408a7", 1 },
+	{ "f3f49249dc28ff90a5aec7978306d03bf38b2ffc80a4df5a51c9bc701e7ea41a", "f8c06501f7a25f29914b521cae04a0454d4fee0af8dc1eee47100254031fd3f6", "f3d87a13d33131c58cee443fc6c96824bd52a38adbb453ca46600646680c9f04", 0 },
+	{ "6bad6be28e7aa6e99f19950499dd251de512148239292d22e255accb1a466885", "45f4600c8a058ddaea76061d9eb761b67b7799eb14fbf231d21bf31f95c60b8e", "e785559ef9bbc70158778d4b8bd12a357323cef6b24f9d0e1ff677169c38a623", 0 },
+};
+
+static const struct ecc_mul_kat mul_kats[] = {
+	{ "14aa4e719d3c7dec00a61f933d6c51e370eb9a0a96263ae6c5e818fac0433cbe",
+	  "097d2406a589a4cfb7c9bc96b62f2367ecb42b9d661753774ffa0e89e9559075", "155c8d8eb20e75602b2dabd1e318ee63bab7926fd837632a6db4a069bcacbf7c",
+	  "224ab8fcb3b0c5928f562eec803026069441af613c6024bd116cfa267f33c5ff", "650c0db757345afa7c57e8d008658031445653efd4cefaaff3cc84fa8ed79997", 0 },
+	{ "59001ac9406329bc65b00a2d35d148805071950eadec6f117d836e77af67d462",
+	  "608ac3ab2c7409af3f6720b1c0cb6241dcdb23432550db86268c5b1a32bae1e2", "3b23ae4718e52fe8533da080585471d2e53faf7b31c326c5abc65a6682dbe708",
+	  "1d7553817bbeabbb069170b0bed07d2448ae274c39f13eb62691449218519f3d", "a80eba7a3cf726da911b62f244ee4b00d4d9b0a0b50eb2a44f429927b27fce04", 0 },
+	{ "89be9c1c8eb5140f16f4488157241955b91dddd91389b372a341738c837a7936",
+	  "ac27f40649eae46a72fd5a2b1051efa6200188785caf8f455c85e97bcb35ecb8", "336fba10c2978e1261683c2c752213491a440e6d2012742bc72f9c440d42bbd2",
+	  "2e9ba898f12dbf09c1ff8d492e92a15ac16bacb048fffd41ec029c0a88d98102", "26d265d097e3526345b5233bf8507ed5dd1c3162e625691f7988db0b41ef18ee", 0 },
+	{ "ffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc632551",
+	  "7ca169db4f9e166e07c3d3da759df63273db8b0edfa2323aee553ed0747c52a9", "3e32ab205760034343ebe836bc2587e653976d6a8132c5791fcbfb58333c810d",
+	  NULL, NULL, 1 },
+};
+
+static const struct ecc_k_kat k_kats[] = {
+	{ "e01c683e99a46df0dde3a361c0099ebacd73de0081a0ba056ce9da661dcf884d", "90624fe36b82e6c9d82fb0f1423674a6864fa3f3eab06e9b65ed0de47db4304e",
+	  "114d65f84a9e19f92e87eae24cc45100c8b43550ac14155e140154f24890fd6c", "6162613cfe633dc68564ee00dc6bc0d506485f59daf30ed5e7917c624f624e34",
+	  "53f5c23492464169f4cef5e31ae8708a651db9111e4bc80dc84df7333ddd55dd", "a175c63f320a4e384810b8fa86e43af243862bd7c5559880907be882fa709632",
+	  "ab880aa931563a494c783dc9d544fe68cbfcda120a9d0d22044dc67c190b0556", "981d7a5a7ad461d697ca5dc2b0f15134eb723d09da8a39bfbc78beb644f7162f" },
+	{ "2475263c785490146dedc86a9f4fb02bb7a1774f1a42721eaba4c70ee306f0c5", "b3618e1ca06d7a691f3c42b2e2cbbb93d98145593a9afa39e261e34a7b6bc3c7",
+	  "c4fbcef8fef05c1313ea598e3ff1262a0778c944b4816a678815a78c31b52799", "5de80ec01d415d5742e5b3749926d2930c136b050c1dc8ec0deceba61f1c276c",
+	  "645c5386027077f20e360faf038de3e5a81a3f4e40be5bd666911537637c8d7e", "383e6c552f4669d7032462e71481fe27831e36a01e5d6b325f475fab0a2780b7",
+	  "b5761d7d583ebccb8f01634191b7db99ba1f8a95bf46aa38a35631b08bf9ac56", "782497af2ab8bd62c320f9a5562f2388280404080cfc360900531c905710f65c" },
+};
+
+static const struct ecc_find_kat find_kats[] = {
+	{ "fa97002cfcbad167f5a9ca5fedf165dab6eafff5782afe6bac9f21df74f09af5", "7ce6bdb19b3081e06b2b004a12753982d77a8e732079b4cf5423137650e5c91e" },
+	{ "8c53765f4ec0a954ff8b2a6aab74fe5766eebc578f4ecb4f4041f5ee8bae8e66", "647069a721b80945a1af413038ea28265f4e3b076e8567597355cb68e897e53b" },
+	{ "66e61127e26b524ace0d8d877a98b9acb2c55523807c7e30a598d0dbccbfd2ec", NULL },
+	{ "ea9e7ab5730b89dc2577c324694baad6db4c9492bf5f85e231d06d9c18bee074", NULL },
+};
+
+static EC_GROUP_INFO_BI *group;
+static int skip_edge;
+static int failures;
+
+static SAE_BN *bn(const char *hex)
+{
+	SAE_BN *v = NULL;
+	UCHAR buf[32];
+	unsigned int byte;
+	int i;
+
+	for (i = 0; i < 32; i++) {
+		sscanf(hex + 2 * i, "%2x", &byte);
+		buf[i] = byte;
+	}
+
+	SAE_BN_BIN2BI(buf, sizeof(buf), &v);
+	return v;
+}
+
+static BIG_INTEGER_EC_POINT *point(const char *x, const char *y)
+{
+	BIG_INTEGER_EC_POINT *p = NULL;
+
+	ecc_point_init(&p);
+	p->x = bn(x);
+	p->y = bn(y);
+	SAE_ECC_SET_Z_TO_1(p);
+	return p;
+}
+
+static BIG_INTEGER_EC_POINT *generator(void)
+{
+	BIG_INTEGER_EC_POINT *p = NULL;
+
+	ecc_point_init(&p);
+	SAE_BN_COPY(group->gx, &p->x);
+	SAE_BN_COPY(group->gy, &p->y);
+	SAE_ECC_SET_Z_TO_1(p);
+	return p;
+}
+
+static int bn_equal(SAE_BN *a, const char *hex)
+{
+	SAE_BN *b = bn(hex);
+	int ret = (SAE_BN_UCMP(a, b) == 0);
+
+	SAE_BN_FREE(&b);
+	return ret;
+}
+
+static void check_point(const char *what, int i, BIG_INTEGER_EC_POINT *res,
+			const char *x, const char *y)
+{
+	int ok;
+
+	if (res)
+		SAE_ECC_3D_to_2D(group, res);
+
+	if (!x)
+		ok = (res == NULL);
+	else
+		ok = res && bn_equal(res->x, x) && bn_equal(res->y, y);
+
+	if (!ok) {
+		printf("FAIL %s %d: expected %s\n", what, i, x ? x : "infinity");
+		failures++;
+	}
+}
+
+static void test_base(void)
+{
+	BIG_INTEGER_EC_POINT *g = generator();
+	BIG_INTEGER_EC_POINT *res = NULL;
+	SAE_BN *k;
+	int i;
+
+	for (i = 0; i < sizeof(base_kats) / sizeof(base_kats[0]); i++) {
+		if (skip_edge && base_kats[i].edge)
+			continue;
+
+		k = bn(base_kats[i].k);
+		ECC_POINT_MUL(g, k, group, &res);
+		check_point("base", i, res, base_kats[i].x, base_kats[i].y);
+		ecc_point_free(&res);
+		SAE_BN_FREE(&k);
+	}
+
+	ecc_point_free(&g);
+}
+
+static void test_mul(const char *what)
+{
+	BIG_INTEGER_EC_POINT *p;
+	BIG_INTEGER_EC_POINT *res = NULL;
+	SAE_BN *k;
+	int i;
+
+	for (i = 0; i < sizeof(mul_kats) / sizeof(mul_kats[0]); i++) {
+		if (skip_edge && mul_kats[i].edge)
+			continue;
+
+		p = point(mul_kats[i].px, mul_kats[i].py);
+		k = bn(mul_kats[i].k);
+		ECC_POINT_MUL(p, k, group, &res);
+		check_point(what, i, res, mul_kats[i].x, mul_kats[i].y);
+		ecc_point_free(&res);
+		ecc_point_free(&p);
+		SAE_BN_FREE(&k);
+	}
+}
+
+static void test_k(void)
+{
+	BIG_INTEGER_EC_POINT *p;
+	BIG_INTEGER_EC_POINT *e;
+	BIG_INTEGER_EC_POINT *res = NULL;
+	SAE_BN *s;
+	SAE_BN *r;
+	int i;
+
+	for (i = 0; i < sizeof(k_kats) / sizeof(k_kats[0]); i++) {
+		p = point(k_kats[i].px, k_kats[i].py);
+		e = point(k_kats[i].ex, k_kats[i].ey);
+		s = bn(k_kats[i].s);
+		r = bn(k_kats[i].r);
+		ECC_POINT_MUL(p, s, group, &res);
+		ecc_point_add(res, e, group, &res);
+		ECC_POINT_MUL(res, r, group, &res);
+		check_point("k", i, res, k_kats[i].x, k_kats[i].y);
+		ecc_point_free(&res);
+		ecc_point_free(&p);
+		ecc_point_free(&e);
+		SAE_BN_FREE(&s);
+		SAE_BN_FREE(&r);
+	}
+}
+
+static void test_find(void)
+{
+	SAE_BN *x;
+	SAE_BN *y = NULL;
+	SAE_BN *neg = NULL;
+	UCHAR found;
+	int ok;
+	int i;
+
+	for (i = 0; i < sizeof(find_kats) / sizeof(find_kats[0]); i++) {
+		x = bn(find_kats[i].x);
+		found = ecc_point_find_by_x(group, x, &y, TRUE);
+
+		if (!find_kats[i].y)
+			ok = !found;
+		else if (!found)
+			ok = 0;
+		else {
+			/* either root will do */
+			SAE_BN_SUB(group->prime, y, &neg);
+			ok = bn_equal(y, find_kats[i].y) || bn_equal(neg, find_kats[i].y);
+		}
+
+		if (!ok) {
+			printf("FAIL find %d: expected %s\n", i, find_kats[i].y ? "a root" : "none");
+			failures++;
+		}
+
+		SAE_BN_FREE(&x);
+		SAE_BN_FREE(&y);
+		SAE_BN_FREE(&neg);
+	}
+}
+
+static void test_on_curve(void)
+{
+	int n = sizeof(mul_kats) / sizeof(mul_kats[0]);
+	BIG_INTEGER_EC_POINT *p;
+	int i;
+
+	for (i = 0; i < n; i++) {
+		p = point(mul_kats[i].px, mul_kats[i].py);
+
+		if (!ecc_point_is_on_curve(group, p)) {
+			printf("FAIL on_curve %d\n", i);
+			failures++;
+		}
+
+		ecc_point_free(&p);
+
+		/* the y of another point */
+		p = point(mul_kats[i].px, mul_kats[(i + 1) % n].py);
+
+		if (ecc_point_is_on_curve(group, p)) {
+			printf("FAIL off_curve %d\n", i);
+			failures++;
+		}
+
+		ecc_point_free(&p);
+	}
+}
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static void bench(int n)
+{
+	BIG_INTEGER_EC_POINT *g = generator();
+	BIG_INTEGER_EC_POINT *p = point(mul_kats[0].px, mul_kats[0].py);
+	BIG_INTEGER_EC_POINT *res = NULL;
+	SAE_BN *k = bn(mul_kats[0].k);
+	int n_find = sizeof(find_kats) / sizeof(find_kats[0]);
+	SAE_BN *x[sizeof(find_kats) / sizeof(find_kats[0])];
+	SAE_BN *y = NULL;
+	double t;
+	int i;
+
+	for (i = 0; i < n_find; i++)
+		x[i] = bn(find_kats[i].x);
+
+	t = now();
+	for (i = 0; i < n; i++) {
+		ECC_POINT_MUL(p, k, group, &res);
+		SAE_ECC_3D_to_2D(group, res);
+		ecc_point_free(&res);
+	}
+	printf("mul       %10.1f us\n", (now() - t) / n);
+
+	t = now();
+	for (i = 0; i < n; i++) {
+		ECC_POINT_MUL(g, k, group, &res);
+		SAE_ECC_3D_to_2D(group, res);
+		ecc_point_free(&res);
+	}
+	printf("mul_gen   %10.1f us\n", (now() - t) / n);
+
+	t = now();
+	for (i = 0; i < n; i++) {
+		ecc_point_find_by_x(group, x[i % n_find], &y, TRUE);
+		SAE_BN_FREE(&y);
+	}
+	printf("find_y    %10.1f us\n", (now() - t) / n);
+
+	t = now();
+	for (i = 0; i < n * 100; i++)
+		ecc_point_is_on_curve(group, p);
+	printf("on_curve  %10.2f us\n", (now() - t) / n / 100);
+
+	ecc_point_free(&g);
+	ecc_point_free(&p);
+	SAE_BN_FREE(&k);
+
+	for (i = 0; i < n_find; i++)
+		SAE_BN_FREE(&x[i]);
+}
+
+int main(int argc, char **argv)
+{
+	int iterations = 0;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "sb:")) != -1) {
+		switch (opt) {
+		case 's':
+			skip_edge = 1;
+			break;
+		case 'b':
+			iterations = atoi(optarg);
+			break;
+		default:
+			fprintf(stderr, "Usage: %s [-s] [-b iterations]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	group = get_ecc_group_info_bi(19);
+
+	if (iterations > 0) {
+		bench(iterations);
+		return 0;
+	}
+
+	test_base();
+	test_mul("mul");
+	test_k();
+	test_find();
+	test_on_curve();
+
+	/* the table allocation fails, the generic path must give the same points */
+	shim_fail_alloc_size = P256_TABLE_SIZE;
+	test_mul("mul_nomem");
+	shim_fail_alloc_size = 0;
+
+	printf("%s\n", failures ? "FAIL" : "OK");
+	return failures ? 1 : 0;
+}
@@ -752,6 +752,10 @@ struct os_cookie {
 	struct proc_dir_entry *proc_fwdump_file;
 	CHAR fwdump_dir_name[11];
 #endif
+#ifdef MAT_SUPPORT
+	struct proc_dir_entry *proc_mat_file;
+	CHAR mat_file_name[IFNAMSIZ + 4];
+#endif /* MAT_SUPPORT */
 
 	struct workqueue_struct *hif_wq;
 	struct work_struct tx_dma_done_work;
@@ -1838,6 +1842,13 @@ INT os_set_fwdump_path(VOID *pAd, VOID *arg);
 #define RTMP_OS_FWDUMP_SETPATH(ad, ar)	os_set_fwdump_path(ad, ar)
 #endif
 
+#ifdef MAT_SUPPORT
+BOOLEAN MATProcCreate(VOID *pAd);
+VOID MATProcRemove(VOID *pAd);
+#define RTMP_OS_MAT_PROC_CREATE(ad)	MATProcCreate(ad)
+#define RTMP_OS_MAT_PROC_REMOVE(ad)	MATProcRemove(ad)
+#endif /* MAT_SUPPORT */
+
 #define OS_TRACE __builtin_return_address(0)
 
 typedef struct kref os_kref;
@@ -305,6 +305,24 @@ RTMP_DECLARE_DRV_OPS_FUNCTION(pci);
 
 #endif /* OS_ABL_FUNC_SUPPORT */
 
+/* RCU, for tables read lock-free from the data path */
+typedef struct rcu_head RTMP_OS_RCU_HEAD;
+
+#define RTMP_RCU_READ_LOCK()					rcu_read_lock()
+#define RTMP_RCU_READ_UNLOCK()					rcu_read_unlock()
+#define RTMP_RCU_DEREFERENCE(__p)				rcu_dereference(__p)
+#define RTMP_RCU_ASSIGN_POINTER(__p, __v)		rcu_assign_pointer(__p, __v)
+#define RTMP_CALL_RCU(__pHead, __func)			call_rcu(__pHead, __func)
+#define RTMP_SYNCHRONIZE_RCU()					synchronize_rcu()
+#define RTMP_RCU_BARRIER()						rcu_barrier()
+
+/* per-CPU data, for counters bumped from the data path on every CPU */
+#define RTMP_OS_PERCPU_ALLOC(__size)			__alloc_percpu(__size, sizeof(ULONG))
+#define RTMP_OS_PERCPU_FREE(__p)				free_percpu(__p)
+#define RTMP_OS_PERCPU_INC(__var)				this_cpu_inc(__var)
+#define RTMP_OS_PERCPU_PTR(__p, __cpu)			per_cpu_ptr(__p, __cpu)
+#define RTMP_OS_FOR_EACH_CPU(__cpu)				for_each_possible_cpu(__cpu)
+
 
 /*****************************************************************************
  *	OS task related data structure and definitions
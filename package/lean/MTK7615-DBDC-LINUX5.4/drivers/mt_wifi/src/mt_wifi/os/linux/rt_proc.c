@@ -556,3 +556,102 @@ int wl_proc_exit(void)
 }
 #endif /* VIDEO_TURBINE_SUPPORT  && CONFIG_PROC_FS */
 
+
+#ifdef MAT_SUPPORT
+#include <linux/seq_file.h>
+
+#define MAT_PROC_NAME	"mat_"
+
+static const RTMP_STRING *mat_db_type_str[MAT_DB_TYPE_MAX] = {
+	"IPv4", "IPv6", "PPPoE-Ses", "PPPoE-Uid"
+};
+
+static int mat_proc_show(struct seq_file *m, void *v)
+{
+	struct _RTMP_ADAPTER *pAd = (struct _RTMP_ADAPTER *)m->private;
+	MAT_STRUCT *pMatCfg = &pAd->MatCfg;
+	MAT_DB_STAT stat;
+	INT type;
+
+	seq_printf(m, "HashSize=%u, nodeCount=%u\n",
+			   pMatCfg->MatTableSet.HashSize, pMatCfg->nodeCount);
+	seq_printf(m, "%-10s %8s %10s %10s %10s\n", "Type", "Entry", "Hit", "Miss", "BcastFB");
+
+	for (type = 0; type < MAT_DB_TYPE_MAX; type++) {
+		MATDBStatGet(pMatCfg, type, &stat);
+		seq_printf(m, "%-10s %8u %10lu %10lu %10lu\n", mat_db_type_str[type],
+				   pMatCfg->MatTableSet.EntryCnt[type], stat.Hit, stat.Miss, stat.BcastFallback);
+	}
+
+	return 0;
+}
+
+static int mat_proc_open(struct inode *inode, struct file *fp)
+{
+#if (KERNEL_VERSION(3, 10, 0) > LINUX_VERSION_CODE)
+	return single_open(fp, mat_proc_show, PDE(inode)->data);
+#else
+	return single_open(fp, mat_proc_show, PDE_DATA(inode));
+#endif
+}
+
+/* any write clears the hit/miss counters, the entry counts are kept */
+static ssize_t mat_proc_write(struct file *fp, const char __user *buf, size_t cnt, loff_t *pos)
+{
+	struct _RTMP_ADAPTER *pAd = (struct _RTMP_ADAPTER *)((struct seq_file *)fp->private_data)->private;
+
+	MATDBStatClear(&pAd->MatCfg);
+	return cnt;
+}
+
+#if (KERNEL_VERSION(5, 6, 0) > LINUX_VERSION_CODE)
+static const struct file_operations fops_mat = {
+	.owner = THIS_MODULE,
+	.open = mat_proc_open,
+	.read = seq_read,
+	.write = mat_proc_write,
+	.llseek = seq_lseek,
+	.release = single_release,
+};
+#else
+static const struct proc_ops fops_mat = {
+	.proc_open = mat_proc_open,
+	.proc_read = seq_read,
+	.proc_write = mat_proc_write,
+	.proc_lseek = seq_lseek,
+	.proc_release = single_release,
+};
+#endif
+
+BOOLEAN MATProcCreate(VOID *ptr)
+{
+	struct _RTMP_ADAPTER *pAd = (struct _RTMP_ADAPTER *)ptr;
+	POS_COOKIE pCookie = (POS_COOKIE) pAd->OS_Cookie;
+
+	if (pCookie->proc_mat_file)
+		return TRUE;
+
+	snprintf(pCookie->mat_file_name, sizeof(pCookie->mat_file_name), "%s%s",
+			 MAT_PROC_NAME, pAd->net_dev->name);
+	pCookie->proc_mat_file = proc_create_data(pCookie->mat_file_name, 0644, NULL, &fops_mat, (VOID *)pAd);
+
+	if (!pCookie->proc_mat_file) {
+		MTWF_LOG(DBG_CAT_PROTO, CATPROTO_MAT, DBG_LVL_ERROR,
+				 ("%s: Create /proc/%s fail\n", __func__, pCookie->mat_file_name));
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+VOID MATProcRemove(VOID *ptr)
+{
+	struct _RTMP_ADAPTER *pAd = (struct _RTMP_ADAPTER *)ptr;
+	POS_COOKIE pCookie = (POS_COOKIE) pAd->OS_Cookie;
+
+	if (pCookie->proc_mat_file) {
+		remove_proc_entry(pCookie->mat_file_name, NULL);
+		pCookie->proc_mat_file = NULL;
+	}
+}
+#endif /* MAT_SUPPORT */
@@ -778,11 +778,14 @@ function apcli_connect(dev, vif)
         os.execute("ubus call network.interface.lan add_device \"{\\\"name\\\":\\\""..vifname.."\\\"}\"")
     end
 
+    -- the driver applies comma separated settings in order within one call,
+    -- free text values (keys, ssid) may contain commas and stay separate;
+    -- MACRepeaterEn only exists with MAC_REPEATER_SUPPORT, keep it on its own
     os.execute("iwpriv "..vifname.." set MACRepeaterEn="..cfgs.MACRepeaterEn)
-    os.execute("iwpriv "..vifname.." set ApCliEnable=0")
-    os.execute("iwpriv "..vifname.." set Channel="..cfgs.Channel)
-    os.execute("iwpriv "..vifname.." set ApCliAuthMode="..cfgs.ApCliAuthMode)
-    os.execute("iwpriv "..vifname.." set ApCliEncrypType="..cfgs.ApCliEncrypType)
+    os.execute("iwpriv "..vifname.." set ApCliEnable=0"
+        ..",Channel="..cfgs.Channel
+        ..",ApCliAuthMode="..cfgs.ApCliAuthMode
+        ..",ApCliEncrypType="..cfgs.ApCliEncrypType)
     if cfgs.ApCliAuthMode == "WEP" then
         os.execute("#iwpriv "..vifname.." set ApCliDefaultKeyID="..cfgs.ApCliDefaultKeyID)
         os.execute("#iwpriv "..vifname.." set ApCliKey1="..cfgs.ApCliKey1Str)
@@ -71,21 +71,19 @@ static const unsigned char charsets[] =
 #define BIG5        005
 #define GBK         006
 
-/* FIXME: these are not implemented yet
-// EUC:   A1-FE A1-FE
-// GBK:   81-FE 40-7E,80-FE
-// Big5:  A1-FE 40-7E,A1-FE
-*/
-
-static const unsigned short maplen[] = {
-	[UCS2_8BIT] = 4+ 2* 128,
-	[UCS3_8BIT] = 4+ 3* 128,
-	[EUC]       = 4+ 2* 94*94,
-	[SHIFT_JIS] = 4+ 2* 94*94,
-	[BIG5]      = 4+ 2* 94*157,
-	[GBK]       = 4+ 2* 126*190,
-	[EUC_TW]    = 4+ 2* 2*94*94,
-};
+/*
+ * Double byte charmaps are stored as two-level tables: after the 4 byte
+ * header there is one 16 bit row number per lead byte (0xffff if nothing
+ * is mapped in that row), followed by the rows themselves, each holding
+ * one 16 bit code point per trail byte (0xffff if unmapped).
+ *
+ * EUC:       A1-FE        A1-FE
+ * GBK:       81-FE        40-7E,80-FE
+ * Big5:      A1-FE        40-7E,A1-FE
+ * Shift_JIS: 81-9F,E0-FC  40-7E,80-FC
+ *
+ * FIXME: EUC_TW is not implemented yet
+ */
 
 static int find_charmap(const char *name)
 {
@@ -138,6 +136,115 @@ static inline void put_16(unsigned char *s, wchar_t c, int endian)
 	s[endian^1] = c;
 }
 
+static inline wchar_t dbcs_decode(const unsigned char *map, unsigned lead,
+                                  unsigned trail)
+{
+	unsigned row, col, rows, cols;
+
+	switch (map[0]) {
+	case EUC:
+		row = lead - 0xa1;
+		rows = 94;
+		col = trail - 0xa1;
+		cols = 94;
+		if (col >= cols) return 0xffff;
+		break;
+	case GBK:
+		row = lead - 0x81;
+		rows = 126;
+		if (trail < 0x40 || trail == 0x7f || trail == 0xff) return 0xffff;
+		col = trail - 0x40 - (trail > 0x7f);
+		cols = 190;
+		break;
+	case BIG5:
+		row = lead - 0xa1;
+		rows = 94;
+		if (trail - 0x40 < 0x3f) col = trail - 0x40;
+		else if (trail - 0xa1 < 94) col = trail - 0xa1 + 0x3f;
+		else return 0xffff;
+		cols = 157;
+		break;
+	case SHIFT_JIS:
+		if (lead > 0x9f && lead < 0xe0) return 0xffff;
+		row = (lead < 0xe0) ? lead - 0x81 : lead - 0xe0 + 0x1f;
+		rows = 60;
+		if (trail < 0x40 || trail == 0x7f || trail > 0xfc) return 0xffff;
+		col = trail - 0x40 - (trail > 0x7f);
+		cols = 188;
+		break;
+	default:
+		return 0xffff;
+	}
+
+	if (row >= rows) return 0xffff;
+	row = get_16(map + 4 + 2*row, 0);
+	if (row == 0xffff) return 0xffff;
+	return get_16(map + 4 + 2*rows + 2*(row*cols + col), 0);
+}
+
+/* length of the run of plain ASCII bytes at the start of s, a word at a time */
+static inline size_t ascii_span(const unsigned char *s, size_t n)
+{
+	const size_t high = (size_t)-1 / 0xff * 0x80;
+	const unsigned char *p = s;
+	size_t w;
+
+	for (; n >= sizeof(w); p += sizeof(w), n -= sizeof(w)) {
+		memcpy(&w, p, sizeof(w));
+		if (w & high) break;
+	}
+	for (; n && *p < 0x80; p++, n--);
+	return p - s;
+}
+
+/* length of the run of ASCII code units at the start of the UTF-16 string s */
+static inline size_t utf16_ascii_span(const unsigned char *s, size_t n, int endian)
+{
+	size_t i;
+
+	endian &= 1;
+	for (i = 0; i < n && !s[2*i + endian] && s[2*i + (endian^1)] < 0x80; i++);
+	return i;
+}
+
+/* copy a run of ASCII characters in one step, return the number of input bytes taken */
+static size_t ascii_copy(unsigned char to, int from, char **in, size_t inb,
+                         char **out, size_t *outb)
+{
+	const unsigned char *s = (const unsigned char *)*in;
+	unsigned char *d = (unsigned char *)*out;
+	size_t i, n;
+
+	if (from <= UTF_16LE) {
+		if (to < UTF_8) return 0;
+		n = utf16_ascii_span(s, (inb / 2 < *outb) ? inb / 2 : *outb, from);
+		for (i = 0; i < n; i++)
+			d[i] = s[2*i + ((from & 1) ^ 1)];
+		*out += n;
+		*outb -= n;
+		return 2*n;
+	}
+
+	if (to >= UTF_8) {
+		n = ascii_span(s, (inb < *outb) ? inb : *outb);
+		memcpy(d, s, n);
+		*out += n;
+		*outb -= n;
+		return n;
+	}
+
+	if (to <= UTF_16LE) {
+		n = ascii_span(s, (inb < *outb / 2) ? inb : *outb / 2);
+		for (i = 0; i < n; i++)
+			put_16(d + 2*i, s[i], to);
+		*out += 2*n;
+		*outb -= 2*n;
+		return n;
+	}
+
+	return 0;
+}
+
 static inline int utf8enc_wchar(char *outb, wchar_t c)
 {
 	if (c <= 0x7F) {
@@ -222,6 +329,7 @@ static inline int utf8dec_wchar(wchar_t *c, unsigned char *in, size_t inb)
 	else if ((*in & 0xF8) == 0xF0) n = 4;
 	else if ((*in & 0xFC) == 0xF8) n = 5;
 	else if ((*in & 0xFE) == 0xFC) n = 6;
+	else return -1;
 
 	/* starved? */
 	if (n > inb)
@@ -290,7 +398,14 @@ size_t iconv(iconv_t cd, char **in, size_t *inb, char **out, size_t *outb)
 	for (; *inb; *in+=l, *inb-=l) {
 		c = *(unsigned char *)*in;
 		l = 1;
-		if (from >= UTF_8 && c < 0x80) goto charok;
+		if ((from >= UTF_8 && c < 0x80) || from <= UTF_16LE) {
+			k = ascii_copy(to, from, in, *inb, out, outb);
+			if (k) {
+				l = k;
+				continue;
+			}
+			if (from >= UTF_8) goto charok;
+		}
 		switch (from) {
 		case WCHAR_T:
 			l = sizeof(wchar_t);
@@ -336,8 +451,8 @@ size_t iconv(iconv_t cd, char **in, size_t *inb, char **out, size_t *outb)
 				l = 4;
 				if (*inb < 4) goto starved;
 				d = get_16(*in + 2, from);
-				if ((unsigned)(c-0xdc00) >= 0x400) goto ilseq;
-				c = ((c-0xd800)<<10) | (d-0xdc00);
+				if ((unsigned)(d-0xdc00) >= 0x400) goto ilseq;
+				c = (((c-0xd800)<<10) | (d-0xdc00)) + 0x10000;
 			}
 			break;
 		case UTF_32BE:
@@ -352,26 +467,24 @@ size_t iconv(iconv_t cd, char **in, size_t *inb, char **out, size_t *outb)
 			if (c < 0x80) break;
 			switch (map[0]) {
 			case UCS2_8BIT:
-				c -= 0x80;
-				break;
-			case EUC:
-				if ((unsigned)c - 0xa1 >= 94) goto ilseq;
-				if ((unsigned)in[0][1] - 0xa1 >= 94) goto ilseq;
-				c = (c-0xa1)*94 + (in[0][1]-0xa1);
-				l = 2;
+				c = get_16(map + 4 + 2*(c-0x80), 0);
 				break;
 			case SHIFT_JIS:
 				if ((unsigned)c - 0xa1 <= 0xdf-0xa1) {
 					c += 0xff61-0xa1;
 					goto charok;
 				}
-				// FIXME...
+				/* fall through */
+			case EUC:
+			case BIG5:
+			case GBK:
 				l = 2;
+				if (*inb < 2) goto starved;
+				c = dbcs_decode(map, c, ((unsigned char *)*in)[1]);
 				break;
 			default:
 				goto badf;
 			}
-			c = get_16(map + 4 + 2*c, 0);
 			if (c == 0xffff) goto ilseq;
 			goto charok;
 		}
@@ -419,6 +532,7 @@ charok:
 				break;
 			}
 			if (*outb < 4) goto toobig;
+			c -= 0x10000;
 			put_16(*out, (c>>10)|0xd800, to);
 			put_16(*out + 2, (c&0x3ff)|0xdc00, to);
 			*out += 4;
@@ -443,6 +557,7 @@ toobig:
 	goto end;
 starved:
 	err = EINVAL;
+	x = -1;
 end:
 	errno = err;
 	return x;
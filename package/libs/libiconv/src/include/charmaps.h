@@ -23,6 +23,10 @@
 #include "charmaps/windows-1256.h"
 #include "charmaps/windows-1257.h"
 #include "charmaps/windows-1258.h"
+#include "charmaps/euc-kr.h"
+#include "charmaps/gbk.h"
+#include "charmaps/big5.h"
+#include "charmaps/shift-jis.h"
 #endif
 
 
@@ -64,6 +68,13 @@ static struct charmap charmaps[] = {
 
 	{ "KOI8-R",       map_koi8_r       },
 
+#ifdef ALL_CHARSETS
+	{ "EUC-KR",       map_euc_kr       },
+	{ "GBK",          map_gbk          },
+	{ "BIG5",         map_big5         },
+	{ "SHIFT_JIS",    map_shift_jis    },
+#endif
+
 	/* Aliases */
 	{ "LATIN2",       map_iso_8859_2   },
 	{ "LATIN6",       map_iso_8859_10  },
@@ -76,5 +87,11 @@ static struct charmap charmaps[] = {
 	{ "LATIN3",       map_iso_8859_3   },
 	{ "LATIN4",       map_iso_8859_4   },
 	{ "LATIN5",       map_iso_8859_9   },
+	{ "CP936",        map_gbk          },
+	{ "GB2312",       map_gbk          },
+	{ "EUC-CN",       map_gbk          },
+	{ "BIG-5",        map_big5         },
+	{ "SJIS",         map_shift_jis    },
+	{ "SHIFT-JIS",    map_shift_jis    },
 #endif
 };
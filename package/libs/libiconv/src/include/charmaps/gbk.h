@@ -0,0 +1,4014 @@
+static const unsigned char map_gbk[] = {
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03,
+	0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09,
+	0x00, 0x0a, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f,
+	0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15,
+	0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b,
+	0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x20, 0x00, 0x21,
+	0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27,
+	0x00, 0x28, 0x00, 0x29, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d,
+	0x00, 0x2e, 0x00, 0x2f, 0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33,
+	0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39,
+	0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f,
+	0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45,
+	0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b,
+	0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x51,
+	0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57,
+	0x00, 0x58, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d,
+	0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x61, 0x00, 0x62, 0x00, 0x63,
+	0x00, 0x64, 0x00, 0x65, 0x00, 0x66, 0x00, 0x67, 0x00, 0x68, 0x00, 0x69,
+	0x00, 0x6a, 0x00, 0x6b, 0x00, 0x6c, 0x00, 0x6d, 0x00, 0x6e, 0x00, 0x6f,
+	0x00, 0x70, 0x00, 0x71, 0x00, 0x72, 0x00, 0x73, 0x00, 0x74, 0x00, 0x75,
+	0x00, 0x76, 0x00, 0x77, 0x00, 0x78, 0x00, 0x79, 0x00, 0x7a, 0x00, 0x7b,
+	0x00, 0x7c, 0x00, 0x7d, 0x4e, 0x02, 0x4e, 0x04, 0x4e, 0x05, 0x4e, 0x06,
+	0x4e, 0x0f, 0x4e, 0x12, 0x4e, 0x17, 0x4e, 0x1f, 0x4e, 0x20, 0x4e, 0x21,
+	0x4e, 0x23, 0x4e, 0x26, 0x4e, 0x29, 0x4e, 0x2e, 0x4e, 0x2f, 0x4e, 0x31,
+	0x4e, 0x33, 0x4e, 0x35, 0x4e, 0x37, 0x4e, 0x3c, 0x4e, 0x40, 0x4e, 0x41,
+	0x4e, 0x42, 0x4e, 0x44, 0x4e, 0x46, 0x4e, 0x4a, 0x4e, 0x51, 0x4e, 0x55,
+	0x4e, 0x57, 0x4e, 0x5a, 0x4e, 0x5b, 0x4e, 0x62, 0x4e, 0x63, 0x4e, 0x64,
+	0x4e, 0x65, 0x4e, 0x67, 0x4e, 0x68, 0x4e, 0x6a, 0x4e, 0x6b, 0x4e, 0x6c,
+	0x4e, 0x6d, 0x4e, 0x6e, 0x4e, 0x6f, 0x4e, 0x72, 0x4e, 0x74, 0x4e, 0x75,
+	0x4e, 0x76, 0x4e, 0x77, 0x4e, 0x78, 0x4e, 0x79, 0x4e, 0x7a, 0x4e, 0x7b,
+	0x4e, 0x7c, 0x4e, 0x7d, 0x4e, 0x7f, 0x4e, 0x80, 0x4e, 0x81, 0x4e, 0x82,
+	0x4e, 0x83, 0x4e, 0x84, 0x4e, 0x85, 0x4e, 0x87, 0x4e, 0x8a, 0x4e, 0x90,
+	0x4e, 0x96, 0x4e, 0x97, 0x4e, 0x99, 0x4e, 0x9c, 0x4e, 0x9d, 0x4e, 0x9e,
+	0x4e, 0xa3, 0x4e, 0xaa, 0x4e, 0xaf, 0x4e, 0xb0, 0x4e, 0xb1, 0x4e, 0xb4,
+	0x4e, 0xb6, 0x4e, 0xb7, 0x4e, 0xb8, 0x4e, 0xb9, 0x4e, 0xbc, 0x4e, 0xbd,
+	0x4e, 0xbe, 0x4e, 0xc8, 0x4e, 0xcc, 0x4e, 0xcf, 0x4e, 0xd0, 0x4e, 0xd2,
+	0x4e, 0xda, 0x4e, 0xdb, 0x4e, 0xdc, 0x4e, 0xe0, 0x4e, 0xe2, 0x4e, 0xe6,
+	0x4e, 0xe7, 0x4e, 0xe9, 0x4e, 0xed, 0x4e, 0xee, 0x4e, 0xef, 0x4e, 0xf1,
+	0x4e, 0xf4, 0x4e, 0xf8, 0x4e, 0xf9, 0x4e, 0xfa, 0x4e, 0xfc, 0x4e, 0xfe,
+	0x4f, 0x00, 0x4f, 0x02, 0x4f, 0x03, 0x4f, 0x04, 0x4f, 0x05, 0x4f, 0x06,
+	0x4f, 0x07, 0x4f, 0x08, 0x4f, 0x0b, 0x4f, 0x0c, 0x4f, 0x12, 0x4f, 0x13,
+	0x4f, 0x14, 0x4f, 0x15, 0x4f, 0x16, 0x4f, 0x1c, 0x4f, 0x1d, 0x4f, 0x21,
+	0x4f, 0x23, 0x4f, 0x28, 0x4f, 0x29, 0x4f, 0x2c, 0x4f, 0x2d, 0x4f, 0x2e,
+	0x4f, 0x31, 0x4f, 0x33, 0x4f, 0x35, 0x4f, 0x37, 0x4f, 0x39, 0x4f, 0x3b,
+	0x4f, 0x3e, 0x4f, 0x3f, 0x4f, 0x40, 0x4f, 0x41, 0x4f, 0x42, 0x4f, 0x44,
+	0x4f, 0x45, 0x4f, 0x47, 0x4f, 0x48, 0x4f, 0x49, 0x4f, 0x4a, 0x4f, 0x4b,
+	0x4f, 0x4c, 0x4f, 0x52, 0x4f, 0x54, 0x4f, 0x56, 0x4f, 0x61, 0x4f, 0x62,
+	0x4f, 0x66, 0x4f, 0x68, 0x4f, 0x6a, 0x4f, 0x6b, 0x4f, 0x6d, 0x4f, 0x6e,
+	0x4f, 0x71, 0x4f, 0x72, 0x4f, 0x75, 0x4f, 0x77, 0x4f, 0x78, 0x4f, 0x79,
+	0x4f, 0x7a, 0x4f, 0x7d, 0x4f, 0x80, 0x4f, 0x81, 0x4f, 0x82, 0x4f, 0x85,
+	0x4f, 0x86, 0x4f, 0x87, 0x4f, 0x8a, 0x4f, 0x8c, 0x4f, 0x8e, 0x4f, 0x90,
+	0x4f, 0x92, 0x4f, 0x93, 0x4f, 0x95, 0x4f, 0x96, 0x4f, 0x98, 0x4f, 0x99,
+	0x4f, 0x9a, 0x4f, 0x9c, 0x4f, 0x9e, 0x4f, 0x9f, 0x4f, 0xa1, 0x4f, 0xa2,
+	0x4f, 0xa4, 0x4f, 0xab, 0x4f, 0xad, 0x4f, 0xb0, 0x4f, 0xb1, 0x4f, 0xb2,
+	0x4f, 0xb3, 0x4f, 0xb4, 0x4f, 0xb6, 0x4f, 0xb7, 0x4f, 0xb8, 0x4f, 0xb9,
+	0x4f, 0xba, 0x4f, 0xbb, 0x4f, 0xbc, 0x4f, 0xbd, 0x4f, 0xbe, 0x4f, 0xc0,
+	0x4f, 0xc1, 0x4f, 0xc2, 0x4f, 0xc6, 0x4f, 0xc7, 0x4f, 0xc8, 0x4f, 0xc9,
+	0x4f, 0xcb, 0x4f, 0xcc, 0x4f, 0xcd, 0x4f, 0xd2, 0x4f, 0xd3, 0x4f, 0xd4,
+	0x4f, 0xd5, 0x4f, 0xd6, 0x4f, 0xd9, 0x4f, 0xdb, 0x4f, 0xe0, 0x4f, 0xe2,
+	0x4f, 0xe4, 0x4f, 0xe5, 0x4f, 0xe7, 0x4f, 0xeb, 0x4f, 0xec, 0x4f, 0xf0,
+	0x4f, 0xf2, 0x4f, 0xf4, 0x4f, 0xf5, 0x4f, 0xf6, 0x4f, 0xf7, 0x4f, 0xf9,
+	0x4f, 0xfb, 0x4f, 0xfc, 0x4f, 0xfd, 0x4f, 0xff, 0x50, 0x00, 0x50, 0x01,
+	0x50, 0x02, 0x50, 0x03, 0x50, 0x04, 0x50, 0x05, 0x50, 0x06, 0x50, 0x07,
+	0x50, 0x08, 0x50, 0x09, 0x50, 0x0a, 0x50, 0x0b, 0x50, 0x0e, 0x50, 0x10,
+	0x50, 0x11, 0x50, 0x13, 0x50, 0x15, 0x50, 0x16, 0x50, 0x17, 0x50, 0x1b,
+	0x50, 0x1d, 0x50, 0x1e, 0x50, 0x20, 0x50, 0x22, 0x50, 0x23, 0x50, 0x24,
+	0x50, 0x27, 0x50, 0x2b, 0x50, 0x2f, 0x50, 0x30, 0x50, 0x31, 0x50, 0x32,
+	0x50, 0x33, 0x50, 0x34, 0x50, 0x35, 0x50, 0x36, 0x50, 0x37, 0x50, 0x38,
+	0x50, 0x39, 0x50, 0x3b, 0x50, 0x3d, 0x50, 0x3f, 0x50, 0x40, 0x50, 0x41,
+	0x50, 0x42, 0x50, 0x44, 0x50, 0x45, 0x50, 0x46, 0x50, 0x49, 0x50, 0x4a,
+	0x50, 0x4b, 0x50, 0x4d, 0x50, 0x50, 0x50, 0x51, 0x50, 0x52, 0x50, 0x53,
+	0x50, 0x54, 0x50, 0x56, 0x50, 0x57, 0x50, 0x58, 0x50, 0x59, 0x50, 0x5b,
+	0x50, 0x5d, 0x50, 0x5e, 0x50, 0x5f, 0x50, 0x60, 0x50, 0x61, 0x50, 0x62,
+	0x50, 0x63, 0x50, 0x64, 0x50, 0x66, 0x50, 0x67, 0x50, 0x68, 0x50, 0x69,
+	0x50, 0x6a, 0x50, 0x6b, 0x50, 0x6d, 0x50, 0x6e, 0x50, 0x6f, 0x50, 0x70,
+	0x50, 0x71, 0x50, 0x72, 0x50, 0x73, 0x50, 0x74, 0x50, 0x75, 0x50, 0x78,
+	0x50, 0x79, 0x50, 0x7a, 0x50, 0x7c, 0x50, 0x7d, 0x50, 0x81, 0x50, 0x82,
+	0x50, 0x83, 0x50, 0x84, 0x50, 0x86, 0x50, 0x87, 0x50, 0x89, 0x50, 0x8a,
+	0x50, 0x8b, 0x50, 0x8c, 0x50, 0x8e, 0x50, 0x8f, 0x50, 0x90, 0x50, 0x91,
+	0x50, 0x92, 0x50, 0x93, 0x50, 0x94, 0x50, 0x95, 0x50, 0x96, 0x50, 0x97,
+	0x50, 0x98, 0x50, 0x99, 0x50, 0x9a, 0x50, 0x9b, 0x50, 0x9c, 0x50, 0x9d,
+	0x50, 0x9e, 0x50, 0x9f, 0x50, 0xa0, 0x50, 0xa1, 0x50, 0xa2, 0x50, 0xa4,
+	0x50, 0xa6, 0x50, 0xaa, 0x50, 0xab, 0x50, 0xad, 0x50, 0xae, 0x50, 0xaf,
+	0x50, 0xb0, 0x50, 0xb1, 0x50, 0xb3, 0x50, 0xb4, 0x50, 0xb5, 0x50, 0xb6,
+	0x50, 0xb7, 0x50, 0xb8, 0x50, 0xb9, 0x50, 0xbc, 0x50, 0xbd, 0x50, 0xbe,
+	0x50, 0xbf, 0x50, 0xc0, 0x50, 0xc1, 0x50, 0xc2, 0x50, 0xc3, 0x50, 0xc4,
+	0x50, 0xc5, 0x50, 0xc6, 0x50, 0xc7, 0x50, 0xc8, 0x50, 0xc9, 0x50, 0xca,
+	0x50, 0xcb, 0x50, 0xcc, 0x50, 0xcd, 0x50, 0xce, 0x50, 0xd0, 0x50, 0xd1,
+	0x50, 0xd2, 0x50, 0xd3, 0x50, 0xd4, 0x50, 0xd5, 0x50, 0xd7, 0x50, 0xd8,
+	0x50, 0xd9, 0x50, 0xdb, 0x50, 0xdc, 0x50, 0xdd, 0x50, 0xde, 0x50, 0xdf,
+	0x50, 0xe0, 0x50, 0xe1, 0x50, 0xe2, 0x50, 0xe3, 0x50, 0xe4, 0x50, 0xe5,
+	0x50, 0xe8, 0x50, 0xe9, 0x50, 0xea, 0x50, 0xeb, 0x50, 0xef, 0x50, 0xf0,
+	0x50, 0xf1, 0x50, 0xf2, 0x50, 0xf4, 0x50, 0xf6, 0x50, 0xf7, 0x50, 0xf8,
+	0x50, 0xf9, 0x50, 0xfa, 0x50, 0xfc, 0x50, 0xfd, 0x50, 0xfe, 0x50, 0xff,
+	0x51, 0x00, 0x51, 0x01, 0x51, 0x02, 0x51, 0x03, 0x51, 0x04, 0x51, 0x05,
+	0x51, 0x08, 0x51, 0x09, 0x51, 0x0a, 0x51, 0x0c, 0x51, 0x0d, 0x51, 0x0e,
+	0x51, 0x0f, 0x51, 0x10, 0x51, 0x11, 0x51, 0x13, 0x51, 0x14, 0x51, 0x15,
+	0x51, 0x16, 0x51, 0x17, 0x51, 0x18, 0x51, 0x19, 0x51, 0x1a, 0x51, 0x1b,
+	0x51, 0x1c, 0x51, 0x1d, 0x51, 0x1e, 0x51, 0x1f, 0x51, 0x20, 0x51, 0x22,
+	0x51, 0x23, 0x51, 0x24, 0x51, 0x25, 0x51, 0x26, 0x51, 0x27, 0x51, 0x28,
+	0x51, 0x29, 0x51, 0x2a, 0x51, 0x2b, 0x51, 0x2c, 0x51, 0x2d, 0x51, 0x2e,
+	0x51, 0x2f, 0x51, 0x30, 0x51, 0x31, 0x51, 0x32, 0x51, 0x33, 0x51, 0x34,
+	0x51, 0x35, 0x51, 0x36, 0x51, 0x37, 0x51, 0x38, 0x51, 0x39, 0x51, 0x3a,
+	0x51, 0x3b, 0x51, 0x3c, 0x51, 0x3d, 0x51, 0x3e, 0x51, 0x42, 0x51, 0x47,
+	0x51, 0x4a, 0x51, 0x4c, 0x51, 0x4e, 0x51, 0x4f, 0x51, 0x50, 0x51, 0x52,
+	0x51, 0x53, 0x51, 0x57, 0x51, 0x58, 0x51, 0x59, 0x51, 0x5b, 0x51, 0x5d,
+	0x51, 0x5e, 0x51, 0x5f, 0x51, 0x60, 0x51, 0x61, 0x51, 0x63, 0x51, 0x64,
+	0x51, 0x66, 0x51, 0x67, 0x51, 0x69, 0x51, 0x6a, 0x51, 0x6f, 0x51, 0x72,
+	0x51, 0x7a, 0x51, 0x7e, 0x51, 0x7f, 0x51, 0x83, 0x51, 0x84, 0x51, 0x86,
+	0x51, 0x87, 0x51, 0x8a, 0x51, 0x8b, 0x51, 0x8e, 0x51, 0x8f, 0x51, 0x90,
+	0x51, 0x91, 0x51, 0x93, 0x51, 0x94, 0x51, 0x98, 0x51, 0x9a, 0x51, 0x9d,
+	0x51, 0x9e, 0x51, 0x9f, 0x51, 0xa1, 0x51, 0xa3, 0x51, 0xa6, 0x51, 0xa7,
+	0x51, 0xa8, 0x51, 0xa9, 0x51, 0xaa, 0x51, 0xad, 0x51, 0xae, 0x51, 0xb4,
+	0x51, 0xb8, 0x51, 0xb9, 0x51, 0xba, 0x51, 0xbe, 0x51, 0xbf, 0x51, 0xc1,
+	0x51, 0xc2, 0x51, 0xc3, 0x51, 0xc5, 0x51, 0xc8, 0x51, 0xca, 0x51, 0xcd,
+	0x51, 0xce, 0x51, 0xd0, 0x51, 0xd2, 0x51, 0xd3, 0x51, 0xd4, 0x51, 0xd5,
+	0x51, 0xd6, 0x51, 0xd7, 0x51, 0xd8, 0x51, 0xd9, 0x51, 0xda, 0x51, 0xdc,
+	0x51, 0xde, 0x51, 0xdf, 0x51, 0xe2, 0x51, 0xe3, 0x51, 0xe5, 0x51, 0xe6,
+	0x51, 0xe7, 0x51, 0xe8, 0x51, 0xe9, 0x51, 0xea, 0x51, 0xec, 0x51, 0xee,
+	0x51, 0xf1, 0x51, 0xf2, 0x51, 0xf4, 0x51, 0xf7, 0x51, 0xfe, 0x52, 0x04,
+	0x52, 0x05, 0x52, 0x09, 0x52, 0x0b, 0x52, 0x0c, 0x52, 0x0f, 0x52, 0x10,
+	0x52, 0x13, 0x52, 0x14, 0x52, 0x15, 0x52, 0x1c, 0x52, 0x1e, 0x52, 0x1f,
+	0x52, 0x21, 0x52, 0x22, 0x52, 0x23, 0x52, 0x25, 0x52, 0x26, 0x52, 0x27,
+	0x52, 0x2a, 0x52, 0x2c, 0x52, 0x2f, 0x52, 0x31, 0x52, 0x32, 0x52, 0x34,
+	0x52, 0x35, 0x52, 0x3c, 0x52, 0x3e, 0x52, 0x44, 0x52, 0x45, 0x52, 0x46,
+	0x52, 0x47, 0x52, 0x48, 0x52, 0x49, 0x52, 0x4b, 0x52, 0x4e, 0x52, 0x4f,
+	0x52, 0x52, 0x52, 0x53, 0x52, 0x55, 0x52, 0x57, 0x52, 0x58, 0x52, 0x59,
+	0x52, 0x5a, 0x52, 0x5b, 0x52, 0x5d, 0x52, 0x5f, 0x52, 0x60, 0x52, 0x62,
+	0x52, 0x63, 0x52, 0x64, 0x52, 0x66, 0x52, 0x68, 0x52, 0x6b, 0x52, 0x6c,
+	0x52, 0x6d, 0x52, 0x6e, 0x52, 0x70, 0x52, 0x71, 0x52, 0x73, 0x52, 0x74,
+	0x52, 0x75, 0x52, 0x76, 0x52, 0x77, 0x52, 0x78, 0x52, 0x79, 0x52, 0x7a,
+	0x52, 0x7b, 0x52, 0x7c, 0x52, 0x7e, 0x52, 0x80, 0x52, 0x83, 0x52, 0x84,
+	0x52, 0x85, 0x52, 0x86, 0x52, 0x87, 0x52, 0x89, 0x52, 0x8a, 0x52, 0x8b,
+	0x52, 0x8c, 0x52, 0x8d, 0x52, 0x8e, 0x52, 0x8f, 0x52, 0x91, 0x52, 0x92,
+	0x52, 0x94, 0x52, 0x95, 0x52, 0x96, 0x52, 0x97, 0x52, 0x98, 0x52, 0x99,
+	0x52, 0x9a, 0x52, 0x9c, 0x52, 0xa4, 0x52, 0xa5, 0x52, 0xa6, 0x52, 0xa7,
+	0x52, 0xae, 0x52, 0xaf, 0x52, 0xb0, 0x52, 0xb4, 0x52, 0xb5, 0x52, 0xb6,
+	0x52, 0xb7, 0x52, 0xb8, 0x52, 0xb9, 0x52, 0xba, 0x52, 0xbb, 0x52, 0xbc,
+	0x52, 0xbd, 0x52, 0xc0, 0x52, 0xc1, 0x52, 0xc2, 0x52, 0xc4, 0x52, 0xc5,
+	0x52, 0xc6, 0x52, 0xc8, 0x52, 0xca, 0x52, 0xcc, 0x52, 0xcd, 0x52, 0xce,
+	0x52, 0xcf, 0x52, 0xd1, 0x52, 0xd3, 0x52, 0xd4, 0x52, 0xd5, 0x52, 0xd7,
+	0x52, 0xd9, 0x52, 0xda, 0x52, 0xdb, 0x52, 0xdc, 0x52, 0xdd, 0x52, 0xde,
+	0x52, 0xe0, 0x52, 0xe1, 0x52, 0xe2, 0x52, 0xe3, 0x52, 0xe5, 0x52, 0xe6,
+	0x52, 0xe7, 0x52, 0xe8, 0x52, 0xe9, 0x52, 0xea, 0x52, 0xeb, 0x52, 0xec,
+	0x52, 0xed, 0x52, 0xee, 0x52, 0xef, 0x52, 0xf1, 0x52, 0xf2, 0x52, 0xf3,
+	0x52, 0xf4, 0x52, 0xf5, 0x52, 0xf6, 0x52, 0xf7, 0x52, 0xf8, 0x52, 0xfb,
+	0x52, 0xfc, 0x52, 0xfd, 0x53, 0x01, 0x53, 0x02, 0x53, 0x03, 0x53, 0x04,
+	0x53, 0x07, 0x53, 0x09, 0x53, 0x0a, 0x53, 0x0b, 0x53, 0x0c, 0x53, 0x0e,
+	0x53, 0x11, 0x53, 0x12, 0x53, 0x13, 0x53, 0x14, 0x53, 0x18, 0x53, 0x1b,
+	0x53, 0x1c, 0x53, 0x1e, 0x53, 0x1f, 0x53, 0x22, 0x53, 0x24, 0x53, 0x25,
+	0x53, 0x27, 0x53, 0x28, 0x53, 0x29, 0x53, 0x2b, 0x53, 0x2c, 0x53, 0x2d,
+	0x53, 0x2f, 0x53, 0x30, 0x53, 0x31, 0x53, 0x32, 0x53, 0x33, 0x53, 0x34,
+	0x53, 0x35, 0x53, 0x36, 0x53, 0x37, 0x53, 0x38, 0x53, 0x3c, 0x53, 0x3d,
+	0x53, 0x40, 0x53, 0x42, 0x53, 0x44, 0x53, 0x46, 0x53, 0x4b, 0x53, 0x4c,
+	0x53, 0x4d, 0x53, 0x50, 0x53, 0x54, 0x53, 0x58, 0x53, 0x59, 0x53, 0x5b,
+	0x53, 0x5d, 0x53, 0x65, 0x53, 0x68, 0x53, 0x6a, 0x53, 0x6c, 0x53, 0x6d,
+	0x53, 0x72, 0x53, 0x76, 0x53, 0x79, 0x53, 0x7b, 0x53, 0x7c, 0x53, 0x7d,
+	0x53, 0x7e, 0x53, 0x80, 0x53, 0x81, 0x53, 0x83, 0x53, 0x87, 0x53, 0x88,
+	0x53, 0x8a, 0x53, 0x8e, 0x53, 0x8f, 0x53, 0x90, 0x53, 0x91, 0x53, 0x92,
+	0x53, 0x93, 0x53, 0x94, 0x53, 0x96, 0x53, 0x97, 0x53, 0x99, 0x53, 0x9b,
+	0x53, 0x9c, 0x53, 0x9e, 0x53, 0xa0, 0x53, 0xa1, 0x53, 0xa4, 0x53, 0xa7,
+	0x53, 0xaa, 0x53, 0xab, 0x53, 0xac, 0x53, 0xad, 0x53, 0xaf, 0x53, 0xb0,
+	0x53, 0xb1, 0x53, 0xb2, 0x53, 0xb3, 0x53, 0xb4, 0x53, 0xb5, 0x53, 0xb7,
+	0x53, 0xb8, 0x53, 0xb9, 0x53, 0xba, 0x53, 0xbc, 0x53, 0xbd, 0x53, 0xbe,
+	0x53, 0xc0, 0x53, 0xc3, 0x53, 0xc4, 0x53, 0xc5, 0x53, 0xc6, 0x53, 0xc7,
+	0x53, 0xce, 0x53, 0xcf, 0x53, 0xd0, 0x53, 0xd2, 0x53, 0xd3, 0x53, 0xd5,
+	0x53, 0xda, 0x53, 0xdc, 0x53, 0xdd, 0x53, 0xde, 0x53, 0xe1, 0x53, 0xe2,
+	0x53, 0xe7, 0x53, 0xf4, 0x53, 0xfa, 0x53, 0xfe, 0x53, 0xff, 0x54, 0x00,
+	0x54, 0x02, 0x54, 0x05, 0x54, 0x07, 0x54, 0x0b, 0x54, 0x14, 0x54, 0x18,
+	0x54, 0x19, 0x54, 0x1a, 0x54, 0x1c, 0x54, 0x22, 0x54, 0x24, 0x54, 0x25,
+	0x54, 0x2a, 0x54, 0x30, 0x54, 0x33, 0x54, 0x36, 0x54, 0x37, 0x54, 0x3a,
+	0x54, 0x3d, 0x54, 0x3f, 0x54, 0x41, 0x54, 0x42, 0x54, 0x44, 0x54, 0x45,
+	0x54, 0x47, 0x54, 0x49, 0x54, 0x4c, 0x54, 0x4d, 0x54, 0x4e, 0x54, 0x4f,
+	0x54, 0x51, 0x54, 0x5a, 0x54, 0x5d, 0x54, 0x5e, 0x54, 0x5f, 0x54, 0x60,
+	0x54, 0x61, 0x54, 0x63, 0x54, 0x65, 0x54, 0x67, 0x54, 0x69, 0x54, 0x6a,
+	0x54, 0x6b, 0x54, 0x6c, 0x54, 0x6d, 0x54, 0x6e, 0x54, 0x6f, 0x54, 0x70,
+	0x54, 0x74, 0x54, 0x79, 0x54, 0x7a, 0x54, 0x7e, 0x54, 0x7f, 0x54, 0x81,
+	0x54, 0x83, 0x54, 0x85, 0x54, 0x87, 0x54, 0x88, 0x54, 0x89, 0x54, 0x8a,
+	0x54, 0x8d, 0x54, 0x91, 0x54, 0x93, 0x54, 0x97, 0x54, 0x98, 0x54, 0x9c,
+	0x54, 0x9e, 0x54, 0x9f, 0x54, 0xa0, 0x54, 0xa1, 0x54, 0xa2, 0x54, 0xa5,
+	0x54, 0xae, 0x54, 0xb0, 0x54, 0xb2, 0x54, 0xb5, 0x54, 0xb6, 0x54, 0xb7,
+	0x54, 0xb9, 0x54, 0xba, 0x54, 0xbc, 0x54, 0xbe, 0x54, 0xc3, 0x54, 0xc5,
+	0x54, 0xca, 0x54, 0xcb, 0x54, 0xd6, 0x54, 0xd8, 0x54, 0xdb, 0x54, 0xe0,
+	0x54, 0xe1, 0x54, 0xe2, 0x54, 0xe3, 0x54, 0xe4, 0x54, 0xeb, 0x54, 0xec,
+	0x54, 0xef, 0x54, 0xf0, 0x54, 0xf1, 0x54, 0xf4, 0x54, 0xf5, 0x54, 0xf6,
+	0x54, 0xf7, 0x54, 0xf8, 0x54, 0xf9, 0x54, 0xfb, 0x54, 0xfe, 0x55, 0x00,
+	0x55, 0x02, 0x55, 0x03, 0x55, 0x04, 0x55, 0x05, 0x55, 0x08, 0x55, 0x0a,
+	0x55, 0x0b, 0x55, 0x0c, 0x55, 0x0d, 0x55, 0x0e, 0x55, 0x12, 0x55, 0x13,
+	0x55, 0x15, 0x55, 0x16, 0x55, 0x17, 0x55, 0x18, 0x55, 0x19, 0x55, 0x1a,
+	0x55, 0x1c, 0x55, 0x1d, 0x55, 0x1e, 0x55, 0x1f, 0x55, 0x21, 0x55, 0x25,
+	0x55, 0x26, 0x55, 0x28, 0x55, 0x29, 0x55, 0x2b, 0x55, 0x2d, 0x55, 0x32,
+	0x55, 0x34, 0x55, 0x35, 0x55, 0x36, 0x55, 0x38, 0x55, 0x39, 0x55, 0x3a,
+	0x55, 0x3b, 0x55, 0x3d, 0x55, 0x40, 0x55, 0x42, 0x55, 0x45, 0x55, 0x47,
+	0x55, 0x48, 0x55, 0x4b, 0x55, 0x4c, 0x55, 0x4d, 0x55, 0x4e, 0x55, 0x4f,
+	0x55, 0x51, 0x55, 0x52, 0x55, 0x53, 0x55, 0x54, 0x55, 0x57, 0x55, 0x58,
+	0x55, 0x59, 0x55, 0x5a, 0x55, 0x5b, 0x55, 0x5d, 0x55, 0x5e, 0x55, 0x5f,
+	0x55, 0x60, 0x55, 0x62, 0x55, 0x63, 0x55, 0x68, 0x55, 0x69, 0x55, 0x6b,
+	0x55, 0x6f, 0x55, 0x70, 0x55, 0x71, 0x55, 0x72, 0x55, 0x73, 0x55, 0x74,
+	0x55, 0x79, 0x55, 0x7a, 0x55, 0x7d, 0x55, 0x7f, 0x55, 0x85, 0x55, 0x86,
+	0x55, 0x8c, 0x55, 0x8d, 0x55, 0x8e, 0x55, 0x90, 0x55, 0x92, 0x55, 0x93,
+	0x55, 0x95, 0x55, 0x96, 0x55, 0x97, 0x55, 0x9a, 0x55, 0x9b, 0x55, 0x9e,
+	0x55, 0xa0, 0x55, 0xa1, 0x55, 0xa2, 0x55, 0xa3, 0x55, 0xa4, 0x55, 0xa5,
+	0x55, 0xa6, 0x55, 0xa8, 0x55, 0xa9, 0x55, 0xaa, 0x55, 0xab, 0x55, 0xac,
+	0x55, 0xad, 0x55, 0xae, 0x55, 0xaf, 0x55, 0xb0, 0x55, 0xb2, 0x55, 0xb4,
+	0x55, 0xb6, 0x55, 0xb8, 0x55, 0xba, 0x55, 0xbc, 0x55, 0xbf, 0x55, 0xc0,
+	0x55, 0xc1, 0x55, 0xc2, 0x55, 0xc3, 0x55, 0xc6, 0x55, 0xc7, 0x55, 0xc8,
+	0x55, 0xca, 0x55, 0xcb, 0x55, 0xce, 0x55, 0xcf, 0x55, 0xd0, 0x55, 0xd5,
+	0x55, 0xd7, 0x55, 0xd8, 0x55, 0xd9, 0x55, 0xda, 0x55, 0xdb, 0x55, 0xde,
+	0x55, 0xe0, 0x55, 0xe2, 0x55, 0xe7, 0x55, 0xe9, 0x55, 0xed, 0x55, 0xee,
+	0x55, 0xf0, 0x55, 0xf1, 0x55, 0xf4, 0x55, 0xf6, 0x55, 0xf8, 0x55, 0xf9,
+	0x55, 0xfa, 0x55, 0xfb, 0x55, 0xfc, 0x55, 0xff, 0x56, 0x02, 0x56, 0x03,
+	0x56, 0x04, 0x56, 0x05, 0x56, 0x06, 0x56, 0x07, 0x56, 0x0a, 0x56, 0x0b,
+	0x56, 0x0d, 0x56, 0x10, 0x56, 0x11, 0x56, 0x12, 0x56, 0x13, 0x56, 0x14,
+	0x56, 0x15, 0x56, 0x16, 0x56, 0x17, 0x56, 0x19, 0x56, 0x1a, 0x56, 0x1c,
+	0x56, 0x1d, 0x56, 0x20, 0x56, 0x21, 0x56, 0x22, 0x56, 0x25, 0x56, 0x26,
+	0x56, 0x28, 0x56, 0x29, 0x56, 0x2a, 0x56, 0x2b, 0x56, 0x2e, 0x56, 0x2f,
+	0x56, 0x30, 0x56, 0x33, 0x56, 0x35, 0x56, 0x37, 0x56, 0x38, 0x56, 0x3a,
+	0x56, 0x3c, 0x56, 0x3d, 0x56, 0x3e, 0x56, 0x40, 0x56, 0x41, 0x56, 0x42,
+	0x56, 0x43, 0x56, 0x44, 0x56, 0x45, 0x56, 0x46, 0x56, 0x47, 0x56, 0x48,
+	0x56, 0x49, 0x56, 0x4a, 0x56, 0x4b, 0x56, 0x4f, 0x56, 0x50, 0x56, 0x51,
+	0x56, 0x52, 0x56, 0x53, 0x56, 0x55, 0x56, 0x56, 0x56, 0x5a, 0x56, 0x5b,
+	0x56, 0x5d, 0x56, 0x5e, 0x56, 0x5f, 0x56, 0x60, 0x56, 0x61, 0x56, 0x63,
+	0x56, 0x65, 0x56, 0x66, 0x56, 0x67, 0x56, 0x6d, 0x56, 0x6e, 0x56, 0x6f,
+	0x56, 0x70, 0x56, 0x72, 0x56, 0x73, 0x56, 0x74, 0x56, 0x75, 0x56, 0x77,
+	0x56, 0x78, 0x56, 0x79, 0x56, 0x7a, 0x56, 0x7d, 0x56, 0x7e, 0x56, 0x7f,
+	0x56, 0x80, 0x56, 0x81, 0x56, 0x82, 0x56, 0x83, 0x56, 0x84, 0x56, 0x87,
+	0x56, 0x88, 0x56, 0x89, 0x56, 0x8a, 0x56, 0x8b, 0x56, 0x8c, 0x56, 0x8d,
+	0x56, 0x90, 0x56, 0x91, 0x56, 0x92, 0x56, 0x94, 0x56, 0x95, 0x56, 0x96,
+	0x56, 0x97, 0x56, 0x98, 0x56, 0x99, 0x56, 0x9a, 0x56, 0x9b, 0x56, 0x9c,
+	0x56, 0x9d, 0x56, 0x9e, 0x56, 0x9f, 0x56, 0xa0, 0x56, 0xa1, 0x56, 0xa2,
+	0x56, 0xa4, 0x56, 0xa5, 0x56, 0xa6, 0x56, 0xa7, 0x56, 0xa8, 0x56, 0xa9,
+	0x56, 0xaa, 0x56, 0xab, 0x56, 0xac, 0x56, 0xad, 0x56, 0xae, 0x56, 0xb0,
+	0x56, 0xb1, 0x56, 0xb2, 0x56, 0xb3, 0x56, 0xb4, 0x56, 0xb5, 0x56, 0xb6,
+	0x56, 0xb8, 0x56, 0xb9, 0x56, 0xba, 0x56, 0xbb, 0x56, 0xbd, 0x56, 0xbe,
+	0x56, 0xbf, 0x56, 0xc0, 0x56, 0xc1, 0x56, 0xc2, 0x56, 0xc3, 0x56, 0xc4,
+	0x56, 0xc5, 0x56, 0xc6, 0x56, 0xc7, 0x56, 0xc8, 0x56, 0xc9, 0x56, 0xcb,
+	0x56, 0xcc, 0x56, 0xcd, 0x56, 0xce, 0x56, 0xcf, 0x56, 0xd0, 0x56, 0xd1,
+	0x56, 0xd2, 0x56, 0xd3, 0x56, 0xd5, 0x56, 0xd6, 0x56, 0xd8, 0x56, 0xd9,
+	0x56, 0xdc, 0x56, 0xe3, 0x56, 0xe5, 0x56, 0xe6, 0x56, 0xe7, 0x56, 0xe8,
+	0x56, 0xe9, 0x56, 0xea, 0x56, 0xec, 0x56, 0xee, 0x56, 0xef, 0x56, 0xf2,
+	0x56, 0xf3, 0x56, 0xf6, 0x56, 0xf7, 0x56, 0xf8, 0x56, 0xfb, 0x56, 0xfc,
+	0x57, 0x00, 0x57, 0x01, 0x57, 0x02, 0x57, 0x05, 0x57, 0x07, 0x57, 0x0b,
+	0x57, 0x0c, 0x57, 0x0d, 0x57, 0x0e, 0x57, 0x0f, 0x57, 0x10, 0x57, 0x11,
+	0x57, 0x12, 0x57, 0x13, 0x57, 0x14, 0x57, 0x15, 0x57, 0x16, 0x57, 0x17,
+	0x57, 0x18, 0x57, 0x19, 0x57, 0x1a, 0x57, 0x1b, 0x57, 0x1d, 0x57, 0x1e,
+	0x57, 0x20, 0x57, 0x21, 0x57, 0x22, 0x57, 0x24, 0x57, 0x25, 0x57, 0x26,
+	0x57, 0x27, 0x57, 0x2b, 0x57, 0x31, 0x57, 0x32, 0x57, 0x34, 0x57, 0x35,
+	0x57, 0x36, 0x57, 0x37, 0x57, 0x38, 0x57, 0x3c, 0x57, 0x3d, 0x57, 0x3f,
+	0x57, 0x41, 0x57, 0x43, 0x57, 0x44, 0x57, 0x45, 0x57, 0x46, 0x57, 0x48,
+	0x57, 0x49, 0x57, 0x4b, 0x57, 0x52, 0x57, 0x53, 0x57, 0x54, 0x57, 0x55,
+	0x57, 0x56, 0x57, 0x58, 0x57, 0x59, 0x57, 0x62, 0x57, 0x63, 0x57, 0x65,
+	0x57, 0x67, 0x57, 0x6c, 0x57, 0x6e, 0x57, 0x70, 0x57, 0x71, 0x57, 0x72,
+	0x57, 0x74, 0x57, 0x75, 0x57, 0x78, 0x57, 0x79, 0x57, 0x7a, 0x57, 0x7d,
+	0x57, 0x7e, 0x57, 0x7f, 0x57, 0x80, 0x57, 0x81, 0x57, 0x87, 0x57, 0x88,
+	0x57, 0x89, 0x57, 0x8a, 0x57, 0x8d, 0x57, 0x8e, 0x57, 0x8f, 0x57, 0x90,
+	0x57, 0x91, 0x57, 0x94, 0x57, 0x95, 0x57, 0x96, 0x57, 0x97, 0x57, 0x98,
+	0x57, 0x99, 0x57, 0x9a, 0x57, 0x9c, 0x57, 0x9d, 0x57, 0x9e, 0x57, 0x9f,
+	0x57, 0xa5, 0x57, 0xa8, 0x57, 0xaa, 0x57, 0xac, 0x57, 0xaf, 0x57, 0xb0,
+	0x57, 0xb1, 0x57, 0xb3, 0x57, 0xb5, 0x57, 0xb6, 0x57, 0xb7, 0x57, 0xb9,
+	0x57, 0xba, 0x57, 0xbb, 0x57, 0xbc, 0x57, 0xbd, 0x57, 0xbe, 0x57, 0xbf,
+	0x57, 0xc0, 0x57, 0xc1, 0x57, 0xc4, 0x57, 0xc5, 0x57, 0xc6, 0x57, 0xc7,
+	0x57, 0xc8, 0x57, 0xc9, 0x57, 0xca, 0x57, 0xcc, 0x57, 0xcd, 0x57, 0xd0,
+	0x57, 0xd1, 0x57, 0xd3, 0x57, 0xd6, 0x57, 0xd7, 0x57, 0xdb, 0x57, 0xdc,
+	0x57, 0xde, 0x57, 0xe1, 0x57, 0xe2, 0x57, 0xe3, 0x57, 0xe5, 0x57, 0xe6,
+	0x57, 0xe7, 0x57, 0xe8, 0x57, 0xe9, 0x57, 0xea, 0x57, 0xeb, 0x57, 0xec,
+	0x57, 0xee, 0x57, 0xf0, 0x57, 0xf1, 0x57, 0xf2, 0x57, 0xf3, 0x57, 0xf5,
+	0x57, 0xf6, 0x57, 0xf7, 0x57, 0xfb, 0x57, 0xfc, 0x57, 0xfe, 0x57, 0xff,
+	0x58, 0x01, 0x58, 0x03, 0x58, 0x04, 0x58, 0x05, 0x58, 0x08, 0x58, 0x09,
+	0x58, 0x0a, 0x58, 0x0c, 0x58, 0x0e, 0x58, 0x0f, 0x58, 0x10, 0x58, 0x12,
+	0x58, 0x13, 0x58, 0x14, 0x58, 0x16, 0x58, 0x17, 0x58, 0x18, 0x58, 0x1a,
+	0x58, 0x1b, 0x58, 0x1c, 0x58, 0x1d, 0x58, 0x1f, 0x58, 0x22, 0x58, 0x23,
+	0x58, 0x25, 0x58, 0x26, 0x58, 0x27, 0x58, 0x28, 0x58, 0x29, 0x58, 0x2b,
+	0x58, 0x2c, 0x58, 0x2d, 0x58, 0x2e, 0x58, 0x2f, 0x58, 0x31, 0x58, 0x32,
+	0x58, 0x33, 0x58, 0x34, 0x58, 0x36, 0x58, 0x37, 0x58, 0x38, 0x58, 0x39,
+	0x58, 0x3a, 0x58, 0x3b, 0x58, 0x3c, 0x58, 0x3d, 0x58, 0x3e, 0x58, 0x3f,
+	0x58, 0x40, 0x58, 0x41, 0x58, 0x42, 0x58, 0x43, 0x58, 0x45, 0x58, 0x46,
+	0x58, 0x47, 0x58, 0x48, 0x58, 0x49, 0x58, 0x4a, 0x58, 0x4b, 0x58, 0x4e,
+	0x58, 0x4f, 0x58, 0x50, 0x58, 0x52, 0x58, 0x53, 0x58, 0x55, 0x58, 0x56,
+	0x58, 0x57, 0x58, 0x59, 0x58, 0x5a, 0x58, 0x5b, 0x58, 0x5c, 0x58, 0x5d,
+	0x58, 0x5f, 0x58, 0x60, 0x58, 0x61, 0x58, 0x62, 0x58, 0x63, 0x58, 0x64,
+	0x58, 0x66, 0x58, 0x67, 0x58, 0x68, 0x58, 0x69, 0x58, 0x6a, 0x58, 0x6d,
+	0x58, 0x6e, 0x58, 0x6f, 0x58, 0x70, 0x58, 0x71, 0x58, 0x72, 0x58, 0x73,
+	0x58, 0x74, 0x58, 0x75, 0x58, 0x76, 0x58, 0x77, 0x58, 0x78, 0x58, 0x79,
+	0x58, 0x7a, 0x58, 0x7b, 0x58, 0x7c, 0x58, 0x7d, 0x58, 0x7f, 0x58, 0x82,
+	0x58, 0x84, 0x58, 0x86, 0x58, 0x87, 0x58, 0x88, 0x58, 0x8a, 0x58, 0x8b,
+	0x58, 0x8c, 0x58, 0x8d, 0x58, 0x8e, 0x58, 0x8f, 0x58, 0x90, 0x58, 0x91,
+	0x58, 0x94, 0x58, 0x95, 0x58, 0x96, 0x58, 0x97, 0x58, 0x98, 0x58, 0x9b,
+	0x58, 0x9c, 0x58, 0x9d, 0x58, 0xa0, 0x58, 0xa1, 0x58, 0xa2, 0x58, 0xa3,
+	0x58, 0xa4, 0x58, 0xa5, 0x58, 0xa6, 0x58, 0xa7, 0x58, 0xaa, 0x58, 0xab,
+	0x58, 0xac, 0x58, 0xad, 0x58, 0xae, 0x58, 0xaf, 0x58, 0xb0, 0x58, 0xb1,
+	0x58, 0xb2, 0x58, 0xb3, 0x58, 0xb4, 0x58, 0xb5, 0x58, 0xb6, 0x58, 0xb7,
+	0x58, 0xb8, 0x58, 0xb9, 0x58, 0xba, 0x58, 0xbb, 0x58, 0xbd, 0x58, 0xbe,
+	0x58, 0xbf, 0x58, 0xc0, 0x58, 0xc2, 0x58, 0xc3, 0x58, 0xc4, 0x58, 0xc6,
+	0x58, 0xc7, 0x58, 0xc8, 0x58, 0xc9, 0x58, 0xca, 0x58, 0xcb, 0x58, 0xcc,
+	0x58, 0xcd, 0x58, 0xce, 0x58, 0xcf, 0x58, 0xd0, 0x58, 0xd2, 0x58, 0xd3,
+	0x58, 0xd4, 0x58, 0xd6, 0x58, 0xd7, 0x58, 0xd8, 0x58, 0xd9, 0x58, 0xda,
+	0x58, 0xdb, 0x58, 0xdc, 0x58, 0xdd, 0x58, 0xde, 0x58, 0xdf, 0x58, 0xe0,
+	0x58, 0xe1, 0x58, 0xe2, 0x58, 0xe3, 0x58, 0xe5, 0x58, 0xe6, 0x58, 0xe7,
+	0x58, 0xe8, 0x58, 0xe9, 0x58, 0xea, 0x58, 0xed, 0x58, 0xef, 0x58, 0xf1,
+	0x58, 0xf2, 0x58, 0xf4, 0x58, 0xf5, 0x58, 0xf7, 0x58, 0xf8, 0x58, 0xfa,
+	0x58, 0xfb, 0x58, 0xfc, 0x58, 0xfd, 0x58, 0xfe, 0x58, 0xff, 0x59, 0x00,
+	0x59, 0x01, 0x59, 0x03, 0x59, 0x05, 0x59, 0x06, 0x59, 0x08, 0x59, 0x09,
+	0x59, 0x0a, 0x59, 0x0b, 0x59, 0x0c, 0x59, 0x0e, 0x59, 0x10, 0x59, 0x11,
+	0x59, 0x12, 0x59, 0x13, 0x59, 0x17, 0x59, 0x18, 0x59, 0x1b, 0x59, 0x1d,
+	0x59, 0x1e, 0x59, 0x20, 0x59, 0x21, 0x59, 0x22, 0x59, 0x23, 0x59, 0x26,
+	0x59, 0x28, 0x59, 0x2c, 0x59, 0x30, 0x59, 0x32, 0x59, 0x33, 0x59, 0x35,
+	0x59, 0x36, 0x59, 0x3b, 0x59, 0x3d, 0x59, 0x3e, 0x59, 0x3f, 0x59, 0x40,
+	0x59, 0x43, 0x59, 0x45, 0x59, 0x46, 0x59, 0x4a, 0x59, 0x4c, 0x59, 0x4d,
+	0x59, 0x50, 0x59, 0x52, 0x59, 0x53, 0x59, 0x59, 0x59, 0x5b, 0x59, 0x5c,
+	0x59, 0x5d, 0x59, 0x5e, 0x59, 0x5f, 0x59, 0x61, 0x59, 0x63, 0x59, 0x64,
+	0x59, 0x66, 0x59, 0x67, 0x59, 0x68, 0x59, 0x69, 0x59, 0x6a, 0x59, 0x6b,
+	0x59, 0x6c, 0x59, 0x6d, 0x59, 0x6e, 0x59, 0x6f, 0x59, 0x70, 0x59, 0x71,
+	0x59, 0x72, 0x59, 0x75, 0x59, 0x77, 0x59, 0x7a, 0x59, 0x7b, 0x59, 0x7c,
+	0x59, 0x7e, 0x59, 0x7f, 0x59, 0x80, 0x59, 0x85, 0x59, 0x89, 0x59, 0x8b,
+	0x59, 0x8c, 0x59, 0x8e, 0x59, 0x8f, 0x59, 0x90, 0x59, 0x91, 0x59, 0x94,
+	0x59, 0x95, 0x59, 0x98, 0x59, 0x9a, 0x59, 0x9b, 0x59, 0x9c, 0x59, 0x9d,
+	0x59, 0x9f, 0x59, 0xa0, 0x59, 0xa1, 0x59, 0xa2, 0x59, 0xa6, 0x59, 0xa7,
+	0x59, 0xac, 0x59, 0xad, 0x59, 0xb0, 0x59, 0xb1, 0x59, 0xb3, 0x59, 0xb4,
+	0x59, 0xb5, 0x59, 0xb6, 0x59, 0xb7, 0x59, 0xb8, 0x59, 0xba, 0x59, 0xbc,
+	0x59, 0xbd, 0x59, 0xbf, 0x59, 0xc0, 0x59, 0xc1, 0x59, 0xc2, 0x59, 0xc3,
+	0x59, 0xc4, 0x59, 0xc5, 0x59, 0xc7, 0x59, 0xc8, 0x59, 0xc9, 0x59, 0xcc,
+	0x59, 0xcd, 0x59, 0xce, 0x59, 0xcf, 0x59, 0xd5, 0x59, 0xd6, 0x59, 0xd9,
+	0x59, 0xdb, 0x59, 0xde, 0x59, 0xdf, 0x59, 0xe0, 0x59, 0xe1, 0x59, 0xe2,
+	0x59, 0xe4, 0x59, 0xe6, 0x59, 0xe7, 0x59, 0xe9, 0x59, 0xea, 0x59, 0xeb,
+	0x59, 0xed, 0x59, 0xee, 0x59, 0xef, 0x59, 0xf0, 0x59, 0xf1, 0x59, 0xf2,
+	0x59, 0xf3, 0x59, 0xf4, 0x59, 0xf5, 0x59, 0xf6, 0x59, 0xf7, 0x59, 0xf8,
+	0x59, 0xfa, 0x59, 0xfc, 0x59, 0xfd, 0x59, 0xfe, 0x5a, 0x00, 0x5a, 0x02,
+	0x5a, 0x0a, 0x5a, 0x0b, 0x5a, 0x0d, 0x5a, 0x0e, 0x5a, 0x0f, 0x5a, 0x10,
+	0x5a, 0x12, 0x5a, 0x14, 0x5a, 0x15, 0x5a, 0x16, 0x5a, 0x17, 0x5a, 0x19,
+	0x5a, 0x1a, 0x5a, 0x1b, 0x5a, 0x1d, 0x5a, 0x1e, 0x5a, 0x21, 0x5a, 0x22,
+	0x5a, 0x24, 0x5a, 0x26, 0x5a, 0x27, 0x5a, 0x28, 0x5a, 0x2a, 0x5a, 0x2b,
+	0x5a, 0x2c, 0x5a, 0x2d, 0x5a, 0x2e, 0x5a, 0x2f, 0x5a, 0x30, 0x5a, 0x33,
+	0x5a, 0x35, 0x5a, 0x37, 0x5a, 0x38, 0x5a, 0x39, 0x5a, 0x3a, 0x5a, 0x3b,
+	0x5a, 0x3d, 0x5a, 0x3e, 0x5a, 0x3f, 0x5a, 0x41, 0x5a, 0x42, 0x5a, 0x43,
+	0x5a, 0x44, 0x5a, 0x45, 0x5a, 0x47, 0x5a, 0x48, 0x5a, 0x4b, 0x5a, 0x4c,
+	0x5a, 0x4d, 0x5a, 0x4e, 0x5a, 0x4f, 0x5a, 0x50, 0x5a, 0x51, 0x5a, 0x52,
+	0x5a, 0x53, 0x5a, 0x54, 0x5a, 0x56, 0x5a, 0x57, 0x5a, 0x58, 0x5a, 0x59,
+	0x5a, 0x5b, 0x5a, 0x5c, 0x5a, 0x5d, 0x5a, 0x5e, 0x5a, 0x5f, 0x5a, 0x60,
+	0x5a, 0x61, 0x5a, 0x63, 0x5a, 0x64, 0x5a, 0x65, 0x5a, 0x66, 0x5a, 0x68,
+	0x5a, 0x69, 0x5a, 0x6b, 0x5a, 0x6c, 0x5a, 0x6d, 0x5a, 0x6e, 0x5a, 0x6f,
+	0x5a, 0x70, 0x5a, 0x71, 0x5a, 0x72, 0x5a, 0x73, 0x5a, 0x78, 0x5a, 0x79,
+	0x5a, 0x7b, 0x5a, 0x7c, 0x5a, 0x7d, 0x5a, 0x7e, 0x5a, 0x80, 0x5a, 0x81,
+	0x5a, 0x82, 0x5a, 0x83, 0x5a, 0x84, 0x5a, 0x85, 0x5a, 0x86, 0x5a, 0x87,
+	0x5a, 0x88, 0x5a, 0x89, 0x5a, 0x8a, 0x5a, 0x8b, 0x5a, 0x8c, 0x5a, 0x8d,
+	0x5a, 0x8e, 0x5a, 0x8f, 0x5a, 0x90, 0x5a, 0x91, 0x5a, 0x93, 0x5a, 0x94,
+	0x5a, 0x95, 0x5a, 0x96, 0x5a, 0x97, 0x5a, 0x98, 0x5a, 0x99, 0x5a, 0x9c,
+	0x5a, 0x9d, 0x5a, 0x9e, 0x5a, 0x9f, 0x5a, 0xa0, 0x5a, 0xa1, 0x5a, 0xa2,
+	0x5a, 0xa3, 0x5a, 0xa4, 0x5a, 0xa5, 0x5a, 0xa6, 0x5a, 0xa7, 0x5a, 0xa8,
+	0x5a, 0xa9, 0x5a, 0xab, 0x5a, 0xac, 0x5a, 0xad, 0x5a, 0xae, 0x5a, 0xaf,
+	0x5a, 0xb0, 0x5a, 0xb1, 0x5a, 0xb4, 0x5a, 0xb6, 0x5a, 0xb7, 0x5a, 0xb9,
+	0x5a, 0xba, 0x5a, 0xbb, 0x5a, 0xbc, 0x5a, 0xbd, 0x5a, 0xbf, 0x5a, 0xc0,
+	0x5a, 0xc3, 0x5a, 0xc4, 0x5a, 0xc5, 0x5a, 0xc6, 0x5a, 0xc7, 0x5a, 0xc8,
+	0x5a, 0xca, 0x5a, 0xcb, 0x5a, 0xcd, 0x5a, 0xce, 0x5a, 0xcf, 0x5a, 0xd0,
+	0x5a, 0xd1, 0x5a, 0xd3, 0x5a, 0xd5, 0x5a, 0xd7, 0x5a, 0xd9, 0x5a, 0xda,
+	0x5a, 0xdb, 0x5a, 0xdd, 0x5a, 0xde, 0x5a, 0xdf, 0x5a, 0xe2, 0x5a, 0xe4,
+	0x5a, 0xe5, 0x5a, 0xe7, 0x5a, 0xe8, 0x5a, 0xea, 0x5a, 0xec, 0x5a, 0xed,
+	0x5a, 0xee, 0x5a, 0xef, 0x5a, 0xf0, 0x5a, 0xf2, 0x5a, 0xf3, 0x5a, 0xf4,
+	0x5a, 0xf5, 0x5a, 0xf6, 0x5a, 0xf7, 0x5a, 0xf8, 0x5a, 0xf9, 0x5a, 0xfa,
+	0x5a, 0xfb, 0x5a, 0xfc, 0x5a, 0xfd, 0x5a, 0xfe, 0x5a, 0xff, 0x5b, 0x00,
+	0x5b, 0x01, 0x5b, 0x02, 0x5b, 0x03, 0x5b, 0x04, 0x5b, 0x05, 0x5b, 0x06,
+	0x5b, 0x07, 0x5b, 0x08, 0x5b, 0x0a, 0x5b, 0x0b, 0x5b, 0x0c, 0x5b, 0x0d,
+	0x5b, 0x0e, 0x5b, 0x0f, 0x5b, 0x10, 0x5b, 0x11, 0x5b, 0x12, 0x5b, 0x13,
+	0x5b, 0x14, 0x5b, 0x15, 0x5b, 0x18, 0x5b, 0x19, 0x5b, 0x1a, 0x5b, 0x1b,
+	0x5b, 0x1c, 0x5b, 0x1d, 0x5b, 0x1e, 0x5b, 0x1f, 0x5b, 0x20, 0x5b, 0x21,
+	0x5b, 0x22, 0x5b, 0x23, 0x5b, 0x24, 0x5b, 0x25, 0x5b, 0x26, 0x5b, 0x27,
+	0x5b, 0x28, 0x5b, 0x29, 0x5b, 0x2a, 0x5b, 0x2b, 0x5b, 0x2c, 0x5b, 0x2d,
+	0x5b, 0x2e, 0x5b, 0x2f, 0x5b, 0x30, 0x5b, 0x31, 0x5b, 0x33, 0x5b, 0x35,
+	0x5b, 0x36, 0x5b, 0x38, 0x5b, 0x39, 0x5b, 0x3a, 0x5b, 0x3b, 0x5b, 0x3c,
+	0x5b, 0x3d, 0x5b, 0x3e, 0x5b, 0x3f, 0x5b, 0x41, 0x5b, 0x42, 0x5b, 0x43,
+	0x5b, 0x44, 0x5b, 0x45, 0x5b, 0x46, 0x5b, 0x47, 0x5b, 0x48, 0x5b, 0x49,
+	0x5b, 0x4a, 0x5b, 0x4b, 0x5b, 0x4c, 0x5b, 0x4d, 0x5b, 0x4e, 0x5b, 0x4f,
+	0x5b, 0x52, 0x5b, 0x56, 0x5b, 0x5e, 0x5b, 0x60, 0x5b, 0x61, 0x5b, 0x67,
+	0x5b, 0x68, 0x5b, 0x6b, 0x5b, 0x6d, 0x5b, 0x6e, 0x5b, 0x6f, 0x5b, 0x72,
+	0x5b, 0x74, 0x5b, 0x76, 0x5b, 0x77, 0x5b, 0x78, 0x5b, 0x79, 0x5b, 0x7b,
+	0x5b, 0x7c, 0x5b, 0x7e, 0x5b, 0x7f, 0x5b, 0x82, 0x5b, 0x86, 0x5b, 0x8a,
+	0x5b, 0x8d, 0x5b, 0x8e, 0x5b, 0x90, 0x5b, 0x91, 0x5b, 0x92, 0x5b, 0x94,
+	0x5b, 0x96, 0x5b, 0x9f, 0x5b, 0xa7, 0x5b, 0xa8, 0x5b, 0xa9, 0x5b, 0xac,
+	0x5b, 0xad, 0x5b, 0xae, 0x5b, 0xaf, 0x5b, 0xb1, 0x5b, 0xb2, 0x5b, 0xb7,
+	0x5b, 0xba, 0x5b, 0xbb, 0x5b, 0xbc, 0x5b, 0xc0, 0x5b, 0xc1, 0x5b, 0xc3,
+	0x5b, 0xc8, 0x5b, 0xc9, 0x5b, 0xca, 0x5b, 0xcb, 0x5b, 0xcd, 0x5b, 0xce,
+	0x5b, 0xcf, 0x5b, 0xd1, 0x5b, 0xd4, 0x5b, 0xd5, 0x5b, 0xd6, 0x5b, 0xd7,
+	0x5b, 0xd8, 0x5b, 0xd9, 0x5b, 0xda, 0x5b, 0xdb, 0x5b, 0xdc, 0x5b, 0xe0,
+	0x5b, 0xe2, 0x5b, 0xe3, 0x5b, 0xe6, 0x5b, 0xe7, 0x5b, 0xe9, 0x5b, 0xea,
+	0x5b, 0xeb, 0x5b, 0xec, 0x5b, 0xed, 0x5b, 0xef, 0x5b, 0xf1, 0x5b, 0xf2,
+	0x5b, 0xf3, 0x5b, 0xf4, 0x5b, 0xf5, 0x5b, 0xf6, 0x5b, 0xf7, 0x5b, 0xfd,
+	0x5b, 0xfe, 0x5c, 0x00, 0x5c, 0x02, 0x5c, 0x03, 0x5c, 0x05, 0x5c, 0x07,
+	0x5c, 0x08, 0x5c, 0x0b, 0x5c, 0x0c, 0x5c, 0x0d, 0x5c, 0x0e, 0x5c, 0x10,
+	0x5c, 0x12, 0x5c, 0x13, 0x5c, 0x17, 0x5c, 0x19, 0x5c, 0x1b, 0x5c, 0x1e,
+	0x5c, 0x1f, 0x5c, 0x20, 0x5c, 0x21, 0x5c, 0x23, 0x5c, 0x26, 0x5c, 0x28,
+	0x5c, 0x29, 0x5c, 0x2a, 0x5c, 0x2b, 0x5c, 0x2d, 0x5c, 0x2e, 0x5c, 0x2f,
+	0x5c, 0x30, 0x5c, 0x32, 0x5c, 0x33, 0x5c, 0x35, 0x5c, 0x36, 0x5c, 0x37,
+	0x5c, 0x43, 0x5c, 0x44, 0x5c, 0x46, 0x5c, 0x47, 0x5c, 0x4c, 0x5c, 0x4d,
+	0x5c, 0x52, 0x5c, 0x53, 0x5c, 0x54, 0x5c, 0x56, 0x5c, 0x57, 0x5c, 0x58,
+	0x5c, 0x5a, 0x5c, 0x5b, 0x5c, 0x5c, 0x5c, 0x5d, 0x5c, 0x5f, 0x5c, 0x62,
+	0x5c, 0x64, 0x5c, 0x67, 0x5c, 0x68, 0x5c, 0x69, 0x5c, 0x6a, 0x5c, 0x6b,
+	0x5c, 0x6c, 0x5c, 0x6d, 0x5c, 0x70, 0x5c, 0x72, 0x5c, 0x73, 0x5c, 0x74,
+	0x5c, 0x75, 0x5c, 0x76, 0x5c, 0x77, 0x5c, 0x78, 0x5c, 0x7b, 0x5c, 0x7c,
+	0x5c, 0x7d, 0x5c, 0x7e, 0x5c, 0x80, 0x5c, 0x83, 0x5c, 0x84, 0x5c, 0x85,
+	0x5c, 0x86, 0x5c, 0x87, 0x5c, 0x89, 0x5c, 0x8a, 0x5c, 0x8b, 0x5c, 0x8e,
+	0x5c, 0x8f, 0x5c, 0x92, 0x5c, 0x93, 0x5c, 0x95, 0x5c, 0x9d, 0x5c, 0x9e,
+	0x5c, 0x9f, 0x5c, 0xa0, 0x5c, 0xa1, 0x5c, 0xa4, 0x5c, 0xa5, 0x5c, 0xa6,
+	0x5c, 0xa7, 0x5c, 0xa8, 0x5c, 0xaa, 0x5c, 0xae, 0x5c, 0xaf, 0x5c, 0xb0,
+	0x5c, 0xb2, 0x5c, 0xb4, 0x5c, 0xb6, 0x5c, 0xb9, 0x5c, 0xba, 0x5c, 0xbb,
+	0x5c, 0xbc, 0x5c, 0xbe, 0x5c, 0xc0, 0x5c, 0xc2, 0x5c, 0xc3, 0x5c, 0xc5,
+	0x5c, 0xc6, 0x5c, 0xc7, 0x5c, 0xc8, 0x5c, 0xc9, 0x5c, 0xca, 0x5c, 0xcc,
+	0x5c, 0xcd, 0x5c, 0xce, 0x5c, 0xcf, 0x5c, 0xd0, 0x5c, 0xd1, 0x5c, 0xd3,
+	0x5c, 0xd4, 0x5c, 0xd5, 0x5c, 0xd6, 0x5c, 0xd7, 0x5c, 0xd8, 0x5c, 0xda,
+	0x5c, 0xdb, 0x5c, 0xdc, 0x5c, 0xdd, 0x5c, 0xde, 0x5c, 0xdf, 0x5c, 0xe0,
+	0x5c, 0xe2, 0x5c, 0xe3, 0x5c, 0xe7, 0x5c, 0xe9, 0x5c, 0xeb, 0x5c, 0xec,
+	0x5c, 0xee, 0x5c, 0xef, 0x5c, 0xf1, 0x5c, 0xf2, 0x5c, 0xf3, 0x5c, 0xf4,
+	0x5c, 0xf5, 0x5c, 0xf6, 0x5c, 0xf7, 0x5c, 0xf8, 0x5c, 0xf9, 0x5c, 0xfa,
+	0x5c, 0xfc, 0x5c, 0xfd, 0x5c, 0xfe, 0x5c, 0xff, 0x5d, 0x00, 0x5d, 0x01,
+	0x5d, 0x04, 0x5d, 0x05, 0x5d, 0x08, 0x5d, 0x09, 0x5d, 0x0a, 0x5d, 0x0b,
+	0x5d, 0x0c, 0x5d, 0x0d, 0x5d, 0x0f, 0x5d, 0x10, 0x5d, 0x11, 0x5d, 0x12,
+	0x5d, 0x13, 0x5d, 0x15, 0x5d, 0x17, 0x5d, 0x18, 0x5d, 0x19, 0x5d, 0x1a,
+	0x5d, 0x1c, 0x5d, 0x1d, 0x5d, 0x1f, 0x5d, 0x20, 0x5d, 0x21, 0x5d, 0x22,
+	0x5d, 0x23, 0x5d, 0x25, 0x5d, 0x28, 0x5d, 0x2a, 0x5d, 0x2b, 0x5d, 0x2c,
+	0x5d, 0x2f, 0x5d, 0x30, 0x5d, 0x31, 0x5d, 0x32, 0x5d, 0x33, 0x5d, 0x35,
+	0x5d, 0x36, 0x5d, 0x37, 0x5d, 0x38, 0x5d, 0x39, 0x5d, 0x3a, 0x5d, 0x3b,
+	0x5d, 0x3c, 0x5d, 0x3f, 0x5d, 0x40, 0x5d, 0x41, 0x5d, 0x42, 0x5d, 0x43,
+	0x5d, 0x44, 0x5d, 0x45, 0x5d, 0x46, 0x5d, 0x48, 0x5d, 0x49, 0x5d, 0x4d,
+	0x5d, 0x4e, 0x5d, 0x4f, 0x5d, 0x50, 0x5d, 0x51, 0x5d, 0x52, 0x5d, 0x53,
+	0x5d, 0x54, 0x5d, 0x55, 0x5d, 0x56, 0x5d, 0x57, 0x5d, 0x59, 0x5d, 0x5a,
+	0x5d, 0x5c, 0x5d, 0x5e, 0x5d, 0x5f, 0x5d, 0x60, 0x5d, 0x61, 0x5d, 0x62,
+	0x5d, 0x63, 0x5d, 0x64, 0x5d, 0x65, 0x5d, 0x66, 0x5d, 0x67, 0x5d, 0x68,
+	0x5d, 0x6a, 0x5d, 0x6d, 0x5d, 0x6e, 0x5d, 0x70, 0x5d, 0x71, 0x5d, 0x72,
+	0x5d, 0x73, 0x5d, 0x75, 0x5d, 0x76, 0x5d, 0x77, 0x5d, 0x78, 0x5d, 0x79,
+	0x5d, 0x7a, 0x5d, 0x7b, 0x5d, 0x7c, 0x5d, 0x7d, 0x5d, 0x7e, 0x5d, 0x7f,
+	0x5d, 0x80, 0x5d, 0x81, 0x5d, 0x83, 0x5d, 0x84, 0x5d, 0x85, 0x5d, 0x86,
+	0x5d, 0x87, 0x5d, 0x88, 0x5d, 0x89, 0x5d, 0x8a, 0x5d, 0x8b, 0x5d, 0x8c,
+	0x5d, 0x8d, 0x5d, 0x8e, 0x5d, 0x8f, 0x5d, 0x90, 0x5d, 0x91, 0x5d, 0x92,
+	0x5d, 0x93, 0x5d, 0x94, 0x5d, 0x95, 0x5d, 0x96, 0x5d, 0x97, 0x5d, 0x98,
+	0x5d, 0x9a, 0x5d, 0x9b, 0x5d, 0x9c, 0x5d, 0x9e, 0x5d, 0x9f, 0x5d, 0xa0,
+	0x5d, 0xa1, 0x5d, 0xa2, 0x5d, 0xa3, 0x5d, 0xa4, 0x5d, 0xa5, 0x5d, 0xa6,
+	0x5d, 0xa7, 0x5d, 0xa8, 0x5d, 0xa9, 0x5d, 0xaa, 0x5d, 0xab, 0x5d, 0xac,
+	0x5d, 0xad, 0x5d, 0xae, 0x5d, 0xaf, 0x5d, 0xb0, 0x5d, 0xb1, 0x5d, 0xb2,
+	0x5d, 0xb3, 0x5d, 0xb4, 0x5d, 0xb5, 0x5d, 0xb6, 0x5d, 0xb8, 0x5d, 0xb9,
+	0x5d, 0xba, 0x5d, 0xbb, 0x5d, 0xbc, 0x5d, 0xbd, 0x5d, 0xbe, 0x5d, 0xbf,
+	0x5d, 0xc0, 0x5d, 0xc1, 0x5d, 0xc2, 0x5d, 0xc3, 0x5d, 0xc4, 0x5d, 0xc6,
+	0x5d, 0xc7, 0x5d, 0xc8, 0x5d, 0xc9, 0x5d, 0xca, 0x5d, 0xcb, 0x5d, 0xcc,
+	0x5d, 0xce, 0x5d, 0xcf, 0x5d, 0xd0, 0x5d, 0xd1, 0x5d, 0xd2, 0x5d, 0xd3,
+	0x5d, 0xd4, 0x5d, 0xd5, 0x5d, 0xd6, 0x5d, 0xd7, 0x5d, 0xd8, 0x5d, 0xd9,
+	0x5d, 0xda, 0x5d, 0xdc, 0x5d, 0xdf, 0x5d, 0xe0, 0x5d, 0xe3, 0x5d, 0xe4,
+	0x5d, 0xea, 0x5d, 0xec, 0x5d, 0xed, 0x5d, 0xf0, 0x5d, 0xf5, 0x5d, 0xf6,
+	0x5d, 0xf8, 0x5d, 0xf9, 0x5d, 0xfa, 0x5d, 0xfb, 0x5d, 0xfc, 0x5d, 0xff,
+	0x5e, 0x00, 0x5e, 0x04, 0x5e, 0x07, 0x5e, 0x09, 0x5e, 0x0a, 0x5e, 0x0b,
+	0x5e, 0x0d, 0x5e, 0x0e, 0x5e, 0x12, 0x5e, 0x13, 0x5e, 0x17, 0x5e, 0x1e,
+	0x5e, 0x1f, 0x5e, 0x20, 0x5e, 0x21, 0x5e, 0x22, 0x5e, 0x23, 0x5e, 0x24,
+	0x5e, 0x25, 0x5e, 0x28, 0x5e, 0x29, 0x5e, 0x2a, 0x5e, 0x2b, 0x5e, 0x2c,
+	0x5e, 0x2f, 0x5e, 0x30, 0x5e, 0x32, 0x5e, 0x33, 0x5e, 0x34, 0x5e, 0x35,
+	0x5e, 0x36, 0x5e, 0x39, 0x5e, 0x3a, 0x5e, 0x3e, 0x5e, 0x3f, 0x5e, 0x40,
+	0x5e, 0x41, 0x5e, 0x43, 0x5e, 0x46, 0x5e, 0x47, 0x5e, 0x48, 0x5e, 0x49,
+	0x5e, 0x4a, 0x5e, 0x4b, 0x5e, 0x4d, 0x5e, 0x4e, 0x5e, 0x4f, 0x5e, 0x50,
+	0x5e, 0x51, 0x5e, 0x52, 0x5e, 0x53, 0x5e, 0x56, 0x5e, 0x57, 0x5e, 0x58,
+	0x5e, 0x59, 0x5e, 0x5a, 0x5e, 0x5c, 0x5e, 0x5d, 0x5e, 0x5f, 0x5e, 0x60,
+	0x5e, 0x63, 0x5e, 0x64, 0x5e, 0x65, 0x5e, 0x66, 0x5e, 0x67, 0x5e, 0x68,
+	0x5e, 0x69, 0x5e, 0x6a, 0x5e, 0x6b, 0x5e, 0x6c, 0x5e, 0x6d, 0x5e, 0x6e,
+	0x5e, 0x6f, 0x5e, 0x70, 0x5e, 0x71, 0x5e, 0x75, 0x5e, 0x77, 0x5e, 0x79,
+	0x5e, 0x7e, 0x5e, 0x81, 0x5e, 0x82, 0x5e, 0x83, 0x5e, 0x85, 0x5e, 0x88,
+	0x5e, 0x89, 0x5e, 0x8c, 0x5e, 0x8d, 0x5e, 0x8e, 0x5e, 0x92, 0x5e, 0x98,
+	0x5e, 0x9b, 0x5e, 0x9d, 0x5e, 0xa1, 0x5e, 0xa2, 0x5e, 0xa3, 0x5e, 0xa4,
+	0x5e, 0xa8, 0x5e, 0xa9, 0x5e, 0xaa, 0x5e, 0xab, 0x5e, 0xac, 0x5e, 0xae,
+	0x5e, 0xaf, 0x5e, 0xb0, 0x5e, 0xb1, 0x5e, 0xb2, 0x5e, 0xb4, 0x5e, 0xba,
+	0x5e, 0xbb, 0x5e, 0xbc, 0x5e, 0xbd, 0x5e, 0xbf, 0x5e, 0xc0, 0x5e, 0xc1,
+	0x5e, 0xc2, 0x5e, 0xc3, 0x5e, 0xc4, 0x5e, 0xc5, 0x5e, 0xc6, 0x5e, 0xc7,
+	0x5e, 0xc8, 0x5e, 0xcb, 0x5e, 0xcc, 0x5e, 0xcd, 0x5e, 0xce, 0x5e, 0xcf,
+	0x5e, 0xd0, 0x5e, 0xd4, 0x5e, 0xd5, 0x5e, 0xd7, 0x5e, 0xd8, 0x5e, 0xd9,
+	0x5e, 0xda, 0x5e, 0xdc, 0x5e, 0xdd, 0x5e, 0xde, 0x5e, 0xdf, 0x5e, 0xe0,
+	0x5e, 0xe1, 0x5e, 0xe2, 0x5e, 0xe3, 0x5e, 0xe4, 0x5e, 0xe5, 0x5e, 0xe6,
+	0x5e, 0xe7, 0x5e, 0xe9, 0x5e, 0xeb, 0x5e, 0xec, 0x5e, 0xed, 0x5e, 0xee,
+	0x5e, 0xef, 0x5e, 0xf0, 0x5e, 0xf1, 0x5e, 0xf2, 0x5e, 0xf3, 0x5e, 0xf5,
+	0x5e, 0xf8, 0x5e, 0xf9, 0x5e, 0xfb, 0x5e, 0xfc, 0x5e, 0xfd, 0x5f, 0x05,
+	0x5f, 0x06, 0x5f, 0x07, 0x5f, 0x09, 0x5f, 0x0c, 0x5f, 0x0d, 0x5f, 0x0e,
+	0x5f, 0x10, 0x5f, 0x12, 0x5f, 0x14, 0x5f, 0x16, 0x5f, 0x19, 0x5f, 0x1a,
+	0x5f, 0x1c, 0x5f, 0x1d, 0x5f, 0x1e, 0x5f, 0x21, 0x5f, 0x22, 0x5f, 0x23,
+	0x5f, 0x24, 0x5f, 0x28, 0x5f, 0x2b, 0x5f, 0x2c, 0x5f, 0x2e, 0x5f, 0x30,
+	0x5f, 0x32, 0x5f, 0x33, 0x5f, 0x34, 0x5f, 0x35, 0x5f, 0x36, 0x5f, 0x37,
+	0x5f, 0x38, 0x5f, 0x3b, 0x5f, 0x3d, 0x5f, 0x3e, 0x5f, 0x3f, 0x5f, 0x41,
+	0x5f, 0x42, 0x5f, 0x43, 0x5f, 0x44, 0x5f, 0x45, 0x5f, 0x46, 0x5f, 0x47,
+	0x5f, 0x48, 0x5f, 0x49, 0x5f, 0x4a, 0x5f, 0x4b, 0x5f, 0x4c, 0x5f, 0x4d,
+	0x5f, 0x4e, 0x5f, 0x4f, 0x5f, 0x51, 0x5f, 0x54, 0x5f, 0x59, 0x5f, 0x5a,
+	0x5f, 0x5b, 0x5f, 0x5c, 0x5f, 0x5e, 0x5f, 0x5f, 0x5f, 0x60, 0x5f, 0x63,
+	0x5f, 0x65, 0x5f, 0x67, 0x5f, 0x68, 0x5f, 0x6b, 0x5f, 0x6e, 0x5f, 0x6f,
+	0x5f, 0x72, 0x5f, 0x74, 0x5f, 0x75, 0x5f, 0x76, 0x5f, 0x78, 0x5f, 0x7a,
+	0x5f, 0x7d, 0x5f, 0x7e, 0x5f, 0x7f, 0x5f, 0x83, 0x5f, 0x86, 0x5f, 0x8d,
+	0x5f, 0x8e, 0x5f, 0x8f, 0x5f, 0x91, 0x5f, 0x93, 0x5f, 0x94, 0x5f, 0x96,
+	0x5f, 0x9a, 0x5f, 0x9b, 0x5f, 0x9d, 0x5f, 0x9e, 0x5f, 0x9f, 0x5f, 0xa0,
+	0x5f, 0xa2, 0x5f, 0xa3, 0x5f, 0xa4, 0x5f, 0xa5, 0x5f, 0xa6, 0x5f, 0xa7,
+	0x5f, 0xa9, 0x5f, 0xab, 0x5f, 0xac, 0x5f, 0xaf, 0x5f, 0xb0, 0x5f, 0xb1,
+	0x5f, 0xb2, 0x5f, 0xb3, 0x5f, 0xb4, 0x5f, 0xb6, 0x5f, 0xb8, 0x5f, 0xb9,
+	0x5f, 0xba, 0x5f, 0xbb, 0x5f, 0xbe, 0x5f, 0xbf, 0x5f, 0xc0, 0x5f, 0xc1,
+	0x5f, 0xc2, 0x5f, 0xc7, 0x5f, 0xc8, 0x5f, 0xca, 0x5f, 0xcb, 0x5f, 0xce,
+	0x5f, 0xd3, 0x5f, 0xd4, 0x5f, 0xd5, 0x5f, 0xda, 0x5f, 0xdb, 0x5f, 0xdc,
+	0x5f, 0xde, 0x5f, 0xdf, 0x5f, 0xe2, 0x5f, 0xe3, 0x5f, 0xe5, 0x5f, 0xe6,
+	0x5f, 0xe8, 0x5f, 0xe9, 0x5f, 0xec, 0x5f, 0xef, 0x5f, 0xf0, 0x5f, 0xf2,
+	0x5f, 0xf3, 0x5f, 0xf4, 0x5f, 0xf6, 0x5f, 0xf7, 0x5f, 0xf9, 0x5f, 0xfa,
+	0x5f, 0xfc, 0x60, 0x07, 0x60, 0x08, 0x60, 0x09, 0x60, 0x0b, 0x60, 0x0c,
+	0x60, 0x10, 0x60, 0x11, 0x60, 0x13, 0x60, 0x17, 0x60, 0x18, 0x60, 0x1a,
+	0x60, 0x1e, 0x60, 0x1f, 0x60, 0x22, 0x60, 0x23, 0x60, 0x24, 0x60, 0x2c,
+	0x60, 0x2d, 0x60, 0x2e, 0x60, 0x30, 0x60, 0x31, 0x60, 0x32, 0x60, 0x33,
+	0x60, 0x34, 0x60, 0x36, 0x60, 0x37, 0x60, 0x38, 0x60, 0x39, 0x60, 0x3a,
+	0x60, 0x3d, 0x60, 0x3e, 0x60, 0x40, 0x60, 0x44, 0x60, 0x45, 0x60, 0x46,
+	0x60, 0x47, 0x60, 0x48, 0x60, 0x49, 0x60, 0x4a, 0x60, 0x4c, 0x60, 0x4e,
+	0x60, 0x4f, 0x60, 0x51, 0x60, 0x53, 0x60, 0x54, 0x60, 0x56, 0x60, 0x57,
+	0x60, 0x58, 0x60, 0x5b, 0x60, 0x5c, 0x60, 0x5e, 0x60, 0x5f, 0x60, 0x60,
+	0x60, 0x61, 0x60, 0x65, 0x60, 0x66, 0x60, 0x6e, 0x60, 0x71, 0x60, 0x72,
+	0x60, 0x74, 0x60, 0x75, 0x60, 0x77, 0x60, 0x7e, 0x60, 0x80, 0x60, 0x81,
+	0x60, 0x82, 0x60, 0x85, 0x60, 0x86, 0x60, 0x87, 0x60, 0x88, 0x60, 0x8a,
+	0x60, 0x8b, 0x60, 0x8e, 0x60, 0x8f, 0x60, 0x90, 0x60, 0x91, 0x60, 0x93,
+	0x60, 0x95, 0x60, 0x97, 0x60, 0x98, 0x60, 0x99, 0x60, 0x9c, 0x60, 0x9e,
+	0x60, 0xa1, 0x60, 0xa2, 0x60, 0xa4, 0x60, 0xa5, 0x60, 0xa7, 0x60, 0xa9,
+	0x60, 0xaa, 0x60, 0xae, 0x60, 0xb0, 0x60, 0xb3, 0x60, 0xb5, 0x60, 0xb6,
+	0x60, 0xb7, 0x60, 0xb9, 0x60, 0xba, 0x60, 0xbd, 0x60, 0xbe, 0x60, 0xbf,
+	0x60, 0xc0, 0x60, 0xc1, 0x60, 0xc2, 0x60, 0xc3, 0x60, 0xc4, 0x60, 0xc7,
+	0x60, 0xc8, 0x60, 0xc9, 0x60, 0xcc, 0x60, 0xcd, 0x60, 0xce, 0x60, 0xcf,
+	0x60, 0xd0, 0x60, 0xd2, 0x60, 0xd3, 0x60, 0xd4, 0x60, 0xd6, 0x60, 0xd7,
+	0x60, 0xd9, 0x60, 0xdb, 0x60, 0xde, 0x60, 0xe1, 0x60, 0xe2, 0x60, 0xe3,
+	0x60, 0xe4, 0x60, 0xe5, 0x60, 0xea, 0x60, 0xf1, 0x60, 0xf2, 0x60, 0xf5,
+	0x60, 0xf7, 0x60, 0xf8, 0x60, 0xfb, 0x60, 0xfc, 0x60, 0xfd, 0x60, 0xfe,
+	0x60, 0xff, 0x61, 0x02, 0x61, 0x03, 0x61, 0x04, 0x61, 0x05, 0x61, 0x07,
+	0x61, 0x0a, 0x61, 0x0b, 0x61, 0x0c, 0x61, 0x10, 0x61, 0x11, 0x61, 0x12,
+	0x61, 0x13, 0x61, 0x14, 0x61, 0x16, 0x61, 0x17, 0x61, 0x18, 0x61, 0x19,
+	0x61, 0x1b, 0x61, 0x1c, 0x61, 0x1d, 0x61, 0x1e, 0x61, 0x21, 0x61, 0x22,
+	0x61, 0x25, 0x61, 0x28, 0x61, 0x29, 0x61, 0x2a, 0x61, 0x2c, 0x61, 0x2d,
+	0x61, 0x2e, 0x61, 0x2f, 0x61, 0x30, 0x61, 0x31, 0x61, 0x32, 0x61, 0x33,
+	0x61, 0x34, 0x61, 0x35, 0x61, 0x36, 0x61, 0x37, 0x61, 0x38, 0x61, 0x39,
+	0x61, 0x3a, 0x61, 0x3b, 0x61, 0x3c, 0x61, 0x3d, 0x61, 0x3e, 0x61, 0x40,
+	0x61, 0x41, 0x61, 0x42, 0x61, 0x43, 0x61, 0x44, 0x61, 0x45, 0x61, 0x46,
+	0x61, 0x47, 0x61, 0x49, 0x61, 0x4b, 0x61, 0x4d, 0x61, 0x4f, 0x61, 0x50,
+	0x61, 0x52, 0x61, 0x53, 0x61, 0x54, 0x61, 0x56, 0x61, 0x57, 0x61, 0x58,
+	0x61, 0x59, 0x61, 0x5a, 0x61, 0x5b, 0x61, 0x5c, 0x61, 0x5e, 0x61, 0x5f,
+	0x61, 0x60, 0x61, 0x61, 0x61, 0x63, 0x61, 0x64, 0x61, 0x65, 0x61, 0x66,
+	0x61, 0x69, 0x61, 0x6a, 0x61, 0x6b, 0x61, 0x6c, 0x61, 0x6d, 0x61, 0x6e,
+	0x61, 0x6f, 0x61, 0x71, 0x61, 0x72, 0x61, 0x73, 0x61, 0x74, 0x61, 0x76,
+	0x61, 0x78, 0x61, 0x79, 0x61, 0x7a, 0x61, 0x7b, 0x61, 0x7c, 0x61, 0x7d,
+	0x61, 0x7e, 0x61, 0x7f, 0x61, 0x80, 0x61, 0x81, 0x61, 0x82, 0x61, 0x83,
+	0x61, 0x84, 0x61, 0x85, 0x61, 0x86, 0x61, 0x87, 0x61, 0x88, 0x61, 0x89,
+	0x61, 0x8a, 0x61, 0x8c, 0x61, 0x8d, 0x61, 0x8f, 0x61, 0x90, 0x61, 0x91,
+	0x61, 0x92, 0x61, 0x93, 0x61, 0x95, 0x61, 0x96, 0x61, 0x97, 0x61, 0x98,
+	0x61, 0x99, 0x61, 0x9a, 0x61, 0x9b, 0x61, 0x9c, 0x61, 0x9e, 0x61, 0x9f,
+	0x61, 0xa0, 0x61, 0xa1, 0x61, 0xa2, 0x61, 0xa3, 0x61, 0xa4, 0x61, 0xa5,
+	0x61, 0xa6, 0x61, 0xaa, 0x61, 0xab, 0x61, 0xad, 0x61, 0xae, 0x61, 0xaf,
+	0x61, 0xb0, 0x61, 0xb1, 0x61, 0xb2, 0x61, 0xb3, 0x61, 0xb4, 0x61, 0xb5,
+	0x61, 0xb6, 0x61, 0xb8, 0x61, 0xb9, 0x61, 0xba, 0x61, 0xbb, 0x61, 0xbc,
+	0x61, 0xbd, 0x61, 0xbf, 0x61, 0xc0, 0x61, 0xc1, 0x61, 0xc3, 0x61, 0xc4,
+	0x61, 0xc5, 0x61, 0xc6, 0x61, 0xc7, 0x61, 0xc9, 0x61, 0xcc, 0x61, 0xcd,
+	0x61, 0xce, 0x61, 0xcf, 0x61, 0xd0, 0x61, 0xd3, 0x61, 0xd5, 0x61, 0xd6,
+	0x61, 0xd7, 0x61, 0xd8, 0x61, 0xd9, 0x61, 0xda, 0x61, 0xdb, 0x61, 0xdc,
+	0x61, 0xdd, 0x61, 0xde, 0x61, 0xdf, 0x61, 0xe0, 0x61, 0xe1, 0x61, 0xe2,
+	0x61, 0xe3, 0x61, 0xe4, 0x61, 0xe5, 0x61, 0xe7, 0x61, 0xe8, 0x61, 0xe9,
+	0x61, 0xea, 0x61, 0xeb, 0x61, 0xec, 0x61, 0xed, 0x61, 0xee, 0x61, 0xef,
+	0x61, 0xf0, 0x61, 0xf1, 0x61, 0xf2, 0x61, 0xf3, 0x61, 0xf4, 0x61, 0xf6,
+	0x61, 0xf7, 0x61, 0xf8, 0x61, 0xf9, 0x61, 0xfa, 0x61, 0xfb, 0x61, 0xfc,
+	0x61, 0xfd, 0x61, 0xfe, 0x62, 0x00, 0x62, 0x01, 0x62, 0x02, 0x62, 0x03,
+	0x62, 0x04, 0x62, 0x05, 0x62, 0x07, 0x62, 0x09, 0x62, 0x13, 0x62, 0x14,
+	0x62, 0x19, 0x62, 0x1c, 0x62, 0x1d, 0x62, 0x1e, 0x62, 0x20, 0x62, 0x23,
+	0x62, 0x26, 0x62, 0x27, 0x62, 0x28, 0x62, 0x29, 0x62, 0x2b, 0x62, 0x2d,
+	0x62, 0x2f, 0x62, 0x30, 0x62, 0x31, 0x62, 0x32, 0x62, 0x35, 0x62, 0x36,
+	0x62, 0x38, 0x62, 0x39, 0x62, 0x3a, 0x62, 0x3b, 0x62, 0x3c, 0x62, 0x42,
+	0x62, 0x44, 0x62, 0x45, 0x62, 0x46, 0x62, 0x4a, 0x62, 0x4f, 0x62, 0x50,
+	0x62, 0x55, 0x62, 0x56, 0x62, 0x57, 0x62, 0x59, 0x62, 0x5a, 0x62, 0x5c,
+	0x62, 0x5d, 0x62, 0x5e, 0x62, 0x5f, 0x62, 0x60, 0x62, 0x61, 0x62, 0x62,
+	0x62, 0x64, 0x62, 0x65, 0x62, 0x68, 0x62, 0x71, 0x62, 0x72, 0x62, 0x74,
+	0x62, 0x75, 0x62, 0x77, 0x62, 0x78, 0x62, 0x7a, 0x62, 0x7b, 0x62, 0x7d,
+	0x62, 0x81, 0x62, 0x82, 0x62, 0x83, 0x62, 0x85, 0x62, 0x86, 0x62, 0x87,
+	0x62, 0x88, 0x62, 0x8b, 0x62, 0x8c, 0x62, 0x8d, 0x62, 0x8e, 0x62, 0x8f,
+	0x62, 0x90, 0x62, 0x94, 0x62, 0x99, 0x62, 0x9c, 0x62, 0x9d, 0x62, 0x9e,
+	0x62, 0xa3, 0x62, 0xa6, 0x62, 0xa7, 0x62, 0xa9, 0x62, 0xaa, 0x62, 0xad,
+	0x62, 0xae, 0x62, 0xaf, 0x62, 0xb0, 0x62, 0xb2, 0x62, 0xb3, 0x62, 0xb4,
+	0x62, 0xb6, 0x62, 0xb7, 0x62, 0xb8, 0x62, 0xba, 0x62, 0xbe, 0x62, 0xc0,
+	0x62, 0xc1, 0x62, 0xc3, 0x62, 0xcb, 0x62, 0xcf, 0x62, 0xd1, 0x62, 0xd5,
+	0x62, 0xdd, 0x62, 0xde, 0x62, 0xe0, 0x62, 0xe1, 0x62, 0xe4, 0x62, 0xea,
+	0x62, 0xeb, 0x62, 0xf0, 0x62, 0xf2, 0x62, 0xf5, 0x62, 0xf8, 0x62, 0xf9,
+	0x62, 0xfa, 0x62, 0xfb, 0x63, 0x00, 0x63, 0x03, 0x63, 0x04, 0x63, 0x05,
+	0x63, 0x06, 0x63, 0x0a, 0x63, 0x0b, 0x63, 0x0c, 0x63, 0x0d, 0x63, 0x0f,
+	0x63, 0x10, 0x63, 0x12, 0x63, 0x13, 0x63, 0x14, 0x63, 0x15, 0x63, 0x17,
+	0x63, 0x18, 0x63, 0x19, 0x63, 0x1c, 0x63, 0x26, 0x63, 0x27, 0x63, 0x29,
+	0x63, 0x2c, 0x63, 0x2d, 0x63, 0x2e, 0x63, 0x30, 0x63, 0x31, 0x63, 0x33,
+	0x63, 0x34, 0x63, 0x35, 0x63, 0x36, 0x63, 0x37, 0x63, 0x38, 0x63, 0x3b,
+	0x63, 0x3c, 0x63, 0x3e, 0x63, 0x3f, 0x63, 0x40, 0x63, 0x41, 0x63, 0x44,
+	0x63, 0x47, 0x63, 0x48, 0x63, 0x4a, 0x63, 0x51, 0x63, 0x52, 0x63, 0x53,
+	0x63, 0x54, 0x63, 0x56, 0x63, 0x57, 0x63, 0x58, 0x63, 0x59, 0x63, 0x5a,
+	0x63, 0x5b, 0x63, 0x5c, 0x63, 0x5d, 0x63, 0x60, 0x63, 0x64, 0x63, 0x65,
+	0x63, 0x66, 0x63, 0x68, 0x63, 0x6a, 0x63, 0x6b, 0x63, 0x6c, 0x63, 0x6f,
+	0x63, 0x70, 0x63, 0x72, 0x63, 0x73, 0x63, 0x74, 0x63, 0x75, 0x63, 0x78,
+	0x63, 0x79, 0x63, 0x7c, 0x63, 0x7d, 0x63, 0x7e, 0x63, 0x7f, 0x63, 0x81,
+	0x63, 0x83, 0x63, 0x84, 0x63, 0x85, 0x63, 0x86, 0x63, 0x8b, 0x63, 0x8d,
+	0x63, 0x91, 0x63, 0x93, 0x63, 0x94, 0x63, 0x95, 0x63, 0x97, 0x63, 0x99,
+	0x63, 0x9a, 0x63, 0x9b, 0x63, 0x9c, 0x63, 0x9d, 0x63, 0x9e, 0x63, 0x9f,
+	0x63, 0xa1, 0x63, 0xa4, 0x63, 0xa6, 0x63, 0xab, 0x63, 0xaf, 0x63, 0xb1,
+	0x63, 0xb2, 0x63, 0xb5, 0x63, 0xb6, 0x63, 0xb9, 0x63, 0xbb, 0x63, 0xbd,
+	0x63, 0xbf, 0x63, 0xc0, 0x63, 0xc1, 0x63, 0xc2, 0x63, 0xc3, 0x63, 0xc5,
+	0x63, 0xc7, 0x63, 0xc8, 0x63, 0xca, 0x63, 0xcb, 0x63, 0xcc, 0x63, 0xd1,
+	0x63, 0xd3, 0x63, 0xd4, 0x63, 0xd5, 0x63, 0xd7, 0x63, 0xd8, 0x63, 0xd9,
+	0x63, 0xda, 0x63, 0xdb, 0x63, 0xdc, 0x63, 0xdd, 0x63, 0xdf, 0x63, 0xe2,
+	0x63, 0xe4, 0x63, 0xe5, 0x63, 0xe6, 0x63, 0xe7, 0x63, 0xe8, 0x63, 0xeb,
+	0x63, 0xec, 0x63, 0xee, 0x63, 0xef, 0x63, 0xf0, 0x63, 0xf1, 0x63, 0xf3,
+	0x63, 0xf5, 0x63, 0xf7, 0x63, 0xf9, 0x63, 0xfa, 0x63, 0xfb, 0x63, 0xfc,
+	0x63, 0xfe, 0x64, 0x03, 0x64, 0x04, 0x64, 0x06, 0x64, 0x07, 0x64, 0x08,
+	0x64, 0x09, 0x64, 0x0a, 0x64, 0x0d, 0x64, 0x0e, 0x64, 0x11, 0x64, 0x12,
+	0x64, 0x15, 0x64, 0x16, 0x64, 0x17, 0x64, 0x18, 0x64, 0x19, 0x64, 0x1a,
+	0x64, 0x1d, 0x64, 0x1f, 0x64, 0x22, 0x64, 0x23, 0x64, 0x24, 0x64, 0x25,
+	0x64, 0x27, 0x64, 0x28, 0x64, 0x29, 0x64, 0x2b, 0x64, 0x2e, 0x64, 0x2f,
+	0x64, 0x30, 0x64, 0x31, 0x64, 0x32, 0x64, 0x33, 0x64, 0x35, 0x64, 0x36,
+	0x64, 0x37, 0x64, 0x38, 0x64, 0x39, 0x64, 0x3b, 0x64, 0x3c, 0x64, 0x3e,
+	0x64, 0x40, 0x64, 0x42, 0x64, 0x43, 0x64, 0x49, 0x64, 0x4b, 0x64, 0x4c,
+	0x64, 0x4d, 0x64, 0x4e, 0x64, 0x4f, 0x64, 0x50, 0x64, 0x51, 0x64, 0x53,
+	0x64, 0x55, 0x64, 0x56, 0x64, 0x57, 0x64, 0x59, 0x64, 0x5a, 0x64, 0x5b,
+	0x64, 0x5c, 0x64, 0x5d, 0x64, 0x5f, 0x64, 0x60, 0x64, 0x61, 0x64, 0x62,
+	0x64, 0x63, 0x64, 0x64, 0x64, 0x65, 0x64, 0x66, 0x64, 0x68, 0x64, 0x6a,
+	0x64, 0x6b, 0x64, 0x6c, 0x64, 0x6e, 0x64, 0x6f, 0x64, 0x70, 0x64, 0x71,
+	0x64, 0x72, 0x64, 0x73, 0x64, 0x74, 0x64, 0x75, 0x64, 0x76, 0x64, 0x77,
+	0x64, 0x7b, 0x64, 0x7c, 0x64, 0x7d, 0x64, 0x7e, 0x64, 0x7f, 0x64, 0x80,
+	0x64, 0x81, 0x64, 0x83, 0x64, 0x86, 0x64, 0x88, 0x64, 0x89, 0x64, 0x8a,
+	0x64, 0x8b, 0x64, 0x8c, 0x64, 0x8d, 0x64, 0x8e, 0x64, 0x8f, 0x64, 0x90,
+	0x64, 0x93, 0x64, 0x94, 0x64, 0x97, 0x64, 0x98, 0x64, 0x9a, 0x64, 0x9b,
+	0x64, 0x9c, 0x64, 0x9d, 0x64, 0x9f, 0x64, 0xa0, 0x64, 0xa1, 0x64, 0xa2,
+	0x64, 0xa3, 0x64, 0xa5, 0x64, 0xa6, 0x64, 0xa7, 0x64, 0xa8, 0x64, 0xaa,
+	0x64, 0xab, 0x64, 0xaf, 0x64, 0xb1, 0x64, 0xb2, 0x64, 0xb3, 0x64, 0xb4,
+	0x64, 0xb6, 0x64, 0xb9, 0x64, 0xbb, 0x64, 0xbd, 0x64, 0xbe, 0x64, 0xbf,
+	0x64, 0xc1, 0x64, 0xc3, 0x64, 0xc4, 0x64, 0xc6, 0x64, 0xc7, 0x64, 0xc8,
+	0x64, 0xc9, 0x64, 0xca, 0x64, 0xcb, 0x64, 0xcc, 0x64, 0xcf, 0x64, 0xd1,
+	0x64, 0xd3, 0x64, 0xd4, 0x64, 0xd5, 0x64, 0xd6, 0x64, 0xd9, 0x64, 0xda,
+	0x64, 0xdb, 0x64, 0xdc, 0x64, 0xdd, 0x64, 0xdf, 0x64, 0xe0, 0x64, 0xe1,
+	0x64, 0xe3, 0x64, 0xe5, 0x64, 0xe7, 0x64, 0xe8, 0x64, 0xe9, 0x64, 0xea,
+	0x64, 0xeb, 0x64, 0xec, 0x64, 0xed, 0x64, 0xee, 0x64, 0xef, 0x64, 0xf0,
+	0x64, 0xf1, 0x64, 0xf2, 0x64, 0xf3, 0x64, 0xf4, 0x64, 0xf5, 0x64, 0xf6,
+	0x64, 0xf7, 0x64, 0xf8, 0x64, 0xf9, 0x64, 0xfa, 0x64, 0xfb, 0x64, 0xfc,
+	0x64, 0xfd, 0x64, 0xfe, 0x64, 0xff, 0x65, 0x01, 0x65, 0x02, 0x65, 0x03,
+	0x65, 0x04, 0x65, 0x05, 0x65, 0x06, 0x65, 0x07, 0x65, 0x08, 0x65, 0x0a,
+	0x65, 0x0b, 0x65, 0x0c, 0x65, 0x0d, 0x65, 0x0e, 0x65, 0x0f, 0x65, 0x10,
+	0x65, 0x11, 0x65, 0x13, 0x65, 0x14, 0x65, 0x15, 0x65, 0x16, 0x65, 0x17,
+	0x65, 0x19, 0x65, 0x1a, 0x65, 0x1b, 0x65, 0x1c, 0x65, 0x1d, 0x65, 0x1e,
+	0x65, 0x1f, 0x65, 0x20, 0x65, 0x21, 0x65, 0x22, 0x65, 0x23, 0x65, 0x24,
+	0x65, 0x26, 0x65, 0x27, 0x65, 0x28, 0x65, 0x29, 0x65, 0x2a, 0x65, 0x2c,
+	0x65, 0x2d, 0x65, 0x30, 0x65, 0x31, 0x65, 0x32, 0x65, 0x33, 0x65, 0x37,
+	0x65, 0x3a, 0x65, 0x3c, 0x65, 0x3d, 0x65, 0x40, 0x65, 0x41, 0x65, 0x42,
+	0x65, 0x43, 0x65, 0x44, 0x65, 0x46, 0x65, 0x47, 0x65, 0x4a, 0x65, 0x4b,
+	0x65, 0x4d, 0x65, 0x4e, 0x65, 0x50, 0x65, 0x52, 0x65, 0x53, 0x65, 0x54,
+	0x65, 0x57, 0x65, 0x58, 0x65, 0x5a, 0x65, 0x5c, 0x65, 0x5f, 0x65, 0x60,
+	0x65, 0x61, 0x65, 0x64, 0x65, 0x65, 0x65, 0x67, 0x65, 0x68, 0x65, 0x69,
+	0x65, 0x6a, 0x65, 0x6d, 0x65, 0x6e, 0x65, 0x6f, 0x65, 0x71, 0x65, 0x73,
+	0x65, 0x75, 0x65, 0x76, 0x65, 0x78, 0x65, 0x79, 0x65, 0x7a, 0x65, 0x7b,
+	0x65, 0x7c, 0x65, 0x7d, 0x65, 0x7e, 0x65, 0x7f, 0x65, 0x80, 0x65, 0x81,
+	0x65, 0x82, 0x65, 0x83, 0x65, 0x84, 0x65, 0x85, 0x65, 0x86, 0x65, 0x88,
+	0x65, 0x89, 0x65, 0x8a, 0x65, 0x8d, 0x65, 0x8e, 0x65, 0x8f, 0x65, 0x92,
+	0x65, 0x94, 0x65, 0x95, 0x65, 0x96, 0x65, 0x98, 0x65, 0x9a, 0x65, 0x9d,
+	0x65, 0x9e, 0x65, 0xa0, 0x65, 0xa2, 0x65, 0xa3, 0x65, 0xa6, 0x65, 0xa8,
+	0x65, 0xaa, 0x65, 0xac, 0x65, 0xae, 0x65, 0xb1, 0x65, 0xb2, 0x65, 0xb3,
+	0x65, 0xb4, 0x65, 0xb5, 0x65, 0xb6, 0x65, 0xb7, 0x65, 0xb8, 0x65, 0xba,
+	0x65, 0xbb, 0x65, 0xbe, 0x65, 0xbf, 0x65, 0xc0, 0x65, 0xc2, 0x65, 0xc7,
+	0x65, 0xc8, 0x65, 0xc9, 0x65, 0xca, 0x65, 0xcd, 0x65, 0xd0, 0x65, 0xd1,
+	0x65, 0xd3, 0x65, 0xd4, 0x65, 0xd5, 0x65, 0xd8, 0x65, 0xd9, 0x65, 0xda,
+	0x65, 0xdb, 0x65, 0xdc, 0x65, 0xdd, 0x65, 0xde, 0x65, 0xdf, 0x65, 0xe1,
+	0x65, 0xe3, 0x65, 0xe4, 0x65, 0xea, 0x65, 0xeb, 0x65, 0xf2, 0x65, 0xf3,
+	0x65, 0xf4, 0x65, 0xf5, 0x65, 0xf8, 0x65, 0xf9, 0x65, 0xfb, 0x65, 0xfc,
+	0x65, 0xfd, 0x65, 0xfe, 0x65, 0xff, 0x66, 0x01, 0x66, 0x04, 0x66, 0x05,
+	0x66, 0x07, 0x66, 0x08, 0x66, 0x09, 0x66, 0x0b, 0x66, 0x0d, 0x66, 0x10,
+	0x66, 0x11, 0x66, 0x12, 0x66, 0x16, 0x66, 0x17, 0x66, 0x18, 0x66, 0x1a,
+	0x66, 0x1b, 0x66, 0x1c, 0x66, 0x1e, 0x66, 0x21, 0x66, 0x22, 0x66, 0x23,
+	0x66, 0x24, 0x66, 0x26, 0x66, 0x29, 0x66, 0x2a, 0x66, 0x2b, 0x66, 0x2c,
+	0x66, 0x2e, 0x66, 0x30, 0x66, 0x32, 0x66, 0x33, 0x66, 0x37, 0x66, 0x38,
+	0x66, 0x39, 0x66, 0x3a, 0x66, 0x3b, 0x66, 0x3d, 0x66, 0x3f, 0x66, 0x40,
+	0x66, 0x42, 0x66, 0x44, 0x66, 0x45, 0x66, 0x46, 0x66, 0x47, 0x66, 0x48,
+	0x66, 0x49, 0x66, 0x4a, 0x66, 0x4d, 0x66, 0x4e, 0x66, 0x50, 0x66, 0x51,
+	0x66, 0x58, 0x66, 0x59, 0x66, 0x5b, 0x66, 0x5c, 0x66, 0x5d, 0x66, 0x5e,
+	0x66, 0x60, 0x66, 0x62, 0x66, 0x63, 0x66, 0x65, 0x66, 0x67, 0x66, 0x69,
+	0x66, 0x6a, 0x66, 0x6b, 0x66, 0x6c, 0x66, 0x6d, 0x66, 0x71, 0x66, 0x72,
+	0x66, 0x73, 0x66, 0x75, 0x66, 0x78, 0x66, 0x79, 0x66, 0x7b, 0x66, 0x7c,
+	0x66, 0x7d, 0x66, 0x7f, 0x66, 0x80, 0x66, 0x81, 0x66, 0x83, 0x66, 0x85,
+	0x66, 0x86, 0x66, 0x88, 0x66, 0x89, 0x66, 0x8a, 0x66, 0x8b, 0x66, 0x8d,
+	0x66, 0x8e, 0x66, 0x8f, 0x66, 0x90, 0x66, 0x92, 0x66, 0x93, 0x66, 0x94,
+	0x66, 0x95, 0x66, 0x98, 0x66, 0x99, 0x66, 0x9a, 0x66, 0x9b, 0x66, 0x9c,
+	0x66, 0x9e, 0x66, 0x9f, 0x66, 0xa0, 0x66, 0xa1, 0x66, 0xa2, 0x66, 0xa3,
+	0x66, 0xa4, 0x66, 0xa5, 0x66, 0xa6, 0x66, 0xa9, 0x66, 0xaa, 0x66, 0xab,
+	0x66, 0xac, 0x66, 0xad, 0x66, 0xaf, 0x66, 0xb0, 0x66, 0xb1, 0x66, 0xb2,
+	0x66, 0xb3, 0x66, 0xb5, 0x66, 0xb6, 0x66, 0xb7, 0x66, 0xb8, 0x66, 0xba,
+	0x66, 0xbb, 0x66, 0xbc, 0x66, 0xbd, 0x66, 0xbf, 0x66, 0xc0, 0x66, 0xc1,
+	0x66, 0xc2, 0x66, 0xc3, 0x66, 0xc4, 0x66, 0xc5, 0x66, 0xc6, 0x66, 0xc7,
+	0x66, 0xc8, 0x66, 0xc9, 0x66, 0xca, 0x66, 0xcb, 0x66, 0xcc, 0x66, 0xcd,
+	0x66, 0xce, 0x66, 0xcf, 0x66, 0xd0, 0x66, 0xd1, 0x66, 0xd2, 0x66, 0xd3,
+	0x66, 0xd4, 0x66, 0xd5, 0x66, 0xd6, 0x66, 0xd7, 0x66, 0xd8, 0x66, 0xda,
+	0x66, 0xde, 0x66, 0xdf, 0x66, 0xe0, 0x66, 0xe1, 0x66, 0xe2, 0x66, 0xe3,
+	0x66, 0xe4, 0x66, 0xe5, 0x66, 0xe7, 0x66, 0xe8, 0x66, 0xea, 0x66, 0xeb,
+	0x66, 0xec, 0x66, 0xed, 0x66, 0xee, 0x66, 0xef, 0x66, 0xf1, 0x66, 0xf5,
+	0x66, 0xf6, 0x66, 0xf8, 0x66, 0xfa, 0x66, 0xfb, 0x66, 0xfd, 0x67, 0x01,
+	0x67, 0x02, 0x67, 0x03, 0x67, 0x04, 0x67, 0x05, 0x67, 0x06, 0x67, 0x07,
+	0x67, 0x0c, 0x67, 0x0e, 0x67, 0x0f, 0x67, 0x11, 0x67, 0x12, 0x67, 0x13,
+	0x67, 0x16, 0x67, 0x18, 0x67, 0x19, 0x67, 0x1a, 0x67, 0x1c, 0x67, 0x1e,
+	0x67, 0x20, 0x67, 0x21, 0x67, 0x22, 0x67, 0x23, 0x67, 0x24, 0x67, 0x25,
+	0x67, 0x27, 0x67, 0x29, 0x67, 0x2e, 0x67, 0x30, 0x67, 0x32, 0x67, 0x33,
+	0x67, 0x36, 0x67, 0x37, 0x67, 0x38, 0x67, 0x39, 0x67, 0x3b, 0x67, 0x3c,
+	0x67, 0x3e, 0x67, 0x3f, 0x67, 0x41, 0x67, 0x44, 0x67, 0x45, 0x67, 0x47,
+	0x67, 0x4a, 0x67, 0x4b, 0x67, 0x4d, 0x67, 0x52, 0x67, 0x54, 0x67, 0x55,
+	0x67, 0x57, 0x67, 0x58, 0x67, 0x59, 0x67, 0x5a, 0x67, 0x5b, 0x67, 0x5d,
+	0x67, 0x62, 0x67, 0x63, 0x67, 0x64, 0x67, 0x66, 0x67, 0x67, 0x67, 0x6b,
+	0x67, 0x6c, 0x67, 0x6e, 0x67, 0x71, 0x67, 0x74, 0x67, 0x76, 0x67, 0x78,
+	0x67, 0x79, 0x67, 0x7a, 0x67, 0x7b, 0x67, 0x7d, 0x67, 0x80, 0x67, 0x82,
+	0x67, 0x83, 0x67, 0x85, 0x67, 0x86, 0x67, 0x88, 0x67, 0x8a, 0x67, 0x8c,
+	0x67, 0x8d, 0x67, 0x8e, 0x67, 0x8f, 0x67, 0x91, 0x67, 0x92, 0x67, 0x93,
+	0x67, 0x94, 0x67, 0x96, 0x67, 0x99, 0x67, 0x9b, 0x67, 0x9f, 0x67, 0xa0,
+	0x67, 0xa1, 0x67, 0xa4, 0x67, 0xa6, 0x67, 0xa9, 0x67, 0xac, 0x67, 0xae,
+	0x67, 0xb1, 0x67, 0xb2, 0x67, 0xb4, 0x67, 0xb9, 0x67, 0xba, 0x67, 0xbb,
+	0x67, 0xbc, 0x67, 0xbd, 0x67, 0xbe, 0x67, 0xbf, 0x67, 0xc0, 0x67, 0xc2,
+	0x67, 0xc5, 0x67, 0xc6, 0x67, 0xc7, 0x67, 0xc8, 0x67, 0xc9, 0x67, 0xca,
+	0x67, 0xcb, 0x67, 0xcc, 0x67, 0xcd, 0x67, 0xce, 0x67, 0xd5, 0x67, 0xd6,
+	0x67, 0xd7, 0x67, 0xdb, 0x67, 0xdf, 0x67, 0xe1, 0x67, 0xe3, 0x67, 0xe4,
+	0x67, 0xe6, 0x67, 0xe7, 0x67, 0xe8, 0x67, 0xea, 0x67, 0xeb, 0x67, 0xed,
+	0x67, 0xee, 0x67, 0xf2, 0x67, 0xf5, 0x67, 0xf6, 0x67, 0xf7, 0x67, 0xf8,
+	0x67, 0xf9, 0x67, 0xfa, 0x67, 0xfb, 0x67, 0xfc, 0x67, 0xfe, 0x68, 0x01,
+	0x68, 0x02, 0x68, 0x03, 0x68, 0x04, 0x68, 0x06, 0x68, 0x0d, 0x68, 0x10,
+	0x68, 0x12, 0x68, 0x14, 0x68, 0x15, 0x68, 0x18, 0x68, 0x19, 0x68, 0x1a,
+	0x68, 0x1b, 0x68, 0x1c, 0x68, 0x1e, 0x68, 0x1f, 0x68, 0x20, 0x68, 0x22,
+	0x68, 0x23, 0x68, 0x24, 0x68, 0x25, 0x68, 0x26, 0x68, 0x27, 0x68, 0x28,
+	0x68, 0x2b, 0x68, 0x2c, 0x68, 0x2d, 0x68, 0x2e, 0x68, 0x2f, 0x68, 0x30,
+	0x68, 0x31, 0x68, 0x34, 0x68, 0x35, 0x68, 0x36, 0x68, 0x3a, 0x68, 0x3b,
+	0x68, 0x3f, 0x68, 0x47, 0x68, 0x4b, 0x68, 0x4d, 0x68, 0x4f, 0x68, 0x52,
+	0x68, 0x56, 0x68, 0x57, 0x68, 0x58, 0x68, 0x59, 0x68, 0x5a, 0x68, 0x5b,
+	0x68, 0x5c, 0x68, 0x5d, 0x68, 0x5e, 0x68, 0x5f, 0x68, 0x6a, 0x68, 0x6c,
+	0x68, 0x6d, 0x68, 0x6e, 0x68, 0x6f, 0x68, 0x70, 0x68, 0x71, 0x68, 0x72,
+	0x68, 0x73, 0x68, 0x75, 0x68, 0x78, 0x68, 0x79, 0x68, 0x7a, 0x68, 0x7b,
+	0x68, 0x7c, 0x68, 0x7d, 0x68, 0x7e, 0x68, 0x7f, 0x68, 0x80, 0x68, 0x82,
+	0x68, 0x84, 0x68, 0x87, 0x68, 0x88, 0x68, 0x89, 0x68, 0x8a, 0x68, 0x8b,
+	0x68, 0x8c, 0x68, 0x8d, 0x68, 0x8e, 0x68, 0x90, 0x68, 0x91, 0x68, 0x92,
+	0x68, 0x94, 0x68, 0x95, 0x68, 0x96, 0x68, 0x98, 0x68, 0x99, 0x68, 0x9a,
+	0x68, 0x9b, 0x68, 0x9c, 0x68, 0x9d, 0x68, 0x9e, 0x68, 0x9f, 0x68, 0xa0,
+	0x68, 0xa1, 0x68, 0xa3, 0x68, 0xa4, 0x68, 0xa5, 0x68, 0xa9, 0x68, 0xaa,
+	0x68, 0xab, 0x68, 0xac, 0x68, 0xae, 0x68, 0xb1, 0x68, 0xb2, 0x68, 0xb4,
+	0x68, 0xb6, 0x68, 0xb7, 0x68, 0xb8, 0x68, 0xb9, 0x68, 0xba, 0x68, 0xbb,
+	0x68, 0xbc, 0x68, 0xbd, 0x68, 0xbe, 0x68, 0xbf, 0x68, 0xc1, 0x68, 0xc3,
+	0x68, 0xc4, 0x68, 0xc5, 0x68, 0xc6, 0x68, 0xc7, 0x68, 0xc8, 0x68, 0xca,
+	0x68, 0xcc, 0x68, 0xce, 0x68, 0xcf, 0x68, 0xd0, 0x68, 0xd1, 0x68, 0xd3,
+	0x68, 0xd4, 0x68, 0xd6, 0x68, 0xd7, 0x68, 0xd9, 0x68, 0xdb, 0x68, 0xdc,
+	0x68, 0xdd, 0x68, 0xde, 0x68, 0xdf, 0x68, 0xe1, 0x68, 0xe2, 0x68, 0xe4,
+	0x68, 0xe5, 0x68, 0xe6, 0x68, 0xe7, 0x68, 0xe8, 0x68, 0xe9, 0x68, 0xea,
+	0x68, 0xeb, 0x68, 0xec, 0x68, 0xed, 0x68, 0xef, 0x68, 0xf2, 0x68, 0xf3,
+	0x68, 0xf4, 0x68, 0xf6, 0x68, 0xf7, 0x68, 0xf8, 0x68, 0xfb, 0x68, 0xfd,
+	0x68, 0xfe, 0x68, 0xff, 0x69, 0x00, 0x69, 0x02, 0x69, 0x03, 0x69, 0x04,
+	0x69, 0x06, 0x69, 0x07, 0x69, 0x08, 0x69, 0x09, 0x69, 0x0a, 0x69, 0x0c,
+	0x69, 0x0f, 0x69, 0x11, 0x69, 0x13, 0x69, 0x14, 0x69, 0x15, 0x69, 0x16,
+	0x69, 0x17, 0x69, 0x18, 0x69, 0x19, 0x69, 0x1a, 0x69, 0x1b, 0x69, 0x1c,
+	0x69, 0x1d, 0x69, 0x1e, 0x69, 0x21, 0x69, 0x22, 0x69, 0x23, 0x69, 0x25,
+	0x69, 0x26, 0x69, 0x27, 0x69, 0x28, 0x69, 0x29, 0x69, 0x2a, 0x69, 0x2b,
+	0x69, 0x2c, 0x69, 0x2e, 0x69, 0x2f, 0x69, 0x31, 0x69, 0x32, 0x69, 0x33,
+	0x69, 0x35, 0x69, 0x36, 0x69, 0x37, 0x69, 0x38, 0x69, 0x3a, 0x69, 0x3b,
+	0x69, 0x3c, 0x69, 0x3e, 0x69, 0x40, 0x69, 0x41, 0x69, 0x43, 0x69, 0x44,
+	0x69, 0x45, 0x69, 0x46, 0x69, 0x47, 0x69, 0x48, 0x69, 0x49, 0x69, 0x4a,
+	0x69, 0x4b, 0x69, 0x4c, 0x69, 0x4d, 0x69, 0x4e, 0x69, 0x4f, 0x69, 0x50,
+	0x69, 0x51, 0x69, 0x52, 0x69, 0x53, 0x69, 0x55, 0x69, 0x56, 0x69, 0x58,
+	0x69, 0x59, 0x69, 0x5b, 0x69, 0x5c, 0x69, 0x5f, 0x69, 0x61, 0x69, 0x62,
+	0x69, 0x64, 0x69, 0x65, 0x69, 0x67, 0x69, 0x68, 0x69, 0x69, 0x69, 0x6a,
+	0x69, 0x6c, 0x69, 0x6d, 0x69, 0x6f, 0x69, 0x70, 0x69, 0x72, 0x69, 0x73,
+	0x69, 0x74, 0x69, 0x75, 0x69, 0x76, 0x69, 0x7a, 0x69, 0x7b, 0x69, 0x7d,
+	0x69, 0x7e, 0x69, 0x7f, 0x69, 0x81, 0x69, 0x83, 0x69, 0x85, 0x69, 0x8a,
+	0x69, 0x8b, 0x69, 0x8c, 0x69, 0x8e, 0x69, 0x8f, 0x69, 0x90, 0x69, 0x91,
+	0x69, 0x92, 0x69, 0x93, 0x69, 0x96, 0x69, 0x97, 0x69, 0x99, 0x69, 0x9a,
+	0x69, 0x9d, 0x69, 0x9e, 0x69, 0x9f, 0x69, 0xa0, 0x69, 0xa1, 0x69, 0xa2,
+	0x69, 0xa3, 0x69, 0xa4, 0x69, 0xa5, 0x69, 0xa6, 0x69, 0xa9, 0x69, 0xaa,
+	0x69, 0xac, 0x69, 0xae, 0x69, 0xaf, 0x69, 0xb0, 0x69, 0xb2, 0x69, 0xb3,
+	0x69, 0xb5, 0x69, 0xb6, 0x69, 0xb8, 0x69, 0xb9, 0x69, 0xba, 0x69, 0xbc,
+	0x69, 0xbd, 0x69, 0xbe, 0x69, 0xbf, 0x69, 0xc0, 0x69, 0xc2, 0x69, 0xc3,
+	0x69, 0xc4, 0x69, 0xc5, 0x69, 0xc6, 0x69, 0xc7, 0x69, 0xc8, 0x69, 0xc9,
+	0x69, 0xcb, 0x69, 0xcd, 0x69, 0xcf, 0x69, 0xd1, 0x69, 0xd2, 0x69, 0xd3,
+	0x69, 0xd5, 0x69, 0xd6, 0x69, 0xd7, 0x69, 0xd8, 0x69, 0xd9, 0x69, 0xda,
+	0x69, 0xdc, 0x69, 0xdd, 0x69, 0xde, 0x69, 0xe1, 0x69, 0xe2, 0x69, 0xe3,
+	0x69, 0xe4, 0x69, 0xe5, 0x69, 0xe6, 0x69, 0xe7, 0x69, 0xe8, 0x69, 0xe9,
+	0x69, 0xea, 0x69, 0xeb, 0x69, 0xec, 0x69, 0xee, 0x69, 0xef, 0x69, 0xf0,
+	0x69, 0xf1, 0x69, 0xf3, 0x69, 0xf4, 0x69, 0xf5, 0x69, 0xf6, 0x69, 0xf7,
+	0x69, 0xf8, 0x69, 0xf9, 0x69, 0xfa, 0x69, 0xfb, 0x69, 0xfc, 0x69, 0xfe,
+	0x6a, 0x00, 0x6a, 0x01, 0x6a, 0x02, 0x6a, 0x03, 0x6a, 0x04, 0x6a, 0x05,
+	0x6a, 0x06, 0x6a, 0x07, 0x6a, 0x08, 0x6a, 0x09, 0x6a, 0x0b, 0x6a, 0x0c,
+	0x6a, 0x0d, 0x6a, 0x0e, 0x6a, 0x0f, 0x6a, 0x10, 0x6a, 0x11, 0x6a, 0x12,
+	0x6a, 0x13, 0x6a, 0x14, 0x6a, 0x15, 0x6a, 0x16, 0x6a, 0x19, 0x6a, 0x1a,
+	0x6a, 0x1b, 0x6a, 0x1c, 0x6a, 0x1d, 0x6a, 0x1e, 0x6a, 0x20, 0x6a, 0x22,
+	0x6a, 0x23, 0x6a, 0x24, 0x6a, 0x25, 0x6a, 0x26, 0x6a, 0x27, 0x6a, 0x29,
+	0x6a, 0x2b, 0x6a, 0x2c, 0x6a, 0x2d, 0x6a, 0x2e, 0x6a, 0x30, 0x6a, 0x32,
+	0x6a, 0x33, 0x6a, 0x34, 0x6a, 0x36, 0x6a, 0x37, 0x6a, 0x38, 0x6a, 0x39,
+	0x6a, 0x3a, 0x6a, 0x3b, 0x6a, 0x3c, 0x6a, 0x3f, 0x6a, 0x40, 0x6a, 0x41,
+	0x6a, 0x42, 0x6a, 0x43, 0x6a, 0x45, 0x6a, 0x46, 0x6a, 0x48, 0x6a, 0x49,
+	0x6a, 0x4a, 0x6a, 0x4b, 0x6a, 0x4c, 0x6a, 0x4d, 0x6a, 0x4e, 0x6a, 0x4f,
+	0x6a, 0x51, 0x6a, 0x52, 0x6a, 0x53, 0x6a, 0x54, 0x6a, 0x55, 0x6a, 0x56,
+	0x6a, 0x57, 0x6a, 0x5a, 0x6a, 0x5c, 0x6a, 0x5d, 0x6a, 0x5e, 0x6a, 0x5f,
+	0x6a, 0x60, 0x6a, 0x62, 0x6a, 0x63, 0x6a, 0x64, 0x6a, 0x66, 0x6a, 0x67,
+	0x6a, 0x68, 0x6a, 0x69, 0x6a, 0x6a, 0x6a, 0x6b, 0x6a, 0x6c, 0x6a, 0x6d,
+	0x6a, 0x6e, 0x6a, 0x6f, 0x6a, 0x70, 0x6a, 0x72, 0x6a, 0x73, 0x6a, 0x74,
+	0x6a, 0x75, 0x6a, 0x76, 0x6a, 0x77, 0x6a, 0x78, 0x6a, 0x7a, 0x6a, 0x7b,
+	0x6a, 0x7d, 0x6a, 0x7e, 0x6a, 0x7f, 0x6a, 0x81, 0x6a, 0x82, 0x6a, 0x83,
+	0x6a, 0x85, 0x6a, 0x86, 0x6a, 0x87, 0x6a, 0x88, 0x6a, 0x89, 0x6a, 0x8a,
+	0x6a, 0x8b, 0x6a, 0x8c, 0x6a, 0x8d, 0x6a, 0x8f, 0x6a, 0x92, 0x6a, 0x93,
+	0x6a, 0x94, 0x6a, 0x95, 0x6a, 0x96, 0x6a, 0x98, 0x6a, 0x99, 0x6a, 0x9a,
+	0x6a, 0x9b, 0x6a, 0x9c, 0x6a, 0x9d, 0x6a, 0x9e, 0x6a, 0x9f, 0x6a, 0xa1,
+	0x6a, 0xa2, 0x6a, 0xa3, 0x6a, 0xa4, 0x6a, 0xa5, 0x6a, 0xa6, 0x6a, 0xa7,
+	0x6a, 0xa8, 0x6a, 0xaa, 0x6a, 0xad, 0x6a, 0xae, 0x6a, 0xaf, 0x6a, 0xb0,
+	0x6a, 0xb1, 0x6a, 0xb2, 0x6a, 0xb3, 0x6a, 0xb4, 0x6a, 0xb5, 0x6a, 0xb6,
+	0x6a, 0xb7, 0x6a, 0xb8, 0x6a, 0xb9, 0x6a, 0xba, 0x6a, 0xbb, 0x6a, 0xbc,
+	0x6a, 0xbd, 0x6a, 0xbe, 0x6a, 0xbf, 0x6a, 0xc0, 0x6a, 0xc1, 0x6a, 0xc2,
+	0x6a, 0xc3, 0x6a, 0xc4, 0x6a, 0xc5, 0x6a, 0xc6, 0x6a, 0xc7, 0x6a, 0xc8,
+	0x6a, 0xc9, 0x6a, 0xca, 0x6a, 0xcb, 0x6a, 0xcc, 0x6a, 0xcd, 0x6a, 0xce,
+	0x6a, 0xcf, 0x6a, 0xd0, 0x6a, 0xd1, 0x6a, 0xd2, 0x6a, 0xd3, 0x6a, 0xd4,
+	0x6a, 0xd5, 0x6a, 0xd6, 0x6a, 0xd7, 0x6a, 0xd8, 0x6a, 0xd9, 0x6a, 0xda,
+	0x6a, 0xdb, 0x6a, 0xdc, 0x6a, 0xdd, 0x6a, 0xde, 0x6a, 0xdf, 0x6a, 0xe0,
+	0x6a, 0xe1, 0x6a, 0xe2, 0x6a, 0xe3, 0x6a, 0xe4, 0x6a, 0xe5, 0x6a, 0xe6,
+	0x6a, 0xe7, 0x6a, 0xe8, 0x6a, 0xe9, 0x6a, 0xea, 0x6a, 0xeb, 0x6a, 0xec,
+	0x6a, 0xed, 0x6a, 0xee, 0x6a, 0xef, 0x6a, 0xf0, 0x6a, 0xf1, 0x6a, 0xf2,
+	0x6a, 0xf3, 0x6a, 0xf4, 0x6a, 0xf5, 0x6a, 0xf6, 0x6a, 0xf7, 0x6a, 0xf8,
+	0x6a, 0xf9, 0x6a, 0xfa, 0x6a, 0xfb, 0x6a, 0xfc, 0x6a, 0xfd, 0x6a, 0xfe,
+	0x6a, 0xff, 0x6b, 0x00, 0x6b, 0x01, 0x6b, 0x02, 0x6b, 0x03, 0x6b, 0x04,
+	0x6b, 0x05, 0x6b, 0x06, 0x6b, 0x07, 0x6b, 0x08, 0x6b, 0x09, 0x6b, 0x0a,
+	0x6b, 0x0b, 0x6b, 0x0c, 0x6b, 0x0d, 0x6b, 0x0e, 0x6b, 0x0f, 0x6b, 0x10,
+	0x6b, 0x11, 0x6b, 0x12, 0x6b, 0x13, 0x6b, 0x14, 0x6b, 0x15, 0x6b, 0x16,
+	0x6b, 0x17, 0x6b, 0x18, 0x6b, 0x19, 0x6b, 0x1a, 0x6b, 0x1b, 0x6b, 0x1c,
+	0x6b, 0x1d, 0x6b, 0x1e, 0x6b, 0x1f, 0x6b, 0x25, 0x6b, 0x26, 0x6b, 0x28,
+	0x6b, 0x29, 0x6b, 0x2a, 0x6b, 0x2b, 0x6b, 0x2c, 0x6b, 0x2d, 0x6b, 0x2e,
+	0x6b, 0x2f, 0x6b, 0x30, 0x6b, 0x31, 0x6b, 0x33, 0x6b, 0x34, 0x6b, 0x35,
+	0x6b, 0x36, 0x6b, 0x38, 0x6b, 0x3b, 0x6b, 0x3c, 0x6b, 0x3d, 0x6b, 0x3f,
+	0x6b, 0x40, 0x6b, 0x41, 0x6b, 0x42, 0x6b, 0x44, 0x6b, 0x45, 0x6b, 0x48,
+	0x6b, 0x4a, 0x6b, 0x4b, 0x6b, 0x4d, 0x6b, 0x4e, 0x6b, 0x4f, 0x6b, 0x50,
+	0x6b, 0x51, 0x6b, 0x52, 0x6b, 0x53, 0x6b, 0x54, 0x6b, 0x55, 0x6b, 0x56,
+	0x6b, 0x57, 0x6b, 0x58, 0x6b, 0x5a, 0x6b, 0x5b, 0x6b, 0x5c, 0x6b, 0x5d,
+	0x6b, 0x5e, 0x6b, 0x5f, 0x6b, 0x60, 0x6b, 0x61, 0x6b, 0x68, 0x6b, 0x69,
+	0x6b, 0x6b, 0x6b, 0x6c, 0x6b, 0x6d, 0x6b, 0x6e, 0x6b, 0x6f, 0x6b, 0x70,
+	0x6b, 0x71, 0x6b, 0x72, 0x6b, 0x73, 0x6b, 0x74, 0x6b, 0x75, 0x6b, 0x76,
+	0x6b, 0x77, 0x6b, 0x78, 0x6b, 0x7a, 0x6b, 0x7d, 0x6b, 0x7e, 0x6b, 0x7f,
+	0x6b, 0x80, 0x6b, 0x85, 0x6b, 0x88, 0x6b, 0x8c, 0x6b, 0x8e, 0x6b, 0x8f,
+	0x6b, 0x90, 0x6b, 0x91, 0x6b, 0x94, 0x6b, 0x95, 0x6b, 0x97, 0x6b, 0x98,
+	0x6b, 0x99, 0x6b, 0x9c, 0x6b, 0x9d, 0x6b, 0x9e, 0x6b, 0x9f, 0x6b, 0xa0,
+	0x6b, 0xa2, 0x6b, 0xa3, 0x6b, 0xa4, 0x6b, 0xa5, 0x6b, 0xa6, 0x6b, 0xa7,
+	0x6b, 0xa8, 0x6b, 0xa9, 0x6b, 0xab, 0x6b, 0xac, 0x6b, 0xad, 0x6b, 0xae,
+	0x6b, 0xaf, 0x6b, 0xb0, 0x6b, 0xb1, 0x6b, 0xb2, 0x6b, 0xb6, 0x6b, 0xb8,
+	0x6b, 0xb9, 0x6b, 0xba, 0x6b, 0xbb, 0x6b, 0xbc, 0x6b, 0xbd, 0x6b, 0xbe,
+	0x6b, 0xc0, 0x6b, 0xc3, 0x6b, 0xc4, 0x6b, 0xc6, 0x6b, 0xc7, 0x6b, 0xc8,
+	0x6b, 0xc9, 0x6b, 0xca, 0x6b, 0xcc, 0x6b, 0xce, 0x6b, 0xd0, 0x6b, 0xd1,
+	0x6b, 0xd8, 0x6b, 0xda, 0x6b, 0xdc, 0x6b, 0xdd, 0x6b, 0xde, 0x6b, 0xdf,
+	0x6b, 0xe0, 0x6b, 0xe2, 0x6b, 0xe3, 0x6b, 0xe4, 0x6b, 0xe5, 0x6b, 0xe6,
+	0x6b, 0xe7, 0x6b, 0xe8, 0x6b, 0xe9, 0x6b, 0xec, 0x6b, 0xed, 0x6b, 0xee,
+	0x6b, 0xf0, 0x6b, 0xf1, 0x6b, 0xf2, 0x6b, 0xf4, 0x6b, 0xf6, 0x6b, 0xf7,
+	0x6b, 0xf8, 0x6b, 0xfa, 0x6b, 0xfb, 0x6b, 0xfc, 0x6b, 0xfe, 0x6b, 0xff,
+	0x6c, 0x00, 0x6c, 0x01, 0x6c, 0x02, 0x6c, 0x03, 0x6c, 0x04, 0x6c, 0x08,
+	0x6c, 0x09, 0x6c, 0x0a, 0x6c, 0x0b, 0x6c, 0x0c, 0x6c, 0x0e, 0x6c, 0x12,
+	0x6c, 0x17, 0x6c, 0x1c, 0x6c, 0x1d, 0x6c, 0x1e, 0x6c, 0x20, 0x6c, 0x23,
+	0x6c, 0x25, 0x6c, 0x2b, 0x6c, 0x2c, 0x6c, 0x2d, 0x6c, 0x31, 0x6c, 0x33,
+	0x6c, 0x36, 0x6c, 0x37, 0x6c, 0x39, 0x6c, 0x3a, 0x6c, 0x3b, 0x6c, 0x3c,
+	0x6c, 0x3e, 0x6c, 0x3f, 0x6c, 0x43, 0x6c, 0x44, 0x6c, 0x45, 0x6c, 0x48,
+	0x6c, 0x4b, 0x6c, 0x4c, 0x6c, 0x4d, 0x6c, 0x4e, 0x6c, 0x4f, 0x6c, 0x51,
+	0x6c, 0x52, 0x6c, 0x53, 0x6c, 0x56, 0x6c, 0x58, 0x6c, 0x59, 0x6c, 0x5a,
+	0x6c, 0x62, 0x6c, 0x63, 0x6c, 0x65, 0x6c, 0x66, 0x6c, 0x67, 0x6c, 0x6b,
+	0x6c, 0x6c, 0x6c, 0x6d, 0x6c, 0x6e, 0x6c, 0x6f, 0x6c, 0x71, 0x6c, 0x73,
+	0x6c, 0x75, 0x6c, 0x77, 0x6c, 0x78, 0x6c, 0x7a, 0x6c, 0x7b, 0x6c, 0x7c,
+	0x6c, 0x7f, 0x6c, 0x80, 0x6c, 0x84, 0x6c, 0x87, 0x6c, 0x8a, 0x6c, 0x8b,
+	0x6c, 0x8d, 0x6c, 0x8e, 0x6c, 0x91, 0x6c, 0x92, 0x6c, 0x95, 0x6c, 0x96,
+	0x6c, 0x97, 0x6c, 0x98, 0x6c, 0x9a, 0x6c, 0x9c, 0x6c, 0x9d, 0x6c, 0x9e,
+	0x6c, 0xa0, 0x6c, 0xa2, 0x6c, 0xa8, 0x6c, 0xac, 0x6c, 0xaf, 0x6c, 0xb0,
+	0x6c, 0xb4, 0x6c, 0xb5, 0x6c, 0xb6, 0x6c, 0xb7, 0x6c, 0xba, 0x6c, 0xc0,
+	0x6c, 0xc1, 0x6c, 0xc2, 0x6c, 0xc3, 0x6c, 0xc6, 0x6c, 0xc7, 0x6c, 0xc8,
+	0x6c, 0xcb, 0x6c, 0xcd, 0x6c, 0xce, 0x6c, 0xcf, 0x6c, 0xd1, 0x6c, 0xd2,
+	0x6c, 0xd8, 0x6c, 0xd9, 0x6c, 0xda, 0x6c, 0xdc, 0x6c, 0xdd, 0x6c, 0xdf,
+	0x6c, 0xe4, 0x6c, 0xe6, 0x6c, 0xe7, 0x6c, 0xe9, 0x6c, 0xec, 0x6c, 0xed,
+	0x6c, 0xf2, 0x6c, 0xf4, 0x6c, 0xf9, 0x6c, 0xff, 0x6d, 0x00, 0x6d, 0x02,
+	0x6d, 0x03, 0x6d, 0x05, 0x6d, 0x06, 0x6d, 0x08, 0x6d, 0x09, 0x6d, 0x0a,
+	0x6d, 0x0d, 0x6d, 0x0f, 0x6d, 0x10, 0x6d, 0x11, 0x6d, 0x13, 0x6d, 0x14,
+	0x6d, 0x15, 0x6d, 0x16, 0x6d, 0x18, 0x6d, 0x1c, 0x6d, 0x1d, 0x6d, 0x1f,
+	0x6d, 0x20, 0x6d, 0x21, 0x6d, 0x22, 0x6d, 0x23, 0x6d, 0x24, 0x6d, 0x26,
+	0x6d, 0x28, 0x6d, 0x29, 0x6d, 0x2c, 0x6d, 0x2d, 0x6d, 0x2f, 0x6d, 0x30,
+	0x6d, 0x34, 0x6d, 0x36, 0x6d, 0x37, 0x6d, 0x38, 0x6d, 0x3a, 0x6d, 0x3f,
+	0x6d, 0x40, 0x6d, 0x42, 0x6d, 0x44, 0x6d, 0x49, 0x6d, 0x4c, 0x6d, 0x50,
+	0x6d, 0x55, 0x6d, 0x56, 0x6d, 0x57, 0x6d, 0x58, 0x6d, 0x5b, 0x6d, 0x5d,
+	0x6d, 0x5f, 0x6d, 0x61, 0x6d, 0x62, 0x6d, 0x64, 0x6d, 0x65, 0x6d, 0x67,
+	0x6d, 0x68, 0x6d, 0x6b, 0x6d, 0x6c, 0x6d, 0x6d, 0x6d, 0x70, 0x6d, 0x71,
+	0x6d, 0x72, 0x6d, 0x73, 0x6d, 0x75, 0x6d, 0x76, 0x6d, 0x79, 0x6d, 0x7a,
+	0x6d, 0x7b, 0x6d, 0x7d, 0x6d, 0x7e, 0x6d, 0x7f, 0x6d, 0x80, 0x6d, 0x81,
+	0x6d, 0x83, 0x6d, 0x84, 0x6d, 0x86, 0x6d, 0x87, 0x6d, 0x8a, 0x6d, 0x8b,
+	0x6d, 0x8d, 0x6d, 0x8f, 0x6d, 0x90, 0x6d, 0x92, 0x6d, 0x96, 0x6d, 0x97,
+	0x6d, 0x98, 0x6d, 0x99, 0x6d, 0x9a, 0x6d, 0x9c, 0x6d, 0xa2, 0x6d, 0xa5,
+	0x6d, 0xac, 0x6d, 0xad, 0x6d, 0xb0, 0x6d, 0xb1, 0x6d, 0xb3, 0x6d, 0xb4,
+	0x6d, 0xb6, 0x6d, 0xb7, 0x6d, 0xb9, 0x6d, 0xba, 0x6d, 0xbb, 0x6d, 0xbc,
+	0x6d, 0xbd, 0x6d, 0xbe, 0x6d, 0xc1, 0x6d, 0xc2, 0x6d, 0xc3, 0x6d, 0xc8,
+	0x6d, 0xc9, 0x6d, 0xca, 0x6d, 0xcd, 0x6d, 0xce, 0x6d, 0xcf, 0x6d, 0xd0,
+	0x6d, 0xd2, 0x6d, 0xd3, 0x6d, 0xd4, 0x6d, 0xd5, 0x6d, 0xd7, 0x6d, 0xda,
+	0x6d, 0xdb, 0x6d, 0xdc, 0x6d, 0xdf, 0x6d, 0xe2, 0x6d, 0xe3, 0x6d, 0xe5,
+	0x6d, 0xe7, 0x6d, 0xe8, 0x6d, 0xe9, 0x6d, 0xea, 0x6d, 0xed, 0x6d, 0xef,
+	0x6d, 0xf0, 0x6d, 0xf2, 0x6d, 0xf4, 0x6d, 0xf5, 0x6d, 0xf6, 0x6d, 0xf8,
+	0x6d, 0xfa, 0x6d, 0xfd, 0x6d, 0xfe, 0x6d, 0xff, 0x6e, 0x00, 0x6e, 0x01,
+	0x6e, 0x02, 0x6e, 0x03, 0x6e, 0x04, 0x6e, 0x06, 0x6e, 0x07, 0x6e, 0x08,
+	0x6e, 0x09, 0x6e, 0x0b, 0x6e, 0x0f, 0x6e, 0x12, 0x6e, 0x13, 0x6e, 0x15,
+	0x6e, 0x18, 0x6e, 0x19, 0x6e, 0x1b, 0x6e, 0x1c, 0x6e, 0x1e, 0x6e, 0x1f,
+	0x6e, 0x22, 0x6e, 0x26, 0x6e, 0x27, 0x6e, 0x28, 0x6e, 0x2a, 0x6e, 0x2c,
+	0x6e, 0x2e, 0x6e, 0x30, 0x6e, 0x31, 0x6e, 0x33, 0x6e, 0x35, 0x6e, 0x36,
+	0x6e, 0x37, 0x6e, 0x39, 0x6e, 0x3b, 0x6e, 0x3c, 0x6e, 0x3d, 0x6e, 0x3e,
+	0x6e, 0x3f, 0x6e, 0x40, 0x6e, 0x41, 0x6e, 0x42, 0x6e, 0x45, 0x6e, 0x46,
+	0x6e, 0x47, 0x6e, 0x48, 0x6e, 0x49, 0x6e, 0x4a, 0x6e, 0x4b, 0x6e, 0x4c,
+	0x6e, 0x4f, 0x6e, 0x50, 0x6e, 0x51, 0x6e, 0x52, 0x6e, 0x55, 0x6e, 0x57,
+	0x6e, 0x59, 0x6e, 0x5a, 0x6e, 0x5c, 0x6e, 0x5d, 0x6e, 0x5e, 0x6e, 0x60,
+	0x6e, 0x61, 0x6e, 0x62, 0x6e, 0x63, 0x6e, 0x64, 0x6e, 0x65, 0x6e, 0x66,
+	0x6e, 0x67, 0x6e, 0x68, 0x6e, 0x69, 0x6e, 0x6a, 0x6e, 0x6c, 0x6e, 0x6d,
+	0x6e, 0x6f, 0x6e, 0x70, 0x6e, 0x71, 0x6e, 0x72, 0x6e, 0x73, 0x6e, 0x74,
+	0x6e, 0x75, 0x6e, 0x76, 0x6e, 0x77, 0x6e, 0x78, 0x6e, 0x79, 0x6e, 0x7a,
+	0x6e, 0x7b, 0x6e, 0x7c, 0x6e, 0x7d, 0x6e, 0x80, 0x6e, 0x81, 0x6e, 0x82,
+	0x6e, 0x84, 0x6e, 0x87, 0x6e, 0x88, 0x6e, 0x8a, 0x6e, 0x8b, 0x6e, 0x8c,
+	0x6e, 0x8d, 0x6e, 0x8e, 0x6e, 0x91, 0x6e, 0x92, 0x6e, 0x93, 0x6e, 0x94,
+	0x6e, 0x95, 0x6e, 0x96, 0x6e, 0x97, 0x6e, 0x99, 0x6e, 0x9a, 0x6e, 0x9b,
+	0x6e, 0x9d, 0x6e, 0x9e, 0x6e, 0xa0, 0x6e, 0xa1, 0x6e, 0xa3, 0x6e, 0xa4,
+	0x6e, 0xa6, 0x6e, 0xa8, 0x6e, 0xa9, 0x6e, 0xab, 0x6e, 0xac, 0x6e, 0xad,
+	0x6e, 0xae, 0x6e, 0xb0, 0x6e, 0xb3, 0x6e, 0xb5, 0x6e, 0xb8, 0x6e, 0xb9,
+	0x6e, 0xbc, 0x6e, 0xbe, 0x6e, 0xbf, 0x6e, 0xc0, 0x6e, 0xc3, 0x6e, 0xc4,
+	0x6e, 0xc5, 0x6e, 0xc6, 0x6e, 0xc8, 0x6e, 0xc9, 0x6e, 0xca, 0x6e, 0xcc,
+	0x6e, 0xcd, 0x6e, 0xce, 0x6e, 0xd0, 0x6e, 0xd2, 0x6e, 0xd6, 0x6e, 0xd8,
+	0x6e, 0xd9, 0x6e, 0xdb, 0x6e, 0xdc, 0x6e, 0xdd, 0x6e, 0xe3, 0x6e, 0xe7,
+	0x6e, 0xea, 0x6e, 0xeb, 0x6e, 0xec, 0x6e, 0xed, 0x6e, 0xee, 0x6e, 0xef,
+	0x6e, 0xf0, 0x6e, 0xf1, 0x6e, 0xf2, 0x6e, 0xf3, 0x6e, 0xf5, 0x6e, 0xf6,
+	0x6e, 0xf7, 0x6e, 0xf8, 0x6e, 0xfa, 0x6e, 0xfb, 0x6e, 0xfc, 0x6e, 0xfd,
+	0x6e, 0xfe, 0x6e, 0xff, 0x6f, 0x00, 0x6f, 0x01, 0x6f, 0x03, 0x6f, 0x04,
+	0x6f, 0x05, 0x6f, 0x07, 0x6f, 0x08, 0x6f, 0x0a, 0x6f, 0x0b, 0x6f, 0x0c,
+	0x6f, 0x0d, 0x6f, 0x0e, 0x6f, 0x10, 0x6f, 0x11, 0x6f, 0x12, 0x6f, 0x16,
+	0x6f, 0x17, 0x6f, 0x18, 0x6f, 0x19, 0x6f, 0x1a, 0x6f, 0x1b, 0x6f, 0x1c,
+	0x6f, 0x1d, 0x6f, 0x1e, 0x6f, 0x1f, 0x6f, 0x21, 0x6f, 0x22, 0x6f, 0x23,
+	0x6f, 0x25, 0x6f, 0x26, 0x6f, 0x27, 0x6f, 0x28, 0x6f, 0x2c, 0x6f, 0x2e,
+	0x6f, 0x30, 0x6f, 0x32, 0x6f, 0x34, 0x6f, 0x35, 0x6f, 0x37, 0x6f, 0x38,
+	0x6f, 0x39, 0x6f, 0x3a, 0x6f, 0x3b, 0x6f, 0x3c, 0x6f, 0x3d, 0x6f, 0x3f,
+	0x6f, 0x40, 0x6f, 0x41, 0x6f, 0x42, 0x6f, 0x43, 0x6f, 0x44, 0x6f, 0x45,
+	0x6f, 0x48, 0x6f, 0x49, 0x6f, 0x4a, 0x6f, 0x4c, 0x6f, 0x4e, 0x6f, 0x4f,
+	0x6f, 0x50, 0x6f, 0x51, 0x6f, 0x52, 0x6f, 0x53, 0x6f, 0x54, 0x6f, 0x55,
+	0x6f, 0x56, 0x6f, 0x57, 0x6f, 0x59, 0x6f, 0x5a, 0x6f, 0x5b, 0x6f, 0x5d,
+	0x6f, 0x5f, 0x6f, 0x60, 0x6f, 0x61, 0x6f, 0x63, 0x6f, 0x64, 0x6f, 0x65,
+	0x6f, 0x67, 0x6f, 0x68, 0x6f, 0x69, 0x6f, 0x6a, 0x6f, 0x6b, 0x6f, 0x6c,
+	0x6f, 0x6f, 0x6f, 0x70, 0x6f, 0x71, 0x6f, 0x73, 0x6f, 0x75, 0x6f, 0x76,
+	0x6f, 0x77, 0x6f, 0x79, 0x6f, 0x7b, 0x6f, 0x7d, 0x6f, 0x7e, 0x6f, 0x7f,
+	0x6f, 0x80, 0x6f, 0x81, 0x6f, 0x82, 0x6f, 0x83, 0x6f, 0x85, 0x6f, 0x86,
+	0x6f, 0x87, 0x6f, 0x8a, 0x6f, 0x8b, 0x6f, 0x8f, 0x6f, 0x90, 0x6f, 0x91,
+	0x6f, 0x92, 0x6f, 0x93, 0x6f, 0x94, 0x6f, 0x95, 0x6f, 0x96, 0x6f, 0x97,
+	0x6f, 0x98, 0x6f, 0x99, 0x6f, 0x9a, 0x6f, 0x9b, 0x6f, 0x9d, 0x6f, 0x9e,
+	0x6f, 0x9f, 0x6f, 0xa0, 0x6f, 0xa2, 0x6f, 0xa3, 0x6f, 0xa4, 0x6f, 0xa5,
+	0x6f, 0xa6, 0x6f, 0xa8, 0x6f, 0xa9, 0x6f, 0xaa, 0x6f, 0xab, 0x6f, 0xac,
+	0x6f, 0xad, 0x6f, 0xae, 0x6f, 0xaf, 0x6f, 0xb0, 0x6f, 0xb1, 0x6f, 0xb2,
+	0x6f, 0xb4, 0x6f, 0xb5, 0x6f, 0xb7, 0x6f, 0xb8, 0x6f, 0xba, 0x6f, 0xbb,
+	0x6f, 0xbc, 0x6f, 0xbd, 0x6f, 0xbe, 0x6f, 0xbf, 0x6f, 0xc1, 0x6f, 0xc3,
+	0x6f, 0xc4, 0x6f, 0xc5, 0x6f, 0xc6, 0x6f, 0xc7, 0x6f, 0xc8, 0x6f, 0xca,
+	0x6f, 0xcb, 0x6f, 0xcc, 0x6f, 0xcd, 0x6f, 0xce, 0x6f, 0xcf, 0x6f, 0xd0,
+	0x6f, 0xd3, 0x6f, 0xd4, 0x6f, 0xd5, 0x6f, 0xd6, 0x6f, 0xd7, 0x6f, 0xd8,
+	0x6f, 0xd9, 0x6f, 0xda, 0x6f, 0xdb, 0x6f, 0xdc, 0x6f, 0xdd, 0x6f, 0xdf,
+	0x6f, 0xe2, 0x6f, 0xe3, 0x6f, 0xe4, 0x6f, 0xe5, 0x6f, 0xe6, 0x6f, 0xe7,
+	0x6f, 0xe8, 0x6f, 0xe9, 0x6f, 0xea, 0x6f, 0xeb, 0x6f, 0xec, 0x6f, 0xed,
+	0x6f, 0xf0, 0x6f, 0xf1, 0x6f, 0xf2, 0x6f, 0xf3, 0x6f, 0xf4, 0x6f, 0xf5,
+	0x6f, 0xf6, 0x6f, 0xf7, 0x6f, 0xf8, 0x6f, 0xf9, 0x6f, 0xfa, 0x6f, 0xfb,
+	0x6f, 0xfc, 0x6f, 0xfd, 0x6f, 0xfe, 0x6f, 0xff, 0x70, 0x00, 0x70, 0x01,
+	0x70, 0x02, 0x70, 0x03, 0x70, 0x04, 0x70, 0x05, 0x70, 0x06, 0x70, 0x07,
+	0x70, 0x08, 0x70, 0x09, 0x70, 0x0a, 0x70, 0x0b, 0x70, 0x0c, 0x70, 0x0d,
+	0x70, 0x0e, 0x70, 0x0f, 0x70, 0x10, 0x70, 0x12, 0x70, 0x13, 0x70, 0x14,
+	0x70, 0x15, 0x70, 0x16, 0x70, 0x17, 0x70, 0x18, 0x70, 0x19, 0x70, 0x1c,
+	0x70, 0x1d, 0x70, 0x1e, 0x70, 0x1f, 0x70, 0x20, 0x70, 0x21, 0x70, 0x22,
+	0x70, 0x24, 0x70, 0x25, 0x70, 0x26, 0x70, 0x27, 0x70, 0x28, 0x70, 0x29,
+	0x70, 0x2a, 0x70, 0x2b, 0x70, 0x2c, 0x70, 0x2d, 0x70, 0x2e, 0x70, 0x2f,
+	0x70, 0x30, 0x70, 0x31, 0x70, 0x32, 0x70, 0x33, 0x70, 0x34, 0x70, 0x36,
+	0x70, 0x37, 0x70, 0x38, 0x70, 0x3a, 0x70, 0x3b, 0x70, 0x3c, 0x70, 0x3d,
+	0x70, 0x3e, 0x70, 0x3f, 0x70, 0x40, 0x70, 0x41, 0x70, 0x42, 0x70, 0x43,
+	0x70, 0x44, 0x70, 0x45, 0x70, 0x46, 0x70, 0x47, 0x70, 0x48, 0x70, 0x49,
+	0x70, 0x4a, 0x70, 0x4b, 0x70, 0x4d, 0x70, 0x4e, 0x70, 0x50, 0x70, 0x51,
+	0x70, 0x52, 0x70, 0x53, 0x70, 0x54, 0x70, 0x55, 0x70, 0x56, 0x70, 0x57,
+	0x70, 0x58, 0x70, 0x59, 0x70, 0x5a, 0x70, 0x5b, 0x70, 0x5c, 0x70, 0x5d,
+	0x70, 0x5f, 0x70, 0x60, 0x70, 0x61, 0x70, 0x62, 0x70, 0x63, 0x70, 0x64,
+	0x70, 0x65, 0x70, 0x66, 0x70, 0x67, 0x70, 0x68, 0x70, 0x69, 0x70, 0x6a,
+	0x70, 0x6e, 0x70, 0x71, 0x70, 0x72, 0x70, 0x73, 0x70, 0x74, 0x70, 0x77,
+	0x70, 0x79, 0x70, 0x7a, 0x70, 0x7b, 0x70, 0x7d, 0x70, 0x81, 0x70, 0x82,
+	0x70, 0x83, 0x70, 0x84, 0x70, 0x86, 0x70, 0x87, 0x70, 0x88, 0x70, 0x8b,
+	0x70, 0x8c, 0x70, 0x8d, 0x70, 0x8f, 0x70, 0x90, 0x70, 0x91, 0x70, 0x93,
+	0x70, 0x97, 0x70, 0x98, 0x70, 0x9a, 0x70, 0x9b, 0x70, 0x9e, 0x70, 0x9f,
+	0x70, 0xa0, 0x70, 0xa1, 0x70, 0xa2, 0x70, 0xa3, 0x70, 0xa4, 0x70, 0xa5,
+	0x70, 0xa6, 0x70, 0xa7, 0x70, 0xa8, 0x70, 0xa9, 0x70, 0xaa, 0x70, 0xb0,
+	0x70, 0xb2, 0x70, 0xb4, 0x70, 0xb5, 0x70, 0xb6, 0x70, 0xba, 0x70, 0xbe,
+	0x70, 0xbf, 0x70, 0xc4, 0x70, 0xc5, 0x70, 0xc6, 0x70, 0xc7, 0x70, 0xc9,
+	0x70, 0xcb, 0x70, 0xcc, 0x70, 0xcd, 0x70, 0xce, 0x70, 0xcf, 0x70, 0xd0,
+	0x70, 0xd1, 0x70, 0xd2, 0x70, 0xd3, 0x70, 0xd4, 0x70, 0xd5, 0x70, 0xd6,
+	0x70, 0xd7, 0x70, 0xda, 0x70, 0xdc, 0x70, 0xdd, 0x70, 0xde, 0x70, 0xe0,
+	0x70, 0xe1, 0x70, 0xe2, 0x70, 0xe3, 0x70, 0xe5, 0x70, 0xea, 0x70, 0xee,
+	0x70, 0xf0, 0x70, 0xf1, 0x70, 0xf2, 0x70, 0xf3, 0x70, 0xf4, 0x70, 0xf5,
+	0x70, 0xf6, 0x70, 0xf8, 0x70, 0xfa, 0x70, 0xfb, 0x70, 0xfc, 0x70, 0xfe,
+	0x70, 0xff, 0x71, 0x00, 0x71, 0x01, 0x71, 0x02, 0x71, 0x03, 0x71, 0x04,
+	0x71, 0x05, 0x71, 0x06, 0x71, 0x07, 0x71, 0x08, 0x71, 0x0b, 0x71, 0x0c,
+	0x71, 0x0d, 0x71, 0x0e, 0x71, 0x0f, 0x71, 0x11, 0x71, 0x12, 0x71, 0x14,
+	0x71, 0x17, 0x71, 0x1b, 0x71, 0x1c, 0x71, 0x1d, 0x71, 0x1e, 0x71, 0x1f,
+	0x71, 0x20, 0x71, 0x21, 0x71, 0x22, 0x71, 0x23, 0x71, 0x24, 0x71, 0x25,
+	0x71, 0x27, 0x71, 0x28, 0x71, 0x29, 0x71, 0x2a, 0x71, 0x2b, 0x71, 0x2c,
+	0x71, 0x2d, 0x71, 0x2e, 0x71, 0x32, 0x71, 0x33, 0x71, 0x34, 0x71, 0x35,
+	0x71, 0x37, 0x71, 0x38, 0x71, 0x39, 0x71, 0x3a, 0x71, 0x3b, 0x71, 0x3c,
+	0x71, 0x3d, 0x71, 0x3e, 0x71, 0x3f, 0x71, 0x40, 0x71, 0x41, 0x71, 0x42,
+	0x71, 0x43, 0x71, 0x44, 0x71, 0x46, 0x71, 0x47, 0x71, 0x48, 0x71, 0x49,
+	0x71, 0x4b, 0x71, 0x4d, 0x71, 0x4f, 0x71, 0x50, 0x71, 0x51, 0x71, 0x52,
+	0x71, 0x53, 0x71, 0x54, 0x71, 0x55, 0x71, 0x56, 0x71, 0x57, 0x71, 0x58,
+	0x71, 0x59, 0x71, 0x5a, 0x71, 0x5b, 0x71, 0x5d, 0x71, 0x5f, 0x71, 0x60,
+	0x71, 0x61, 0x71, 0x62, 0x71, 0x63, 0x71, 0x65, 0x71, 0x69, 0x71, 0x6a,
+	0x71, 0x6b, 0x71, 0x6c, 0x71, 0x6d, 0x71, 0x6f, 0x71, 0x70, 0x71, 0x71,
+	0x71, 0x74, 0x71, 0x75, 0x71, 0x76, 0x71, 0x77, 0x71, 0x79, 0x71, 0x7b,
+	0x71, 0x7c, 0x71, 0x7e, 0x71, 0x7f, 0x71, 0x80, 0x71, 0x81, 0x71, 0x82,
+	0x71, 0x83, 0x71, 0x85, 0x71, 0x86, 0x71, 0x87, 0x71, 0x88, 0x71, 0x89,
+	0x71, 0x8b, 0x71, 0x8c, 0x71, 0x8d, 0x71, 0x8e, 0x71, 0x90, 0x71, 0x91,
+	0x71, 0x92, 0x71, 0x93, 0x71, 0x95, 0x71, 0x96, 0x71, 0x97, 0x71, 0x9a,
+	0x71, 0x9b, 0x71, 0x9c, 0x71, 0x9d, 0x71, 0x9e, 0x71, 0xa1, 0x71, 0xa2,
+	0x71, 0xa3, 0x71, 0xa4, 0x71, 0xa5, 0x71, 0xa6, 0x71, 0xa7, 0x71, 0xa9,
+	0x71, 0xaa, 0x71, 0xab, 0x71, 0xad, 0x71, 0xae, 0x71, 0xaf, 0x71, 0xb0,
+	0x71, 0xb1, 0x71, 0xb2, 0x71, 0xb4, 0x71, 0xb6, 0x71, 0xb7, 0x71, 0xb8,
+	0x71, 0xba, 0x71, 0xbb, 0x71, 0xbc, 0x71, 0xbd, 0x71, 0xbe, 0x71, 0xbf,
+	0x71, 0xc0, 0x71, 0xc1, 0x71, 0xc2, 0x71, 0xc4, 0x71, 0xc5, 0x71, 0xc6,
+	0x71, 0xc7, 0x71, 0xc8, 0x71, 0xc9, 0x71, 0xca, 0x71, 0xcb, 0x71, 0xcc,
+	0x71, 0xcd, 0x71, 0xcf, 0x71, 0xd0, 0x71, 0xd1, 0x71, 0xd2, 0x71, 0xd3,
+	0x71, 0xd6, 0x71, 0xd7, 0x71, 0xd8, 0x71, 0xd9, 0x71, 0xda, 0x71, 0xdb,
+	0x71, 0xdc, 0x71, 0xdd, 0x71, 0xde, 0x71, 0xdf, 0x71, 0xe1, 0x71, 0xe2,
+	0x71, 0xe3, 0x71, 0xe4, 0x71, 0xe6, 0x71, 0xe8, 0x71, 0xe9, 0x71, 0xea,
+	0x71, 0xeb, 0x71, 0xec, 0x71, 0xed, 0x71, 0xef, 0x71, 0xf0, 0x71, 0xf1,
+	0x71, 0xf2, 0x71, 0xf3, 0x71, 0xf4, 0x71, 0xf5, 0x71, 0xf6, 0x71, 0xf7,
+	0x71, 0xf8, 0x71, 0xfa, 0x71, 0xfb, 0x71, 0xfc, 0x71, 0xfd, 0x71, 0xfe,
+	0x71, 0xff, 0x72, 0x00, 0x72, 0x01, 0x72, 0x02, 0x72, 0x03, 0x72, 0x04,
+	0x72, 0x05, 0x72, 0x07, 0x72, 0x08, 0x72, 0x09, 0x72, 0x0a, 0x72, 0x0b,
+	0x72, 0x0c, 0x72, 0x0d, 0x72, 0x0e, 0x72, 0x0f, 0x72, 0x10, 0x72, 0x11,
+	0x72, 0x12, 0x72, 0x13, 0x72, 0x14, 0x72, 0x15, 0x72, 0x16, 0x72, 0x17,
+	0x72, 0x18, 0x72, 0x19, 0x72, 0x1a, 0x72, 0x1b, 0x72, 0x1c, 0x72, 0x1e,
+	0x72, 0x1f, 0x72, 0x20, 0x72, 0x21, 0x72, 0x22, 0x72, 0x23, 0x72, 0x24,
+	0x72, 0x25, 0x72, 0x26, 0x72, 0x27, 0x72, 0x29, 0x72, 0x2b, 0x72, 0x2d,
+	0x72, 0x2e, 0x72, 0x2f, 0x72, 0x32, 0x72, 0x33, 0x72, 0x34, 0x72, 0x3a,
+	0x72, 0x3c, 0x72, 0x3e, 0x72, 0x40, 0x72, 0x41, 0x72, 0x42, 0x72, 0x43,
+	0x72, 0x44, 0x72, 0x45, 0x72, 0x46, 0x72, 0x49, 0x72, 0x4a, 0x72, 0x4b,
+	0x72, 0x4e, 0x72, 0x4f, 0x72, 0x50, 0x72, 0x51, 0x72, 0x53, 0x72, 0x54,
+	0x72, 0x55, 0x72, 0x57, 0x72, 0x58, 0x72, 0x5a, 0x72, 0x5c, 0x72, 0x5e,
+	0x72, 0x60, 0x72, 0x63, 0x72, 0x64, 0x72, 0x65, 0x72, 0x68, 0x72, 0x6a,
+	0x72, 0x6b, 0x72, 0x6c, 0x72, 0x6d, 0x72, 0x70, 0x72, 0x71, 0x72, 0x73,
+	0x72, 0x74, 0x72, 0x76, 0x72, 0x77, 0x72, 0x78, 0x72, 0x7b, 0x72, 0x7c,
+	0x72, 0x7d, 0x72, 0x82, 0x72, 0x83, 0x72, 0x85, 0x72, 0x86, 0x72, 0x87,
+	0x72, 0x88, 0x72, 0x89, 0x72, 0x8c, 0x72, 0x8e, 0x72, 0x90, 0x72, 0x91,
+	0x72, 0x93, 0x72, 0x94, 0x72, 0x95, 0x72, 0x96, 0x72, 0x97, 0x72, 0x98,
+	0x72, 0x99, 0x72, 0x9a, 0x72, 0x9b, 0x72, 0x9c, 0x72, 0x9d, 0x72, 0x9e,
+	0x72, 0xa0, 0x72, 0xa1, 0x72, 0xa2, 0x72, 0xa3, 0x72, 0xa4, 0x72, 0xa5,
+	0x72, 0xa6, 0x72, 0xa7, 0x72, 0xa8, 0x72, 0xa9, 0x72, 0xaa, 0x72, 0xab,
+	0x72, 0xae, 0x72, 0xb1, 0x72, 0xb2, 0x72, 0xb3, 0x72, 0xb5, 0x72, 0xba,
+	0x72, 0xbb, 0x72, 0xbc, 0x72, 0xbd, 0x72, 0xbe, 0x72, 0xbf, 0x72, 0xc0,
+	0x72, 0xc5, 0x72, 0xc6, 0x72, 0xc7, 0x72, 0xc9, 0x72, 0xca, 0x72, 0xcb,
+	0x72, 0xcc, 0x72, 0xcf, 0x72, 0xd1, 0x72, 0xd3, 0x72, 0xd4, 0x72, 0xd5,
+	0x72, 0xd6, 0x72, 0xd8, 0x72, 0xda, 0x72, 0xdb, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x00, 0x30, 0x01,
+	0x30, 0x02, 0x00, 0xb7, 0x02, 0xc9, 0x02, 0xc7, 0x00, 0xa8, 0x30, 0x03,
+	0x30, 0x05, 0x20, 0x14, 0xff, 0x5e, 0x20, 0x16, 0x20, 0x26, 0x20, 0x18,
+	0x20, 0x19, 0x20, 0x1c, 0x20, 0x1d, 0x30, 0x14, 0x30, 0x15, 0x30, 0x08,
+	0x30, 0x09, 0x30, 0x0a, 0x30, 0x0b, 0x30, 0x0c, 0x30, 0x0d, 0x30, 0x0e,
+	0x30, 0x0f, 0x30, 0x16, 0x30, 0x17, 0x30, 0x10, 0x30, 0x11, 0x00, 0xb1,
+	0x00, 0xd7, 0x00, 0xf7, 0x22, 0x36, 0x22, 0x27, 0x22, 0x28, 0x22, 0x11,
+	0x22, 0x0f, 0x22, 0x2a, 0x22, 0x29, 0x22, 0x08, 0x22, 0x37, 0x22, 0x1a,
+	0x22, 0xa5, 0x22, 0x25, 0x22, 0x20, 0x23, 0x12, 0x22, 0x99, 0x22, 0x2b,
+	0x22, 0x2e, 0x22, 0x61, 0x22, 0x4c, 0x22, 0x48, 0x22, 0x3d, 0x22, 0x1d,
+	0x22, 0x60, 0x22, 0x6e, 0x22, 0x6f, 0x22, 0x64, 0x22, 0x65, 0x22, 0x1e,
+	0x22, 0x35, 0x22, 0x34, 0x26, 0x42, 0x26, 0x40, 0x00, 0xb0, 0x20, 0x32,
+	0x20, 0x33, 0x21, 0x03, 0xff, 0x04, 0x00, 0xa4, 0xff, 0xe0, 0xff, 0xe1,
+	0x20, 0x30, 0x00, 0xa7, 0x21, 0x16, 0x26, 0x06, 0x26, 0x05, 0x25, 0xcb,
+	0x25, 0xcf, 0x25, 0xce, 0x25, 0xc7, 0x25, 0xc6, 0x25, 0xa1, 0x25, 0xa0,
+	0x25, 0xb3, 0x25, 0xb2, 0x20, 0x3b, 0x21, 0x92, 0x21, 0x90, 0x21, 0x91,
+	0x21, 0x93, 0x30, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x21, 0x70, 0x21, 0x71, 0x21, 0x72, 0x21, 0x73,
+	0x21, 0x74, 0x21, 0x75, 0x21, 0x76, 0x21, 0x77, 0x21, 0x78, 0x21, 0x79,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x24, 0x88, 0x24, 0x89, 0x24, 0x8a, 0x24, 0x8b, 0x24, 0x8c, 0x24, 0x8d,
+	0x24, 0x8e, 0x24, 0x8f, 0x24, 0x90, 0x24, 0x91, 0x24, 0x92, 0x24, 0x93,
+	0x24, 0x94, 0x24, 0x95, 0x24, 0x96, 0x24, 0x97, 0x24, 0x98, 0x24, 0x99,
+	0x24, 0x9a, 0x24, 0x9b, 0x24, 0x74, 0x24, 0x75, 0x24, 0x76, 0x24, 0x77,
+	0x24, 0x78, 0x24, 0x79, 0x24, 0x7a, 0x24, 0x7b, 0x24, 0x7c, 0x24, 0x7d,
+	0x24, 0x7e, 0x24, 0x7f, 0x24, 0x80, 0x24, 0x81, 0x24, 0x82, 0x24, 0x83,
+	0x24, 0x84, 0x24, 0x85, 0x24, 0x86, 0x24, 0x87, 0x24, 0x60, 0x24, 0x61,
+	0x24, 0x62, 0x24, 0x63, 0x24, 0x64, 0x24, 0x65, 0x24, 0x66, 0x24, 0x67,
+	0x24, 0x68, 0x24, 0x69, 0xff, 0xff, 0xff, 0xff, 0x32, 0x20, 0x32, 0x21,
+	0x32, 0x22, 0x32, 0x23, 0x32, 0x24, 0x32, 0x25, 0x32, 0x26, 0x32, 0x27,
+	0x32, 0x28, 0x32, 0x29, 0xff, 0xff, 0xff, 0xff, 0x21, 0x60, 0x21, 0x61,
+	0x21, 0x62, 0x21, 0x63, 0x21, 0x64, 0x21, 0x65, 0x21, 0x66, 0x21, 0x67,
+	0x21, 0x68, 0x21, 0x69, 0x21, 0x6a, 0x21, 0x6b, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x01, 0xff, 0x02, 0xff, 0x03, 0xff, 0xe5, 0xff, 0x05, 0xff, 0x06,
+	0xff, 0x07, 0xff, 0x08, 0xff, 0x09, 0xff, 0x0a, 0xff, 0x0b, 0xff, 0x0c,
+	0xff, 0x0d, 0xff, 0x0e, 0xff, 0x0f, 0xff, 0x10, 0xff, 0x11, 0xff, 0x12,
+	0xff, 0x13, 0xff, 0x14, 0xff, 0x15, 0xff, 0x16, 0xff, 0x17, 0xff, 0x18,
+	0xff, 0x19, 0xff, 0x1a, 0xff, 0x1b, 0xff, 0x1c, 0xff, 0x1d, 0xff, 0x1e,
+	0xff, 0x1f, 0xff, 0x20, 0xff, 0x21, 0xff, 0x22, 0xff, 0x23, 0xff, 0x24,
+	0xff, 0x25, 0xff, 0x26, 0xff, 0x27, 0xff, 0x28, 0xff, 0x29, 0xff, 0x2a,
+	0xff, 0x2b, 0xff, 0x2c, 0xff, 0x2d, 0xff, 0x2e, 0xff, 0x2f, 0xff, 0x30,
+	0xff, 0x31, 0xff, 0x32, 0xff, 0x33, 0xff, 0x34, 0xff, 0x35, 0xff, 0x36,
+	0xff, 0x37, 0xff, 0x38, 0xff, 0x39, 0xff, 0x3a, 0xff, 0x3b, 0xff, 0x3c,
+	0xff, 0x3d, 0xff, 0x3e, 0xff, 0x3f, 0xff, 0x40, 0xff, 0x41, 0xff, 0x42,
+	0xff, 0x43, 0xff, 0x44, 0xff, 0x45, 0xff, 0x46, 0xff, 0x47, 0xff, 0x48,
+	0xff, 0x49, 0xff, 0x4a, 0xff, 0x4b, 0xff, 0x4c, 0xff, 0x4d, 0xff, 0x4e,
+	0xff, 0x4f, 0xff, 0x50, 0xff, 0x51, 0xff, 0x52, 0xff, 0x53, 0xff, 0x54,
+	0xff, 0x55, 0xff, 0x56, 0xff, 0x57, 0xff, 0x58, 0xff, 0x59, 0xff, 0x5a,
+	0xff, 0x5b, 0xff, 0x5c, 0xff, 0x5d, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x41, 0x30, 0x42,
+	0x30, 0x43, 0x30, 0x44, 0x30, 0x45, 0x30, 0x46, 0x30, 0x47, 0x30, 0x48,
+	0x30, 0x49, 0x30, 0x4a, 0x30, 0x4b, 0x30, 0x4c, 0x30, 0x4d, 0x30, 0x4e,
+	0x30, 0x4f, 0x30, 0x50, 0x30, 0x51, 0x30, 0x52, 0x30, 0x53, 0x30, 0x54,
+	0x30, 0x55, 0x30, 0x56, 0x30, 0x57, 0x30, 0x58, 0x30, 0x59, 0x30, 0x5a,
+	0x30, 0x5b, 0x30, 0x5c, 0x30, 0x5d, 0x30, 0x5e, 0x30, 0x5f, 0x30, 0x60,
+	0x30, 0x61, 0x30, 0x62, 0x30, 0x63, 0x30, 0x64, 0x30, 0x65, 0x30, 0x66,
+	0x30, 0x67, 0x30, 0x68, 0x30, 0x69, 0x30, 0x6a, 0x30, 0x6b, 0x30, 0x6c,
+	0x30, 0x6d, 0x30, 0x6e, 0x30, 0x6f, 0x30, 0x70, 0x30, 0x71, 0x30, 0x72,
+	0x30, 0x73, 0x30, 0x74, 0x30, 0x75, 0x30, 0x76, 0x30, 0x77, 0x30, 0x78,
+	0x30, 0x79, 0x30, 0x7a, 0x30, 0x7b, 0x30, 0x7c, 0x30, 0x7d, 0x30, 0x7e,
+	0x30, 0x7f, 0x30, 0x80, 0x30, 0x81, 0x30, 0x82, 0x30, 0x83, 0x30, 0x84,
+	0x30, 0x85, 0x30, 0x86, 0x30, 0x87, 0x30, 0x88, 0x30, 0x89, 0x30, 0x8a,
+	0x30, 0x8b, 0x30, 0x8c, 0x30, 0x8d, 0x30, 0x8e, 0x30, 0x8f, 0x30, 0x90,
+	0x30, 0x91, 0x30, 0x92, 0x30, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x30, 0xa1, 0x30, 0xa2, 0x30, 0xa3, 0x30, 0xa4,
+	0x30, 0xa5, 0x30, 0xa6, 0x30, 0xa7, 0x30, 0xa8, 0x30, 0xa9, 0x30, 0xaa,
+	0x30, 0xab, 0x30, 0xac, 0x30, 0xad, 0x30, 0xae, 0x30, 0xaf, 0x30, 0xb0,
+	0x30, 0xb1, 0x30, 0xb2, 0x30, 0xb3, 0x30, 0xb4, 0x30, 0xb5, 0x30, 0xb6,
+	0x30, 0xb7, 0x30, 0xb8, 0x30, 0xb9, 0x30, 0xba, 0x30, 0xbb, 0x30, 0xbc,
+	0x30, 0xbd, 0x30, 0xbe, 0x30, 0xbf, 0x30, 0xc0, 0x30, 0xc1, 0x30, 0xc2,
+	0x30, 0xc3, 0x30, 0xc4, 0x30, 0xc5, 0x30, 0xc6, 0x30, 0xc7, 0x30, 0xc8,
+	0x30, 0xc9, 0x30, 0xca, 0x30, 0xcb, 0x30, 0xcc, 0x30, 0xcd, 0x30, 0xce,
+	0x30, 0xcf, 0x30, 0xd0, 0x30, 0xd1, 0x30, 0xd2, 0x30, 0xd3, 0x30, 0xd4,
+	0x30, 0xd5, 0x30, 0xd6, 0x30, 0xd7, 0x30, 0xd8, 0x30, 0xd9, 0x30, 0xda,
+	0x30, 0xdb, 0x30, 0xdc, 0x30, 0xdd, 0x30, 0xde, 0x30, 0xdf, 0x30, 0xe0,
+	0x30, 0xe1, 0x30, 0xe2, 0x30, 0xe3, 0x30, 0xe4, 0x30, 0xe5, 0x30, 0xe6,
+	0x30, 0xe7, 0x30, 0xe8, 0x30, 0xe9, 0x30, 0xea, 0x30, 0xeb, 0x30, 0xec,
+	0x30, 0xed, 0x30, 0xee, 0x30, 0xef, 0x30, 0xf0, 0x30, 0xf1, 0x30, 0xf2,
+	0x30, 0xf3, 0x30, 0xf4, 0x30, 0xf5, 0x30, 0xf6, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x03, 0x91, 0x03, 0x92, 0x03, 0x93, 0x03, 0x94, 0x03, 0x95, 0x03, 0x96,
+	0x03, 0x97, 0x03, 0x98, 0x03, 0x99, 0x03, 0x9a, 0x03, 0x9b, 0x03, 0x9c,
+	0x03, 0x9d, 0x03, 0x9e, 0x03, 0x9f, 0x03, 0xa0, 0x03, 0xa1, 0x03, 0xa3,
+	0x03, 0xa4, 0x03, 0xa5, 0x03, 0xa6, 0x03, 0xa7, 0x03, 0xa8, 0x03, 0xa9,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x03, 0xb1, 0x03, 0xb2, 0x03, 0xb3, 0x03, 0xb4,
+	0x03, 0xb5, 0x03, 0xb6, 0x03, 0xb7, 0x03, 0xb8, 0x03, 0xb9, 0x03, 0xba,
+	0x03, 0xbb, 0x03, 0xbc, 0x03, 0xbd, 0x03, 0xbe, 0x03, 0xbf, 0x03, 0xc0,
+	0x03, 0xc1, 0x03, 0xc3, 0x03, 0xc4, 0x03, 0xc5, 0x03, 0xc6, 0x03, 0xc7,
+	0x03, 0xc8, 0x03, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x35, 0xfe, 0x36, 0xfe, 0x39,
+	0xfe, 0x3a, 0xfe, 0x3f, 0xfe, 0x40, 0xfe, 0x3d, 0xfe, 0x3e, 0xfe, 0x41,
+	0xfe, 0x42, 0xfe, 0x43, 0xfe, 0x44, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3b,
+	0xfe, 0x3c, 0xfe, 0x37, 0xfe, 0x38, 0xfe, 0x31, 0xff, 0xff, 0xfe, 0x33,
+	0xfe, 0x34, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04, 0x10, 0x04, 0x11,
+	0x04, 0x12, 0x04, 0x13, 0x04, 0x14, 0x04, 0x15, 0x04, 0x01, 0x04, 0x16,
+	0x04, 0x17, 0x04, 0x18, 0x04, 0x19, 0x04, 0x1a, 0x04, 0x1b, 0x04, 0x1c,
+	0x04, 0x1d, 0x04, 0x1e, 0x04, 0x1f, 0x04, 0x20, 0x04, 0x21, 0x04, 0x22,
+	0x04, 0x23, 0x04, 0x24, 0x04, 0x25, 0x04, 0x26, 0x04, 0x27, 0x04, 0x28,
+	0x04, 0x29, 0x04, 0x2a, 0x04, 0x2b, 0x04, 0x2c, 0x04, 0x2d, 0x04, 0x2e,
+	0x04, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04, 0x30, 0x04, 0x31,
+	0x04, 0x32, 0x04, 0x33, 0x04, 0x34, 0x04, 0x35, 0x04, 0x51, 0x04, 0x36,
+	0x04, 0x37, 0x04, 0x38, 0x04, 0x39, 0x04, 0x3a, 0x04, 0x3b, 0x04, 0x3c,
+	0x04, 0x3d, 0x04, 0x3e, 0x04, 0x3f, 0x04, 0x40, 0x04, 0x41, 0x04, 0x42,
+	0x04, 0x43, 0x04, 0x44, 0x04, 0x45, 0x04, 0x46, 0x04, 0x47, 0x04, 0x48,
+	0x04, 0x49, 0x04, 0x4a, 0x04, 0x4b, 0x04, 0x4c, 0x04, 0x4d, 0x04, 0x4e,
+	0x04, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x02, 0xca, 0x02, 0xcb, 0x02, 0xd9, 0x20, 0x13,
+	0x20, 0x15, 0x20, 0x25, 0x20, 0x35, 0x21, 0x05, 0x21, 0x09, 0x21, 0x96,
+	0x21, 0x97, 0x21, 0x98, 0x21, 0x99, 0x22, 0x15, 0x22, 0x1f, 0x22, 0x23,
+	0x22, 0x52, 0x22, 0x66, 0x22, 0x67, 0x22, 0xbf, 0x25, 0x50, 0x25, 0x51,
+	0x25, 0x52, 0x25, 0x53, 0x25, 0x54, 0x25, 0x55, 0x25, 0x56, 0x25, 0x57,
+	0x25, 0x58, 0x25, 0x59, 0x25, 0x5a, 0x25, 0x5b, 0x25, 0x5c, 0x25, 0x5d,
+	0x25, 0x5e, 0x25, 0x5f, 0x25, 0x60, 0x25, 0x61, 0x25, 0x62, 0x25, 0x63,
+	0x25, 0x64, 0x25, 0x65, 0x25, 0x66, 0x25, 0x67, 0x25, 0x68, 0x25, 0x69,
+	0x25, 0x6a, 0x25, 0x6b, 0x25, 0x6c, 0x25, 0x6d, 0x25, 0x6e, 0x25, 0x6f,
+	0x25, 0x70, 0x25, 0x71, 0x25, 0x72, 0x25, 0x73, 0x25, 0x81, 0x25, 0x82,
+	0x25, 0x83, 0x25, 0x84, 0x25, 0x85, 0x25, 0x86, 0x25, 0x87, 0x25, 0x88,
+	0x25, 0x89, 0x25, 0x8a, 0x25, 0x8b, 0x25, 0x8c, 0x25, 0x8d, 0x25, 0x8e,
+	0x25, 0x8f, 0x25, 0x93, 0x25, 0x94, 0x25, 0x95, 0x25, 0xbc, 0x25, 0xbd,
+	0x25, 0xe2, 0x25, 0xe3, 0x25, 0xe4, 0x25, 0xe5, 0x26, 0x09, 0x22, 0x95,
+	0x30, 0x12, 0x30, 0x1d, 0x30, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x01, 0x01, 0x00, 0xe1, 0x01, 0xce, 0x00, 0xe0,
+	0x01, 0x13, 0x00, 0xe9, 0x01, 0x1b, 0x00, 0xe8, 0x01, 0x2b, 0x00, 0xed,
+	0x01, 0xd0, 0x00, 0xec, 0x01, 0x4d, 0x00, 0xf3, 0x01, 0xd2, 0x00, 0xf2,
+	0x01, 0x6b, 0x00, 0xfa, 0x01, 0xd4, 0x00, 0xf9, 0x01, 0xd6, 0x01, 0xd8,
+	0x01, 0xda, 0x01, 0xdc, 0x00, 0xfc, 0x00, 0xea, 0x02, 0x51, 0xff, 0xff,
+	0x01, 0x44, 0x01, 0x48, 0xff, 0xff, 0x02, 0x61, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x31, 0x05, 0x31, 0x06, 0x31, 0x07, 0x31, 0x08,
+	0x31, 0x09, 0x31, 0x0a, 0x31, 0x0b, 0x31, 0x0c, 0x31, 0x0d, 0x31, 0x0e,
+	0x31, 0x0f, 0x31, 0x10, 0x31, 0x11, 0x31, 0x12, 0x31, 0x13, 0x31, 0x14,
+	0x31, 0x15, 0x31, 0x16, 0x31, 0x17, 0x31, 0x18, 0x31, 0x19, 0x31, 0x1a,
+	0x31, 0x1b, 0x31, 0x1c, 0x31, 0x1d, 0x31, 0x1e, 0x31, 0x1f, 0x31, 0x20,
+	0x31, 0x21, 0x31, 0x22, 0x31, 0x23, 0x31, 0x24, 0x31, 0x25, 0x31, 0x26,
+	0x31, 0x27, 0x31, 0x28, 0x31, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x30, 0x21, 0x30, 0x22, 0x30, 0x23, 0x30, 0x24, 0x30, 0x25, 0x30, 0x26,
+	0x30, 0x27, 0x30, 0x28, 0x30, 0x29, 0x32, 0xa3, 0x33, 0x8e, 0x33, 0x8f,
+	0x33, 0x9c, 0x33, 0x9d, 0x33, 0x9e, 0x33, 0xa1, 0x33, 0xc4, 0x33, 0xce,
+	0x33, 0xd1, 0x33, 0xd2, 0x33, 0xd5, 0xfe, 0x30, 0xff, 0xe2, 0xff, 0xe4,
+	0xff, 0xff, 0x21, 0x21, 0x32, 0x31, 0xff, 0xff, 0x20, 0x10, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x30, 0xfc, 0x30, 0x9b, 0x30, 0x9c, 0x30, 0xfd,
+	0x30, 0xfe, 0x30, 0x06, 0x30, 0x9d, 0x30, 0x9e, 0xfe, 0x49, 0xfe, 0x4a,
+	0xfe, 0x4b, 0xfe, 0x4c, 0xfe, 0x4d, 0xfe, 0x4e, 0xfe, 0x4f, 0xfe, 0x50,
+	0xfe, 0x51, 0xfe, 0x52, 0xfe, 0x54, 0xfe, 0x55, 0xfe, 0x56, 0xfe, 0x57,
+	0xfe, 0x59, 0xfe, 0x5a, 0xfe, 0x5b, 0xfe, 0x5c, 0xfe, 0x5d, 0xfe, 0x5e,
+	0xfe, 0x5f, 0xfe, 0x60, 0xfe, 0x61, 0xfe, 0x62, 0xfe, 0x63, 0xfe, 0x64,
+	0xfe, 0x65, 0xfe, 0x66, 0xfe, 0x68, 0xfe, 0x69, 0xfe, 0x6a, 0xfe, 0x6b,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x30, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0x00, 0x25, 0x01, 0x25, 0x02,
+	0x25, 0x03, 0x25, 0x04, 0x25, 0x05, 0x25, 0x06, 0x25, 0x07, 0x25, 0x08,
+	0x25, 0x09, 0x25, 0x0a, 0x25, 0x0b, 0x25, 0x0c, 0x25, 0x0d, 0x25, 0x0e,
+	0x25, 0x0f, 0x25, 0x10, 0x25, 0x11, 0x25, 0x12, 0x25, 0x13, 0x25, 0x14,
+	0x25, 0x15, 0x25, 0x16, 0x25, 0x17, 0x25, 0x18, 0x25, 0x19, 0x25, 0x1a,
+	0x25, 0x1b, 0x25, 0x1c, 0x25, 0x1d, 0x25, 0x1e, 0x25, 0x1f, 0x25, 0x20,
+	0x25, 0x21, 0x25, 0x22, 0x25, 0x23, 0x25, 0x24, 0x25, 0x25, 0x25, 0x26,
+	0x25, 0x27, 0x25, 0x28, 0x25, 0x29, 0x25, 0x2a, 0x25, 0x2b, 0x25, 0x2c,
+	0x25, 0x2d, 0x25, 0x2e, 0x25, 0x2f, 0x25, 0x30, 0x25, 0x31, 0x25, 0x32,
+	0x25, 0x33, 0x25, 0x34, 0x25, 0x35, 0x25, 0x36, 0x25, 0x37, 0x25, 0x38,
+	0x25, 0x39, 0x25, 0x3a, 0x25, 0x3b, 0x25, 0x3c, 0x25, 0x3d, 0x25, 0x3e,
+	0x25, 0x3f, 0x25, 0x40, 0x25, 0x41, 0x25, 0x42, 0x25, 0x43, 0x25, 0x44,
+	0x25, 0x45, 0x25, 0x46, 0x25, 0x47, 0x25, 0x48, 0x25, 0x49, 0x25, 0x4a,
+	0x25, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xdc, 0x72, 0xdd,
+	0x72, 0xdf, 0x72, 0xe2, 0x72, 0xe3, 0x72, 0xe4, 0x72, 0xe5, 0x72, 0xe6,
+	0x72, 0xe7, 0x72, 0xea, 0x72, 0xeb, 0x72, 0xf5, 0x72, 0xf6, 0x72, 0xf9,
+	0x72, 0xfd, 0x72, 0xfe, 0x72, 0xff, 0x73, 0x00, 0x73, 0x02, 0x73, 0x04,
+	0x73, 0x05, 0x73, 0x06, 0x73, 0x07, 0x73, 0x08, 0x73, 0x09, 0x73, 0x0b,
+	0x73, 0x0c, 0x73, 0x0d, 0x73, 0x0f, 0x73, 0x10, 0x73, 0x11, 0x73, 0x12,
+	0x73, 0x14, 0x73, 0x18, 0x73, 0x19, 0x73, 0x1a, 0x73, 0x1f, 0x73, 0x20,
+	0x73, 0x23, 0x73, 0x24, 0x73, 0x26, 0x73, 0x27, 0x73, 0x28, 0x73, 0x2d,
+	0x73, 0x2f, 0x73, 0x30, 0x73, 0x32, 0x73, 0x33, 0x73, 0x35, 0x73, 0x36,
+	0x73, 0x3a, 0x73, 0x3b, 0x73, 0x3c, 0x73, 0x3d, 0x73, 0x40, 0x73, 0x41,
+	0x73, 0x42, 0x73, 0x43, 0x73, 0x44, 0x73, 0x45, 0x73, 0x46, 0x73, 0x47,
+	0x73, 0x48, 0x73, 0x49, 0x73, 0x4a, 0x73, 0x4b, 0x73, 0x4c, 0x73, 0x4e,
+	0x73, 0x4f, 0x73, 0x51, 0x73, 0x53, 0x73, 0x54, 0x73, 0x55, 0x73, 0x56,
+	0x73, 0x58, 0x73, 0x59, 0x73, 0x5a, 0x73, 0x5b, 0x73, 0x5c, 0x73, 0x5d,
+	0x73, 0x5e, 0x73, 0x5f, 0x73, 0x61, 0x73, 0x62, 0x73, 0x63, 0x73, 0x64,
+	0x73, 0x65, 0x73, 0x66, 0x73, 0x67, 0x73, 0x68, 0x73, 0x69, 0x73, 0x6a,
+	0x73, 0x6b, 0x73, 0x6e, 0x73, 0x70, 0x73, 0x71, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x73, 0x72, 0x73, 0x73, 0x73, 0x74, 0x73, 0x75,
+	0x73, 0x76, 0x73, 0x77, 0x73, 0x78, 0x73, 0x79, 0x73, 0x7a, 0x73, 0x7b,
+	0x73, 0x7c, 0x73, 0x7d, 0x73, 0x7f, 0x73, 0x80, 0x73, 0x81, 0x73, 0x82,
+	0x73, 0x83, 0x73, 0x85, 0x73, 0x86, 0x73, 0x88, 0x73, 0x8a, 0x73, 0x8c,
+	0x73, 0x8d, 0x73, 0x8f, 0x73, 0x90, 0x73, 0x92, 0x73, 0x93, 0x73, 0x94,
+	0x73, 0x95, 0x73, 0x97, 0x73, 0x98, 0x73, 0x99, 0x73, 0x9a, 0x73, 0x9c,
+	0x73, 0x9d, 0x73, 0x9e, 0x73, 0xa0, 0x73, 0xa1, 0x73, 0xa3, 0x73, 0xa4,
+	0x73, 0xa5, 0x73, 0xa6, 0x73, 0xa7, 0x73, 0xa8, 0x73, 0xaa, 0x73, 0xac,
+	0x73, 0xad, 0x73, 0xb1, 0x73, 0xb4, 0x73, 0xb5, 0x73, 0xb6, 0x73, 0xb8,
+	0x73, 0xb9, 0x73, 0xbc, 0x73, 0xbd, 0x73, 0xbe, 0x73, 0xbf, 0x73, 0xc1,
+	0x73, 0xc3, 0x73, 0xc4, 0x73, 0xc5, 0x73, 0xc6, 0x73, 0xc7, 0x73, 0xcb,
+	0x73, 0xcc, 0x73, 0xce, 0x73, 0xd2, 0x73, 0xd3, 0x73, 0xd4, 0x73, 0xd5,
+	0x73, 0xd6, 0x73, 0xd7, 0x73, 0xd8, 0x73, 0xda, 0x73, 0xdb, 0x73, 0xdc,
+	0x73, 0xdd, 0x73, 0xdf, 0x73, 0xe1, 0x73, 0xe2, 0x73, 0xe3, 0x73, 0xe4,
+	0x73, 0xe6, 0x73, 0xe8, 0x73, 0xea, 0x73, 0xeb, 0x73, 0xec, 0x73, 0xee,
+	0x73, 0xef, 0x73, 0xf0, 0x73, 0xf1, 0x73, 0xf3, 0x73, 0xf4, 0x73, 0xf5,
+	0x73, 0xf6, 0x73, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x73, 0xf8, 0x73, 0xf9, 0x73, 0xfa, 0x73, 0xfb, 0x73, 0xfc, 0x73, 0xfd,
+	0x73, 0xfe, 0x73, 0xff, 0x74, 0x00, 0x74, 0x01, 0x74, 0x02, 0x74, 0x04,
+	0x74, 0x07, 0x74, 0x08, 0x74, 0x0b, 0x74, 0x0c, 0x74, 0x0d, 0x74, 0x0e,
+	0x74, 0x11, 0x74, 0x12, 0x74, 0x13, 0x74, 0x14, 0x74, 0x15, 0x74, 0x16,
+	0x74, 0x17, 0x74, 0x18, 0x74, 0x19, 0x74, 0x1c, 0x74, 0x1d, 0x74, 0x1e,
+	0x74, 0x1f, 0x74, 0x20, 0x74, 0x21, 0x74, 0x23, 0x74, 0x24, 0x74, 0x27,
+	0x74, 0x29, 0x74, 0x2b, 0x74, 0x2d, 0x74, 0x2f, 0x74, 0x31, 0x74, 0x32,
+	0x74, 0x37, 0x74, 0x38, 0x74, 0x39, 0x74, 0x3a, 0x74, 0x3b, 0x74, 0x3d,
+	0x74, 0x3e, 0x74, 0x3f, 0x74, 0x40, 0x74, 0x42, 0x74, 0x43, 0x74, 0x44,
+	0x74, 0x45, 0x74, 0x46, 0x74, 0x47, 0x74, 0x48, 0x74, 0x49, 0x74, 0x4a,
+	0x74, 0x4b, 0x74, 0x4c, 0x74, 0x4d, 0x74, 0x4e, 0x74, 0x4f, 0x74, 0x50,
+	0x74, 0x51, 0x74, 0x52, 0x74, 0x53, 0x74, 0x54, 0x74, 0x56, 0x74, 0x58,
+	0x74, 0x5d, 0x74, 0x60, 0x74, 0x61, 0x74, 0x62, 0x74, 0x63, 0x74, 0x64,
+	0x74, 0x65, 0x74, 0x66, 0x74, 0x67, 0x74, 0x68, 0x74, 0x69, 0x74, 0x6a,
+	0x74, 0x6b, 0x74, 0x6c, 0x74, 0x6e, 0x74, 0x6f, 0x74, 0x71, 0x74, 0x72,
+	0x74, 0x73, 0x74, 0x74, 0x74, 0x75, 0x74, 0x78, 0x74, 0x79, 0x74, 0x7a,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0x7b, 0x74, 0x7c,
+	0x74, 0x7d, 0x74, 0x7f, 0x74, 0x82, 0x74, 0x84, 0x74, 0x85, 0x74, 0x86,
+	0x74, 0x88, 0x74, 0x89, 0x74, 0x8a, 0x74, 0x8c, 0x74, 0x8d, 0x74, 0x8f,
+	0x74, 0x91, 0x74, 0x92, 0x74, 0x93, 0x74, 0x94, 0x74, 0x95, 0x74, 0x96,
+	0x74, 0x97, 0x74, 0x98, 0x74, 0x99, 0x74, 0x9a, 0x74, 0x9b, 0x74, 0x9d,
+	0x74, 0x9f, 0x74, 0xa0, 0x74, 0xa1, 0x74, 0xa2, 0x74, 0xa3, 0x74, 0xa4,
+	0x74, 0xa5, 0x74, 0xa6, 0x74, 0xaa, 0x74, 0xab, 0x74, 0xac, 0x74, 0xad,
+	0x74, 0xae, 0x74, 0xaf, 0x74, 0xb0, 0x74, 0xb1, 0x74, 0xb2, 0x74, 0xb3,
+	0x74, 0xb4, 0x74, 0xb5, 0x74, 0xb6, 0x74, 0xb7, 0x74, 0xb8, 0x74, 0xb9,
+	0x74, 0xbb, 0x74, 0xbc, 0x74, 0xbd, 0x74, 0xbe, 0x74, 0xbf, 0x74, 0xc0,
+	0x74, 0xc1, 0x74, 0xc2, 0x74, 0xc3, 0x74, 0xc4, 0x74, 0xc5, 0x74, 0xc6,
+	0x74, 0xc7, 0x74, 0xc8, 0x74, 0xc9, 0x74, 0xca, 0x74, 0xcb, 0x74, 0xcc,
+	0x74, 0xcd, 0x74, 0xce, 0x74, 0xcf, 0x74, 0xd0, 0x74, 0xd1, 0x74, 0xd3,
+	0x74, 0xd4, 0x74, 0xd5, 0x74, 0xd6, 0x74, 0xd7, 0x74, 0xd8, 0x74, 0xd9,
+	0x74, 0xda, 0x74, 0xdb, 0x74, 0xdd, 0x74, 0xdf, 0x74, 0xe1, 0x74, 0xe5,
+	0x74, 0xe7, 0x74, 0xe8, 0x74, 0xe9, 0x74, 0xea, 0x74, 0xeb, 0x74, 0xec,
+	0x74, 0xed, 0x74, 0xf0, 0x74, 0xf1, 0x74, 0xf2, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x74, 0xf3, 0x74, 0xf5, 0x74, 0xf8, 0x74, 0xf9,
+	0x74, 0xfa, 0x74, 0xfb, 0x74, 0xfc, 0x74, 0xfd, 0x74, 0xfe, 0x75, 0x00,
+	0x75, 0x01, 0x75, 0x02, 0x75, 0x03, 0x75, 0x05, 0x75, 0x06, 0x75, 0x07,
+	0x75, 0x08, 0x75, 0x09, 0x75, 0x0a, 0x75, 0x0b, 0x75, 0x0c, 0x75, 0x0e,
+	0x75, 0x10, 0x75, 0x12, 0x75, 0x14, 0x75, 0x15, 0x75, 0x16, 0x75, 0x17,
+	0x75, 0x1b, 0x75, 0x1d, 0x75, 0x1e, 0x75, 0x20, 0x75, 0x21, 0x75, 0x22,
+	0x75, 0x23, 0x75, 0x24, 0x75, 0x26, 0x75, 0x27, 0x75, 0x2a, 0x75, 0x2e,
+	0x75, 0x34, 0x75, 0x36, 0x75, 0x39, 0x75, 0x3c, 0x75, 0x3d, 0x75, 0x3f,
+	0x75, 0x41, 0x75, 0x42, 0x75, 0x43, 0x75, 0x44, 0x75, 0x46, 0x75, 0x47,
+	0x75, 0x49, 0x75, 0x4a, 0x75, 0x4d, 0x75, 0x50, 0x75, 0x51, 0x75, 0x52,
+	0x75, 0x53, 0x75, 0x55, 0x75, 0x56, 0x75, 0x57, 0x75, 0x58, 0x75, 0x5d,
+	0x75, 0x5e, 0x75, 0x5f, 0x75, 0x60, 0x75, 0x61, 0x75, 0x62, 0x75, 0x63,
+	0x75, 0x64, 0x75, 0x67, 0x75, 0x68, 0x75, 0x69, 0x75, 0x6b, 0x75, 0x6c,
+	0x75, 0x6d, 0x75, 0x6e, 0x75, 0x6f, 0x75, 0x70, 0x75, 0x71, 0x75, 0x73,
+	0x75, 0x75, 0x75, 0x76, 0x75, 0x77, 0x75, 0x7a, 0x75, 0x7b, 0x75, 0x7c,
+	0x75, 0x7d, 0x75, 0x7e, 0x75, 0x80, 0x75, 0x81, 0x75, 0x82, 0x75, 0x84,
+	0x75, 0x85, 0x75, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x75, 0x88, 0x75, 0x89, 0x75, 0x8a, 0x75, 0x8c, 0x75, 0x8d, 0x75, 0x8e,
+	0x75, 0x90, 0x75, 0x93, 0x75, 0x95, 0x75, 0x98, 0x75, 0x9b, 0x75, 0x9c,
+	0x75, 0x9e, 0x75, 0xa2, 0x75, 0xa6, 0x75, 0xa7, 0x75, 0xa8, 0x75, 0xa9,
+	0x75, 0xaa, 0x75, 0xad, 0x75, 0xb6, 0x75, 0xb7, 0x75, 0xba, 0x75, 0xbb,
+	0x75, 0xbf, 0x75, 0xc0, 0x75, 0xc1, 0x75, 0xc6, 0x75, 0xcb, 0x75, 0xcc,
+	0x75, 0xce, 0x75, 0xcf, 0x75, 0xd0, 0x75, 0xd1, 0x75, 0xd3, 0x75, 0xd7,
+	0x75, 0xd9, 0x75, 0xda, 0x75, 0xdc, 0x75, 0xdd, 0x75, 0xdf, 0x75, 0xe0,
+	0x75, 0xe1, 0x75, 0xe5, 0x75, 0xe9, 0x75, 0xec, 0x75, 0xed, 0x75, 0xee,
+	0x75, 0xef, 0x75, 0xf2, 0x75, 0xf3, 0x75, 0xf5, 0x75, 0xf6, 0x75, 0xf7,
+	0x75, 0xf8, 0x75, 0xfa, 0x75, 0xfb, 0x75, 0xfd, 0x75, 0xfe, 0x76, 0x02,
+	0x76, 0x04, 0x76, 0x06, 0x76, 0x07, 0x76, 0x08, 0x76, 0x09, 0x76, 0x0b,
+	0x76, 0x0d, 0x76, 0x0e, 0x76, 0x0f, 0x76, 0x11, 0x76, 0x12, 0x76, 0x13,
+	0x76, 0x14, 0x76, 0x16, 0x76, 0x1a, 0x76, 0x1c, 0x76, 0x1d, 0x76, 0x1e,
+	0x76, 0x21, 0x76, 0x23, 0x76, 0x27, 0x76, 0x28, 0x76, 0x2c, 0x76, 0x2e,
+	0x76, 0x2f, 0x76, 0x31, 0x76, 0x32, 0x76, 0x36, 0x76, 0x37, 0x76, 0x39,
+	0x76, 0x3a, 0x76, 0x3b, 0x76, 0x3d, 0x76, 0x41, 0x76, 0x42, 0x76, 0x44,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0x45, 0x76, 0x46,
+	0x76, 0x47, 0x76, 0x48, 0x76, 0x49, 0x76, 0x4a, 0x76, 0x4b, 0x76, 0x4e,
+	0x76, 0x4f, 0x76, 0x50, 0x76, 0x51, 0x76, 0x52, 0x76, 0x53, 0x76, 0x55,
+	0x76, 0x57, 0x76, 0x58, 0x76, 0x59, 0x76, 0x5a, 0x76, 0x5b, 0x76, 0x5d,
+	0x76, 0x5f, 0x76, 0x60, 0x76, 0x61, 0x76, 0x62, 0x76, 0x64, 0x76, 0x65,
+	0x76, 0x66, 0x76, 0x67, 0x76, 0x68, 0x76, 0x69, 0x76, 0x6a, 0x76, 0x6c,
+	0x76, 0x6d, 0x76, 0x6e, 0x76, 0x70, 0x76, 0x71, 0x76, 0x72, 0x76, 0x73,
+	0x76, 0x74, 0x76, 0x75, 0x76, 0x76, 0x76, 0x77, 0x76, 0x79, 0x76, 0x7a,
+	0x76, 0x7c, 0x76, 0x7f, 0x76, 0x80, 0x76, 0x81, 0x76, 0x83, 0x76, 0x85,
+	0x76, 0x89, 0x76, 0x8a, 0x76, 0x8c, 0x76, 0x8d, 0x76, 0x8f, 0x76, 0x90,
+	0x76, 0x92, 0x76, 0x94, 0x76, 0x95, 0x76, 0x97, 0x76, 0x98, 0x76, 0x9a,
+	0x76, 0x9b, 0x76, 0x9c, 0x76, 0x9d, 0x76, 0x9e, 0x76, 0x9f, 0x76, 0xa0,
+	0x76, 0xa1, 0x76, 0xa2, 0x76, 0xa3, 0x76, 0xa5, 0x76, 0xa6, 0x76, 0xa7,
+	0x76, 0xa8, 0x76, 0xa9, 0x76, 0xaa, 0x76, 0xab, 0x76, 0xac, 0x76, 0xad,
+	0x76, 0xaf, 0x76, 0xb0, 0x76, 0xb3, 0x76, 0xb5, 0x76, 0xb6, 0x76, 0xb7,
+	0x76, 0xb8, 0x76, 0xb9, 0x76, 0xba, 0x76, 0xbb, 0x76, 0xbc, 0x76, 0xbd,
+	0x76, 0xbe, 0x76, 0xc0, 0x76, 0xc1, 0x76, 0xc3, 0x55, 0x4a, 0x96, 0x3f,
+	0x57, 0xc3, 0x63, 0x28, 0x54, 0xce, 0x55, 0x09, 0x54, 0xc0, 0x76, 0x91,
+	0x76, 0x4c, 0x85, 0x3c, 0x77, 0xee, 0x82, 0x7e, 0x78, 0x8d, 0x72, 0x31,
+	0x96, 0x98, 0x97, 0x8d, 0x6c, 0x28, 0x5b, 0x89, 0x4f, 0xfa, 0x63, 0x09,
+	0x66, 0x97, 0x5c, 0xb8, 0x80, 0xfa, 0x68, 0x48, 0x80, 0xae, 0x66, 0x02,
+	0x76, 0xce, 0x51, 0xf9, 0x65, 0x56, 0x71, 0xac, 0x7f, 0xf1, 0x88, 0x84,
+	0x50, 0xb2, 0x59, 0x65, 0x61, 0xca, 0x6f, 0xb3, 0x82, 0xad, 0x63, 0x4c,
+	0x62, 0x52, 0x53, 0xed, 0x54, 0x27, 0x7b, 0x06, 0x51, 0x6b, 0x75, 0xa4,
+	0x5d, 0xf4, 0x62, 0xd4, 0x8d, 0xcb, 0x97, 0x76, 0x62, 0x8a, 0x80, 0x19,
+	0x57, 0x5d, 0x97, 0x38, 0x7f, 0x62, 0x72, 0x38, 0x76, 0x7d, 0x67, 0xcf,
+	0x76, 0x7e, 0x64, 0x46, 0x4f, 0x70, 0x8d, 0x25, 0x62, 0xdc, 0x7a, 0x17,
+	0x65, 0x91, 0x73, 0xed, 0x64, 0x2c, 0x62, 0x73, 0x82, 0x2c, 0x98, 0x81,
+	0x67, 0x7f, 0x72, 0x48, 0x62, 0x6e, 0x62, 0xcc, 0x4f, 0x34, 0x74, 0xe3,
+	0x53, 0x4a, 0x52, 0x9e, 0x7e, 0xca, 0x90, 0xa6, 0x5e, 0x2e, 0x68, 0x86,
+	0x69, 0x9c, 0x81, 0x80, 0x7e, 0xd1, 0x68, 0xd2, 0x78, 0xc5, 0x86, 0x8c,
+	0x95, 0x51, 0x50, 0x8d, 0x8c, 0x24, 0x82, 0xde, 0x80, 0xde, 0x53, 0x05,
+	0x89, 0x12, 0x52, 0x65, 0x76, 0xc4, 0x76, 0xc7, 0x76, 0xc9, 0x76, 0xcb,
+	0x76, 0xcc, 0x76, 0xd3, 0x76, 0xd5, 0x76, 0xd9, 0x76, 0xda, 0x76, 0xdc,
+	0x76, 0xdd, 0x76, 0xde, 0x76, 0xe0, 0x76, 0xe1, 0x76, 0xe2, 0x76, 0xe3,
+	0x76, 0xe4, 0x76, 0xe6, 0x76, 0xe7, 0x76, 0xe8, 0x76, 0xe9, 0x76, 0xea,
+	0x76, 0xeb, 0x76, 0xec, 0x76, 0xed, 0x76, 0xf0, 0x76, 0xf3, 0x76, 0xf5,
+	0x76, 0xf6, 0x76, 0xf7, 0x76, 0xfa, 0x76, 0xfb, 0x76, 0xfd, 0x76, 0xff,
+	0x77, 0x00, 0x77, 0x02, 0x77, 0x03, 0x77, 0x05, 0x77, 0x06, 0x77, 0x0a,
+	0x77, 0x0c, 0x77, 0x0e, 0x77, 0x0f, 0x77, 0x10, 0x77, 0x11, 0x77, 0x12,
+	0x77, 0x13, 0x77, 0x14, 0x77, 0x15, 0x77, 0x16, 0x77, 0x17, 0x77, 0x18,
+	0x77, 0x1b, 0x77, 0x1c, 0x77, 0x1d, 0x77, 0x1e, 0x77, 0x21, 0x77, 0x23,
+	0x77, 0x24, 0x77, 0x25, 0x77, 0x27, 0x77, 0x2a, 0x77, 0x2b, 0x77, 0x2c,
+	0x77, 0x2e, 0x77, 0x30, 0x77, 0x31, 0x77, 0x32, 0x77, 0x33, 0x77, 0x34,
+	0x77, 0x39, 0x77, 0x3b, 0x77, 0x3d, 0x77, 0x3e, 0x77, 0x3f, 0x77, 0x42,
+	0x77, 0x44, 0x77, 0x45, 0x77, 0x46, 0x77, 0x48, 0x77, 0x49, 0x77, 0x4a,
+	0x77, 0x4b, 0x77, 0x4c, 0x77, 0x4d, 0x77, 0x4e, 0x77, 0x4f, 0x77, 0x52,
+	0x77, 0x53, 0x77, 0x54, 0x77, 0x55, 0x77, 0x56, 0x77, 0x57, 0x77, 0x58,
+	0x77, 0x59, 0x77, 0x5c, 0x85, 0x84, 0x96, 0xf9, 0x4f, 0xdd, 0x58, 0x21,
+	0x99, 0x71, 0x5b, 0x9d, 0x62, 0xb1, 0x62, 0xa5, 0x66, 0xb4, 0x8c, 0x79,
+	0x9c, 0x8d, 0x72, 0x06, 0x67, 0x6f, 0x78, 0x91, 0x60, 0xb2, 0x53, 0x51,
+	0x53, 0x17, 0x8f, 0x88, 0x80, 0xcc, 0x8d, 0x1d, 0x94, 0xa1, 0x50, 0x0d,
+	0x72, 0xc8, 0x59, 0x07, 0x60, 0xeb, 0x71, 0x19, 0x88, 0xab, 0x59, 0x54,
+	0x82, 0xef, 0x67, 0x2c, 0x7b, 0x28, 0x5d, 0x29, 0x7e, 0xf7, 0x75, 0x2d,
+	0x6c, 0xf5, 0x8e, 0x66, 0x8f, 0xf8, 0x90, 0x3c, 0x9f, 0x3b, 0x6b, 0xd4,
+	0x91, 0x19, 0x7b, 0x14, 0x5f, 0x7c, 0x78, 0xa7, 0x84, 0xd6, 0x85, 0x3d,
+	0x6b, 0xd5, 0x6b, 0xd9, 0x6b, 0xd6, 0x5e, 0x01, 0x5e, 0x87, 0x75, 0xf9,
+	0x95, 0xed, 0x65, 0x5d, 0x5f, 0x0a, 0x5f, 0xc5, 0x8f, 0x9f, 0x58, 0xc1,
+	0x81, 0xc2, 0x90, 0x7f, 0x96, 0x5b, 0x97, 0xad, 0x8f, 0xb9, 0x7f, 0x16,
+	0x8d, 0x2c, 0x62, 0x41, 0x4f, 0xbf, 0x53, 0xd8, 0x53, 0x5e, 0x8f, 0xa8,
+	0x8f, 0xa9, 0x8f, 0xab, 0x90, 0x4d, 0x68, 0x07, 0x5f, 0x6a, 0x81, 0x98,
+	0x88, 0x68, 0x9c, 0xd6, 0x61, 0x8b, 0x52, 0x2b, 0x76, 0x2a, 0x5f, 0x6c,
+	0x65, 0x8c, 0x6f, 0xd2, 0x6e, 0xe8, 0x5b, 0xbe, 0x64, 0x48, 0x51, 0x75,
+	0x51, 0xb0, 0x67, 0xc4, 0x4e, 0x19, 0x79, 0xc9, 0x99, 0x7c, 0x70, 0xb3,
+	0x77, 0x5d, 0x77, 0x5e, 0x77, 0x5f, 0x77, 0x60, 0x77, 0x64, 0x77, 0x67,
+	0x77, 0x69, 0x77, 0x6a, 0x77, 0x6d, 0x77, 0x6e, 0x77, 0x6f, 0x77, 0x70,
+	0x77, 0x71, 0x77, 0x72, 0x77, 0x73, 0x77, 0x74, 0x77, 0x75, 0x77, 0x76,
+	0x77, 0x77, 0x77, 0x78, 0x77, 0x7a, 0x77, 0x7b, 0x77, 0x7c, 0x77, 0x81,
+	0x77, 0x82, 0x77, 0x83, 0x77, 0x86, 0x77, 0x87, 0x77, 0x88, 0x77, 0x89,
+	0x77, 0x8a, 0x77, 0x8b, 0x77, 0x8f, 0x77, 0x90, 0x77, 0x93, 0x77, 0x94,
+	0x77, 0x95, 0x77, 0x96, 0x77, 0x97, 0x77, 0x98, 0x77, 0x99, 0x77, 0x9a,
+	0x77, 0x9b, 0x77, 0x9c, 0x77, 0x9d, 0x77, 0x9e, 0x77, 0xa1, 0x77, 0xa3,
+	0x77, 0xa4, 0x77, 0xa6, 0x77, 0xa8, 0x77, 0xab, 0x77, 0xad, 0x77, 0xae,
+	0x77, 0xaf, 0x77, 0xb1, 0x77, 0xb2, 0x77, 0xb4, 0x77, 0xb6, 0x77, 0xb7,
+	0x77, 0xb8, 0x77, 0xb9, 0x77, 0xba, 0x77, 0xbc, 0x77, 0xbe, 0x77, 0xc0,
+	0x77, 0xc1, 0x77, 0xc2, 0x77, 0xc3, 0x77, 0xc4, 0x77, 0xc5, 0x77, 0xc6,
+	0x77, 0xc7, 0x77, 0xc8, 0x77, 0xc9, 0x77, 0xca, 0x77, 0xcb, 0x77, 0xcc,
+	0x77, 0xce, 0x77, 0xcf, 0x77, 0xd0, 0x77, 0xd1, 0x77, 0xd2, 0x77, 0xd3,
+	0x77, 0xd4, 0x77, 0xd5, 0x77, 0xd6, 0x77, 0xd8, 0x77, 0xd9, 0x77, 0xda,
+	0x77, 0xdd, 0x77, 0xde, 0x77, 0xdf, 0x77, 0xe0, 0x77, 0xe1, 0x77, 0xe4,
+	0x75, 0xc5, 0x5e, 0x76, 0x73, 0xbb, 0x83, 0xe0, 0x64, 0xad, 0x62, 0xe8,
+	0x94, 0xb5, 0x6c, 0xe2, 0x53, 0x5a, 0x52, 0xc3, 0x64, 0x0f, 0x94, 0xc2,
+	0x7b, 0x94, 0x4f, 0x2f, 0x5e, 0x1b, 0x82, 0x36, 0x81, 0x16, 0x81, 0x8a,
+	0x6e, 0x24, 0x6c, 0xca, 0x9a, 0x73, 0x63, 0x55, 0x53, 0x5c, 0x54, 0xfa,
+	0x88, 0x65, 0x57, 0xe0, 0x4e, 0x0d, 0x5e, 0x03, 0x6b, 0x65, 0x7c, 0x3f,
+	0x90, 0xe8, 0x60, 0x16, 0x64, 0xe6, 0x73, 0x1c, 0x88, 0xc1, 0x67, 0x50,
+	0x62, 0x4d, 0x8d, 0x22, 0x77, 0x6c, 0x8e, 0x29, 0x91, 0xc7, 0x5f, 0x69,
+	0x83, 0xdc, 0x85, 0x21, 0x99, 0x10, 0x53, 0xc2, 0x86, 0x95, 0x6b, 0x8b,
+	0x60, 0xed, 0x60, 0xe8, 0x70, 0x7f, 0x82, 0xcd, 0x82, 0x31, 0x4e, 0xd3,
+	0x6c, 0xa7, 0x85, 0xcf, 0x64, 0xcd, 0x7c, 0xd9, 0x69, 0xfd, 0x66, 0xf9,
+	0x83, 0x49, 0x53, 0x95, 0x7b, 0x56, 0x4f, 0xa7, 0x51, 0x8c, 0x6d, 0x4b,
+	0x5c, 0x42, 0x8e, 0x6d, 0x63, 0xd2, 0x53, 0xc9, 0x83, 0x2c, 0x83, 0x36,
+	0x67, 0xe5, 0x78, 0xb4, 0x64, 0x3d, 0x5b, 0xdf, 0x5c, 0x94, 0x5d, 0xee,
+	0x8b, 0xe7, 0x62, 0xc6, 0x67, 0xf4, 0x8c, 0x7a, 0x64, 0x00, 0x63, 0xba,
+	0x87, 0x49, 0x99, 0x8b, 0x8c, 0x17, 0x7f, 0x20, 0x94, 0xf2, 0x4e, 0xa7,
+	0x96, 0x10, 0x98, 0xa4, 0x66, 0x0c, 0x73, 0x16, 0x77, 0xe6, 0x77, 0xe8,
+	0x77, 0xea, 0x77, 0xef, 0x77, 0xf0, 0x77, 0xf1, 0x77, 0xf2, 0x77, 0xf4,
+	0x77, 0xf5, 0x77, 0xf7, 0x77, 0xf9, 0x77, 0xfa, 0x77, 0xfb, 0x77, 0xfc,
+	0x78, 0x03, 0x78, 0x04, 0x78, 0x05, 0x78, 0x06, 0x78, 0x07, 0x78, 0x08,
+	0x78, 0x0a, 0x78, 0x0b, 0x78, 0x0e, 0x78, 0x0f, 0x78, 0x10, 0x78, 0x13,
+	0x78, 0x15, 0x78, 0x19, 0x78, 0x1b, 0x78, 0x1e, 0x78, 0x20, 0x78, 0x21,
+	0x78, 0x22, 0x78, 0x24, 0x78, 0x28, 0x78, 0x2a, 0x78, 0x2b, 0x78, 0x2e,
+	0x78, 0x2f, 0x78, 0x31, 0x78, 0x32, 0x78, 0x33, 0x78, 0x35, 0x78, 0x36,
+	0x78, 0x3d, 0x78, 0x3f, 0x78, 0x41, 0x78, 0x42, 0x78, 0x43, 0x78, 0x44,
+	0x78, 0x46, 0x78, 0x48, 0x78, 0x49, 0x78, 0x4a, 0x78, 0x4b, 0x78, 0x4d,
+	0x78, 0x4f, 0x78, 0x51, 0x78, 0x53, 0x78, 0x54, 0x78, 0x58, 0x78, 0x59,
+	0x78, 0x5a, 0x78, 0x5b, 0x78, 0x5c, 0x78, 0x5e, 0x78, 0x5f, 0x78, 0x60,
+	0x78, 0x61, 0x78, 0x62, 0x78, 0x63, 0x78, 0x64, 0x78, 0x65, 0x78, 0x66,
+	0x78, 0x67, 0x78, 0x68, 0x78, 0x69, 0x78, 0x6f, 0x78, 0x70, 0x78, 0x71,
+	0x78, 0x72, 0x78, 0x73, 0x78, 0x74, 0x78, 0x75, 0x78, 0x76, 0x78, 0x78,
+	0x78, 0x79, 0x78, 0x7a, 0x78, 0x7b, 0x78, 0x7d, 0x78, 0x7e, 0x78, 0x7f,
+	0x78, 0x80, 0x78, 0x81, 0x78, 0x82, 0x78, 0x83, 0x57, 0x3a, 0x5c, 0x1d,
+	0x5e, 0x38, 0x95, 0x7f, 0x50, 0x7f, 0x80, 0xa0, 0x53, 0x82, 0x65, 0x5e,
+	0x75, 0x45, 0x55, 0x31, 0x50, 0x21, 0x8d, 0x85, 0x62, 0x84, 0x94, 0x9e,
+	0x67, 0x1d, 0x56, 0x32, 0x6f, 0x6e, 0x5d, 0xe2, 0x54, 0x35, 0x70, 0x92,
+	0x8f, 0x66, 0x62, 0x6f, 0x64, 0xa4, 0x63, 0xa3, 0x5f, 0x7b, 0x6f, 0x88,
+	0x90, 0xf4, 0x81, 0xe3, 0x8f, 0xb0, 0x5c, 0x18, 0x66, 0x68, 0x5f, 0xf1,
+	0x6c, 0x89, 0x96, 0x48, 0x8d, 0x81, 0x88, 0x6c, 0x64, 0x91, 0x79, 0xf0,
+	0x57, 0xce, 0x6a, 0x59, 0x62, 0x10, 0x54, 0x48, 0x4e, 0x58, 0x7a, 0x0b,
+	0x60, 0xe9, 0x6f, 0x84, 0x8b, 0xda, 0x62, 0x7f, 0x90, 0x1e, 0x9a, 0x8b,
+	0x79, 0xe4, 0x54, 0x03, 0x75, 0xf4, 0x63, 0x01, 0x53, 0x19, 0x6c, 0x60,
+	0x8f, 0xdf, 0x5f, 0x1b, 0x9a, 0x70, 0x80, 0x3b, 0x9f, 0x7f, 0x4f, 0x88,
+	0x5c, 0x3a, 0x8d, 0x64, 0x7f, 0xc5, 0x65, 0xa5, 0x70, 0xbd, 0x51, 0x45,
+	0x51, 0xb2, 0x86, 0x6b, 0x5d, 0x07, 0x5b, 0xa0, 0x62, 0xbd, 0x91, 0x6c,
+	0x75, 0x74, 0x8e, 0x0c, 0x7a, 0x20, 0x61, 0x01, 0x7b, 0x79, 0x4e, 0xc7,
+	0x7e, 0xf8, 0x77, 0x85, 0x4e, 0x11, 0x81, 0xed, 0x52, 0x1d, 0x51, 0xfa,
+	0x6a, 0x71, 0x53, 0xa8, 0x8e, 0x87, 0x95, 0x04, 0x96, 0xcf, 0x6e, 0xc1,
+	0x96, 0x64, 0x69, 0x5a, 0x78, 0x84, 0x78, 0x85, 0x78, 0x86, 0x78, 0x88,
+	0x78, 0x8a, 0x78, 0x8b, 0x78, 0x8f, 0x78, 0x90, 0x78, 0x92, 0x78, 0x94,
+	0x78, 0x95, 0x78, 0x96, 0x78, 0x99, 0x78, 0x9d, 0x78, 0x9e, 0x78, 0xa0,
+	0x78, 0xa2, 0x78, 0xa4, 0x78, 0xa6, 0x78, 0xa8, 0x78, 0xa9, 0x78, 0xaa,
+	0x78, 0xab, 0x78, 0xac, 0x78, 0xad, 0x78, 0xae, 0x78, 0xaf, 0x78, 0xb5,
+	0x78, 0xb6, 0x78, 0xb7, 0x78, 0xb8, 0x78, 0xba, 0x78, 0xbb, 0x78, 0xbc,
+	0x78, 0xbd, 0x78, 0xbf, 0x78, 0xc0, 0x78, 0xc2, 0x78, 0xc3, 0x78, 0xc4,
+	0x78, 0xc6, 0x78, 0xc7, 0x78, 0xc8, 0x78, 0xcc, 0x78, 0xcd, 0x78, 0xce,
+	0x78, 0xcf, 0x78, 0xd1, 0x78, 0xd2, 0x78, 0xd3, 0x78, 0xd6, 0x78, 0xd7,
+	0x78, 0xd8, 0x78, 0xda, 0x78, 0xdb, 0x78, 0xdc, 0x78, 0xdd, 0x78, 0xde,
+	0x78, 0xdf, 0x78, 0xe0, 0x78, 0xe1, 0x78, 0xe2, 0x78, 0xe3, 0x78, 0xe4,
+	0x78, 0xe5, 0x78, 0xe6, 0x78, 0xe7, 0x78, 0xe9, 0x78, 0xea, 0x78, 0xeb,
+	0x78, 0xed, 0x78, 0xee, 0x78, 0xef, 0x78, 0xf0, 0x78, 0xf1, 0x78, 0xf3,
+	0x78, 0xf5, 0x78, 0xf6, 0x78, 0xf8, 0x78, 0xf9, 0x78, 0xfb, 0x78, 0xfc,
+	0x78, 0xfd, 0x78, 0xfe, 0x78, 0xff, 0x79, 0x00, 0x79, 0x02, 0x79, 0x03,
+	0x79, 0x04, 0x79, 0x06, 0x79, 0x07, 0x79, 0x08, 0x79, 0x09, 0x79, 0x0a,
+	0x79, 0x0b, 0x79, 0x0c, 0x78, 0x40, 0x50, 0xa8, 0x77, 0xd7, 0x64, 0x10,
+	0x89, 0xe6, 0x59, 0x04, 0x63, 0xe3, 0x5d, 0xdd, 0x7a, 0x7f, 0x69, 0x3d,
+	0x4f, 0x20, 0x82, 0x39, 0x55, 0x98, 0x4e, 0x32, 0x75, 0xae, 0x7a, 0x97,
+	0x5e, 0x62, 0x5e, 0x8a, 0x95, 0xef, 0x52, 0x1b, 0x54, 0x39, 0x70, 0x8a,
+	0x63, 0x76, 0x95, 0x24, 0x57, 0x82, 0x66, 0x25, 0x69, 0x3f, 0x91, 0x87,
+	0x55, 0x07, 0x6d, 0xf3, 0x7e, 0xaf, 0x88, 0x22, 0x62, 0x33, 0x7e, 0xf0,
+	0x75, 0xb5, 0x83, 0x28, 0x78, 0xc1, 0x96, 0xcc, 0x8f, 0x9e, 0x61, 0x48,
+	0x74, 0xf7, 0x8b, 0xcd, 0x6b, 0x64, 0x52, 0x3a, 0x8d, 0x50, 0x6b, 0x21,
+	0x80, 0x6a, 0x84, 0x71, 0x56, 0xf1, 0x53, 0x06, 0x4e, 0xce, 0x4e, 0x1b,
+	0x51, 0xd1, 0x7c, 0x97, 0x91, 0x8b, 0x7c, 0x07, 0x4f, 0xc3, 0x8e, 0x7f,
+	0x7b, 0xe1, 0x7a, 0x9c, 0x64, 0x67, 0x5d, 0x14, 0x50, 0xac, 0x81, 0x06,
+	0x76, 0x01, 0x7c, 0xb9, 0x6d, 0xec, 0x7f, 0xe0, 0x67, 0x51, 0x5b, 0x58,
+	0x5b, 0xf8, 0x78, 0xcb, 0x64, 0xae, 0x64, 0x13, 0x63, 0xaa, 0x63, 0x2b,
+	0x95, 0x19, 0x64, 0x2d, 0x8f, 0xbe, 0x7b, 0x54, 0x76, 0x29, 0x62, 0x53,
+	0x59, 0x27, 0x54, 0x46, 0x6b, 0x79, 0x50, 0xa3, 0x62, 0x34, 0x5e, 0x26,
+	0x6b, 0x86, 0x4e, 0xe3, 0x8d, 0x37, 0x88, 0x8b, 0x5f, 0x85, 0x90, 0x2e,
+	0x79, 0x0d, 0x79, 0x0e, 0x79, 0x0f, 0x79, 0x10, 0x79, 0x11, 0x79, 0x12,
+	0x79, 0x14, 0x79, 0x15, 0x79, 0x16, 0x79, 0x17, 0x79, 0x18, 0x79, 0x19,
+	0x79, 0x1a, 0x79, 0x1b, 0x79, 0x1c, 0x79, 0x1d, 0x79, 0x1f, 0x79, 0x20,
+	0x79, 0x21, 0x79, 0x22, 0x79, 0x23, 0x79, 0x25, 0x79, 0x26, 0x79, 0x27,
+	0x79, 0x28, 0x79, 0x29, 0x79, 0x2a, 0x79, 0x2b, 0x79, 0x2c, 0x79, 0x2d,
+	0x79, 0x2e, 0x79, 0x2f, 0x79, 0x30, 0x79, 0x31, 0x79, 0x32, 0x79, 0x33,
+	0x79, 0x35, 0x79, 0x36, 0x79, 0x37, 0x79, 0x38, 0x79, 0x39, 0x79, 0x3d,
+	0x79, 0x3f, 0x79, 0x42, 0x79, 0x43, 0x79, 0x44, 0x79, 0x45, 0x79, 0x47,
+	0x79, 0x4a, 0x79, 0x4b, 0x79, 0x4c, 0x79, 0x4d, 0x79, 0x4e, 0x79, 0x4f,
+	0x79, 0x50, 0x79, 0x51, 0x79, 0x52, 0x79, 0x54, 0x79, 0x55, 0x79, 0x58,
+	0x79, 0x59, 0x79, 0x61, 0x79, 0x63, 0x79, 0x64, 0x79, 0x66, 0x79, 0x69,
+	0x79, 0x6a, 0x79, 0x6b, 0x79, 0x6c, 0x79, 0x6e, 0x79, 0x70, 0x79, 0x71,
+	0x79, 0x72, 0x79, 0x73, 0x79, 0x74, 0x79, 0x75, 0x79, 0x76, 0x79, 0x79,
+	0x79, 0x7b, 0x79, 0x7c, 0x79, 0x7d, 0x79, 0x7e, 0x79, 0x7f, 0x79, 0x82,
+	0x79, 0x83, 0x79, 0x86, 0x79, 0x87, 0x79, 0x88, 0x79, 0x89, 0x79, 0x8b,
+	0x79, 0x8c, 0x79, 0x8d, 0x79, 0x8e, 0x79, 0x90, 0x79, 0x91, 0x79, 0x92,
+	0x60, 0x20, 0x80, 0x3d, 0x62, 0xc5, 0x4e, 0x39, 0x53, 0x55, 0x90, 0xf8,
+	0x63, 0xb8, 0x80, 0xc6, 0x65, 0xe6, 0x6c, 0x2e, 0x4f, 0x46, 0x60, 0xee,
+	0x6d, 0xe1, 0x8b, 0xde, 0x5f, 0x39, 0x86, 0xcb, 0x5f, 0x53, 0x63, 0x21,
+	0x51, 0x5a, 0x83, 0x61, 0x68, 0x63, 0x52, 0x00, 0x63, 0x63, 0x8e, 0x48,
+	0x50, 0x12, 0x5c, 0x9b, 0x79, 0x77, 0x5b, 0xfc, 0x52, 0x30, 0x7a, 0x3b,
+	0x60, 0xbc, 0x90, 0x53, 0x76, 0xd7, 0x5f, 0xb7, 0x5f, 0x97, 0x76, 0x84,
+	0x8e, 0x6c, 0x70, 0x6f, 0x76, 0x7b, 0x7b, 0x49, 0x77, 0xaa, 0x51, 0xf3,
+	0x90, 0x93, 0x58, 0x24, 0x4f, 0x4e, 0x6e, 0xf4, 0x8f, 0xea, 0x65, 0x4c,
+	0x7b, 0x1b, 0x72, 0xc4, 0x6d, 0xa4, 0x7f, 0xdf, 0x5a, 0xe1, 0x62, 0xb5,
+	0x5e, 0x95, 0x57, 0x30, 0x84, 0x82, 0x7b, 0x2c, 0x5e, 0x1d, 0x5f, 0x1f,
+	0x90, 0x12, 0x7f, 0x14, 0x98, 0xa0, 0x63, 0x82, 0x6e, 0xc7, 0x78, 0x98,
+	0x70, 0xb9, 0x51, 0x78, 0x97, 0x5b, 0x57, 0xab, 0x75, 0x35, 0x4f, 0x43,
+	0x75, 0x38, 0x5e, 0x97, 0x60, 0xe6, 0x59, 0x60, 0x6d, 0xc0, 0x6b, 0xbf,
+	0x78, 0x89, 0x53, 0xfc, 0x96, 0xd5, 0x51, 0xcb, 0x52, 0x01, 0x63, 0x89,
+	0x54, 0x0a, 0x94, 0x93, 0x8c, 0x03, 0x8d, 0xcc, 0x72, 0x39, 0x78, 0x9f,
+	0x87, 0x76, 0x8f, 0xed, 0x8c, 0x0d, 0x53, 0xe0, 0x79, 0x93, 0x79, 0x94,
+	0x79, 0x95, 0x79, 0x96, 0x79, 0x97, 0x79, 0x98, 0x79, 0x99, 0x79, 0x9b,
+	0x79, 0x9c, 0x79, 0x9d, 0x79, 0x9e, 0x79, 0x9f, 0x79, 0xa0, 0x79, 0xa1,
+	0x79, 0xa2, 0x79, 0xa3, 0x79, 0xa4, 0x79, 0xa5, 0x79, 0xa6, 0x79, 0xa8,
+	0x79, 0xa9, 0x79, 0xaa, 0x79, 0xab, 0x79, 0xac, 0x79, 0xad, 0x79, 0xae,
+	0x79, 0xaf, 0x79, 0xb0, 0x79, 0xb1, 0x79, 0xb2, 0x79, 0xb4, 0x79, 0xb5,
+	0x79, 0xb6, 0x79, 0xb7, 0x79, 0xb8, 0x79, 0xbc, 0x79, 0xbf, 0x79, 0xc2,
+	0x79, 0xc4, 0x79, 0xc5, 0x79, 0xc7, 0x79, 0xc8, 0x79, 0xca, 0x79, 0xcc,
+	0x79, 0xce, 0x79, 0xcf, 0x79, 0xd0, 0x79, 0xd3, 0x79, 0xd4, 0x79, 0xd6,
+	0x79, 0xd7, 0x79, 0xd9, 0x79, 0xda, 0x79, 0xdb, 0x79, 0xdc, 0x79, 0xdd,
+	0x79, 0xde, 0x79, 0xe0, 0x79, 0xe1, 0x79, 0xe2, 0x79, 0xe5, 0x79, 0xe8,
+	0x79, 0xea, 0x79, 0xec, 0x79, 0xee, 0x79, 0xf1, 0x79, 0xf2, 0x79, 0xf3,
+	0x79, 0xf4, 0x79, 0xf5, 0x79, 0xf6, 0x79, 0xf7, 0x79, 0xf9, 0x79, 0xfa,
+	0x79, 0xfc, 0x79, 0xfe, 0x79, 0xff, 0x7a, 0x01, 0x7a, 0x04, 0x7a, 0x05,
+	0x7a, 0x07, 0x7a, 0x08, 0x7a, 0x09, 0x7a, 0x0a, 0x7a, 0x0c, 0x7a, 0x0f,
+	0x7a, 0x10, 0x7a, 0x11, 0x7a, 0x12, 0x7a, 0x13, 0x7a, 0x15, 0x7a, 0x16,
+	0x7a, 0x18, 0x7a, 0x19, 0x7a, 0x1b, 0x7a, 0x1c, 0x4e, 0x01, 0x76, 0xef,
+	0x53, 0xee, 0x94, 0x89, 0x98, 0x76, 0x9f, 0x0e, 0x95, 0x2d, 0x5b, 0x9a,
+	0x8b, 0xa2, 0x4e, 0x22, 0x4e, 0x1c, 0x51, 0xac, 0x84, 0x63, 0x61, 0xc2,
+	0x52, 0xa8, 0x68, 0x0b, 0x4f, 0x97, 0x60, 0x6b, 0x51, 0xbb, 0x6d, 0x1e,
+	0x51, 0x5c, 0x62, 0x96, 0x65, 0x97, 0x96, 0x61, 0x8c, 0x46, 0x90, 0x17,
+	0x75, 0xd8, 0x90, 0xfd, 0x77, 0x63, 0x6b, 0xd2, 0x72, 0x8a, 0x72, 0xec,
+	0x8b, 0xfb, 0x58, 0x35, 0x77, 0x79, 0x8d, 0x4c, 0x67, 0x5c, 0x95, 0x40,
+	0x80, 0x9a, 0x5e, 0xa6, 0x6e, 0x21, 0x59, 0x92, 0x7a, 0xef, 0x77, 0xed,
+	0x95, 0x3b, 0x6b, 0xb5, 0x65, 0xad, 0x7f, 0x0e, 0x58, 0x06, 0x51, 0x51,
+	0x96, 0x1f, 0x5b, 0xf9, 0x58, 0xa9, 0x54, 0x28, 0x8e, 0x72, 0x65, 0x66,
+	0x98, 0x7f, 0x56, 0xe4, 0x94, 0x9d, 0x76, 0xfe, 0x90, 0x41, 0x63, 0x87,
+	0x54, 0xc6, 0x59, 0x1a, 0x59, 0x3a, 0x57, 0x9b, 0x8e, 0xb2, 0x67, 0x35,
+	0x8d, 0xfa, 0x82, 0x35, 0x52, 0x41, 0x60, 0xf0, 0x58, 0x15, 0x86, 0xfe,
+	0x5c, 0xe8, 0x9e, 0x45, 0x4f, 0xc4, 0x98, 0x9d, 0x8b, 0xb9, 0x5a, 0x25,
+	0x60, 0x76, 0x53, 0x84, 0x62, 0x7c, 0x90, 0x4f, 0x91, 0x02, 0x99, 0x7f,
+	0x60, 0x69, 0x80, 0x0c, 0x51, 0x3f, 0x80, 0x33, 0x5c, 0x14, 0x99, 0x75,
+	0x6d, 0x31, 0x4e, 0x8c, 0x7a, 0x1d, 0x7a, 0x1f, 0x7a, 0x21, 0x7a, 0x22,
+	0x7a, 0x24, 0x7a, 0x25, 0x7a, 0x26, 0x7a, 0x27, 0x7a, 0x28, 0x7a, 0x29,
+	0x7a, 0x2a, 0x7a, 0x2b, 0x7a, 0x2c, 0x7a, 0x2d, 0x7a, 0x2e, 0x7a, 0x2f,
+	0x7a, 0x30, 0x7a, 0x31, 0x7a, 0x32, 0x7a, 0x34, 0x7a, 0x35, 0x7a, 0x36,
+	0x7a, 0x38, 0x7a, 0x3a, 0x7a, 0x3e, 0x7a, 0x40, 0x7a, 0x41, 0x7a, 0x42,
+	0x7a, 0x43, 0x7a, 0x44, 0x7a, 0x45, 0x7a, 0x47, 0x7a, 0x48, 0x7a, 0x49,
+	0x7a, 0x4a, 0x7a, 0x4b, 0x7a, 0x4c, 0x7a, 0x4d, 0x7a, 0x4e, 0x7a, 0x4f,
+	0x7a, 0x50, 0x7a, 0x52, 0x7a, 0x53, 0x7a, 0x54, 0x7a, 0x55, 0x7a, 0x56,
+	0x7a, 0x58, 0x7a, 0x59, 0x7a, 0x5a, 0x7a, 0x5b, 0x7a, 0x5c, 0x7a, 0x5d,
+	0x7a, 0x5e, 0x7a, 0x5f, 0x7a, 0x60, 0x7a, 0x61, 0x7a, 0x62, 0x7a, 0x63,
+	0x7a, 0x64, 0x7a, 0x65, 0x7a, 0x66, 0x7a, 0x67, 0x7a, 0x68, 0x7a, 0x69,
+	0x7a, 0x6a, 0x7a, 0x6b, 0x7a, 0x6c, 0x7a, 0x6d, 0x7a, 0x6e, 0x7a, 0x6f,
+	0x7a, 0x71, 0x7a, 0x72, 0x7a, 0x73, 0x7a, 0x75, 0x7a, 0x7b, 0x7a, 0x7c,
+	0x7a, 0x7d, 0x7a, 0x7e, 0x7a, 0x82, 0x7a, 0x85, 0x7a, 0x87, 0x7a, 0x89,
+	0x7a, 0x8a, 0x7a, 0x8b, 0x7a, 0x8c, 0x7a, 0x8e, 0x7a, 0x8f, 0x7a, 0x90,
+	0x7a, 0x93, 0x7a, 0x94, 0x7a, 0x99, 0x7a, 0x9a, 0x7a, 0x9b, 0x7a, 0x9e,
+	0x7a, 0xa1, 0x7a, 0xa2, 0x8d, 0x30, 0x53, 0xd1, 0x7f, 0x5a, 0x7b, 0x4f,
+	0x4f, 0x10, 0x4e, 0x4f, 0x96, 0x00, 0x6c, 0xd5, 0x73, 0xd0, 0x85, 0xe9,
+	0x5e, 0x06, 0x75, 0x6a, 0x7f, 0xfb, 0x6a, 0x0a, 0x77, 0xfe, 0x94, 0x92,
+	0x7e, 0x41, 0x51, 0xe1, 0x70, 0xe6, 0x53, 0xcd, 0x8f, 0xd4, 0x83, 0x03,
+	0x8d, 0x29, 0x72, 0xaf, 0x99, 0x6d, 0x6c, 0xdb, 0x57, 0x4a, 0x82, 0xb3,
+	0x65, 0xb9, 0x80, 0xaa, 0x62, 0x3f, 0x96, 0x32, 0x59, 0xa8, 0x4e, 0xff,
+	0x8b, 0xbf, 0x7e, 0xba, 0x65, 0x3e, 0x83, 0xf2, 0x97, 0x5e, 0x55, 0x61,
+	0x98, 0xde, 0x80, 0xa5, 0x53, 0x2a, 0x8b, 0xfd, 0x54, 0x20, 0x80, 0xba,
+	0x5e, 0x9f, 0x6c, 0xb8, 0x8d, 0x39, 0x82, 0xac, 0x91, 0x5a, 0x54, 0x29,
+	0x6c, 0x1b, 0x52, 0x06, 0x7e, 0xb7, 0x57, 0x5f, 0x71, 0x1a, 0x6c, 0x7e,
+	0x7c, 0x89, 0x59, 0x4b, 0x4e, 0xfd, 0x5f, 0xff, 0x61, 0x24, 0x7c, 0xaa,
+	0x4e, 0x30, 0x5c, 0x01, 0x67, 0xab, 0x87, 0x02, 0x5c, 0xf0, 0x95, 0x0b,
+	0x98, 0xce, 0x75, 0xaf, 0x70, 0xfd, 0x90, 0x22, 0x51, 0xaf, 0x7f, 0x1d,
+	0x8b, 0xbd, 0x59, 0x49, 0x51, 0xe4, 0x4f, 0x5b, 0x54, 0x26, 0x59, 0x2b,
+	0x65, 0x77, 0x80, 0xa4, 0x5b, 0x75, 0x62, 0x76, 0x62, 0xc2, 0x8f, 0x90,
+	0x5e, 0x45, 0x6c, 0x1f, 0x7b, 0x26, 0x4f, 0x0f, 0x4f, 0xd8, 0x67, 0x0d,
+	0x7a, 0xa3, 0x7a, 0xa4, 0x7a, 0xa7, 0x7a, 0xa9, 0x7a, 0xaa, 0x7a, 0xab,
+	0x7a, 0xae, 0x7a, 0xaf, 0x7a, 0xb0, 0x7a, 0xb1, 0x7a, 0xb2, 0x7a, 0xb4,
+	0x7a, 0xb5, 0x7a, 0xb6, 0x7a, 0xb7, 0x7a, 0xb8, 0x7a, 0xb9, 0x7a, 0xba,
+	0x7a, 0xbb, 0x7a, 0xbc, 0x7a, 0xbd, 0x7a, 0xbe, 0x7a, 0xc0, 0x7a, 0xc1,
+	0x7a, 0xc2, 0x7a, 0xc3, 0x7a, 0xc4, 0x7a, 0xc5, 0x7a, 0xc6, 0x7a, 0xc7,
+	0x7a, 0xc8, 0x7a, 0xc9, 0x7a, 0xca, 0x7a, 0xcc, 0x7a, 0xcd, 0x7a, 0xce,
+	0x7a, 0xcf, 0x7a, 0xd0, 0x7a, 0xd1, 0x7a, 0xd2, 0x7a, 0xd3, 0x7a, 0xd4,
+	0x7a, 0xd5, 0x7a, 0xd7, 0x7a, 0xd8, 0x7a, 0xda, 0x7a, 0xdb, 0x7a, 0xdc,
+	0x7a, 0xdd, 0x7a, 0xe1, 0x7a, 0xe2, 0x7a, 0xe4, 0x7a, 0xe7, 0x7a, 0xe8,
+	0x7a, 0xe9, 0x7a, 0xea, 0x7a, 0xeb, 0x7a, 0xec, 0x7a, 0xee, 0x7a, 0xf0,
+	0x7a, 0xf1, 0x7a, 0xf2, 0x7a, 0xf3, 0x7a, 0xf4, 0x7a, 0xf5, 0x7a, 0xf6,
+	0x7a, 0xf7, 0x7a, 0xf8, 0x7a, 0xfb, 0x7a, 0xfc, 0x7a, 0xfe, 0x7b, 0x00,
+	0x7b, 0x01, 0x7b, 0x02, 0x7b, 0x05, 0x7b, 0x07, 0x7b, 0x09, 0x7b, 0x0c,
+	0x7b, 0x0d, 0x7b, 0x0e, 0x7b, 0x10, 0x7b, 0x12, 0x7b, 0x13, 0x7b, 0x16,
+	0x7b, 0x17, 0x7b, 0x18, 0x7b, 0x1a, 0x7b, 0x1c, 0x7b, 0x1d, 0x7b, 0x1f,
+	0x7b, 0x21, 0x7b, 0x22, 0x7b, 0x23, 0x7b, 0x27, 0x7b, 0x29, 0x7b, 0x2d,
+	0x6d, 0x6e, 0x6d, 0xaa, 0x79, 0x8f, 0x88, 0xb1, 0x5f, 0x17, 0x75, 0x2b,
+	0x62, 0x9a, 0x8f, 0x85, 0x4f, 0xef, 0x91, 0xdc, 0x65, 0xa7, 0x81, 0x2f,
+	0x81, 0x51, 0x5e, 0x9c, 0x81, 0x50, 0x8d, 0x74, 0x52, 0x6f, 0x89, 0x86,
+	0x8d, 0x4b, 0x59, 0x0d, 0x50, 0x85, 0x4e, 0xd8, 0x96, 0x1c, 0x72, 0x36,
+	0x81, 0x79, 0x8d, 0x1f, 0x5b, 0xcc, 0x8b, 0xa3, 0x96, 0x44, 0x59, 0x87,
+	0x7f, 0x1a, 0x54, 0x90, 0x56, 0x76, 0x56, 0x0e, 0x8b, 0xe5, 0x65, 0x39,
+	0x69, 0x82, 0x94, 0x99, 0x76, 0xd6, 0x6e, 0x89, 0x5e, 0x72, 0x75, 0x18,
+	0x67, 0x46, 0x67, 0xd1, 0x7a, 0xff, 0x80, 0x9d, 0x8d, 0x76, 0x61, 0x1f,
+	0x79, 0xc6, 0x65, 0x62, 0x8d, 0x63, 0x51, 0x88, 0x52, 0x1a, 0x94, 0xa2,
+	0x7f, 0x38, 0x80, 0x9b, 0x7e, 0xb2, 0x5c, 0x97, 0x6e, 0x2f, 0x67, 0x60,
+	0x7b, 0xd9, 0x76, 0x8b, 0x9a, 0xd8, 0x81, 0x8f, 0x7f, 0x94, 0x7c, 0xd5,
+	0x64, 0x1e, 0x95, 0x50, 0x7a, 0x3f, 0x54, 0x4a, 0x54, 0xe5, 0x6b, 0x4c,
+	0x64, 0x01, 0x62, 0x08, 0x9e, 0x3d, 0x80, 0xf3, 0x75, 0x99, 0x52, 0x72,
+	0x97, 0x69, 0x84, 0x5b, 0x68, 0x3c, 0x86, 0xe4, 0x96, 0x01, 0x96, 0x94,
+	0x94, 0xec, 0x4e, 0x2a, 0x54, 0x04, 0x7e, 0xd9, 0x68, 0x39, 0x8d, 0xdf,
+	0x80, 0x15, 0x66, 0xf4, 0x5e, 0x9a, 0x7f, 0xb9, 0x7b, 0x2f, 0x7b, 0x30,
+	0x7b, 0x32, 0x7b, 0x34, 0x7b, 0x35, 0x7b, 0x36, 0x7b, 0x37, 0x7b, 0x39,
+	0x7b, 0x3b, 0x7b, 0x3d, 0x7b, 0x3f, 0x7b, 0x40, 0x7b, 0x41, 0x7b, 0x42,
+	0x7b, 0x43, 0x7b, 0x44, 0x7b, 0x46, 0x7b, 0x48, 0x7b, 0x4a, 0x7b, 0x4d,
+	0x7b, 0x4e, 0x7b, 0x53, 0x7b, 0x55, 0x7b, 0x57, 0x7b, 0x59, 0x7b, 0x5c,
+	0x7b, 0x5e, 0x7b, 0x5f, 0x7b, 0x61, 0x7b, 0x63, 0x7b, 0x64, 0x7b, 0x65,
+	0x7b, 0x66, 0x7b, 0x67, 0x7b, 0x68, 0x7b, 0x69, 0x7b, 0x6a, 0x7b, 0x6b,
+	0x7b, 0x6c, 0x7b, 0x6d, 0x7b, 0x6f, 0x7b, 0x70, 0x7b, 0x73, 0x7b, 0x74,
+	0x7b, 0x76, 0x7b, 0x78, 0x7b, 0x7a, 0x7b, 0x7c, 0x7b, 0x7d, 0x7b, 0x7f,
+	0x7b, 0x81, 0x7b, 0x82, 0x7b, 0x83, 0x7b, 0x84, 0x7b, 0x86, 0x7b, 0x87,
+	0x7b, 0x88, 0x7b, 0x89, 0x7b, 0x8a, 0x7b, 0x8b, 0x7b, 0x8c, 0x7b, 0x8e,
+	0x7b, 0x8f, 0x7b, 0x91, 0x7b, 0x92, 0x7b, 0x93, 0x7b, 0x96, 0x7b, 0x98,
+	0x7b, 0x99, 0x7b, 0x9a, 0x7b, 0x9b, 0x7b, 0x9e, 0x7b, 0x9f, 0x7b, 0xa0,
+	0x7b, 0xa3, 0x7b, 0xa4, 0x7b, 0xa5, 0x7b, 0xae, 0x7b, 0xaf, 0x7b, 0xb0,
+	0x7b, 0xb2, 0x7b, 0xb3, 0x7b, 0xb5, 0x7b, 0xb6, 0x7b, 0xb7, 0x7b, 0xb9,
+	0x7b, 0xba, 0x7b, 0xbb, 0x7b, 0xbc, 0x7b, 0xbd, 0x7b, 0xbe, 0x7b, 0xbf,
+	0x7b, 0xc0, 0x7b, 0xc2, 0x7b, 0xc3, 0x7b, 0xc4, 0x57, 0xc2, 0x80, 0x3f,
+	0x68, 0x97, 0x5d, 0xe5, 0x65, 0x3b, 0x52, 0x9f, 0x60, 0x6d, 0x9f, 0x9a,
+	0x4f, 0x9b, 0x8e, 0xac, 0x51, 0x6c, 0x5b, 0xab, 0x5f, 0x13, 0x5d, 0xe9,
+	0x6c, 0x5e, 0x62, 0xf1, 0x8d, 0x21, 0x51, 0x71, 0x94, 0xa9, 0x52, 0xfe,
+	0x6c, 0x9f, 0x82, 0xdf, 0x72, 0xd7, 0x57, 0xa2, 0x67, 0x84, 0x8d, 0x2d,
+	0x59, 0x1f, 0x8f, 0x9c, 0x83, 0xc7, 0x54, 0x95, 0x7b, 0x8d, 0x4f, 0x30,
+	0x6c, 0xbd, 0x5b, 0x64, 0x59, 0xd1, 0x9f, 0x13, 0x53, 0xe4, 0x86, 0xca,
+	0x9a, 0xa8, 0x8c, 0x37, 0x80, 0xa1, 0x65, 0x45, 0x98, 0x7e, 0x56, 0xfa,
+	0x96, 0xc7, 0x52, 0x2e, 0x74, 0xdc, 0x52, 0x50, 0x5b, 0xe1, 0x63, 0x02,
+	0x89, 0x02, 0x4e, 0x56, 0x62, 0xd0, 0x60, 0x2a, 0x68, 0xfa, 0x51, 0x73,
+	0x5b, 0x98, 0x51, 0xa0, 0x89, 0xc2, 0x7b, 0xa1, 0x99, 0x86, 0x7f, 0x50,
+	0x60, 0xef, 0x70, 0x4c, 0x8d, 0x2f, 0x51, 0x49, 0x5e, 0x7f, 0x90, 0x1b,
+	0x74, 0x70, 0x89, 0xc4, 0x57, 0x2d, 0x78, 0x45, 0x5f, 0x52, 0x9f, 0x9f,
+	0x95, 0xfa, 0x8f, 0x68, 0x9b, 0x3c, 0x8b, 0xe1, 0x76, 0x78, 0x68, 0x42,
+	0x67, 0xdc, 0x8d, 0xea, 0x8d, 0x35, 0x52, 0x3d, 0x8f, 0x8a, 0x6e, 0xda,
+	0x68, 0xcd, 0x95, 0x05, 0x90, 0xed, 0x56, 0xfd, 0x67, 0x9c, 0x88, 0xf9,
+	0x8f, 0xc7, 0x54, 0xc8, 0x7b, 0xc5, 0x7b, 0xc8, 0x7b, 0xc9, 0x7b, 0xca,
+	0x7b, 0xcb, 0x7b, 0xcd, 0x7b, 0xce, 0x7b, 0xcf, 0x7b, 0xd0, 0x7b, 0xd2,
+	0x7b, 0xd4, 0x7b, 0xd5, 0x7b, 0xd6, 0x7b, 0xd7, 0x7b, 0xd8, 0x7b, 0xdb,
+	0x7b, 0xdc, 0x7b, 0xde, 0x7b, 0xdf, 0x7b, 0xe0, 0x7b, 0xe2, 0x7b, 0xe3,
+	0x7b, 0xe4, 0x7b, 0xe7, 0x7b, 0xe8, 0x7b, 0xe9, 0x7b, 0xeb, 0x7b, 0xec,
+	0x7b, 0xed, 0x7b, 0xef, 0x7b, 0xf0, 0x7b, 0xf2, 0x7b, 0xf3, 0x7b, 0xf4,
+	0x7b, 0xf5, 0x7b, 0xf6, 0x7b, 0xf8, 0x7b, 0xf9, 0x7b, 0xfa, 0x7b, 0xfb,
+	0x7b, 0xfd, 0x7b, 0xff, 0x7c, 0x00, 0x7c, 0x01, 0x7c, 0x02, 0x7c, 0x03,
+	0x7c, 0x04, 0x7c, 0x05, 0x7c, 0x06, 0x7c, 0x08, 0x7c, 0x09, 0x7c, 0x0a,
+	0x7c, 0x0d, 0x7c, 0x0e, 0x7c, 0x10, 0x7c, 0x11, 0x7c, 0x12, 0x7c, 0x13,
+	0x7c, 0x14, 0x7c, 0x15, 0x7c, 0x17, 0x7c, 0x18, 0x7c, 0x19, 0x7c, 0x1a,
+	0x7c, 0x1b, 0x7c, 0x1c, 0x7c, 0x1d, 0x7c, 0x1e, 0x7c, 0x20, 0x7c, 0x21,
+	0x7c, 0x22, 0x7c, 0x23, 0x7c, 0x24, 0x7c, 0x25, 0x7c, 0x28, 0x7c, 0x29,
+	0x7c, 0x2b, 0x7c, 0x2c, 0x7c, 0x2d, 0x7c, 0x2e, 0x7c, 0x2f, 0x7c, 0x30,
+	0x7c, 0x31, 0x7c, 0x32, 0x7c, 0x33, 0x7c, 0x34, 0x7c, 0x35, 0x7c, 0x36,
+	0x7c, 0x37, 0x7c, 0x39, 0x7c, 0x3a, 0x7c, 0x3b, 0x7c, 0x3c, 0x7c, 0x3d,
+	0x7c, 0x3e, 0x7c, 0x42, 0x9a, 0xb8, 0x5b, 0x69, 0x6d, 0x77, 0x6c, 0x26,
+	0x4e, 0xa5, 0x5b, 0xb3, 0x9a, 0x87, 0x91, 0x63, 0x61, 0xa8, 0x90, 0xaf,
+	0x97, 0xe9, 0x54, 0x2b, 0x6d, 0xb5, 0x5b, 0xd2, 0x51, 0xfd, 0x55, 0x8a,
+	0x7f, 0x55, 0x7f, 0xf0, 0x64, 0xbc, 0x63, 0x4d, 0x65, 0xf1, 0x61, 0xbe,
+	0x60, 0x8d, 0x71, 0x0a, 0x6c, 0x57, 0x6c, 0x49, 0x59, 0x2f, 0x67, 0x6d,
+	0x82, 0x2a, 0x58, 0xd5, 0x56, 0x8e, 0x8c, 0x6a, 0x6b, 0xeb, 0x90, 0xdd,
+	0x59, 0x7d, 0x80, 0x17, 0x53, 0xf7, 0x6d, 0x69, 0x54, 0x75, 0x55, 0x9d,
+	0x83, 0x77, 0x83, 0xcf, 0x68, 0x38, 0x79, 0xbe, 0x54, 0x8c, 0x4f, 0x55,
+	0x54, 0x08, 0x76, 0xd2, 0x8c, 0x89, 0x96, 0x02, 0x6c, 0xb3, 0x6d, 0xb8,
+	0x8d, 0x6b, 0x89, 0x10, 0x9e, 0x64, 0x8d, 0x3a, 0x56, 0x3f, 0x9e, 0xd1,
+	0x75, 0xd5, 0x5f, 0x88, 0x72, 0xe0, 0x60, 0x68, 0x54, 0xfc, 0x4e, 0xa8,
+	0x6a, 0x2a, 0x88, 0x61, 0x60, 0x52, 0x8f, 0x70, 0x54, 0xc4, 0x70, 0xd8,
+	0x86, 0x79, 0x9e, 0x3f, 0x6d, 0x2a, 0x5b, 0x8f, 0x5f, 0x18, 0x7e, 0xa2,
+	0x55, 0x89, 0x4f, 0xaf, 0x73, 0x34, 0x54, 0x3c, 0x53, 0x9a, 0x50, 0x19,
+	0x54, 0x0e, 0x54, 0x7c, 0x4e, 0x4e, 0x5f, 0xfd, 0x74, 0x5a, 0x58, 0xf6,
+	0x84, 0x6b, 0x80, 0xe1, 0x87, 0x74, 0x72, 0xd0, 0x7c, 0xca, 0x6e, 0x56,
+	0x7c, 0x43, 0x7c, 0x44, 0x7c, 0x45, 0x7c, 0x46, 0x7c, 0x47, 0x7c, 0x48,
+	0x7c, 0x49, 0x7c, 0x4a, 0x7c, 0x4b, 0x7c, 0x4c, 0x7c, 0x4e, 0x7c, 0x4f,
+	0x7c, 0x50, 0x7c, 0x51, 0x7c, 0x52, 0x7c, 0x53, 0x7c, 0x54, 0x7c, 0x55,
+	0x7c, 0x56, 0x7c, 0x57, 0x7c, 0x58, 0x7c, 0x59, 0x7c, 0x5a, 0x7c, 0x5b,
+	0x7c, 0x5c, 0x7c, 0x5d, 0x7c, 0x5e, 0x7c, 0x5f, 0x7c, 0x60, 0x7c, 0x61,
+	0x7c, 0x62, 0x7c, 0x63, 0x7c, 0x64, 0x7c, 0x65, 0x7c, 0x66, 0x7c, 0x67,
+	0x7c, 0x68, 0x7c, 0x69, 0x7c, 0x6a, 0x7c, 0x6b, 0x7c, 0x6c, 0x7c, 0x6d,
+	0x7c, 0x6e, 0x7c, 0x6f, 0x7c, 0x70, 0x7c, 0x71, 0x7c, 0x72, 0x7c, 0x75,
+	0x7c, 0x76, 0x7c, 0x77, 0x7c, 0x78, 0x7c, 0x79, 0x7c, 0x7a, 0x7c, 0x7e,
+	0x7c, 0x7f, 0x7c, 0x80, 0x7c, 0x81, 0x7c, 0x82, 0x7c, 0x83, 0x7c, 0x84,
+	0x7c, 0x85, 0x7c, 0x86, 0x7c, 0x87, 0x7c, 0x88, 0x7c, 0x8a, 0x7c, 0x8b,
+	0x7c, 0x8c, 0x7c, 0x8d, 0x7c, 0x8e, 0x7c, 0x8f, 0x7c, 0x90, 0x7c, 0x93,
+	0x7c, 0x94, 0x7c, 0x96, 0x7c, 0x99, 0x7c, 0x9a, 0x7c, 0x9b, 0x7c, 0xa0,
+	0x7c, 0xa1, 0x7c, 0xa3, 0x7c, 0xa6, 0x7c, 0xa7, 0x7c, 0xa8, 0x7c, 0xa9,
+	0x7c, 0xab, 0x7c, 0xac, 0x7c, 0xad, 0x7c, 0xaf, 0x7c, 0xb0, 0x7c, 0xb4,
+	0x7c, 0xb5, 0x7c, 0xb6, 0x7c, 0xb7, 0x7c, 0xb8, 0x7c, 0xba, 0x7c, 0xbb,
+	0x5f, 0x27, 0x86, 0x4e, 0x55, 0x2c, 0x62, 0xa4, 0x4e, 0x92, 0x6c, 0xaa,
+	0x62, 0x37, 0x82, 0xb1, 0x54, 0xd7, 0x53, 0x4e, 0x73, 0x3e, 0x6e, 0xd1,
+	0x75, 0x3b, 0x52, 0x12, 0x53, 0x16, 0x8b, 0xdd, 0x69, 0xd0, 0x5f, 0x8a,
+	0x60, 0x00, 0x6d, 0xee, 0x57, 0x4f, 0x6b, 0x22, 0x73, 0xaf, 0x68, 0x53,
+	0x8f, 0xd8, 0x7f, 0x13, 0x63, 0x62, 0x60, 0xa3, 0x55, 0x24, 0x75, 0xea,
+	0x8c, 0x62, 0x71, 0x15, 0x6d, 0xa3, 0x5b, 0xa6, 0x5e, 0x7b, 0x83, 0x52,
+	0x61, 0x4c, 0x9e, 0xc4, 0x78, 0xfa, 0x87, 0x57, 0x7c, 0x27, 0x76, 0x87,
+	0x51, 0xf0, 0x60, 0xf6, 0x71, 0x4c, 0x66, 0x43, 0x5e, 0x4c, 0x60, 0x4d,
+	0x8c, 0x0e, 0x70, 0x70, 0x63, 0x25, 0x8f, 0x89, 0x5f, 0xbd, 0x60, 0x62,
+	0x86, 0xd4, 0x56, 0xde, 0x6b, 0xc1, 0x60, 0x94, 0x61, 0x67, 0x53, 0x49,
+	0x60, 0xe0, 0x66, 0x66, 0x8d, 0x3f, 0x79, 0xfd, 0x4f, 0x1a, 0x70, 0xe9,
+	0x6c, 0x47, 0x8b, 0xb3, 0x8b, 0xf2, 0x7e, 0xd8, 0x83, 0x64, 0x66, 0x0f,
+	0x5a, 0x5a, 0x9b, 0x42, 0x6d, 0x51, 0x6d, 0xf7, 0x8c, 0x41, 0x6d, 0x3b,
+	0x4f, 0x19, 0x70, 0x6b, 0x83, 0xb7, 0x62, 0x16, 0x60, 0xd1, 0x97, 0x0d,
+	0x8d, 0x27, 0x79, 0x78, 0x51, 0xfb, 0x57, 0x3e, 0x57, 0xfa, 0x67, 0x3a,
+	0x75, 0x78, 0x7a, 0x3d, 0x79, 0xef, 0x7b, 0x95, 0x7c, 0xbf, 0x7c, 0xc0,
+	0x7c, 0xc2, 0x7c, 0xc3, 0x7c, 0xc4, 0x7c, 0xc6, 0x7c, 0xc9, 0x7c, 0xcb,
+	0x7c, 0xce, 0x7c, 0xcf, 0x7c, 0xd0, 0x7c, 0xd1, 0x7c, 0xd2, 0x7c, 0xd3,
+	0x7c, 0xd4, 0x7c, 0xd8, 0x7c, 0xda, 0x7c, 0xdb, 0x7c, 0xdd, 0x7c, 0xde,
+	0x7c, 0xe1, 0x7c, 0xe2, 0x7c, 0xe3, 0x7c, 0xe4, 0x7c, 0xe5, 0x7c, 0xe6,
+	0x7c, 0xe7, 0x7c, 0xe9, 0x7c, 0xea, 0x7c, 0xeb, 0x7c, 0xec, 0x7c, 0xed,
+	0x7c, 0xee, 0x7c, 0xf0, 0x7c, 0xf1, 0x7c, 0xf2, 0x7c, 0xf3, 0x7c, 0xf4,
+	0x7c, 0xf5, 0x7c, 0xf6, 0x7c, 0xf7, 0x7c, 0xf9, 0x7c, 0xfa, 0x7c, 0xfc,
+	0x7c, 0xfd, 0x7c, 0xfe, 0x7c, 0xff, 0x7d, 0x00, 0x7d, 0x01, 0x7d, 0x02,
+	0x7d, 0x03, 0x7d, 0x04, 0x7d, 0x05, 0x7d, 0x06, 0x7d, 0x07, 0x7d, 0x08,
+	0x7d, 0x09, 0x7d, 0x0b, 0x7d, 0x0c, 0x7d, 0x0d, 0x7d, 0x0e, 0x7d, 0x0f,
+	0x7d, 0x10, 0x7d, 0x11, 0x7d, 0x12, 0x7d, 0x13, 0x7d, 0x14, 0x7d, 0x15,
+	0x7d, 0x16, 0x7d, 0x17, 0x7d, 0x18, 0x7d, 0x19, 0x7d, 0x1a, 0x7d, 0x1b,
+	0x7d, 0x1c, 0x7d, 0x1d, 0x7d, 0x1e, 0x7d, 0x1f, 0x7d, 0x21, 0x7d, 0x23,
+	0x7d, 0x24, 0x7d, 0x25, 0x7d, 0x26, 0x7d, 0x28, 0x7d, 0x29, 0x7d, 0x2a,
+	0x7d, 0x2c, 0x7d, 0x2d, 0x7d, 0x2e, 0x7d, 0x30, 0x7d, 0x31, 0x7d, 0x32,
+	0x7d, 0x33, 0x7d, 0x34, 0x7d, 0x35, 0x7d, 0x36, 0x80, 0x8c, 0x99, 0x65,
+	0x8f, 0xf9, 0x6f, 0xc0, 0x8b, 0xa5, 0x9e, 0x21, 0x59, 0xec, 0x7e, 0xe9,
+	0x7f, 0x09, 0x54, 0x09, 0x67, 0x81, 0x68, 0xd8, 0x8f, 0x91, 0x7c, 0x4d,
+	0x96, 0xc6, 0x53, 0xca, 0x60, 0x25, 0x75, 0xbe, 0x6c, 0x72, 0x53, 0x73,
+	0x5a, 0xc9, 0x7e, 0xa7, 0x63, 0x24, 0x51, 0xe0, 0x81, 0x0a, 0x5d, 0xf1,
+	0x84, 0xdf, 0x62, 0x80, 0x51, 0x80, 0x5b, 0x63, 0x4f, 0x0e, 0x79, 0x6d,
+	0x52, 0x42, 0x60, 0xb8, 0x6d, 0x4e, 0x5b, 0xc4, 0x5b, 0xc2, 0x8b, 0xa1,
+	0x8b, 0xb0, 0x65, 0xe2, 0x5f, 0xcc, 0x96, 0x45, 0x59, 0x93, 0x7e, 0xe7,
+	0x7e, 0xaa, 0x56, 0x09, 0x67, 0xb7, 0x59, 0x39, 0x4f, 0x73, 0x5b, 0xb6,
+	0x52, 0xa0, 0x83, 0x5a, 0x98, 0x8a, 0x8d, 0x3e, 0x75, 0x32, 0x94, 0xbe,
+	0x50, 0x47, 0x7a, 0x3c, 0x4e, 0xf7, 0x67, 0xb6, 0x9a, 0x7e, 0x5a, 0xc1,
+	0x6b, 0x7c, 0x76, 0xd1, 0x57, 0x5a, 0x5c, 0x16, 0x7b, 0x3a, 0x95, 0xf4,
+	0x71, 0x4e, 0x51, 0x7c, 0x80, 0xa9, 0x82, 0x70, 0x59, 0x78, 0x7f, 0x04,
+	0x83, 0x27, 0x68, 0xc0, 0x67, 0xec, 0x78, 0xb1, 0x78, 0x77, 0x62, 0xe3,
+	0x63, 0x61, 0x7b, 0x80, 0x4f, 0xed, 0x52, 0x6a, 0x51, 0xcf, 0x83, 0x50,
+	0x69, 0xdb, 0x92, 0x74, 0x8d, 0xf5, 0x8d, 0x31, 0x89, 0xc1, 0x95, 0x2e,
+	0x7b, 0xad, 0x4e, 0xf6, 0x7d, 0x37, 0x7d, 0x38, 0x7d, 0x39, 0x7d, 0x3a,
+	0x7d, 0x3b, 0x7d, 0x3c, 0x7d, 0x3d, 0x7d, 0x3e, 0x7d, 0x3f, 0x7d, 0x40,
+	0x7d, 0x41, 0x7d, 0x42, 0x7d, 0x43, 0x7d, 0x44, 0x7d, 0x45, 0x7d, 0x46,
+	0x7d, 0x47, 0x7d, 0x48, 0x7d, 0x49, 0x7d, 0x4a, 0x7d, 0x4b, 0x7d, 0x4c,
+	0x7d, 0x4d, 0x7d, 0x4e, 0x7d, 0x4f, 0x7d, 0x50, 0x7d, 0x51, 0x7d, 0x52,
+	0x7d, 0x53, 0x7d, 0x54, 0x7d, 0x55, 0x7d, 0x56, 0x7d, 0x57, 0x7d, 0x58,
+	0x7d, 0x59, 0x7d, 0x5a, 0x7d, 0x5b, 0x7d, 0x5c, 0x7d, 0x5d, 0x7d, 0x5e,
+	0x7d, 0x5f, 0x7d, 0x60, 0x7d, 0x61, 0x7d, 0x62, 0x7d, 0x63, 0x7d, 0x64,
+	0x7d, 0x65, 0x7d, 0x66, 0x7d, 0x67, 0x7d, 0x68, 0x7d, 0x69, 0x7d, 0x6a,
+	0x7d, 0x6b, 0x7d, 0x6c, 0x7d, 0x6d, 0x7d, 0x6f, 0x7d, 0x70, 0x7d, 0x71,
+	0x7d, 0x72, 0x7d, 0x73, 0x7d, 0x74, 0x7d, 0x75, 0x7d, 0x76, 0x7d, 0x78,
+	0x7d, 0x79, 0x7d, 0x7a, 0x7d, 0x7b, 0x7d, 0x7c, 0x7d, 0x7d, 0x7d, 0x7e,
+	0x7d, 0x7f, 0x7d, 0x80, 0x7d, 0x81, 0x7d, 0x82, 0x7d, 0x83, 0x7d, 0x84,
+	0x7d, 0x85, 0x7d, 0x86, 0x7d, 0x87, 0x7d, 0x88, 0x7d, 0x89, 0x7d, 0x8a,
+	0x7d, 0x8b, 0x7d, 0x8c, 0x7d, 0x8d, 0x7d, 0x8e, 0x7d, 0x8f, 0x7d, 0x90,
+	0x7d, 0x91, 0x7d, 0x92, 0x7d, 0x93, 0x7d, 0x94, 0x7d, 0x95, 0x7d, 0x96,
+	0x7d, 0x97, 0x7d, 0x98, 0x50, 0x65, 0x82, 0x30, 0x52, 0x51, 0x99, 0x6f,
+	0x6e, 0x10, 0x6e, 0x85, 0x6d, 0xa7, 0x5e, 0xfa, 0x50, 0xf5, 0x59, 0xdc,
+	0x5c, 0x06, 0x6d, 0x46, 0x6c, 0x5f, 0x75, 0x86, 0x84, 0x8b, 0x68, 0x68,
+	0x59, 0x56, 0x8b, 0xb2, 0x53, 0x20, 0x91, 0x71, 0x96, 0x4d, 0x85, 0x49,
+	0x69, 0x12, 0x79, 0x01, 0x71, 0x26, 0x80, 0xf6, 0x4e, 0xa4, 0x90, 0xca,
+	0x6d, 0x47, 0x9a, 0x84, 0x5a, 0x07, 0x56, 0xbc, 0x64, 0x05, 0x94, 0xf0,
+	0x77, 0xeb, 0x4f, 0xa5, 0x81, 0x1a, 0x72, 0xe1, 0x89, 0xd2, 0x99, 0x7a,
+	0x7f, 0x34, 0x7e, 0xde, 0x52, 0x7f, 0x65, 0x59, 0x91, 0x75, 0x8f, 0x7f,
+	0x8f, 0x83, 0x53, 0xeb, 0x7a, 0x96, 0x63, 0xed, 0x63, 0xa5, 0x76, 0x86,
+	0x79, 0xf8, 0x88, 0x57, 0x96, 0x36, 0x62, 0x2a, 0x52, 0xab, 0x82, 0x82,
+	0x68, 0x54, 0x67, 0x70, 0x63, 0x77, 0x77, 0x6b, 0x7a, 0xed, 0x6d, 0x01,
+	0x7e, 0xd3, 0x89, 0xe3, 0x59, 0xd0, 0x62, 0x12, 0x85, 0xc9, 0x82, 0xa5,
+	0x75, 0x4c, 0x50, 0x1f, 0x4e, 0xcb, 0x75, 0xa5, 0x8b, 0xeb, 0x5c, 0x4a,
+	0x5d, 0xfe, 0x7b, 0x4b, 0x65, 0xa4, 0x91, 0xd1, 0x4e, 0xca, 0x6d, 0x25,
+	0x89, 0x5f, 0x7d, 0x27, 0x95, 0x26, 0x4e, 0xc5, 0x8c, 0x28, 0x8f, 0xdb,
+	0x97, 0x73, 0x66, 0x4b, 0x79, 0x81, 0x8f, 0xd1, 0x70, 0xec, 0x6d, 0x78,
+	0x7d, 0x99, 0x7d, 0x9a, 0x7d, 0x9b, 0x7d, 0x9c, 0x7d, 0x9d, 0x7d, 0x9e,
+	0x7d, 0x9f, 0x7d, 0xa0, 0x7d, 0xa1, 0x7d, 0xa2, 0x7d, 0xa3, 0x7d, 0xa4,
+	0x7d, 0xa5, 0x7d, 0xa7, 0x7d, 0xa8, 0x7d, 0xa9, 0x7d, 0xaa, 0x7d, 0xab,
+	0x7d, 0xac, 0x7d, 0xad, 0x7d, 0xaf, 0x7d, 0xb0, 0x7d, 0xb1, 0x7d, 0xb2,
+	0x7d, 0xb3, 0x7d, 0xb4, 0x7d, 0xb5, 0x7d, 0xb6, 0x7d, 0xb7, 0x7d, 0xb8,
+	0x7d, 0xb9, 0x7d, 0xba, 0x7d, 0xbb, 0x7d, 0xbc, 0x7d, 0xbd, 0x7d, 0xbe,
+	0x7d, 0xbf, 0x7d, 0xc0, 0x7d, 0xc1, 0x7d, 0xc2, 0x7d, 0xc3, 0x7d, 0xc4,
+	0x7d, 0xc5, 0x7d, 0xc6, 0x7d, 0xc7, 0x7d, 0xc8, 0x7d, 0xc9, 0x7d, 0xca,
+	0x7d, 0xcb, 0x7d, 0xcc, 0x7d, 0xcd, 0x7d, 0xce, 0x7d, 0xcf, 0x7d, 0xd0,
+	0x7d, 0xd1, 0x7d, 0xd2, 0x7d, 0xd3, 0x7d, 0xd4, 0x7d, 0xd5, 0x7d, 0xd6,
+	0x7d, 0xd7, 0x7d, 0xd8, 0x7d, 0xd9, 0x7d, 0xda, 0x7d, 0xdb, 0x7d, 0xdc,
+	0x7d, 0xdd, 0x7d, 0xde, 0x7d, 0xdf, 0x7d, 0xe0, 0x7d, 0xe1, 0x7d, 0xe2,
+	0x7d, 0xe3, 0x7d, 0xe4, 0x7d, 0xe5, 0x7d, 0xe6, 0x7d, 0xe7, 0x7d, 0xe8,
+	0x7d, 0xe9, 0x7d, 0xea, 0x7d, 0xeb, 0x7d, 0xec, 0x7d, 0xed, 0x7d, 0xee,
+	0x7d, 0xef, 0x7d, 0xf0, 0x7d, 0xf1, 0x7d, 0xf2, 0x7d, 0xf3, 0x7d, 0xf4,
+	0x7d, 0xf5, 0x7d, 0xf6, 0x7d, 0xf7, 0x7d, 0xf8, 0x7d, 0xf9, 0x7d, 0xfa,
+	0x5c, 0x3d, 0x52, 0xb2, 0x83, 0x46, 0x51, 0x62, 0x83, 0x0e, 0x77, 0x5b,
+	0x66, 0x76, 0x9c, 0xb8, 0x4e, 0xac, 0x60, 0xca, 0x7c, 0xbe, 0x7c, 0xb3,
+	0x7e, 0xcf, 0x4e, 0x95, 0x8b, 0x66, 0x66, 0x6f, 0x98, 0x88, 0x97, 0x59,
+	0x58, 0x83, 0x65, 0x6c, 0x95, 0x5c, 0x5f, 0x84, 0x75, 0xc9, 0x97, 0x56,
+	0x7a, 0xdf, 0x7a, 0xde, 0x51, 0xc0, 0x70, 0xaf, 0x7a, 0x98, 0x63, 0xea,
+	0x7a, 0x76, 0x7e, 0xa0, 0x73, 0x96, 0x97, 0xed, 0x4e, 0x45, 0x70, 0x78,
+	0x4e, 0x5d, 0x91, 0x52, 0x53, 0xa9, 0x65, 0x51, 0x65, 0xe7, 0x81, 0xfc,
+	0x82, 0x05, 0x54, 0x8e, 0x5c, 0x31, 0x75, 0x9a, 0x97, 0xa0, 0x62, 0xd8,
+	0x72, 0xd9, 0x75, 0xbd, 0x5c, 0x45, 0x9a, 0x79, 0x83, 0xca, 0x5c, 0x40,
+	0x54, 0x80, 0x77, 0xe9, 0x4e, 0x3e, 0x6c, 0xae, 0x80, 0x5a, 0x62, 0xd2,
+	0x63, 0x6e, 0x5d, 0xe8, 0x51, 0x77, 0x8d, 0xdd, 0x8e, 0x1e, 0x95, 0x2f,
+	0x4f, 0xf1, 0x53, 0xe5, 0x60, 0xe7, 0x70, 0xac, 0x52, 0x67, 0x63, 0x50,
+	0x9e, 0x43, 0x5a, 0x1f, 0x50, 0x26, 0x77, 0x37, 0x53, 0x77, 0x7e, 0xe2,
+	0x64, 0x85, 0x65, 0x2b, 0x62, 0x89, 0x63, 0x98, 0x50, 0x14, 0x72, 0x35,
+	0x89, 0xc9, 0x51, 0xb3, 0x8b, 0xc0, 0x7e, 0xdd, 0x57, 0x47, 0x83, 0xcc,
+	0x94, 0xa7, 0x51, 0x9b, 0x54, 0x1b, 0x5c, 0xfb, 0x7d, 0xfb, 0x7d, 0xfc,
+	0x7d, 0xfd, 0x7d, 0xfe, 0x7d, 0xff, 0x7e, 0x00, 0x7e, 0x01, 0x7e, 0x02,
+	0x7e, 0x03, 0x7e, 0x04, 0x7e, 0x05, 0x7e, 0x06, 0x7e, 0x07, 0x7e, 0x08,
+	0x7e, 0x09, 0x7e, 0x0a, 0x7e, 0x0b, 0x7e, 0x0c, 0x7e, 0x0d, 0x7e, 0x0e,
+	0x7e, 0x0f, 0x7e, 0x10, 0x7e, 0x11, 0x7e, 0x12, 0x7e, 0x13, 0x7e, 0x14,
+	0x7e, 0x15, 0x7e, 0x16, 0x7e, 0x17, 0x7e, 0x18, 0x7e, 0x19, 0x7e, 0x1a,
+	0x7e, 0x1b, 0x7e, 0x1c, 0x7e, 0x1d, 0x7e, 0x1e, 0x7e, 0x1f, 0x7e, 0x20,
+	0x7e, 0x21, 0x7e, 0x22, 0x7e, 0x23, 0x7e, 0x24, 0x7e, 0x25, 0x7e, 0x26,
+	0x7e, 0x27, 0x7e, 0x28, 0x7e, 0x29, 0x7e, 0x2a, 0x7e, 0x2b, 0x7e, 0x2c,
+	0x7e, 0x2d, 0x7e, 0x2e, 0x7e, 0x2f, 0x7e, 0x30, 0x7e, 0x31, 0x7e, 0x32,
+	0x7e, 0x33, 0x7e, 0x34, 0x7e, 0x35, 0x7e, 0x36, 0x7e, 0x37, 0x7e, 0x38,
+	0x7e, 0x39, 0x7e, 0x3a, 0x7e, 0x3c, 0x7e, 0x3d, 0x7e, 0x3e, 0x7e, 0x3f,
+	0x7e, 0x40, 0x7e, 0x42, 0x7e, 0x43, 0x7e, 0x44, 0x7e, 0x45, 0x7e, 0x46,
+	0x7e, 0x48, 0x7e, 0x49, 0x7e, 0x4a, 0x7e, 0x4b, 0x7e, 0x4c, 0x7e, 0x4d,
+	0x7e, 0x4e, 0x7e, 0x4f, 0x7e, 0x50, 0x7e, 0x51, 0x7e, 0x52, 0x7e, 0x53,
+	0x7e, 0x54, 0x7e, 0x55, 0x7e, 0x56, 0x7e, 0x57, 0x7e, 0x58, 0x7e, 0x59,
+	0x7e, 0x5a, 0x7e, 0x5b, 0x7e, 0x5c, 0x7e, 0x5d, 0x4f, 0xca, 0x7a, 0xe3,
+	0x6d, 0x5a, 0x90, 0xe1, 0x9a, 0x8f, 0x55, 0x80, 0x54, 0x96, 0x53, 0x61,
+	0x54, 0xaf, 0x5f, 0x00, 0x63, 0xe9, 0x69, 0x77, 0x51, 0xef, 0x61, 0x68,
+	0x52, 0x0a, 0x58, 0x2a, 0x52, 0xd8, 0x57, 0x4e, 0x78, 0x0d, 0x77, 0x0b,
+	0x5e, 0xb7, 0x61, 0x77, 0x7c, 0xe0, 0x62, 0x5b, 0x62, 0x97, 0x4e, 0xa2,
+	0x70, 0x95, 0x80, 0x03, 0x62, 0xf7, 0x70, 0xe4, 0x97, 0x60, 0x57, 0x77,
+	0x82, 0xdb, 0x67, 0xef, 0x68, 0xf5, 0x78, 0xd5, 0x98, 0x97, 0x79, 0xd1,
+	0x58, 0xf3, 0x54, 0xb3, 0x53, 0xef, 0x6e, 0x34, 0x51, 0x4b, 0x52, 0x3b,
+	0x5b, 0xa2, 0x8b, 0xfe, 0x80, 0xaf, 0x55, 0x43, 0x57, 0xa6, 0x60, 0x73,
+	0x57, 0x51, 0x54, 0x2d, 0x7a, 0x7a, 0x60, 0x50, 0x5b, 0x54, 0x63, 0xa7,
+	0x62, 0xa0, 0x53, 0xe3, 0x62, 0x63, 0x5b, 0xc7, 0x67, 0xaf, 0x54, 0xed,
+	0x7a, 0x9f, 0x82, 0xe6, 0x91, 0x77, 0x5e, 0x93, 0x88, 0xe4, 0x59, 0x38,
+	0x57, 0xae, 0x63, 0x0e, 0x8d, 0xe8, 0x80, 0xef, 0x57, 0x57, 0x7b, 0x77,
+	0x4f, 0xa9, 0x5f, 0xeb, 0x5b, 0xbd, 0x6b, 0x3e, 0x53, 0x21, 0x7b, 0x50,
+	0x72, 0xc2, 0x68, 0x46, 0x77, 0xff, 0x77, 0x36, 0x65, 0xf7, 0x51, 0xb5,
+	0x4e, 0x8f, 0x76, 0xd4, 0x5c, 0xbf, 0x7a, 0xa5, 0x84, 0x75, 0x59, 0x4e,
+	0x9b, 0x41, 0x50, 0x80, 0x7e, 0x5e, 0x7e, 0x5f, 0x7e, 0x60, 0x7e, 0x61,
+	0x7e, 0x62, 0x7e, 0x63, 0x7e, 0x64, 0x7e, 0x65, 0x7e, 0x66, 0x7e, 0x67,
+	0x7e, 0x68, 0x7e, 0x69, 0x7e, 0x6a, 0x7e, 0x6b, 0x7e, 0x6c, 0x7e, 0x6d,
+	0x7e, 0x6e, 0x7e, 0x6f, 0x7e, 0x70, 0x7e, 0x71, 0x7e, 0x72, 0x7e, 0x73,
+	0x7e, 0x74, 0x7e, 0x75, 0x7e, 0x76, 0x7e, 0x77, 0x7e, 0x78, 0x7e, 0x79,
+	0x7e, 0x7a, 0x7e, 0x7b, 0x7e, 0x7c, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7f,
+	0x7e, 0x80, 0x7e, 0x81, 0x7e, 0x83, 0x7e, 0x84, 0x7e, 0x85, 0x7e, 0x86,
+	0x7e, 0x87, 0x7e, 0x88, 0x7e, 0x89, 0x7e, 0x8a, 0x7e, 0x8b, 0x7e, 0x8c,
+	0x7e, 0x8d, 0x7e, 0x8e, 0x7e, 0x8f, 0x7e, 0x90, 0x7e, 0x91, 0x7e, 0x92,
+	0x7e, 0x93, 0x7e, 0x94, 0x7e, 0x95, 0x7e, 0x96, 0x7e, 0x97, 0x7e, 0x98,
+	0x7e, 0x99, 0x7e, 0x9a, 0x7e, 0x9c, 0x7e, 0x9d, 0x7e, 0x9e, 0x7e, 0xae,
+	0x7e, 0xb4, 0x7e, 0xbb, 0x7e, 0xbc, 0x7e, 0xd6, 0x7e, 0xe4, 0x7e, 0xec,
+	0x7e, 0xf9, 0x7f, 0x0a, 0x7f, 0x10, 0x7f, 0x1e, 0x7f, 0x37, 0x7f, 0x39,
+	0x7f, 0x3b, 0x7f, 0x3c, 0x7f, 0x3d, 0x7f, 0x3e, 0x7f, 0x3f, 0x7f, 0x40,
+	0x7f, 0x41, 0x7f, 0x43, 0x7f, 0x46, 0x7f, 0x47, 0x7f, 0x48, 0x7f, 0x49,
+	0x7f, 0x4a, 0x7f, 0x4b, 0x7f, 0x4c, 0x7f, 0x4d, 0x7f, 0x4e, 0x7f, 0x4f,
+	0x7f, 0x52, 0x7f, 0x53, 0x99, 0x88, 0x61, 0x27, 0x6e, 0x83, 0x57, 0x64,
+	0x66, 0x06, 0x63, 0x46, 0x56, 0xf0, 0x62, 0xec, 0x62, 0x69, 0x5e, 0xd3,
+	0x96, 0x14, 0x57, 0x83, 0x62, 0xc9, 0x55, 0x87, 0x87, 0x21, 0x81, 0x4a,
+	0x8f, 0xa3, 0x55, 0x66, 0x83, 0xb1, 0x67, 0x65, 0x8d, 0x56, 0x84, 0xdd,
+	0x5a, 0x6a, 0x68, 0x0f, 0x62, 0xe6, 0x7b, 0xee, 0x96, 0x11, 0x51, 0x70,
+	0x6f, 0x9c, 0x8c, 0x30, 0x63, 0xfd, 0x89, 0xc8, 0x61, 0xd2, 0x7f, 0x06,
+	0x70, 0xc2, 0x6e, 0xe5, 0x74, 0x05, 0x69, 0x94, 0x72, 0xfc, 0x5e, 0xca,
+	0x90, 0xce, 0x67, 0x17, 0x6d, 0x6a, 0x63, 0x5e, 0x52, 0xb3, 0x72, 0x62,
+	0x80, 0x01, 0x4f, 0x6c, 0x59, 0xe5, 0x91, 0x6a, 0x70, 0xd9, 0x6d, 0x9d,
+	0x52, 0xd2, 0x4e, 0x50, 0x96, 0xf7, 0x95, 0x6d, 0x85, 0x7e, 0x78, 0xca,
+	0x7d, 0x2f, 0x51, 0x21, 0x57, 0x92, 0x64, 0xc2, 0x80, 0x8b, 0x7c, 0x7b,
+	0x6c, 0xea, 0x68, 0xf1, 0x69, 0x5e, 0x51, 0xb7, 0x53, 0x98, 0x68, 0xa8,
+	0x72, 0x81, 0x9e, 0xce, 0x7b, 0xf1, 0x72, 0xf8, 0x79, 0xbb, 0x6f, 0x13,
+	0x74, 0x06, 0x67, 0x4e, 0x91, 0xcc, 0x9c, 0xa4, 0x79, 0x3c, 0x83, 0x89,
+	0x83, 0x54, 0x54, 0x0f, 0x68, 0x17, 0x4e, 0x3d, 0x53, 0x89, 0x52, 0xb1,
+	0x78, 0x3e, 0x53, 0x86, 0x52, 0x29, 0x50, 0x88, 0x4f, 0x8b, 0x4f, 0xd0,
+	0x7f, 0x56, 0x7f, 0x59, 0x7f, 0x5b, 0x7f, 0x5c, 0x7f, 0x5d, 0x7f, 0x5e,
+	0x7f, 0x60, 0x7f, 0x63, 0x7f, 0x64, 0x7f, 0x65, 0x7f, 0x66, 0x7f, 0x67,
+	0x7f, 0x6b, 0x7f, 0x6c, 0x7f, 0x6d, 0x7f, 0x6f, 0x7f, 0x70, 0x7f, 0x73,
+	0x7f, 0x75, 0x7f, 0x76, 0x7f, 0x77, 0x7f, 0x78, 0x7f, 0x7a, 0x7f, 0x7b,
+	0x7f, 0x7c, 0x7f, 0x7d, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x82, 0x7f, 0x83,
+	0x7f, 0x84, 0x7f, 0x85, 0x7f, 0x86, 0x7f, 0x87, 0x7f, 0x88, 0x7f, 0x89,
+	0x7f, 0x8b, 0x7f, 0x8d, 0x7f, 0x8f, 0x7f, 0x90, 0x7f, 0x91, 0x7f, 0x92,
+	0x7f, 0x93, 0x7f, 0x95, 0x7f, 0x96, 0x7f, 0x97, 0x7f, 0x98, 0x7f, 0x99,
+	0x7f, 0x9b, 0x7f, 0x9c, 0x7f, 0xa0, 0x7f, 0xa2, 0x7f, 0xa3, 0x7f, 0xa5,
+	0x7f, 0xa6, 0x7f, 0xa8, 0x7f, 0xa9, 0x7f, 0xaa, 0x7f, 0xab, 0x7f, 0xac,
+	0x7f, 0xad, 0x7f, 0xae, 0x7f, 0xb1, 0x7f, 0xb3, 0x7f, 0xb4, 0x7f, 0xb5,
+	0x7f, 0xb6, 0x7f, 0xb7, 0x7f, 0xba, 0x7f, 0xbb, 0x7f, 0xbe, 0x7f, 0xc0,
+	0x7f, 0xc2, 0x7f, 0xc3, 0x7f, 0xc4, 0x7f, 0xc6, 0x7f, 0xc7, 0x7f, 0xc8,
+	0x7f, 0xc9, 0x7f, 0xcb, 0x7f, 0xcd, 0x7f, 0xcf, 0x7f, 0xd0, 0x7f, 0xd1,
+	0x7f, 0xd2, 0x7f, 0xd3, 0x7f, 0xd6, 0x7f, 0xd7, 0x7f, 0xd9, 0x7f, 0xda,
+	0x7f, 0xdb, 0x7f, 0xdc, 0x7f, 0xdd, 0x7f, 0xde, 0x7f, 0xe2, 0x7f, 0xe3,
+	0x75, 0xe2, 0x7a, 0xcb, 0x7c, 0x92, 0x6c, 0xa5, 0x96, 0xb6, 0x52, 0x9b,
+	0x74, 0x83, 0x54, 0xe9, 0x4f, 0xe9, 0x80, 0x54, 0x83, 0xb2, 0x8f, 0xde,
+	0x95, 0x70, 0x5e, 0xc9, 0x60, 0x1c, 0x6d, 0x9f, 0x5e, 0x18, 0x65, 0x5b,
+	0x81, 0x38, 0x94, 0xfe, 0x60, 0x4b, 0x70, 0xbc, 0x7e, 0xc3, 0x7c, 0xae,
+	0x51, 0xc9, 0x68, 0x81, 0x7c, 0xb1, 0x82, 0x6f, 0x4e, 0x24, 0x8f, 0x86,
+	0x91, 0xcf, 0x66, 0x7e, 0x4e, 0xae, 0x8c, 0x05, 0x64, 0xa9, 0x80, 0x4a,
+	0x50, 0xda, 0x75, 0x97, 0x71, 0xce, 0x5b, 0xe5, 0x8f, 0xbd, 0x6f, 0x66,
+	0x4e, 0x86, 0x64, 0x82, 0x95, 0x63, 0x5e, 0xd6, 0x65, 0x99, 0x52, 0x17,
+	0x88, 0xc2, 0x70, 0xc8, 0x52, 0xa3, 0x73, 0x0e, 0x74, 0x33, 0x67, 0x97,
+	0x78, 0xf7, 0x97, 0x16, 0x4e, 0x34, 0x90, 0xbb, 0x9c, 0xde, 0x6d, 0xcb,
+	0x51, 0xdb, 0x8d, 0x41, 0x54, 0x1d, 0x62, 0xce, 0x73, 0xb2, 0x83, 0xf1,
+	0x96, 0xf6, 0x9f, 0x84, 0x94, 0xc3, 0x4f, 0x36, 0x7f, 0x9a, 0x51, 0xcc,
+	0x70, 0x75, 0x96, 0x75, 0x5c, 0xad, 0x98, 0x86, 0x53, 0xe6, 0x4e, 0xe4,
+	0x6e, 0x9c, 0x74, 0x09, 0x69, 0xb4, 0x78, 0x6b, 0x99, 0x8f, 0x75, 0x59,
+	0x52, 0x18, 0x76, 0x24, 0x6d, 0x41, 0x67, 0xf3, 0x51, 0x6d, 0x9f, 0x99,
+	0x80, 0x4b, 0x54, 0x99, 0x7b, 0x3c, 0x7a, 0xbf, 0x7f, 0xe4, 0x7f, 0xe7,
+	0x7f, 0xe8, 0x7f, 0xea, 0x7f, 0xeb, 0x7f, 0xec, 0x7f, 0xed, 0x7f, 0xef,
+	0x7f, 0xf2, 0x7f, 0xf4, 0x7f, 0xf5, 0x7f, 0xf6, 0x7f, 0xf7, 0x7f, 0xf8,
+	0x7f, 0xf9, 0x7f, 0xfa, 0x7f, 0xfd, 0x7f, 0xfe, 0x7f, 0xff, 0x80, 0x02,
+	0x80, 0x07, 0x80, 0x08, 0x80, 0x09, 0x80, 0x0a, 0x80, 0x0e, 0x80, 0x0f,
+	0x80, 0x11, 0x80, 0x13, 0x80, 0x1a, 0x80, 0x1b, 0x80, 0x1d, 0x80, 0x1e,
+	0x80, 0x1f, 0x80, 0x21, 0x80, 0x23, 0x80, 0x24, 0x80, 0x2b, 0x80, 0x2c,
+	0x80, 0x2d, 0x80, 0x2e, 0x80, 0x2f, 0x80, 0x30, 0x80, 0x32, 0x80, 0x34,
+	0x80, 0x39, 0x80, 0x3a, 0x80, 0x3c, 0x80, 0x3e, 0x80, 0x40, 0x80, 0x41,
+	0x80, 0x44, 0x80, 0x45, 0x80, 0x47, 0x80, 0x48, 0x80, 0x49, 0x80, 0x4e,
+	0x80, 0x4f, 0x80, 0x50, 0x80, 0x51, 0x80, 0x53, 0x80, 0x55, 0x80, 0x56,
+	0x80, 0x57, 0x80, 0x59, 0x80, 0x5b, 0x80, 0x5c, 0x80, 0x5d, 0x80, 0x5e,
+	0x80, 0x5f, 0x80, 0x60, 0x80, 0x61, 0x80, 0x62, 0x80, 0x63, 0x80, 0x64,
+	0x80, 0x65, 0x80, 0x66, 0x80, 0x67, 0x80, 0x68, 0x80, 0x6b, 0x80, 0x6c,
+	0x80, 0x6d, 0x80, 0x6e, 0x80, 0x6f, 0x80, 0x70, 0x80, 0x72, 0x80, 0x73,
+	0x80, 0x74, 0x80, 0x75, 0x80, 0x76, 0x80, 0x77, 0x80, 0x78, 0x80, 0x79,
+	0x80, 0x7a, 0x80, 0x7b, 0x80, 0x7c, 0x80, 0x7d, 0x96, 0x86, 0x57, 0x84,
+	0x62, 0xe2, 0x96, 0x47, 0x69, 0x7c, 0x5a, 0x04, 0x64, 0x02, 0x7b, 0xd3,
+	0x6f, 0x0f, 0x96, 0x4b, 0x82, 0xa6, 0x53, 0x62, 0x98, 0x85, 0x5e, 0x90,
+	0x70, 0x89, 0x63, 0xb3, 0x53, 0x64, 0x86, 0x4f, 0x9c, 0x81, 0x9e, 0x93,
+	0x78, 0x8c, 0x97, 0x32, 0x8d, 0xef, 0x8d, 0x42, 0x9e, 0x7f, 0x6f, 0x5e,
+	0x79, 0x84, 0x5f, 0x55, 0x96, 0x46, 0x62, 0x2e, 0x9a, 0x74, 0x54, 0x15,
+	0x94, 0xdd, 0x4f, 0xa3, 0x65, 0xc5, 0x5c, 0x65, 0x5c, 0x61, 0x7f, 0x15,
+	0x86, 0x51, 0x6c, 0x2f, 0x5f, 0x8b, 0x73, 0x87, 0x6e, 0xe4, 0x7e, 0xff,
+	0x5c, 0xe6, 0x63, 0x1b, 0x5b, 0x6a, 0x6e, 0xe6, 0x53, 0x75, 0x4e, 0x71,
+	0x63, 0xa0, 0x75, 0x65, 0x62, 0xa1, 0x8f, 0x6e, 0x4f, 0x26, 0x4e, 0xd1,
+	0x6c, 0xa6, 0x7e, 0xb6, 0x8b, 0xba, 0x84, 0x1d, 0x87, 0xba, 0x7f, 0x57,
+	0x90, 0x3b, 0x95, 0x23, 0x7b, 0xa9, 0x9a, 0xa1, 0x88, 0xf8, 0x84, 0x3d,
+	0x6d, 0x1b, 0x9a, 0x86, 0x7e, 0xdc, 0x59, 0x88, 0x9e, 0xbb, 0x73, 0x9b,
+	0x78, 0x01, 0x86, 0x82, 0x9a, 0x6c, 0x9a, 0x82, 0x56, 0x1b, 0x54, 0x17,
+	0x57, 0xcb, 0x4e, 0x70, 0x9e, 0xa6, 0x53, 0x56, 0x8f, 0xc8, 0x81, 0x09,
+	0x77, 0x92, 0x99, 0x92, 0x86, 0xee, 0x6e, 0xe1, 0x85, 0x13, 0x66, 0xfc,
+	0x61, 0x62, 0x6f, 0x2b, 0x80, 0x7e, 0x80, 0x81, 0x80, 0x82, 0x80, 0x85,
+	0x80, 0x88, 0x80, 0x8a, 0x80, 0x8d, 0x80, 0x8e, 0x80, 0x8f, 0x80, 0x90,
+	0x80, 0x91, 0x80, 0x92, 0x80, 0x94, 0x80, 0x95, 0x80, 0x97, 0x80, 0x99,
+	0x80, 0x9e, 0x80, 0xa3, 0x80, 0xa6, 0x80, 0xa7, 0x80, 0xa8, 0x80, 0xac,
+	0x80, 0xb0, 0x80, 0xb3, 0x80, 0xb5, 0x80, 0xb6, 0x80, 0xb8, 0x80, 0xb9,
+	0x80, 0xbb, 0x80, 0xc5, 0x80, 0xc7, 0x80, 0xc8, 0x80, 0xc9, 0x80, 0xca,
+	0x80, 0xcb, 0x80, 0xcf, 0x80, 0xd0, 0x80, 0xd1, 0x80, 0xd2, 0x80, 0xd3,
+	0x80, 0xd4, 0x80, 0xd5, 0x80, 0xd8, 0x80, 0xdf, 0x80, 0xe0, 0x80, 0xe2,
+	0x80, 0xe3, 0x80, 0xe6, 0x80, 0xee, 0x80, 0xf5, 0x80, 0xf7, 0x80, 0xf9,
+	0x80, 0xfb, 0x80, 0xfe, 0x80, 0xff, 0x81, 0x00, 0x81, 0x01, 0x81, 0x03,
+	0x81, 0x04, 0x81, 0x05, 0x81, 0x07, 0x81, 0x08, 0x81, 0x0b, 0x81, 0x0c,
+	0x81, 0x15, 0x81, 0x17, 0x81, 0x19, 0x81, 0x1b, 0x81, 0x1c, 0x81, 0x1d,
+	0x81, 0x1f, 0x81, 0x20, 0x81, 0x21, 0x81, 0x22, 0x81, 0x23, 0x81, 0x24,
+	0x81, 0x25, 0x81, 0x26, 0x81, 0x27, 0x81, 0x28, 0x81, 0x29, 0x81, 0x2a,
+	0x81, 0x2b, 0x81, 0x2d, 0x81, 0x2e, 0x81, 0x30, 0x81, 0x33, 0x81, 0x34,
+	0x81, 0x35, 0x81, 0x37, 0x81, 0x39, 0x81, 0x3a, 0x81, 0x3b, 0x81, 0x3c,
+	0x81, 0x3d, 0x81, 0x3f, 0x8c, 0x29, 0x82, 0x92, 0x83, 0x2b, 0x76, 0xf2,
+	0x6c, 0x13, 0x5f, 0xd9, 0x83, 0xbd, 0x73, 0x2b, 0x83, 0x05, 0x95, 0x1a,
+	0x6b, 0xdb, 0x77, 0xdb, 0x94, 0xc6, 0x53, 0x6f, 0x83, 0x02, 0x51, 0x92,
+	0x5e, 0x3d, 0x8c, 0x8c, 0x8d, 0x38, 0x4e, 0x48, 0x73, 0xab, 0x67, 0x9a,
+	0x68, 0x85, 0x91, 0x76, 0x97, 0x09, 0x71, 0x64, 0x6c, 0xa1, 0x77, 0x09,
+	0x5a, 0x92, 0x95, 0x41, 0x6b, 0xcf, 0x7f, 0x8e, 0x66, 0x27, 0x5b, 0xd0,
+	0x59, 0xb9, 0x5a, 0x9a, 0x95, 0xe8, 0x95, 0xf7, 0x4e, 0xec, 0x84, 0x0c,
+	0x84, 0x99, 0x6a, 0xac, 0x76, 0xdf, 0x95, 0x30, 0x73, 0x1b, 0x68, 0xa6,
+	0x5b, 0x5f, 0x77, 0x2f, 0x91, 0x9a, 0x97, 0x61, 0x7c, 0xdc, 0x8f, 0xf7,
+	0x8c, 0x1c, 0x5f, 0x25, 0x7c, 0x73, 0x79, 0xd8, 0x89, 0xc5, 0x6c, 0xcc,
+	0x87, 0x1c, 0x5b, 0xc6, 0x5e, 0x42, 0x68, 0xc9, 0x77, 0x20, 0x7e, 0xf5,
+	0x51, 0x95, 0x51, 0x4d, 0x52, 0xc9, 0x5a, 0x29, 0x7f, 0x05, 0x97, 0x62,
+	0x82, 0xd7, 0x63, 0xcf, 0x77, 0x84, 0x85, 0xd0, 0x79, 0xd2, 0x6e, 0x3a,
+	0x5e, 0x99, 0x59, 0x99, 0x85, 0x11, 0x70, 0x6d, 0x6c, 0x11, 0x62, 0xbf,
+	0x76, 0xbf, 0x65, 0x4f, 0x60, 0xaf, 0x95, 0xfd, 0x66, 0x0e, 0x87, 0x9f,
+	0x9e, 0x23, 0x94, 0xed, 0x54, 0x0d, 0x54, 0x7d, 0x8c, 0x2c, 0x64, 0x78,
+	0x81, 0x40, 0x81, 0x41, 0x81, 0x42, 0x81, 0x43, 0x81, 0x44, 0x81, 0x45,
+	0x81, 0x47, 0x81, 0x49, 0x81, 0x4d, 0x81, 0x4e, 0x81, 0x4f, 0x81, 0x52,
+	0x81, 0x56, 0x81, 0x57, 0x81, 0x58, 0x81, 0x5b, 0x81, 0x5c, 0x81, 0x5d,
+	0x81, 0x5e, 0x81, 0x5f, 0x81, 0x61, 0x81, 0x62, 0x81, 0x63, 0x81, 0x64,
+	0x81, 0x66, 0x81, 0x68, 0x81, 0x6a, 0x81, 0x6b, 0x81, 0x6c, 0x81, 0x6f,
+	0x81, 0x72, 0x81, 0x73, 0x81, 0x75, 0x81, 0x76, 0x81, 0x77, 0x81, 0x78,
+	0x81, 0x81, 0x81, 0x83, 0x81, 0x84, 0x81, 0x85, 0x81, 0x86, 0x81, 0x87,
+	0x81, 0x89, 0x81, 0x8b, 0x81, 0x8c, 0x81, 0x8d, 0x81, 0x8e, 0x81, 0x90,
+	0x81, 0x92, 0x81, 0x93, 0x81, 0x94, 0x81, 0x95, 0x81, 0x96, 0x81, 0x97,
+	0x81, 0x99, 0x81, 0x9a, 0x81, 0x9e, 0x81, 0x9f, 0x81, 0xa0, 0x81, 0xa1,
+	0x81, 0xa2, 0x81, 0xa4, 0x81, 0xa5, 0x81, 0xa7, 0x81, 0xa9, 0x81, 0xab,
+	0x81, 0xac, 0x81, 0xad, 0x81, 0xae, 0x81, 0xaf, 0x81, 0xb0, 0x81, 0xb1,
+	0x81, 0xb2, 0x81, 0xb4, 0x81, 0xb5, 0x81, 0xb6, 0x81, 0xb7, 0x81, 0xb8,
+	0x81, 0xb9, 0x81, 0xbc, 0x81, 0xbd, 0x81, 0xbe, 0x81, 0xbf, 0x81, 0xc4,
+	0x81, 0xc5, 0x81, 0xc7, 0x81, 0xc8, 0x81, 0xc9, 0x81, 0xcb, 0x81, 0xcd,
+	0x81, 0xce, 0x81, 0xcf, 0x81, 0xd0, 0x81, 0xd1, 0x81, 0xd2, 0x81, 0xd3,
+	0x64, 0x79, 0x86, 0x11, 0x6a, 0x21, 0x81, 0x9c, 0x78, 0xe8, 0x64, 0x69,
+	0x9b, 0x54, 0x62, 0xb9, 0x67, 0x2b, 0x83, 0xab, 0x58, 0xa8, 0x9e, 0xd8,
+	0x6c, 0xab, 0x6f, 0x20, 0x5b, 0xde, 0x96, 0x4c, 0x8c, 0x0b, 0x72, 0x5f,
+	0x67, 0xd0, 0x62, 0xc7, 0x72, 0x61, 0x4e, 0xa9, 0x59, 0xc6, 0x6b, 0xcd,
+	0x58, 0x93, 0x66, 0xae, 0x5e, 0x55, 0x52, 0xdf, 0x61, 0x55, 0x67, 0x28,
+	0x76, 0xee, 0x77, 0x66, 0x72, 0x67, 0x7a, 0x46, 0x62, 0xff, 0x54, 0xea,
+	0x54, 0x50, 0x94, 0xa0, 0x90, 0xa3, 0x5a, 0x1c, 0x7e, 0xb3, 0x6c, 0x16,
+	0x4e, 0x43, 0x59, 0x76, 0x80, 0x10, 0x59, 0x48, 0x53, 0x57, 0x75, 0x37,
+	0x96, 0xbe, 0x56, 0xca, 0x63, 0x20, 0x81, 0x11, 0x60, 0x7c, 0x95, 0xf9,
+	0x6d, 0xd6, 0x54, 0x62, 0x99, 0x81, 0x51, 0x85, 0x5a, 0xe9, 0x80, 0xfd,
+	0x59, 0xae, 0x97, 0x13, 0x50, 0x2a, 0x6c, 0xe5, 0x5c, 0x3c, 0x62, 0xdf,
+	0x4f, 0x60, 0x53, 0x3f, 0x81, 0x7b, 0x90, 0x06, 0x6e, 0xba, 0x85, 0x2b,
+	0x62, 0xc8, 0x5e, 0x74, 0x78, 0xbe, 0x64, 0xb5, 0x63, 0x7b, 0x5f, 0xf5,
+	0x5a, 0x18, 0x91, 0x7f, 0x9e, 0x1f, 0x5c, 0x3f, 0x63, 0x4f, 0x80, 0x42,
+	0x5b, 0x7d, 0x55, 0x6e, 0x95, 0x4a, 0x95, 0x4d, 0x6d, 0x85, 0x60, 0xa8,
+	0x67, 0xe0, 0x72, 0xde, 0x51, 0xdd, 0x5b, 0x81, 0x81, 0xd4, 0x81, 0xd5,
+	0x81, 0xd6, 0x81, 0xd7, 0x81, 0xd8, 0x81, 0xd9, 0x81, 0xda, 0x81, 0xdb,
+	0x81, 0xdc, 0x81, 0xdd, 0x81, 0xde, 0x81, 0xdf, 0x81, 0xe0, 0x81, 0xe1,
+	0x81, 0xe2, 0x81, 0xe4, 0x81, 0xe5, 0x81, 0xe6, 0x81, 0xe8, 0x81, 0xe9,
+	0x81, 0xeb, 0x81, 0xee, 0x81, 0xef, 0x81, 0xf0, 0x81, 0xf1, 0x81, 0xf2,
+	0x81, 0xf5, 0x81, 0xf6, 0x81, 0xf7, 0x81, 0xf8, 0x81, 0xf9, 0x81, 0xfa,
+	0x81, 0xfd, 0x81, 0xff, 0x82, 0x03, 0x82, 0x07, 0x82, 0x08, 0x82, 0x09,
+	0x82, 0x0a, 0x82, 0x0b, 0x82, 0x0e, 0x82, 0x0f, 0x82, 0x11, 0x82, 0x13,
+	0x82, 0x15, 0x82, 0x16, 0x82, 0x17, 0x82, 0x18, 0x82, 0x19, 0x82, 0x1a,
+	0x82, 0x1d, 0x82, 0x20, 0x82, 0x24, 0x82, 0x25, 0x82, 0x26, 0x82, 0x27,
+	0x82, 0x29, 0x82, 0x2e, 0x82, 0x32, 0x82, 0x3a, 0x82, 0x3c, 0x82, 0x3d,
+	0x82, 0x3f, 0x82, 0x40, 0x82, 0x41, 0x82, 0x42, 0x82, 0x43, 0x82, 0x45,
+	0x82, 0x46, 0x82, 0x48, 0x82, 0x4a, 0x82, 0x4c, 0x82, 0x4d, 0x82, 0x4e,
+	0x82, 0x50, 0x82, 0x51, 0x82, 0x52, 0x82, 0x53, 0x82, 0x54, 0x82, 0x55,
+	0x82, 0x56, 0x82, 0x57, 0x82, 0x59, 0x82, 0x5b, 0x82, 0x5c, 0x82, 0x5d,
+	0x82, 0x5e, 0x82, 0x60, 0x82, 0x61, 0x82, 0x62, 0x82, 0x63, 0x82, 0x64,
+	0x82, 0x65, 0x82, 0x66, 0x82, 0x67, 0x82, 0x69, 0x62, 0xe7, 0x6c, 0xde,
+	0x72, 0x5b, 0x62, 0x6d, 0x94, 0xae, 0x7e, 0xbd, 0x81, 0x13, 0x6d, 0x53,
+	0x51, 0x9c, 0x5f, 0x04, 0x59, 0x74, 0x52, 0xaa, 0x60, 0x12, 0x59, 0x73,
+	0x66, 0x96, 0x86, 0x50, 0x75, 0x9f, 0x63, 0x2a, 0x61, 0xe6, 0x7c, 0xef,
+	0x8b, 0xfa, 0x54, 0xe6, 0x6b, 0x27, 0x9e, 0x25, 0x6b, 0xb4, 0x85, 0xd5,
+	0x54, 0x55, 0x50, 0x76, 0x6c, 0xa4, 0x55, 0x6a, 0x8d, 0xb4, 0x72, 0x2c,
+	0x5e, 0x15, 0x60, 0x15, 0x74, 0x36, 0x62, 0xcd, 0x63, 0x92, 0x72, 0x4c,
+	0x5f, 0x98, 0x6e, 0x43, 0x6d, 0x3e, 0x65, 0x00, 0x6f, 0x58, 0x76, 0xd8,
+	0x78, 0xd0, 0x76, 0xfc, 0x75, 0x54, 0x52, 0x24, 0x53, 0xdb, 0x4e, 0x53,
+	0x5e, 0x9e, 0x65, 0xc1, 0x80, 0x2a, 0x80, 0xd6, 0x62, 0x9b, 0x54, 0x86,
+	0x52, 0x28, 0x70, 0xae, 0x88, 0x8d, 0x8d, 0xd1, 0x6c, 0xe1, 0x54, 0x78,
+	0x80, 0xda, 0x57, 0xf9, 0x88, 0xf4, 0x8d, 0x54, 0x96, 0x6a, 0x91, 0x4d,
+	0x4f, 0x69, 0x6c, 0x9b, 0x55, 0xb7, 0x76, 0xc6, 0x78, 0x30, 0x62, 0xa8,
+	0x70, 0xf9, 0x6f, 0x8e, 0x5f, 0x6d, 0x84, 0xec, 0x68, 0xda, 0x78, 0x7c,
+	0x7b, 0xf7, 0x81, 0xa8, 0x67, 0x0b, 0x9e, 0x4f, 0x63, 0x67, 0x78, 0xb0,
+	0x57, 0x6f, 0x78, 0x12, 0x97, 0x39, 0x62, 0x79, 0x62, 0xab, 0x52, 0x88,
+	0x74, 0x35, 0x6b, 0xd7, 0x82, 0x6a, 0x82, 0x6b, 0x82, 0x6c, 0x82, 0x6d,
+	0x82, 0x71, 0x82, 0x75, 0x82, 0x76, 0x82, 0x77, 0x82, 0x78, 0x82, 0x7b,
+	0x82, 0x7c, 0x82, 0x80, 0x82, 0x81, 0x82, 0x83, 0x82, 0x85, 0x82, 0x86,
+	0x82, 0x87, 0x82, 0x89, 0x82, 0x8c, 0x82, 0x90, 0x82, 0x93, 0x82, 0x94,
+	0x82, 0x95, 0x82, 0x96, 0x82, 0x9a, 0x82, 0x9b, 0x82, 0x9e, 0x82, 0xa0,
+	0x82, 0xa2, 0x82, 0xa3, 0x82, 0xa7, 0x82, 0xb2, 0x82, 0xb5, 0x82, 0xb6,
+	0x82, 0xba, 0x82, 0xbb, 0x82, 0xbc, 0x82, 0xbf, 0x82, 0xc0, 0x82, 0xc2,
+	0x82, 0xc3, 0x82, 0xc5, 0x82, 0xc6, 0x82, 0xc9, 0x82, 0xd0, 0x82, 0xd6,
+	0x82, 0xd9, 0x82, 0xda, 0x82, 0xdd, 0x82, 0xe2, 0x82, 0xe7, 0x82, 0xe8,
+	0x82, 0xe9, 0x82, 0xea, 0x82, 0xec, 0x82, 0xed, 0x82, 0xee, 0x82, 0xf0,
+	0x82, 0xf2, 0x82, 0xf3, 0x82, 0xf5, 0x82, 0xf6, 0x82, 0xf8, 0x82, 0xfa,
+	0x82, 0xfc, 0x82, 0xfd, 0x82, 0xfe, 0x82, 0xff, 0x83, 0x00, 0x83, 0x0a,
+	0x83, 0x0b, 0x83, 0x0d, 0x83, 0x10, 0x83, 0x12, 0x83, 0x13, 0x83, 0x16,
+	0x83, 0x18, 0x83, 0x19, 0x83, 0x1d, 0x83, 0x1e, 0x83, 0x1f, 0x83, 0x20,
+	0x83, 0x21, 0x83, 0x22, 0x83, 0x23, 0x83, 0x24, 0x83, 0x25, 0x83, 0x26,
+	0x83, 0x29, 0x83, 0x2a, 0x83, 0x2e, 0x83, 0x30, 0x83, 0x32, 0x83, 0x37,
+	0x83, 0x3b, 0x83, 0x3d, 0x55, 0x64, 0x81, 0x3e, 0x75, 0xb2, 0x76, 0xae,
+	0x53, 0x39, 0x75, 0xde, 0x50, 0xfb, 0x5c, 0x41, 0x8b, 0x6c, 0x7b, 0xc7,
+	0x50, 0x4f, 0x72, 0x47, 0x9a, 0x97, 0x98, 0xd8, 0x6f, 0x02, 0x74, 0xe2,
+	0x79, 0x68, 0x64, 0x87, 0x77, 0xa5, 0x62, 0xfc, 0x98, 0x91, 0x8d, 0x2b,
+	0x54, 0xc1, 0x80, 0x58, 0x4e, 0x52, 0x57, 0x6a, 0x82, 0xf9, 0x84, 0x0d,
+	0x5e, 0x73, 0x51, 0xed, 0x74, 0xf6, 0x8b, 0xc4, 0x5c, 0x4f, 0x57, 0x61,
+	0x6c, 0xfc, 0x98, 0x87, 0x5a, 0x46, 0x78, 0x34, 0x9b, 0x44, 0x8f, 0xeb,
+	0x7c, 0x95, 0x52, 0x56, 0x62, 0x51, 0x94, 0xfa, 0x4e, 0xc6, 0x83, 0x86,
+	0x84, 0x61, 0x83, 0xe9, 0x84, 0xb2, 0x57, 0xd4, 0x67, 0x34, 0x57, 0x03,
+	0x66, 0x6e, 0x6d, 0x66, 0x8c, 0x31, 0x66, 0xdd, 0x70, 0x11, 0x67, 0x1f,
+	0x6b, 0x3a, 0x68, 0x16, 0x62, 0x1a, 0x59, 0xbb, 0x4e, 0x03, 0x51, 0xc4,
+	0x6f, 0x06, 0x67, 0xd2, 0x6c, 0x8f, 0x51, 0x76, 0x68, 0xcb, 0x59, 0x47,
+	0x6b, 0x67, 0x75, 0x66, 0x5d, 0x0e, 0x81, 0x10, 0x9f, 0x50, 0x65, 0xd7,
+	0x79, 0x48, 0x79, 0x41, 0x9a, 0x91, 0x8d, 0x77, 0x5c, 0x82, 0x4e, 0x5e,
+	0x4f, 0x01, 0x54, 0x2f, 0x59, 0x51, 0x78, 0x0c, 0x56, 0x68, 0x6c, 0x14,
+	0x8f, 0xc4, 0x5f, 0x03, 0x6c, 0x7d, 0x6c, 0xe3, 0x8b, 0xab, 0x63, 0x90,
+	0x83, 0x3e, 0x83, 0x3f, 0x83, 0x41, 0x83, 0x42, 0x83, 0x44, 0x83, 0x45,
+	0x83, 0x48, 0x83, 0x4a, 0x83, 0x4b, 0x83, 0x4c, 0x83, 0x4d, 0x83, 0x4e,
+	0x83, 0x53, 0x83, 0x55, 0x83, 0x56, 0x83, 0x57, 0x83, 0x58, 0x83, 0x59,
+	0x83, 0x5d, 0x83, 0x62, 0x83, 0x70, 0x83, 0x71, 0x83, 0x72, 0x83, 0x73,
+	0x83, 0x74, 0x83, 0x75, 0x83, 0x76, 0x83, 0x79, 0x83, 0x7a, 0x83, 0x7e,
+	0x83, 0x7f, 0x83, 0x80, 0x83, 0x81, 0x83, 0x82, 0x83, 0x83, 0x83, 0x84,
+	0x83, 0x87, 0x83, 0x88, 0x83, 0x8a, 0x83, 0x8b, 0x83, 0x8c, 0x83, 0x8d,
+	0x83, 0x8f, 0x83, 0x90, 0x83, 0x91, 0x83, 0x94, 0x83, 0x95, 0x83, 0x96,
+	0x83, 0x97, 0x83, 0x99, 0x83, 0x9a, 0x83, 0x9d, 0x83, 0x9f, 0x83, 0xa1,
+	0x83, 0xa2, 0x83, 0xa3, 0x83, 0xa4, 0x83, 0xa5, 0x83, 0xa6, 0x83, 0xa7,
+	0x83, 0xac, 0x83, 0xad, 0x83, 0xae, 0x83, 0xaf, 0x83, 0xb5, 0x83, 0xbb,
+	0x83, 0xbe, 0x83, 0xbf, 0x83, 0xc2, 0x83, 0xc3, 0x83, 0xc4, 0x83, 0xc6,
+	0x83, 0xc8, 0x83, 0xc9, 0x83, 0xcb, 0x83, 0xcd, 0x83, 0xce, 0x83, 0xd0,
+	0x83, 0xd1, 0x83, 0xd2, 0x83, 0xd3, 0x83, 0xd5, 0x83, 0xd7, 0x83, 0xd9,
+	0x83, 0xda, 0x83, 0xdb, 0x83, 0xde, 0x83, 0xe2, 0x83, 0xe3, 0x83, 0xe4,
+	0x83, 0xe6, 0x83, 0xe7, 0x83, 0xe8, 0x83, 0xeb, 0x83, 0xec, 0x83, 0xed,
+	0x60, 0x70, 0x6d, 0x3d, 0x72, 0x75, 0x62, 0x66, 0x94, 0x8e, 0x94, 0xc5,
+	0x53, 0x43, 0x8f, 0xc1, 0x7b, 0x7e, 0x4e, 0xdf, 0x8c, 0x26, 0x4e, 0x7e,
+	0x9e, 0xd4, 0x94, 0xb1, 0x94, 0xb3, 0x52, 0x4d, 0x6f, 0x5c, 0x90, 0x63,
+	0x6d, 0x45, 0x8c, 0x34, 0x58, 0x11, 0x5d, 0x4c, 0x6b, 0x20, 0x6b, 0x49,
+	0x67, 0xaa, 0x54, 0x5b, 0x81, 0x54, 0x7f, 0x8c, 0x58, 0x99, 0x85, 0x37,
+	0x5f, 0x3a, 0x62, 0xa2, 0x6a, 0x47, 0x95, 0x39, 0x65, 0x72, 0x60, 0x84,
+	0x68, 0x65, 0x77, 0xa7, 0x4e, 0x54, 0x4f, 0xa8, 0x5d, 0xe7, 0x97, 0x98,
+	0x64, 0xac, 0x7f, 0xd8, 0x5c, 0xed, 0x4f, 0xcf, 0x7a, 0x8d, 0x52, 0x07,
+	0x83, 0x04, 0x4e, 0x14, 0x60, 0x2f, 0x7a, 0x83, 0x94, 0xa6, 0x4f, 0xb5,
+	0x4e, 0xb2, 0x79, 0xe6, 0x74, 0x34, 0x52, 0xe4, 0x82, 0xb9, 0x64, 0xd2,
+	0x79, 0xbd, 0x5b, 0xdd, 0x6c, 0x81, 0x97, 0x52, 0x8f, 0x7b, 0x6c, 0x22,
+	0x50, 0x3e, 0x53, 0x7f, 0x6e, 0x05, 0x64, 0xce, 0x66, 0x74, 0x6c, 0x30,
+	0x60, 0xc5, 0x98, 0x77, 0x8b, 0xf7, 0x5e, 0x86, 0x74, 0x3c, 0x7a, 0x77,
+	0x79, 0xcb, 0x4e, 0x18, 0x90, 0xb1, 0x74, 0x03, 0x6c, 0x42, 0x56, 0xda,
+	0x91, 0x4b, 0x6c, 0xc5, 0x8d, 0x8b, 0x53, 0x3a, 0x86, 0xc6, 0x66, 0xf2,
+	0x8e, 0xaf, 0x5c, 0x48, 0x9a, 0x71, 0x6e, 0x20, 0x83, 0xee, 0x83, 0xef,
+	0x83, 0xf3, 0x83, 0xf4, 0x83, 0xf5, 0x83, 0xf6, 0x83, 0xf7, 0x83, 0xfa,
+	0x83, 0xfb, 0x83, 0xfc, 0x83, 0xfe, 0x83, 0xff, 0x84, 0x00, 0x84, 0x02,
+	0x84, 0x05, 0x84, 0x07, 0x84, 0x08, 0x84, 0x09, 0x84, 0x0a, 0x84, 0x10,
+	0x84, 0x12, 0x84, 0x13, 0x84, 0x14, 0x84, 0x15, 0x84, 0x16, 0x84, 0x17,
+	0x84, 0x19, 0x84, 0x1a, 0x84, 0x1b, 0x84, 0x1e, 0x84, 0x1f, 0x84, 0x20,
+	0x84, 0x21, 0x84, 0x22, 0x84, 0x23, 0x84, 0x29, 0x84, 0x2a, 0x84, 0x2b,
+	0x84, 0x2c, 0x84, 0x2d, 0x84, 0x2e, 0x84, 0x2f, 0x84, 0x30, 0x84, 0x32,
+	0x84, 0x33, 0x84, 0x34, 0x84, 0x35, 0x84, 0x36, 0x84, 0x37, 0x84, 0x39,
+	0x84, 0x3a, 0x84, 0x3b, 0x84, 0x3e, 0x84, 0x3f, 0x84, 0x40, 0x84, 0x41,
+	0x84, 0x42, 0x84, 0x43, 0x84, 0x44, 0x84, 0x45, 0x84, 0x47, 0x84, 0x48,
+	0x84, 0x49, 0x84, 0x4a, 0x84, 0x4b, 0x84, 0x4c, 0x84, 0x4d, 0x84, 0x4e,
+	0x84, 0x4f, 0x84, 0x50, 0x84, 0x52, 0x84, 0x53, 0x84, 0x54, 0x84, 0x55,
+	0x84, 0x56, 0x84, 0x58, 0x84, 0x5d, 0x84, 0x5e, 0x84, 0x5f, 0x84, 0x60,
+	0x84, 0x62, 0x84, 0x64, 0x84, 0x65, 0x84, 0x66, 0x84, 0x67, 0x84, 0x68,
+	0x84, 0x6a, 0x84, 0x6e, 0x84, 0x6f, 0x84, 0x70, 0x84, 0x72, 0x84, 0x74,
+	0x84, 0x77, 0x84, 0x79, 0x84, 0x7b, 0x84, 0x7c, 0x53, 0xd6, 0x5a, 0x36,
+	0x9f, 0x8b, 0x8d, 0xa3, 0x53, 0xbb, 0x57, 0x08, 0x98, 0xa7, 0x67, 0x43,
+	0x91, 0x9b, 0x6c, 0xc9, 0x51, 0x68, 0x75, 0xca, 0x62, 0xf3, 0x72, 0xac,
+	0x52, 0x38, 0x52, 0x9d, 0x7f, 0x3a, 0x70, 0x94, 0x76, 0x38, 0x53, 0x74,
+	0x9e, 0x4a, 0x69, 0xb7, 0x78, 0x6e, 0x96, 0xc0, 0x88, 0xd9, 0x7f, 0xa4,
+	0x71, 0x36, 0x71, 0xc3, 0x51, 0x89, 0x67, 0xd3, 0x74, 0xe4, 0x58, 0xe4,
+	0x65, 0x18, 0x56, 0xb7, 0x8b, 0xa9, 0x99, 0x76, 0x62, 0x70, 0x7e, 0xd5,
+	0x60, 0xf9, 0x70, 0xed, 0x58, 0xec, 0x4e, 0xc1, 0x4e, 0xba, 0x5f, 0xcd,
+	0x97, 0xe7, 0x4e, 0xfb, 0x8b, 0xa4, 0x52, 0x03, 0x59, 0x8a, 0x7e, 0xab,
+	0x62, 0x54, 0x4e, 0xcd, 0x65, 0xe5, 0x62, 0x0e, 0x83, 0x38, 0x84, 0xc9,
+	0x83, 0x63, 0x87, 0x8d, 0x71, 0x94, 0x6e, 0xb6, 0x5b, 0xb9, 0x7e, 0xd2,
+	0x51, 0x97, 0x63, 0xc9, 0x67, 0xd4, 0x80, 0x89, 0x83, 0x39, 0x88, 0x15,
+	0x51, 0x12, 0x5b, 0x7a, 0x59, 0x82, 0x8f, 0xb1, 0x4e, 0x73, 0x6c, 0x5d,
+	0x51, 0x65, 0x89, 0x25, 0x8f, 0x6f, 0x96, 0x2e, 0x85, 0x4a, 0x74, 0x5e,
+	0x95, 0x10, 0x95, 0xf0, 0x6d, 0xa6, 0x82, 0xe5, 0x5f, 0x31, 0x64, 0x92,
+	0x6d, 0x12, 0x84, 0x28, 0x81, 0x6e, 0x9c, 0xc3, 0x58, 0x5e, 0x8d, 0x5b,
+	0x4e, 0x09, 0x53, 0xc1, 0x84, 0x7d, 0x84, 0x7e, 0x84, 0x7f, 0x84, 0x80,
+	0x84, 0x81, 0x84, 0x83, 0x84, 0x84, 0x84, 0x85, 0x84, 0x86, 0x84, 0x8a,
+	0x84, 0x8d, 0x84, 0x8f, 0x84, 0x90, 0x84, 0x91, 0x84, 0x92, 0x84, 0x93,
+	0x84, 0x94, 0x84, 0x95, 0x84, 0x96, 0x84, 0x98, 0x84, 0x9a, 0x84, 0x9b,
+	0x84, 0x9d, 0x84, 0x9e, 0x84, 0x9f, 0x84, 0xa0, 0x84, 0xa2, 0x84, 0xa3,
+	0x84, 0xa4, 0x84, 0xa5, 0x84, 0xa6, 0x84, 0xa7, 0x84, 0xa8, 0x84, 0xa9,
+	0x84, 0xaa, 0x84, 0xab, 0x84, 0xac, 0x84, 0xad, 0x84, 0xae, 0x84, 0xb0,
+	0x84, 0xb1, 0x84, 0xb3, 0x84, 0xb5, 0x84, 0xb6, 0x84, 0xb7, 0x84, 0xbb,
+	0x84, 0xbc, 0x84, 0xbe, 0x84, 0xc0, 0x84, 0xc2, 0x84, 0xc3, 0x84, 0xc5,
+	0x84, 0xc6, 0x84, 0xc7, 0x84, 0xc8, 0x84, 0xcb, 0x84, 0xcc, 0x84, 0xce,
+	0x84, 0xcf, 0x84, 0xd2, 0x84, 0xd4, 0x84, 0xd5, 0x84, 0xd7, 0x84, 0xd8,
+	0x84, 0xd9, 0x84, 0xda, 0x84, 0xdb, 0x84, 0xdc, 0x84, 0xde, 0x84, 0xe1,
+	0x84, 0xe2, 0x84, 0xe4, 0x84, 0xe7, 0x84, 0xe8, 0x84, 0xe9, 0x84, 0xea,
+	0x84, 0xeb, 0x84, 0xed, 0x84, 0xee, 0x84, 0xef, 0x84, 0xf1, 0x84, 0xf2,
+	0x84, 0xf3, 0x84, 0xf4, 0x84, 0xf5, 0x84, 0xf6, 0x84, 0xf7, 0x84, 0xf8,
+	0x84, 0xf9, 0x84, 0xfa, 0x84, 0xfb, 0x84, 0xfd, 0x84, 0xfe, 0x85, 0x00,
+	0x85, 0x01, 0x85, 0x02, 0x4f, 0x1e, 0x65, 0x63, 0x68, 0x51, 0x55, 0xd3,
+	0x4e, 0x27, 0x64, 0x14, 0x9a, 0x9a, 0x62, 0x6b, 0x5a, 0xc2, 0x74, 0x5f,
+	0x82, 0x72, 0x6d, 0xa9, 0x68, 0xee, 0x50, 0xe7, 0x83, 0x8e, 0x78, 0x02,
+	0x67, 0x40, 0x52, 0x39, 0x6c, 0x99, 0x7e, 0xb1, 0x50, 0xbb, 0x55, 0x65,
+	0x71, 0x5e, 0x7b, 0x5b, 0x66, 0x52, 0x73, 0xca, 0x82, 0xeb, 0x67, 0x49,
+	0x5c, 0x71, 0x52, 0x20, 0x71, 0x7d, 0x88, 0x6b, 0x95, 0xea, 0x96, 0x55,
+	0x64, 0xc5, 0x8d, 0x61, 0x81, 0xb3, 0x55, 0x84, 0x6c, 0x55, 0x62, 0x47,
+	0x7f, 0x2e, 0x58, 0x92, 0x4f, 0x24, 0x55, 0x46, 0x8d, 0x4f, 0x66, 0x4c,
+	0x4e, 0x0a, 0x5c, 0x1a, 0x88, 0xf3, 0x68, 0xa2, 0x63, 0x4e, 0x7a, 0x0d,
+	0x70, 0xe7, 0x82, 0x8d, 0x52, 0xfa, 0x97, 0xf6, 0x5c, 0x11, 0x54, 0xe8,
+	0x90, 0xb5, 0x7e, 0xcd, 0x59, 0x62, 0x8d, 0x4a, 0x86, 0xc7, 0x82, 0x0c,
+	0x82, 0x0d, 0x8d, 0x66, 0x64, 0x44, 0x5c, 0x04, 0x61, 0x51, 0x6d, 0x89,
+	0x79, 0x3e, 0x8b, 0xbe, 0x78, 0x37, 0x75, 0x33, 0x54, 0x7b, 0x4f, 0x38,
+	0x8e, 0xab, 0x6d, 0xf1, 0x5a, 0x20, 0x7e, 0xc5, 0x79, 0x5e, 0x6c, 0x88,
+	0x5b, 0xa1, 0x5a, 0x76, 0x75, 0x1a, 0x80, 0xbe, 0x61, 0x4e, 0x6e, 0x17,
+	0x58, 0xf0, 0x75, 0x1f, 0x75, 0x25, 0x72, 0x72, 0x53, 0x47, 0x7e, 0xf3,
+	0x85, 0x03, 0x85, 0x04, 0x85, 0x05, 0x85, 0x06, 0x85, 0x07, 0x85, 0x08,
+	0x85, 0x09, 0x85, 0x0a, 0x85, 0x0b, 0x85, 0x0d, 0x85, 0x0e, 0x85, 0x0f,
+	0x85, 0x10, 0x85, 0x12, 0x85, 0x14, 0x85, 0x15, 0x85, 0x16, 0x85, 0x18,
+	0x85, 0x19, 0x85, 0x1b, 0x85, 0x1c, 0x85, 0x1d, 0x85, 0x1e, 0x85, 0x20,
+	0x85, 0x22, 0x85, 0x23, 0x85, 0x24, 0x85, 0x25, 0x85, 0x26, 0x85, 0x27,
+	0x85, 0x28, 0x85, 0x29, 0x85, 0x2a, 0x85, 0x2d, 0x85, 0x2e, 0x85, 0x2f,
+	0x85, 0x30, 0x85, 0x31, 0x85, 0x32, 0x85, 0x33, 0x85, 0x34, 0x85, 0x35,
+	0x85, 0x36, 0x85, 0x3e, 0x85, 0x3f, 0x85, 0x40, 0x85, 0x41, 0x85, 0x42,
+	0x85, 0x44, 0x85, 0x45, 0x85, 0x46, 0x85, 0x47, 0x85, 0x4b, 0x85, 0x4c,
+	0x85, 0x4d, 0x85, 0x4e, 0x85, 0x4f, 0x85, 0x50, 0x85, 0x51, 0x85, 0x52,
+	0x85, 0x53, 0x85, 0x54, 0x85, 0x55, 0x85, 0x57, 0x85, 0x58, 0x85, 0x5a,
+	0x85, 0x5b, 0x85, 0x5c, 0x85, 0x5d, 0x85, 0x5f, 0x85, 0x60, 0x85, 0x61,
+	0x85, 0x62, 0x85, 0x63, 0x85, 0x65, 0x85, 0x66, 0x85, 0x67, 0x85, 0x69,
+	0x85, 0x6a, 0x85, 0x6b, 0x85, 0x6c, 0x85, 0x6d, 0x85, 0x6e, 0x85, 0x6f,
+	0x85, 0x70, 0x85, 0x71, 0x85, 0x73, 0x85, 0x75, 0x85, 0x76, 0x85, 0x77,
+	0x85, 0x78, 0x85, 0x7c, 0x85, 0x7d, 0x85, 0x7f, 0x85, 0x80, 0x85, 0x81,
+	0x77, 0x01, 0x76, 0xdb, 0x52, 0x69, 0x80, 0xdc, 0x57, 0x23, 0x5e, 0x08,
+	0x59, 0x31, 0x72, 0xee, 0x65, 0xbd, 0x6e, 0x7f, 0x8b, 0xd7, 0x5c, 0x38,
+	0x86, 0x71, 0x53, 0x41, 0x77, 0xf3, 0x62, 0xfe, 0x65, 0xf6, 0x4e, 0xc0,
+	0x98, 0xdf, 0x86, 0x80, 0x5b, 0x9e, 0x8b, 0xc6, 0x53, 0xf2, 0x77, 0xe2,
+	0x4f, 0x7f, 0x5c, 0x4e, 0x9a, 0x76, 0x59, 0xcb, 0x5f, 0x0f, 0x79, 0x3a,
+	0x58, 0xeb, 0x4e, 0x16, 0x67, 0xff, 0x4e, 0x8b, 0x62, 0xed, 0x8a, 0x93,
+	0x90, 0x1d, 0x52, 0xbf, 0x66, 0x2f, 0x55, 0xdc, 0x56, 0x6c, 0x90, 0x02,
+	0x4e, 0xd5, 0x4f, 0x8d, 0x91, 0xca, 0x99, 0x70, 0x6c, 0x0f, 0x5e, 0x02,
+	0x60, 0x43, 0x5b, 0xa4, 0x89, 0xc6, 0x8b, 0xd5, 0x65, 0x36, 0x62, 0x4b,
+	0x99, 0x96, 0x5b, 0x88, 0x5b, 0xff, 0x63, 0x88, 0x55, 0x2e, 0x53, 0xd7,
+	0x76, 0x26, 0x51, 0x7d, 0x85, 0x2c, 0x67, 0xa2, 0x68, 0xb3, 0x6b, 0x8a,
+	0x62, 0x92, 0x8f, 0x93, 0x53, 0xd4, 0x82, 0x12, 0x6d, 0xd1, 0x75, 0x8f,
+	0x4e, 0x66, 0x8d, 0x4e, 0x5b, 0x70, 0x71, 0x9f, 0x85, 0xaf, 0x66, 0x91,
+	0x66, 0xd9, 0x7f, 0x72, 0x87, 0x00, 0x9e, 0xcd, 0x9f, 0x20, 0x5c, 0x5e,
+	0x67, 0x2f, 0x8f, 0xf0, 0x68, 0x11, 0x67, 0x5f, 0x62, 0x0d, 0x7a, 0xd6,
+	0x58, 0x85, 0x5e, 0xb6, 0x65, 0x70, 0x6f, 0x31, 0x85, 0x82, 0x85, 0x83,
+	0x85, 0x86, 0x85, 0x88, 0x85, 0x89, 0x85, 0x8a, 0x85, 0x8b, 0x85, 0x8c,
+	0x85, 0x8d, 0x85, 0x8e, 0x85, 0x90, 0x85, 0x91, 0x85, 0x92, 0x85, 0x93,
+	0x85, 0x94, 0x85, 0x95, 0x85, 0x96, 0x85, 0x97, 0x85, 0x98, 0x85, 0x99,
+	0x85, 0x9a, 0x85, 0x9d, 0x85, 0x9e, 0x85, 0x9f, 0x85, 0xa0, 0x85, 0xa1,
+	0x85, 0xa2, 0x85, 0xa3, 0x85, 0xa5, 0x85, 0xa6, 0x85, 0xa7, 0x85, 0xa9,
+	0x85, 0xab, 0x85, 0xac, 0x85, 0xad, 0x85, 0xb1, 0x85, 0xb2, 0x85, 0xb3,
+	0x85, 0xb4, 0x85, 0xb5, 0x85, 0xb6, 0x85, 0xb8, 0x85, 0xba, 0x85, 0xbb,
+	0x85, 0xbc, 0x85, 0xbd, 0x85, 0xbe, 0x85, 0xbf, 0x85, 0xc0, 0x85, 0xc2,
+	0x85, 0xc3, 0x85, 0xc4, 0x85, 0xc5, 0x85, 0xc6, 0x85, 0xc7, 0x85, 0xc8,
+	0x85, 0xca, 0x85, 0xcb, 0x85, 0xcc, 0x85, 0xcd, 0x85, 0xce, 0x85, 0xd1,
+	0x85, 0xd2, 0x85, 0xd4, 0x85, 0xd6, 0x85, 0xd7, 0x85, 0xd8, 0x85, 0xd9,
+	0x85, 0xda, 0x85, 0xdb, 0x85, 0xdd, 0x85, 0xde, 0x85, 0xdf, 0x85, 0xe0,
+	0x85, 0xe1, 0x85, 0xe2, 0x85, 0xe3, 0x85, 0xe5, 0x85, 0xe6, 0x85, 0xe7,
+	0x85, 0xe8, 0x85, 0xea, 0x85, 0xeb, 0x85, 0xec, 0x85, 0xed, 0x85, 0xee,
+	0x85, 0xef, 0x85, 0xf0, 0x85, 0xf1, 0x85, 0xf2, 0x85, 0xf3, 0x85, 0xf4,
+	0x85, 0xf5, 0x85, 0xf6, 0x85, 0xf7, 0x85, 0xf8, 0x60, 0x55, 0x52, 0x37,
+	0x80, 0x0d, 0x64, 0x54, 0x88, 0x70, 0x75, 0x29, 0x5e, 0x05, 0x68, 0x13,
+	0x62, 0xf4, 0x97, 0x1c, 0x53, 0xcc, 0x72, 0x3d, 0x8c, 0x01, 0x6c, 0x34,
+	0x77, 0x61, 0x7a, 0x0e, 0x54, 0x2e, 0x77, 0xac, 0x98, 0x7a, 0x82, 0x1c,
+	0x8b, 0xf4, 0x78, 0x55, 0x67, 0x14, 0x70, 0xc1, 0x65, 0xaf, 0x64, 0x95,
+	0x56, 0x36, 0x60, 0x1d, 0x79, 0xc1, 0x53, 0xf8, 0x4e, 0x1d, 0x6b, 0x7b,
+	0x80, 0x86, 0x5b, 0xfa, 0x55, 0xe3, 0x56, 0xdb, 0x4f, 0x3a, 0x4f, 0x3c,
+	0x99, 0x72, 0x5d, 0xf3, 0x67, 0x7e, 0x80, 0x38, 0x60, 0x02, 0x98, 0x82,
+	0x90, 0x01, 0x5b, 0x8b, 0x8b, 0xbc, 0x8b, 0xf5, 0x64, 0x1c, 0x82, 0x58,
+	0x64, 0xde, 0x55, 0xfd, 0x82, 0xcf, 0x91, 0x65, 0x4f, 0xd7, 0x7d, 0x20,
+	0x90, 0x1f, 0x7c, 0x9f, 0x50, 0xf3, 0x58, 0x51, 0x6e, 0xaf, 0x5b, 0xbf,
+	0x8b, 0xc9, 0x80, 0x83, 0x91, 0x78, 0x84, 0x9c, 0x7b, 0x97, 0x86, 0x7d,
+	0x96, 0x8b, 0x96, 0x8f, 0x7e, 0xe5, 0x9a, 0xd3, 0x78, 0x8e, 0x5c, 0x81,
+	0x7a, 0x57, 0x90, 0x42, 0x96, 0xa7, 0x79, 0x5f, 0x5b, 0x59, 0x63, 0x5f,
+	0x7b, 0x0b, 0x84, 0xd1, 0x68, 0xad, 0x55, 0x06, 0x7f, 0x29, 0x74, 0x10,
+	0x7d, 0x22, 0x95, 0x01, 0x62, 0x40, 0x58, 0x4c, 0x4e, 0xd6, 0x5b, 0x83,
+	0x59, 0x79, 0x58, 0x54, 0x85, 0xf9, 0x85, 0xfa, 0x85, 0xfc, 0x85, 0xfd,
+	0x85, 0xfe, 0x86, 0x00, 0x86, 0x01, 0x86, 0x02, 0x86, 0x03, 0x86, 0x04,
+	0x86, 0x06, 0x86, 0x07, 0x86, 0x08, 0x86, 0x09, 0x86, 0x0a, 0x86, 0x0b,
+	0x86, 0x0c, 0x86, 0x0d, 0x86, 0x0e, 0x86, 0x0f, 0x86, 0x10, 0x86, 0x12,
+	0x86, 0x13, 0x86, 0x14, 0x86, 0x15, 0x86, 0x17, 0x86, 0x18, 0x86, 0x19,
+	0x86, 0x1a, 0x86, 0x1b, 0x86, 0x1c, 0x86, 0x1d, 0x86, 0x1e, 0x86, 0x1f,
+	0x86, 0x20, 0x86, 0x21, 0x86, 0x22, 0x86, 0x23, 0x86, 0x24, 0x86, 0x25,
+	0x86, 0x26, 0x86, 0x28, 0x86, 0x2a, 0x86, 0x2b, 0x86, 0x2c, 0x86, 0x2d,
+	0x86, 0x2e, 0x86, 0x2f, 0x86, 0x30, 0x86, 0x31, 0x86, 0x32, 0x86, 0x33,
+	0x86, 0x34, 0x86, 0x35, 0x86, 0x36, 0x86, 0x37, 0x86, 0x39, 0x86, 0x3a,
+	0x86, 0x3b, 0x86, 0x3d, 0x86, 0x3e, 0x86, 0x3f, 0x86, 0x40, 0x86, 0x41,
+	0x86, 0x42, 0x86, 0x43, 0x86, 0x44, 0x86, 0x45, 0x86, 0x46, 0x86, 0x47,
+	0x86, 0x48, 0x86, 0x49, 0x86, 0x4a, 0x86, 0x4b, 0x86, 0x4c, 0x86, 0x52,
+	0x86, 0x53, 0x86, 0x55, 0x86, 0x56, 0x86, 0x57, 0x86, 0x58, 0x86, 0x59,
+	0x86, 0x5b, 0x86, 0x5c, 0x86, 0x5d, 0x86, 0x5f, 0x86, 0x60, 0x86, 0x61,
+	0x86, 0x63, 0x86, 0x64, 0x86, 0x65, 0x86, 0x66, 0x86, 0x67, 0x86, 0x68,
+	0x86, 0x69, 0x86, 0x6a, 0x73, 0x6d, 0x63, 0x1e, 0x8e, 0x4b, 0x8e, 0x0f,
+	0x80, 0xce, 0x82, 0xd4, 0x62, 0xac, 0x53, 0xf0, 0x6c, 0xf0, 0x91, 0x5e,
+	0x59, 0x2a, 0x60, 0x01, 0x6c, 0x70, 0x57, 0x4d, 0x64, 0x4a, 0x8d, 0x2a,
+	0x76, 0x2b, 0x6e, 0xe9, 0x57, 0x5b, 0x6a, 0x80, 0x75, 0xf0, 0x6f, 0x6d,
+	0x8c, 0x2d, 0x8c, 0x08, 0x57, 0x66, 0x6b, 0xef, 0x88, 0x92, 0x78, 0xb3,
+	0x63, 0xa2, 0x53, 0xf9, 0x70, 0xad, 0x6c, 0x64, 0x58, 0x58, 0x64, 0x2a,
+	0x58, 0x02, 0x68, 0xe0, 0x81, 0x9b, 0x55, 0x10, 0x7c, 0xd6, 0x50, 0x18,
+	0x8e, 0xba, 0x6d, 0xcc, 0x8d, 0x9f, 0x70, 0xeb, 0x63, 0x8f, 0x6d, 0x9b,
+	0x6e, 0xd4, 0x7e, 0xe6, 0x84, 0x04, 0x68, 0x43, 0x90, 0x03, 0x6d, 0xd8,
+	0x96, 0x76, 0x8b, 0xa8, 0x59, 0x57, 0x72, 0x79, 0x85, 0xe4, 0x81, 0x7e,
+	0x75, 0xbc, 0x8a, 0x8a, 0x68, 0xaf, 0x52, 0x54, 0x8e, 0x22, 0x95, 0x11,
+	0x63, 0xd0, 0x98, 0x98, 0x8e, 0x44, 0x55, 0x7c, 0x4f, 0x53, 0x66, 0xff,
+	0x56, 0x8f, 0x60, 0xd5, 0x6d, 0x95, 0x52, 0x43, 0x5c, 0x49, 0x59, 0x29,
+	0x6d, 0xfb, 0x58, 0x6b, 0x75, 0x30, 0x75, 0x1c, 0x60, 0x6c, 0x82, 0x14,
+	0x81, 0x46, 0x63, 0x11, 0x67, 0x61, 0x8f, 0xe2, 0x77, 0x3a, 0x8d, 0xf3,
+	0x8d, 0x34, 0x94, 0xc1, 0x5e, 0x16, 0x53, 0x85, 0x54, 0x2c, 0x70, 0xc3,
+	0x86, 0x6d, 0x86, 0x6f, 0x86, 0x70, 0x86, 0x72, 0x86, 0x73, 0x86, 0x74,
+	0x86, 0x75, 0x86, 0x76, 0x86, 0x77, 0x86, 0x78, 0x86, 0x83, 0x86, 0x84,
+	0x86, 0x85, 0x86, 0x86, 0x86, 0x87, 0x86, 0x88, 0x86, 0x89, 0x86, 0x8e,
+	0x86, 0x8f, 0x86, 0x90, 0x86, 0x91, 0x86, 0x92, 0x86, 0x94, 0x86, 0x96,
+	0x86, 0x97, 0x86, 0x98, 0x86, 0x99, 0x86, 0x9a, 0x86, 0x9b, 0x86, 0x9e,
+	0x86, 0x9f, 0x86, 0xa0, 0x86, 0xa1, 0x86, 0xa2, 0x86, 0xa5, 0x86, 0xa6,
+	0x86, 0xab, 0x86, 0xad, 0x86, 0xae, 0x86, 0xb2, 0x86, 0xb3, 0x86, 0xb7,
+	0x86, 0xb8, 0x86, 0xb9, 0x86, 0xbb, 0x86, 0xbc, 0x86, 0xbd, 0x86, 0xbe,
+	0x86, 0xbf, 0x86, 0xc1, 0x86, 0xc2, 0x86, 0xc3, 0x86, 0xc5, 0x86, 0xc8,
+	0x86, 0xcc, 0x86, 0xcd, 0x86, 0xd2, 0x86, 0xd3, 0x86, 0xd5, 0x86, 0xd6,
+	0x86, 0xd7, 0x86, 0xda, 0x86, 0xdc, 0x86, 0xdd, 0x86, 0xe0, 0x86, 0xe1,
+	0x86, 0xe2, 0x86, 0xe3, 0x86, 0xe5, 0x86, 0xe6, 0x86, 0xe7, 0x86, 0xe8,
+	0x86, 0xea, 0x86, 0xeb, 0x86, 0xec, 0x86, 0xef, 0x86, 0xf5, 0x86, 0xf6,
+	0x86, 0xf7, 0x86, 0xfa, 0x86, 0xfb, 0x86, 0xfc, 0x86, 0xfd, 0x86, 0xff,
+	0x87, 0x01, 0x87, 0x04, 0x87, 0x05, 0x87, 0x06, 0x87, 0x0b, 0x87, 0x0c,
+	0x87, 0x0e, 0x87, 0x0f, 0x87, 0x10, 0x87, 0x11, 0x87, 0x14, 0x87, 0x16,
+	0x6c, 0x40, 0x5e, 0xf7, 0x50, 0x5c, 0x4e, 0xad, 0x5e, 0xad, 0x63, 0x3a,
+	0x82, 0x47, 0x90, 0x1a, 0x68, 0x50, 0x91, 0x6e, 0x77, 0xb3, 0x54, 0x0c,
+	0x94, 0xdc, 0x5f, 0x64, 0x7a, 0xe5, 0x68, 0x76, 0x63, 0x45, 0x7b, 0x52,
+	0x7e, 0xdf, 0x75, 0xdb, 0x50, 0x77, 0x62, 0x95, 0x59, 0x34, 0x90, 0x0f,
+	0x51, 0xf8, 0x79, 0xc3, 0x7a, 0x81, 0x56, 0xfe, 0x5f, 0x92, 0x90, 0x14,
+	0x6d, 0x82, 0x5c, 0x60, 0x57, 0x1f, 0x54, 0x10, 0x51, 0x54, 0x6e, 0x4d,
+	0x56, 0xe2, 0x63, 0xa8, 0x98, 0x93, 0x81, 0x7f, 0x87, 0x15, 0x89, 0x2a,
+	0x90, 0x00, 0x54, 0x1e, 0x5c, 0x6f, 0x81, 0xc0, 0x62, 0xd6, 0x62, 0x58,
+	0x81, 0x31, 0x9e, 0x35, 0x96, 0x40, 0x9a, 0x6e, 0x9a, 0x7c, 0x69, 0x2d,
+	0x59, 0xa5, 0x62, 0xd3, 0x55, 0x3e, 0x63, 0x16, 0x54, 0xc7, 0x86, 0xd9,
+	0x6d, 0x3c, 0x5a, 0x03, 0x74, 0xe6, 0x88, 0x9c, 0x6b, 0x6a, 0x59, 0x16,
+	0x8c, 0x4c, 0x5f, 0x2f, 0x6e, 0x7e, 0x73, 0xa9, 0x98, 0x7d, 0x4e, 0x38,
+	0x70, 0xf7, 0x5b, 0x8c, 0x78, 0x97, 0x63, 0x3d, 0x66, 0x5a, 0x76, 0x96,
+	0x60, 0xcb, 0x5b, 0x9b, 0x5a, 0x49, 0x4e, 0x07, 0x81, 0x55, 0x6c, 0x6a,
+	0x73, 0x8b, 0x4e, 0xa1, 0x67, 0x89, 0x7f, 0x51, 0x5f, 0x80, 0x65, 0xfa,
+	0x67, 0x1b, 0x5f, 0xd8, 0x59, 0x84, 0x5a, 0x01, 0x87, 0x19, 0x87, 0x1b,
+	0x87, 0x1d, 0x87, 0x1f, 0x87, 0x20, 0x87, 0x24, 0x87, 0x26, 0x87, 0x27,
+	0x87, 0x28, 0x87, 0x2a, 0x87, 0x2b, 0x87, 0x2c, 0x87, 0x2d, 0x87, 0x2f,
+	0x87, 0x30, 0x87, 0x32, 0x87, 0x33, 0x87, 0x35, 0x87, 0x36, 0x87, 0x38,
+	0x87, 0x39, 0x87, 0x3a, 0x87, 0x3c, 0x87, 0x3d, 0x87, 0x40, 0x87, 0x41,
+	0x87, 0x42, 0x87, 0x43, 0x87, 0x44, 0x87, 0x45, 0x87, 0x46, 0x87, 0x4a,
+	0x87, 0x4b, 0x87, 0x4d, 0x87, 0x4f, 0x87, 0x50, 0x87, 0x51, 0x87, 0x52,
+	0x87, 0x54, 0x87, 0x55, 0x87, 0x56, 0x87, 0x58, 0x87, 0x5a, 0x87, 0x5b,
+	0x87, 0x5c, 0x87, 0x5d, 0x87, 0x5e, 0x87, 0x5f, 0x87, 0x61, 0x87, 0x62,
+	0x87, 0x66, 0x87, 0x67, 0x87, 0x68, 0x87, 0x69, 0x87, 0x6a, 0x87, 0x6b,
+	0x87, 0x6c, 0x87, 0x6d, 0x87, 0x6f, 0x87, 0x71, 0x87, 0x72, 0x87, 0x73,
+	0x87, 0x75, 0x87, 0x77, 0x87, 0x78, 0x87, 0x79, 0x87, 0x7a, 0x87, 0x7f,
+	0x87, 0x80, 0x87, 0x81, 0x87, 0x84, 0x87, 0x86, 0x87, 0x87, 0x87, 0x89,
+	0x87, 0x8a, 0x87, 0x8c, 0x87, 0x8e, 0x87, 0x8f, 0x87, 0x90, 0x87, 0x91,
+	0x87, 0x92, 0x87, 0x94, 0x87, 0x95, 0x87, 0x96, 0x87, 0x98, 0x87, 0x99,
+	0x87, 0x9a, 0x87, 0x9b, 0x87, 0x9c, 0x87, 0x9d, 0x87, 0x9e, 0x87, 0xa0,
+	0x87, 0xa1, 0x87, 0xa2, 0x87, 0xa3, 0x87, 0xa4, 0x5d, 0xcd, 0x5f, 0xae,
+	0x53, 0x71, 0x97, 0xe6, 0x8f, 0xdd, 0x68, 0x45, 0x56, 0xf4, 0x55, 0x2f,
+	0x60, 0xdf, 0x4e, 0x3a, 0x6f, 0x4d, 0x7e, 0xf4, 0x82, 0xc7, 0x84, 0x0e,
+	0x59, 0xd4, 0x4f, 0x1f, 0x4f, 0x2a, 0x5c, 0x3e, 0x7e, 0xac, 0x67, 0x2a,
+	0x85, 0x1a, 0x54, 0x73, 0x75, 0x4f, 0x80, 0xc3, 0x55, 0x82, 0x9b, 0x4f,
+	0x4f, 0x4d, 0x6e, 0x2d, 0x8c, 0x13, 0x5c, 0x09, 0x61, 0x70, 0x53, 0x6b,
+	0x76, 0x1f, 0x6e, 0x29, 0x86, 0x8a, 0x65, 0x87, 0x95, 0xfb, 0x7e, 0xb9,
+	0x54, 0x3b, 0x7a, 0x33, 0x7d, 0x0a, 0x95, 0xee, 0x55, 0xe1, 0x7f, 0xc1,
+	0x74, 0xee, 0x63, 0x1d, 0x87, 0x17, 0x6d, 0xa1, 0x7a, 0x9d, 0x62, 0x11,
+	0x65, 0xa1, 0x53, 0x67, 0x63, 0xe1, 0x6c, 0x83, 0x5d, 0xeb, 0x54, 0x5c,
+	0x94, 0xa8, 0x4e, 0x4c, 0x6c, 0x61, 0x8b, 0xec, 0x5c, 0x4b, 0x65, 0xe0,
+	0x82, 0x9c, 0x68, 0xa7, 0x54, 0x3e, 0x54, 0x34, 0x6b, 0xcb, 0x6b, 0x66,
+	0x4e, 0x94, 0x63, 0x42, 0x53, 0x48, 0x82, 0x1e, 0x4f, 0x0d, 0x4f, 0xae,
+	0x57, 0x5e, 0x62, 0x0a, 0x96, 0xfe, 0x66, 0x64, 0x72, 0x69, 0x52, 0xff,
+	0x52, 0xa1, 0x60, 0x9f, 0x8b, 0xef, 0x66, 0x14, 0x71, 0x99, 0x67, 0x90,
+	0x89, 0x7f, 0x78, 0x52, 0x77, 0xfd, 0x66, 0x70, 0x56, 0x3b, 0x54, 0x38,
+	0x95, 0x21, 0x72, 0x7a, 0x87, 0xa5, 0x87, 0xa6, 0x87, 0xa7, 0x87, 0xa9,
+	0x87, 0xaa, 0x87, 0xae, 0x87, 0xb0, 0x87, 0xb1, 0x87, 0xb2, 0x87, 0xb4,
+	0x87, 0xb6, 0x87, 0xb7, 0x87, 0xb8, 0x87, 0xb9, 0x87, 0xbb, 0x87, 0xbc,
+	0x87, 0xbe, 0x87, 0xbf, 0x87, 0xc1, 0x87, 0xc2, 0x87, 0xc3, 0x87, 0xc4,
+	0x87, 0xc5, 0x87, 0xc7, 0x87, 0xc8, 0x87, 0xc9, 0x87, 0xcc, 0x87, 0xcd,
+	0x87, 0xce, 0x87, 0xcf, 0x87, 0xd0, 0x87, 0xd4, 0x87, 0xd5, 0x87, 0xd6,
+	0x87, 0xd7, 0x87, 0xd8, 0x87, 0xd9, 0x87, 0xda, 0x87, 0xdc, 0x87, 0xdd,
+	0x87, 0xde, 0x87, 0xdf, 0x87, 0xe1, 0x87, 0xe2, 0x87, 0xe3, 0x87, 0xe4,
+	0x87, 0xe6, 0x87, 0xe7, 0x87, 0xe8, 0x87, 0xe9, 0x87, 0xeb, 0x87, 0xec,
+	0x87, 0xed, 0x87, 0xef, 0x87, 0xf0, 0x87, 0xf1, 0x87, 0xf2, 0x87, 0xf3,
+	0x87, 0xf4, 0x87, 0xf5, 0x87, 0xf6, 0x87, 0xf7, 0x87, 0xf8, 0x87, 0xfa,
+	0x87, 0xfb, 0x87, 0xfc, 0x87, 0xfd, 0x87, 0xff, 0x88, 0x00, 0x88, 0x01,
+	0x88, 0x02, 0x88, 0x04, 0x88, 0x05, 0x88, 0x06, 0x88, 0x07, 0x88, 0x08,
+	0x88, 0x09, 0x88, 0x0b, 0x88, 0x0c, 0x88, 0x0d, 0x88, 0x0e, 0x88, 0x0f,
+	0x88, 0x10, 0x88, 0x11, 0x88, 0x12, 0x88, 0x14, 0x88, 0x17, 0x88, 0x18,
+	0x88, 0x19, 0x88, 0x1a, 0x88, 0x1c, 0x88, 0x1d, 0x88, 0x1e, 0x88, 0x1f,
+	0x88, 0x20, 0x88, 0x23, 0x7a, 0x00, 0x60, 0x6f, 0x5e, 0x0c, 0x60, 0x89,
+	0x81, 0x9d, 0x59, 0x15, 0x60, 0xdc, 0x71, 0x84, 0x70, 0xef, 0x6e, 0xaa,
+	0x6c, 0x50, 0x72, 0x80, 0x6a, 0x84, 0x88, 0xad, 0x5e, 0x2d, 0x4e, 0x60,
+	0x5a, 0xb3, 0x55, 0x9c, 0x94, 0xe3, 0x6d, 0x17, 0x7c, 0xfb, 0x96, 0x99,
+	0x62, 0x0f, 0x7e, 0xc6, 0x77, 0x8e, 0x86, 0x7e, 0x53, 0x23, 0x97, 0x1e,
+	0x8f, 0x96, 0x66, 0x87, 0x5c, 0xe1, 0x4f, 0xa0, 0x72, 0xed, 0x4e, 0x0b,
+	0x53, 0xa6, 0x59, 0x0f, 0x54, 0x13, 0x63, 0x80, 0x95, 0x28, 0x51, 0x48,
+	0x4e, 0xd9, 0x9c, 0x9c, 0x7e, 0xa4, 0x54, 0xb8, 0x8d, 0x24, 0x88, 0x54,
+	0x82, 0x37, 0x95, 0xf2, 0x6d, 0x8e, 0x5f, 0x26, 0x5a, 0xcc, 0x66, 0x3e,
+	0x96, 0x69, 0x73, 0xb0, 0x73, 0x2e, 0x53, 0xbf, 0x81, 0x7a, 0x99, 0x85,
+	0x7f, 0xa1, 0x5b, 0xaa, 0x96, 0x77, 0x96, 0x50, 0x7e, 0xbf, 0x76, 0xf8,
+	0x53, 0xa2, 0x95, 0x76, 0x99, 0x99, 0x7b, 0xb1, 0x89, 0x44, 0x6e, 0x58,
+	0x4e, 0x61, 0x7f, 0xd4, 0x79, 0x65, 0x8b, 0xe6, 0x60, 0xf3, 0x54, 0xcd,
+	0x4e, 0xab, 0x98, 0x79, 0x5d, 0xf7, 0x6a, 0x61, 0x50, 0xcf, 0x54, 0x11,
+	0x8c, 0x61, 0x84, 0x27, 0x78, 0x5d, 0x97, 0x04, 0x52, 0x4a, 0x54, 0xee,
+	0x56, 0xa3, 0x95, 0x00, 0x6d, 0x88, 0x5b, 0xb5, 0x6d, 0xc6, 0x66, 0x53,
+	0x88, 0x24, 0x88, 0x25, 0x88, 0x26, 0x88, 0x27, 0x88, 0x28, 0x88, 0x29,
+	0x88, 0x2a, 0x88, 0x2b, 0x88, 0x2c, 0x88, 0x2d, 0x88, 0x2e, 0x88, 0x2f,
+	0x88, 0x30, 0x88, 0x31, 0x88, 0x33, 0x88, 0x34, 0x88, 0x35, 0x88, 0x36,
+	0x88, 0x37, 0x88, 0x38, 0x88, 0x3a, 0x88, 0x3b, 0x88, 0x3d, 0x88, 0x3e,
+	0x88, 0x3f, 0x88, 0x41, 0x88, 0x42, 0x88, 0x43, 0x88, 0x46, 0x88, 0x47,
+	0x88, 0x48, 0x88, 0x49, 0x88, 0x4a, 0x88, 0x4b, 0x88, 0x4e, 0x88, 0x4f,
+	0x88, 0x50, 0x88, 0x51, 0x88, 0x52, 0x88, 0x53, 0x88, 0x55, 0x88, 0x56,
+	0x88, 0x58, 0x88, 0x5a, 0x88, 0x5b, 0x88, 0x5c, 0x88, 0x5d, 0x88, 0x5e,
+	0x88, 0x5f, 0x88, 0x60, 0x88, 0x66, 0x88, 0x67, 0x88, 0x6a, 0x88, 0x6d,
+	0x88, 0x6f, 0x88, 0x71, 0x88, 0x73, 0x88, 0x74, 0x88, 0x75, 0x88, 0x76,
+	0x88, 0x78, 0x88, 0x79, 0x88, 0x7a, 0x88, 0x7b, 0x88, 0x7c, 0x88, 0x80,
+	0x88, 0x83, 0x88, 0x86, 0x88, 0x87, 0x88, 0x89, 0x88, 0x8a, 0x88, 0x8c,
+	0x88, 0x8e, 0x88, 0x8f, 0x88, 0x90, 0x88, 0x91, 0x88, 0x93, 0x88, 0x94,
+	0x88, 0x95, 0x88, 0x97, 0x88, 0x98, 0x88, 0x99, 0x88, 0x9a, 0x88, 0x9b,
+	0x88, 0x9d, 0x88, 0x9e, 0x88, 0x9f, 0x88, 0xa0, 0x88, 0xa1, 0x88, 0xa3,
+	0x88, 0xa5, 0x88, 0xa6, 0x88, 0xa7, 0x88, 0xa8, 0x88, 0xa9, 0x88, 0xaa,
+	0x5c, 0x0f, 0x5b, 0x5d, 0x68, 0x21, 0x80, 0x96, 0x55, 0x78, 0x7b, 0x11,
+	0x65, 0x48, 0x69, 0x54, 0x4e, 0x9b, 0x6b, 0x47, 0x87, 0x4e, 0x97, 0x8b,
+	0x53, 0x4f, 0x63, 0x1f, 0x64, 0x3a, 0x90, 0xaa, 0x65, 0x9c, 0x80, 0xc1,
+	0x8c, 0x10, 0x51, 0x99, 0x68, 0xb0, 0x53, 0x78, 0x87, 0xf9, 0x61, 0xc8,
+	0x6c, 0xc4, 0x6c, 0xfb, 0x8c, 0x22, 0x5c, 0x51, 0x85, 0xaa, 0x82, 0xaf,
+	0x95, 0x0c, 0x6b, 0x23, 0x8f, 0x9b, 0x65, 0xb0, 0x5f, 0xfb, 0x5f, 0xc3,
+	0x4f, 0xe1, 0x88, 0x45, 0x66, 0x1f, 0x81, 0x65, 0x73, 0x29, 0x60, 0xfa,
+	0x51, 0x74, 0x52, 0x11, 0x57, 0x8b, 0x5f, 0x62, 0x90, 0xa2, 0x88, 0x4c,
+	0x91, 0x92, 0x5e, 0x78, 0x67, 0x4f, 0x60, 0x27, 0x59, 0xd3, 0x51, 0x44,
+	0x51, 0xf6, 0x80, 0xf8, 0x53, 0x08, 0x6c, 0x79, 0x96, 0xc4, 0x71, 0x8a,
+	0x4f, 0x11, 0x4f, 0xee, 0x7f, 0x9e, 0x67, 0x3d, 0x55, 0xc5, 0x95, 0x08,
+	0x79, 0xc0, 0x88, 0x96, 0x7e, 0xe3, 0x58, 0x9f, 0x62, 0x0c, 0x97, 0x00,
+	0x86, 0x5a, 0x56, 0x18, 0x98, 0x7b, 0x5f, 0x90, 0x8b, 0xb8, 0x84, 0xc4,
+	0x91, 0x57, 0x53, 0xd9, 0x65, 0xed, 0x5e, 0x8f, 0x75, 0x5c, 0x60, 0x64,
+	0x7d, 0x6e, 0x5a, 0x7f, 0x7e, 0xea, 0x7e, 0xed, 0x8f, 0x69, 0x55, 0xa7,
+	0x5b, 0xa3, 0x60, 0xac, 0x65, 0xcb, 0x73, 0x84, 0x88, 0xac, 0x88, 0xae,
+	0x88, 0xaf, 0x88, 0xb0, 0x88, 0xb2, 0x88, 0xb3, 0x88, 0xb4, 0x88, 0xb5,
+	0x88, 0xb6, 0x88, 0xb8, 0x88, 0xb9, 0x88, 0xba, 0x88, 0xbb, 0x88, 0xbd,
+	0x88, 0xbe, 0x88, 0xbf, 0x88, 0xc0, 0x88, 0xc3, 0x88, 0xc4, 0x88, 0xc7,
+	0x88, 0xc8, 0x88, 0xca, 0x88, 0xcb, 0x88, 0xcc, 0x88, 0xcd, 0x88, 0xcf,
+	0x88, 0xd0, 0x88, 0xd1, 0x88, 0xd3, 0x88, 0xd6, 0x88, 0xd7, 0x88, 0xda,
+	0x88, 0xdb, 0x88, 0xdc, 0x88, 0xdd, 0x88, 0xde, 0x88, 0xe0, 0x88, 0xe1,
+	0x88, 0xe6, 0x88, 0xe7, 0x88, 0xe9, 0x88, 0xea, 0x88, 0xeb, 0x88, 0xec,
+	0x88, 0xed, 0x88, 0xee, 0x88, 0xef, 0x88, 0xf2, 0x88, 0xf5, 0x88, 0xf6,
+	0x88, 0xf7, 0x88, 0xfa, 0x88, 0xfb, 0x88, 0xfd, 0x88, 0xff, 0x89, 0x00,
+	0x89, 0x01, 0x89, 0x03, 0x89, 0x04, 0x89, 0x05, 0x89, 0x06, 0x89, 0x07,
+	0x89, 0x08, 0x89, 0x09, 0x89, 0x0b, 0x89, 0x0c, 0x89, 0x0d, 0x89, 0x0e,
+	0x89, 0x0f, 0x89, 0x11, 0x89, 0x14, 0x89, 0x15, 0x89, 0x16, 0x89, 0x17,
+	0x89, 0x18, 0x89, 0x1c, 0x89, 0x1d, 0x89, 0x1e, 0x89, 0x1f, 0x89, 0x20,
+	0x89, 0x22, 0x89, 0x23, 0x89, 0x24, 0x89, 0x26, 0x89, 0x27, 0x89, 0x28,
+	0x89, 0x29, 0x89, 0x2c, 0x89, 0x2d, 0x89, 0x2e, 0x89, 0x2f, 0x89, 0x31,
+	0x89, 0x32, 0x89, 0x33, 0x89, 0x35, 0x89, 0x37, 0x90, 0x09, 0x76, 0x63,
+	0x77, 0x29, 0x7e, 0xda, 0x97, 0x74, 0x85, 0x9b, 0x5b, 0x66, 0x7a, 0x74,
+	0x96, 0xea, 0x88, 0x40, 0x52, 0xcb, 0x71, 0x8f, 0x5f, 0xaa, 0x65, 0xec,
+	0x8b, 0xe2, 0x5b, 0xfb, 0x9a, 0x6f, 0x5d, 0xe1, 0x6b, 0x89, 0x6c, 0x5b,
+	0x8b, 0xad, 0x8b, 0xaf, 0x90, 0x0a, 0x8f, 0xc5, 0x53, 0x8b, 0x62, 0xbc,
+	0x9e, 0x26, 0x9e, 0x2d, 0x54, 0x40, 0x4e, 0x2b, 0x82, 0xbd, 0x72, 0x59,
+	0x86, 0x9c, 0x5d, 0x16, 0x88, 0x59, 0x6d, 0xaf, 0x96, 0xc5, 0x54, 0xd1,
+	0x4e, 0x9a, 0x8b, 0xb6, 0x71, 0x09, 0x54, 0xbd, 0x96, 0x09, 0x70, 0xdf,
+	0x6d, 0xf9, 0x76, 0xd0, 0x4e, 0x25, 0x78, 0x14, 0x87, 0x12, 0x5c, 0xa9,
+	0x5e, 0xf6, 0x8a, 0x00, 0x98, 0x9c, 0x96, 0x0e, 0x70, 0x8e, 0x6c, 0xbf,
+	0x59, 0x44, 0x63, 0xa9, 0x77, 0x3c, 0x88, 0x4d, 0x6f, 0x14, 0x82, 0x73,
+	0x58, 0x30, 0x71, 0xd5, 0x53, 0x8c, 0x78, 0x1a, 0x96, 0xc1, 0x55, 0x01,
+	0x5f, 0x66, 0x71, 0x30, 0x5b, 0xb4, 0x8c, 0x1a, 0x9a, 0x8c, 0x6b, 0x83,
+	0x59, 0x2e, 0x9e, 0x2f, 0x79, 0xe7, 0x67, 0x68, 0x62, 0x6c, 0x4f, 0x6f,
+	0x75, 0xa1, 0x7f, 0x8a, 0x6d, 0x0b, 0x96, 0x33, 0x6c, 0x27, 0x4e, 0xf0,
+	0x75, 0xd2, 0x51, 0x7b, 0x68, 0x37, 0x6f, 0x3e, 0x90, 0x80, 0x81, 0x70,
+	0x59, 0x96, 0x74, 0x76, 0x89, 0x38, 0x89, 0x39, 0x89, 0x3a, 0x89, 0x3b,
+	0x89, 0x3c, 0x89, 0x3d, 0x89, 0x3e, 0x89, 0x3f, 0x89, 0x40, 0x89, 0x42,
+	0x89, 0x43, 0x89, 0x45, 0x89, 0x46, 0x89, 0x47, 0x89, 0x48, 0x89, 0x49,
+	0x89, 0x4a, 0x89, 0x4b, 0x89, 0x4c, 0x89, 0x4d, 0x89, 0x4e, 0x89, 0x4f,
+	0x89, 0x50, 0x89, 0x51, 0x89, 0x52, 0x89, 0x53, 0x89, 0x54, 0x89, 0x55,
+	0x89, 0x56, 0x89, 0x57, 0x89, 0x58, 0x89, 0x59, 0x89, 0x5a, 0x89, 0x5b,
+	0x89, 0x5c, 0x89, 0x5d, 0x89, 0x60, 0x89, 0x61, 0x89, 0x62, 0x89, 0x63,
+	0x89, 0x64, 0x89, 0x65, 0x89, 0x67, 0x89, 0x68, 0x89, 0x69, 0x89, 0x6a,
+	0x89, 0x6b, 0x89, 0x6c, 0x89, 0x6d, 0x89, 0x6e, 0x89, 0x6f, 0x89, 0x70,
+	0x89, 0x71, 0x89, 0x72, 0x89, 0x73, 0x89, 0x74, 0x89, 0x75, 0x89, 0x76,
+	0x89, 0x77, 0x89, 0x78, 0x89, 0x79, 0x89, 0x7a, 0x89, 0x7c, 0x89, 0x7d,
+	0x89, 0x7e, 0x89, 0x80, 0x89, 0x82, 0x89, 0x84, 0x89, 0x85, 0x89, 0x87,
+	0x89, 0x88, 0x89, 0x89, 0x89, 0x8a, 0x89, 0x8b, 0x89, 0x8c, 0x89, 0x8d,
+	0x89, 0x8e, 0x89, 0x8f, 0x89, 0x90, 0x89, 0x91, 0x89, 0x92, 0x89, 0x93,
+	0x89, 0x94, 0x89, 0x95, 0x89, 0x96, 0x89, 0x97, 0x89, 0x98, 0x89, 0x99,
+	0x89, 0x9a, 0x89, 0x9b, 0x89, 0x9c, 0x89, 0x9d, 0x89, 0x9e, 0x89, 0x9f,
+	0x89, 0xa0, 0x89, 0xa1, 0x64, 0x47, 0x5c, 0x27, 0x90, 0x65, 0x7a, 0x91,
+	0x8c, 0x23, 0x59, 0xda, 0x54, 0xac, 0x82, 0x00, 0x83, 0x6f, 0x89, 0x81,
+	0x80, 0x00, 0x69, 0x30, 0x56, 0x4e, 0x80, 0x36, 0x72, 0x37, 0x91, 0xce,
+	0x51, 0xb6, 0x4e, 0x5f, 0x98, 0x75, 0x63, 0x96, 0x4e, 0x1a, 0x53, 0xf6,
+	0x66, 0xf3, 0x81, 0x4b, 0x59, 0x1c, 0x6d, 0xb2, 0x4e, 0x00, 0x58, 0xf9,
+	0x53, 0x3b, 0x63, 0xd6, 0x94, 0xf1, 0x4f, 0x9d, 0x4f, 0x0a, 0x88, 0x63,
+	0x98, 0x90, 0x59, 0x37, 0x90, 0x57, 0x79, 0xfb, 0x4e, 0xea, 0x80, 0xf0,
+	0x75, 0x91, 0x6c, 0x82, 0x5b, 0x9c, 0x59, 0xe8, 0x5f, 0x5d, 0x69, 0x05,
+	0x86, 0x81, 0x50, 0x1a, 0x5d, 0xf2, 0x4e, 0x59, 0x77, 0xe3, 0x4e, 0xe5,
+	0x82, 0x7a, 0x62, 0x91, 0x66, 0x13, 0x90, 0x91, 0x5c, 0x79, 0x4e, 0xbf,
+	0x5f, 0x79, 0x81, 0xc6, 0x90, 0x38, 0x80, 0x84, 0x75, 0xab, 0x4e, 0xa6,
+	0x88, 0xd4, 0x61, 0x0f, 0x6b, 0xc5, 0x5f, 0xc6, 0x4e, 0x49, 0x76, 0xca,
+	0x6e, 0xa2, 0x8b, 0xe3, 0x8b, 0xae, 0x8c, 0x0a, 0x8b, 0xd1, 0x5f, 0x02,
+	0x7f, 0xfc, 0x7f, 0xcc, 0x7e, 0xce, 0x83, 0x35, 0x83, 0x6b, 0x56, 0xe0,
+	0x6b, 0xb7, 0x97, 0xf3, 0x96, 0x34, 0x59, 0xfb, 0x54, 0x1f, 0x94, 0xf6,
+	0x6d, 0xeb, 0x5b, 0xc5, 0x99, 0x6e, 0x5c, 0x39, 0x5f, 0x15, 0x96, 0x90,
+	0x89, 0xa2, 0x89, 0xa3, 0x89, 0xa4, 0x89, 0xa5, 0x89, 0xa6, 0x89, 0xa7,
+	0x89, 0xa8, 0x89, 0xa9, 0x89, 0xaa, 0x89, 0xab, 0x89, 0xac, 0x89, 0xad,
+	0x89, 0xae, 0x89, 0xaf, 0x89, 0xb0, 0x89, 0xb1, 0x89, 0xb2, 0x89, 0xb3,
+	0x89, 0xb4, 0x89, 0xb5, 0x89, 0xb6, 0x89, 0xb7, 0x89, 0xb8, 0x89, 0xb9,
+	0x89, 0xba, 0x89, 0xbb, 0x89, 0xbc, 0x89, 0xbd, 0x89, 0xbe, 0x89, 0xbf,
+	0x89, 0xc0, 0x89, 0xc3, 0x89, 0xcd, 0x89, 0xd3, 0x89, 0xd4, 0x89, 0xd5,
+	0x89, 0xd7, 0x89, 0xd8, 0x89, 0xd9, 0x89, 0xdb, 0x89, 0xdd, 0x89, 0xdf,
+	0x89, 0xe0, 0x89, 0xe1, 0x89, 0xe2, 0x89, 0xe4, 0x89, 0xe7, 0x89, 0xe8,
+	0x89, 0xe9, 0x89, 0xea, 0x89, 0xec, 0x89, 0xed, 0x89, 0xee, 0x89, 0xf0,
+	0x89, 0xf1, 0x89, 0xf2, 0x89, 0xf4, 0x89, 0xf5, 0x89, 0xf6, 0x89, 0xf7,
+	0x89, 0xf8, 0x89, 0xf9, 0x89, 0xfa, 0x89, 0xfb, 0x89, 0xfc, 0x89, 0xfd,
+	0x89, 0xfe, 0x89, 0xff, 0x8a, 0x01, 0x8a, 0x02, 0x8a, 0x03, 0x8a, 0x04,
+	0x8a, 0x05, 0x8a, 0x06, 0x8a, 0x08, 0x8a, 0x09, 0x8a, 0x0a, 0x8a, 0x0b,
+	0x8a, 0x0c, 0x8a, 0x0d, 0x8a, 0x0e, 0x8a, 0x0f, 0x8a, 0x10, 0x8a, 0x11,
+	0x8a, 0x12, 0x8a, 0x13, 0x8a, 0x14, 0x8a, 0x15, 0x8a, 0x16, 0x8a, 0x17,
+	0x8a, 0x18, 0x8a, 0x19, 0x8a, 0x1a, 0x8a, 0x1b, 0x8a, 0x1c, 0x8a, 0x1d,
+	0x53, 0x70, 0x82, 0xf1, 0x6a, 0x31, 0x5a, 0x74, 0x9e, 0x70, 0x5e, 0x94,
+	0x7f, 0x28, 0x83, 0xb9, 0x84, 0x24, 0x84, 0x25, 0x83, 0x67, 0x87, 0x47,
+	0x8f, 0xce, 0x8d, 0x62, 0x76, 0xc8, 0x5f, 0x71, 0x98, 0x96, 0x78, 0x6c,
+	0x66, 0x20, 0x54, 0xdf, 0x62, 0xe5, 0x4f, 0x63, 0x81, 0xc3, 0x75, 0xc8,
+	0x5e, 0xb8, 0x96, 0xcd, 0x8e, 0x0a, 0x86, 0xf9, 0x54, 0x8f, 0x6c, 0xf3,
+	0x6d, 0x8c, 0x6c, 0x38, 0x60, 0x7f, 0x52, 0xc7, 0x75, 0x28, 0x5e, 0x7d,
+	0x4f, 0x18, 0x60, 0xa0, 0x5f, 0xe7, 0x5c, 0x24, 0x75, 0x31, 0x90, 0xae,
+	0x94, 0xc0, 0x72, 0xb9, 0x6c, 0xb9, 0x6e, 0x38, 0x91, 0x49, 0x67, 0x09,
+	0x53, 0xcb, 0x53, 0xf3, 0x4f, 0x51, 0x91, 0xc9, 0x8b, 0xf1, 0x53, 0xc8,
+	0x5e, 0x7c, 0x8f, 0xc2, 0x6d, 0xe4, 0x4e, 0x8e, 0x76, 0xc2, 0x69, 0x86,
+	0x86, 0x5e, 0x61, 0x1a, 0x82, 0x06, 0x4f, 0x59, 0x4f, 0xde, 0x90, 0x3e,
+	0x9c, 0x7c, 0x61, 0x09, 0x6e, 0x1d, 0x6e, 0x14, 0x96, 0x85, 0x4e, 0x88,
+	0x5a, 0x31, 0x96, 0xe8, 0x4e, 0x0e, 0x5c, 0x7f, 0x79, 0xb9, 0x5b, 0x87,
+	0x8b, 0xed, 0x7f, 0xbd, 0x73, 0x89, 0x57, 0xdf, 0x82, 0x8b, 0x90, 0xc1,
+	0x54, 0x01, 0x90, 0x47, 0x55, 0xbb, 0x5c, 0xea, 0x5f, 0xa1, 0x61, 0x08,
+	0x6b, 0x32, 0x72, 0xf1, 0x80, 0xb2, 0x8a, 0x89, 0x8a, 0x1e, 0x8a, 0x1f,
+	0x8a, 0x20, 0x8a, 0x21, 0x8a, 0x22, 0x8a, 0x23, 0x8a, 0x24, 0x8a, 0x25,
+	0x8a, 0x26, 0x8a, 0x27, 0x8a, 0x28, 0x8a, 0x29, 0x8a, 0x2a, 0x8a, 0x2b,
+	0x8a, 0x2c, 0x8a, 0x2d, 0x8a, 0x2e, 0x8a, 0x2f, 0x8a, 0x30, 0x8a, 0x31,
+	0x8a, 0x32, 0x8a, 0x33, 0x8a, 0x34, 0x8a, 0x35, 0x8a, 0x36, 0x8a, 0x37,
+	0x8a, 0x38, 0x8a, 0x39, 0x8a, 0x3a, 0x8a, 0x3b, 0x8a, 0x3c, 0x8a, 0x3d,
+	0x8a, 0x3f, 0x8a, 0x40, 0x8a, 0x41, 0x8a, 0x42, 0x8a, 0x43, 0x8a, 0x44,
+	0x8a, 0x45, 0x8a, 0x46, 0x8a, 0x47, 0x8a, 0x49, 0x8a, 0x4a, 0x8a, 0x4b,
+	0x8a, 0x4c, 0x8a, 0x4d, 0x8a, 0x4e, 0x8a, 0x4f, 0x8a, 0x50, 0x8a, 0x51,
+	0x8a, 0x52, 0x8a, 0x53, 0x8a, 0x54, 0x8a, 0x55, 0x8a, 0x56, 0x8a, 0x57,
+	0x8a, 0x58, 0x8a, 0x59, 0x8a, 0x5a, 0x8a, 0x5b, 0x8a, 0x5c, 0x8a, 0x5d,
+	0x8a, 0x5e, 0x8a, 0x5f, 0x8a, 0x60, 0x8a, 0x61, 0x8a, 0x62, 0x8a, 0x63,
+	0x8a, 0x64, 0x8a, 0x65, 0x8a, 0x66, 0x8a, 0x67, 0x8a, 0x68, 0x8a, 0x69,
+	0x8a, 0x6a, 0x8a, 0x6b, 0x8a, 0x6c, 0x8a, 0x6d, 0x8a, 0x6e, 0x8a, 0x6f,
+	0x8a, 0x70, 0x8a, 0x71, 0x8a, 0x72, 0x8a, 0x73, 0x8a, 0x74, 0x8a, 0x75,
+	0x8a, 0x76, 0x8a, 0x77, 0x8a, 0x78, 0x8a, 0x7a, 0x8a, 0x7b, 0x8a, 0x7c,
+	0x8a, 0x7d, 0x8a, 0x7e, 0x8a, 0x7f, 0x8a, 0x80, 0x6d, 0x74, 0x5b, 0xd3,
+	0x88, 0xd5, 0x98, 0x84, 0x8c, 0x6b, 0x9a, 0x6d, 0x9e, 0x33, 0x6e, 0x0a,
+	0x51, 0xa4, 0x51, 0x43, 0x57, 0xa3, 0x88, 0x81, 0x53, 0x9f, 0x63, 0xf4,
+	0x8f, 0x95, 0x56, 0xed, 0x54, 0x58, 0x57, 0x06, 0x73, 0x3f, 0x6e, 0x90,
+	0x7f, 0x18, 0x8f, 0xdc, 0x82, 0xd1, 0x61, 0x3f, 0x60, 0x28, 0x96, 0x62,
+	0x66, 0xf0, 0x7e, 0xa6, 0x8d, 0x8a, 0x8d, 0xc3, 0x94, 0xa5, 0x5c, 0xb3,
+	0x7c, 0xa4, 0x67, 0x08, 0x60, 0xa6, 0x96, 0x05, 0x80, 0x18, 0x4e, 0x91,
+	0x90, 0xe7, 0x53, 0x00, 0x96, 0x68, 0x51, 0x41, 0x8f, 0xd0, 0x85, 0x74,
+	0x91, 0x5d, 0x66, 0x55, 0x97, 0xf5, 0x5b, 0x55, 0x53, 0x1d, 0x78, 0x38,
+	0x67, 0x42, 0x68, 0x3d, 0x54, 0xc9, 0x70, 0x7e, 0x5b, 0xb0, 0x8f, 0x7d,
+	0x51, 0x8d, 0x57, 0x28, 0x54, 0xb1, 0x65, 0x12, 0x66, 0x82, 0x8d, 0x5e,
+	0x8d, 0x43, 0x81, 0x0f, 0x84, 0x6c, 0x90, 0x6d, 0x7c, 0xdf, 0x51, 0xff,
+	0x85, 0xfb, 0x67, 0xa3, 0x65, 0xe9, 0x6f, 0xa1, 0x86, 0xa4, 0x8e, 0x81,
+	0x56, 0x6a, 0x90, 0x20, 0x76, 0x82, 0x70, 0x76, 0x71, 0xe5, 0x8d, 0x23,
+	0x62, 0xe9, 0x52, 0x19, 0x6c, 0xfd, 0x8d, 0x3c, 0x60, 0x0e, 0x58, 0x9e,
+	0x61, 0x8e, 0x66, 0xfe, 0x8d, 0x60, 0x62, 0x4e, 0x55, 0xb3, 0x6e, 0x23,
+	0x67, 0x2d, 0x8f, 0x67, 0x8a, 0x81, 0x8a, 0x82, 0x8a, 0x83, 0x8a, 0x84,
+	0x8a, 0x85, 0x8a, 0x86, 0x8a, 0x87, 0x8a, 0x88, 0x8a, 0x8b, 0x8a, 0x8c,
+	0x8a, 0x8d, 0x8a, 0x8e, 0x8a, 0x8f, 0x8a, 0x90, 0x8a, 0x91, 0x8a, 0x92,
+	0x8a, 0x94, 0x8a, 0x95, 0x8a, 0x96, 0x8a, 0x97, 0x8a, 0x98, 0x8a, 0x99,
+	0x8a, 0x9a, 0x8a, 0x9b, 0x8a, 0x9c, 0x8a, 0x9d, 0x8a, 0x9e, 0x8a, 0x9f,
+	0x8a, 0xa0, 0x8a, 0xa1, 0x8a, 0xa2, 0x8a, 0xa3, 0x8a, 0xa4, 0x8a, 0xa5,
+	0x8a, 0xa6, 0x8a, 0xa7, 0x8a, 0xa8, 0x8a, 0xa9, 0x8a, 0xaa, 0x8a, 0xab,
+	0x8a, 0xac, 0x8a, 0xad, 0x8a, 0xae, 0x8a, 0xaf, 0x8a, 0xb0, 0x8a, 0xb1,
+	0x8a, 0xb2, 0x8a, 0xb3, 0x8a, 0xb4, 0x8a, 0xb5, 0x8a, 0xb6, 0x8a, 0xb7,
+	0x8a, 0xb8, 0x8a, 0xb9, 0x8a, 0xba, 0x8a, 0xbb, 0x8a, 0xbc, 0x8a, 0xbd,
+	0x8a, 0xbe, 0x8a, 0xbf, 0x8a, 0xc0, 0x8a, 0xc1, 0x8a, 0xc2, 0x8a, 0xc3,
+	0x8a, 0xc4, 0x8a, 0xc5, 0x8a, 0xc6, 0x8a, 0xc7, 0x8a, 0xc8, 0x8a, 0xc9,
+	0x8a, 0xca, 0x8a, 0xcb, 0x8a, 0xcc, 0x8a, 0xcd, 0x8a, 0xce, 0x8a, 0xcf,
+	0x8a, 0xd0, 0x8a, 0xd1, 0x8a, 0xd2, 0x8a, 0xd3, 0x8a, 0xd4, 0x8a, 0xd5,
+	0x8a, 0xd6, 0x8a, 0xd7, 0x8a, 0xd8, 0x8a, 0xd9, 0x8a, 0xda, 0x8a, 0xdb,
+	0x8a, 0xdc, 0x8a, 0xdd, 0x8a, 0xde, 0x8a, 0xdf, 0x8a, 0xe0, 0x8a, 0xe1,
+	0x8a, 0xe2, 0x8a, 0xe3, 0x94, 0xe1, 0x95, 0xf8, 0x77, 0x28, 0x68, 0x05,
+	0x69, 0xa8, 0x54, 0x8b, 0x4e, 0x4d, 0x70, 0xb8, 0x8b, 0xc8, 0x64, 0x58,
+	0x65, 0x8b, 0x5b, 0x85, 0x7a, 0x84, 0x50, 0x3a, 0x5b, 0xe8, 0x77, 0xbb,
+	0x6b, 0xe1, 0x8a, 0x79, 0x7c, 0x98, 0x6c, 0xbe, 0x76, 0xcf, 0x65, 0xa9,
+	0x8f, 0x97, 0x5d, 0x2d, 0x5c, 0x55, 0x86, 0x38, 0x68, 0x08, 0x53, 0x60,
+	0x62, 0x18, 0x7a, 0xd9, 0x6e, 0x5b, 0x7e, 0xfd, 0x6a, 0x1f, 0x7a, 0xe0,
+	0x5f, 0x70, 0x6f, 0x33, 0x5f, 0x20, 0x63, 0x8c, 0x6d, 0xa8, 0x67, 0x56,
+	0x4e, 0x08, 0x5e, 0x10, 0x8d, 0x26, 0x4e, 0xd7, 0x80, 0xc0, 0x76, 0x34,
+	0x96, 0x9c, 0x62, 0xdb, 0x66, 0x2d, 0x62, 0x7e, 0x6c, 0xbc, 0x8d, 0x75,
+	0x71, 0x67, 0x7f, 0x69, 0x51, 0x46, 0x80, 0x87, 0x53, 0xec, 0x90, 0x6e,
+	0x62, 0x98, 0x54, 0xf2, 0x86, 0xf0, 0x8f, 0x99, 0x80, 0x05, 0x95, 0x17,
+	0x85, 0x17, 0x8f, 0xd9, 0x6d, 0x59, 0x73, 0xcd, 0x65, 0x9f, 0x77, 0x1f,
+	0x75, 0x04, 0x78, 0x27, 0x81, 0xfb, 0x8d, 0x1e, 0x94, 0x88, 0x4f, 0xa6,
+	0x67, 0x95, 0x75, 0xb9, 0x8b, 0xca, 0x97, 0x07, 0x63, 0x2f, 0x95, 0x47,
+	0x96, 0x35, 0x84, 0xb8, 0x63, 0x23, 0x77, 0x41, 0x5f, 0x81, 0x72, 0xf0,
+	0x4e, 0x89, 0x60, 0x14, 0x65, 0x74, 0x62, 0xef, 0x6b, 0x63, 0x65, 0x3f,
+	0x8a, 0xe4, 0x8a, 0xe5, 0x8a, 0xe6, 0x8a, 0xe7, 0x8a, 0xe8, 0x8a, 0xe9,
+	0x8a, 0xea, 0x8a, 0xeb, 0x8a, 0xec, 0x8a, 0xed, 0x8a, 0xee, 0x8a, 0xef,
+	0x8a, 0xf0, 0x8a, 0xf1, 0x8a, 0xf2, 0x8a, 0xf3, 0x8a, 0xf4, 0x8a, 0xf5,
+	0x8a, 0xf6, 0x8a, 0xf7, 0x8a, 0xf8, 0x8a, 0xf9, 0x8a, 0xfa, 0x8a, 0xfb,
+	0x8a, 0xfc, 0x8a, 0xfd, 0x8a, 0xfe, 0x8a, 0xff, 0x8b, 0x00, 0x8b, 0x01,
+	0x8b, 0x02, 0x8b, 0x03, 0x8b, 0x04, 0x8b, 0x05, 0x8b, 0x06, 0x8b, 0x08,
+	0x8b, 0x09, 0x8b, 0x0a, 0x8b, 0x0b, 0x8b, 0x0c, 0x8b, 0x0d, 0x8b, 0x0e,
+	0x8b, 0x0f, 0x8b, 0x10, 0x8b, 0x11, 0x8b, 0x12, 0x8b, 0x13, 0x8b, 0x14,
+	0x8b, 0x15, 0x8b, 0x16, 0x8b, 0x17, 0x8b, 0x18, 0x8b, 0x19, 0x8b, 0x1a,
+	0x8b, 0x1b, 0x8b, 0x1c, 0x8b, 0x1d, 0x8b, 0x1e, 0x8b, 0x1f, 0x8b, 0x20,
+	0x8b, 0x21, 0x8b, 0x22, 0x8b, 0x23, 0x8b, 0x24, 0x8b, 0x25, 0x8b, 0x27,
+	0x8b, 0x28, 0x8b, 0x29, 0x8b, 0x2a, 0x8b, 0x2b, 0x8b, 0x2c, 0x8b, 0x2d,
+	0x8b, 0x2e, 0x8b, 0x2f, 0x8b, 0x30, 0x8b, 0x31, 0x8b, 0x32, 0x8b, 0x33,
+	0x8b, 0x34, 0x8b, 0x35, 0x8b, 0x36, 0x8b, 0x37, 0x8b, 0x38, 0x8b, 0x39,
+	0x8b, 0x3a, 0x8b, 0x3b, 0x8b, 0x3c, 0x8b, 0x3d, 0x8b, 0x3e, 0x8b, 0x3f,
+	0x8b, 0x40, 0x8b, 0x41, 0x8b, 0x42, 0x8b, 0x43, 0x8b, 0x44, 0x8b, 0x45,
+	0x5e, 0x27, 0x75, 0xc7, 0x90, 0xd1, 0x8b, 0xc1, 0x82, 0x9d, 0x67, 0x9d,
+	0x65, 0x2f, 0x54, 0x31, 0x87, 0x18, 0x77, 0xe5, 0x80, 0xa2, 0x81, 0x02,
+	0x6c, 0x41, 0x4e, 0x4b, 0x7e, 0xc7, 0x80, 0x4c, 0x76, 0xf4, 0x69, 0x0d,
+	0x6b, 0x96, 0x62, 0x67, 0x50, 0x3c, 0x4f, 0x84, 0x57, 0x40, 0x63, 0x07,
+	0x6b, 0x62, 0x8d, 0xbe, 0x53, 0xea, 0x65, 0xe8, 0x7e, 0xb8, 0x5f, 0xd7,
+	0x63, 0x1a, 0x63, 0xb7, 0x81, 0xf3, 0x81, 0xf4, 0x7f, 0x6e, 0x5e, 0x1c,
+	0x5c, 0xd9, 0x52, 0x36, 0x66, 0x7a, 0x79, 0xe9, 0x7a, 0x1a, 0x8d, 0x28,
+	0x70, 0x99, 0x75, 0xd4, 0x6e, 0xde, 0x6c, 0xbb, 0x7a, 0x92, 0x4e, 0x2d,
+	0x76, 0xc5, 0x5f, 0xe0, 0x94, 0x9f, 0x88, 0x77, 0x7e, 0xc8, 0x79, 0xcd,
+	0x80, 0xbf, 0x91, 0xcd, 0x4e, 0xf2, 0x4f, 0x17, 0x82, 0x1f, 0x54, 0x68,
+	0x5d, 0xde, 0x6d, 0x32, 0x8b, 0xcc, 0x7c, 0xa5, 0x8f, 0x74, 0x80, 0x98,
+	0x5e, 0x1a, 0x54, 0x92, 0x76, 0xb1, 0x5b, 0x99, 0x66, 0x3c, 0x9a, 0xa4,
+	0x73, 0xe0, 0x68, 0x2a, 0x86, 0xdb, 0x67, 0x31, 0x73, 0x2a, 0x8b, 0xf8,
+	0x8b, 0xdb, 0x90, 0x10, 0x7a, 0xf9, 0x70, 0xdb, 0x71, 0x6e, 0x62, 0xc4,
+	0x77, 0xa9, 0x56, 0x31, 0x4e, 0x3b, 0x84, 0x57, 0x67, 0xf1, 0x52, 0xa9,
+	0x86, 0xc0, 0x8d, 0x2e, 0x94, 0xf8, 0x7b, 0x51, 0x8b, 0x46, 0x8b, 0x47,
+	0x8b, 0x48, 0x8b, 0x49, 0x8b, 0x4a, 0x8b, 0x4b, 0x8b, 0x4c, 0x8b, 0x4d,
+	0x8b, 0x4e, 0x8b, 0x4f, 0x8b, 0x50, 0x8b, 0x51, 0x8b, 0x52, 0x8b, 0x53,
+	0x8b, 0x54, 0x8b, 0x55, 0x8b, 0x56, 0x8b, 0x57, 0x8b, 0x58, 0x8b, 0x59,
+	0x8b, 0x5a, 0x8b, 0x5b, 0x8b, 0x5c, 0x8b, 0x5d, 0x8b, 0x5e, 0x8b, 0x5f,
+	0x8b, 0x60, 0x8b, 0x61, 0x8b, 0x62, 0x8b, 0x63, 0x8b, 0x64, 0x8b, 0x65,
+	0x8b, 0x67, 0x8b, 0x68, 0x8b, 0x69, 0x8b, 0x6a, 0x8b, 0x6b, 0x8b, 0x6d,
+	0x8b, 0x6e, 0x8b, 0x6f, 0x8b, 0x70, 0x8b, 0x71, 0x8b, 0x72, 0x8b, 0x73,
+	0x8b, 0x74, 0x8b, 0x75, 0x8b, 0x76, 0x8b, 0x77, 0x8b, 0x78, 0x8b, 0x79,
+	0x8b, 0x7a, 0x8b, 0x7b, 0x8b, 0x7c, 0x8b, 0x7d, 0x8b, 0x7e, 0x8b, 0x7f,
+	0x8b, 0x80, 0x8b, 0x81, 0x8b, 0x82, 0x8b, 0x83, 0x8b, 0x84, 0x8b, 0x85,
+	0x8b, 0x86, 0x8b, 0x87, 0x8b, 0x88, 0x8b, 0x89, 0x8b, 0x8a, 0x8b, 0x8b,
+	0x8b, 0x8c, 0x8b, 0x8d, 0x8b, 0x8e, 0x8b, 0x8f, 0x8b, 0x90, 0x8b, 0x91,
+	0x8b, 0x92, 0x8b, 0x93, 0x8b, 0x94, 0x8b, 0x95, 0x8b, 0x96, 0x8b, 0x97,
+	0x8b, 0x98, 0x8b, 0x99, 0x8b, 0x9a, 0x8b, 0x9b, 0x8b, 0x9c, 0x8b, 0x9d,
+	0x8b, 0x9e, 0x8b, 0x9f, 0x8b, 0xac, 0x8b, 0xb1, 0x8b, 0xbb, 0x8b, 0xc7,
+	0x8b, 0xd0, 0x8b, 0xea, 0x8c, 0x09, 0x8c, 0x1e, 0x4f, 0x4f, 0x6c, 0xe8,
+	0x79, 0x5d, 0x9a, 0x7b, 0x62, 0x93, 0x72, 0x2a, 0x62, 0xfd, 0x4e, 0x13,
+	0x78, 0x16, 0x8f, 0x6c, 0x64, 0xb0, 0x8d, 0x5a, 0x7b, 0xc6, 0x68, 0x69,
+	0x5e, 0x84, 0x88, 0xc5, 0x59, 0x86, 0x64, 0x9e, 0x58, 0xee, 0x72, 0xb6,
+	0x69, 0x0e, 0x95, 0x25, 0x8f, 0xfd, 0x8d, 0x58, 0x57, 0x60, 0x7f, 0x00,
+	0x8c, 0x06, 0x51, 0xc6, 0x63, 0x49, 0x62, 0xd9, 0x53, 0x53, 0x68, 0x4c,
+	0x74, 0x22, 0x83, 0x01, 0x91, 0x4c, 0x55, 0x44, 0x77, 0x40, 0x70, 0x7c,
+	0x6d, 0x4a, 0x51, 0x79, 0x54, 0xa8, 0x8d, 0x44, 0x59, 0xff, 0x6e, 0xcb,
+	0x6d, 0xc4, 0x5b, 0x5c, 0x7d, 0x2b, 0x4e, 0xd4, 0x7c, 0x7d, 0x6e, 0xd3,
+	0x5b, 0x50, 0x81, 0xea, 0x6e, 0x0d, 0x5b, 0x57, 0x9b, 0x03, 0x68, 0xd5,
+	0x8e, 0x2a, 0x5b, 0x97, 0x7e, 0xfc, 0x60, 0x3b, 0x7e, 0xb5, 0x90, 0xb9,
+	0x8d, 0x70, 0x59, 0x4f, 0x63, 0xcd, 0x79, 0xdf, 0x8d, 0xb3, 0x53, 0x52,
+	0x65, 0xcf, 0x79, 0x56, 0x8b, 0xc5, 0x96, 0x3b, 0x7e, 0xc4, 0x94, 0xbb,
+	0x7e, 0x82, 0x56, 0x34, 0x91, 0x89, 0x67, 0x00, 0x7f, 0x6a, 0x5c, 0x0a,
+	0x90, 0x75, 0x66, 0x28, 0x5d, 0xe6, 0x4f, 0x50, 0x67, 0xde, 0x50, 0x5a,
+	0x4f, 0x5c, 0x57, 0x50, 0x5e, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x8c, 0x38, 0x8c, 0x39, 0x8c, 0x3a, 0x8c, 0x3b,
+	0x8c, 0x3c, 0x8c, 0x3d, 0x8c, 0x3e, 0x8c, 0x3f, 0x8c, 0x40, 0x8c, 0x42,
+	0x8c, 0x43, 0x8c, 0x44, 0x8c, 0x45, 0x8c, 0x48, 0x8c, 0x4a, 0x8c, 0x4b,
+	0x8c, 0x4d, 0x8c, 0x4e, 0x8c, 0x4f, 0x8c, 0x50, 0x8c, 0x51, 0x8c, 0x52,
+	0x8c, 0x53, 0x8c, 0x54, 0x8c, 0x56, 0x8c, 0x57, 0x8c, 0x58, 0x8c, 0x59,
+	0x8c, 0x5b, 0x8c, 0x5c, 0x8c, 0x5d, 0x8c, 0x5e, 0x8c, 0x5f, 0x8c, 0x60,
+	0x8c, 0x63, 0x8c, 0x64, 0x8c, 0x65, 0x8c, 0x66, 0x8c, 0x67, 0x8c, 0x68,
+	0x8c, 0x69, 0x8c, 0x6c, 0x8c, 0x6d, 0x8c, 0x6e, 0x8c, 0x6f, 0x8c, 0x70,
+	0x8c, 0x71, 0x8c, 0x72, 0x8c, 0x74, 0x8c, 0x75, 0x8c, 0x76, 0x8c, 0x77,
+	0x8c, 0x7b, 0x8c, 0x7c, 0x8c, 0x7d, 0x8c, 0x7e, 0x8c, 0x7f, 0x8c, 0x80,
+	0x8c, 0x81, 0x8c, 0x83, 0x8c, 0x84, 0x8c, 0x86, 0x8c, 0x87, 0x8c, 0x88,
+	0x8c, 0x8b, 0x8c, 0x8d, 0x8c, 0x8e, 0x8c, 0x8f, 0x8c, 0x90, 0x8c, 0x91,
+	0x8c, 0x92, 0x8c, 0x93, 0x8c, 0x95, 0x8c, 0x96, 0x8c, 0x97, 0x8c, 0x99,
+	0x8c, 0x9a, 0x8c, 0x9b, 0x8c, 0x9c, 0x8c, 0x9d, 0x8c, 0x9e, 0x8c, 0x9f,
+	0x8c, 0xa0, 0x8c, 0xa1, 0x8c, 0xa2, 0x8c, 0xa3, 0x8c, 0xa4, 0x8c, 0xa5,
+	0x8c, 0xa6, 0x8c, 0xa7, 0x8c, 0xa8, 0x8c, 0xa9, 0x8c, 0xaa, 0x8c, 0xab,
+	0x8c, 0xac, 0x8c, 0xad, 0x4e, 0x8d, 0x4e, 0x0c, 0x51, 0x40, 0x4e, 0x10,
+	0x5e, 0xff, 0x53, 0x45, 0x4e, 0x15, 0x4e, 0x98, 0x4e, 0x1e, 0x9b, 0x32,
+	0x5b, 0x6c, 0x56, 0x69, 0x4e, 0x28, 0x79, 0xba, 0x4e, 0x3f, 0x53, 0x15,
+	0x4e, 0x47, 0x59, 0x2d, 0x72, 0x3b, 0x53, 0x6e, 0x6c, 0x10, 0x56, 0xdf,
+	0x80, 0xe4, 0x99, 0x97, 0x6b, 0xd3, 0x77, 0x7e, 0x9f, 0x17, 0x4e, 0x36,
+	0x4e, 0x9f, 0x9f, 0x10, 0x4e, 0x5c, 0x4e, 0x69, 0x4e, 0x93, 0x82, 0x88,
+	0x5b, 0x5b, 0x55, 0x6c, 0x56, 0x0f, 0x4e, 0xc4, 0x53, 0x8d, 0x53, 0x9d,
+	0x53, 0xa3, 0x53, 0xa5, 0x53, 0xae, 0x97, 0x65, 0x8d, 0x5d, 0x53, 0x1a,
+	0x53, 0xf5, 0x53, 0x26, 0x53, 0x2e, 0x53, 0x3e, 0x8d, 0x5c, 0x53, 0x66,
+	0x53, 0x63, 0x52, 0x02, 0x52, 0x08, 0x52, 0x0e, 0x52, 0x2d, 0x52, 0x33,
+	0x52, 0x3f, 0x52, 0x40, 0x52, 0x4c, 0x52, 0x5e, 0x52, 0x61, 0x52, 0x5c,
+	0x84, 0xaf, 0x52, 0x7d, 0x52, 0x82, 0x52, 0x81, 0x52, 0x90, 0x52, 0x93,
+	0x51, 0x82, 0x7f, 0x54, 0x4e, 0xbb, 0x4e, 0xc3, 0x4e, 0xc9, 0x4e, 0xc2,
+	0x4e, 0xe8, 0x4e, 0xe1, 0x4e, 0xeb, 0x4e, 0xde, 0x4f, 0x1b, 0x4e, 0xf3,
+	0x4f, 0x22, 0x4f, 0x64, 0x4e, 0xf5, 0x4f, 0x25, 0x4f, 0x27, 0x4f, 0x09,
+	0x4f, 0x2b, 0x4f, 0x5e, 0x4f, 0x67, 0x65, 0x38, 0x4f, 0x5a, 0x4f, 0x5d,
+	0x8c, 0xae, 0x8c, 0xaf, 0x8c, 0xb0, 0x8c, 0xb1, 0x8c, 0xb2, 0x8c, 0xb3,
+	0x8c, 0xb4, 0x8c, 0xb5, 0x8c, 0xb6, 0x8c, 0xb7, 0x8c, 0xb8, 0x8c, 0xb9,
+	0x8c, 0xba, 0x8c, 0xbb, 0x8c, 0xbc, 0x8c, 0xbd, 0x8c, 0xbe, 0x8c, 0xbf,
+	0x8c, 0xc0, 0x8c, 0xc1, 0x8c, 0xc2, 0x8c, 0xc3, 0x8c, 0xc4, 0x8c, 0xc5,
+	0x8c, 0xc6, 0x8c, 0xc7, 0x8c, 0xc8, 0x8c, 0xc9, 0x8c, 0xca, 0x8c, 0xcb,
+	0x8c, 0xcc, 0x8c, 0xcd, 0x8c, 0xce, 0x8c, 0xcf, 0x8c, 0xd0, 0x8c, 0xd1,
+	0x8c, 0xd2, 0x8c, 0xd3, 0x8c, 0xd4, 0x8c, 0xd5, 0x8c, 0xd6, 0x8c, 0xd7,
+	0x8c, 0xd8, 0x8c, 0xd9, 0x8c, 0xda, 0x8c, 0xdb, 0x8c, 0xdc, 0x8c, 0xdd,
+	0x8c, 0xde, 0x8c, 0xdf, 0x8c, 0xe0, 0x8c, 0xe1, 0x8c, 0xe2, 0x8c, 0xe3,
+	0x8c, 0xe4, 0x8c, 0xe5, 0x8c, 0xe6, 0x8c, 0xe7, 0x8c, 0xe8, 0x8c, 0xe9,
+	0x8c, 0xea, 0x8c, 0xeb, 0x8c, 0xec, 0x8c, 0xed, 0x8c, 0xee, 0x8c, 0xef,
+	0x8c, 0xf0, 0x8c, 0xf1, 0x8c, 0xf2, 0x8c, 0xf3, 0x8c, 0xf4, 0x8c, 0xf5,
+	0x8c, 0xf6, 0x8c, 0xf7, 0x8c, 0xf8, 0x8c, 0xf9, 0x8c, 0xfa, 0x8c, 0xfb,
+	0x8c, 0xfc, 0x8c, 0xfd, 0x8c, 0xfe, 0x8c, 0xff, 0x8d, 0x00, 0x8d, 0x01,
+	0x8d, 0x02, 0x8d, 0x03, 0x8d, 0x04, 0x8d, 0x05, 0x8d, 0x06, 0x8d, 0x07,
+	0x8d, 0x08, 0x8d, 0x09, 0x8d, 0x0a, 0x8d, 0x0b, 0x8d, 0x0c, 0x8d, 0x0d,
+	0x4f, 0x5f, 0x4f, 0x57, 0x4f, 0x32, 0x4f, 0x3d, 0x4f, 0x76, 0x4f, 0x74,
+	0x4f, 0x91, 0x4f, 0x89, 0x4f, 0x83, 0x4f, 0x8f, 0x4f, 0x7e, 0x4f, 0x7b,
+	0x4f, 0xaa, 0x4f, 0x7c, 0x4f, 0xac, 0x4f, 0x94, 0x4f, 0xe6, 0x4f, 0xe8,
+	0x4f, 0xea, 0x4f, 0xc5, 0x4f, 0xda, 0x4f, 0xe3, 0x4f, 0xdc, 0x4f, 0xd1,
+	0x4f, 0xdf, 0x4f, 0xf8, 0x50, 0x29, 0x50, 0x4c, 0x4f, 0xf3, 0x50, 0x2c,
+	0x50, 0x0f, 0x50, 0x2e, 0x50, 0x2d, 0x4f, 0xfe, 0x50, 0x1c, 0x50, 0x0c,
+	0x50, 0x25, 0x50, 0x28, 0x50, 0x7e, 0x50, 0x43, 0x50, 0x55, 0x50, 0x48,
+	0x50, 0x4e, 0x50, 0x6c, 0x50, 0x7b, 0x50, 0xa5, 0x50, 0xa7, 0x50, 0xa9,
+	0x50, 0xba, 0x50, 0xd6, 0x51, 0x06, 0x50, 0xed, 0x50, 0xec, 0x50, 0xe6,
+	0x50, 0xee, 0x51, 0x07, 0x51, 0x0b, 0x4e, 0xdd, 0x6c, 0x3d, 0x4f, 0x58,
+	0x4f, 0x65, 0x4f, 0xce, 0x9f, 0xa0, 0x6c, 0x46, 0x7c, 0x74, 0x51, 0x6e,
+	0x5d, 0xfd, 0x9e, 0xc9, 0x99, 0x98, 0x51, 0x81, 0x59, 0x14, 0x52, 0xf9,
+	0x53, 0x0d, 0x8a, 0x07, 0x53, 0x10, 0x51, 0xeb, 0x59, 0x19, 0x51, 0x55,
+	0x4e, 0xa0, 0x51, 0x56, 0x4e, 0xb3, 0x88, 0x6e, 0x88, 0xa4, 0x4e, 0xb5,
+	0x81, 0x14, 0x88, 0xd2, 0x79, 0x80, 0x5b, 0x34, 0x88, 0x03, 0x7f, 0xb8,
+	0x51, 0xab, 0x51, 0xb1, 0x51, 0xbd, 0x51, 0xbc, 0x8d, 0x0e, 0x8d, 0x0f,
+	0x8d, 0x10, 0x8d, 0x11, 0x8d, 0x12, 0x8d, 0x13, 0x8d, 0x14, 0x8d, 0x15,
+	0x8d, 0x16, 0x8d, 0x17, 0x8d, 0x18, 0x8d, 0x19, 0x8d, 0x1a, 0x8d, 0x1b,
+	0x8d, 0x1c, 0x8d, 0x20, 0x8d, 0x51, 0x8d, 0x52, 0x8d, 0x57, 0x8d, 0x5f,
+	0x8d, 0x65, 0x8d, 0x68, 0x8d, 0x69, 0x8d, 0x6a, 0x8d, 0x6c, 0x8d, 0x6e,
+	0x8d, 0x6f, 0x8d, 0x71, 0x8d, 0x72, 0x8d, 0x78, 0x8d, 0x79, 0x8d, 0x7a,
+	0x8d, 0x7b, 0x8d, 0x7c, 0x8d, 0x7d, 0x8d, 0x7e, 0x8d, 0x7f, 0x8d, 0x80,
+	0x8d, 0x82, 0x8d, 0x83, 0x8d, 0x86, 0x8d, 0x87, 0x8d, 0x88, 0x8d, 0x89,
+	0x8d, 0x8c, 0x8d, 0x8d, 0x8d, 0x8e, 0x8d, 0x8f, 0x8d, 0x90, 0x8d, 0x92,
+	0x8d, 0x93, 0x8d, 0x95, 0x8d, 0x96, 0x8d, 0x97, 0x8d, 0x98, 0x8d, 0x99,
+	0x8d, 0x9a, 0x8d, 0x9b, 0x8d, 0x9c, 0x8d, 0x9d, 0x8d, 0x9e, 0x8d, 0xa0,
+	0x8d, 0xa1, 0x8d, 0xa2, 0x8d, 0xa4, 0x8d, 0xa5, 0x8d, 0xa6, 0x8d, 0xa7,
+	0x8d, 0xa8, 0x8d, 0xa9, 0x8d, 0xaa, 0x8d, 0xab, 0x8d, 0xac, 0x8d, 0xad,
+	0x8d, 0xae, 0x8d, 0xaf, 0x8d, 0xb0, 0x8d, 0xb2, 0x8d, 0xb6, 0x8d, 0xb7,
+	0x8d, 0xb9, 0x8d, 0xbb, 0x8d, 0xbd, 0x8d, 0xc0, 0x8d, 0xc1, 0x8d, 0xc2,
+	0x8d, 0xc5, 0x8d, 0xc7, 0x8d, 0xc8, 0x8d, 0xc9, 0x8d, 0xca, 0x8d, 0xcd,
+	0x8d, 0xd0, 0x8d, 0xd2, 0x8d, 0xd3, 0x8d, 0xd4, 0x51, 0xc7, 0x51, 0x96,
+	0x51, 0xa2, 0x51, 0xa5, 0x8b, 0xa0, 0x8b, 0xa6, 0x8b, 0xa7, 0x8b, 0xaa,
+	0x8b, 0xb4, 0x8b, 0xb5, 0x8b, 0xb7, 0x8b, 0xc2, 0x8b, 0xc3, 0x8b, 0xcb,
+	0x8b, 0xcf, 0x8b, 0xce, 0x8b, 0xd2, 0x8b, 0xd3, 0x8b, 0xd4, 0x8b, 0xd6,
+	0x8b, 0xd8, 0x8b, 0xd9, 0x8b, 0xdc, 0x8b, 0xdf, 0x8b, 0xe0, 0x8b, 0xe4,
+	0x8b, 0xe8, 0x8b, 0xe9, 0x8b, 0xee, 0x8b, 0xf0, 0x8b, 0xf3, 0x8b, 0xf6,
+	0x8b, 0xf9, 0x8b, 0xfc, 0x8b, 0xff, 0x8c, 0x00, 0x8c, 0x02, 0x8c, 0x04,
+	0x8c, 0x07, 0x8c, 0x0c, 0x8c, 0x0f, 0x8c, 0x11, 0x8c, 0x12, 0x8c, 0x14,
+	0x8c, 0x15, 0x8c, 0x16, 0x8c, 0x19, 0x8c, 0x1b, 0x8c, 0x18, 0x8c, 0x1d,
+	0x8c, 0x1f, 0x8c, 0x20, 0x8c, 0x21, 0x8c, 0x25, 0x8c, 0x27, 0x8c, 0x2a,
+	0x8c, 0x2b, 0x8c, 0x2e, 0x8c, 0x2f, 0x8c, 0x32, 0x8c, 0x33, 0x8c, 0x35,
+	0x8c, 0x36, 0x53, 0x69, 0x53, 0x7a, 0x96, 0x1d, 0x96, 0x22, 0x96, 0x21,
+	0x96, 0x31, 0x96, 0x2a, 0x96, 0x3d, 0x96, 0x3c, 0x96, 0x42, 0x96, 0x49,
+	0x96, 0x54, 0x96, 0x5f, 0x96, 0x67, 0x96, 0x6c, 0x96, 0x72, 0x96, 0x74,
+	0x96, 0x88, 0x96, 0x8d, 0x96, 0x97, 0x96, 0xb0, 0x90, 0x97, 0x90, 0x9b,
+	0x90, 0x9d, 0x90, 0x99, 0x90, 0xac, 0x90, 0xa1, 0x90, 0xb4, 0x90, 0xb3,
+	0x90, 0xb6, 0x90, 0xba, 0x8d, 0xd5, 0x8d, 0xd8, 0x8d, 0xd9, 0x8d, 0xdc,
+	0x8d, 0xe0, 0x8d, 0xe1, 0x8d, 0xe2, 0x8d, 0xe5, 0x8d, 0xe6, 0x8d, 0xe7,
+	0x8d, 0xe9, 0x8d, 0xed, 0x8d, 0xee, 0x8d, 0xf0, 0x8d, 0xf1, 0x8d, 0xf2,
+	0x8d, 0xf4, 0x8d, 0xf6, 0x8d, 0xfc, 0x8d, 0xfe, 0x8d, 0xff, 0x8e, 0x00,
+	0x8e, 0x01, 0x8e, 0x02, 0x8e, 0x03, 0x8e, 0x04, 0x8e, 0x06, 0x8e, 0x07,
+	0x8e, 0x08, 0x8e, 0x0b, 0x8e, 0x0d, 0x8e, 0x0e, 0x8e, 0x10, 0x8e, 0x11,
+	0x8e, 0x12, 0x8e, 0x13, 0x8e, 0x15, 0x8e, 0x16, 0x8e, 0x17, 0x8e, 0x18,
+	0x8e, 0x19, 0x8e, 0x1a, 0x8e, 0x1b, 0x8e, 0x1c, 0x8e, 0x20, 0x8e, 0x21,
+	0x8e, 0x24, 0x8e, 0x25, 0x8e, 0x26, 0x8e, 0x27, 0x8e, 0x28, 0x8e, 0x2b,
+	0x8e, 0x2d, 0x8e, 0x30, 0x8e, 0x32, 0x8e, 0x33, 0x8e, 0x34, 0x8e, 0x36,
+	0x8e, 0x37, 0x8e, 0x38, 0x8e, 0x3b, 0x8e, 0x3c, 0x8e, 0x3e, 0x8e, 0x3f,
+	0x8e, 0x43, 0x8e, 0x45, 0x8e, 0x46, 0x8e, 0x4c, 0x8e, 0x4d, 0x8e, 0x4e,
+	0x8e, 0x4f, 0x8e, 0x50, 0x8e, 0x53, 0x8e, 0x54, 0x8e, 0x55, 0x8e, 0x56,
+	0x8e, 0x57, 0x8e, 0x58, 0x8e, 0x5a, 0x8e, 0x5b, 0x8e, 0x5c, 0x8e, 0x5d,
+	0x8e, 0x5e, 0x8e, 0x5f, 0x8e, 0x60, 0x8e, 0x61, 0x8e, 0x62, 0x8e, 0x63,
+	0x8e, 0x64, 0x8e, 0x65, 0x8e, 0x67, 0x8e, 0x68, 0x8e, 0x6a, 0x8e, 0x6b,
+	0x8e, 0x6e, 0x8e, 0x71, 0x90, 0xb8, 0x90, 0xb0, 0x90, 0xcf, 0x90, 0xc5,
+	0x90, 0xbe, 0x90, 0xd0, 0x90, 0xc4, 0x90, 0xc7, 0x90, 0xd3, 0x90, 0xe6,
+	0x90, 0xe2, 0x90, 0xdc, 0x90, 0xd7, 0x90, 0xdb, 0x90, 0xeb, 0x90, 0xef,
+	0x90, 0xfe, 0x91, 0x04, 0x91, 0x22, 0x91, 0x1e, 0x91, 0x23, 0x91, 0x31,
+	0x91, 0x2f, 0x91, 0x39, 0x91, 0x43, 0x91, 0x46, 0x52, 0x0d, 0x59, 0x42,
+	0x52, 0xa2, 0x52, 0xac, 0x52, 0xad, 0x52, 0xbe, 0x54, 0xff, 0x52, 0xd0,
+	0x52, 0xd6, 0x52, 0xf0, 0x53, 0xdf, 0x71, 0xee, 0x77, 0xcd, 0x5e, 0xf4,
+	0x51, 0xf5, 0x51, 0xfc, 0x9b, 0x2f, 0x53, 0xb6, 0x5f, 0x01, 0x75, 0x5a,
+	0x5d, 0xef, 0x57, 0x4c, 0x57, 0xa9, 0x57, 0xa1, 0x58, 0x7e, 0x58, 0xbc,
+	0x58, 0xc5, 0x58, 0xd1, 0x57, 0x29, 0x57, 0x2c, 0x57, 0x2a, 0x57, 0x33,
+	0x57, 0x39, 0x57, 0x2e, 0x57, 0x2f, 0x57, 0x5c, 0x57, 0x3b, 0x57, 0x42,
+	0x57, 0x69, 0x57, 0x85, 0x57, 0x6b, 0x57, 0x86, 0x57, 0x7c, 0x57, 0x7b,
+	0x57, 0x68, 0x57, 0x6d, 0x57, 0x76, 0x57, 0x73, 0x57, 0xad, 0x57, 0xa4,
+	0x57, 0x8c, 0x57, 0xb2, 0x57, 0xcf, 0x57, 0xa7, 0x57, 0xb4, 0x57, 0x93,
+	0x57, 0xa0, 0x57, 0xd5, 0x57, 0xd8, 0x57, 0xda, 0x57, 0xd9, 0x57, 0xd2,
+	0x57, 0xb8, 0x57, 0xf4, 0x57, 0xef, 0x57, 0xf8, 0x57, 0xe4, 0x57, 0xdd,
+	0x8e, 0x73, 0x8e, 0x75, 0x8e, 0x77, 0x8e, 0x78, 0x8e, 0x79, 0x8e, 0x7a,
+	0x8e, 0x7b, 0x8e, 0x7d, 0x8e, 0x7e, 0x8e, 0x80, 0x8e, 0x82, 0x8e, 0x83,
+	0x8e, 0x84, 0x8e, 0x86, 0x8e, 0x88, 0x8e, 0x89, 0x8e, 0x8a, 0x8e, 0x8b,
+	0x8e, 0x8c, 0x8e, 0x8d, 0x8e, 0x8e, 0x8e, 0x91, 0x8e, 0x92, 0x8e, 0x93,
+	0x8e, 0x95, 0x8e, 0x96, 0x8e, 0x97, 0x8e, 0x98, 0x8e, 0x99, 0x8e, 0x9a,
+	0x8e, 0x9b, 0x8e, 0x9d, 0x8e, 0x9f, 0x8e, 0xa0, 0x8e, 0xa1, 0x8e, 0xa2,
+	0x8e, 0xa3, 0x8e, 0xa4, 0x8e, 0xa5, 0x8e, 0xa6, 0x8e, 0xa7, 0x8e, 0xa8,
+	0x8e, 0xa9, 0x8e, 0xaa, 0x8e, 0xad, 0x8e, 0xae, 0x8e, 0xb0, 0x8e, 0xb1,
+	0x8e, 0xb3, 0x8e, 0xb4, 0x8e, 0xb5, 0x8e, 0xb6, 0x8e, 0xb7, 0x8e, 0xb8,
+	0x8e, 0xb9, 0x8e, 0xbb, 0x8e, 0xbc, 0x8e, 0xbd, 0x8e, 0xbe, 0x8e, 0xbf,
+	0x8e, 0xc0, 0x8e, 0xc1, 0x8e, 0xc2, 0x8e, 0xc3, 0x8e, 0xc4, 0x8e, 0xc5,
+	0x8e, 0xc6, 0x8e, 0xc7, 0x8e, 0xc8, 0x8e, 0xc9, 0x8e, 0xca, 0x8e, 0xcb,
+	0x8e, 0xcc, 0x8e, 0xcd, 0x8e, 0xcf, 0x8e, 0xd0, 0x8e, 0xd1, 0x8e, 0xd2,
+	0x8e, 0xd3, 0x8e, 0xd4, 0x8e, 0xd5, 0x8e, 0xd6, 0x8e, 0xd7, 0x8e, 0xd8,
+	0x8e, 0xd9, 0x8e, 0xda, 0x8e, 0xdb, 0x8e, 0xdc, 0x8e, 0xdd, 0x8e, 0xde,
+	0x8e, 0xdf, 0x8e, 0xe0, 0x8e, 0xe1, 0x8e, 0xe2, 0x8e, 0xe3, 0x8e, 0xe4,
+	0x58, 0x0b, 0x58, 0x0d, 0x57, 0xfd, 0x57, 0xed, 0x58, 0x00, 0x58, 0x1e,
+	0x58, 0x19, 0x58, 0x44, 0x58, 0x20, 0x58, 0x65, 0x58, 0x6c, 0x58, 0x81,
+	0x58, 0x89, 0x58, 0x9a, 0x58, 0x80, 0x99, 0xa8, 0x9f, 0x19, 0x61, 0xff,
+	0x82, 0x79, 0x82, 0x7d, 0x82, 0x7f, 0x82, 0x8f, 0x82, 0x8a, 0x82, 0xa8,
+	0x82, 0x84, 0x82, 0x8e, 0x82, 0x91, 0x82, 0x97, 0x82, 0x99, 0x82, 0xab,
+	0x82, 0xb8, 0x82, 0xbe, 0x82, 0xb0, 0x82, 0xc8, 0x82, 0xca, 0x82, 0xe3,
+	0x82, 0x98, 0x82, 0xb7, 0x82, 0xae, 0x82, 0xcb, 0x82, 0xcc, 0x82, 0xc1,
+	0x82, 0xa9, 0x82, 0xb4, 0x82, 0xa1, 0x82, 0xaa, 0x82, 0x9f, 0x82, 0xc4,
+	0x82, 0xce, 0x82, 0xa4, 0x82, 0xe1, 0x83, 0x09, 0x82, 0xf7, 0x82, 0xe4,
+	0x83, 0x0f, 0x83, 0x07, 0x82, 0xdc, 0x82, 0xf4, 0x82, 0xd2, 0x82, 0xd8,
+	0x83, 0x0c, 0x82, 0xfb, 0x82, 0xd3, 0x83, 0x11, 0x83, 0x1a, 0x83, 0x06,
+	0x83, 0x14, 0x83, 0x15, 0x82, 0xe0, 0x82, 0xd5, 0x83, 0x1c, 0x83, 0x51,
+	0x83, 0x5b, 0x83, 0x5c, 0x83, 0x08, 0x83, 0x92, 0x83, 0x3c, 0x83, 0x34,
+	0x83, 0x31, 0x83, 0x9b, 0x83, 0x5e, 0x83, 0x2f, 0x83, 0x4f, 0x83, 0x47,
+	0x83, 0x43, 0x83, 0x5f, 0x83, 0x40, 0x83, 0x17, 0x83, 0x60, 0x83, 0x2d,
+	0x83, 0x3a, 0x83, 0x33, 0x83, 0x66, 0x83, 0x65, 0x8e, 0xe5, 0x8e, 0xe6,
+	0x8e, 0xe7, 0x8e, 0xe8, 0x8e, 0xe9, 0x8e, 0xea, 0x8e, 0xeb, 0x8e, 0xec,
+	0x8e, 0xed, 0x8e, 0xee, 0x8e, 0xef, 0x8e, 0xf0, 0x8e, 0xf1, 0x8e, 0xf2,
+	0x8e, 0xf3, 0x8e, 0xf4, 0x8e, 0xf5, 0x8e, 0xf6, 0x8e, 0xf7, 0x8e, 0xf8,
+	0x8e, 0xf9, 0x8e, 0xfa, 0x8e, 0xfb, 0x8e, 0xfc, 0x8e, 0xfd, 0x8e, 0xfe,
+	0x8e, 0xff, 0x8f, 0x00, 0x8f, 0x01, 0x8f, 0x02, 0x8f, 0x03, 0x8f, 0x04,
+	0x8f, 0x05, 0x8f, 0x06, 0x8f, 0x07, 0x8f, 0x08, 0x8f, 0x09, 0x8f, 0x0a,
+	0x8f, 0x0b, 0x8f, 0x0c, 0x8f, 0x0d, 0x8f, 0x0e, 0x8f, 0x0f, 0x8f, 0x10,
+	0x8f, 0x11, 0x8f, 0x12, 0x8f, 0x13, 0x8f, 0x14, 0x8f, 0x15, 0x8f, 0x16,
+	0x8f, 0x17, 0x8f, 0x18, 0x8f, 0x19, 0x8f, 0x1a, 0x8f, 0x1b, 0x8f, 0x1c,
+	0x8f, 0x1d, 0x8f, 0x1e, 0x8f, 0x1f, 0x8f, 0x20, 0x8f, 0x21, 0x8f, 0x22,
+	0x8f, 0x23, 0x8f, 0x24, 0x8f, 0x25, 0x8f, 0x26, 0x8f, 0x27, 0x8f, 0x28,
+	0x8f, 0x29, 0x8f, 0x2a, 0x8f, 0x2b, 0x8f, 0x2c, 0x8f, 0x2d, 0x8f, 0x2e,
+	0x8f, 0x2f, 0x8f, 0x30, 0x8f, 0x31, 0x8f, 0x32, 0x8f, 0x33, 0x8f, 0x34,
+	0x8f, 0x35, 0x8f, 0x36, 0x8f, 0x37, 0x8f, 0x38, 0x8f, 0x39, 0x8f, 0x3a,
+	0x8f, 0x3b, 0x8f, 0x3c, 0x8f, 0x3d, 0x8f, 0x3e, 0x8f, 0x3f, 0x8f, 0x40,
+	0x8f, 0x41, 0x8f, 0x42, 0x8f, 0x43, 0x8f, 0x44, 0x83, 0x68, 0x83, 0x1b,
+	0x83, 0x69, 0x83, 0x6c, 0x83, 0x6a, 0x83, 0x6d, 0x83, 0x6e, 0x83, 0xb0,
+	0x83, 0x78, 0x83, 0xb3, 0x83, 0xb4, 0x83, 0xa0, 0x83, 0xaa, 0x83, 0x93,
+	0x83, 0x9c, 0x83, 0x85, 0x83, 0x7c, 0x83, 0xb6, 0x83, 0xa9, 0x83, 0x7d,
+	0x83, 0xb8, 0x83, 0x7b, 0x83, 0x98, 0x83, 0x9e, 0x83, 0xa8, 0x83, 0xba,
+	0x83, 0xbc, 0x83, 0xc1, 0x84, 0x01, 0x83, 0xe5, 0x83, 0xd8, 0x58, 0x07,
+	0x84, 0x18, 0x84, 0x0b, 0x83, 0xdd, 0x83, 0xfd, 0x83, 0xd6, 0x84, 0x1c,
+	0x84, 0x38, 0x84, 0x11, 0x84, 0x06, 0x83, 0xd4, 0x83, 0xdf, 0x84, 0x0f,
+	0x84, 0x03, 0x83, 0xf8, 0x83, 0xf9, 0x83, 0xea, 0x83, 0xc5, 0x83, 0xc0,
+	0x84, 0x26, 0x83, 0xf0, 0x83, 0xe1, 0x84, 0x5c, 0x84, 0x51, 0x84, 0x5a,
+	0x84, 0x59, 0x84, 0x73, 0x84, 0x87, 0x84, 0x88, 0x84, 0x7a, 0x84, 0x89,
+	0x84, 0x78, 0x84, 0x3c, 0x84, 0x46, 0x84, 0x69, 0x84, 0x76, 0x84, 0x8c,
+	0x84, 0x8e, 0x84, 0x31, 0x84, 0x6d, 0x84, 0xc1, 0x84, 0xcd, 0x84, 0xd0,
+	0x84, 0xe6, 0x84, 0xbd, 0x84, 0xd3, 0x84, 0xca, 0x84, 0xbf, 0x84, 0xba,
+	0x84, 0xe0, 0x84, 0xa1, 0x84, 0xb9, 0x84, 0xb4, 0x84, 0x97, 0x84, 0xe5,
+	0x84, 0xe3, 0x85, 0x0c, 0x75, 0x0d, 0x85, 0x38, 0x84, 0xf0, 0x85, 0x39,
+	0x85, 0x1f, 0x85, 0x3a, 0x8f, 0x45, 0x8f, 0x46, 0x8f, 0x47, 0x8f, 0x48,
+	0x8f, 0x49, 0x8f, 0x4a, 0x8f, 0x4b, 0x8f, 0x4c, 0x8f, 0x4d, 0x8f, 0x4e,
+	0x8f, 0x4f, 0x8f, 0x50, 0x8f, 0x51, 0x8f, 0x52, 0x8f, 0x53, 0x8f, 0x54,
+	0x8f, 0x55, 0x8f, 0x56, 0x8f, 0x57, 0x8f, 0x58, 0x8f, 0x59, 0x8f, 0x5a,
+	0x8f, 0x5b, 0x8f, 0x5c, 0x8f, 0x5d, 0x8f, 0x5e, 0x8f, 0x5f, 0x8f, 0x60,
+	0x8f, 0x61, 0x8f, 0x62, 0x8f, 0x63, 0x8f, 0x64, 0x8f, 0x65, 0x8f, 0x6a,
+	0x8f, 0x80, 0x8f, 0x8c, 0x8f, 0x92, 0x8f, 0x9d, 0x8f, 0xa0, 0x8f, 0xa1,
+	0x8f, 0xa2, 0x8f, 0xa4, 0x8f, 0xa5, 0x8f, 0xa6, 0x8f, 0xa7, 0x8f, 0xaa,
+	0x8f, 0xac, 0x8f, 0xad, 0x8f, 0xae, 0x8f, 0xaf, 0x8f, 0xb2, 0x8f, 0xb3,
+	0x8f, 0xb4, 0x8f, 0xb5, 0x8f, 0xb7, 0x8f, 0xb8, 0x8f, 0xba, 0x8f, 0xbb,
+	0x8f, 0xbc, 0x8f, 0xbf, 0x8f, 0xc0, 0x8f, 0xc3, 0x8f, 0xc6, 0x8f, 0xc9,
+	0x8f, 0xca, 0x8f, 0xcb, 0x8f, 0xcc, 0x8f, 0xcd, 0x8f, 0xcf, 0x8f, 0xd2,
+	0x8f, 0xd6, 0x8f, 0xd7, 0x8f, 0xda, 0x8f, 0xe0, 0x8f, 0xe1, 0x8f, 0xe3,
+	0x8f, 0xe7, 0x8f, 0xec, 0x8f, 0xef, 0x8f, 0xf1, 0x8f, 0xf2, 0x8f, 0xf4,
+	0x8f, 0xf5, 0x8f, 0xf6, 0x8f, 0xfa, 0x8f, 0xfb, 0x8f, 0xfc, 0x8f, 0xfe,
+	0x8f, 0xff, 0x90, 0x07, 0x90, 0x08, 0x90, 0x0c, 0x90, 0x0e, 0x90, 0x13,
+	0x90, 0x15, 0x90, 0x18, 0x85, 0x56, 0x85, 0x3b, 0x84, 0xff, 0x84, 0xfc,
+	0x85, 0x59, 0x85, 0x48, 0x85, 0x68, 0x85, 0x64, 0x85, 0x5e, 0x85, 0x7a,
+	0x77, 0xa2, 0x85, 0x43, 0x85, 0x72, 0x85, 0x7b, 0x85, 0xa4, 0x85, 0xa8,
+	0x85, 0x87, 0x85, 0x8f, 0x85, 0x79, 0x85, 0xae, 0x85, 0x9c, 0x85, 0x85,
+	0x85, 0xb9, 0x85, 0xb7, 0x85, 0xb0, 0x85, 0xd3, 0x85, 0xc1, 0x85, 0xdc,
+	0x85, 0xff, 0x86, 0x27, 0x86, 0x05, 0x86, 0x29, 0x86, 0x16, 0x86, 0x3c,
+	0x5e, 0xfe, 0x5f, 0x08, 0x59, 0x3c, 0x59, 0x41, 0x80, 0x37, 0x59, 0x55,
+	0x59, 0x5a, 0x59, 0x58, 0x53, 0x0f, 0x5c, 0x22, 0x5c, 0x25, 0x5c, 0x2c,
+	0x5c, 0x34, 0x62, 0x4c, 0x62, 0x6a, 0x62, 0x9f, 0x62, 0xbb, 0x62, 0xca,
+	0x62, 0xda, 0x62, 0xd7, 0x62, 0xee, 0x63, 0x22, 0x62, 0xf6, 0x63, 0x39,
+	0x63, 0x4b, 0x63, 0x43, 0x63, 0xad, 0x63, 0xf6, 0x63, 0x71, 0x63, 0x7a,
+	0x63, 0x8e, 0x63, 0xb4, 0x63, 0x6d, 0x63, 0xac, 0x63, 0x8a, 0x63, 0x69,
+	0x63, 0xae, 0x63, 0xbc, 0x63, 0xf2, 0x63, 0xf8, 0x63, 0xe0, 0x63, 0xff,
+	0x63, 0xc4, 0x63, 0xde, 0x63, 0xce, 0x64, 0x52, 0x63, 0xc6, 0x63, 0xbe,
+	0x64, 0x45, 0x64, 0x41, 0x64, 0x0b, 0x64, 0x1b, 0x64, 0x20, 0x64, 0x0c,
+	0x64, 0x26, 0x64, 0x21, 0x64, 0x5e, 0x64, 0x84, 0x64, 0x6d, 0x64, 0x96,
+	0x90, 0x19, 0x90, 0x1c, 0x90, 0x23, 0x90, 0x24, 0x90, 0x25, 0x90, 0x27,
+	0x90, 0x28, 0x90, 0x29, 0x90, 0x2a, 0x90, 0x2b, 0x90, 0x2c, 0x90, 0x30,
+	0x90, 0x31, 0x90, 0x32, 0x90, 0x33, 0x90, 0x34, 0x90, 0x37, 0x90, 0x39,
+	0x90, 0x3a, 0x90, 0x3d, 0x90, 0x3f, 0x90, 0x40, 0x90, 0x43, 0x90, 0x45,
+	0x90, 0x46, 0x90, 0x48, 0x90, 0x49, 0x90, 0x4a, 0x90, 0x4b, 0x90, 0x4c,
+	0x90, 0x4e, 0x90, 0x54, 0x90, 0x55, 0x90, 0x56, 0x90, 0x59, 0x90, 0x5a,
+	0x90, 0x5c, 0x90, 0x5d, 0x90, 0x5e, 0x90, 0x5f, 0x90, 0x60, 0x90, 0x61,
+	0x90, 0x64, 0x90, 0x66, 0x90, 0x67, 0x90, 0x69, 0x90, 0x6a, 0x90, 0x6b,
+	0x90, 0x6c, 0x90, 0x6f, 0x90, 0x70, 0x90, 0x71, 0x90, 0x72, 0x90, 0x73,
+	0x90, 0x76, 0x90, 0x77, 0x90, 0x78, 0x90, 0x79, 0x90, 0x7a, 0x90, 0x7b,
+	0x90, 0x7c, 0x90, 0x7e, 0x90, 0x81, 0x90, 0x84, 0x90, 0x85, 0x90, 0x86,
+	0x90, 0x87, 0x90, 0x89, 0x90, 0x8a, 0x90, 0x8c, 0x90, 0x8d, 0x90, 0x8e,
+	0x90, 0x8f, 0x90, 0x90, 0x90, 0x92, 0x90, 0x94, 0x90, 0x96, 0x90, 0x98,
+	0x90, 0x9a, 0x90, 0x9c, 0x90, 0x9e, 0x90, 0x9f, 0x90, 0xa0, 0x90, 0xa4,
+	0x90, 0xa5, 0x90, 0xa7, 0x90, 0xa8, 0x90, 0xa9, 0x90, 0xab, 0x90, 0xad,
+	0x90, 0xb2, 0x90, 0xb7, 0x90, 0xbc, 0x90, 0xbd, 0x90, 0xbf, 0x90, 0xc0,
+	0x64, 0x7a, 0x64, 0xb7, 0x64, 0xb8, 0x64, 0x99, 0x64, 0xba, 0x64, 0xc0,
+	0x64, 0xd0, 0x64, 0xd7, 0x64, 0xe4, 0x64, 0xe2, 0x65, 0x09, 0x65, 0x25,
+	0x65, 0x2e, 0x5f, 0x0b, 0x5f, 0xd2, 0x75, 0x19, 0x5f, 0x11, 0x53, 0x5f,
+	0x53, 0xf1, 0x53, 0xfd, 0x53, 0xe9, 0x53, 0xe8, 0x53, 0xfb, 0x54, 0x12,
+	0x54, 0x16, 0x54, 0x06, 0x54, 0x4b, 0x54, 0x52, 0x54, 0x53, 0x54, 0x54,
+	0x54, 0x56, 0x54, 0x43, 0x54, 0x21, 0x54, 0x57, 0x54, 0x59, 0x54, 0x23,
+	0x54, 0x32, 0x54, 0x82, 0x54, 0x94, 0x54, 0x77, 0x54, 0x71, 0x54, 0x64,
+	0x54, 0x9a, 0x54, 0x9b, 0x54, 0x84, 0x54, 0x76, 0x54, 0x66, 0x54, 0x9d,
+	0x54, 0xd0, 0x54, 0xad, 0x54, 0xc2, 0x54, 0xb4, 0x54, 0xd2, 0x54, 0xa7,
+	0x54, 0xa6, 0x54, 0xd3, 0x54, 0xd4, 0x54, 0x72, 0x54, 0xa3, 0x54, 0xd5,
+	0x54, 0xbb, 0x54, 0xbf, 0x54, 0xcc, 0x54, 0xd9, 0x54, 0xda, 0x54, 0xdc,
+	0x54, 0xa9, 0x54, 0xaa, 0x54, 0xa4, 0x54, 0xdd, 0x54, 0xcf, 0x54, 0xde,
+	0x55, 0x1b, 0x54, 0xe7, 0x55, 0x20, 0x54, 0xfd, 0x55, 0x14, 0x54, 0xf3,
+	0x55, 0x22, 0x55, 0x23, 0x55, 0x0f, 0x55, 0x11, 0x55, 0x27, 0x55, 0x2a,
+	0x55, 0x67, 0x55, 0x8f, 0x55, 0xb5, 0x55, 0x49, 0x55, 0x6d, 0x55, 0x41,
+	0x55, 0x55, 0x55, 0x3f, 0x55, 0x50, 0x55, 0x3c, 0x90, 0xc2, 0x90, 0xc3,
+	0x90, 0xc6, 0x90, 0xc8, 0x90, 0xc9, 0x90, 0xcb, 0x90, 0xcc, 0x90, 0xcd,
+	0x90, 0xd2, 0x90, 0xd4, 0x90, 0xd5, 0x90, 0xd6, 0x90, 0xd8, 0x90, 0xd9,
+	0x90, 0xda, 0x90, 0xde, 0x90, 0xdf, 0x90, 0xe0, 0x90, 0xe3, 0x90, 0xe4,
+	0x90, 0xe5, 0x90, 0xe9, 0x90, 0xea, 0x90, 0xec, 0x90, 0xee, 0x90, 0xf0,
+	0x90, 0xf1, 0x90, 0xf2, 0x90, 0xf3, 0x90, 0xf5, 0x90, 0xf6, 0x90, 0xf7,
+	0x90, 0xf9, 0x90, 0xfa, 0x90, 0xfb, 0x90, 0xfc, 0x90, 0xff, 0x91, 0x00,
+	0x91, 0x01, 0x91, 0x03, 0x91, 0x05, 0x91, 0x06, 0x91, 0x07, 0x91, 0x08,
+	0x91, 0x09, 0x91, 0x0a, 0x91, 0x0b, 0x91, 0x0c, 0x91, 0x0d, 0x91, 0x0e,
+	0x91, 0x0f, 0x91, 0x10, 0x91, 0x11, 0x91, 0x12, 0x91, 0x13, 0x91, 0x14,
+	0x91, 0x15, 0x91, 0x16, 0x91, 0x17, 0x91, 0x18, 0x91, 0x1a, 0x91, 0x1b,
+	0x91, 0x1c, 0x91, 0x1d, 0x91, 0x1f, 0x91, 0x20, 0x91, 0x21, 0x91, 0x24,
+	0x91, 0x25, 0x91, 0x26, 0x91, 0x27, 0x91, 0x28, 0x91, 0x29, 0x91, 0x2a,
+	0x91, 0x2b, 0x91, 0x2c, 0x91, 0x2d, 0x91, 0x2e, 0x91, 0x30, 0x91, 0x32,
+	0x91, 0x33, 0x91, 0x34, 0x91, 0x35, 0x91, 0x36, 0x91, 0x37, 0x91, 0x38,
+	0x91, 0x3a, 0x91, 0x3b, 0x91, 0x3c, 0x91, 0x3d, 0x91, 0x3e, 0x91, 0x3f,
+	0x91, 0x40, 0x91, 0x41, 0x91, 0x42, 0x91, 0x44, 0x55, 0x37, 0x55, 0x56,
+	0x55, 0x75, 0x55, 0x76, 0x55, 0x77, 0x55, 0x33, 0x55, 0x30, 0x55, 0x5c,
+	0x55, 0x8b, 0x55, 0xd2, 0x55, 0x83, 0x55, 0xb1, 0x55, 0xb9, 0x55, 0x88,
+	0x55, 0x81, 0x55, 0x9f, 0x55, 0x7e, 0x55, 0xd6, 0x55, 0x91, 0x55, 0x7b,
+	0x55, 0xdf, 0x55, 0xbd, 0x55, 0xbe, 0x55, 0x94, 0x55, 0x99, 0x55, 0xea,
+	0x55, 0xf7, 0x55, 0xc9, 0x56, 0x1f, 0x55, 0xd1, 0x55, 0xeb, 0x55, 0xec,
+	0x55, 0xd4, 0x55, 0xe6, 0x55, 0xdd, 0x55, 0xc4, 0x55, 0xef, 0x55, 0xe5,
+	0x55, 0xf2, 0x55, 0xf3, 0x55, 0xcc, 0x55, 0xcd, 0x55, 0xe8, 0x55, 0xf5,
+	0x55, 0xe4, 0x8f, 0x94, 0x56, 0x1e, 0x56, 0x08, 0x56, 0x0c, 0x56, 0x01,
+	0x56, 0x24, 0x56, 0x23, 0x55, 0xfe, 0x56, 0x00, 0x56, 0x27, 0x56, 0x2d,
+	0x56, 0x58, 0x56, 0x39, 0x56, 0x57, 0x56, 0x2c, 0x56, 0x4d, 0x56, 0x62,
+	0x56, 0x59, 0x56, 0x5c, 0x56, 0x4c, 0x56, 0x54, 0x56, 0x86, 0x56, 0x64,
+	0x56, 0x71, 0x56, 0x6b, 0x56, 0x7b, 0x56, 0x7c, 0x56, 0x85, 0x56, 0x93,
+	0x56, 0xaf, 0x56, 0xd4, 0x56, 0xd7, 0x56, 0xdd, 0x56, 0xe1, 0x56, 0xf5,
+	0x56, 0xeb, 0x56, 0xf9, 0x56, 0xff, 0x57, 0x04, 0x57, 0x0a, 0x57, 0x09,
+	0x57, 0x1c, 0x5e, 0x0f, 0x5e, 0x19, 0x5e, 0x14, 0x5e, 0x11, 0x5e, 0x31,
+	0x5e, 0x3b, 0x5e, 0x3c, 0x91, 0x45, 0x91, 0x47, 0x91, 0x48, 0x91, 0x51,
+	0x91, 0x53, 0x91, 0x54, 0x91, 0x55, 0x91, 0x56, 0x91, 0x58, 0x91, 0x59,
+	0x91, 0x5b, 0x91, 0x5c, 0x91, 0x5f, 0x91, 0x60, 0x91, 0x66, 0x91, 0x67,
+	0x91, 0x68, 0x91, 0x6b, 0x91, 0x6d, 0x91, 0x73, 0x91, 0x7a, 0x91, 0x7b,
+	0x91, 0x7c, 0x91, 0x80, 0x91, 0x81, 0x91, 0x82, 0x91, 0x83, 0x91, 0x84,
+	0x91, 0x86, 0x91, 0x88, 0x91, 0x8a, 0x91, 0x8e, 0x91, 0x8f, 0x91, 0x93,
+	0x91, 0x94, 0x91, 0x95, 0x91, 0x96, 0x91, 0x97, 0x91, 0x98, 0x91, 0x99,
+	0x91, 0x9c, 0x91, 0x9d, 0x91, 0x9e, 0x91, 0x9f, 0x91, 0xa0, 0x91, 0xa1,
+	0x91, 0xa4, 0x91, 0xa5, 0x91, 0xa6, 0x91, 0xa7, 0x91, 0xa8, 0x91, 0xa9,
+	0x91, 0xab, 0x91, 0xac, 0x91, 0xb0, 0x91, 0xb1, 0x91, 0xb2, 0x91, 0xb3,
+	0x91, 0xb6, 0x91, 0xb7, 0x91, 0xb8, 0x91, 0xb9, 0x91, 0xbb, 0x91, 0xbc,
+	0x91, 0xbd, 0x91, 0xbe, 0x91, 0xbf, 0x91, 0xc0, 0x91, 0xc1, 0x91, 0xc2,
+	0x91, 0xc3, 0x91, 0xc4, 0x91, 0xc5, 0x91, 0xc6, 0x91, 0xc8, 0x91, 0xcb,
+	0x91, 0xd0, 0x91, 0xd2, 0x91, 0xd3, 0x91, 0xd4, 0x91, 0xd5, 0x91, 0xd6,
+	0x91, 0xd7, 0x91, 0xd8, 0x91, 0xd9, 0x91, 0xda, 0x91, 0xdb, 0x91, 0xdd,
+	0x91, 0xde, 0x91, 0xdf, 0x91, 0xe0, 0x91, 0xe1, 0x91, 0xe2, 0x91, 0xe3,
+	0x91, 0xe4, 0x91, 0xe5, 0x5e, 0x37, 0x5e, 0x44, 0x5e, 0x54, 0x5e, 0x5b,
+	0x5e, 0x5e, 0x5e, 0x61, 0x5c, 0x8c, 0x5c, 0x7a, 0x5c, 0x8d, 0x5c, 0x90,
+	0x5c, 0x96, 0x5c, 0x88, 0x5c, 0x98, 0x5c, 0x99, 0x5c, 0x91, 0x5c, 0x9a,
+	0x5c, 0x9c, 0x5c, 0xb5, 0x5c, 0xa2, 0x5c, 0xbd, 0x5c, 0xac, 0x5c, 0xab,
+	0x5c, 0xb1, 0x5c, 0xa3, 0x5c, 0xc1, 0x5c, 0xb7, 0x5c, 0xc4, 0x5c, 0xd2,
+	0x5c, 0xe4, 0x5c, 0xcb, 0x5c, 0xe5, 0x5d, 0x02, 0x5d, 0x03, 0x5d, 0x27,
+	0x5d, 0x26, 0x5d, 0x2e, 0x5d, 0x24, 0x5d, 0x1e, 0x5d, 0x06, 0x5d, 0x1b,
+	0x5d, 0x58, 0x5d, 0x3e, 0x5d, 0x34, 0x5d, 0x3d, 0x5d, 0x6c, 0x5d, 0x5b,
+	0x5d, 0x6f, 0x5d, 0x5d, 0x5d, 0x6b, 0x5d, 0x4b, 0x5d, 0x4a, 0x5d, 0x69,
+	0x5d, 0x74, 0x5d, 0x82, 0x5d, 0x99, 0x5d, 0x9d, 0x8c, 0x73, 0x5d, 0xb7,
+	0x5d, 0xc5, 0x5f, 0x73, 0x5f, 0x77, 0x5f, 0x82, 0x5f, 0x87, 0x5f, 0x89,
+	0x5f, 0x8c, 0x5f, 0x95, 0x5f, 0x99, 0x5f, 0x9c, 0x5f, 0xa8, 0x5f, 0xad,
+	0x5f, 0xb5, 0x5f, 0xbc, 0x88, 0x62, 0x5f, 0x61, 0x72, 0xad, 0x72, 0xb0,
+	0x72, 0xb4, 0x72, 0xb7, 0x72, 0xb8, 0x72, 0xc3, 0x72, 0xc1, 0x72, 0xce,
+	0x72, 0xcd, 0x72, 0xd2, 0x72, 0xe8, 0x72, 0xef, 0x72, 0xe9, 0x72, 0xf2,
+	0x72, 0xf4, 0x72, 0xf7, 0x73, 0x01, 0x72, 0xf3, 0x73, 0x03, 0x72, 0xfa,
+	0x91, 0xe6, 0x91, 0xe7, 0x91, 0xe8, 0x91, 0xe9, 0x91, 0xea, 0x91, 0xeb,
+	0x91, 0xec, 0x91, 0xed, 0x91, 0xee, 0x91, 0xef, 0x91, 0xf0, 0x91, 0xf1,
+	0x91, 0xf2, 0x91, 0xf3, 0x91, 0xf4, 0x91, 0xf5, 0x91, 0xf6, 0x91, 0xf7,
+	0x91, 0xf8, 0x91, 0xf9, 0x91, 0xfa, 0x91, 0xfb, 0x91, 0xfc, 0x91, 0xfd,
+	0x91, 0xfe, 0x91, 0xff, 0x92, 0x00, 0x92, 0x01, 0x92, 0x02, 0x92, 0x03,
+	0x92, 0x04, 0x92, 0x05, 0x92, 0x06, 0x92, 0x07, 0x92, 0x08, 0x92, 0x09,
+	0x92, 0x0a, 0x92, 0x0b, 0x92, 0x0c, 0x92, 0x0d, 0x92, 0x0e, 0x92, 0x0f,
+	0x92, 0x10, 0x92, 0x11, 0x92, 0x12, 0x92, 0x13, 0x92, 0x14, 0x92, 0x15,
+	0x92, 0x16, 0x92, 0x17, 0x92, 0x18, 0x92, 0x19, 0x92, 0x1a, 0x92, 0x1b,
+	0x92, 0x1c, 0x92, 0x1d, 0x92, 0x1e, 0x92, 0x1f, 0x92, 0x20, 0x92, 0x21,
+	0x92, 0x22, 0x92, 0x23, 0x92, 0x24, 0x92, 0x25, 0x92, 0x26, 0x92, 0x27,
+	0x92, 0x28, 0x92, 0x29, 0x92, 0x2a, 0x92, 0x2b, 0x92, 0x2c, 0x92, 0x2d,
+	0x92, 0x2e, 0x92, 0x2f, 0x92, 0x30, 0x92, 0x31, 0x92, 0x32, 0x92, 0x33,
+	0x92, 0x34, 0x92, 0x35, 0x92, 0x36, 0x92, 0x37, 0x92, 0x38, 0x92, 0x39,
+	0x92, 0x3a, 0x92, 0x3b, 0x92, 0x3c, 0x92, 0x3d, 0x92, 0x3e, 0x92, 0x3f,
+	0x92, 0x40, 0x92, 0x41, 0x92, 0x42, 0x92, 0x43, 0x92, 0x44, 0x92, 0x45,
+	0x72, 0xfb, 0x73, 0x17, 0x73, 0x13, 0x73, 0x21, 0x73, 0x0a, 0x73, 0x1e,
+	0x73, 0x1d, 0x73, 0x15, 0x73, 0x22, 0x73, 0x39, 0x73, 0x25, 0x73, 0x2c,
+	0x73, 0x38, 0x73, 0x31, 0x73, 0x50, 0x73, 0x4d, 0x73, 0x57, 0x73, 0x60,
+	0x73, 0x6c, 0x73, 0x6f, 0x73, 0x7e, 0x82, 0x1b, 0x59, 0x25, 0x98, 0xe7,
+	0x59, 0x24, 0x59, 0x02, 0x99, 0x63, 0x99, 0x67, 0x99, 0x68, 0x99, 0x69,
+	0x99, 0x6a, 0x99, 0x6b, 0x99, 0x6c, 0x99, 0x74, 0x99, 0x77, 0x99, 0x7d,
+	0x99, 0x80, 0x99, 0x84, 0x99, 0x87, 0x99, 0x8a, 0x99, 0x8d, 0x99, 0x90,
+	0x99, 0x91, 0x99, 0x93, 0x99, 0x94, 0x99, 0x95, 0x5e, 0x80, 0x5e, 0x91,
+	0x5e, 0x8b, 0x5e, 0x96, 0x5e, 0xa5, 0x5e, 0xa0, 0x5e, 0xb9, 0x5e, 0xb5,
+	0x5e, 0xbe, 0x5e, 0xb3, 0x8d, 0x53, 0x5e, 0xd2, 0x5e, 0xd1, 0x5e, 0xdb,
+	0x5e, 0xe8, 0x5e, 0xea, 0x81, 0xba, 0x5f, 0xc4, 0x5f, 0xc9, 0x5f, 0xd6,
+	0x5f, 0xcf, 0x60, 0x03, 0x5f, 0xee, 0x60, 0x04, 0x5f, 0xe1, 0x5f, 0xe4,
+	0x5f, 0xfe, 0x60, 0x05, 0x60, 0x06, 0x5f, 0xea, 0x5f, 0xed, 0x5f, 0xf8,
+	0x60, 0x19, 0x60, 0x35, 0x60, 0x26, 0x60, 0x1b, 0x60, 0x0f, 0x60, 0x0d,
+	0x60, 0x29, 0x60, 0x2b, 0x60, 0x0a, 0x60, 0x3f, 0x60, 0x21, 0x60, 0x78,
+	0x60, 0x79, 0x60, 0x7b, 0x60, 0x7a, 0x60, 0x42, 0x92, 0x46, 0x92, 0x47,
+	0x92, 0x48, 0x92, 0x49, 0x92, 0x4a, 0x92, 0x4b, 0x92, 0x4c, 0x92, 0x4d,
+	0x92, 0x4e, 0x92, 0x4f, 0x92, 0x50, 0x92, 0x51, 0x92, 0x52, 0x92, 0x53,
+	0x92, 0x54, 0x92, 0x55, 0x92, 0x56, 0x92, 0x57, 0x92, 0x58, 0x92, 0x59,
+	0x92, 0x5a, 0x92, 0x5b, 0x92, 0x5c, 0x92, 0x5d, 0x92, 0x5e, 0x92, 0x5f,
+	0x92, 0x60, 0x92, 0x61, 0x92, 0x62, 0x92, 0x63, 0x92, 0x64, 0x92, 0x65,
+	0x92, 0x66, 0x92, 0x67, 0x92, 0x68, 0x92, 0x69, 0x92, 0x6a, 0x92, 0x6b,
+	0x92, 0x6c, 0x92, 0x6d, 0x92, 0x6e, 0x92, 0x6f, 0x92, 0x70, 0x92, 0x71,
+	0x92, 0x72, 0x92, 0x73, 0x92, 0x75, 0x92, 0x76, 0x92, 0x77, 0x92, 0x78,
+	0x92, 0x79, 0x92, 0x7a, 0x92, 0x7b, 0x92, 0x7c, 0x92, 0x7d, 0x92, 0x7e,
+	0x92, 0x7f, 0x92, 0x80, 0x92, 0x81, 0x92, 0x82, 0x92, 0x83, 0x92, 0x84,
+	0x92, 0x85, 0x92, 0x86, 0x92, 0x87, 0x92, 0x88, 0x92, 0x89, 0x92, 0x8a,
+	0x92, 0x8b, 0x92, 0x8c, 0x92, 0x8d, 0x92, 0x8f, 0x92, 0x90, 0x92, 0x91,
+	0x92, 0x92, 0x92, 0x93, 0x92, 0x94, 0x92, 0x95, 0x92, 0x96, 0x92, 0x97,
+	0x92, 0x98, 0x92, 0x99, 0x92, 0x9a, 0x92, 0x9b, 0x92, 0x9c, 0x92, 0x9d,
+	0x92, 0x9e, 0x92, 0x9f, 0x92, 0xa0, 0x92, 0xa1, 0x92, 0xa2, 0x92, 0xa3,
+	0x92, 0xa4, 0x92, 0xa5, 0x92, 0xa6, 0x92, 0xa7, 0x60, 0x6a, 0x60, 0x7d,
+	0x60, 0x96, 0x60, 0x9a, 0x60, 0xad, 0x60, 0x9d, 0x60, 0x83, 0x60, 0x92,
+	0x60, 0x8c, 0x60, 0x9b, 0x60, 0xec, 0x60, 0xbb, 0x60, 0xb1, 0x60, 0xdd,
+	0x60, 0xd8, 0x60, 0xc6, 0x60, 0xda, 0x60, 0xb4, 0x61, 0x20, 0x61, 0x26,
+	0x61, 0x15, 0x61, 0x23, 0x60, 0xf4, 0x61, 0x00, 0x61, 0x0e, 0x61, 0x2b,
+	0x61, 0x4a, 0x61, 0x75, 0x61, 0xac, 0x61, 0x94, 0x61, 0xa7, 0x61, 0xb7,
+	0x61, 0xd4, 0x61, 0xf5, 0x5f, 0xdd, 0x96, 0xb3, 0x95, 0xe9, 0x95, 0xeb,
+	0x95, 0xf1, 0x95, 0xf3, 0x95, 0xf5, 0x95, 0xf6, 0x95, 0xfc, 0x95, 0xfe,
+	0x96, 0x03, 0x96, 0x04, 0x96, 0x06, 0x96, 0x08, 0x96, 0x0a, 0x96, 0x0b,
+	0x96, 0x0c, 0x96, 0x0d, 0x96, 0x0f, 0x96, 0x12, 0x96, 0x15, 0x96, 0x16,
+	0x96, 0x17, 0x96, 0x19, 0x96, 0x1a, 0x4e, 0x2c, 0x72, 0x3f, 0x62, 0x15,
+	0x6c, 0x35, 0x6c, 0x54, 0x6c, 0x5c, 0x6c, 0x4a, 0x6c, 0xa3, 0x6c, 0x85,
+	0x6c, 0x90, 0x6c, 0x94, 0x6c, 0x8c, 0x6c, 0x68, 0x6c, 0x69, 0x6c, 0x74,
+	0x6c, 0x76, 0x6c, 0x86, 0x6c, 0xa9, 0x6c, 0xd0, 0x6c, 0xd4, 0x6c, 0xad,
+	0x6c, 0xf7, 0x6c, 0xf8, 0x6c, 0xf1, 0x6c, 0xd7, 0x6c, 0xb2, 0x6c, 0xe0,
+	0x6c, 0xd6, 0x6c, 0xfa, 0x6c, 0xeb, 0x6c, 0xee, 0x6c, 0xb1, 0x6c, 0xd3,
+	0x6c, 0xef, 0x6c, 0xfe, 0x92, 0xa8, 0x92, 0xa9, 0x92, 0xaa, 0x92, 0xab,
+	0x92, 0xac, 0x92, 0xad, 0x92, 0xaf, 0x92, 0xb0, 0x92, 0xb1, 0x92, 0xb2,
+	0x92, 0xb3, 0x92, 0xb4, 0x92, 0xb5, 0x92, 0xb6, 0x92, 0xb7, 0x92, 0xb8,
+	0x92, 0xb9, 0x92, 0xba, 0x92, 0xbb, 0x92, 0xbc, 0x92, 0xbd, 0x92, 0xbe,
+	0x92, 0xbf, 0x92, 0xc0, 0x92, 0xc1, 0x92, 0xc2, 0x92, 0xc3, 0x92, 0xc4,
+	0x92, 0xc5, 0x92, 0xc6, 0x92, 0xc7, 0x92, 0xc9, 0x92, 0xca, 0x92, 0xcb,
+	0x92, 0xcc, 0x92, 0xcd, 0x92, 0xce, 0x92, 0xcf, 0x92, 0xd0, 0x92, 0xd1,
+	0x92, 0xd2, 0x92, 0xd3, 0x92, 0xd4, 0x92, 0xd5, 0x92, 0xd6, 0x92, 0xd7,
+	0x92, 0xd8, 0x92, 0xd9, 0x92, 0xda, 0x92, 0xdb, 0x92, 0xdc, 0x92, 0xdd,
+	0x92, 0xde, 0x92, 0xdf, 0x92, 0xe0, 0x92, 0xe1, 0x92, 0xe2, 0x92, 0xe3,
+	0x92, 0xe4, 0x92, 0xe5, 0x92, 0xe6, 0x92, 0xe7, 0x92, 0xe8, 0x92, 0xe9,
+	0x92, 0xea, 0x92, 0xeb, 0x92, 0xec, 0x92, 0xed, 0x92, 0xee, 0x92, 0xef,
+	0x92, 0xf0, 0x92, 0xf1, 0x92, 0xf2, 0x92, 0xf3, 0x92, 0xf4, 0x92, 0xf5,
+	0x92, 0xf6, 0x92, 0xf7, 0x92, 0xf8, 0x92, 0xf9, 0x92, 0xfa, 0x92, 0xfb,
+	0x92, 0xfc, 0x92, 0xfd, 0x92, 0xfe, 0x92, 0xff, 0x93, 0x00, 0x93, 0x01,
+	0x93, 0x02, 0x93, 0x03, 0x93, 0x04, 0x93, 0x05, 0x93, 0x06, 0x93, 0x07,
+	0x93, 0x08, 0x93, 0x09, 0x6d, 0x39, 0x6d, 0x27, 0x6d, 0x0c, 0x6d, 0x43,
+	0x6d, 0x48, 0x6d, 0x07, 0x6d, 0x04, 0x6d, 0x19, 0x6d, 0x0e, 0x6d, 0x2b,
+	0x6d, 0x4d, 0x6d, 0x2e, 0x6d, 0x35, 0x6d, 0x1a, 0x6d, 0x4f, 0x6d, 0x52,
+	0x6d, 0x54, 0x6d, 0x33, 0x6d, 0x91, 0x6d, 0x6f, 0x6d, 0x9e, 0x6d, 0xa0,
+	0x6d, 0x5e, 0x6d, 0x93, 0x6d, 0x94, 0x6d, 0x5c, 0x6d, 0x60, 0x6d, 0x7c,
+	0x6d, 0x63, 0x6e, 0x1a, 0x6d, 0xc7, 0x6d, 0xc5, 0x6d, 0xde, 0x6e, 0x0e,
+	0x6d, 0xbf, 0x6d, 0xe0, 0x6e, 0x11, 0x6d, 0xe6, 0x6d, 0xdd, 0x6d, 0xd9,
+	0x6e, 0x16, 0x6d, 0xab, 0x6e, 0x0c, 0x6d, 0xae, 0x6e, 0x2b, 0x6e, 0x6e,
+	0x6e, 0x4e, 0x6e, 0x6b, 0x6e, 0xb2, 0x6e, 0x5f, 0x6e, 0x86, 0x6e, 0x53,
+	0x6e, 0x54, 0x6e, 0x32, 0x6e, 0x25, 0x6e, 0x44, 0x6e, 0xdf, 0x6e, 0xb1,
+	0x6e, 0x98, 0x6e, 0xe0, 0x6f, 0x2d, 0x6e, 0xe2, 0x6e, 0xa5, 0x6e, 0xa7,
+	0x6e, 0xbd, 0x6e, 0xbb, 0x6e, 0xb7, 0x6e, 0xd7, 0x6e, 0xb4, 0x6e, 0xcf,
+	0x6e, 0x8f, 0x6e, 0xc2, 0x6e, 0x9f, 0x6f, 0x62, 0x6f, 0x46, 0x6f, 0x47,
+	0x6f, 0x24, 0x6f, 0x15, 0x6e, 0xf9, 0x6f, 0x2f, 0x6f, 0x36, 0x6f, 0x4b,
+	0x6f, 0x74, 0x6f, 0x2a, 0x6f, 0x09, 0x6f, 0x29, 0x6f, 0x89, 0x6f, 0x8d,
+	0x6f, 0x8c, 0x6f, 0x78, 0x6f, 0x72, 0x6f, 0x7c, 0x6f, 0x7a, 0x6f, 0xd1,
+	0x93, 0x0a, 0x93, 0x0b, 0x93, 0x0c, 0x93, 0x0d, 0x93, 0x0e, 0x93, 0x0f,
+	0x93, 0x10, 0x93, 0x11, 0x93, 0x12, 0x93, 0x13, 0x93, 0x14, 0x93, 0x15,
+	0x93, 0x16, 0x93, 0x17, 0x93, 0x18, 0x93, 0x19, 0x93, 0x1a, 0x93, 0x1b,
+	0x93, 0x1c, 0x93, 0x1d, 0x93, 0x1e, 0x93, 0x1f, 0x93, 0x20, 0x93, 0x21,
+	0x93, 0x22, 0x93, 0x23, 0x93, 0x24, 0x93, 0x25, 0x93, 0x26, 0x93, 0x27,
+	0x93, 0x28, 0x93, 0x29, 0x93, 0x2a, 0x93, 0x2b, 0x93, 0x2c, 0x93, 0x2d,
+	0x93, 0x2e, 0x93, 0x2f, 0x93, 0x30, 0x93, 0x31, 0x93, 0x32, 0x93, 0x33,
+	0x93, 0x34, 0x93, 0x35, 0x93, 0x36, 0x93, 0x37, 0x93, 0x38, 0x93, 0x39,
+	0x93, 0x3a, 0x93, 0x3b, 0x93, 0x3c, 0x93, 0x3d, 0x93, 0x3f, 0x93, 0x40,
+	0x93, 0x41, 0x93, 0x42, 0x93, 0x43, 0x93, 0x44, 0x93, 0x45, 0x93, 0x46,
+	0x93, 0x47, 0x93, 0x48, 0x93, 0x49, 0x93, 0x4a, 0x93, 0x4b, 0x93, 0x4c,
+	0x93, 0x4d, 0x93, 0x4e, 0x93, 0x4f, 0x93, 0x50, 0x93, 0x51, 0x93, 0x52,
+	0x93, 0x53, 0x93, 0x54, 0x93, 0x55, 0x93, 0x56, 0x93, 0x57, 0x93, 0x58,
+	0x93, 0x59, 0x93, 0x5a, 0x93, 0x5b, 0x93, 0x5c, 0x93, 0x5d, 0x93, 0x5e,
+	0x93, 0x5f, 0x93, 0x60, 0x93, 0x61, 0x93, 0x62, 0x93, 0x63, 0x93, 0x64,
+	0x93, 0x65, 0x93, 0x66, 0x93, 0x67, 0x93, 0x68, 0x93, 0x69, 0x93, 0x6b,
+	0x6f, 0xc9, 0x6f, 0xa7, 0x6f, 0xb9, 0x6f, 0xb6, 0x6f, 0xc2, 0x6f, 0xe1,
+	0x6f, 0xee, 0x6f, 0xde, 0x6f, 0xe0, 0x6f, 0xef, 0x70, 0x1a, 0x70, 0x23,
+	0x70, 0x1b, 0x70, 0x39, 0x70, 0x35, 0x70, 0x4f, 0x70, 0x5e, 0x5b, 0x80,
+	0x5b, 0x84, 0x5b, 0x95, 0x5b, 0x93, 0x5b, 0xa5, 0x5b, 0xb8, 0x75, 0x2f,
+	0x9a, 0x9e, 0x64, 0x34, 0x5b, 0xe4, 0x5b, 0xee, 0x89, 0x30, 0x5b, 0xf0,
+	0x8e, 0x47, 0x8b, 0x07, 0x8f, 0xb6, 0x8f, 0xd3, 0x8f, 0xd5, 0x8f, 0xe5,
+	0x8f, 0xee, 0x8f, 0xe4, 0x8f, 0xe9, 0x8f, 0xe6, 0x8f, 0xf3, 0x8f, 0xe8,
+	0x90, 0x05, 0x90, 0x04, 0x90, 0x0b, 0x90, 0x26, 0x90, 0x11, 0x90, 0x0d,
+	0x90, 0x16, 0x90, 0x21, 0x90, 0x35, 0x90, 0x36, 0x90, 0x2d, 0x90, 0x2f,
+	0x90, 0x44, 0x90, 0x51, 0x90, 0x52, 0x90, 0x50, 0x90, 0x68, 0x90, 0x58,
+	0x90, 0x62, 0x90, 0x5b, 0x66, 0xb9, 0x90, 0x74, 0x90, 0x7d, 0x90, 0x82,
+	0x90, 0x88, 0x90, 0x83, 0x90, 0x8b, 0x5f, 0x50, 0x5f, 0x57, 0x5f, 0x56,
+	0x5f, 0x58, 0x5c, 0x3b, 0x54, 0xab, 0x5c, 0x50, 0x5c, 0x59, 0x5b, 0x71,
+	0x5c, 0x63, 0x5c, 0x66, 0x7f, 0xbc, 0x5f, 0x2a, 0x5f, 0x29, 0x5f, 0x2d,
+	0x82, 0x74, 0x5f, 0x3c, 0x9b, 0x3b, 0x5c, 0x6e, 0x59, 0x81, 0x59, 0x83,
+	0x59, 0x8d, 0x59, 0xa9, 0x59, 0xaa, 0x59, 0xa3, 0x93, 0x6c, 0x93, 0x6d,
+	0x93, 0x6e, 0x93, 0x6f, 0x93, 0x70, 0x93, 0x71, 0x93, 0x72, 0x93, 0x73,
+	0x93, 0x74, 0x93, 0x75, 0x93, 0x76, 0x93, 0x77, 0x93, 0x78, 0x93, 0x79,
+	0x93, 0x7a, 0x93, 0x7b, 0x93, 0x7c, 0x93, 0x7d, 0x93, 0x7e, 0x93, 0x7f,
+	0x93, 0x80, 0x93, 0x81, 0x93, 0x82, 0x93, 0x83, 0x93, 0x84, 0x93, 0x85,
+	0x93, 0x86, 0x93, 0x87, 0x93, 0x88, 0x93, 0x89, 0x93, 0x8a, 0x93, 0x8b,
+	0x93, 0x8c, 0x93, 0x8d, 0x93, 0x8e, 0x93, 0x90, 0x93, 0x91, 0x93, 0x92,
+	0x93, 0x93, 0x93, 0x94, 0x93, 0x95, 0x93, 0x96, 0x93, 0x97, 0x93, 0x98,
+	0x93, 0x99, 0x93, 0x9a, 0x93, 0x9b, 0x93, 0x9c, 0x93, 0x9d, 0x93, 0x9e,
+	0x93, 0x9f, 0x93, 0xa0, 0x93, 0xa1, 0x93, 0xa2, 0x93, 0xa3, 0x93, 0xa4,
+	0x93, 0xa5, 0x93, 0xa6, 0x93, 0xa7, 0x93, 0xa8, 0x93, 0xa9, 0x93, 0xaa,
+	0x93, 0xab, 0x93, 0xac, 0x93, 0xad, 0x93, 0xae, 0x93, 0xaf, 0x93, 0xb0,
+	0x93, 0xb1, 0x93, 0xb2, 0x93, 0xb3, 0x93, 0xb4, 0x93, 0xb5, 0x93, 0xb6,
+	0x93, 0xb7, 0x93, 0xb8, 0x93, 0xb9, 0x93, 0xba, 0x93, 0xbb, 0x93, 0xbc,
+	0x93, 0xbd, 0x93, 0xbe, 0x93, 0xbf, 0x93, 0xc0, 0x93, 0xc1, 0x93, 0xc2,
+	0x93, 0xc3, 0x93, 0xc4, 0x93, 0xc5, 0x93, 0xc6, 0x93, 0xc7, 0x93, 0xc8,
+	0x93, 0xc9, 0x93, 0xcb, 0x93, 0xcc, 0x93, 0xcd, 0x59, 0x97, 0x59, 0xca,
+	0x59, 0xab, 0x59, 0x9e, 0x59, 0xa4, 0x59, 0xd2, 0x59, 0xb2, 0x59, 0xaf,
+	0x59, 0xd7, 0x59, 0xbe, 0x5a, 0x05, 0x5a, 0x06, 0x59, 0xdd, 0x5a, 0x08,
+	0x59, 0xe3, 0x59, 0xd8, 0x59, 0xf9, 0x5a, 0x0c, 0x5a, 0x09, 0x5a, 0x32,
+	0x5a, 0x34, 0x5a, 0x11, 0x5a, 0x23, 0x5a, 0x13, 0x5a, 0x40, 0x5a, 0x67,
+	0x5a, 0x4a, 0x5a, 0x55, 0x5a, 0x3c, 0x5a, 0x62, 0x5a, 0x75, 0x80, 0xec,
+	0x5a, 0xaa, 0x5a, 0x9b, 0x5a, 0x77, 0x5a, 0x7a, 0x5a, 0xbe, 0x5a, 0xeb,
+	0x5a, 0xb2, 0x5a, 0xd2, 0x5a, 0xd4, 0x5a, 0xb8, 0x5a, 0xe0, 0x5a, 0xe3,
+	0x5a, 0xf1, 0x5a, 0xd6, 0x5a, 0xe6, 0x5a, 0xd8, 0x5a, 0xdc, 0x5b, 0x09,
+	0x5b, 0x17, 0x5b, 0x16, 0x5b, 0x32, 0x5b, 0x37, 0x5b, 0x40, 0x5c, 0x15,
+	0x5c, 0x1c, 0x5b, 0x5a, 0x5b, 0x65, 0x5b, 0x73, 0x5b, 0x51, 0x5b, 0x53,
+	0x5b, 0x62, 0x9a, 0x75, 0x9a, 0x77, 0x9a, 0x78, 0x9a, 0x7a, 0x9a, 0x7f,
+	0x9a, 0x7d, 0x9a, 0x80, 0x9a, 0x81, 0x9a, 0x85, 0x9a, 0x88, 0x9a, 0x8a,
+	0x9a, 0x90, 0x9a, 0x92, 0x9a, 0x93, 0x9a, 0x96, 0x9a, 0x98, 0x9a, 0x9b,
+	0x9a, 0x9c, 0x9a, 0x9d, 0x9a, 0x9f, 0x9a, 0xa0, 0x9a, 0xa2, 0x9a, 0xa3,
+	0x9a, 0xa5, 0x9a, 0xa7, 0x7e, 0x9f, 0x7e, 0xa1, 0x7e, 0xa3, 0x7e, 0xa5,
+	0x7e, 0xa8, 0x7e, 0xa9, 0x93, 0xce, 0x93, 0xcf, 0x93, 0xd0, 0x93, 0xd1,
+	0x93, 0xd2, 0x93, 0xd3, 0x93, 0xd4, 0x93, 0xd5, 0x93, 0xd7, 0x93, 0xd8,
+	0x93, 0xd9, 0x93, 0xda, 0x93, 0xdb, 0x93, 0xdc, 0x93, 0xdd, 0x93, 0xde,
+	0x93, 0xdf, 0x93, 0xe0, 0x93, 0xe1, 0x93, 0xe2, 0x93, 0xe3, 0x93, 0xe4,
+	0x93, 0xe5, 0x93, 0xe6, 0x93, 0xe7, 0x93, 0xe8, 0x93, 0xe9, 0x93, 0xea,
+	0x93, 0xeb, 0x93, 0xec, 0x93, 0xed, 0x93, 0xee, 0x93, 0xef, 0x93, 0xf0,
+	0x93, 0xf1, 0x93, 0xf2, 0x93, 0xf3, 0x93, 0xf4, 0x93, 0xf5, 0x93, 0xf6,
+	0x93, 0xf7, 0x93, 0xf8, 0x93, 0xf9, 0x93, 0xfa, 0x93, 0xfb, 0x93, 0xfc,
+	0x93, 0xfd, 0x93, 0xfe, 0x93, 0xff, 0x94, 0x00, 0x94, 0x01, 0x94, 0x02,
+	0x94, 0x03, 0x94, 0x04, 0x94, 0x05, 0x94, 0x06, 0x94, 0x07, 0x94, 0x08,
+	0x94, 0x09, 0x94, 0x0a, 0x94, 0x0b, 0x94, 0x0c, 0x94, 0x0d, 0x94, 0x0e,
+	0x94, 0x0f, 0x94, 0x10, 0x94, 0x11, 0x94, 0x12, 0x94, 0x13, 0x94, 0x14,
+	0x94, 0x15, 0x94, 0x16, 0x94, 0x17, 0x94, 0x18, 0x94, 0x19, 0x94, 0x1a,
+	0x94, 0x1b, 0x94, 0x1c, 0x94, 0x1d, 0x94, 0x1e, 0x94, 0x1f, 0x94, 0x20,
+	0x94, 0x21, 0x94, 0x22, 0x94, 0x23, 0x94, 0x24, 0x94, 0x25, 0x94, 0x26,
+	0x94, 0x27, 0x94, 0x28, 0x94, 0x29, 0x94, 0x2a, 0x94, 0x2b, 0x94, 0x2c,
+	0x94, 0x2d, 0x94, 0x2e, 0x7e, 0xad, 0x7e, 0xb0, 0x7e, 0xbe, 0x7e, 0xc0,
+	0x7e, 0xc1, 0x7e, 0xc2, 0x7e, 0xc9, 0x7e, 0xcb, 0x7e, 0xcc, 0x7e, 0xd0,
+	0x7e, 0xd4, 0x7e, 0xd7, 0x7e, 0xdb, 0x7e, 0xe0, 0x7e, 0xe1, 0x7e, 0xe8,
+	0x7e, 0xeb, 0x7e, 0xee, 0x7e, 0xef, 0x7e, 0xf1, 0x7e, 0xf2, 0x7f, 0x0d,
+	0x7e, 0xf6, 0x7e, 0xfa, 0x7e, 0xfb, 0x7e, 0xfe, 0x7f, 0x01, 0x7f, 0x02,
+	0x7f, 0x03, 0x7f, 0x07, 0x7f, 0x08, 0x7f, 0x0b, 0x7f, 0x0c, 0x7f, 0x0f,
+	0x7f, 0x11, 0x7f, 0x12, 0x7f, 0x17, 0x7f, 0x19, 0x7f, 0x1c, 0x7f, 0x1b,
+	0x7f, 0x1f, 0x7f, 0x21, 0x7f, 0x22, 0x7f, 0x23, 0x7f, 0x24, 0x7f, 0x25,
+	0x7f, 0x26, 0x7f, 0x27, 0x7f, 0x2a, 0x7f, 0x2b, 0x7f, 0x2c, 0x7f, 0x2d,
+	0x7f, 0x2f, 0x7f, 0x30, 0x7f, 0x31, 0x7f, 0x32, 0x7f, 0x33, 0x7f, 0x35,
+	0x5e, 0x7a, 0x75, 0x7f, 0x5d, 0xdb, 0x75, 0x3e, 0x90, 0x95, 0x73, 0x8e,
+	0x73, 0x91, 0x73, 0xae, 0x73, 0xa2, 0x73, 0x9f, 0x73, 0xcf, 0x73, 0xc2,
+	0x73, 0xd1, 0x73, 0xb7, 0x73, 0xb3, 0x73, 0xc0, 0x73, 0xc9, 0x73, 0xc8,
+	0x73, 0xe5, 0x73, 0xd9, 0x98, 0x7c, 0x74, 0x0a, 0x73, 0xe9, 0x73, 0xe7,
+	0x73, 0xde, 0x73, 0xba, 0x73, 0xf2, 0x74, 0x0f, 0x74, 0x2a, 0x74, 0x5b,
+	0x74, 0x26, 0x74, 0x25, 0x74, 0x28, 0x74, 0x30, 0x74, 0x2e, 0x74, 0x2c,
+	0x94, 0x2f, 0x94, 0x30, 0x94, 0x31, 0x94, 0x32, 0x94, 0x33, 0x94, 0x34,
+	0x94, 0x35, 0x94, 0x36, 0x94, 0x37, 0x94, 0x38, 0x94, 0x39, 0x94, 0x3a,
+	0x94, 0x3b, 0x94, 0x3c, 0x94, 0x3d, 0x94, 0x3f, 0x94, 0x40, 0x94, 0x41,
+	0x94, 0x42, 0x94, 0x43, 0x94, 0x44, 0x94, 0x45, 0x94, 0x46, 0x94, 0x47,
+	0x94, 0x48, 0x94, 0x49, 0x94, 0x4a, 0x94, 0x4b, 0x94, 0x4c, 0x94, 0x4d,
+	0x94, 0x4e, 0x94, 0x4f, 0x94, 0x50, 0x94, 0x51, 0x94, 0x52, 0x94, 0x53,
+	0x94, 0x54, 0x94, 0x55, 0x94, 0x56, 0x94, 0x57, 0x94, 0x58, 0x94, 0x59,
+	0x94, 0x5a, 0x94, 0x5b, 0x94, 0x5c, 0x94, 0x5d, 0x94, 0x5e, 0x94, 0x5f,
+	0x94, 0x60, 0x94, 0x61, 0x94, 0x62, 0x94, 0x63, 0x94, 0x64, 0x94, 0x65,
+	0x94, 0x66, 0x94, 0x67, 0x94, 0x68, 0x94, 0x69, 0x94, 0x6a, 0x94, 0x6c,
+	0x94, 0x6d, 0x94, 0x6e, 0x94, 0x6f, 0x94, 0x70, 0x94, 0x71, 0x94, 0x72,
+	0x94, 0x73, 0x94, 0x74, 0x94, 0x75, 0x94, 0x76, 0x94, 0x77, 0x94, 0x78,
+	0x94, 0x79, 0x94, 0x7a, 0x94, 0x7b, 0x94, 0x7c, 0x94, 0x7d, 0x94, 0x7e,
+	0x94, 0x7f, 0x94, 0x80, 0x94, 0x81, 0x94, 0x82, 0x94, 0x83, 0x94, 0x84,
+	0x94, 0x91, 0x94, 0x96, 0x94, 0x98, 0x94, 0xc7, 0x94, 0xcf, 0x94, 0xd3,
+	0x94, 0xd4, 0x94, 0xda, 0x94, 0xe6, 0x94, 0xfb, 0x95, 0x1c, 0x95, 0x20,
+	0x74, 0x1b, 0x74, 0x1a, 0x74, 0x41, 0x74, 0x5c, 0x74, 0x57, 0x74, 0x55,
+	0x74, 0x59, 0x74, 0x77, 0x74, 0x6d, 0x74, 0x7e, 0x74, 0x9c, 0x74, 0x8e,
+	0x74, 0x80, 0x74, 0x81, 0x74, 0x87, 0x74, 0x8b, 0x74, 0x9e, 0x74, 0xa8,
+	0x74, 0xa9, 0x74, 0x90, 0x74, 0xa7, 0x74, 0xd2, 0x74, 0xba, 0x97, 0xea,
+	0x97, 0xeb, 0x97, 0xec, 0x67, 0x4c, 0x67, 0x53, 0x67, 0x5e, 0x67, 0x48,
+	0x67, 0x69, 0x67, 0xa5, 0x67, 0x87, 0x67, 0x6a, 0x67, 0x73, 0x67, 0x98,
+	0x67, 0xa7, 0x67, 0x75, 0x67, 0xa8, 0x67, 0x9e, 0x67, 0xad, 0x67, 0x8b,
+	0x67, 0x77, 0x67, 0x7c, 0x67, 0xf0, 0x68, 0x09, 0x67, 0xd8, 0x68, 0x0a,
+	0x67, 0xe9, 0x67, 0xb0, 0x68, 0x0c, 0x67, 0xd9, 0x67, 0xb5, 0x67, 0xda,
+	0x67, 0xb3, 0x67, 0xdd, 0x68, 0x00, 0x67, 0xc3, 0x67, 0xb8, 0x67, 0xe2,
+	0x68, 0x0e, 0x67, 0xc1, 0x67, 0xfd, 0x68, 0x32, 0x68, 0x33, 0x68, 0x60,
+	0x68, 0x61, 0x68, 0x4e, 0x68, 0x62, 0x68, 0x44, 0x68, 0x64, 0x68, 0x83,
+	0x68, 0x1d, 0x68, 0x55, 0x68, 0x66, 0x68, 0x41, 0x68, 0x67, 0x68, 0x40,
+	0x68, 0x3e, 0x68, 0x4a, 0x68, 0x49, 0x68, 0x29, 0x68, 0xb5, 0x68, 0x8f,
+	0x68, 0x74, 0x68, 0x77, 0x68, 0x93, 0x68, 0x6b, 0x68, 0xc2, 0x69, 0x6e,
+	0x68, 0xfc, 0x69, 0x1f, 0x69, 0x20, 0x68, 0xf9, 0x95, 0x27, 0x95, 0x33,
+	0x95, 0x3d, 0x95, 0x43, 0x95, 0x48, 0x95, 0x4b, 0x95, 0x55, 0x95, 0x5a,
+	0x95, 0x60, 0x95, 0x6e, 0x95, 0x74, 0x95, 0x75, 0x95, 0x77, 0x95, 0x78,
+	0x95, 0x79, 0x95, 0x7a, 0x95, 0x7b, 0x95, 0x7c, 0x95, 0x7d, 0x95, 0x7e,
+	0x95, 0x80, 0x95, 0x81, 0x95, 0x82, 0x95, 0x83, 0x95, 0x84, 0x95, 0x85,
+	0x95, 0x86, 0x95, 0x87, 0x95, 0x88, 0x95, 0x89, 0x95, 0x8a, 0x95, 0x8b,
+	0x95, 0x8c, 0x95, 0x8d, 0x95, 0x8e, 0x95, 0x8f, 0x95, 0x90, 0x95, 0x91,
+	0x95, 0x92, 0x95, 0x93, 0x95, 0x94, 0x95, 0x95, 0x95, 0x96, 0x95, 0x97,
+	0x95, 0x98, 0x95, 0x99, 0x95, 0x9a, 0x95, 0x9b, 0x95, 0x9c, 0x95, 0x9d,
+	0x95, 0x9e, 0x95, 0x9f, 0x95, 0xa0, 0x95, 0xa1, 0x95, 0xa2, 0x95, 0xa3,
+	0x95, 0xa4, 0x95, 0xa5, 0x95, 0xa6, 0x95, 0xa7, 0x95, 0xa8, 0x95, 0xa9,
+	0x95, 0xaa, 0x95, 0xab, 0x95, 0xac, 0x95, 0xad, 0x95, 0xae, 0x95, 0xaf,
+	0x95, 0xb0, 0x95, 0xb1, 0x95, 0xb2, 0x95, 0xb3, 0x95, 0xb4, 0x95, 0xb5,
+	0x95, 0xb6, 0x95, 0xb7, 0x95, 0xb8, 0x95, 0xb9, 0x95, 0xba, 0x95, 0xbb,
+	0x95, 0xbc, 0x95, 0xbd, 0x95, 0xbe, 0x95, 0xbf, 0x95, 0xc0, 0x95, 0xc1,
+	0x95, 0xc2, 0x95, 0xc3, 0x95, 0xc4, 0x95, 0xc5, 0x95, 0xc6, 0x95, 0xc7,
+	0x95, 0xc8, 0x95, 0xc9, 0x95, 0xca, 0x95, 0xcb, 0x69, 0x24, 0x68, 0xf0,
+	0x69, 0x0b, 0x69, 0x01, 0x69, 0x57, 0x68, 0xe3, 0x69, 0x10, 0x69, 0x71,
+	0x69, 0x39, 0x69, 0x60, 0x69, 0x42, 0x69, 0x5d, 0x69, 0x84, 0x69, 0x6b,
+	0x69, 0x80, 0x69, 0x98, 0x69, 0x78, 0x69, 0x34, 0x69, 0xcc, 0x69, 0x87,
+	0x69, 0x88, 0x69, 0xce, 0x69, 0x89, 0x69, 0x66, 0x69, 0x63, 0x69, 0x79,
+	0x69, 0x9b, 0x69, 0xa7, 0x69, 0xbb, 0x69, 0xab, 0x69, 0xad, 0x69, 0xd4,
+	0x69, 0xb1, 0x69, 0xc1, 0x69, 0xca, 0x69, 0xdf, 0x69, 0x95, 0x69, 0xe0,
+	0x69, 0x8d, 0x69, 0xff, 0x6a, 0x2f, 0x69, 0xed, 0x6a, 0x17, 0x6a, 0x18,
+	0x6a, 0x65, 0x69, 0xf2, 0x6a, 0x44, 0x6a, 0x3e, 0x6a, 0xa0, 0x6a, 0x50,
+	0x6a, 0x5b, 0x6a, 0x35, 0x6a, 0x8e, 0x6a, 0x79, 0x6a, 0x3d, 0x6a, 0x28,
+	0x6a, 0x58, 0x6a, 0x7c, 0x6a, 0x91, 0x6a, 0x90, 0x6a, 0xa9, 0x6a, 0x97,
+	0x6a, 0xab, 0x73, 0x37, 0x73, 0x52, 0x6b, 0x81, 0x6b, 0x82, 0x6b, 0x87,
+	0x6b, 0x84, 0x6b, 0x92, 0x6b, 0x93, 0x6b, 0x8d, 0x6b, 0x9a, 0x6b, 0x9b,
+	0x6b, 0xa1, 0x6b, 0xaa, 0x8f, 0x6b, 0x8f, 0x6d, 0x8f, 0x71, 0x8f, 0x72,
+	0x8f, 0x73, 0x8f, 0x75, 0x8f, 0x76, 0x8f, 0x78, 0x8f, 0x77, 0x8f, 0x79,
+	0x8f, 0x7a, 0x8f, 0x7c, 0x8f, 0x7e, 0x8f, 0x81, 0x8f, 0x82, 0x8f, 0x84,
+	0x8f, 0x87, 0x8f, 0x8b, 0x95, 0xcc, 0x95, 0xcd, 0x95, 0xce, 0x95, 0xcf,
+	0x95, 0xd0, 0x95, 0xd1, 0x95, 0xd2, 0x95, 0xd3, 0x95, 0xd4, 0x95, 0xd5,
+	0x95, 0xd6, 0x95, 0xd7, 0x95, 0xd8, 0x95, 0xd9, 0x95, 0xda, 0x95, 0xdb,
+	0x95, 0xdc, 0x95, 0xdd, 0x95, 0xde, 0x95, 0xdf, 0x95, 0xe0, 0x95, 0xe1,
+	0x95, 0xe2, 0x95, 0xe3, 0x95, 0xe4, 0x95, 0xe5, 0x95, 0xe6, 0x95, 0xe7,
+	0x95, 0xec, 0x95, 0xff, 0x96, 0x07, 0x96, 0x13, 0x96, 0x18, 0x96, 0x1b,
+	0x96, 0x1e, 0x96, 0x20, 0x96, 0x23, 0x96, 0x24, 0x96, 0x25, 0x96, 0x26,
+	0x96, 0x27, 0x96, 0x28, 0x96, 0x29, 0x96, 0x2b, 0x96, 0x2c, 0x96, 0x2d,
+	0x96, 0x2f, 0x96, 0x30, 0x96, 0x37, 0x96, 0x38, 0x96, 0x39, 0x96, 0x3a,
+	0x96, 0x3e, 0x96, 0x41, 0x96, 0x43, 0x96, 0x4a, 0x96, 0x4e, 0x96, 0x4f,
+	0x96, 0x51, 0x96, 0x52, 0x96, 0x53, 0x96, 0x56, 0x96, 0x57, 0x96, 0x58,
+	0x96, 0x59, 0x96, 0x5a, 0x96, 0x5c, 0x96, 0x5d, 0x96, 0x5e, 0x96, 0x60,
+	0x96, 0x63, 0x96, 0x65, 0x96, 0x66, 0x96, 0x6b, 0x96, 0x6d, 0x96, 0x6e,
+	0x96, 0x6f, 0x96, 0x70, 0x96, 0x71, 0x96, 0x73, 0x96, 0x78, 0x96, 0x79,
+	0x96, 0x7a, 0x96, 0x7b, 0x96, 0x7c, 0x96, 0x7d, 0x96, 0x7e, 0x96, 0x7f,
+	0x96, 0x80, 0x96, 0x81, 0x96, 0x82, 0x96, 0x83, 0x96, 0x84, 0x96, 0x87,
+	0x96, 0x89, 0x96, 0x8a, 0x8f, 0x8d, 0x8f, 0x8e, 0x8f, 0x8f, 0x8f, 0x98,
+	0x8f, 0x9a, 0x8e, 0xce, 0x62, 0x0b, 0x62, 0x17, 0x62, 0x1b, 0x62, 0x1f,
+	0x62, 0x22, 0x62, 0x21, 0x62, 0x25, 0x62, 0x24, 0x62, 0x2c, 0x81, 0xe7,
+	0x74, 0xef, 0x74, 0xf4, 0x74, 0xff, 0x75, 0x0f, 0x75, 0x11, 0x75, 0x13,
+	0x65, 0x34, 0x65, 0xee, 0x65, 0xef, 0x65, 0xf0, 0x66, 0x0a, 0x66, 0x19,
+	0x67, 0x72, 0x66, 0x03, 0x66, 0x15, 0x66, 0x00, 0x70, 0x85, 0x66, 0xf7,
+	0x66, 0x1d, 0x66, 0x34, 0x66, 0x31, 0x66, 0x36, 0x66, 0x35, 0x80, 0x06,
+	0x66, 0x5f, 0x66, 0x54, 0x66, 0x41, 0x66, 0x4f, 0x66, 0x56, 0x66, 0x61,
+	0x66, 0x57, 0x66, 0x77, 0x66, 0x84, 0x66, 0x8c, 0x66, 0xa7, 0x66, 0x9d,
+	0x66, 0xbe, 0x66, 0xdb, 0x66, 0xdc, 0x66, 0xe6, 0x66, 0xe9, 0x8d, 0x32,
+	0x8d, 0x33, 0x8d, 0x36, 0x8d, 0x3b, 0x8d, 0x3d, 0x8d, 0x40, 0x8d, 0x45,
+	0x8d, 0x46, 0x8d, 0x48, 0x8d, 0x49, 0x8d, 0x47, 0x8d, 0x4d, 0x8d, 0x55,
+	0x8d, 0x59, 0x89, 0xc7, 0x89, 0xca, 0x89, 0xcb, 0x89, 0xcc, 0x89, 0xce,
+	0x89, 0xcf, 0x89, 0xd0, 0x89, 0xd1, 0x72, 0x6e, 0x72, 0x9f, 0x72, 0x5d,
+	0x72, 0x66, 0x72, 0x6f, 0x72, 0x7e, 0x72, 0x7f, 0x72, 0x84, 0x72, 0x8b,
+	0x72, 0x8d, 0x72, 0x8f, 0x72, 0x92, 0x63, 0x08, 0x63, 0x32, 0x63, 0xb0,
+	0x96, 0x8c, 0x96, 0x8e, 0x96, 0x91, 0x96, 0x92, 0x96, 0x93, 0x96, 0x95,
+	0x96, 0x96, 0x96, 0x9a, 0x96, 0x9b, 0x96, 0x9d, 0x96, 0x9e, 0x96, 0x9f,
+	0x96, 0xa0, 0x96, 0xa1, 0x96, 0xa2, 0x96, 0xa3, 0x96, 0xa4, 0x96, 0xa5,
+	0x96, 0xa6, 0x96, 0xa8, 0x96, 0xa9, 0x96, 0xaa, 0x96, 0xab, 0x96, 0xac,
+	0x96, 0xad, 0x96, 0xae, 0x96, 0xaf, 0x96, 0xb1, 0x96, 0xb2, 0x96, 0xb4,
+	0x96, 0xb5, 0x96, 0xb7, 0x96, 0xb8, 0x96, 0xba, 0x96, 0xbb, 0x96, 0xbf,
+	0x96, 0xc2, 0x96, 0xc3, 0x96, 0xc8, 0x96, 0xca, 0x96, 0xcb, 0x96, 0xd0,
+	0x96, 0xd1, 0x96, 0xd3, 0x96, 0xd4, 0x96, 0xd6, 0x96, 0xd7, 0x96, 0xd8,
+	0x96, 0xd9, 0x96, 0xda, 0x96, 0xdb, 0x96, 0xdc, 0x96, 0xdd, 0x96, 0xde,
+	0x96, 0xdf, 0x96, 0xe1, 0x96, 0xe2, 0x96, 0xe3, 0x96, 0xe4, 0x96, 0xe5,
+	0x96, 0xe6, 0x96, 0xe7, 0x96, 0xeb, 0x96, 0xec, 0x96, 0xed, 0x96, 0xee,
+	0x96, 0xf0, 0x96, 0xf1, 0x96, 0xf2, 0x96, 0xf4, 0x96, 0xf5, 0x96, 0xf8,
+	0x96, 0xfa, 0x96, 0xfb, 0x96, 0xfc, 0x96, 0xfd, 0x96, 0xff, 0x97, 0x02,
+	0x97, 0x03, 0x97, 0x05, 0x97, 0x0a, 0x97, 0x0b, 0x97, 0x0c, 0x97, 0x10,
+	0x97, 0x11, 0x97, 0x12, 0x97, 0x14, 0x97, 0x15, 0x97, 0x17, 0x97, 0x18,
+	0x97, 0x19, 0x97, 0x1a, 0x97, 0x1b, 0x97, 0x1d, 0x97, 0x1f, 0x97, 0x20,
+	0x64, 0x3f, 0x64, 0xd8, 0x80, 0x04, 0x6b, 0xea, 0x6b, 0xf3, 0x6b, 0xfd,
+	0x6b, 0xf5, 0x6b, 0xf9, 0x6c, 0x05, 0x6c, 0x07, 0x6c, 0x06, 0x6c, 0x0d,
+	0x6c, 0x15, 0x6c, 0x18, 0x6c, 0x19, 0x6c, 0x1a, 0x6c, 0x21, 0x6c, 0x29,
+	0x6c, 0x24, 0x6c, 0x2a, 0x6c, 0x32, 0x65, 0x35, 0x65, 0x55, 0x65, 0x6b,
+	0x72, 0x4d, 0x72, 0x52, 0x72, 0x56, 0x72, 0x30, 0x86, 0x62, 0x52, 0x16,
+	0x80, 0x9f, 0x80, 0x9c, 0x80, 0x93, 0x80, 0xbc, 0x67, 0x0a, 0x80, 0xbd,
+	0x80, 0xb1, 0x80, 0xab, 0x80, 0xad, 0x80, 0xb4, 0x80, 0xb7, 0x80, 0xe7,
+	0x80, 0xe8, 0x80, 0xe9, 0x80, 0xea, 0x80, 0xdb, 0x80, 0xc2, 0x80, 0xc4,
+	0x80, 0xd9, 0x80, 0xcd, 0x80, 0xd7, 0x67, 0x10, 0x80, 0xdd, 0x80, 0xeb,
+	0x80, 0xf1, 0x80, 0xf4, 0x80, 0xed, 0x81, 0x0d, 0x81, 0x0e, 0x80, 0xf2,
+	0x80, 0xfc, 0x67, 0x15, 0x81, 0x12, 0x8c, 0x5a, 0x81, 0x36, 0x81, 0x1e,
+	0x81, 0x2c, 0x81, 0x18, 0x81, 0x32, 0x81, 0x48, 0x81, 0x4c, 0x81, 0x53,
+	0x81, 0x74, 0x81, 0x59, 0x81, 0x5a, 0x81, 0x71, 0x81, 0x60, 0x81, 0x69,
+	0x81, 0x7c, 0x81, 0x7d, 0x81, 0x6d, 0x81, 0x67, 0x58, 0x4d, 0x5a, 0xb5,
+	0x81, 0x88, 0x81, 0x82, 0x81, 0x91, 0x6e, 0xd5, 0x81, 0xa3, 0x81, 0xaa,
+	0x81, 0xcc, 0x67, 0x26, 0x81, 0xca, 0x81, 0xbb, 0x97, 0x21, 0x97, 0x22,
+	0x97, 0x23, 0x97, 0x24, 0x97, 0x25, 0x97, 0x26, 0x97, 0x27, 0x97, 0x28,
+	0x97, 0x29, 0x97, 0x2b, 0x97, 0x2c, 0x97, 0x2e, 0x97, 0x2f, 0x97, 0x31,
+	0x97, 0x33, 0x97, 0x34, 0x97, 0x35, 0x97, 0x36, 0x97, 0x37, 0x97, 0x3a,
+	0x97, 0x3b, 0x97, 0x3c, 0x97, 0x3d, 0x97, 0x3f, 0x97, 0x40, 0x97, 0x41,
+	0x97, 0x42, 0x97, 0x43, 0x97, 0x44, 0x97, 0x45, 0x97, 0x46, 0x97, 0x47,
+	0x97, 0x48, 0x97, 0x49, 0x97, 0x4a, 0x97, 0x4b, 0x97, 0x4c, 0x97, 0x4d,
+	0x97, 0x4e, 0x97, 0x4f, 0x97, 0x50, 0x97, 0x51, 0x97, 0x54, 0x97, 0x55,
+	0x97, 0x57, 0x97, 0x58, 0x97, 0x5a, 0x97, 0x5c, 0x97, 0x5d, 0x97, 0x5f,
+	0x97, 0x63, 0x97, 0x64, 0x97, 0x66, 0x97, 0x67, 0x97, 0x68, 0x97, 0x6a,
+	0x97, 0x6b, 0x97, 0x6c, 0x97, 0x6d, 0x97, 0x6e, 0x97, 0x6f, 0x97, 0x70,
+	0x97, 0x71, 0x97, 0x72, 0x97, 0x75, 0x97, 0x77, 0x97, 0x78, 0x97, 0x79,
+	0x97, 0x7a, 0x97, 0x7b, 0x97, 0x7d, 0x97, 0x7e, 0x97, 0x7f, 0x97, 0x80,
+	0x97, 0x81, 0x97, 0x82, 0x97, 0x83, 0x97, 0x84, 0x97, 0x86, 0x97, 0x87,
+	0x97, 0x88, 0x97, 0x89, 0x97, 0x8a, 0x97, 0x8c, 0x97, 0x8e, 0x97, 0x8f,
+	0x97, 0x90, 0x97, 0x93, 0x97, 0x95, 0x97, 0x96, 0x97, 0x97, 0x97, 0x99,
+	0x97, 0x9a, 0x97, 0x9b, 0x97, 0x9c, 0x97, 0x9d, 0x81, 0xc1, 0x81, 0xa6,
+	0x6b, 0x24, 0x6b, 0x37, 0x6b, 0x39, 0x6b, 0x43, 0x6b, 0x46, 0x6b, 0x59,
+	0x98, 0xd1, 0x98, 0xd2, 0x98, 0xd3, 0x98, 0xd5, 0x98, 0xd9, 0x98, 0xda,
+	0x6b, 0xb3, 0x5f, 0x40, 0x6b, 0xc2, 0x89, 0xf3, 0x65, 0x90, 0x9f, 0x51,
+	0x65, 0x93, 0x65, 0xbc, 0x65, 0xc6, 0x65, 0xc4, 0x65, 0xc3, 0x65, 0xcc,
+	0x65, 0xce, 0x65, 0xd2, 0x65, 0xd6, 0x70, 0x80, 0x70, 0x9c, 0x70, 0x96,
+	0x70, 0x9d, 0x70, 0xbb, 0x70, 0xc0, 0x70, 0xb7, 0x70, 0xab, 0x70, 0xb1,
+	0x70, 0xe8, 0x70, 0xca, 0x71, 0x10, 0x71, 0x13, 0x71, 0x16, 0x71, 0x2f,
+	0x71, 0x31, 0x71, 0x73, 0x71, 0x5c, 0x71, 0x68, 0x71, 0x45, 0x71, 0x72,
+	0x71, 0x4a, 0x71, 0x78, 0x71, 0x7a, 0x71, 0x98, 0x71, 0xb3, 0x71, 0xb5,
+	0x71, 0xa8, 0x71, 0xa0, 0x71, 0xe0, 0x71, 0xd4, 0x71, 0xe7, 0x71, 0xf9,
+	0x72, 0x1d, 0x72, 0x28, 0x70, 0x6c, 0x71, 0x18, 0x71, 0x66, 0x71, 0xb9,
+	0x62, 0x3e, 0x62, 0x3d, 0x62, 0x43, 0x62, 0x48, 0x62, 0x49, 0x79, 0x3b,
+	0x79, 0x40, 0x79, 0x46, 0x79, 0x49, 0x79, 0x5b, 0x79, 0x5c, 0x79, 0x53,
+	0x79, 0x5a, 0x79, 0x62, 0x79, 0x57, 0x79, 0x60, 0x79, 0x6f, 0x79, 0x67,
+	0x79, 0x7a, 0x79, 0x85, 0x79, 0x8a, 0x79, 0x9a, 0x79, 0xa7, 0x79, 0xb3,
+	0x5f, 0xd1, 0x5f, 0xd0, 0x97, 0x9e, 0x97, 0x9f, 0x97, 0xa1, 0x97, 0xa2,
+	0x97, 0xa4, 0x97, 0xa5, 0x97, 0xa6, 0x97, 0xa7, 0x97, 0xa8, 0x97, 0xa9,
+	0x97, 0xaa, 0x97, 0xac, 0x97, 0xae, 0x97, 0xb0, 0x97, 0xb1, 0x97, 0xb3,
+	0x97, 0xb5, 0x97, 0xb6, 0x97, 0xb7, 0x97, 0xb8, 0x97, 0xb9, 0x97, 0xba,
+	0x97, 0xbb, 0x97, 0xbc, 0x97, 0xbd, 0x97, 0xbe, 0x97, 0xbf, 0x97, 0xc0,
+	0x97, 0xc1, 0x97, 0xc2, 0x97, 0xc3, 0x97, 0xc4, 0x97, 0xc5, 0x97, 0xc6,
+	0x97, 0xc7, 0x97, 0xc8, 0x97, 0xc9, 0x97, 0xca, 0x97, 0xcb, 0x97, 0xcc,
+	0x97, 0xcd, 0x97, 0xce, 0x97, 0xcf, 0x97, 0xd0, 0x97, 0xd1, 0x97, 0xd2,
+	0x97, 0xd3, 0x97, 0xd4, 0x97, 0xd5, 0x97, 0xd6, 0x97, 0xd7, 0x97, 0xd8,
+	0x97, 0xd9, 0x97, 0xda, 0x97, 0xdb, 0x97, 0xdc, 0x97, 0xdd, 0x97, 0xde,
+	0x97, 0xdf, 0x97, 0xe0, 0x97, 0xe1, 0x97, 0xe2, 0x97, 0xe3, 0x97, 0xe4,
+	0x97, 0xe5, 0x97, 0xe8, 0x97, 0xee, 0x97, 0xef, 0x97, 0xf0, 0x97, 0xf1,
+	0x97, 0xf2, 0x97, 0xf4, 0x97, 0xf7, 0x97, 0xf8, 0x97, 0xf9, 0x97, 0xfa,
+	0x97, 0xfb, 0x97, 0xfc, 0x97, 0xfd, 0x97, 0xfe, 0x97, 0xff, 0x98, 0x00,
+	0x98, 0x01, 0x98, 0x02, 0x98, 0x03, 0x98, 0x04, 0x98, 0x05, 0x98, 0x06,
+	0x98, 0x07, 0x98, 0x08, 0x98, 0x09, 0x98, 0x0a, 0x98, 0x0b, 0x98, 0x0c,
+	0x98, 0x0d, 0x98, 0x0e, 0x60, 0x3c, 0x60, 0x5d, 0x60, 0x5a, 0x60, 0x67,
+	0x60, 0x41, 0x60, 0x59, 0x60, 0x63, 0x60, 0xab, 0x61, 0x06, 0x61, 0x0d,
+	0x61, 0x5d, 0x61, 0xa9, 0x61, 0x9d, 0x61, 0xcb, 0x61, 0xd1, 0x62, 0x06,
+	0x80, 0x80, 0x80, 0x7f, 0x6c, 0x93, 0x6c, 0xf6, 0x6d, 0xfc, 0x77, 0xf6,
+	0x77, 0xf8, 0x78, 0x00, 0x78, 0x09, 0x78, 0x17, 0x78, 0x18, 0x78, 0x11,
+	0x65, 0xab, 0x78, 0x2d, 0x78, 0x1c, 0x78, 0x1d, 0x78, 0x39, 0x78, 0x3a,
+	0x78, 0x3b, 0x78, 0x1f, 0x78, 0x3c, 0x78, 0x25, 0x78, 0x2c, 0x78, 0x23,
+	0x78, 0x29, 0x78, 0x4e, 0x78, 0x6d, 0x78, 0x56, 0x78, 0x57, 0x78, 0x26,
+	0x78, 0x50, 0x78, 0x47, 0x78, 0x4c, 0x78, 0x6a, 0x78, 0x9b, 0x78, 0x93,
+	0x78, 0x9a, 0x78, 0x87, 0x78, 0x9c, 0x78, 0xa1, 0x78, 0xa3, 0x78, 0xb2,
+	0x78, 0xb9, 0x78, 0xa5, 0x78, 0xd4, 0x78, 0xd9, 0x78, 0xc9, 0x78, 0xec,
+	0x78, 0xf2, 0x79, 0x05, 0x78, 0xf4, 0x79, 0x13, 0x79, 0x24, 0x79, 0x1e,
+	0x79, 0x34, 0x9f, 0x9b, 0x9e, 0xf9, 0x9e, 0xfb, 0x9e, 0xfc, 0x76, 0xf1,
+	0x77, 0x04, 0x77, 0x0d, 0x76, 0xf9, 0x77, 0x07, 0x77, 0x08, 0x77, 0x1a,
+	0x77, 0x22, 0x77, 0x19, 0x77, 0x2d, 0x77, 0x26, 0x77, 0x35, 0x77, 0x38,
+	0x77, 0x50, 0x77, 0x51, 0x77, 0x47, 0x77, 0x43, 0x77, 0x5a, 0x77, 0x68,
+	0x98, 0x0f, 0x98, 0x10, 0x98, 0x11, 0x98, 0x12, 0x98, 0x13, 0x98, 0x14,
+	0x98, 0x15, 0x98, 0x16, 0x98, 0x17, 0x98, 0x18, 0x98, 0x19, 0x98, 0x1a,
+	0x98, 0x1b, 0x98, 0x1c, 0x98, 0x1d, 0x98, 0x1e, 0x98, 0x1f, 0x98, 0x20,
+	0x98, 0x21, 0x98, 0x22, 0x98, 0x23, 0x98, 0x24, 0x98, 0x25, 0x98, 0x26,
+	0x98, 0x27, 0x98, 0x28, 0x98, 0x29, 0x98, 0x2a, 0x98, 0x2b, 0x98, 0x2c,
+	0x98, 0x2d, 0x98, 0x2e, 0x98, 0x2f, 0x98, 0x30, 0x98, 0x31, 0x98, 0x32,
+	0x98, 0x33, 0x98, 0x34, 0x98, 0x35, 0x98, 0x36, 0x98, 0x37, 0x98, 0x38,
+	0x98, 0x39, 0x98, 0x3a, 0x98, 0x3b, 0x98, 0x3c, 0x98, 0x3d, 0x98, 0x3e,
+	0x98, 0x3f, 0x98, 0x40, 0x98, 0x41, 0x98, 0x42, 0x98, 0x43, 0x98, 0x44,
+	0x98, 0x45, 0x98, 0x46, 0x98, 0x47, 0x98, 0x48, 0x98, 0x49, 0x98, 0x4a,
+	0x98, 0x4b, 0x98, 0x4c, 0x98, 0x4d, 0x98, 0x4e, 0x98, 0x4f, 0x98, 0x50,
+	0x98, 0x51, 0x98, 0x52, 0x98, 0x53, 0x98, 0x54, 0x98, 0x55, 0x98, 0x56,
+	0x98, 0x57, 0x98, 0x58, 0x98, 0x59, 0x98, 0x5a, 0x98, 0x5b, 0x98, 0x5c,
+	0x98, 0x5d, 0x98, 0x5e, 0x98, 0x5f, 0x98, 0x60, 0x98, 0x61, 0x98, 0x62,
+	0x98, 0x63, 0x98, 0x64, 0x98, 0x65, 0x98, 0x66, 0x98, 0x67, 0x98, 0x68,
+	0x98, 0x69, 0x98, 0x6a, 0x98, 0x6b, 0x98, 0x6c, 0x98, 0x6d, 0x98, 0x6e,
+	0x77, 0x62, 0x77, 0x65, 0x77, 0x7f, 0x77, 0x8d, 0x77, 0x7d, 0x77, 0x80,
+	0x77, 0x8c, 0x77, 0x91, 0x77, 0x9f, 0x77, 0xa0, 0x77, 0xb0, 0x77, 0xb5,
+	0x77, 0xbd, 0x75, 0x3a, 0x75, 0x40, 0x75, 0x4e, 0x75, 0x4b, 0x75, 0x48,
+	0x75, 0x5b, 0x75, 0x72, 0x75, 0x79, 0x75, 0x83, 0x7f, 0x58, 0x7f, 0x61,
+	0x7f, 0x5f, 0x8a, 0x48, 0x7f, 0x68, 0x7f, 0x74, 0x7f, 0x71, 0x7f, 0x79,
+	0x7f, 0x81, 0x7f, 0x7e, 0x76, 0xcd, 0x76, 0xe5, 0x88, 0x32, 0x94, 0x85,
+	0x94, 0x86, 0x94, 0x87, 0x94, 0x8b, 0x94, 0x8a, 0x94, 0x8c, 0x94, 0x8d,
+	0x94, 0x8f, 0x94, 0x90, 0x94, 0x94, 0x94, 0x97, 0x94, 0x95, 0x94, 0x9a,
+	0x94, 0x9b, 0x94, 0x9c, 0x94, 0xa3, 0x94, 0xa4, 0x94, 0xab, 0x94, 0xaa,
+	0x94, 0xad, 0x94, 0xac, 0x94, 0xaf, 0x94, 0xb0, 0x94, 0xb2, 0x94, 0xb4,
+	0x94, 0xb6, 0x94, 0xb7, 0x94, 0xb8, 0x94, 0xb9, 0x94, 0xba, 0x94, 0xbc,
+	0x94, 0xbd, 0x94, 0xbf, 0x94, 0xc4, 0x94, 0xc8, 0x94, 0xc9, 0x94, 0xca,
+	0x94, 0xcb, 0x94, 0xcc, 0x94, 0xcd, 0x94, 0xce, 0x94, 0xd0, 0x94, 0xd1,
+	0x94, 0xd2, 0x94, 0xd5, 0x94, 0xd6, 0x94, 0xd7, 0x94, 0xd9, 0x94, 0xd8,
+	0x94, 0xdb, 0x94, 0xde, 0x94, 0xdf, 0x94, 0xe0, 0x94, 0xe2, 0x94, 0xe4,
+	0x94, 0xe5, 0x94, 0xe7, 0x94, 0xe8, 0x94, 0xea, 0x98, 0x6f, 0x98, 0x70,
+	0x98, 0x71, 0x98, 0x72, 0x98, 0x73, 0x98, 0x74, 0x98, 0x8b, 0x98, 0x8e,
+	0x98, 0x92, 0x98, 0x95, 0x98, 0x99, 0x98, 0xa3, 0x98, 0xa8, 0x98, 0xa9,
+	0x98, 0xaa, 0x98, 0xab, 0x98, 0xac, 0x98, 0xad, 0x98, 0xae, 0x98, 0xaf,
+	0x98, 0xb0, 0x98, 0xb1, 0x98, 0xb2, 0x98, 0xb3, 0x98, 0xb4, 0x98, 0xb5,
+	0x98, 0xb6, 0x98, 0xb7, 0x98, 0xb8, 0x98, 0xb9, 0x98, 0xba, 0x98, 0xbb,
+	0x98, 0xbc, 0x98, 0xbd, 0x98, 0xbe, 0x98, 0xbf, 0x98, 0xc0, 0x98, 0xc1,
+	0x98, 0xc2, 0x98, 0xc3, 0x98, 0xc4, 0x98, 0xc5, 0x98, 0xc6, 0x98, 0xc7,
+	0x98, 0xc8, 0x98, 0xc9, 0x98, 0xca, 0x98, 0xcb, 0x98, 0xcc, 0x98, 0xcd,
+	0x98, 0xcf, 0x98, 0xd0, 0x98, 0xd4, 0x98, 0xd6, 0x98, 0xd7, 0x98, 0xdb,
+	0x98, 0xdc, 0x98, 0xdd, 0x98, 0xe0, 0x98, 0xe1, 0x98, 0xe2, 0x98, 0xe3,
+	0x98, 0xe4, 0x98, 0xe5, 0x98, 0xe6, 0x98, 0xe9, 0x98, 0xea, 0x98, 0xeb,
+	0x98, 0xec, 0x98, 0xed, 0x98, 0xee, 0x98, 0xef, 0x98, 0xf0, 0x98, 0xf1,
+	0x98, 0xf2, 0x98, 0xf3, 0x98, 0xf4, 0x98, 0xf5, 0x98, 0xf6, 0x98, 0xf7,
+	0x98, 0xf8, 0x98, 0xf9, 0x98, 0xfa, 0x98, 0xfb, 0x98, 0xfc, 0x98, 0xfd,
+	0x98, 0xfe, 0x98, 0xff, 0x99, 0x00, 0x99, 0x01, 0x99, 0x02, 0x99, 0x03,
+	0x99, 0x04, 0x99, 0x05, 0x99, 0x06, 0x99, 0x07, 0x94, 0xe9, 0x94, 0xeb,
+	0x94, 0xee, 0x94, 0xef, 0x94, 0xf3, 0x94, 0xf4, 0x94, 0xf5, 0x94, 0xf7,
+	0x94, 0xf9, 0x94, 0xfc, 0x94, 0xfd, 0x94, 0xff, 0x95, 0x03, 0x95, 0x02,
+	0x95, 0x06, 0x95, 0x07, 0x95, 0x09, 0x95, 0x0a, 0x95, 0x0d, 0x95, 0x0e,
+	0x95, 0x0f, 0x95, 0x12, 0x95, 0x13, 0x95, 0x14, 0x95, 0x15, 0x95, 0x16,
+	0x95, 0x18, 0x95, 0x1b, 0x95, 0x1d, 0x95, 0x1e, 0x95, 0x1f, 0x95, 0x22,
+	0x95, 0x2a, 0x95, 0x2b, 0x95, 0x29, 0x95, 0x2c, 0x95, 0x31, 0x95, 0x32,
+	0x95, 0x34, 0x95, 0x36, 0x95, 0x37, 0x95, 0x38, 0x95, 0x3c, 0x95, 0x3e,
+	0x95, 0x3f, 0x95, 0x42, 0x95, 0x35, 0x95, 0x44, 0x95, 0x45, 0x95, 0x46,
+	0x95, 0x49, 0x95, 0x4c, 0x95, 0x4e, 0x95, 0x4f, 0x95, 0x52, 0x95, 0x53,
+	0x95, 0x54, 0x95, 0x56, 0x95, 0x57, 0x95, 0x58, 0x95, 0x59, 0x95, 0x5b,
+	0x95, 0x5e, 0x95, 0x5f, 0x95, 0x5d, 0x95, 0x61, 0x95, 0x62, 0x95, 0x64,
+	0x95, 0x65, 0x95, 0x66, 0x95, 0x67, 0x95, 0x68, 0x95, 0x69, 0x95, 0x6a,
+	0x95, 0x6b, 0x95, 0x6c, 0x95, 0x6f, 0x95, 0x71, 0x95, 0x72, 0x95, 0x73,
+	0x95, 0x3a, 0x77, 0xe7, 0x77, 0xec, 0x96, 0xc9, 0x79, 0xd5, 0x79, 0xed,
+	0x79, 0xe3, 0x79, 0xeb, 0x7a, 0x06, 0x5d, 0x47, 0x7a, 0x03, 0x7a, 0x02,
+	0x7a, 0x1e, 0x7a, 0x14, 0x99, 0x08, 0x99, 0x09, 0x99, 0x0a, 0x99, 0x0b,
+	0x99, 0x0c, 0x99, 0x0e, 0x99, 0x0f, 0x99, 0x11, 0x99, 0x12, 0x99, 0x13,
+	0x99, 0x14, 0x99, 0x15, 0x99, 0x16, 0x99, 0x17, 0x99, 0x18, 0x99, 0x19,
+	0x99, 0x1a, 0x99, 0x1b, 0x99, 0x1c, 0x99, 0x1d, 0x99, 0x1e, 0x99, 0x1f,
+	0x99, 0x20, 0x99, 0x21, 0x99, 0x22, 0x99, 0x23, 0x99, 0x24, 0x99, 0x25,
+	0x99, 0x26, 0x99, 0x27, 0x99, 0x28, 0x99, 0x29, 0x99, 0x2a, 0x99, 0x2b,
+	0x99, 0x2c, 0x99, 0x2d, 0x99, 0x2f, 0x99, 0x30, 0x99, 0x31, 0x99, 0x32,
+	0x99, 0x33, 0x99, 0x34, 0x99, 0x35, 0x99, 0x36, 0x99, 0x37, 0x99, 0x38,
+	0x99, 0x39, 0x99, 0x3a, 0x99, 0x3b, 0x99, 0x3c, 0x99, 0x3d, 0x99, 0x3e,
+	0x99, 0x3f, 0x99, 0x40, 0x99, 0x41, 0x99, 0x42, 0x99, 0x43, 0x99, 0x44,
+	0x99, 0x45, 0x99, 0x46, 0x99, 0x47, 0x99, 0x48, 0x99, 0x49, 0x99, 0x4a,
+	0x99, 0x4b, 0x99, 0x4c, 0x99, 0x4d, 0x99, 0x4e, 0x99, 0x4f, 0x99, 0x50,
+	0x99, 0x51, 0x99, 0x52, 0x99, 0x53, 0x99, 0x56, 0x99, 0x57, 0x99, 0x58,
+	0x99, 0x59, 0x99, 0x5a, 0x99, 0x5b, 0x99, 0x5c, 0x99, 0x5d, 0x99, 0x5e,
+	0x99, 0x5f, 0x99, 0x60, 0x99, 0x61, 0x99, 0x62, 0x99, 0x64, 0x99, 0x66,
+	0x99, 0x73, 0x99, 0x78, 0x99, 0x79, 0x99, 0x7b, 0x99, 0x7e, 0x99, 0x82,
+	0x99, 0x83, 0x99, 0x89, 0x7a, 0x39, 0x7a, 0x37, 0x7a, 0x51, 0x9e, 0xcf,
+	0x99, 0xa5, 0x7a, 0x70, 0x76, 0x88, 0x76, 0x8e, 0x76, 0x93, 0x76, 0x99,
+	0x76, 0xa4, 0x74, 0xde, 0x74, 0xe0, 0x75, 0x2c, 0x9e, 0x20, 0x9e, 0x22,
+	0x9e, 0x28, 0x9e, 0x29, 0x9e, 0x2a, 0x9e, 0x2b, 0x9e, 0x2c, 0x9e, 0x32,
+	0x9e, 0x31, 0x9e, 0x36, 0x9e, 0x38, 0x9e, 0x37, 0x9e, 0x39, 0x9e, 0x3a,
+	0x9e, 0x3e, 0x9e, 0x41, 0x9e, 0x42, 0x9e, 0x44, 0x9e, 0x46, 0x9e, 0x47,
+	0x9e, 0x48, 0x9e, 0x49, 0x9e, 0x4b, 0x9e, 0x4c, 0x9e, 0x4e, 0x9e, 0x51,
+	0x9e, 0x55, 0x9e, 0x57, 0x9e, 0x5a, 0x9e, 0x5b, 0x9e, 0x5c, 0x9e, 0x5e,
+	0x9e, 0x63, 0x9e, 0x66, 0x9e, 0x67, 0x9e, 0x68, 0x9e, 0x69, 0x9e, 0x6a,
+	0x9e, 0x6b, 0x9e, 0x6c, 0x9e, 0x71, 0x9e, 0x6d, 0x9e, 0x73, 0x75, 0x92,
+	0x75, 0x94, 0x75, 0x96, 0x75, 0xa0, 0x75, 0x9d, 0x75, 0xac, 0x75, 0xa3,
+	0x75, 0xb3, 0x75, 0xb4, 0x75, 0xb8, 0x75, 0xc4, 0x75, 0xb1, 0x75, 0xb0,
+	0x75, 0xc3, 0x75, 0xc2, 0x75, 0xd6, 0x75, 0xcd, 0x75, 0xe3, 0x75, 0xe8,
+	0x75, 0xe6, 0x75, 0xe4, 0x75, 0xeb, 0x75, 0xe7, 0x76, 0x03, 0x75, 0xf1,
+	0x75, 0xfc, 0x75, 0xff, 0x76, 0x10, 0x76, 0x00, 0x76, 0x05, 0x76, 0x0c,
+	0x76, 0x17, 0x76, 0x0a, 0x76, 0x25, 0x76, 0x18, 0x76, 0x15, 0x76, 0x19,
+	0x99, 0x8c, 0x99, 0x8e, 0x99, 0x9a, 0x99, 0x9b, 0x99, 0x9c, 0x99, 0x9d,
+	0x99, 0x9e, 0x99, 0x9f, 0x99, 0xa0, 0x99, 0xa1, 0x99, 0xa2, 0x99, 0xa3,
+	0x99, 0xa4, 0x99, 0xa6, 0x99, 0xa7, 0x99, 0xa9, 0x99, 0xaa, 0x99, 0xab,
+	0x99, 0xac, 0x99, 0xad, 0x99, 0xae, 0x99, 0xaf, 0x99, 0xb0, 0x99, 0xb1,
+	0x99, 0xb2, 0x99, 0xb3, 0x99, 0xb4, 0x99, 0xb5, 0x99, 0xb6, 0x99, 0xb7,
+	0x99, 0xb8, 0x99, 0xb9, 0x99, 0xba, 0x99, 0xbb, 0x99, 0xbc, 0x99, 0xbd,
+	0x99, 0xbe, 0x99, 0xbf, 0x99, 0xc0, 0x99, 0xc1, 0x99, 0xc2, 0x99, 0xc3,
+	0x99, 0xc4, 0x99, 0xc5, 0x99, 0xc6, 0x99, 0xc7, 0x99, 0xc8, 0x99, 0xc9,
+	0x99, 0xca, 0x99, 0xcb, 0x99, 0xcc, 0x99, 0xcd, 0x99, 0xce, 0x99, 0xcf,
+	0x99, 0xd0, 0x99, 0xd1, 0x99, 0xd2, 0x99, 0xd3, 0x99, 0xd4, 0x99, 0xd5,
+	0x99, 0xd6, 0x99, 0xd7, 0x99, 0xd8, 0x99, 0xd9, 0x99, 0xda, 0x99, 0xdb,
+	0x99, 0xdc, 0x99, 0xdd, 0x99, 0xde, 0x99, 0xdf, 0x99, 0xe0, 0x99, 0xe1,
+	0x99, 0xe2, 0x99, 0xe3, 0x99, 0xe4, 0x99, 0xe5, 0x99, 0xe6, 0x99, 0xe7,
+	0x99, 0xe8, 0x99, 0xe9, 0x99, 0xea, 0x99, 0xeb, 0x99, 0xec, 0x99, 0xed,
+	0x99, 0xee, 0x99, 0xef, 0x99, 0xf0, 0x99, 0xf1, 0x99, 0xf2, 0x99, 0xf3,
+	0x99, 0xf4, 0x99, 0xf5, 0x99, 0xf6, 0x99, 0xf7, 0x99, 0xf8, 0x99, 0xf9,
+	0x76, 0x1b, 0x76, 0x3c, 0x76, 0x22, 0x76, 0x20, 0x76, 0x40, 0x76, 0x2d,
+	0x76, 0x30, 0x76, 0x3f, 0x76, 0x35, 0x76, 0x43, 0x76, 0x3e, 0x76, 0x33,
+	0x76, 0x4d, 0x76, 0x5e, 0x76, 0x54, 0x76, 0x5c, 0x76, 0x56, 0x76, 0x6b,
+	0x76, 0x6f, 0x7f, 0xca, 0x7a, 0xe6, 0x7a, 0x78, 0x7a, 0x79, 0x7a, 0x80,
+	0x7a, 0x86, 0x7a, 0x88, 0x7a, 0x95, 0x7a, 0xa6, 0x7a, 0xa0, 0x7a, 0xac,
+	0x7a, 0xa8, 0x7a, 0xad, 0x7a, 0xb3, 0x88, 0x64, 0x88, 0x69, 0x88, 0x72,
+	0x88, 0x7d, 0x88, 0x7f, 0x88, 0x82, 0x88, 0xa2, 0x88, 0xc6, 0x88, 0xb7,
+	0x88, 0xbc, 0x88, 0xc9, 0x88, 0xe2, 0x88, 0xce, 0x88, 0xe3, 0x88, 0xe5,
+	0x88, 0xf1, 0x89, 0x1a, 0x88, 0xfc, 0x88, 0xe8, 0x88, 0xfe, 0x88, 0xf0,
+	0x89, 0x21, 0x89, 0x19, 0x89, 0x13, 0x89, 0x1b, 0x89, 0x0a, 0x89, 0x34,
+	0x89, 0x2b, 0x89, 0x36, 0x89, 0x41, 0x89, 0x66, 0x89, 0x7b, 0x75, 0x8b,
+	0x80, 0xe5, 0x76, 0xb2, 0x76, 0xb4, 0x77, 0xdc, 0x80, 0x12, 0x80, 0x14,
+	0x80, 0x16, 0x80, 0x1c, 0x80, 0x20, 0x80, 0x22, 0x80, 0x25, 0x80, 0x26,
+	0x80, 0x27, 0x80, 0x29, 0x80, 0x28, 0x80, 0x31, 0x80, 0x0b, 0x80, 0x35,
+	0x80, 0x43, 0x80, 0x46, 0x80, 0x4d, 0x80, 0x52, 0x80, 0x69, 0x80, 0x71,
+	0x89, 0x83, 0x98, 0x78, 0x98, 0x80, 0x98, 0x83, 0x99, 0xfa, 0x99, 0xfb,
+	0x99, 0xfc, 0x99, 0xfd, 0x99, 0xfe, 0x99, 0xff, 0x9a, 0x00, 0x9a, 0x01,
+	0x9a, 0x02, 0x9a, 0x03, 0x9a, 0x04, 0x9a, 0x05, 0x9a, 0x06, 0x9a, 0x07,
+	0x9a, 0x08, 0x9a, 0x09, 0x9a, 0x0a, 0x9a, 0x0b, 0x9a, 0x0c, 0x9a, 0x0d,
+	0x9a, 0x0e, 0x9a, 0x0f, 0x9a, 0x10, 0x9a, 0x11, 0x9a, 0x12, 0x9a, 0x13,
+	0x9a, 0x14, 0x9a, 0x15, 0x9a, 0x16, 0x9a, 0x17, 0x9a, 0x18, 0x9a, 0x19,
+	0x9a, 0x1a, 0x9a, 0x1b, 0x9a, 0x1c, 0x9a, 0x1d, 0x9a, 0x1e, 0x9a, 0x1f,
+	0x9a, 0x20, 0x9a, 0x21, 0x9a, 0x22, 0x9a, 0x23, 0x9a, 0x24, 0x9a, 0x25,
+	0x9a, 0x26, 0x9a, 0x27, 0x9a, 0x28, 0x9a, 0x29, 0x9a, 0x2a, 0x9a, 0x2b,
+	0x9a, 0x2c, 0x9a, 0x2d, 0x9a, 0x2e, 0x9a, 0x2f, 0x9a, 0x30, 0x9a, 0x31,
+	0x9a, 0x32, 0x9a, 0x33, 0x9a, 0x34, 0x9a, 0x35, 0x9a, 0x36, 0x9a, 0x37,
+	0x9a, 0x38, 0x9a, 0x39, 0x9a, 0x3a, 0x9a, 0x3b, 0x9a, 0x3c, 0x9a, 0x3d,
+	0x9a, 0x3e, 0x9a, 0x3f, 0x9a, 0x40, 0x9a, 0x41, 0x9a, 0x42, 0x9a, 0x43,
+	0x9a, 0x44, 0x9a, 0x45, 0x9a, 0x46, 0x9a, 0x47, 0x9a, 0x48, 0x9a, 0x49,
+	0x9a, 0x4a, 0x9a, 0x4b, 0x9a, 0x4c, 0x9a, 0x4d, 0x9a, 0x4e, 0x9a, 0x4f,
+	0x9a, 0x50, 0x9a, 0x51, 0x9a, 0x52, 0x9a, 0x53, 0x9a, 0x54, 0x9a, 0x55,
+	0x9a, 0x56, 0x9a, 0x57, 0x9a, 0x58, 0x9a, 0x59, 0x98, 0x89, 0x98, 0x8c,
+	0x98, 0x8d, 0x98, 0x8f, 0x98, 0x94, 0x98, 0x9a, 0x98, 0x9b, 0x98, 0x9e,
+	0x98, 0x9f, 0x98, 0xa1, 0x98, 0xa2, 0x98, 0xa5, 0x98, 0xa6, 0x86, 0x4d,
+	0x86, 0x54, 0x86, 0x6c, 0x86, 0x6e, 0x86, 0x7f, 0x86, 0x7a, 0x86, 0x7c,
+	0x86, 0x7b, 0x86, 0xa8, 0x86, 0x8d, 0x86, 0x8b, 0x86, 0xac, 0x86, 0x9d,
+	0x86, 0xa7, 0x86, 0xa3, 0x86, 0xaa, 0x86, 0x93, 0x86, 0xa9, 0x86, 0xb6,
+	0x86, 0xc4, 0x86, 0xb5, 0x86, 0xce, 0x86, 0xb0, 0x86, 0xba, 0x86, 0xb1,
+	0x86, 0xaf, 0x86, 0xc9, 0x86, 0xcf, 0x86, 0xb4, 0x86, 0xe9, 0x86, 0xf1,
+	0x86, 0xf2, 0x86, 0xed, 0x86, 0xf3, 0x86, 0xd0, 0x87, 0x13, 0x86, 0xde,
+	0x86, 0xf4, 0x86, 0xdf, 0x86, 0xd8, 0x86, 0xd1, 0x87, 0x03, 0x87, 0x07,
+	0x86, 0xf8, 0x87, 0x08, 0x87, 0x0a, 0x87, 0x0d, 0x87, 0x09, 0x87, 0x23,
+	0x87, 0x3b, 0x87, 0x1e, 0x87, 0x25, 0x87, 0x2e, 0x87, 0x1a, 0x87, 0x3e,
+	0x87, 0x48, 0x87, 0x34, 0x87, 0x31, 0x87, 0x29, 0x87, 0x37, 0x87, 0x3f,
+	0x87, 0x82, 0x87, 0x22, 0x87, 0x7d, 0x87, 0x7e, 0x87, 0x7b, 0x87, 0x60,
+	0x87, 0x70, 0x87, 0x4c, 0x87, 0x6e, 0x87, 0x8b, 0x87, 0x53, 0x87, 0x63,
+	0x87, 0x7c, 0x87, 0x64, 0x87, 0x59, 0x87, 0x65, 0x87, 0x93, 0x87, 0xaf,
+	0x87, 0xa8, 0x87, 0xd2, 0x9a, 0x5a, 0x9a, 0x5b, 0x9a, 0x5c, 0x9a, 0x5d,
+	0x9a, 0x5e, 0x9a, 0x5f, 0x9a, 0x60, 0x9a, 0x61, 0x9a, 0x62, 0x9a, 0x63,
+	0x9a, 0x64, 0x9a, 0x65, 0x9a, 0x66, 0x9a, 0x67, 0x9a, 0x68, 0x9a, 0x69,
+	0x9a, 0x6a, 0x9a, 0x6b, 0x9a, 0x72, 0x9a, 0x83, 0x9a, 0x89, 0x9a, 0x8d,
+	0x9a, 0x8e, 0x9a, 0x94, 0x9a, 0x95, 0x9a, 0x99, 0x9a, 0xa6, 0x9a, 0xa9,
+	0x9a, 0xaa, 0x9a, 0xab, 0x9a, 0xac, 0x9a, 0xad, 0x9a, 0xae, 0x9a, 0xaf,
+	0x9a, 0xb2, 0x9a, 0xb3, 0x9a, 0xb4, 0x9a, 0xb5, 0x9a, 0xb9, 0x9a, 0xbb,
+	0x9a, 0xbd, 0x9a, 0xbe, 0x9a, 0xbf, 0x9a, 0xc3, 0x9a, 0xc4, 0x9a, 0xc6,
+	0x9a, 0xc7, 0x9a, 0xc8, 0x9a, 0xc9, 0x9a, 0xca, 0x9a, 0xcd, 0x9a, 0xce,
+	0x9a, 0xcf, 0x9a, 0xd0, 0x9a, 0xd2, 0x9a, 0xd4, 0x9a, 0xd5, 0x9a, 0xd6,
+	0x9a, 0xd7, 0x9a, 0xd9, 0x9a, 0xda, 0x9a, 0xdb, 0x9a, 0xdc, 0x9a, 0xdd,
+	0x9a, 0xde, 0x9a, 0xe0, 0x9a, 0xe2, 0x9a, 0xe3, 0x9a, 0xe4, 0x9a, 0xe5,
+	0x9a, 0xe7, 0x9a, 0xe8, 0x9a, 0xe9, 0x9a, 0xea, 0x9a, 0xec, 0x9a, 0xee,
+	0x9a, 0xf0, 0x9a, 0xf1, 0x9a, 0xf2, 0x9a, 0xf3, 0x9a, 0xf4, 0x9a, 0xf5,
+	0x9a, 0xf6, 0x9a, 0xf7, 0x9a, 0xf8, 0x9a, 0xfa, 0x9a, 0xfc, 0x9a, 0xfd,
+	0x9a, 0xfe, 0x9a, 0xff, 0x9b, 0x00, 0x9b, 0x01, 0x9b, 0x02, 0x9b, 0x04,
+	0x9b, 0x05, 0x9b, 0x06, 0x87, 0xc6, 0x87, 0x88, 0x87, 0x85, 0x87, 0xad,
+	0x87, 0x97, 0x87, 0x83, 0x87, 0xab, 0x87, 0xe5, 0x87, 0xac, 0x87, 0xb5,
+	0x87, 0xb3, 0x87, 0xcb, 0x87, 0xd3, 0x87, 0xbd, 0x87, 0xd1, 0x87, 0xc0,
+	0x87, 0xca, 0x87, 0xdb, 0x87, 0xea, 0x87, 0xe0, 0x87, 0xee, 0x88, 0x16,
+	0x88, 0x13, 0x87, 0xfe, 0x88, 0x0a, 0x88, 0x1b, 0x88, 0x21, 0x88, 0x39,
+	0x88, 0x3c, 0x7f, 0x36, 0x7f, 0x42, 0x7f, 0x44, 0x7f, 0x45, 0x82, 0x10,
+	0x7a, 0xfa, 0x7a, 0xfd, 0x7b, 0x08, 0x7b, 0x03, 0x7b, 0x04, 0x7b, 0x15,
+	0x7b, 0x0a, 0x7b, 0x2b, 0x7b, 0x0f, 0x7b, 0x47, 0x7b, 0x38, 0x7b, 0x2a,
+	0x7b, 0x19, 0x7b, 0x2e, 0x7b, 0x31, 0x7b, 0x20, 0x7b, 0x25, 0x7b, 0x24,
+	0x7b, 0x33, 0x7b, 0x3e, 0x7b, 0x1e, 0x7b, 0x58, 0x7b, 0x5a, 0x7b, 0x45,
+	0x7b, 0x75, 0x7b, 0x4c, 0x7b, 0x5d, 0x7b, 0x60, 0x7b, 0x6e, 0x7b, 0x7b,
+	0x7b, 0x62, 0x7b, 0x72, 0x7b, 0x71, 0x7b, 0x90, 0x7b, 0xa6, 0x7b, 0xa7,
+	0x7b, 0xb8, 0x7b, 0xac, 0x7b, 0x9d, 0x7b, 0xa8, 0x7b, 0x85, 0x7b, 0xaa,
+	0x7b, 0x9c, 0x7b, 0xa2, 0x7b, 0xab, 0x7b, 0xb4, 0x7b, 0xd1, 0x7b, 0xc1,
+	0x7b, 0xcc, 0x7b, 0xdd, 0x7b, 0xda, 0x7b, 0xe5, 0x7b, 0xe6, 0x7b, 0xea,
+	0x7c, 0x0c, 0x7b, 0xfe, 0x7b, 0xfc, 0x7c, 0x0f, 0x7c, 0x16, 0x7c, 0x0b,
+	0x9b, 0x07, 0x9b, 0x09, 0x9b, 0x0a, 0x9b, 0x0b, 0x9b, 0x0c, 0x9b, 0x0d,
+	0x9b, 0x0e, 0x9b, 0x10, 0x9b, 0x11, 0x9b, 0x12, 0x9b, 0x14, 0x9b, 0x15,
+	0x9b, 0x16, 0x9b, 0x17, 0x9b, 0x18, 0x9b, 0x19, 0x9b, 0x1a, 0x9b, 0x1b,
+	0x9b, 0x1c, 0x9b, 0x1d, 0x9b, 0x1e, 0x9b, 0x20, 0x9b, 0x21, 0x9b, 0x22,
+	0x9b, 0x24, 0x9b, 0x25, 0x9b, 0x26, 0x9b, 0x27, 0x9b, 0x28, 0x9b, 0x29,
+	0x9b, 0x2a, 0x9b, 0x2b, 0x9b, 0x2c, 0x9b, 0x2d, 0x9b, 0x2e, 0x9b, 0x30,
+	0x9b, 0x31, 0x9b, 0x33, 0x9b, 0x34, 0x9b, 0x35, 0x9b, 0x36, 0x9b, 0x37,
+	0x9b, 0x38, 0x9b, 0x39, 0x9b, 0x3a, 0x9b, 0x3d, 0x9b, 0x3e, 0x9b, 0x3f,
+	0x9b, 0x40, 0x9b, 0x46, 0x9b, 0x4a, 0x9b, 0x4b, 0x9b, 0x4c, 0x9b, 0x4e,
+	0x9b, 0x50, 0x9b, 0x52, 0x9b, 0x53, 0x9b, 0x55, 0x9b, 0x56, 0x9b, 0x57,
+	0x9b, 0x58, 0x9b, 0x59, 0x9b, 0x5a, 0x9b, 0x5b, 0x9b, 0x5c, 0x9b, 0x5d,
+	0x9b, 0x5e, 0x9b, 0x5f, 0x9b, 0x60, 0x9b, 0x61, 0x9b, 0x62, 0x9b, 0x63,
+	0x9b, 0x64, 0x9b, 0x65, 0x9b, 0x66, 0x9b, 0x67, 0x9b, 0x68, 0x9b, 0x69,
+	0x9b, 0x6a, 0x9b, 0x6b, 0x9b, 0x6c, 0x9b, 0x6d, 0x9b, 0x6e, 0x9b, 0x6f,
+	0x9b, 0x70, 0x9b, 0x71, 0x9b, 0x72, 0x9b, 0x73, 0x9b, 0x74, 0x9b, 0x75,
+	0x9b, 0x76, 0x9b, 0x77, 0x9b, 0x78, 0x9b, 0x79, 0x9b, 0x7a, 0x9b, 0x7b,
+	0x7c, 0x1f, 0x7c, 0x2a, 0x7c, 0x26, 0x7c, 0x38, 0x7c, 0x41, 0x7c, 0x40,
+	0x81, 0xfe, 0x82, 0x01, 0x82, 0x02, 0x82, 0x04, 0x81, 0xec, 0x88, 0x44,
+	0x82, 0x21, 0x82, 0x22, 0x82, 0x23, 0x82, 0x2d, 0x82, 0x2f, 0x82, 0x28,
+	0x82, 0x2b, 0x82, 0x38, 0x82, 0x3b, 0x82, 0x33, 0x82, 0x34, 0x82, 0x3e,
+	0x82, 0x44, 0x82, 0x49, 0x82, 0x4b, 0x82, 0x4f, 0x82, 0x5a, 0x82, 0x5f,
+	0x82, 0x68, 0x88, 0x7e, 0x88, 0x85, 0x88, 0x88, 0x88, 0xd8, 0x88, 0xdf,
+	0x89, 0x5e, 0x7f, 0x9d, 0x7f, 0x9f, 0x7f, 0xa7, 0x7f, 0xaf, 0x7f, 0xb0,
+	0x7f, 0xb2, 0x7c, 0x7c, 0x65, 0x49, 0x7c, 0x91, 0x7c, 0x9d, 0x7c, 0x9c,
+	0x7c, 0x9e, 0x7c, 0xa2, 0x7c, 0xb2, 0x7c, 0xbc, 0x7c, 0xbd, 0x7c, 0xc1,
+	0x7c, 0xc7, 0x7c, 0xcc, 0x7c, 0xcd, 0x7c, 0xc8, 0x7c, 0xc5, 0x7c, 0xd7,
+	0x7c, 0xe8, 0x82, 0x6e, 0x66, 0xa8, 0x7f, 0xbf, 0x7f, 0xce, 0x7f, 0xd5,
+	0x7f, 0xe5, 0x7f, 0xe1, 0x7f, 0xe6, 0x7f, 0xe9, 0x7f, 0xee, 0x7f, 0xf3,
+	0x7c, 0xf8, 0x7d, 0x77, 0x7d, 0xa6, 0x7d, 0xae, 0x7e, 0x47, 0x7e, 0x9b,
+	0x9e, 0xb8, 0x9e, 0xb4, 0x8d, 0x73, 0x8d, 0x84, 0x8d, 0x94, 0x8d, 0x91,
+	0x8d, 0xb1, 0x8d, 0x67, 0x8d, 0x6d, 0x8c, 0x47, 0x8c, 0x49, 0x91, 0x4a,
+	0x91, 0x50, 0x91, 0x4e, 0x91, 0x4f, 0x91, 0x64, 0x9b, 0x7c, 0x9b, 0x7d,
+	0x9b, 0x7e, 0x9b, 0x7f, 0x9b, 0x80, 0x9b, 0x81, 0x9b, 0x82, 0x9b, 0x83,
+	0x9b, 0x84, 0x9b, 0x85, 0x9b, 0x86, 0x9b, 0x87, 0x9b, 0x88, 0x9b, 0x89,
+	0x9b, 0x8a, 0x9b, 0x8b, 0x9b, 0x8c, 0x9b, 0x8d, 0x9b, 0x8e, 0x9b, 0x8f,
+	0x9b, 0x90, 0x9b, 0x91, 0x9b, 0x92, 0x9b, 0x93, 0x9b, 0x94, 0x9b, 0x95,
+	0x9b, 0x96, 0x9b, 0x97, 0x9b, 0x98, 0x9b, 0x99, 0x9b, 0x9a, 0x9b, 0x9b,
+	0x9b, 0x9c, 0x9b, 0x9d, 0x9b, 0x9e, 0x9b, 0x9f, 0x9b, 0xa0, 0x9b, 0xa1,
+	0x9b, 0xa2, 0x9b, 0xa3, 0x9b, 0xa4, 0x9b, 0xa5, 0x9b, 0xa6, 0x9b, 0xa7,
+	0x9b, 0xa8, 0x9b, 0xa9, 0x9b, 0xaa, 0x9b, 0xab, 0x9b, 0xac, 0x9b, 0xad,
+	0x9b, 0xae, 0x9b, 0xaf, 0x9b, 0xb0, 0x9b, 0xb1, 0x9b, 0xb2, 0x9b, 0xb3,
+	0x9b, 0xb4, 0x9b, 0xb5, 0x9b, 0xb6, 0x9b, 0xb7, 0x9b, 0xb8, 0x9b, 0xb9,
+	0x9b, 0xba, 0x9b, 0xbb, 0x9b, 0xbc, 0x9b, 0xbd, 0x9b, 0xbe, 0x9b, 0xbf,
+	0x9b, 0xc0, 0x9b, 0xc1, 0x9b, 0xc2, 0x9b, 0xc3, 0x9b, 0xc4, 0x9b, 0xc5,
+	0x9b, 0xc6, 0x9b, 0xc7, 0x9b, 0xc8, 0x9b, 0xc9, 0x9b, 0xca, 0x9b, 0xcb,
+	0x9b, 0xcc, 0x9b, 0xcd, 0x9b, 0xce, 0x9b, 0xcf, 0x9b, 0xd0, 0x9b, 0xd1,
+	0x9b, 0xd2, 0x9b, 0xd3, 0x9b, 0xd4, 0x9b, 0xd5, 0x9b, 0xd6, 0x9b, 0xd7,
+	0x9b, 0xd8, 0x9b, 0xd9, 0x9b, 0xda, 0x9b, 0xdb, 0x91, 0x62, 0x91, 0x61,
+	0x91, 0x70, 0x91, 0x69, 0x91, 0x6f, 0x91, 0x7d, 0x91, 0x7e, 0x91, 0x72,
+	0x91, 0x74, 0x91, 0x79, 0x91, 0x8c, 0x91, 0x85, 0x91, 0x90, 0x91, 0x8d,
+	0x91, 0x91, 0x91, 0xa2, 0x91, 0xa3, 0x91, 0xaa, 0x91, 0xad, 0x91, 0xae,
+	0x91, 0xaf, 0x91, 0xb5, 0x91, 0xb4, 0x91, 0xba, 0x8c, 0x55, 0x9e, 0x7e,
+	0x8d, 0xb8, 0x8d, 0xeb, 0x8e, 0x05, 0x8e, 0x59, 0x8e, 0x69, 0x8d, 0xb5,
+	0x8d, 0xbf, 0x8d, 0xbc, 0x8d, 0xba, 0x8d, 0xc4, 0x8d, 0xd6, 0x8d, 0xd7,
+	0x8d, 0xda, 0x8d, 0xde, 0x8d, 0xce, 0x8d, 0xcf, 0x8d, 0xdb, 0x8d, 0xc6,
+	0x8d, 0xec, 0x8d, 0xf7, 0x8d, 0xf8, 0x8d, 0xe3, 0x8d, 0xf9, 0x8d, 0xfb,
+	0x8d, 0xe4, 0x8e, 0x09, 0x8d, 0xfd, 0x8e, 0x14, 0x8e, 0x1d, 0x8e, 0x1f,
+	0x8e, 0x2c, 0x8e, 0x2e, 0x8e, 0x23, 0x8e, 0x2f, 0x8e, 0x3a, 0x8e, 0x40,
+	0x8e, 0x39, 0x8e, 0x35, 0x8e, 0x3d, 0x8e, 0x31, 0x8e, 0x49, 0x8e, 0x41,
+	0x8e, 0x42, 0x8e, 0x51, 0x8e, 0x52, 0x8e, 0x4a, 0x8e, 0x70, 0x8e, 0x76,
+	0x8e, 0x7c, 0x8e, 0x6f, 0x8e, 0x74, 0x8e, 0x85, 0x8e, 0x8f, 0x8e, 0x94,
+	0x8e, 0x90, 0x8e, 0x9c, 0x8e, 0x9e, 0x8c, 0x78, 0x8c, 0x82, 0x8c, 0x8a,
+	0x8c, 0x85, 0x8c, 0x98, 0x8c, 0x94, 0x65, 0x9b, 0x89, 0xd6, 0x89, 0xde,
+	0x89, 0xda, 0x89, 0xdc, 0x9b, 0xdc, 0x9b, 0xdd, 0x9b, 0xde, 0x9b, 0xdf,
+	0x9b, 0xe0, 0x9b, 0xe1, 0x9b, 0xe2, 0x9b, 0xe3, 0x9b, 0xe4, 0x9b, 0xe5,
+	0x9b, 0xe6, 0x9b, 0xe7, 0x9b, 0xe8, 0x9b, 0xe9, 0x9b, 0xea, 0x9b, 0xeb,
+	0x9b, 0xec, 0x9b, 0xed, 0x9b, 0xee, 0x9b, 0xef, 0x9b, 0xf0, 0x9b, 0xf1,
+	0x9b, 0xf2, 0x9b, 0xf3, 0x9b, 0xf4, 0x9b, 0xf5, 0x9b, 0xf6, 0x9b, 0xf7,
+	0x9b, 0xf8, 0x9b, 0xf9, 0x9b, 0xfa, 0x9b, 0xfb, 0x9b, 0xfc, 0x9b, 0xfd,
+	0x9b, 0xfe, 0x9b, 0xff, 0x9c, 0x00, 0x9c, 0x01, 0x9c, 0x02, 0x9c, 0x03,
+	0x9c, 0x04, 0x9c, 0x05, 0x9c, 0x06, 0x9c, 0x07, 0x9c, 0x08, 0x9c, 0x09,
+	0x9c, 0x0a, 0x9c, 0x0b, 0x9c, 0x0c, 0x9c, 0x0d, 0x9c, 0x0e, 0x9c, 0x0f,
+	0x9c, 0x10, 0x9c, 0x11, 0x9c, 0x12, 0x9c, 0x13, 0x9c, 0x14, 0x9c, 0x15,
+	0x9c, 0x16, 0x9c, 0x17, 0x9c, 0x18, 0x9c, 0x19, 0x9c, 0x1a, 0x9c, 0x1b,
+	0x9c, 0x1c, 0x9c, 0x1d, 0x9c, 0x1e, 0x9c, 0x1f, 0x9c, 0x20, 0x9c, 0x21,
+	0x9c, 0x22, 0x9c, 0x23, 0x9c, 0x24, 0x9c, 0x25, 0x9c, 0x26, 0x9c, 0x27,
+	0x9c, 0x28, 0x9c, 0x29, 0x9c, 0x2a, 0x9c, 0x2b, 0x9c, 0x2c, 0x9c, 0x2d,
+	0x9c, 0x2e, 0x9c, 0x2f, 0x9c, 0x30, 0x9c, 0x31, 0x9c, 0x32, 0x9c, 0x33,
+	0x9c, 0x34, 0x9c, 0x35, 0x9c, 0x36, 0x9c, 0x37, 0x9c, 0x38, 0x9c, 0x39,
+	0x9c, 0x3a, 0x9c, 0x3b, 0x89, 0xe5, 0x89, 0xeb, 0x89, 0xef, 0x8a, 0x3e,
+	0x8b, 0x26, 0x97, 0x53, 0x96, 0xe9, 0x96, 0xf3, 0x96, 0xef, 0x97, 0x06,
+	0x97, 0x01, 0x97, 0x08, 0x97, 0x0f, 0x97, 0x0e, 0x97, 0x2a, 0x97, 0x2d,
+	0x97, 0x30, 0x97, 0x3e, 0x9f, 0x80, 0x9f, 0x83, 0x9f, 0x85, 0x9f, 0x86,
+	0x9f, 0x87, 0x9f, 0x88, 0x9f, 0x89, 0x9f, 0x8a, 0x9f, 0x8c, 0x9e, 0xfe,
+	0x9f, 0x0b, 0x9f, 0x0d, 0x96, 0xb9, 0x96, 0xbc, 0x96, 0xbd, 0x96, 0xce,
+	0x96, 0xd2, 0x77, 0xbf, 0x96, 0xe0, 0x92, 0x8e, 0x92, 0xae, 0x92, 0xc8,
+	0x93, 0x3e, 0x93, 0x6a, 0x93, 0xca, 0x93, 0x8f, 0x94, 0x3e, 0x94, 0x6b,
+	0x9c, 0x7f, 0x9c, 0x82, 0x9c, 0x85, 0x9c, 0x86, 0x9c, 0x87, 0x9c, 0x88,
+	0x7a, 0x23, 0x9c, 0x8b, 0x9c, 0x8e, 0x9c, 0x90, 0x9c, 0x91, 0x9c, 0x92,
+	0x9c, 0x94, 0x9c, 0x95, 0x9c, 0x9a, 0x9c, 0x9b, 0x9c, 0x9e, 0x9c, 0x9f,
+	0x9c, 0xa0, 0x9c, 0xa1, 0x9c, 0xa2, 0x9c, 0xa3, 0x9c, 0xa5, 0x9c, 0xa6,
+	0x9c, 0xa7, 0x9c, 0xa8, 0x9c, 0xa9, 0x9c, 0xab, 0x9c, 0xad, 0x9c, 0xae,
+	0x9c, 0xb0, 0x9c, 0xb1, 0x9c, 0xb2, 0x9c, 0xb3, 0x9c, 0xb4, 0x9c, 0xb5,
+	0x9c, 0xb6, 0x9c, 0xb7, 0x9c, 0xba, 0x9c, 0xbb, 0x9c, 0xbc, 0x9c, 0xbd,
+	0x9c, 0xc4, 0x9c, 0xc5, 0x9c, 0xc6, 0x9c, 0xc7, 0x9c, 0xca, 0x9c, 0xcb,
+	0x9c, 0x3c, 0x9c, 0x3d, 0x9c, 0x3e, 0x9c, 0x3f, 0x9c, 0x40, 0x9c, 0x41,
+	0x9c, 0x42, 0x9c, 0x43, 0x9c, 0x44, 0x9c, 0x45, 0x9c, 0x46, 0x9c, 0x47,
+	0x9c, 0x48, 0x9c, 0x49, 0x9c, 0x4a, 0x9c, 0x4b, 0x9c, 0x4c, 0x9c, 0x4d,
+	0x9c, 0x4e, 0x9c, 0x4f, 0x9c, 0x50, 0x9c, 0x51, 0x9c, 0x52, 0x9c, 0x53,
+	0x9c, 0x54, 0x9c, 0x55, 0x9c, 0x56, 0x9c, 0x57, 0x9c, 0x58, 0x9c, 0x59,
+	0x9c, 0x5a, 0x9c, 0x5b, 0x9c, 0x5c, 0x9c, 0x5d, 0x9c, 0x5e, 0x9c, 0x5f,
+	0x9c, 0x60, 0x9c, 0x61, 0x9c, 0x62, 0x9c, 0x63, 0x9c, 0x64, 0x9c, 0x65,
+	0x9c, 0x66, 0x9c, 0x67, 0x9c, 0x68, 0x9c, 0x69, 0x9c, 0x6a, 0x9c, 0x6b,
+	0x9c, 0x6c, 0x9c, 0x6d, 0x9c, 0x6e, 0x9c, 0x6f, 0x9c, 0x70, 0x9c, 0x71,
+	0x9c, 0x72, 0x9c, 0x73, 0x9c, 0x74, 0x9c, 0x75, 0x9c, 0x76, 0x9c, 0x77,
+	0x9c, 0x78, 0x9c, 0x79, 0x9c, 0x7a, 0x9c, 0x7b, 0x9c, 0x7d, 0x9c, 0x7e,
+	0x9c, 0x80, 0x9c, 0x83, 0x9c, 0x84, 0x9c, 0x89, 0x9c, 0x8a, 0x9c, 0x8c,
+	0x9c, 0x8f, 0x9c, 0x93, 0x9c, 0x96, 0x9c, 0x97, 0x9c, 0x98, 0x9c, 0x99,
+	0x9c, 0x9d, 0x9c, 0xaa, 0x9c, 0xac, 0x9c, 0xaf, 0x9c, 0xb9, 0x9c, 0xbe,
+	0x9c, 0xbf, 0x9c, 0xc0, 0x9c, 0xc1, 0x9c, 0xc2, 0x9c, 0xc8, 0x9c, 0xc9,
+	0x9c, 0xd1, 0x9c, 0xd2, 0x9c, 0xda, 0x9c, 0xdb, 0x9c, 0xe0, 0x9c, 0xe1,
+	0x9c, 0xcc, 0x9c, 0xcd, 0x9c, 0xce, 0x9c, 0xcf, 0x9c, 0xd0, 0x9c, 0xd3,
+	0x9c, 0xd4, 0x9c, 0xd5, 0x9c, 0xd7, 0x9c, 0xd8, 0x9c, 0xd9, 0x9c, 0xdc,
+	0x9c, 0xdd, 0x9c, 0xdf, 0x9c, 0xe2, 0x97, 0x7c, 0x97, 0x85, 0x97, 0x91,
+	0x97, 0x92, 0x97, 0x94, 0x97, 0xaf, 0x97, 0xab, 0x97, 0xa3, 0x97, 0xb2,
+	0x97, 0xb4, 0x9a, 0xb1, 0x9a, 0xb0, 0x9a, 0xb7, 0x9e, 0x58, 0x9a, 0xb6,
+	0x9a, 0xba, 0x9a, 0xbc, 0x9a, 0xc1, 0x9a, 0xc0, 0x9a, 0xc5, 0x9a, 0xc2,
+	0x9a, 0xcb, 0x9a, 0xcc, 0x9a, 0xd1, 0x9b, 0x45, 0x9b, 0x43, 0x9b, 0x47,
+	0x9b, 0x49, 0x9b, 0x48, 0x9b, 0x4d, 0x9b, 0x51, 0x98, 0xe8, 0x99, 0x0d,
+	0x99, 0x2e, 0x99, 0x55, 0x99, 0x54, 0x9a, 0xdf, 0x9a, 0xe1, 0x9a, 0xe6,
+	0x9a, 0xef, 0x9a, 0xeb, 0x9a, 0xfb, 0x9a, 0xed, 0x9a, 0xf9, 0x9b, 0x08,
+	0x9b, 0x0f, 0x9b, 0x13, 0x9b, 0x1f, 0x9b, 0x23, 0x9e, 0xbd, 0x9e, 0xbe,
+	0x7e, 0x3b, 0x9e, 0x82, 0x9e, 0x87, 0x9e, 0x88, 0x9e, 0x8b, 0x9e, 0x92,
+	0x93, 0xd6, 0x9e, 0x9d, 0x9e, 0x9f, 0x9e, 0xdb, 0x9e, 0xdc, 0x9e, 0xdd,
+	0x9e, 0xe0, 0x9e, 0xdf, 0x9e, 0xe2, 0x9e, 0xe9, 0x9e, 0xe7, 0x9e, 0xe5,
+	0x9e, 0xea, 0x9e, 0xef, 0x9f, 0x22, 0x9f, 0x2c, 0x9f, 0x2f, 0x9f, 0x39,
+	0x9f, 0x37, 0x9f, 0x3d, 0x9f, 0x3e, 0x9f, 0x44, 0x9c, 0xe3, 0x9c, 0xe4,
+	0x9c, 0xe5, 0x9c, 0xe6, 0x9c, 0xe7, 0x9c, 0xe8, 0x9c, 0xe9, 0x9c, 0xea,
+	0x9c, 0xeb, 0x9c, 0xec, 0x9c, 0xed, 0x9c, 0xee, 0x9c, 0xef, 0x9c, 0xf0,
+	0x9c, 0xf1, 0x9c, 0xf2, 0x9c, 0xf3, 0x9c, 0xf4, 0x9c, 0xf5, 0x9c, 0xf6,
+	0x9c, 0xf7, 0x9c, 0xf8, 0x9c, 0xf9, 0x9c, 0xfa, 0x9c, 0xfb, 0x9c, 0xfc,
+	0x9c, 0xfd, 0x9c, 0xfe, 0x9c, 0xff, 0x9d, 0x00, 0x9d, 0x01, 0x9d, 0x02,
+	0x9d, 0x03, 0x9d, 0x04, 0x9d, 0x05, 0x9d, 0x06, 0x9d, 0x07, 0x9d, 0x08,
+	0x9d, 0x09, 0x9d, 0x0a, 0x9d, 0x0b, 0x9d, 0x0c, 0x9d, 0x0d, 0x9d, 0x0e,
+	0x9d, 0x0f, 0x9d, 0x10, 0x9d, 0x11, 0x9d, 0x12, 0x9d, 0x13, 0x9d, 0x14,
+	0x9d, 0x15, 0x9d, 0x16, 0x9d, 0x17, 0x9d, 0x18, 0x9d, 0x19, 0x9d, 0x1a,
+	0x9d, 0x1b, 0x9d, 0x1c, 0x9d, 0x1d, 0x9d, 0x1e, 0x9d, 0x1f, 0x9d, 0x20,
+	0x9d, 0x21, 0x9d, 0x22, 0x9d, 0x23, 0x9d, 0x24, 0x9d, 0x25, 0x9d, 0x26,
+	0x9d, 0x27, 0x9d, 0x28, 0x9d, 0x29, 0x9d, 0x2a, 0x9d, 0x2b, 0x9d, 0x2c,
+	0x9d, 0x2d, 0x9d, 0x2e, 0x9d, 0x2f, 0x9d, 0x30, 0x9d, 0x31, 0x9d, 0x32,
+	0x9d, 0x33, 0x9d, 0x34, 0x9d, 0x35, 0x9d, 0x36, 0x9d, 0x37, 0x9d, 0x38,
+	0x9d, 0x39, 0x9d, 0x3a, 0x9d, 0x3b, 0x9d, 0x3c, 0x9d, 0x3d, 0x9d, 0x3e,
+	0x9d, 0x3f, 0x9d, 0x40, 0x9d, 0x41, 0x9d, 0x42, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x9d, 0x43, 0x9d, 0x44, 0x9d, 0x45, 0x9d, 0x46,
+	0x9d, 0x47, 0x9d, 0x48, 0x9d, 0x49, 0x9d, 0x4a, 0x9d, 0x4b, 0x9d, 0x4c,
+	0x9d, 0x4d, 0x9d, 0x4e, 0x9d, 0x4f, 0x9d, 0x50, 0x9d, 0x51, 0x9d, 0x52,
+	0x9d, 0x53, 0x9d, 0x54, 0x9d, 0x55, 0x9d, 0x56, 0x9d, 0x57, 0x9d, 0x58,
+	0x9d, 0x59, 0x9d, 0x5a, 0x9d, 0x5b, 0x9d, 0x5c, 0x9d, 0x5d, 0x9d, 0x5e,
+	0x9d, 0x5f, 0x9d, 0x60, 0x9d, 0x61, 0x9d, 0x62, 0x9d, 0x63, 0x9d, 0x64,
+	0x9d, 0x65, 0x9d, 0x66, 0x9d, 0x67, 0x9d, 0x68, 0x9d, 0x69, 0x9d, 0x6a,
+	0x9d, 0x6b, 0x9d, 0x6c, 0x9d, 0x6d, 0x9d, 0x6e, 0x9d, 0x6f, 0x9d, 0x70,
+	0x9d, 0x71, 0x9d, 0x72, 0x9d, 0x73, 0x9d, 0x74, 0x9d, 0x75, 0x9d, 0x76,
+	0x9d, 0x77, 0x9d, 0x78, 0x9d, 0x79, 0x9d, 0x7a, 0x9d, 0x7b, 0x9d, 0x7c,
+	0x9d, 0x7d, 0x9d, 0x7e, 0x9d, 0x7f, 0x9d, 0x80, 0x9d, 0x81, 0x9d, 0x82,
+	0x9d, 0x83, 0x9d, 0x84, 0x9d, 0x85, 0x9d, 0x86, 0x9d, 0x87, 0x9d, 0x88,
+	0x9d, 0x89, 0x9d, 0x8a, 0x9d, 0x8b, 0x9d, 0x8c, 0x9d, 0x8d, 0x9d, 0x8e,
+	0x9d, 0x8f, 0x9d, 0x90, 0x9d, 0x91, 0x9d, 0x92, 0x9d, 0x93, 0x9d, 0x94,
+	0x9d, 0x95, 0x9d, 0x96, 0x9d, 0x97, 0x9d, 0x98, 0x9d, 0x99, 0x9d, 0x9a,
+	0x9d, 0x9b, 0x9d, 0x9c, 0x9d, 0x9d, 0x9d, 0x9e, 0x9d, 0x9f, 0x9d, 0xa0,
+	0x9d, 0xa1, 0x9d, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x9d, 0xa3, 0x9d, 0xa4, 0x9d, 0xa5, 0x9d, 0xa6, 0x9d, 0xa7, 0x9d, 0xa8,
+	0x9d, 0xa9, 0x9d, 0xaa, 0x9d, 0xab, 0x9d, 0xac, 0x9d, 0xad, 0x9d, 0xae,
+	0x9d, 0xaf, 0x9d, 0xb0, 0x9d, 0xb1, 0x9d, 0xb2, 0x9d, 0xb3, 0x9d, 0xb4,
+	0x9d, 0xb5, 0x9d, 0xb6, 0x9d, 0xb7, 0x9d, 0xb8, 0x9d, 0xb9, 0x9d, 0xba,
+	0x9d, 0xbb, 0x9d, 0xbc, 0x9d, 0xbd, 0x9d, 0xbe, 0x9d, 0xbf, 0x9d, 0xc0,
+	0x9d, 0xc1, 0x9d, 0xc2, 0x9d, 0xc3, 0x9d, 0xc4, 0x9d, 0xc5, 0x9d, 0xc6,
+	0x9d, 0xc7, 0x9d, 0xc8, 0x9d, 0xc9, 0x9d, 0xca, 0x9d, 0xcb, 0x9d, 0xcc,
+	0x9d, 0xcd, 0x9d, 0xce, 0x9d, 0xcf, 0x9d, 0xd0, 0x9d, 0xd1, 0x9d, 0xd2,
+	0x9d, 0xd3, 0x9d, 0xd4, 0x9d, 0xd5, 0x9d, 0xd6, 0x9d, 0xd7, 0x9d, 0xd8,
+	0x9d, 0xd9, 0x9d, 0xda, 0x9d, 0xdb, 0x9d, 0xdc, 0x9d, 0xdd, 0x9d, 0xde,
+	0x9d, 0xdf, 0x9d, 0xe0, 0x9d, 0xe1, 0x9d, 0xe2, 0x9d, 0xe3, 0x9d, 0xe4,
+	0x9d, 0xe5, 0x9d, 0xe6, 0x9d, 0xe7, 0x9d, 0xe8, 0x9d, 0xe9, 0x9d, 0xea,
+	0x9d, 0xeb, 0x9d, 0xec, 0x9d, 0xed, 0x9d, 0xee, 0x9d, 0xef, 0x9d, 0xf0,
+	0x9d, 0xf1, 0x9d, 0xf2, 0x9d, 0xf3, 0x9d, 0xf4, 0x9d, 0xf5, 0x9d, 0xf6,
+	0x9d, 0xf7, 0x9d, 0xf8, 0x9d, 0xf9, 0x9d, 0xfa, 0x9d, 0xfb, 0x9d, 0xfc,
+	0x9d, 0xfd, 0x9d, 0xfe, 0x9d, 0xff, 0x9e, 0x00, 0x9e, 0x01, 0x9e, 0x02,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x03, 0x9e, 0x04,
+	0x9e, 0x05, 0x9e, 0x06, 0x9e, 0x07, 0x9e, 0x08, 0x9e, 0x09, 0x9e, 0x0a,
+	0x9e, 0x0b, 0x9e, 0x0c, 0x9e, 0x0d, 0x9e, 0x0e, 0x9e, 0x0f, 0x9e, 0x10,
+	0x9e, 0x11, 0x9e, 0x12, 0x9e, 0x13, 0x9e, 0x14, 0x9e, 0x15, 0x9e, 0x16,
+	0x9e, 0x17, 0x9e, 0x18, 0x9e, 0x19, 0x9e, 0x1a, 0x9e, 0x1b, 0x9e, 0x1c,
+	0x9e, 0x1d, 0x9e, 0x1e, 0x9e, 0x24, 0x9e, 0x27, 0x9e, 0x2e, 0x9e, 0x30,
+	0x9e, 0x34, 0x9e, 0x3b, 0x9e, 0x3c, 0x9e, 0x40, 0x9e, 0x4d, 0x9e, 0x50,
+	0x9e, 0x52, 0x9e, 0x53, 0x9e, 0x54, 0x9e, 0x56, 0x9e, 0x59, 0x9e, 0x5d,
+	0x9e, 0x5f, 0x9e, 0x60, 0x9e, 0x61, 0x9e, 0x62, 0x9e, 0x65, 0x9e, 0x6e,
+	0x9e, 0x6f, 0x9e, 0x72, 0x9e, 0x74, 0x9e, 0x75, 0x9e, 0x76, 0x9e, 0x77,
+	0x9e, 0x78, 0x9e, 0x79, 0x9e, 0x7a, 0x9e, 0x7b, 0x9e, 0x7c, 0x9e, 0x7d,
+	0x9e, 0x80, 0x9e, 0x81, 0x9e, 0x83, 0x9e, 0x84, 0x9e, 0x85, 0x9e, 0x86,
+	0x9e, 0x89, 0x9e, 0x8a, 0x9e, 0x8c, 0x9e, 0x8d, 0x9e, 0x8e, 0x9e, 0x8f,
+	0x9e, 0x90, 0x9e, 0x91, 0x9e, 0x94, 0x9e, 0x95, 0x9e, 0x96, 0x9e, 0x97,
+	0x9e, 0x98, 0x9e, 0x99, 0x9e, 0x9a, 0x9e, 0x9b, 0x9e, 0x9c, 0x9e, 0x9e,
+	0x9e, 0xa0, 0x9e, 0xa1, 0x9e, 0xa2, 0x9e, 0xa3, 0x9e, 0xa4, 0x9e, 0xa5,
+	0x9e, 0xa7, 0x9e, 0xa8, 0x9e, 0xa9, 0x9e, 0xaa, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x9e, 0xab, 0x9e, 0xac, 0x9e, 0xad, 0x9e, 0xae,
+	0x9e, 0xaf, 0x9e, 0xb0, 0x9e, 0xb1, 0x9e, 0xb2, 0x9e, 0xb3, 0x9e, 0xb5,
+	0x9e, 0xb6, 0x9e, 0xb7, 0x9e, 0xb9, 0x9e, 0xba, 0x9e, 0xbc, 0x9e, 0xbf,
+	0x9e, 0xc0, 0x9e, 0xc1, 0x9e, 0xc2, 0x9e, 0xc3, 0x9e, 0xc5, 0x9e, 0xc6,
+	0x9e, 0xc7, 0x9e, 0xc8, 0x9e, 0xca, 0x9e, 0xcb, 0x9e, 0xcc, 0x9e, 0xd0,
+	0x9e, 0xd2, 0x9e, 0xd3, 0x9e, 0xd5, 0x9e, 0xd6, 0x9e, 0xd7, 0x9e, 0xd9,
+	0x9e, 0xda, 0x9e, 0xde, 0x9e, 0xe1, 0x9e, 0xe3, 0x9e, 0xe4, 0x9e, 0xe6,
+	0x9e, 0xe8, 0x9e, 0xeb, 0x9e, 0xec, 0x9e, 0xed, 0x9e, 0xee, 0x9e, 0xf0,
+	0x9e, 0xf1, 0x9e, 0xf2, 0x9e, 0xf3, 0x9e, 0xf4, 0x9e, 0xf5, 0x9e, 0xf6,
+	0x9e, 0xf7, 0x9e, 0xf8, 0x9e, 0xfa, 0x9e, 0xfd, 0x9e, 0xff, 0x9f, 0x00,
+	0x9f, 0x01, 0x9f, 0x02, 0x9f, 0x03, 0x9f, 0x04, 0x9f, 0x05, 0x9f, 0x06,
+	0x9f, 0x07, 0x9f, 0x08, 0x9f, 0x09, 0x9f, 0x0a, 0x9f, 0x0c, 0x9f, 0x0f,
+	0x9f, 0x11, 0x9f, 0x12, 0x9f, 0x14, 0x9f, 0x15, 0x9f, 0x16, 0x9f, 0x18,
+	0x9f, 0x1a, 0x9f, 0x1b, 0x9f, 0x1c, 0x9f, 0x1d, 0x9f, 0x1e, 0x9f, 0x1f,
+	0x9f, 0x21, 0x9f, 0x23, 0x9f, 0x24, 0x9f, 0x25, 0x9f, 0x26, 0x9f, 0x27,
+	0x9f, 0x28, 0x9f, 0x29, 0x9f, 0x2a, 0x9f, 0x2b, 0x9f, 0x2d, 0x9f, 0x2e,
+	0x9f, 0x30, 0x9f, 0x31, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x9f, 0x32, 0x9f, 0x33, 0x9f, 0x34, 0x9f, 0x35, 0x9f, 0x36, 0x9f, 0x38,
+	0x9f, 0x3a, 0x9f, 0x3c, 0x9f, 0x3f, 0x9f, 0x40, 0x9f, 0x41, 0x9f, 0x42,
+	0x9f, 0x43, 0x9f, 0x45, 0x9f, 0x46, 0x9f, 0x47, 0x9f, 0x48, 0x9f, 0x49,
+	0x9f, 0x4a, 0x9f, 0x4b, 0x9f, 0x4c, 0x9f, 0x4d, 0x9f, 0x4e, 0x9f, 0x4f,
+	0x9f, 0x52, 0x9f, 0x53, 0x9f, 0x54, 0x9f, 0x55, 0x9f, 0x56, 0x9f, 0x57,
+	0x9f, 0x58, 0x9f, 0x59, 0x9f, 0x5a, 0x9f, 0x5b, 0x9f, 0x5c, 0x9f, 0x5d,
+	0x9f, 0x5e, 0x9f, 0x5f, 0x9f, 0x60, 0x9f, 0x61, 0x9f, 0x62, 0x9f, 0x63,
+	0x9f, 0x64, 0x9f, 0x65, 0x9f, 0x66, 0x9f, 0x67, 0x9f, 0x68, 0x9f, 0x69,
+	0x9f, 0x6a, 0x9f, 0x6b, 0x9f, 0x6c, 0x9f, 0x6d, 0x9f, 0x6e, 0x9f, 0x6f,
+	0x9f, 0x70, 0x9f, 0x71, 0x9f, 0x72, 0x9f, 0x73, 0x9f, 0x74, 0x9f, 0x75,
+	0x9f, 0x76, 0x9f, 0x77, 0x9f, 0x78, 0x9f, 0x79, 0x9f, 0x7a, 0x9f, 0x7b,
+	0x9f, 0x7c, 0x9f, 0x7d, 0x9f, 0x7e, 0x9f, 0x81, 0x9f, 0x82, 0x9f, 0x8d,
+	0x9f, 0x8e, 0x9f, 0x8f, 0x9f, 0x90, 0x9f, 0x91, 0x9f, 0x92, 0x9f, 0x93,
+	0x9f, 0x94, 0x9f, 0x95, 0x9f, 0x96, 0x9f, 0x97, 0x9f, 0x98, 0x9f, 0x9c,
+	0x9f, 0x9d, 0x9f, 0x9e, 0x9f, 0xa1, 0x9f, 0xa2, 0x9f, 0xa3, 0x9f, 0xa4,
+	0x9f, 0xa5, 0xf9, 0x2c, 0xf9, 0x79, 0xf9, 0x95, 0xf9, 0xe7, 0xf9, 0xf1,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0c, 0xfa, 0x0d,
+	0xfa, 0x0e, 0xfa, 0x0f, 0xfa, 0x11, 0xfa, 0x13, 0xfa, 0x14, 0xfa, 0x18,
+	0xfa, 0x1f, 0xfa, 0x20, 0xfa, 0x21, 0xfa, 0x23, 0xfa, 0x24, 0xfa, 0x27,
+	0xfa, 0x28, 0xfa, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff
+};
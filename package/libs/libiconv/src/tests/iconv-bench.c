@@ -0,0 +1,141 @@
+/*
+ * Throughput benchmark for the libiconv stub
+ *
+ * Converts a buffer of ASCII, of mostly ASCII text with some Latin-1
+ * letters and, with ALL_CHARSETS, of double byte text, and prints MB/s of
+ * input for each conversion. Build it once against each iconv.c to compare
+ * two versions.
+ *
+ * Build and run from src/:
+ *   cc -O2 -Iinclude -DALL_CHARSETS -o iconv-bench tests/iconv-bench.c iconv.c
+ *   ./iconv-bench [megabytes]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+#include "iconv.h"
+
+struct input {
+	const char *name;
+	const char *charset;
+	char *buf;
+	size_t len;
+};
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* repeat a short sample up to len bytes without splitting a character */
+static size_t fill(char *buf, size_t len, const char *sample)
+{
+	size_t n = 0, l = strlen(sample);
+
+	while (n + l <= len) {
+		memcpy(buf + n, sample, l);
+		n += l;
+	}
+
+	return n;
+}
+
+static void bench(const struct input *in, const char *to, char *out, size_t outsize)
+{
+	double start, best = 0;
+	int i;
+
+	for (i = 0; i < 3; i++) {
+		char *ip = in->buf, *op = out;
+		size_t ib = in->len, ob = outsize;
+		iconv_t cd = libiconv_open(to, in->charset);
+
+		if (cd == (iconv_t) -1) {
+			printf("%-10s %-10s -> %-10s not supported\n", in->name, in->charset, to);
+			return;
+		}
+
+		start = now();
+		if (libiconv(cd, &ip, &ib, &op, &ob) == (size_t) -1) {
+			printf("%-10s %-10s -> %-10s failed: %s\n", in->name, in->charset, to,
+			       strerror(errno));
+			libiconv_close(cd);
+			return;
+		}
+		start = now() - start;
+		libiconv_close(cd);
+
+		if (!best || start < best)
+			best = start;
+	}
+
+	printf("%-10s %-10s -> %-10s %8.0f MB/s\n", in->name, in->charset, to,
+	       in->len / 1e6 / best);
+}
+
+int main(int argc, char **argv)
+{
+	size_t size = (argc > 1 ? atoi(argv[1]) : 16) << 20;
+	size_t outsize = size * 4;
+	char *out = malloc(outsize);
+	struct input ascii = { "ascii", "UTF-8" };
+	struct input latin = { "latin", "UTF-8" };
+	struct input latin1 = { "latin", "ISO-8859-1" };
+
+	ascii.buf = malloc(size);
+	latin.buf = malloc(size);
+	latin1.buf = malloc(size);
+	if (!out || !ascii.buf || !latin.buf || !latin1.buf)
+		return 1;
+
+	ascii.len = fill(ascii.buf, size, "The quick brown fox jumps over the lazy dog. ");
+	latin.len = fill(latin.buf, size, "Le c\xc5\x93ur d\xc3\xa9\xc3\xa7u d'un gar\xc3\xa7on na\xc3\xaf" "f. ");
+	latin1.len = fill(latin1.buf, size, "Das M\xe4" "dchen \xfc" "bt gr\xfc\xdf" "end. ");
+
+	bench(&ascii, "ISO-8859-1", out, outsize);
+	bench(&ascii, "UTF-16LE", out, outsize);
+	bench(&ascii, "UTF-8", out, outsize);
+	bench(&latin, "ISO-8859-15", out, outsize);
+	bench(&latin, "UTF-16LE", out, outsize);
+	bench(&latin1, "UTF-8", out, outsize);
+
+#ifdef ALL_CHARSETS
+	{
+		static const struct {
+			const char *charset, *sample;
+		} dbcs[] = {
+			{ "EUC-KR", "\xc7\xd1\xb1\xb9\xbe\xee \xc5\xd8\xbd\xba\xc6\xae. " },
+			{ "GBK", "\xc4\xe3\xba\xc3\xa3\xac\xca\xc0\xbd\xe7\xa1\xa3 " },
+			{ "BIG5", "\xa4\xa4\xa4\xe5\xa6\x72\xb2\xc5. " },
+			{ "SHIFT_JIS", "\x93\xfa\x96\x7b\x8c\xea\x82\xcc\x83\x65\x83\x4c\x83\x58\x83\x67. " },
+		};
+		struct input in = { "dbcs" };
+		unsigned int i;
+
+		in.buf = malloc(size);
+		if (!in.buf)
+			return 1;
+
+		for (i = 0; i < sizeof(dbcs) / sizeof(dbcs[0]); i++) {
+			in.charset = dbcs[i].charset;
+			in.len = fill(in.buf, size, dbcs[i].sample);
+			bench(&in, "UTF-8", out, outsize);
+		}
+		free(in.buf);
+	}
+#endif
+
+	free(ascii.buf);
+	free(latin.buf);
+	free(latin1.buf);
+	free(out);
+
+	return 0;
+}
@@ -0,0 +1,276 @@
+/*
+ * Conformance test for the libiconv stub
+ *
+ * Checks known conversions and errors, and that converting through small
+ * output buffers (many E2BIG restarts) gives the same result as one call,
+ * which exercises the boundaries of the bulk ASCII copy. With ALL_CHARSETS
+ * the double byte charmaps are checked as well, and with HOST_ICONV every
+ * double byte code is compared with the iconv of the C library.
+ *
+ * Build and run from src/:
+ *   cc -O2 -Iinclude -DALL_CHARSETS -o iconv-test tests/iconv-test.c iconv.c
+ *   cc -O2 -Iinclude -DALL_CHARSETS -DHOST_ICONV -o iconv-test tests/iconv-test.c iconv.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include "iconv.h"
+
+#ifdef HOST_ICONV
+/* the stub's header renamed its own functions, declare the C library ones */
+#undef iconv_open
+#undef iconv
+#undef iconv_close
+void *iconv_open(const char *tocode, const char *fromcode);
+size_t iconv(void *cd, char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft);
+int iconv_close(void *cd);
+#endif
+
+static int failed;
+
+struct vector {
+	const char *from, *to;
+	const char *in;
+	size_t in_len;
+	const char *out;
+	size_t out_len;
+	int err;		/* expected errno, 0 for success */
+};
+
+#define S(s) s, sizeof(s) - 1
+
+static const struct vector vectors[] = {
+	{ "UTF-8", "ISO-8859-1", S("caf\xc3\xa9"), S("caf\xe9"), 0 },
+	{ "UTF-8", "UTF-16LE", S("a\xc3\xa9\xe2\x82\xac"), S("a\0\xe9\0\xac\x20"), 0 },
+	{ "UTF-8", "UTF-16BE", S("a\xf0\x9f\x98\x80"), S("\0a\xd8\x3d\xde\x00"), 0 },
+	{ "UTF-16LE", "UTF-8", S("a\0\x3d\xd8\x00\xde"), S("a\xf0\x9f\x98\x80"), 0 },
+	{ "UTF-16LE", "UTF-8", S("\x3d\xd8" "a\0"), S(""), EILSEQ },
+	{ "ISO-8859-1", "UTF-8", S("\xe9t\xe9"), S("\xc3\xa9t\xc3\xa9"), 0 },
+	{ "UTF-8", "ASCII", S("ab\xc3\xa9"), S("ab"), EILSEQ },
+	{ "UTF-8", "ISO-8859-1", S("ab\xc3"), S("ab"), EINVAL },
+	{ "UTF-8", "UTF-8", S("ab\xff"), S("ab"), EILSEQ },
+	{ "KOI8-R", "UTF-8", S("\xc1\xc2"), S("\xd0\xb0\xd0\xb1"), 0 },
+#ifdef ALL_CHARSETS
+	{ "WINDOWS-1252", "UTF-8", S("\x80"), S("\xe2\x82\xac"), 0 },
+	{ "EUC-KR", "UTF-8", S("a\xb0\xa1"), S("a\xea\xb0\x80"), 0 },
+	{ "EUC-KR", "UTF-8", S("\xb0\x41"), S(""), EILSEQ },
+	{ "EUC-KR", "UTF-8", S("a\xb0"), S("a"), EINVAL },
+	{ "GBK", "UTF-8", S("\xc4\xe3\xba\xc3"), S("\xe4\xbd\xa0\xe5\xa5\xbd"), 0 },
+	{ "GBK", "UTF-8", S("\x81\x7f"), S(""), EILSEQ },
+	{ "BIG5", "UTF-8", S("\xa4\xa4\xa4\xe5"), S("\xe4\xb8\xad\xe6\x96\x87"), 0 },
+	{ "BIG5", "UTF-8", S("\xa4\x80"), S(""), EILSEQ },
+	{ "SHIFT_JIS", "UTF-8", S("\x82\xa0\xb1"), S("\xe3\x81\x82\xef\xbd\xb1"), 0 },
+	{ "SHIFT_JIS", "UTF-8", S("\xa0\x40"), S(""), EILSEQ },
+	{ "SHIFT_JIS", "UTF-16LE", S("x\x88\x9f"), S("x\0\x9c\x4e"), 0 },
+#endif
+};
+
+static void check_vector(const struct vector *v)
+{
+	char out[64], *in = (char *) v->in, *o = out;
+	size_t inb = v->in_len, outb = sizeof(out), r;
+	iconv_t cd;
+	int err;
+
+	cd = libiconv_open(v->to, v->from);
+	if (cd == (iconv_t) -1) {
+		printf("FAIL %s -> %s: not supported\n", v->from, v->to);
+		failed++;
+		return;
+	}
+
+	errno = 0;
+	r = libiconv(cd, &in, &inb, &o, &outb);
+	err = r == (size_t) -1 ? errno : 0;
+
+	if (err != v->err || (size_t)(o - out) != v->out_len ||
+	    memcmp(out, v->out, v->out_len)) {
+		printf("FAIL %s -> %s: errno %d, %zu bytes out (expected errno %d, %zu bytes)\n",
+		       v->from, v->to, err, (size_t)(o - out), v->err, v->out_len);
+		failed++;
+	}
+	libiconv_close(cd);
+}
+
+/* random text, mostly ASCII with multibyte characters mixed in */
+static size_t random_utf8(char *buf, size_t len)
+{
+	static const char *const chars[] = {
+		"\xc3\xa9", "\xc3\xbf", "\xc2\xa0", "\xe2\x82\xac", "\xd0\xb0",
+	};
+	size_t n = 0;
+
+	while (n + 4 < len) {
+		int r = rand() % 100;
+
+		if (r < 90) {
+			buf[n++] = 0x20 + rand() % 0x5f;
+		} else {
+			const char *c = chars[r % 5];
+
+			memcpy(buf + n, c, strlen(c));
+			n += strlen(c);
+		}
+	}
+
+	return n;
+}
+
+static size_t convert(const char *to, const char *from, const char *in,
+		      size_t inb, char *out, size_t outsize, size_t step, int *err)
+{
+	char *i = (char *) in, *o = out;
+	iconv_t cd = libiconv_open(to, from);
+
+	*err = 0;
+	while (inb) {
+		size_t outb = step, r;
+		char *start = o;
+
+		if ((size_t)(o - out) + outb > outsize)
+			outb = outsize - (o - out);
+
+		errno = 0;
+		r = libiconv(cd, &i, &inb, &o, &outb);
+		if (r != (size_t) -1)
+			continue;
+		if (errno != E2BIG || (o == start && step >= 8)) {
+			*err = errno;
+			break;
+		}
+		/* the next character does not fit, retry with more room */
+		if (o == start)
+			step *= 2;
+	}
+	libiconv_close(cd);
+
+	return o - out;
+}
+
+static void check_chunked(void)
+{
+	static const char *const targets[] = {
+		"UTF-8", "UTF-16LE", "UTF-16BE", "UTF-32BE", "WCHAR_T",
+	};
+	char in[4096], whole[16384], part[16384];
+	unsigned int i, t;
+
+	srand(1);
+	for (i = 0; i < 2000; i++) {
+		size_t inb = random_utf8(in, 1 + rand() % sizeof(in));
+
+		for (t = 0; t < sizeof(targets) / sizeof(targets[0]); t++) {
+			size_t step = 1 + rand() % 7;
+			size_t n1, n2;
+			int e1, e2;
+
+			n1 = convert(targets[t], "UTF-8", in, inb, whole, sizeof(whole), sizeof(whole), &e1);
+			n2 = convert(targets[t], "UTF-8", in, inb, part, sizeof(part), step, &e2);
+			if (n1 != n2 || e1 != e2 || memcmp(whole, part, n1)) {
+				printf("FAIL UTF-8 -> %s through %zu byte buffers differs\n",
+				       targets[t], step);
+				failed++;
+				return;
+			}
+		}
+	}
+}
+
+#ifdef HOST_ICONV
+static unsigned int utf8_chars(const char *s, const char *end)
+{
+	unsigned int n = 0;
+
+	for (; s < end; s++)
+		n += (*s & 0xc0) != 0x80;
+
+	return n;
+}
+
+static unsigned int utf8_code(const char *s)
+{
+	const unsigned char *p = (const unsigned char *) s;
+
+	if (p[0] < 0x80)
+		return p[0];
+	if (p[0] < 0xe0)
+		return (p[0] & 0x1f) << 6 | (p[1] & 0x3f);
+	if (p[0] < 0xf0)
+		return (p[0] & 0x0f) << 12 | (p[1] & 0x3f) << 6 | (p[2] & 0x3f);
+	return (p[0] & 0x07) << 18 | (p[1] & 0x3f) << 12 | (p[2] & 0x3f) << 6 | (p[3] & 0x3f);
+}
+
+/* compare every double byte code of a charmap with the C library */
+static void check_host(const char *name)
+{
+	unsigned int lead, trail, checked = 0, differ = 0;
+	void *host = iconv_open("UTF-32LE", name);
+	iconv_t stub = libiconv_open("UTF-8", name);
+	void *host8 = iconv_open("UTF-8", name);
+
+	if (host == (void *) -1 || host8 == (void *) -1 || stub == (iconv_t) -1) {
+		printf("SKIP %s: not supported by the host iconv\n", name);
+		return;
+	}
+
+	for (lead = 0x81; lead <= 0xfe; lead++) {
+		for (trail = 0x40; trail <= 0xfe; trail++) {
+			char in[2] = { lead, trail }, o1[8], o2[8];
+			char *i1 = in, *i2 = in, *p1 = o1, *p2 = o2;
+			size_t ib1 = 2, ib2 = 2, ob1 = sizeof(o1), ob2 = sizeof(o2);
+			size_t r1, r2;
+
+			r1 = libiconv(stub, &i1, &ib1, &p1, &ob1);
+			r2 = iconv(host8, &i2, &ib2, &p2, &ob2);
+			iconv(host8, NULL, NULL, NULL, NULL);
+
+			/* only codes both decode as one character are compared */
+			if (r1 == (size_t) -1 || r2 == (size_t) -1 ||
+			    utf8_chars(o1, p1) != 1 || utf8_chars(o2, p2) != 1)
+				continue;
+
+			checked++;
+			if (p1 - o1 != p2 - o2 || memcmp(o1, o2, p1 - o1)) {
+				if (differ++ < 5)
+					printf("  %s %02x%02x: stub U+%04X, host U+%04X\n", name,
+					       lead, trail, utf8_code(o1), utf8_code(o2));
+			}
+		}
+	}
+
+	/*
+	 * Big5 has vendor variants that disagree on a few hundred punctuation
+	 * codes, so some differences are expected there
+	 */
+	printf("%s: %u codes compared with the host iconv, %u differ\n", name, checked, differ);
+	if (!checked || differ * 20 > checked)
+		failed++;
+
+	iconv_close(host);
+	iconv_close(host8);
+	libiconv_close(stub);
+}
+#endif
+
+int main(void)
+{
+	unsigned int i;
+
+	for (i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++)
+		check_vector(&vectors[i]);
+
+	check_chunked();
+
+#ifdef HOST_ICONV
+	check_host("EUC-KR");
+	check_host("GBK");
+	check_host("BIG5");
+	check_host("SHIFT_JIS");
+#endif
+
+	printf("%s\n", failed ? "FAILED" : "OK");
+	return !!failed;
+}
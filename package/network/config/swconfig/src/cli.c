@@ -42,6 +42,7 @@ enum {
 	CMD_HELP,
 	CMD_SHOW,
 	CMD_PORTMAP,
+	CMD_MIBS,
 };
 
 static void
@@ -198,11 +199,35 @@ show_vlan(struct switch_dev *dev, int vlan, bool all)
 	show_attrs(dev, dev->vlan_ops, &val);
 }
 
+static int
+show_mibs(struct switch_dev *dev, int port)
+{
+	struct switch_port_mibs *mibs;
+	int i, j, err;
+
+	err = swlib_get_port_mibs(dev, &mibs);
+	if (err < 0)
+		return err;
+
+	for (i = 0; i < dev->ports; i++) {
+		if (port >= 0 && i != port)
+			continue;
+
+		printf("Port %d:\n", i);
+		for (j = 0; j < mibs[i].n_mibs; j++)
+			printf("\t%-12s: %llu\n", mibs[i].mibs[j].name,
+			       mibs[i].mibs[j].value);
+	}
+
+	swlib_free_port_mibs(dev, mibs);
+	return 0;
+}
+
 static void
 print_usage(void)
 {
 	printf("swconfig list\n");
-	printf("swconfig dev <dev> [port <port>|vlan <vlan>] (help|set <key> <value>|get <key>|load <config>|show)\n");
+	printf("swconfig dev <dev> [port <port>|vlan <vlan>] (help|set <key> <value>|get <key>|load <config>|show|mibs)\n");
 	exit(1);
 }
 
@@ -291,6 +316,8 @@ int main(int argc, char **argv)
 			cmd = CMD_PORTMAP;
 		} else if (!strcmp(arg, "show")) {
 			cmd = CMD_SHOW;
+		} else if (!strcmp(arg, "mibs")) {
+			cmd = CMD_MIBS;
 		} else {
 			print_usage();
 		}
@@ -379,6 +406,14 @@ int main(int argc, char **argv)
 				show_vlan(dev, i, true);
 		}
 		break;
+	case CMD_MIBS:
+		if (cvlan >= 0)
+			print_usage();
+
+		retval = show_mibs(dev, cport);
+		if (retval < 0)
+			nl_perror(-retval, "Failed to get mib counters");
+		break;
 	}
 
 out:
@@ -61,6 +61,11 @@ static struct nla_policy link_policy[SWITCH_LINK_ATTR_MAX] = {
 	[SWITCH_LINK_FLAG_EEE_1000BASET] = { .type = NLA_FLAG },
 };
 
+static struct nla_policy mib_policy[SWITCH_MIB_ATTR_MAX + 1] = {
+	[SWITCH_MIB_NAME] = { .type = NLA_STRING },
+	[SWITCH_MIB_VALUE] = { .type = NLA_U64 },
+};
+
 static inline void *
 swlib_alloc(size_t size)
 {
@@ -422,6 +427,132 @@ swlib_set_attr(struct switch_dev *dev, struct switch_attr *attr, struct switch_v
 	return swlib_call(cmd, NULL, send_attr_val, val);
 }
 
+struct port_mibs_arg {
+	struct switch_dev *dev;
+	struct switch_port_mibs *mibs;
+	int err;
+};
+
+static int
+send_port_mibs(struct nl_msg *msg, void *arg)
+{
+	struct port_mibs_arg *pa = arg;
+
+	NLA_PUT_U32(msg, SWITCH_ATTR_ID, pa->dev->id);
+
+	return 0;
+nla_put_failure:
+	return -1;
+}
+
+static int
+store_port_mibs(struct nl_msg *msg, void *arg)
+{
+	struct genlmsghdr *gnlh = nlmsg_data(nlmsg_hdr(msg));
+	struct port_mibs_arg *pa = arg;
+	struct switch_port_mibs *pm;
+	struct nlattr *p;
+	int remaining;
+	int port, n = 0;
+
+	if (pa->err)
+		goto done;
+
+	if (nla_parse(tb, SWITCH_ATTR_MAX - 1, genlmsg_attrdata(gnlh, 0),
+			genlmsg_attrlen(gnlh, 0), NULL) < 0)
+		goto done;
+
+	if (!tb[SWITCH_ATTR_OP_PORT] || !tb[SWITCH_ATTR_PORT_MIBS])
+		goto done;
+
+	port = nla_get_u32(tb[SWITCH_ATTR_OP_PORT]);
+	if (port >= pa->dev->ports)
+		goto done;
+
+	pm = &pa->mibs[port];
+	if (pm->mibs)
+		goto done;
+
+	nla_for_each_nested(p, tb[SWITCH_ATTR_PORT_MIBS], remaining)
+		n++;
+
+	if (!n)
+		goto done;
+
+	pm->mibs = swlib_alloc(sizeof(struct switch_port_mib) * n);
+	if (!pm->mibs)
+		goto nomem;
+
+	nla_for_each_nested(p, tb[SWITCH_ATTR_PORT_MIBS], remaining) {
+		struct nlattr *mtb[SWITCH_MIB_ATTR_MAX + 1];
+		struct switch_port_mib *mib;
+
+		if (nla_parse_nested(mtb, SWITCH_MIB_ATTR_MAX, p, mib_policy) < 0)
+			continue;
+
+		if (!mtb[SWITCH_MIB_NAME] || !mtb[SWITCH_MIB_VALUE])
+			continue;
+
+		mib = &pm->mibs[pm->n_mibs];
+		mib->name = strdup(nla_get_string(mtb[SWITCH_MIB_NAME]));
+		if (!mib->name)
+			goto nomem;
+		mib->value = nla_get_u64(mtb[SWITCH_MIB_VALUE]);
+		pm->n_mibs++;
+	}
+
+done:
+	return NL_SKIP;
+nomem:
+	/* keep reading the rest of the dump, the error is returned after it */
+	pa->err = -ENOMEM;
+	return NL_SKIP;
+}
+
+int
+swlib_get_port_mibs(struct switch_dev *dev, struct switch_port_mibs **mibs)
+{
+	struct port_mibs_arg arg;
+	int err;
+	int i;
+
+	arg.dev = dev;
+	arg.err = 0;
+	arg.mibs = swlib_alloc(sizeof(struct switch_port_mibs) * dev->ports);
+	if (!arg.mibs)
+		return -ENOMEM;
+
+	for (i = 0; i < dev->ports; i++)
+		arg.mibs[i].port = i;
+
+	err = swlib_call(SWITCH_CMD_GET_PORT_MIBS, store_port_mibs, send_port_mibs, &arg);
+	if (!err)
+		err = arg.err;
+	if (err < 0) {
+		swlib_free_port_mibs(dev, arg.mibs);
+		return err;
+	}
+
+	*mibs = arg.mibs;
+	return 0;
+}
+
+void
+swlib_free_port_mibs(struct switch_dev *dev, struct switch_port_mibs *mibs)
+{
+	int i, j;
+
+	if (!mibs)
+		return;
+
+	for (i = 0; i < dev->ports; i++) {
+		for (j = 0; j < mibs[i].n_mibs; j++)
+			free(mibs[i].mibs[j].name);
+		free(mibs[i].mibs);
+	}
+	free(mibs);
+}
+
 enum {
 	CMD_NONE,
 	CMD_DUPLEX,
@@ -178,6 +178,17 @@ struct switch_port_link {
 	uint32_t eee;
 };
 
+struct switch_port_mib {
+	char *name;
+	unsigned long long value;
+};
+
+struct switch_port_mibs {
+	int port;
+	int n_mibs;
+	struct switch_port_mib *mibs;
+};
+
 /**
  * swlib_list: list all switches
  */
@@ -259,6 +270,23 @@ int swlib_set_attr_string(struct switch_dev *dev, struct switch_attr *attr,
 int swlib_get_attr(struct switch_dev *dev, struct switch_attr *attr,
 		struct switch_val *val);
 
+/**
+ * swlib_get_port_mibs: get the mib counters of all ports in a single request
+ * @dev: switch device struct
+ * @mibs: set to an array with one entry per port
+ * returns 0 on success
+ * the counters are taken from the snapshot the driver polls periodically,
+ * the result must be freed with swlib_free_port_mibs
+ */
+int swlib_get_port_mibs(struct switch_dev *dev, struct switch_port_mibs **mibs);
+
+/**
+ * swlib_free_port_mibs: free the result of swlib_get_port_mibs
+ * @dev: switch device struct
+ * @mibs: mib counter array
+ */
+void swlib_free_port_mibs(struct switch_dev *dev, struct switch_port_mibs *mibs);
+
 /**
  * swlib_apply_from_uci: set up the switch from a uci configuration
  * @dev: switch device struct
@@ -16,6 +16,7 @@
 #include "wps_hostapd.h"
 #include "sta_info.h"
 #include "ubus.h"
+#include "ieee802_11.h"
 #include "ap_drv_ops.h"
 #include "beacon.h"
 #include "rrm.h"
@@ -195,6 +196,291 @@ hostapd_bss_ban_client(struct hostapd_data *hapd, u8 *addr, int time)
 	eloop_register_timeout(0, time * 1000, hostapd_bss_del_ban, ban, hapd);
 }
 
+/*
+ * notify_response modes: with UBUS_NOTIFY_RESPONSE_WAIT the eloop blocks until
+ * the subscribers reply, with UBUS_NOTIFY_RESPONSE_ASYNC their reply is cached
+ * per station and used for the frames that follow.
+ */
+enum {
+	UBUS_NOTIFY_RESPONSE_NONE,
+	UBUS_NOTIFY_RESPONSE_WAIT,
+	UBUS_NOTIFY_RESPONSE_ASYNC,
+};
+
+#define UBUS_VERDICT_TIMEOUT		10	/* seconds */
+#define UBUS_VERDICT_MAX		1024
+#define UBUS_PROBE_NOTIFY_INTERVAL	1000	/* ms */
+#define UBUS_DEFER_TIMEOUT		100	/* ms */
+#define UBUS_PENDING_TIMEOUT		1000	/* ms */
+
+struct ubus_sta_verdict {
+	struct avl_node avl;
+	u8 addr[ETH_ALEN];
+	struct hostapd_data *hapd;
+	struct os_reltime last_seen;
+
+	/* last reply from the subscribers */
+	int resp;
+	struct os_reltime valid_until;
+
+	/* probe requests seen since the last probe notification */
+	struct os_reltime last_probe;
+	int probes;
+
+	/* notification waiting for a reply */
+	struct ubus_notify_request nreq;
+	bool pending;
+	int pending_resp;
+
+	/* auth frame deferred until the reply */
+	u8 *frame;
+	size_t frame_len;
+	int ssi_signal;
+	bool resuming;
+};
+
+static void ubus_verdict_defer_timeout(void *eloop_data, void *user_ctx);
+static void ubus_verdict_pending_timeout(void *eloop_data, void *user_ctx);
+
+static void
+ubus_verdict_abort(struct hostapd_data *hapd, struct ubus_sta_verdict *v)
+{
+	eloop_cancel_timeout(ubus_verdict_pending_timeout, v, hapd);
+	if (!v->pending)
+		return;
+
+	ubus_abort_request(ctx, &v->nreq.req);
+	v->pending = false;
+}
+
+static void
+ubus_verdict_free(struct hostapd_data *hapd, struct ubus_sta_verdict *v)
+{
+	ubus_verdict_abort(hapd, v);
+	eloop_cancel_timeout(ubus_verdict_defer_timeout, v, hapd);
+	avl_delete(&hapd->ubus.verdicts, &v->avl);
+	os_free(v->frame);
+	os_free(v);
+}
+
+static void
+ubus_verdict_gc(void *eloop_data, void *user_ctx)
+{
+	struct hostapd_data *hapd = eloop_data;
+	struct ubus_sta_verdict *v, *tmp;
+	struct os_reltime now;
+
+	os_get_reltime(&now);
+	avl_for_each_element_safe(&hapd->ubus.verdicts, v, avl, tmp) {
+		if (!os_reltime_expired(&now, &v->last_seen, UBUS_VERDICT_TIMEOUT))
+			continue;
+
+		/* also aborts a notification nobody answered */
+		ubus_verdict_free(hapd, v);
+	}
+
+	if (!avl_is_empty(&hapd->ubus.verdicts))
+		eloop_register_timeout(UBUS_VERDICT_TIMEOUT, 0, ubus_verdict_gc, hapd, NULL);
+}
+
+static struct ubus_sta_verdict *
+ubus_verdict_get(struct hostapd_data *hapd, const u8 *addr)
+{
+	struct ubus_sta_verdict *v;
+
+	v = avl_find_element(&hapd->ubus.verdicts, addr, v, avl);
+	if (v)
+		goto out;
+
+	if (hapd->ubus.verdicts.count >= UBUS_VERDICT_MAX)
+		return NULL;
+
+	v = os_zalloc(sizeof(*v));
+	if (!v)
+		return NULL;
+
+	memcpy(v->addr, addr, sizeof(v->addr));
+	v->avl.key = v->addr;
+	v->hapd = hapd;
+	avl_insert(&hapd->ubus.verdicts, &v->avl);
+
+	if (!eloop_is_timeout_registered(ubus_verdict_gc, hapd, NULL))
+		eloop_register_timeout(UBUS_VERDICT_TIMEOUT, 0, ubus_verdict_gc, hapd, NULL);
+
+out:
+	os_get_reltime(&v->last_seen);
+	return v;
+}
+
+static void
+ubus_verdict_resume(struct hostapd_data *hapd, struct ubus_sta_verdict *v)
+{
+	struct hostapd_frame_info fi = {};
+	size_t len = v->frame_len;
+	u8 *frame = v->frame;
+
+	if (!frame)
+		return;
+
+	eloop_cancel_timeout(ubus_verdict_defer_timeout, v, hapd);
+	v->frame = NULL;
+	v->frame_len = 0;
+
+	fi.freq = hapd->iface->freq;
+	fi.ssi_signal = v->ssi_signal;
+	v->resuming = true;
+	ieee802_11_mgmt(hapd, frame, len, &fi);
+	v->resuming = false;
+	os_free(frame);
+}
+
+static void
+ubus_verdict_defer_timeout(void *eloop_data, void *user_ctx)
+{
+	struct ubus_sta_verdict *v = eloop_data;
+	struct hostapd_data *hapd = user_ctx;
+
+	/* no reply in time, let the station in as the blocking mode would */
+	ubus_verdict_abort(hapd, v);
+
+	v->resp = WLAN_STATUS_SUCCESS;
+	os_get_reltime(&v->valid_until);
+	v->valid_until.sec++;
+	ubus_verdict_resume(hapd, v);
+}
+
+/* no reply to a probe or assoc notification, the next frame notifies again */
+static void
+ubus_verdict_pending_timeout(void *eloop_data, void *user_ctx)
+{
+	ubus_verdict_abort(user_ctx, eloop_data);
+}
+
+static void
+ubus_verdict_status_cb(struct ubus_notify_request *req, int idx, int ret)
+{
+	struct ubus_sta_verdict *v = container_of(req, struct ubus_sta_verdict, nreq);
+
+	v->pending_resp = ret;
+}
+
+static void
+ubus_verdict_complete_cb(struct ubus_notify_request *req, int idx, int ret)
+{
+	struct ubus_sta_verdict *v = container_of(req, struct ubus_sta_verdict, nreq);
+
+	eloop_cancel_timeout(ubus_verdict_pending_timeout, v, v->hapd);
+	v->pending = false;
+	v->resp = v->pending_resp;
+	os_get_reltime(&v->valid_until);
+	v->valid_until.sec += UBUS_VERDICT_TIMEOUT;
+	ubus_verdict_resume(v->hapd, v);
+}
+
+static bool
+ubus_verdict_valid(struct ubus_sta_verdict *v)
+{
+	struct os_reltime now;
+
+	os_get_reltime(&now);
+	return os_reltime_before(&now, &v->valid_until);
+}
+
+static int
+ubus_verdict_defer(struct ubus_sta_verdict *v, struct hostapd_ubus_request *req)
+{
+	u8 *frame;
+
+	if (req->type != HOSTAPD_UBUS_AUTH_REQ || !req->mgmt_frame || !req->frame_len)
+		return WLAN_STATUS_SUCCESS;
+
+	/* keep the latest retransmission */
+	frame = os_memdup(req->mgmt_frame, req->frame_len);
+	if (!frame)
+		return WLAN_STATUS_SUCCESS;
+
+	os_free(v->frame);
+	v->frame = frame;
+	v->frame_len = req->frame_len;
+	v->ssi_signal = req->ssi_signal;
+	if (!eloop_is_timeout_registered(ubus_verdict_defer_timeout, v, v->hapd))
+		eloop_register_timeout(0, UBUS_DEFER_TIMEOUT * 1000,
+				       ubus_verdict_defer_timeout, v, v->hapd);
+
+	return HOSTAPD_UBUS_DEFERRED;
+}
+
+/* decide a frame from the cached reply, or return -1 to send a notification */
+static int
+ubus_verdict_check(struct ubus_sta_verdict *v, struct hostapd_ubus_request *req)
+{
+	struct os_reltime age;
+
+	/* the subscribers already saw the frame we are replaying */
+	if (v->resuming)
+		return v->resp;
+
+	if (v->pending) {
+		if (req->type == HOSTAPD_UBUS_PROBE_REQ)
+			v->probes++;
+
+		if (ubus_verdict_valid(v))
+			return v->resp;
+
+		return ubus_verdict_defer(v, req);
+	}
+
+	if (req->type != HOSTAPD_UBUS_PROBE_REQ)
+		return -1;
+
+	if (os_reltime_initialized(&v->last_probe)) {
+		os_reltime_age(&v->last_probe, &age);
+		if (age.sec * 1000 + age.usec / 1000 < UBUS_PROBE_NOTIFY_INTERVAL) {
+			v->probes++;
+			return ubus_verdict_valid(v) ? v->resp : WLAN_STATUS_SUCCESS;
+		}
+	}
+
+	os_get_reltime(&v->last_probe);
+	return -1;
+}
+
+static int
+ubus_verdict_notify(struct hostapd_data *hapd, struct ubus_sta_verdict *v,
+		    struct hostapd_ubus_request *req, const char *type)
+{
+	if (ubus_notify_async(ctx, &hapd->ubus.obj, type, b.head, &v->nreq))
+		return ubus_verdict_valid(v) ? v->resp : WLAN_STATUS_SUCCESS;
+
+	v->nreq.status_cb = ubus_verdict_status_cb;
+	v->nreq.complete_cb = ubus_verdict_complete_cb;
+	v->pending = true;
+	v->pending_resp = 0;
+	eloop_register_timeout(0, UBUS_PENDING_TIMEOUT * 1000,
+			       ubus_verdict_pending_timeout, v, hapd);
+	ubus_complete_request_async(ctx, &v->nreq.req);
+
+	if (ubus_verdict_valid(v))
+		return v->resp;
+
+	/* nothing known about this station yet, hold auth until the reply */
+	return ubus_verdict_defer(v, req);
+}
+
+static void
+hostapd_ubus_flush_verdicts(struct hostapd_data *hapd)
+{
+	struct ubus_sta_verdict *v, *tmp;
+
+	if (!hapd->ubus.verdicts.comp)
+		return;
+
+	avl_for_each_element_safe(&hapd->ubus.verdicts, v, avl, tmp)
+		ubus_verdict_free(hapd, v);
+
+	eloop_cancel_timeout(ubus_verdict_gc, hapd, NULL);
+}
+
 static int
 hostapd_bss_reload(struct ubus_context *ctx, struct ubus_object *obj,
 		   struct ubus_request_data *req, const char *method,
@@ -477,6 +763,8 @@ hostapd_notify_response(struct ubus_context *ctx, struct ubus_object *obj,
 		return UBUS_STATUS_INVALID_ARGUMENT;
 
 	hapd->ubus.notify_response = blobmsg_get_u32(tb[NOTIFY_RESPONSE]);
+	if (hapd->ubus.notify_response != UBUS_NOTIFY_RESPONSE_ASYNC)
+		hostapd_ubus_flush_verdicts(hapd);
 
 	return UBUS_STATUS_OK;
 }
@@ -1483,6 +1771,7 @@ void hostapd_ubus_add_bss(struct hostapd_data *hapd)
 		return;
 
 	avl_init(&hapd->ubus.banned, avl_compare_macaddr, false, NULL);
+	avl_init(&hapd->ubus.verdicts, avl_compare_macaddr, false, NULL);
 	obj->name = name;
 	obj->type = &bss_object_type;
 	obj->methods = bss_object_type.methods;
@@ -1508,6 +1797,8 @@ void hostapd_ubus_free_bss(struct hostapd_data *hapd)
 
 	hostapd_send_shared_event(&hapd->iface->interfaces->ubus, hapd->conf->iface, "remove");
 
+	hostapd_ubus_flush_verdicts(hapd);
+
 	if (obj->id) {
 		ubus_remove_object(ctx, obj);
 		hostapd_ubus_ref_dec();
@@ -1607,6 +1898,7 @@ ubus_event_cb(struct ubus_notify_request *req, int idx, int ret)
 	ureq->resp = ret;
 }
 
+
 int hostapd_ubus_handle_event(struct hostapd_data *hapd, struct hostapd_ubus_request *req)
 {
 	struct ubus_banned_client *ban;
@@ -1617,7 +1909,9 @@ int hostapd_ubus_handle_event(struct hostapd_data *hapd, struct hostapd_ubus_req
 	};
 	const char *type = "mgmt";
 	struct ubus_event_req ureq = {};
+	struct ubus_sta_verdict *v = NULL;
 	const u8 *addr;
+	int resp;
 
 	if (req->mgmt_frame)
 		addr = req->mgmt_frame->sa;
@@ -1631,11 +1925,24 @@ int hostapd_ubus_handle_event(struct hostapd_data *hapd, struct hostapd_ubus_req
 	if (!hapd->ubus.obj.has_subscribers)
 		return WLAN_STATUS_SUCCESS;
 
+	if (hapd->ubus.notify_response == UBUS_NOTIFY_RESPONSE_ASYNC) {
+		v = ubus_verdict_get(hapd, addr);
+		if (v) {
+			resp = ubus_verdict_check(v, req);
+			if (resp >= 0 || resp == HOSTAPD_UBUS_DEFERRED)
+				return resp;
+		}
+	}
+
 	if (req->type < ARRAY_SIZE(types))
 		type = types[req->type];
 
 	blob_buf_init(&b, 0);
 	blobmsg_add_macaddr(&b, "address", addr);
+	if (v && v->probes) {
+		blobmsg_add_u32(&b, "coalesced", v->probes);
+		v->probes = 0;
+	}
 	if (req->mgmt_frame)
 		blobmsg_add_macaddr(&b, "target", req->mgmt_frame->da);
 	if (req->ssi_signal)
@@ -1683,7 +1990,10 @@ int hostapd_ubus_handle_event(struct hostapd_data *hapd, struct hostapd_ubus_req
 		}
 	}
 
-	if (!hapd->ubus.notify_response) {
+	if (v)
+		return ubus_verdict_notify(hapd, v, req, type);
+
+	if (hapd->ubus.notify_response != UBUS_NOTIFY_RESPONSE_WAIT) {
 		ubus_notify(ctx, &hapd->ubus.obj, type, b.head, -1);
 		return WLAN_STATUS_SUCCESS;
 	}
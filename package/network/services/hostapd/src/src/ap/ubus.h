@@ -21,8 +21,13 @@ struct hostapd_ubus_request {
 	const struct ieee802_11_elems *elems;
 	int ssi_signal; /* dBm */
 	const u8 *addr;
+	size_t frame_len;
 };
 
+/* returned by hostapd_ubus_handle_event() when the frame has been queued
+ * until the ubus subscribers reply, the caller must not answer it */
+#define HOSTAPD_UBUS_DEFERRED -2
+
 struct hostapd_iface;
 struct hostapd_data;
 struct hapd_interfaces;
@@ -36,6 +41,7 @@ struct rrm_measurement_beacon_report;
 struct hostapd_ubus_bss {
 	struct ubus_object obj;
 	struct avl_tree banned;
+	struct avl_tree verdicts;
 	int notify_response;
 };
 
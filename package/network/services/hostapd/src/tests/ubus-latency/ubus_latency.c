@@ -0,0 +1,290 @@
+/*
+ * Stub ubus subscriber measuring the hostapd eloop latency
+ *
+ * Subscribes to hostapd.<ifname>, answers every probe/auth/assoc
+ * notification after a configurable delay (or never), and meanwhile a
+ * second process times get_status calls to the same object. get_status is
+ * served from the hostapd eloop, so its round trip shows how long the eloop
+ * is held by the notifications.
+ *
+ * Build: cc -O2 -o ubus_latency ubus_latency.c -lubus -lubox
+ *
+ * Run it with probe traffic on the BSS, for example from a mac80211_hwsim
+ * station: while :; do iw dev wlan1 scan >/dev/null; done
+ *
+ *	ubus_latency -i wlan0 -m 1 -d 50 -t 30	(blocking notify_response)
+ *	ubus_latency -i wlan0 -m 2 -d 50 -t 30	(asynchronous notify_response)
+ *	ubus_latency -i wlan0 -m 2 -d -1 -t 30	(subscriber never answers)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <signal.h>
+#include <sys/wait.h>
+
+#include <libubox/uloop.h>
+#include <libubox/blobmsg.h>
+#include <libubus.h>
+
+enum {
+	NOTIFY_PROBE,
+	NOTIFY_AUTH,
+	NOTIFY_ASSOC,
+	NOTIFY_OTHER,
+	__NOTIFY_MAX
+};
+
+static const char * const notify_names[__NOTIFY_MAX] = {
+	[NOTIFY_PROBE] = "probe",
+	[NOTIFY_AUTH] = "auth",
+	[NOTIFY_ASSOC] = "assoc",
+	[NOTIFY_OTHER] = "other",
+};
+
+enum {
+	COALESCED,
+	__COALESCED_MAX
+};
+
+static const struct blobmsg_policy coalesced_policy[__COALESCED_MAX] = {
+	[COALESCED] = { "coalesced", BLOBMSG_TYPE_INT32 },
+};
+
+struct deferred_reply {
+	struct ubus_request_data req;
+	struct uloop_timeout timeout;
+};
+
+static struct ubus_context *ctx;
+static struct blob_buf b;
+static int reply_delay = 0;		/* ms, < 0 never answers */
+static int reply_status = 0;		/* 0 accepts, else the 802.11 status */
+static unsigned long notify_count[__NOTIFY_MAX];
+static unsigned long coalesced_count;
+static unsigned long unanswered_count;
+
+static unsigned long long
+now_us(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+static void
+reply_timeout_cb(struct uloop_timeout *t)
+{
+	struct deferred_reply *r = container_of(t, struct deferred_reply, timeout);
+
+	ubus_complete_deferred_request(ctx, &r->req, reply_status);
+	free(r);
+}
+
+static int
+notify_cb(struct ubus_context *ctx, struct ubus_object *obj,
+	  struct ubus_request_data *req, const char *method,
+	  struct blob_attr *msg)
+{
+	struct blob_attr *tb[__COALESCED_MAX];
+	struct deferred_reply *r;
+	int i;
+
+	for (i = 0; i < NOTIFY_OTHER; i++)
+		if (!strcmp(method, notify_names[i]))
+			break;
+	notify_count[i]++;
+
+	blobmsg_parse(coalesced_policy, __COALESCED_MAX, tb, blob_data(msg), blob_len(msg));
+	if (tb[COALESCED])
+		coalesced_count += blobmsg_get_u32(tb[COALESCED]);
+
+	if (!reply_delay)
+		return reply_status;
+
+	r = calloc(1, sizeof(*r));
+	if (!r)
+		return reply_status;
+
+	ubus_defer_request(ctx, req, &r->req);
+	if (reply_delay < 0) {
+		/* hostapd has to give up on its own, the request is never completed */
+		unanswered_count++;
+		return 0;
+	}
+
+	r->timeout.cb = reply_timeout_cb;
+	uloop_timeout_set(&r->timeout, reply_delay);
+	return 0;
+}
+
+static struct ubus_subscriber subscriber = {
+	.cb = notify_cb,
+};
+
+static int
+set_notify_response(struct ubus_context *ctx, uint32_t id, int mode)
+{
+	blob_buf_init(&b, 0);
+	blobmsg_add_u32(&b, "notify_response", mode);
+	return ubus_invoke(ctx, id, "notify_response", b.head, NULL, NULL, 1000);
+}
+
+static int
+cmp_latency(const void *a, const void *b)
+{
+	unsigned long long x = *(const unsigned long long *)a;
+	unsigned long long y = *(const unsigned long long *)b;
+
+	return x < y ? -1 : x > y;
+}
+
+/* child: time get_status round trips on its own connection */
+static int
+run_prober(const char *sock, const char *path, int interval, int duration)
+{
+	struct ubus_context *pctx;
+	unsigned long long *lat, sum = 0;
+	int n = duration * 1000 / interval;
+	int i, timeouts = 0;
+	uint32_t id;
+
+	pctx = ubus_connect(sock);
+	if (!pctx || ubus_lookup_id(pctx, path, &id)) {
+		fprintf(stderr, "prober: cannot reach %s\n", path);
+		return 1;
+	}
+
+	lat = calloc(n, sizeof(*lat));
+	if (!lat)
+		return 1;
+
+	blob_buf_init(&b, 0);
+	for (i = 0; i < n; i++) {
+		unsigned long long start = now_us();
+
+		if (ubus_invoke(pctx, id, "get_status", b.head, NULL, NULL, 1000))
+			timeouts++;
+		lat[i] = now_us() - start;
+		sum += lat[i];
+		usleep(interval * 1000);
+	}
+
+	qsort(lat, n, sizeof(*lat), cmp_latency);
+	printf("get_status round trip over %d calls (us): min %llu avg %llu p50 %llu p99 %llu max %llu, %d failed\n",
+	       n, lat[0], sum / n, lat[n / 2], lat[n * 99 / 100], lat[n - 1], timeouts);
+
+	free(lat);
+	ubus_free(pctx);
+	return 0;
+}
+
+static void
+prober_exit_cb(struct uloop_process *p, int ret)
+{
+	uloop_end();
+}
+
+static struct uloop_process prober = {
+	.cb = prober_exit_cb,
+};
+
+static int
+usage(const char *prog)
+{
+	fprintf(stderr, "Usage: %s -i <ifname> [options]\n"
+		"  -s <socket>     ubus socket path\n"
+		"  -m <mode>       notify_response mode to test, default 2\n"
+		"  -d <ms>         reply delay, -1 never replies, default 0\n"
+		"  -r <status>     reply status, default 0 (accept)\n"
+		"  -p <ms>         get_status interval, default 10\n"
+		"  -t <s>          duration, default 10\n", prog);
+	return 1;
+}
+
+int main(int argc, char **argv)
+{
+	const char *sock = NULL, *ifname = NULL;
+	int mode = 2, interval = 10, duration = 10;
+	char path[64];
+	uint32_t id;
+	int ch, i;
+
+	while ((ch = getopt(argc, argv, "s:i:m:d:r:p:t:")) != -1) {
+		switch (ch) {
+		case 's':
+			sock = optarg;
+			break;
+		case 'i':
+			ifname = optarg;
+			break;
+		case 'm':
+			mode = atoi(optarg);
+			break;
+		case 'd':
+			reply_delay = atoi(optarg);
+			break;
+		case 'r':
+			reply_status = atoi(optarg);
+			break;
+		case 'p':
+			interval = atoi(optarg);
+			break;
+		case 't':
+			duration = atoi(optarg);
+			break;
+		default:
+			return usage(argv[0]);
+		}
+	}
+
+	if (!ifname || interval <= 0 || duration <= 0)
+		return usage(argv[0]);
+
+	snprintf(path, sizeof(path), "hostapd.%s", ifname);
+
+	uloop_init();
+	ctx = ubus_connect(sock);
+	if (!ctx) {
+		fprintf(stderr, "cannot connect to ubus\n");
+		return 1;
+	}
+	ubus_add_uloop(ctx);
+
+	if (ubus_lookup_id(ctx, path, &id)) {
+		fprintf(stderr, "%s not found\n", path);
+		return 1;
+	}
+	if (set_notify_response(ctx, id, mode)) {
+		fprintf(stderr, "cannot set notify_response %d\n", mode);
+		return 1;
+	}
+	if (ubus_register_subscriber(ctx, &subscriber) ||
+	    ubus_subscribe(ctx, &subscriber, id)) {
+		fprintf(stderr, "cannot subscribe to %s\n", path);
+		return 1;
+	}
+
+	prober.pid = fork();
+	if (prober.pid < 0)
+		return 1;
+	if (!prober.pid)
+		_exit(run_prober(sock, path, interval, duration));
+
+	uloop_process_add(&prober);
+	uloop_run();
+
+	printf("notify_response %d, reply delay %d ms:", mode, reply_delay);
+	for (i = 0; i < __NOTIFY_MAX; i++)
+		printf(" %s %lu", notify_names[i], notify_count[i]);
+	printf(", coalesced probes %lu, unanswered %lu\n", coalesced_count, unanswered_count);
+
+	ubus_unsubscribe(ctx, &subscriber, id);
+	set_notify_response(ctx, id, 0);
+	ubus_free(ctx);
+	uloop_done();
+	return 0;
+}
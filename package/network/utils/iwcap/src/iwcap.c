@@ -26,15 +26,19 @@
 #include <signal.h>
 #include <syslog.h>
 #include <errno.h>
+#include <poll.h>
 #include <byteswap.h>
 #include <sys/stat.h>
 #include <sys/time.h>
+#include <sys/uio.h>
+#include <sys/mman.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <net/ethernet.h>
 #include <net/if.h>
 #include <netinet/in.h>
 #include <linux/if_packet.h>
+#include <linux/filter.h>
 
 #define ARPHRD_IEEE80211_RADIOTAP	803
 
@@ -45,6 +49,16 @@
 #define FRAMETYPE_BEACON			0x80
 #define FRAMETYPE_DATA				0x08
 
+#define RX_RING_BLOCK_SIZE			(1 << 17)
+#define RX_RING_BLOCK_NUM			16
+#define RX_RING_FRAME_SIZE			(1 << 16)
+#define RX_RING_BLOCK_TMO			50   /* block retire timeout in ms */
+
+#define BPF_MAX_INSNS				4096
+#define BPF_DROP					0xFF /* jump placeholder, see build_filter() */
+
+#define IOV_BATCH					64   /* frames per writev() call */
+
 #if __BYTE_ORDER == __BIG_ENDIAN
 #define le16(x) __bswap_16(x)
 #else
@@ -57,6 +71,12 @@ uint8_t run_daemon = 0;
 
 uint32_t frames_captured = 0;
 uint32_t frames_filtered = 0;
+uint32_t frames_dropped  = 0;
+uint32_t frames_passed   = 0;   /* frames that passed the socket filter */
+uint32_t frames_kfiltered = 0;  /* frames rejected by the socket filter */
+
+uint8_t  count_kfiltered = 0;
+uint64_t rx_packets_base = 0;
 
 int capture_sock = -1;
 const char *ifname = NULL;
@@ -76,6 +96,13 @@ struct ringbuf_entry {
 	uint32_t usec;			 /* epoch microseconds */
 };
 
+struct rx_ring {
+	uint32_t block_size;     /* size of one kernel ring block */
+	uint32_t block_nr;       /* number of blocks */
+	uint32_t cur;            /* next block to consume */
+	uint8_t *map;            /* mmap()ed ring memory */
+};
+
 typedef struct pcap_hdr_s {
 	uint32_t magic_number;   /* magic number */
 	uint16_t version_major;  /* major version number */
@@ -144,6 +171,227 @@ int set_promisc(int on)
 	return 0;
 }
 
+uint64_t get_rx_packets(void)
+{
+	char path[64];
+	unsigned long long n = 0;
+	FILE *f;
+
+	snprintf(path, sizeof(path), "/sys/class/net/%s/statistics/rx_packets",
+			 ifname);
+
+	if ((f = fopen(path, "r")) != NULL)
+	{
+		if (fscanf(f, "%llu", &n) != 1)
+			n = 0;
+
+		fclose(f);
+	}
+
+	return n;
+}
+
+void update_stats(void)
+{
+	struct tpacket_stats_v3 st;
+	socklen_t len = sizeof(st);
+	uint64_t rx;
+
+	/* the kernel resets its counters on every read, so accumulate them */
+	if (!getsockopt(capture_sock, SOL_PACKET, PACKET_STATISTICS, &st, &len))
+	{
+		frames_dropped += st.tp_drops;
+		frames_passed  += st.tp_packets; /* includes the drops */
+	}
+
+	/*
+	 * Frames rejected by a socket filter are not counted by the socket at
+	 * all, they are what the interface received but the filter did not pass.
+	 */
+	if (count_kfiltered &&
+	    (rx = get_rx_packets()) >= rx_packets_base + frames_passed)
+		frames_kfiltered = rx - rx_packets_base - frames_passed;
+}
+
+
+/*
+ * Compile the -B / -D frame type filters into a classic BPF program so that
+ * unwanted frames are discarded before they are queued to the socket. The
+ * accept verdict doubles as snap length which lets the kernel truncate the
+ * frames to the ring slot size as well.
+ */
+int build_filter(struct sock_filter *code, uint8_t filter_data,
+				 uint8_t filter_beacon, uint32_t snaplen)
+{
+	int i, n = 0;
+
+	/* require more data than the radiotap header itself */
+	code[n++] = (struct sock_filter)BPF_STMT(BPF_LD  | BPF_W | BPF_LEN, 0);
+	code[n++] = (struct sock_filter)BPF_JUMP(BPF_JMP | BPF_JGT | BPF_K,
+		sizeof(radiotap_hdr_t), 0, BPF_DROP);
+
+	/* X = le16(it_len) */
+	code[n++] = (struct sock_filter)BPF_STMT(BPF_LD  | BPF_B | BPF_ABS, 3);
+	code[n++] = (struct sock_filter)BPF_STMT(BPF_ALU | BPF_LSH | BPF_K, 8);
+	code[n++] = (struct sock_filter)BPF_STMT(BPF_MISC | BPF_TAX, 0);
+	code[n++] = (struct sock_filter)BPF_STMT(BPF_LD  | BPF_B | BPF_ABS, 2);
+	code[n++] = (struct sock_filter)BPF_STMT(BPF_ALU | BPF_OR | BPF_X, 0);
+	code[n++] = (struct sock_filter)BPF_STMT(BPF_MISC | BPF_TAX, 0);
+
+	/* the 802.11 header must follow the radiotap header */
+	code[n++] = (struct sock_filter)BPF_STMT(BPF_LD  | BPF_W | BPF_LEN, 0);
+	code[n++] = (struct sock_filter)BPF_JUMP(BPF_JMP | BPF_JGT | BPF_X,
+		0, 0, BPF_DROP);
+
+	if (filter_data || filter_beacon)
+	{
+		code[n++] = (struct sock_filter)BPF_STMT(BPF_LD  | BPF_B | BPF_IND, 0);
+		code[n++] = (struct sock_filter)BPF_STMT(BPF_ALU | BPF_AND | BPF_K,
+			FRAMETYPE_MASK);
+
+		if (filter_data)
+			code[n++] = (struct sock_filter)BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K,
+				FRAMETYPE_DATA, BPF_DROP, 0);
+
+		if (filter_beacon)
+			code[n++] = (struct sock_filter)BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K,
+				FRAMETYPE_BEACON, BPF_DROP, 0);
+	}
+
+	code[n++] = (struct sock_filter)BPF_STMT(BPF_RET | BPF_K, snaplen);
+	code[n++] = (struct sock_filter)BPF_STMT(BPF_RET | BPF_K, 0);
+
+	/* resolve the drop placeholders to the final "ret #0" */
+	for (i = 0; i < n; i++)
+	{
+		if (BPF_CLASS(code[i].code) != BPF_JMP)
+			continue;
+
+		if (code[i].jt == BPF_DROP)
+			code[i].jt = n - 2 - i;
+
+		if (code[i].jf == BPF_DROP)
+			code[i].jf = n - 2 - i;
+	}
+
+	return n;
+}
+
+/*
+ * Read a filter program in the decimal format emitted by "tcpdump -ddd",
+ * that is the instruction count followed by one "code jt jf k" line per
+ * instruction.
+ */
+int load_filter(const char *file, struct sock_filter *code)
+{
+	FILE *f;
+	int i, n;
+	unsigned int c, jt, jf, k;
+
+	if (!(f = fopen(file, "r")))
+		return -1;
+
+	if (fscanf(f, "%d", &n) != 1 || n <= 0 || n > BPF_MAX_INSNS)
+	{
+		fclose(f);
+		errno = EINVAL;
+		return -1;
+	}
+
+	for (i = 0; i < n; i++)
+	{
+		if (fscanf(f, "%u %u %u %u", &c, &jt, &jf, &k) != 4)
+		{
+			fclose(f);
+			errno = EINVAL;
+			return -1;
+		}
+
+		code[i].code = c;
+		code[i].jt   = jt;
+		code[i].jf   = jf;
+		code[i].k    = k;
+	}
+
+	fclose(f);
+
+	return n;
+}
+
+int attach_filter(struct sock_filter *code, int len)
+{
+	struct sock_fprog prog = {
+		.len    = len,
+		.filter = code
+	};
+
+	return setsockopt(capture_sock, SOL_SOCKET, SO_ATTACH_FILTER,
+					  &prog, sizeof(prog));
+}
+
+/* check a received frame against the -B / -D filters, nonzero to drop it */
+int filter_frame(uint8_t *buf, uint32_t caplen, uint32_t len,
+				 uint8_t filter_data, uint8_t filter_beacon)
+{
+	radiotap_hdr_t *rhdr = (radiotap_hdr_t *)buf;
+	uint8_t frametype;
+
+	if (caplen <= sizeof(radiotap_hdr_t) || le16(rhdr->it_len) >= len)
+		return 1;
+
+	/* the frame type may have been cut off by the in-kernel snap length */
+	if (le16(rhdr->it_len) >= caplen)
+		return 0;
+
+	frametype = buf[le16(rhdr->it_len)];
+
+	return ((filter_data   && (frametype & FRAMETYPE_MASK) == FRAMETYPE_DATA) ||
+	        (filter_beacon && (frametype & FRAMETYPE_MASK) == FRAMETYPE_BEACON));
+}
+
+
+/*
+ * Receive one frame. A socket filter may have cut it short, in which case
+ * the original length is taken from the PACKET_AUXDATA control message.
+ */
+ssize_t recv_frame(uint8_t *buf, size_t len, uint32_t *olen)
+{
+	struct tpacket_auxdata *aux;
+	struct cmsghdr *cmsg;
+	union {
+		struct cmsghdr hdr;
+		char buf[CMSG_SPACE(sizeof(struct tpacket_auxdata))];
+	} ctrl;
+	struct iovec iov = {
+		.iov_base = buf,
+		.iov_len  = len
+	};
+	struct msghdr mh = {
+		.msg_iov        = &iov,
+		.msg_iovlen     = 1,
+		.msg_control    = &ctrl,
+		.msg_controllen = sizeof(ctrl)
+	};
+	ssize_t n;
+
+	if ((n = recvmsg(capture_sock, &mh, 0)) < 0)
+		return n;
+
+	*olen = n;
+
+	for (cmsg = CMSG_FIRSTHDR(&mh); cmsg; cmsg = CMSG_NXTHDR(&mh, cmsg))
+	{
+		if (cmsg->cmsg_level != SOL_PACKET ||
+		    cmsg->cmsg_type != PACKET_AUXDATA)
+			continue;
+
+		aux = (struct tpacket_auxdata *)CMSG_DATA(cmsg);
+		*olen = aux->tp_len;
+	}
+
+	return n;
+}
+
 
 void sig_dump(int sig)
 {
@@ -195,6 +443,47 @@ void write_pcap_frame(FILE *o, uint32_t *sec, uint32_t *usec,
 	fwrite(&fhdr, 1, sizeof(fhdr), o);
 }
 
+int write_iov(int fd, struct iovec *iov, int cnt)
+{
+	ssize_t rv;
+	size_t n;
+
+	while (cnt > 0)
+	{
+		if ((rv = writev(fd, iov, cnt)) < 0)
+		{
+			if (errno == EINTR)
+				continue;
+
+			return -1;
+		}
+
+		n = (size_t)rv;
+
+		/* skip over fully written vectors and adjust a partial one */
+		while (cnt > 0 && n >= iov->iov_len)
+		{
+			n -= iov->iov_len;
+			iov++;
+			cnt--;
+		}
+
+		if (cnt > 0)
+		{
+			iov->iov_base = (uint8_t *)iov->iov_base + n;
+			iov->iov_len -= n;
+		}
+	}
+
+	return 0;
+}
+
+void stream_frames(struct iovec *iov, int nframes)
+{
+	if (nframes > 0 && write_iov(STDOUT_FILENO, iov, nframes * 2))
+		run_stop = 1;
+}
+
 
 struct ringbuf * ringbuf_init(uint32_t num_item, uint16_t len_item)
 {
@@ -254,6 +543,72 @@ void ringbuf_free(struct ringbuf *r)
 }
 
 
+int rx_ring_init(struct rx_ring *r)
+{
+	int ver = TPACKET_V3;
+	struct tpacket_req3 req = {
+		.tp_block_size     = RX_RING_BLOCK_SIZE,
+		.tp_block_nr       = RX_RING_BLOCK_NUM,
+		.tp_frame_size     = RX_RING_FRAME_SIZE,
+		.tp_frame_nr       = RX_RING_BLOCK_SIZE / RX_RING_FRAME_SIZE *
+		                     RX_RING_BLOCK_NUM,
+		.tp_retire_blk_tov = RX_RING_BLOCK_TMO
+	};
+
+	if (setsockopt(capture_sock, SOL_PACKET, PACKET_VERSION,
+				   &ver, sizeof(ver)))
+		return -1;
+
+	if (setsockopt(capture_sock, SOL_PACKET, PACKET_RX_RING,
+				   &req, sizeof(req)))
+		return -1;
+
+	r->map = mmap(NULL, req.tp_block_size * req.tp_block_nr,
+				  PROT_READ | PROT_WRITE, MAP_SHARED | MAP_LOCKED,
+				  capture_sock, 0);
+
+	if (r->map == MAP_FAILED)
+	{
+		r->map = NULL;
+		return -1;
+	}
+
+	r->block_size = req.tp_block_size;
+	r->block_nr = req.tp_block_nr;
+	r->cur = 0;
+
+	return 0;
+}
+
+struct tpacket_block_desc * rx_ring_next(struct rx_ring *r)
+{
+	struct tpacket_block_desc *bd;
+
+	bd = (struct tpacket_block_desc *)(r->map + r->cur * r->block_size);
+
+	if (!(bd->hdr.bh1.block_status & TP_STATUS_USER))
+		return NULL;
+
+	__sync_synchronize();
+
+	return bd;
+}
+
+void rx_ring_release(struct rx_ring *r, struct tpacket_block_desc *bd)
+{
+	__sync_synchronize();
+
+	bd->hdr.bh1.block_status = TP_STATUS_KERNEL;
+	r->cur = (r->cur + 1) % r->block_nr;
+}
+
+void rx_ring_free(struct rx_ring *r)
+{
+	munmap(r->map, r->block_size * r->block_nr);
+	memset(r, 0, sizeof(*r));
+}
+
+
 void msg(const char *fmt, ...)
 {
 	va_list ap;
@@ -271,18 +626,29 @@ void msg(const char *fmt, ...)
 int main(int argc, char **argv)
 {
 	int i, n;
-	struct ringbuf *ring;
+	struct ringbuf *ring = NULL;
 	struct ringbuf_entry *e;
+	struct rx_ring rx = { 0 };
+	struct tpacket_block_desc *bd;
+	struct tpacket3_hdr *th;
+	struct pollfd pfd;
 	struct sockaddr_ll local = {
 		.sll_family   = AF_PACKET,
 		.sll_protocol = htons(ETH_P_ALL)
 	};
 
-	radiotap_hdr_t *rhdr;
+	static struct sock_filter bpf[BPF_MAX_INSNS];
+	int bpf_len = 0;
 
-	uint8_t frametype;
+	struct iovec iov[IOV_BATCH * 2];
+	pcaprec_hdr_t rec[IOV_BATCH];
+	uint32_t j;
+	int nf;
+
+	uint8_t *data;
 	uint8_t pktbuf[0xFFFF];
 	ssize_t pktlen;
+	uint32_t olen;
 
 	FILE *o;
 
@@ -293,15 +659,18 @@ int main(int argc, char **argv)
 	uint8_t foreground     = 0;
 	uint8_t filter_data    = 0;
 	uint8_t filter_beacon  = 0;
+	uint8_t filter_kernel  = 0;
+	uint8_t use_mmap       = 0;
 	uint8_t header_written = 0;
 
 	uint32_t ringsz   = 1024 * 1024; /* 1 Mbyte ring buffer */
 	uint16_t pktcap   = 256;		 /* truncate frames after 265KB */
 
 	const char *output = NULL;
+	const char *filter_file = NULL;
 
 
-	while ((opt = getopt(argc, argv, "i:r:c:o:sfhBD")) != -1)
+	while ((opt = getopt(argc, argv, "i:r:c:o:F:sfhmkBD")) != -1)
 	{
 		switch (opt)
 		{
@@ -355,11 +724,24 @@ int main(int argc, char **argv)
 			foreground = 1;
 			break;
 
+		case 'm':
+			use_mmap = 1;
+			break;
+
+		case 'k':
+			filter_kernel = 1;
+			break;
+
+		case 'F':
+			filter_file = optarg;
+			break;
+
 		case 'h':
 			msg(
 				"Usage:\n"
-				"  %s -i {iface} -s [-b] [-d]\n"
+				"  %s -i {iface} -s [-B] [-D] [-m] [-k | -F file]\n"
 				"  %s -i {iface} -o {file} [-r len] [-c len] [-B] [-D] [-f]\n"
+				"      [-m] [-k | -F file]\n"
 				"\n"
 				"  -i iface\n"
 				"    Specify interface to use, must be in monitor mode and\n"
@@ -381,6 +763,15 @@ int main(int argc, char **argv)
 				"    Don't store data frames in ring, default is keep.\n\n"
 				"  -f\n"
 				"    Do not daemonize but keep running in foreground.\n\n"
+				"  -m\n"
+				"    Receive frames through a memory mapped TPACKET_V3 kernel\n"
+				"    ring instead of one system call per frame.\n\n"
+				"  -k\n"
+				"    Apply the -B and -D filters and the -c truncation in the\n"
+				"    kernel by attaching a BPF program to the socket.\n\n"
+				"  -F file\n"
+				"    Attach the BPF program read from file to the socket, the\n"
+				"    file format is the output of \"tcpdump -ddd\".\n\n"
 				"  -h\n"
 				"    Display this help.\n\n",
 				argv[0], argv[0], ringsz, pktcap);
@@ -407,6 +798,12 @@ int main(int argc, char **argv)
 		return 1;
 	}
 
+	if (filter_kernel && filter_file)
+	{
+		msg("The -k and -F options are exclusive\n");
+		return 1;
+	}
+
 	if (!local.sll_ifindex)
 	{
 		msg("No interface specified\n");
@@ -426,6 +823,38 @@ int main(int argc, char **argv)
 		return 6;
 	}
 
+	if (filter_kernel)
+		bpf_len = build_filter(bpf, filter_data, filter_beacon,
+							   streaming ? 0xFFFF : pktcap);
+	else if (filter_file && (bpf_len = load_filter(filter_file, bpf)) < 0)
+	{
+		msg("Unable to load filter from %s: %s\n",
+			filter_file, strerror(errno));
+		return 9;
+	}
+
+	/* attach before binding so that no unfiltered frames get queued */
+	if (bpf_len > 0 && attach_filter(bpf, bpf_len))
+	{
+		msg("Unable to attach filter: %s\n", strerror(errno));
+		return 9;
+	}
+
+	/* the filter truncates frames, ask for their original length */
+	if (bpf_len > 0 && !use_mmap &&
+	    setsockopt(capture_sock, SOL_PACKET, PACKET_AUXDATA, &(int){ 1 },
+					   sizeof(int)))
+	{
+		msg("Unable to enable auxiliary data: %s\n", strerror(errno));
+		return 9;
+	}
+
+	if (use_mmap && rx_ring_init(&rx))
+	{
+		msg("Unable to set up packet ring: %s\n", strerror(errno));
+		return 10;
+	}
+
 	if (bind(capture_sock, (struct sockaddr *)&local, sizeof(local)) == -1)
 	{
 		msg("Unable to bind to interface: %s\n",
@@ -433,6 +862,12 @@ int main(int argc, char **argv)
 		return 7;
 	}
 
+	if (bpf_len > 0)
+	{
+		count_kfiltered = 1;
+		rx_packets_base = get_rx_packets();
+	}
+
 	if (!streaming)
 	{
 		if (!foreground)
@@ -482,6 +917,13 @@ int main(int argc, char **argv)
 	msg(" * Beacon frames are %sfiltered\n", filter_beacon ? "" : "not ");
 	msg(" * Data frames are %sfiltered\n", filter_data ? "" : "not ");
 
+	if (use_mmap)
+		msg(" * Using packet ring with %d blocks of %d bytes\n",
+			rx.block_nr, rx.block_size);
+
+	if (bpf_len > 0)
+		msg(" * Filtering in kernel with %d BPF instructions\n", bpf_len);
+
 	signal(SIGINT, sig_teardown);
 	signal(SIGTERM, sig_teardown);
 
@@ -516,8 +958,11 @@ int main(int argc, char **argv)
 
 				fclose(o);
 
+				update_stats();
+
 				msg(" * %d frames captured\n", frames_captured);
-				msg(" * %d frames filtered\n", frames_filtered);
+				msg(" * %d frames filtered\n", frames_filtered + frames_kfiltered);
+				msg(" * %d frames dropped\n", frames_dropped);
 				msg(" * %d frames dumped\n", n);
 			}
 
@@ -533,25 +978,93 @@ int main(int argc, char **argv)
 			if (ring)
 				ringbuf_free(ring);
 
+			if (rx.map)
+				rx_ring_free(&rx);
+
 			return 0;
 		}
 
-		pktlen = recvfrom(capture_sock, pktbuf, sizeof(pktbuf), 0, NULL, 0);
-		frames_captured++;
+		/* consume one retired block of the kernel ring in place */
+		if (use_mmap)
+		{
+			if (!(bd = rx_ring_next(&rx)))
+			{
+				pfd.fd = capture_sock;
+				pfd.events = POLLIN | POLLERR;
+				pfd.revents = 0;
 
-		/* check received frametype, if we should filter it, rewind the ring */
-		rhdr = (radiotap_hdr_t *)pktbuf;
+				poll(&pfd, 1, -1);
+				continue;
+			}
 
-		if (pktlen <= sizeof(radiotap_hdr_t) || le16(rhdr->it_len) >= pktlen)
-		{
-			frames_filtered++;
+			if (streaming && !header_written)
+			{
+				write_pcap_header(stdout);
+				fflush(stdout);
+				header_written = 1;
+			}
+
+			th = (struct tpacket3_hdr *)((uint8_t *)bd +
+										 bd->hdr.bh1.offset_to_first_pkt);
+
+			for (j = 0, nf = 0; j < bd->hdr.bh1.num_pkts; j++,
+			     th = (struct tpacket3_hdr *)((uint8_t *)th + th->tp_next_offset))
+			{
+				data = (uint8_t *)th + th->tp_mac;
+				frames_captured++;
+
+				if (filter_frame(data, th->tp_snaplen, th->tp_len,
+								 filter_data, filter_beacon))
+				{
+					frames_filtered++;
+					continue;
+				}
+
+				if (streaming)
+				{
+					/* point the pcap record straight at the ring memory */
+					rec[nf].ts_sec   = th->tp_sec;
+					rec[nf].ts_usec  = th->tp_nsec / 1000;
+					rec[nf].incl_len = th->tp_snaplen;
+					rec[nf].orig_len = th->tp_len;
+
+					iov[nf * 2].iov_base     = &rec[nf];
+					iov[nf * 2].iov_len      = sizeof(rec[nf]);
+					iov[nf * 2 + 1].iov_base = data;
+					iov[nf * 2 + 1].iov_len  = th->tp_snaplen;
+
+					if (++nf == IOV_BATCH)
+					{
+						stream_frames(iov, nf);
+						nf = 0;
+					}
+				}
+				else
+				{
+					e = ringbuf_add(ring);
+					e->sec  = th->tp_sec;
+					e->usec = th->tp_nsec / 1000;
+					e->olen = th->tp_len;
+					e->len  = (th->tp_snaplen > pktcap) ? pktcap : th->tp_snaplen;
+
+					memcpy((void *)e + sizeof(*e), data, e->len);
+				}
+			}
+
+			if (streaming)
+				stream_frames(iov, nf);
+
+			rx_ring_release(&rx, bd);
 			continue;
 		}
 
-		frametype = *(uint8_t *)(pktbuf + le16(rhdr->it_len));
+		if ((pktlen = recv_frame(pktbuf, sizeof(pktbuf), &olen)) < 0)
+			continue;
+
+		frames_captured++;
 
-		if ((filter_data   && (frametype & FRAMETYPE_MASK) == FRAMETYPE_DATA) ||
-		    (filter_beacon && (frametype & FRAMETYPE_MASK) == FRAMETYPE_BEACON))
+		/* check received frametype, if we should filter it, rewind the ring */
+		if (filter_frame(pktbuf, pktlen, olen, filter_data, filter_beacon))
 		{
 			frames_filtered++;
 			continue;
@@ -565,14 +1078,14 @@ int main(int argc, char **argv)
 				header_written = 1;
 			}
 
-			write_pcap_frame(stdout, NULL, NULL, pktlen, pktlen);
+			write_pcap_frame(stdout, NULL, NULL, pktlen, olen);
 			fwrite(pktbuf, 1, pktlen, stdout);
 			fflush(stdout);
 		}
 		else
 		{
 			e = ringbuf_add(ring);
-			e->olen = pktlen;
+			e->olen = olen;
 			e->len = (pktlen > pktcap) ? pktcap : pktlen;
 
 			memcpy((void *)e + sizeof(*e), pktbuf, e->len);
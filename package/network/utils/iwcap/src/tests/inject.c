@@ -0,0 +1,110 @@
+/*
+ * inject - send radiotap frames for the iwcap benchmark, or count them
+ *
+ *   inject {iface} {len} {seconds}
+ *     Send frames of len bytes for the given time, alternating between
+ *     data and beacon frames, and print the number sent.
+ *
+ *   inject -c {file} {len}
+ *     Count the frames in a pcap file whose original length is len.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/socket.h>
+#include <net/if.h>
+#include <linux/if_packet.h>
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int count(const char *file, uint32_t len)
+{
+	uint32_t rec[4];
+	unsigned long n = 0;
+	FILE *f;
+
+	if (!(f = fopen(file, "r")) || fseek(f, 24, SEEK_SET))
+	{
+		perror(file);
+		return 1;
+	}
+
+	/* ts_sec, ts_usec, incl_len, orig_len */
+	while (fread(rec, sizeof(rec), 1, f) == 1)
+	{
+		if (rec[3] == len)
+			n++;
+
+		if (fseek(f, rec[2], SEEK_CUR))
+			break;
+	}
+
+	fclose(f);
+	printf("%lu\n", n);
+
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	struct sockaddr_ll addr = {
+		.sll_family = AF_PACKET,
+		.sll_halen  = 6
+	};
+	uint8_t frame[2048];
+	unsigned long i = 0, n = 0;
+	double end;
+	int len, sock;
+
+	if (argc == 4 && !strcmp(argv[1], "-c"))
+		return count(argv[2], atoi(argv[3]));
+
+	if (argc != 4)
+	{
+		fprintf(stderr, "Usage: %s {iface} {len} {seconds}\n"
+				"       %s -c {file} {len}\n", argv[0], argv[0]);
+		return 1;
+	}
+
+	len = atoi(argv[2]);
+	if (len < 32 || len > (int)sizeof(frame))
+	{
+		fprintf(stderr, "Frame length must be 32 to %zu bytes\n", sizeof(frame));
+		return 1;
+	}
+
+	if (!(addr.sll_ifindex = if_nametoindex(argv[1])) ||
+	    (sock = socket(PF_PACKET, SOCK_RAW, 0)) < 0)
+	{
+		perror(argv[1]);
+		return 1;
+	}
+
+	/* empty radiotap header followed by an 802.11 header and payload */
+	memset(frame, 0xaa, sizeof(frame));
+	memset(frame, 0, 8);
+	frame[2] = 8;
+
+	end = now() + atof(argv[3]);
+	do
+	{
+		frame[8] = (n & 1) ? 0x80 : 0x08;	/* beacon : data */
+		if (sendto(sock, frame, len, 0, (struct sockaddr *)&addr,
+				   sizeof(addr)) == len)
+			n++;
+	}
+	while ((++i & 1023) || now() < end);
+
+	printf("%lu\n", n);
+
+	return 0;
+}
@@ -0,0 +1,96 @@
+#!/bin/sh
+#
+# iwcap-bench.sh - compare the capture paths of iwcap
+#
+# Injects frames on one interface for a few seconds while iwcap streams
+# from the other, and reports how many of them each mode captured. Then
+# runs a filtered, truncating dump to show the frame counters and checks
+# that the original frame length survived the truncation.
+#
+# By default two mac80211_hwsim radios with monitor interfaces are used.
+# With -v a veth pair is used instead; it does not produce radiotap
+# frames, so iwcap is built from a copy with the interface check removed.
+#
+# Usage: iwcap-bench.sh [-v] [-l len] [-t seconds]
+# Needs root, a C compiler and, without -v, iw and mac80211_hwsim.
+#
+
+len=400
+secs=3
+veth=0
+
+while getopts "vl:t:" opt; do
+	case "$opt" in
+		v) veth=1 ;;
+		l) len="$OPTARG" ;;
+		t) secs="$OPTARG" ;;
+		*) echo "Usage: $0 [-v] [-l len] [-t seconds]" >&2; exit 1 ;;
+	esac
+done
+
+src="$(cd "$(dirname "$0")/.." && pwd)"
+work="$(mktemp -d)"
+tx=iwb0
+rx=iwb1
+
+cleanup() {
+	ip link del $tx 2>/dev/null
+	[ $veth = 1 ] || iw dev $rx del 2>/dev/null
+	rm -rf "$work"
+}
+trap cleanup EXIT
+
+if [ $veth = 1 ]; then
+	sed 's/if (!check_type())/if (0)/' "$src/iwcap.c" > "$work/iwcap.c"
+	ip link add $tx type veth peer name $rx || exit 1
+else
+	cp "$src/iwcap.c" "$work/iwcap.c"
+	modprobe mac80211_hwsim radios=2 || exit 1
+	set -- $(ls /sys/devices/virtual/mac80211_hwsim/*/ieee80211 | tail -n 2)
+	iw phy "$1" interface add $tx type monitor || exit 1
+	iw phy "$2" interface add $rx type monitor || exit 1
+fi
+
+cc -O2 -o "$work/iwcap" "$work/iwcap.c" || exit 1
+cc -O2 -o "$work/inject" "$src/tests/inject.c" || exit 1
+
+ip link set $tx up
+ip link set $rx up
+[ $veth = 1 ] || { iw dev $tx set channel 1; iw dev $rx set channel 1; }
+
+stream() {
+	"$work/iwcap" -i $rx -s "$@" > "$work/out.pcap" 2>/dev/null &
+	pid=$!
+	sleep 1
+	sent=$("$work/inject" $tx $len $secs)
+	sleep 1
+	kill $pid
+	wait $pid 2>/dev/null
+	got=$("$work/inject" -c "$work/out.pcap" $len)
+	printf "  %-10s %9d of %9d frames captured\n" "${*:-recvfrom}" $got $sent
+}
+
+dump() {
+	"$work/iwcap" -i $rx -o "$work/dump.pcap" -f -r 6400000 "$@" \
+		2> "$work/log" &
+	pid=$!
+	sleep 1
+	sent=$("$work/inject" $tx $len $secs)
+	sleep 1
+	kill -USR1 $pid
+	sleep 1
+	kill $pid
+	wait $pid 2>/dev/null
+	echo "  $* ($sent sent, half of them data frames):"
+	grep -E "[0-9]+ frames" "$work/log" | sed 's/^/  /'
+	echo "    * $("$work/inject" -c "$work/dump.pcap" $len) frames dumped with their original length"
+}
+
+echo "Streaming $len byte frames for $secs seconds:"
+stream
+stream -m
+stream -m -k
+
+echo "Dumping with the data frames filtered and truncated to 64 bytes:"
+dump -k -D -c 64
+dump -m -k -D -c 64
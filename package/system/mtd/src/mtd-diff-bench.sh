@@ -0,0 +1,81 @@
+#!/bin/sh
+#
+# Time "mtd write" against "mtd -D write" on an emulated flash device
+#
+# Loads mtdram (NOR) or nandsim (NAND, -n), writes a random base image, then
+# changes a percentage of its erase blocks and flashes the result once with a
+# full write and once with the differential write, restoring the base image
+# in between. Both results are read back and compared with the new image.
+#
+# Needs root, the mtdram/nandsim modules and the mtd binary to test:
+#   MTD=./mtd ./mtd-diff-bench.sh [-n] [<size MB> [<changed %>]]
+
+MTD=${MTD:-mtd}
+nand=0
+[ "$1" = "-n" ] && { nand=1; shift; }
+size=${1:-16}
+changed=${2:-10}
+tmp=$(mktemp -d) || exit 1
+
+now() {
+	cat /proc/uptime | cut -d' ' -f1
+}
+
+cleanup() {
+	rm -rf "$tmp"
+	rmmod mtdram nandsim 2>/dev/null
+}
+trap cleanup EXIT
+
+if [ $nand = 1 ]; then
+	# 128 MiB, 2 KiB pages, 128 KiB erase blocks
+	modprobe nandsim first_id_byte=0xec second_id_byte=0xa1 \
+		third_id_byte=0x00 fourth_id_byte=0x15 || exit 1
+	name="NAND simulator"
+	[ $size -le 120 ] || { echo "nandsim holds at most 120 MB here"; exit 1; }
+else
+	modprobe mtdram total_size=$((size * 1024 + 1024)) erase_size=64 || exit 1
+	name="mtdram test device"
+fi
+
+mtd=$(grep "\"$name" /proc/mtd | cut -d: -f1)
+[ -n "$mtd" ] || { echo "no $name in /proc/mtd"; exit 1; }
+erasesize=$((0x$(grep "^$mtd:" /proc/mtd | cut -d' ' -f3)))
+blocks=$((size * 1024 * 1024 / erasesize))
+
+head -c $((blocks * erasesize)) /dev/urandom > "$tmp/base"
+cp "$tmp/base" "$tmp/new"
+n=$((blocks * changed / 100))
+i=0
+while [ $i -lt $n ]; do
+	# spread the changed blocks evenly over the image
+	dd if=/dev/urandom of="$tmp/new" bs=$erasesize count=1 conv=notrunc \
+		seek=$((i * blocks / n)) 2>/dev/null
+	i=$((i + 1))
+done
+
+run() {
+	local start end
+
+	"$MTD" -q write "$tmp/base" $mtd || exit 1
+	sync
+	start=$(now)
+	"$MTD" "$@" write "$tmp/new" $mtd || {
+		echo "$*: mtd write failed" >&2
+		exit 1
+	}
+	end=$(now)
+	head -c $((blocks * erasesize)) /dev/$mtd | cmp -s - "$tmp/new" || {
+		echo "$*: data read back differs" >&2
+		exit 1
+	}
+	echo "$start $end"
+}
+
+echo "$mtd ($name): $blocks blocks of $erasesize bytes, $n changed"
+full=$(run -q) || exit 1
+diff=$(run -D) || exit 1
+echo "$full $diff" | awk '{
+	printf "full write:         %.2fs\n", $2 - $1
+	printf "differential write: %.2fs\n", $4 - $3
+}'
@@ -30,6 +30,7 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <signal.h>
+#include <pthread.h>
 #include <sys/ioctl.h>
 #include <sys/syscall.h>
 #include <fcntl.h>
@@ -51,6 +52,7 @@
 #include <libubox/md5.h>
 
 #define MAX_ARGS 8
+#define PIPE_BUFS 8
 #define JFFS2_DEFAULT_DIR	"" /* directory name without /, empty means root dir */
 
 #define TRX_MAGIC		0x48445230	/* "HDR0" */
@@ -90,6 +92,9 @@ static char *tpl_uboot_args_part;
 static int buflen = 0;
 int quiet;
 int no_erase;
+int diff_write;
+int pipelined;
+int verbose;
 int mtdsize = 0;
 int erasesize = 0;
 int jffs2_skip_bytes=0;
@@ -456,6 +461,200 @@ out:
 	return ret;
 }
 
+/*
+ * Check whether the erase block at offset already holds the given data,
+ * so that a differential write can leave it alone.
+ */
+static int
+mtd_block_unchanged(int fd, size_t offset, const char *data)
+{
+	static char *cmpbuf = NULL;
+	static int cmplen = 0;
+	ssize_t r, len = 0;
+
+	if (cmplen < erasesize) {
+		free(cmpbuf);
+		cmpbuf = malloc(erasesize);
+		if (!cmpbuf) {
+			cmplen = 0;
+			return 0;
+		}
+		cmplen = erasesize;
+	}
+
+	while (len < erasesize) {
+		r = pread(fd, cmpbuf + len, erasesize - len, offset + len);
+		if (r < 0 && errno == EINTR)
+			continue;
+		if (r <= 0)
+			return 0;
+		len += r;
+	}
+
+	return !memcmp(cmpbuf, data, erasesize);
+}
+
+/*
+ * Pipelined mode: a reader thread streams the image into a ring of
+ * erase block sized buffers, so that receiving the next block (e.g.
+ * from a pipe fed by wget) overlaps with erasing and programming
+ * the current one.
+ */
+static struct {
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	int fd;
+	int size;
+	char *data[PIPE_BUFS];
+	int len[PIPE_BUFS];
+	int head, tail, count, pos;
+	int eof, error;
+} pipe_ring = {
+	.lock = PTHREAD_MUTEX_INITIALIZER,
+	.cond = PTHREAD_COND_INITIALIZER,
+};
+
+enum {
+	STAGE_READ,
+	STAGE_COMPARE,
+	STAGE_ERASE,
+	STAGE_WRITE,
+	STAGE_VERIFY,
+	__STAGE_MAX
+};
+
+static const char * const stage_names[__STAGE_MAX] = {
+	[STAGE_READ] = "read",
+	[STAGE_COMPARE] = "compare",
+	[STAGE_ERASE] = "erase",
+	[STAGE_WRITE] = "write",
+	[STAGE_VERIFY] = "verify",
+};
+
+static double stage_time[__STAGE_MAX];
+
+static double
+time_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void *
+pipe_reader(void *arg)
+{
+	ssize_t r;
+	int len;
+
+	for (;;) {
+		pthread_mutex_lock(&pipe_ring.lock);
+		while (pipe_ring.count == PIPE_BUFS)
+			pthread_cond_wait(&pipe_ring.cond, &pipe_ring.lock);
+		pthread_mutex_unlock(&pipe_ring.lock);
+
+		len = 0;
+		while (len < pipe_ring.size) {
+			r = read(pipe_ring.fd, pipe_ring.data[pipe_ring.head] + len,
+				 pipe_ring.size - len);
+			if (r < 0) {
+				if ((errno == EINTR) || (errno == EAGAIN))
+					continue;
+				pipe_ring.error = errno;
+				break;
+			}
+			if (r == 0)
+				break;
+			len += r;
+		}
+
+		pthread_mutex_lock(&pipe_ring.lock);
+		if (len > 0) {
+			pipe_ring.len[pipe_ring.head] = len;
+			pipe_ring.head = (pipe_ring.head + 1) % PIPE_BUFS;
+			pipe_ring.count++;
+		}
+		if (len < pipe_ring.size)
+			pipe_ring.eof = 1;
+		pthread_cond_broadcast(&pipe_ring.cond);
+		pthread_mutex_unlock(&pipe_ring.lock);
+
+		if (len < pipe_ring.size)
+			break;
+	}
+
+	return NULL;
+}
+
+static int
+pipe_start(int imagefd)
+{
+	int i;
+
+	pipe_ring.fd = imagefd;
+	pipe_ring.size = erasesize;
+	for (i = 0; i < PIPE_BUFS; i++) {
+		pipe_ring.data[i] = malloc(pipe_ring.size);
+		if (!pipe_ring.data[i])
+			return -1;
+	}
+
+	return pthread_create(&pipe_ring.thread, NULL, pipe_reader, NULL) ? -1 : 0;
+}
+
+static void
+pipe_stop(void)
+{
+	int i;
+
+	pthread_join(pipe_ring.thread, NULL);
+	for (i = 0; i < PIPE_BUFS; i++)
+		free(pipe_ring.data[i]);
+}
+
+static ssize_t
+image_read(int imagefd, char *data, size_t len)
+{
+	double start = time_now();
+	ssize_t r = 0;
+	int *cur;
+
+	if (!pipelined) {
+		r = read(imagefd, data, len);
+		goto out;
+	}
+
+	pthread_mutex_lock(&pipe_ring.lock);
+	while (!pipe_ring.count && !pipe_ring.eof)
+		pthread_cond_wait(&pipe_ring.cond, &pipe_ring.lock);
+
+	if (pipe_ring.count) {
+		cur = &pipe_ring.len[pipe_ring.tail];
+		r = *cur - pipe_ring.pos;
+		if (r > len)
+			r = len;
+
+		memcpy(data, pipe_ring.data[pipe_ring.tail] + pipe_ring.pos, r);
+		pipe_ring.pos += r;
+		if (pipe_ring.pos == *cur) {
+			pipe_ring.tail = (pipe_ring.tail + 1) % PIPE_BUFS;
+			pipe_ring.count--;
+			pipe_ring.pos = 0;
+			pthread_cond_broadcast(&pipe_ring.cond);
+		}
+	} else if (pipe_ring.error) {
+		errno = pipe_ring.error;
+		r = -1;
+	}
+	pthread_mutex_unlock(&pipe_ring.lock);
+
+out:
+	stage_time[STAGE_READ] += time_now() - start;
+	return r;
+}
+
 static void
 indicate_writing(const char *mtd)
 {
@@ -478,6 +677,14 @@ mtd_write(int imagefd, const char *mtd, char *fis_layout, size_t part_offset)
 	int buflen_raw = 0;
 	int jffs2_replaced = 0;
 	int skip_bad_blocks = 0;
+	int blocks_written = 0, blocks_skipped = 0;
+	int unchanged;
+	uint32_t f_md5[4], m_md5[4];
+	md5_ctx_t f_ctx, m_ctx;
+	char *vbuf = NULL;
+	int verify = 0;
+	double start;
+	int i;
 
 #ifdef FIS_SUPPORT
 	static struct fis_part new_parts[MAX_ARGS];
@@ -544,6 +751,25 @@ next:
 
 	r = 0;
 
+	if (pipelined) {
+		if (pipe_start(imagefd) < 0) {
+			fprintf(stderr, "Failed to start the image reader\n");
+			exit(1);
+		}
+
+		/*
+		 * hash the image and read back what was written while streaming,
+		 * unless the flash contents are meant to differ from the image
+		 */
+		if (!jffs2file)
+			vbuf = malloc(erasesize);
+		if (vbuf) {
+			verify = 1;
+			md5_begin(&f_ctx);
+			md5_begin(&m_ctx);
+		}
+	}
+
 resume:
 	next = strchr(mtd, ':');
 	if (next) {
@@ -578,7 +804,7 @@ resume:
 	for (;;) {
 		/* buffer may contain data already (from trx check or last mtd partition write attempt) */
 		while (buflen < erasesize) {
-			r = read(imagefd, buf + buflen, erasesize - buflen);
+			r = image_read(imagefd, buf + buflen, erasesize - buflen);
 			if (r < 0) {
 				if ((errno == EINTR) || (errno == EAGAIN))
 					continue;
@@ -600,6 +826,9 @@ resume:
 		if (buflen == 0)
 			break;
 
+		if (verify)
+			md5_hash(buf, buflen_raw, &f_ctx);
+
 		if (buflen < erasesize) {
 			/* Pad block to eraseblock size */
 			memset(&buf[buflen], 0xff, erasesize - buflen);
@@ -642,8 +871,29 @@ resume:
 			mtd_parse_jffs2data(buf, jffs2dir);
 		}
 
+		/*
+		 * in differential mode, leave a block alone if it maps onto a
+		 * fresh erase block that already holds exactly this data
+		 */
+		start = time_now();
+		unchanged = diff_write && !no_erase && !offset &&
+			w == e - skip_bad_blocks &&
+			!mtd_block_is_bad(fd, e) &&
+			mtd_block_unchanged(fd, e + part_offset, buf);
+
+		if (unchanged) {
+			if (!quiet)
+				fprintf(stderr, "\b\b\b[s]");
+
+			e += erasesize;
+			lseek(fd, buflen, SEEK_CUR);
+			blocks_skipped++;
+		}
+		stage_time[STAGE_COMPARE] += time_now() - start;
+		start = time_now();
+
 		/* need to erase the next block before writing data to it */
-		if(!no_erase)
+		if(!no_erase && !unchanged)
 		{
 			while (w + buflen > e - skip_bad_blocks) {
 				if (!quiet)
@@ -669,6 +919,7 @@ resume:
 						}
 						w = 0;
 						e = 0;
+						verify = 0;
 						close(fd);
 						mtd = next;
 						fprintf(stderr, "\b\b\b   \n");
@@ -684,19 +935,38 @@ resume:
 			}
 		}
 
-		if (!quiet)
-			fprintf(stderr, "\b\b\b[w]");
+		stage_time[STAGE_ERASE] += time_now() - start;
+		start = time_now();
 
-		if ((result = write(fd, buf + offset, buflen)) < buflen) {
-			if (result < 0) {
-				fprintf(stderr, "Error writing image.\n");
-				exit(1);
-			} else {
-				fprintf(stderr, "Insufficient space.\n");
-				exit(1);
+		if (!unchanged) {
+			if (!quiet)
+				fprintf(stderr, "\b\b\b[w]");
+
+			if ((result = write(fd, buf + offset, buflen)) < buflen) {
+				if (result < 0) {
+					fprintf(stderr, "Error writing image.\n");
+					exit(1);
+				} else {
+					fprintf(stderr, "Insufficient space.\n");
+					exit(1);
+				}
 			}
+			blocks_written++;
 		}
 		w += buflen;
+		stage_time[STAGE_WRITE] += time_now() - start;
+
+		if (verify) {
+			start = time_now();
+			if (unchanged) {
+				md5_hash(buf, buflen_raw, &m_ctx);
+			} else {
+				r = pread(fd, vbuf, buflen_raw, lseek(fd, 0, SEEK_CUR) - buflen);
+				if (r > 0)
+					md5_hash(vbuf, r, &m_ctx);
+			}
+			stage_time[STAGE_VERIFY] += time_now() - start;
+		}
 
 #ifdef FIS_SUPPORT
 		if (cur_part && cur_part->size
@@ -713,6 +983,9 @@ resume:
 		offset = 0;
 	}
 
+	if (pipelined)
+		pipe_stop();
+
 	if (jffs2_replaced) {
 		switch (imageformat) {
 		case MTD_IMAGE_FORMAT_TRX:
@@ -742,6 +1015,10 @@ resume:
 	if (quiet < 2)
 		fprintf(stderr, "\n");
 
+	if (diff_write && quiet < 2)
+		fprintf(stderr, "%d blocks written, %d unchanged blocks skipped\n",
+			blocks_written, blocks_skipped);
+
 #ifdef FIS_SUPPORT
 	if (fis_layout) {
 		if (fis_remap(old_parts, n_old, new_parts, n_new) < 0)
@@ -750,6 +1027,29 @@ resume:
 #endif
 
 	close(fd);
+	free(vbuf);
+
+	if (verbose) {
+		fprintf(stderr, "Time spent:");
+		for (i = 0; i < __STAGE_MAX; i++)
+			fprintf(stderr, " %s %.2fs", stage_names[i], stage_time[i]);
+		fprintf(stderr, "\n");
+	}
+
+	if (verify) {
+		md5_end(f_md5, &f_ctx);
+		md5_end(m_md5, &m_ctx);
+
+		if (quiet < 2) {
+			fprintf(stderr, "%08x%08x%08x%08x - %s\n", m_md5[0], m_md5[1], m_md5[2], m_md5[3], mtd);
+			fprintf(stderr, "%08x%08x%08x%08x - %s\n", f_md5[0], f_md5[1], f_md5[2], f_md5[3], imagefile);
+		}
+
+		if (memcmp(f_md5, m_md5, sizeof(m_md5))) {
+			fprintf(stderr, "Failed to verify %s\n", mtd);
+			exit(1);
+		}
+	}
 
 	/* Clear TP-Link recovery flag */
 	if (tpl_uboot_args_part && mtd_tpl_recoverflag_write) {
@@ -801,6 +1101,11 @@ static void usage(void)
 	"        -q                      quiet mode (once: no [w] on writing,\n"
 	"                                           twice: no status messages)\n"
 	"        -n                      write without first erasing the blocks\n"
+	"        -D                      differential write: only erase and write the blocks\n"
+	"                                whose contents differ from the image\n"
+	"        -P                      pipelined write: read the image ahead in a separate\n"
+	"                                thread and verify the written data while streaming\n"
+	"        -v                      show the time spent in each stage of a write\n"
 	"        -r                      reboot after successful command\n"
 	"        -f                      force write without trx checks\n"
 	"        -e <device>             erase <device> before executing the command\n"
@@ -874,12 +1179,15 @@ int main (int argc, char **argv)
 	buflen = 0;
 	quiet = 0;
 	no_erase = 0;
+	diff_write = 0;
+	pipelined = 0;
+	verbose = 0;
 
 	while ((ch = getopt(argc, argv,
 #ifdef FIS_SUPPORT
 			"F:"
 #endif
-			"frnqe:d:s:j:p:o:c:t:l:M:")) != -1)
+			"frnDPvqe:d:s:j:p:o:c:t:l:M:")) != -1)
 		switch (ch) {
 			case 'f':
 				force = 1;
@@ -890,6 +1198,15 @@ int main (int argc, char **argv)
 			case 'n':
 				no_erase = 1;
 				break;
+			case 'D':
+				diff_write = 1;
+				break;
+			case 'P':
+				pipelined = 1;
+				break;
+			case 'v':
+				verbose = 1;
+				break;
 			case 'j':
 				jffs2file = optarg;
 				break;
@@ -0,0 +1,200 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * benchconf - time menuconfig style symbol toggles
+ *
+ * Parses a Kconfig tree, optionally loads a .config, then repeatedly toggles
+ * a random changeable bool or tristate symbol. Each toggle is followed by
+ * recalculating every symbol, as a save does, and by a walk of the whole
+ * menu tree checking visibility, as a redraw does. Both are timed apart,
+ * since menu_is_visible() evaluates its expressions on every call whether
+ * or not the symbols are valid.
+ *
+ *   -a		invalidate every symbol on each toggle, like before the
+ *		dependency tracking in symbol.c
+ *   -v		check each result against a full revalidation
+ *   -n <count>	number of toggles (default 1000)
+ *   -r <file>	load this .config first
+ *
+ * For the OpenWrt tree, run "make prepare-tmpinfo" first so the generated
+ * files under tmp/ exist, then run "scripts/config/benchconf -r .config
+ * Config.in" from the top directory.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "lkc.h"
+
+static struct symbol **candidates;
+static int n_candidates;
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void walk_menu(struct menu *menu)
+{
+	struct menu *child;
+
+	if (menu->sym)
+		sym_calc_value(menu->sym);
+	menu_is_visible(menu);
+
+	for (child = menu->list; child; child = child->next)
+		walk_menu(child);
+}
+
+static void collect(struct menu *menu)
+{
+	struct symbol *sym = menu->sym;
+	struct menu *child;
+
+	if (sym && menu->prompt && !sym_is_choice(sym) &&
+	    (sym->type == S_BOOLEAN || sym->type == S_TRISTATE)) {
+		candidates = xrealloc(candidates, (n_candidates + 1) * sizeof(*candidates));
+		candidates[n_candidates++] = sym;
+	}
+
+	for (child = menu->list; child; child = child->next)
+		collect(child);
+}
+
+static void calc_all(void)
+{
+	struct symbol *sym;
+	int i;
+
+	for_all_symbols(i, sym)
+		sym_calc_value(sym);
+}
+
+static char **snapshot(void)
+{
+	struct symbol *sym;
+	char **values;
+	int i, n = 0;
+
+	for_all_symbols(i, sym)
+		n++;
+
+	values = xmalloc(n * sizeof(*values));
+	n = 0;
+	for_all_symbols(i, sym)
+		values[n++] = xstrdup(sym_get_string_value(sym));
+
+	return values;
+}
+
+/* compare the current values with the ones of a full revalidation */
+static int verify(int step)
+{
+	struct symbol *sym;
+	char **values;
+	int i, n = 0, bad = 0;
+
+	values = snapshot();
+	sym_clear_all_valid();
+	walk_menu(&rootmenu);
+
+	for_all_symbols(i, sym) {
+		const char *val = sym_get_string_value(sym);
+
+		if (strcmp(values[n], val)) {
+			fprintf(stderr, "toggle %d: %s is %s, expected %s\n",
+				step, sym->name ? sym->name : "<choice>",
+				values[n], val);
+			bad++;
+		}
+		free(values[n++]);
+	}
+	free(values);
+
+	return bad;
+}
+
+int main(int ac, char **av)
+{
+	const char *config = NULL;
+	int count = 1000, full = 0, check = 0;
+	int i, opt, toggled = 0, bad = 0;
+	struct symbol *sym;
+	double start, recalc = 0, redraw = 0;
+
+	while ((opt = getopt(ac, av, "avn:r:")) != -1) {
+		switch (opt) {
+		case 'a':
+			full = 1;
+			break;
+		case 'v':
+			check = 1;
+			break;
+		case 'n':
+			count = atoi(optarg);
+			break;
+		case 'r':
+			config = optarg;
+			break;
+		default:
+			goto usage;
+		}
+	}
+	if (ac != optind + 1 || count <= 0)
+		goto usage;
+
+	conf_set_message_callback(NULL);
+	conf_parse(av[optind]);
+	if (conf_read(config) && config) {
+		fprintf(stderr, "%s: failed to read the configuration\n", av[0]);
+		return 1;
+	}
+
+	collect(&rootmenu);
+	if (!n_candidates) {
+		fprintf(stderr, "%s: no symbols to toggle\n", av[0]);
+		return 1;
+	}
+
+	srand(1);
+	walk_menu(&rootmenu);
+
+	for (i = 0; i < count; i++) {
+		sym = candidates[rand() % n_candidates];
+
+		start = now();
+		if (sym_is_changeable(sym)) {
+			sym_toggle_tristate_value(sym);
+			if (full)
+				sym_clear_all_valid();
+			toggled++;
+		}
+		calc_all();
+		recalc += now() - start;
+
+		start = now();
+		walk_menu(&rootmenu);
+		redraw += now() - start;
+
+		if (check)
+			bad += verify(i);
+	}
+
+	printf("%d symbols, %d toggled of %d tries%s\n", n_candidates, toggled,
+	       count, full ? ", full invalidation" : "");
+	printf("per toggle: %.1f us recalculating symbols, %.1f us walking menus\n",
+	       recalc * 1e6 / count, redraw * 1e6 / count);
+	if (check)
+		printf("%d mismatches against full revalidation\n", bad);
+
+	return !!bad;
+
+usage:
+	fprintf(stderr, "Usage: %s [-a] [-v] [-n count] [-r .config] <kconfig-file>\n", av[0]);
+	return 1;
+}
@@ -450,6 +450,146 @@ void sym_clear_all_valid(void)
 	sym_calc_value(modules_sym);
 }
 
+static void sym_add_dependent(struct symbol *sym, struct symbol *dep)
+{
+	int n;
+
+	if (!sym || sym == dep || sym->flags & SYMBOL_CONST)
+		return;
+
+	n = sym->dependents_count;
+	if (n && sym->dependents[n - 1] == dep)
+		return;
+
+	/* grow the array whenever its size reaches a power of two */
+	if (!(n & (n - 1)))
+		sym->dependents = xrealloc(sym->dependents,
+					   (n ? n * 2 : 1) * sizeof(*sym->dependents));
+	sym->dependents[sym->dependents_count++] = dep;
+}
+
+static void expr_add_dependent(struct expr *e, struct symbol *dep)
+{
+	if (!e)
+		return;
+
+	switch (e->type) {
+	case E_SYMBOL:
+		sym_add_dependent(e->left.sym, dep);
+		break;
+	case E_NOT:
+		expr_add_dependent(e->left.expr, dep);
+		break;
+	case E_OR:
+	case E_AND:
+		expr_add_dependent(e->left.expr, dep);
+		expr_add_dependent(e->right.expr, dep);
+		break;
+	case E_LIST:
+		sym_add_dependent(e->right.sym, dep);
+		expr_add_dependent(e->left.expr, dep);
+		break;
+	case E_EQUAL:
+	case E_UNEQUAL:
+	case E_LTH:
+	case E_LEQ:
+	case E_GTH:
+	case E_GEQ:
+	case E_RANGE:
+		sym_add_dependent(e->left.sym, dep);
+		sym_add_dependent(e->right.sym, dep);
+		break;
+	default:
+		;
+	}
+}
+
+/*
+ * Record every symbol as a dependent of the symbols its dependencies and
+ * properties refer to. This is a superset of what sym_calc_value() reads:
+ * choices and their values refer to each other through their P_CHOICE
+ * properties, and selects/implies show up in the target's rev_dep/implied.
+ * The expression of a select or imply property names its target, which the
+ * selecting symbol's own value never reads, so those are skipped; otherwise
+ * a library would link all of its selectors into one invalidation closure.
+ */
+static void sym_build_dependents(void)
+{
+	struct symbol *sym;
+	struct property *prop;
+	int i;
+
+	for_all_symbols(i, sym) {
+		expr_add_dependent(sym->dir_dep.expr, sym);
+		expr_add_dependent(sym->rev_dep.expr, sym);
+		expr_add_dependent(sym->implied.expr, sym);
+		for (prop = sym->prop; prop; prop = prop->next) {
+			if (prop->type != P_SELECT && prop->type != P_IMPLY)
+				expr_add_dependent(prop->expr, sym);
+			expr_add_dependent(prop->visible.expr, sym);
+		}
+	}
+}
+
+/*
+ * Invalidate sym and everything that is (transitively) calculated from it.
+ * Used instead of sym_clear_all_valid() when a single user value changed,
+ * so only the affected part of the tree is recalculated on the next lookup.
+ */
+static void sym_invalidate(struct symbol *sym)
+{
+	static struct symbol **queue;
+	static int queue_size;
+	static bool dependents_built;
+	struct symbol *s, *dep;
+	bool all = false;
+	int i, j, n;
+
+	if (!dependents_built) {
+		sym_build_dependents();
+		dependents_built = true;
+	}
+
+	n = 0;
+	if (!queue) {
+		queue_size = 64;
+		queue = xrealloc(queue, queue_size * sizeof(*queue));
+	}
+	sym->flags |= SYMBOL_INVALIDATE;
+	queue[n++] = sym;
+
+	for (i = 0; i < n; i++) {
+		s = queue[i];
+		/* every tristate depends on the value of modules */
+		if (s == modules_sym)
+			all = true;
+
+		for (j = 0; j < s->dependents_count; j++) {
+			dep = s->dependents[j];
+			if (dep->flags & SYMBOL_INVALIDATE)
+				continue;
+
+			if (n == queue_size) {
+				queue_size *= 2;
+				queue = xrealloc(queue, queue_size * sizeof(*queue));
+			}
+			dep->flags |= SYMBOL_INVALIDATE;
+			queue[n++] = dep;
+		}
+	}
+
+	for (i = 0; i < n; i++)
+		queue[i]->flags &= ~(SYMBOL_INVALIDATE | SYMBOL_VALID);
+
+	if (all) {
+		sym_clear_all_valid();
+		return;
+	}
+
+	sym_add_change_count(1);
+	sym_calc_value(modules_sym);
+}
+
 bool sym_tristate_within_range(struct symbol *sym, tristate val)
 {
 	int type = sym_get_type(sym);
@@ -502,7 +642,7 @@ bool sym_set_tristate_value(struct symbol *sym, tristate val)
 
 	sym->def[S_DEF_USER].tri = val;
 	if (oldval != val)
-		sym_clear_all_valid();
+		sym_invalidate(sym);
 
 	return true;
 }
@@ -659,7 +799,7 @@ bool sym_set_string_value(struct symbol *sym, const char *newval)
 
 	strcpy(val, newval);
 	free((void *)oldval);
-	sym_clear_all_valid();
+	sym_invalidate(sym);
 
 	return true;
 }
@@ -0,0 +1,561 @@
+/*
+ * ipkg-make-index - generate an opkg Packages index
+ *
+ * Native replacement for the per-package tar/stat/mkhash pipeline of
+ * ipkg-make-index.sh. Packages are hashed and their control files extracted
+ * by a pool of worker threads, and the resulting stanzas are kept in a cache
+ * keyed by path, size, inode and nanosecond mtime so that unchanged packages
+ * are not read again on the next run. The output is identical to the one of the shell script.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#define _DEFAULT_SOURCE
+#define _XOPEN_SOURCE 700
+#define MKHASH_NO_MAIN
+#include "mkhash.c"
+
+#include <stdlib.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <ftw.h>
+#include <limits.h>
+#include <pthread.h>
+#include <zlib.h>
+
+#define TAR_BLOCK	512
+
+struct pkg {
+	char *path;
+	const char *name;
+	off_t size;
+	ino_t ino;
+	struct timespec mtime;
+	bool skip;
+	bool cached;
+	char *entry;
+	int entry_len;
+};
+
+static struct pkg *pkgs;
+static int n_pkgs, max_pkgs;
+static int next_pkg;
+static pthread_mutex_t pkg_lock = PTHREAD_MUTEX_INITIALIZER;
+static bool failed;
+
+static void *xrealloc(void *ptr, size_t size)
+{
+	ptr = realloc(ptr, size);
+	if (!ptr) {
+		fprintf(stderr, "Out of memory\n");
+		exit(1);
+	}
+
+	return ptr;
+}
+
+static int usage(const char *progname)
+{
+	fprintf(stderr, "Usage: %s [-j <jobs>] [-c <cachedir>] <package_directory>\n",
+		progname);
+	return 1;
+}
+
+static int add_pkg(const char *path, const struct stat *st, int type,
+		   struct FTW *ftw)
+{
+	const char *name = path + ftw->base;
+	size_t len = strlen(name);
+	struct pkg *pkg;
+
+	(void) st;
+	(void) type;
+
+	if (len < 4 || strcmp(name + len - 4, ".ipk") != 0)
+		return 0;
+
+	if (n_pkgs == max_pkgs) {
+		max_pkgs = max_pkgs ? max_pkgs * 2 : 256;
+		pkgs = xrealloc(pkgs, max_pkgs * sizeof(*pkgs));
+	}
+
+	pkg = &pkgs[n_pkgs++];
+	memset(pkg, 0, sizeof(*pkg));
+	pkg->path = strdup(path);
+	pkg->name = pkg->path + ftw->base;
+	pkg->skip = !strncmp(pkg->name, "kernel_", 7) ||
+		    !strncmp(pkg->name, "libc_", 5);
+
+	return 0;
+}
+
+static int pkg_cmp(const void *a, const void *b)
+{
+	const struct pkg *pa = a, *pb = b;
+
+	return strcmp(pa->path, pb->path);
+}
+
+static unsigned long tar_size(const unsigned char *hdr)
+{
+	unsigned long size = 0;
+	int i;
+
+	for (i = 124; i < 136 && hdr[i]; i++) {
+		if (hdr[i] == ' ')
+			continue;
+		if (hdr[i] < '0' || hdr[i] > '7')
+			break;
+		size = size * 8 + hdr[i] - '0';
+	}
+
+	return size;
+}
+
+static bool tar_match(const unsigned char *hdr, const char *name)
+{
+	const char *hname = (const char *) hdr;
+
+	if (!strncmp(hname, "./", 2))
+		hname += 2;
+
+	return !strncmp(hname, name, 100 - (hname - (const char *) hdr));
+}
+
+/* find member name in the gzip compressed tar file and return its data */
+static char *gz_tar_extract(gzFile gz, const char *name, unsigned long *len)
+{
+	unsigned char hdr[TAR_BLOCK];
+	unsigned long size, skip;
+	char *buf;
+
+	while (gzread(gz, hdr, TAR_BLOCK) == TAR_BLOCK) {
+		if (!hdr[0])
+			break;
+
+		size = tar_size(hdr);
+		skip = (size + TAR_BLOCK - 1) & ~(TAR_BLOCK - 1UL);
+		if (!tar_match(hdr, name)) {
+			if (gzseek(gz, skip, SEEK_CUR) < 0)
+				break;
+			continue;
+		}
+
+		buf = xrealloc(NULL, size + 1);
+		if (gzread(gz, buf, size) != (int) size) {
+			free(buf);
+			break;
+		}
+
+		buf[size] = 0;
+		*len = size;
+		return buf;
+	}
+
+	return NULL;
+}
+
+/* find member name in an in-memory tar.gz and return its data */
+static char *mem_tar_extract(const char *data, unsigned long data_len,
+			     const char *name, unsigned long *len)
+{
+	unsigned char *tar = NULL;
+	unsigned long tar_len = 0, tar_max = 0, ofs, size;
+	z_stream s = {};
+	char *buf = NULL;
+	int ret;
+
+	if (inflateInit2(&s, 32 + MAX_WBITS) != Z_OK)
+		return NULL;
+
+	s.next_in = (unsigned char *) data;
+	s.avail_in = data_len;
+	do {
+		if (tar_len == tar_max) {
+			tar_max = tar_max ? tar_max * 2 : 16384;
+			tar = xrealloc(tar, tar_max);
+		}
+		s.next_out = tar + tar_len;
+		s.avail_out = tar_max - tar_len;
+		ret = inflate(&s, Z_NO_FLUSH);
+		tar_len = tar_max - s.avail_out;
+	} while (ret == Z_OK);
+	inflateEnd(&s);
+
+	if (ret != Z_STREAM_END)
+		goto out;
+
+	ofs = 0;
+	while (ofs + TAR_BLOCK <= tar_len && tar[ofs]) {
+		unsigned char *hdr = tar + ofs;
+
+		size = tar_size(hdr);
+		ofs += TAR_BLOCK;
+		if (size > tar_len - ofs)
+			break;
+
+		if (tar_match(hdr, name)) {
+			buf = xrealloc(NULL, size + 1);
+			memcpy(buf, tar + ofs, size);
+			buf[size] = 0;
+			*len = size;
+			break;
+		}
+
+		ofs += (size + TAR_BLOCK - 1) & ~(TAR_BLOCK - 1UL);
+	}
+
+out:
+	free(tar);
+	return buf;
+}
+
+static bool sha256_file(const char *path, char *hex)
+{
+	unsigned char digest[SHA256_DIGEST_LENGTH];
+	unsigned char buf[65536];
+	SHA256_CTX ctx;
+	ssize_t len;
+	int fd, i;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return false;
+
+	SHA256_Init(&ctx);
+	while ((len = read(fd, buf, sizeof(buf))) > 0)
+		SHA256_Update(&ctx, buf, len);
+	close(fd);
+
+	if (len < 0)
+		return false;
+
+	SHA256_Final(digest, &ctx);
+	for (i = 0; i < SHA256_DIGEST_LENGTH; i++)
+		sprintf(hex + 2 * i, "%02x", digest[i]);
+
+	return true;
+}
+
+/*
+ * Build the index stanza the same way the shell script does: the control
+ * file with Filename, Size and SHA256sum inserted before every line that
+ * starts with "Description:".
+ */
+static char *format_entry(struct pkg *pkg, const char *control,
+			  const char *sha256, int *len)
+{
+	const char *filename = pkg->path;
+	const char *line, *next;
+	char *entry = NULL;
+	size_t size = 0;
+	FILE *f;
+
+	if (!strncmp(filename, "./", 2))
+		filename += 2;
+
+	f = open_memstream(&entry, &size);
+	if (!f)
+		return NULL;
+
+	for (line = control; *line; line = next) {
+		next = strchr(line, '\n');
+		next = next ? next + 1 : line + strlen(line);
+
+		if (!strncmp(line, "Description:", 12))
+			fprintf(f, "Filename: %s\nSize: %lld\nSHA256sum: %s\n",
+				filename, (long long) pkg->size, sha256);
+		fwrite(line, 1, next - line, f);
+	}
+	fclose(f);
+
+	*len = size;
+	return entry;
+}
+
+static bool process_pkg(struct pkg *pkg)
+{
+	char sha256[2 * SHA256_DIGEST_LENGTH + 1];
+	char *control_tar, *control;
+	unsigned long control_tar_len, control_len;
+	gzFile gz;
+
+	fprintf(stderr, "Generating index for package %s\n", pkg->path);
+
+	if (!sha256_file(pkg->path, sha256))
+		return false;
+
+	gz = gzopen(pkg->path, "rb");
+	if (!gz)
+		return false;
+
+	gzbuffer(gz, 65536);
+	control_tar = gz_tar_extract(gz, "control.tar.gz", &control_tar_len);
+	gzclose(gz);
+	if (!control_tar)
+		return false;
+
+	control = mem_tar_extract(control_tar, control_tar_len, "control",
+				  &control_len);
+	free(control_tar);
+	if (!control)
+		return false;
+
+	pkg->entry = format_entry(pkg, control, sha256, &pkg->entry_len);
+	free(control);
+
+	return pkg->entry != NULL;
+}
+
+static void *worker(void *arg)
+{
+	struct pkg *pkg;
+	int i;
+
+	(void) arg;
+
+	while (1) {
+		pthread_mutex_lock(&pkg_lock);
+		do {
+			i = next_pkg++;
+		} while (i < n_pkgs && (pkgs[i].skip || pkgs[i].cached));
+		pthread_mutex_unlock(&pkg_lock);
+
+		if (i >= n_pkgs)
+			break;
+
+		pkg = &pkgs[i];
+		if (!process_pkg(pkg)) {
+			fprintf(stderr, "Failed to generate index for package %s\n",
+				pkg->path);
+			failed = true;
+		}
+	}
+
+	return NULL;
+}
+
+/*
+ * The cache file holds one record per package:
+ *
+ *   <size> <mtime s> <mtime ns> <inode> <entry length> <path>\n<entry>
+ *
+ * A package rewritten within the same second, or replaced by another file,
+ * differs in the nanoseconds or the inode even if its size is unchanged.
+ */
+static void cache_load(const char *file)
+{
+	long long size, mtime_s;
+	unsigned long long ino;
+	long mtime_ns;
+	int entry_len;
+	char path[PATH_MAX + 1];
+	struct pkg key, *pkg;
+	char *entry;
+	FILE *f;
+
+	f = fopen(file, "r");
+	if (!f)
+		return;
+
+	while (fscanf(f, "%lld %lld %ld %llu %d %4096[^\n]", &size, &mtime_s,
+		      &mtime_ns, &ino, &entry_len, path) == 6) {
+		if (fgetc(f) != '\n' || entry_len < 0)
+			break;
+
+		entry = xrealloc(NULL, entry_len + 1);
+		if (fread(entry, 1, entry_len, f) != (size_t) entry_len) {
+			free(entry);
+			break;
+		}
+		entry[entry_len] = 0;
+
+		key.path = path;
+		pkg = bsearch(&key, pkgs, n_pkgs, sizeof(*pkgs), pkg_cmp);
+		if (!pkg || pkg->skip || pkg->cached ||
+		    pkg->size != size || pkg->ino != ino ||
+		    pkg->mtime.tv_sec != mtime_s || pkg->mtime.tv_nsec != mtime_ns) {
+			free(entry);
+			continue;
+		}
+
+		pkg->cached = true;
+		pkg->entry = entry;
+		pkg->entry_len = entry_len;
+	}
+
+	fclose(f);
+}
+
+static void cache_save(const char *file)
+{
+	char *tmp;
+	FILE *f;
+	int i;
+
+	tmp = xrealloc(NULL, strlen(file) + 16);
+	sprintf(tmp, "%s.%d", file, (int) getpid());
+
+	f = fopen(tmp, "w");
+	if (!f)
+		goto out;
+
+	for (i = 0; i < n_pkgs; i++) {
+		struct pkg *pkg = &pkgs[i];
+
+		if (!pkg->entry || strchr(pkg->path, '\n'))
+			continue;
+
+		fprintf(f, "%lld %lld %ld %llu %d %s\n", (long long) pkg->size,
+			(long long) pkg->mtime.tv_sec, (long) pkg->mtime.tv_nsec,
+			(unsigned long long) pkg->ino, pkg->entry_len, pkg->path);
+		fwrite(pkg->entry, 1, pkg->entry_len, f);
+	}
+
+	if (fclose(f) || rename(tmp, file))
+		unlink(tmp);
+
+out:
+	free(tmp);
+}
+
+/* one cache file per package directory, named after the hash of its path */
+static char *cache_file(const char *cache_dir, const char *pkg_dir)
+{
+	unsigned char digest[SHA256_DIGEST_LENGTH];
+	char hex[2 * SHA256_DIGEST_LENGTH + 1];
+	char *dir, *file;
+	SHA256_CTX ctx;
+	int i;
+
+	dir = realpath(pkg_dir, NULL);
+	if (!dir)
+		return NULL;
+
+	SHA256_Init(&ctx);
+	SHA256_Update(&ctx, dir, strlen(dir));
+	SHA256_Final(digest, &ctx);
+	free(dir);
+
+	for (i = 0; i < SHA256_DIGEST_LENGTH; i++)
+		sprintf(hex + 2 * i, "%02x", digest[i]);
+
+	mkdir(cache_dir, 0755);
+	file = xrealloc(NULL, strlen(cache_dir) + sizeof(hex) + 1);
+	sprintf(file, "%s/%s", cache_dir, hex);
+
+	return file;
+}
+
+int main(int argc, char **argv)
+{
+	const char *progname = argv[0];
+	const char *cache_dir = NULL;
+	char *cache = NULL;
+	pthread_t *threads;
+	struct stat st;
+	int jobs = 0;
+	int i, ch;
+
+	while ((ch = getopt(argc, argv, "c:j:")) != -1) {
+		switch (ch) {
+		case 'c':
+			cache_dir = optarg;
+			break;
+		case 'j':
+			jobs = atoi(optarg);
+			break;
+		default:
+			return usage(progname);
+		}
+	}
+
+	argc -= optind;
+	argv += optind;
+
+	if (argc != 1 || stat(argv[0], &st) || !S_ISDIR(st.st_mode))
+		return usage(progname);
+
+	if (jobs <= 0)
+		jobs = sysconf(_SC_NPROCESSORS_ONLN);
+	if (jobs <= 0)
+		jobs = 1;
+
+	if (nftw(argv[0], add_pkg, 32, FTW_PHYS)) {
+		fprintf(stderr, "Failed to scan %s: %s\n", argv[0],
+			strerror(errno));
+		return 1;
+	}
+
+	if (!n_pkgs) {
+		printf("\n");
+		return 0;
+	}
+
+	qsort(pkgs, n_pkgs, sizeof(*pkgs), pkg_cmp);
+
+	for (i = 0; i < n_pkgs; i++) {
+		struct pkg *pkg = &pkgs[i];
+
+		if (pkg->skip)
+			continue;
+
+		if (stat(pkg->path, &st)) {
+			fprintf(stderr, "Failed to stat %s: %s\n", pkg->path,
+				strerror(errno));
+			return 1;
+		}
+
+		pkg->size = st.st_size;
+		pkg->ino = st.st_ino;
+		pkg->mtime = st.st_mtim;
+	}
+
+	if (cache_dir) {
+		cache = cache_file(cache_dir, argv[0]);
+		if (cache)
+			cache_load(cache);
+	}
+
+	threads = xrealloc(NULL, jobs * sizeof(*threads));
+	for (i = 0; i < jobs; i++)
+		if (pthread_create(&threads[i], NULL, worker, NULL))
+			break;
+
+	if (!i)
+		worker(NULL);
+
+	while (i > 0)
+		pthread_join(threads[--i], NULL);
+
+	free(threads);
+
+	if (failed)
+		return 1;
+
+	for (i = 0; i < n_pkgs; i++) {
+		struct pkg *pkg = &pkgs[i];
+
+		if (pkg->skip)
+			continue;
+
+		fwrite(pkg->entry, 1, pkg->entry_len, stdout);
+		printf("\n");
+	}
+
+	if (cache) {
+		cache_save(cache);
+		free(cache);
+	}
+
+	return 0;
+}
@@ -8,6 +8,13 @@ if [ -z $pkg_dir ] || [ ! -d $pkg_dir ]; then
 	exit 1
 fi
 
+# Use the native indexer when it has been built, it processes packages in
+# parallel and only reads those that changed since the last run.
+ipkg_make_index="$STAGING_DIR_HOST/bin/ipkg-make-index"
+if [ -n "$STAGING_DIR_HOST" ] && [ -x "$ipkg_make_index" ]; then
+	exec "$ipkg_make_index" ${TMP_DIR:+-c "$TMP_DIR/ipkg-index"} "$pkg_dir"
+fi
+
 empty=1
 
 for pkg in `find $pkg_dir -name '*.ipk' | sort`; do
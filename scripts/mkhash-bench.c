@@ -0,0 +1,143 @@
+/*
+ * mkhash-bench - measure the hashing throughput of mkhash
+ *
+ * Hashes a buffer in memory with every hash type of mkhash and prints the
+ * throughput in MB/s. SHA256 is measured once per block function the CPU
+ * supports. Every variant is first checked against known answers.
+ *
+ * Build and run from scripts/:
+ *   cc -O2 -o mkhash-bench mkhash-bench.c -lpthread
+ *   ./mkhash-bench [MB]
+ */
+#define MKHASH_NO_MAIN
+#include "mkhash.c"
+
+#include <time.h>
+
+struct sha256_blocks {
+	const char *name;
+	void (*blocks)(uint32_t *state, const unsigned char *data, size_t n);
+};
+
+static const struct sha256_blocks sha256_blocks[] = {
+	{ "generic", SHA256_Blocks_generic },
+#ifdef MKHASH_SHA_NI
+	{ "sha-ni", SHA256_Blocks_shani },
+#endif
+};
+
+static const struct {
+	const char *type;
+	const char *input;
+	const char *digest;
+} known[] = {
+	{ "md5", "", "d41d8cd98f00b204e9800998ecf8427e" },
+	{ "md5", "abc", "900150983cd24fb0d6963f7d28e17f72" },
+	{ "sha256", "", "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855" },
+	{ "sha256", "abc", "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" },
+	{ "sha256", "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+	  "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1" },
+};
+
+static void hash_hex(struct hash_type *t, const void *data, size_t len, char *str)
+{
+	unsigned char val[SHA256_DIGEST_LENGTH];
+	union hash_ctx ctx;
+	int i;
+
+	t->init(&ctx);
+	t->update(&ctx, data, len);
+	t->final(&ctx, val);
+
+	for (i = 0; i < t->len; i++)
+		sprintf(&str[i * 2], "%02x", val[i]);
+}
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int check(struct hash_type *t, const char *name)
+{
+	char str[SHA256_DIGEST_LENGTH * 2 + 1];
+	unsigned int i;
+	int fail = 0;
+
+	for (i = 0; i < ARRAY_SIZE(known); i++) {
+		if (strcmp(known[i].type, t->name))
+			continue;
+
+		hash_hex(t, known[i].input, strlen(known[i].input), str);
+		if (strcmp(str, known[i].digest)) {
+			fprintf(stderr, "%s %s(\"%s\") = %s, expected %s\n",
+				t->name, name, known[i].input, str, known[i].digest);
+			fail = 1;
+		}
+	}
+
+	return fail;
+}
+
+static void run(struct hash_type *t, const char *name, const void *buf,
+		size_t len, char *str)
+{
+	double start, elapsed;
+
+	start = now();
+	hash_hex(t, buf, len, str);
+	elapsed = now() - start;
+
+	printf("%-7s %-8s %8.1f MB/s  %s\n", t->name, name,
+	       len / elapsed / 1e6, str);
+}
+
+int main(int argc, char **argv)
+{
+	char str[SHA256_DIGEST_LENGTH * 2 + 1], ref[SHA256_DIGEST_LENGTH * 2 + 1];
+	size_t len = (argc > 1 ? atoi(argv[1]) : 256) * 1000000UL;
+	unsigned char *buf;
+	unsigned int i, seed = 1;
+	int fail = 0;
+
+	if (!len) {
+		fprintf(stderr, "Usage: %s [MB]\n", argv[0]);
+		return 1;
+	}
+
+	buf = malloc(len);
+	if (!buf)
+		return 1;
+
+	/* odd length, so the tail goes through the buffered path too */
+	len -= 13;
+	for (i = 0; i < len; i++) {
+		seed = seed * 1103515245 + 12345;
+		buf[i] = seed >> 16;
+	}
+
+	fail |= check(&types[0], "");
+	run(&types[0], "", buf, len, str);
+
+	/* let SHA256_Init() pick its default first, then force each variant */
+	pthread_once(&SHA256_Blocks_once, SHA256_Select);
+	for (i = 0; i < ARRAY_SIZE(sha256_blocks); i++) {
+#ifdef MKHASH_SHA_NI
+		if (sha256_blocks[i].blocks == SHA256_Blocks_shani && !SHA256_Have_shani())
+			continue;
+#endif
+		SHA256_Blocks = sha256_blocks[i].blocks;
+		fail |= check(&types[1], sha256_blocks[i].name);
+		run(&types[1], sha256_blocks[i].name, buf, len, i ? str : ref);
+		if (i && strcmp(str, ref)) {
+			fprintf(stderr, "sha256 %s differs from generic\n", sha256_blocks[i].name);
+			fail = 1;
+		}
+	}
+
+	free(buf);
+	return fail;
+}
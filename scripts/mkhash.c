@@ -86,12 +86,23 @@
 #endif
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5))
+#define MKHASH_SHA_NI
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
 #define ARRAY_SIZE(_n) (sizeof(_n) / sizeof((_n)[0]))
 
 #ifndef __FreeBSD__
@@ -562,6 +573,129 @@ SHA256_Transform(uint32_t * state, const unsigned char block[64])
 		state[i] += S[i];
 }
 
+static void
+SHA256_Blocks_generic(uint32_t *state, const unsigned char *data, size_t n)
+{
+	while (n--) {
+		SHA256_Transform(state, data);
+		data += 64;
+	}
+}
+
+#ifdef MKHASH_SHA_NI
+/*
+ * SHA256 block compression using the x86 SHA extensions. The state is kept
+ * in the ABEF/CDGH register layout expected by sha256rnds2 while processing
+ * all blocks, each sha256rnds2 does two rounds.
+ */
+__attribute__((target("sha,sse4.1,ssse3")))
+static void
+SHA256_Blocks_shani(uint32_t *state, const unsigned char *data, size_t n)
+{
+	static const uint32_t K[64] __attribute__((aligned(16))) = {
+		0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+		0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+		0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+		0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+		0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+		0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+		0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+		0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+		0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+		0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+		0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+		0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+		0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+		0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+		0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+		0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+	};
+	const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+					    0x0405060700010203ULL);
+	__m128i state0, state1, abef, cdgh, msg, tmp;
+	__m128i m[4];
+	int i;
+
+	tmp = _mm_loadu_si128((const __m128i *) &state[0]);
+	state1 = _mm_loadu_si128((const __m128i *) &state[4]);
+	tmp = _mm_shuffle_epi32(tmp, 0xb1);		/* CDAB */
+	state1 = _mm_shuffle_epi32(state1, 0x1b);	/* EFGH */
+	state0 = _mm_alignr_epi8(tmp, state1, 8);	/* ABEF */
+	state1 = _mm_blend_epi16(state1, tmp, 0xf0);	/* CDGH */
+
+	while (n--) {
+		abef = state0;
+		cdgh = state1;
+
+		/* 16 groups of 4 rounds, m[] holds the last 16 schedule words */
+		for (i = 0; i < 16; i++) {
+			if (i < 4)
+				m[i] = _mm_shuffle_epi8(_mm_loadu_si128(
+					(const __m128i *) (data + i * 16)), mask);
+
+			msg = _mm_add_epi32(m[i % 4],
+				_mm_load_si128((const __m128i *) &K[i * 4]));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+
+			if (i >= 3 && i < 15) {
+				tmp = _mm_alignr_epi8(m[i % 4], m[(i + 3) % 4], 4);
+				m[(i + 1) % 4] = _mm_add_epi32(m[(i + 1) % 4], tmp);
+				m[(i + 1) % 4] = _mm_sha256msg2_epu32(m[(i + 1) % 4],
+								     m[i % 4]);
+			}
+
+			msg = _mm_shuffle_epi32(msg, 0x0e);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+
+			if (i >= 1 && i < 13)
+				m[(i + 3) % 4] = _mm_sha256msg1_epu32(m[(i + 3) % 4],
+								     m[i % 4]);
+		}
+
+		state0 = _mm_add_epi32(state0, abef);
+		state1 = _mm_add_epi32(state1, cdgh);
+		data += 64;
+	}
+
+	tmp = _mm_shuffle_epi32(state0, 0x1b);		/* FEBA */
+	state1 = _mm_shuffle_epi32(state1, 0xb1);	/* DCHG */
+	state0 = _mm_blend_epi16(tmp, state1, 0xf0);	/* DCBA */
+	state1 = _mm_alignr_epi8(state1, tmp, 8);	/* ABEF */
+	_mm_storeu_si128((__m128i *) &state[0], state0);
+	_mm_storeu_si128((__m128i *) &state[4], state1);
+}
+
+static bool
+SHA256_Have_shani(void)
+{
+	unsigned int eax, ebx, ecx, edx;
+
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) ||
+	    !(ecx & bit_SSSE3) || !(ecx & bit_SSE4_1))
+		return false;
+
+	if (__get_cpuid_max(0, NULL) < 7)
+		return false;
+
+	__cpuid_count(7, 0, eax, ebx, ecx, edx);
+	return !!(ebx & (1 << 29));
+}
+#endif
+
+static void (*SHA256_Blocks)(uint32_t *state, const unsigned char *data,
+			     size_t n) = SHA256_Blocks_generic;
+static pthread_once_t SHA256_Blocks_once = PTHREAD_ONCE_INIT;
+
+/* Pick the fastest block function supported by the CPU */
+static void
+SHA256_Select(void)
+{
+#ifdef MKHASH_SHA_NI
+	if (SHA256_Have_shani())
+		SHA256_Blocks = SHA256_Blocks_shani;
+#endif
+}
+
 static unsigned char PAD[64] = {
 	0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -585,7 +719,7 @@ SHA256_Pad(SHA256_CTX * ctx)
 	} else {
 		/* Finish the current block and mix. */
 		memcpy(&ctx->buf[r], PAD, 64 - r);
-		SHA256_Transform(ctx->state, ctx->buf);
+		SHA256_Blocks(ctx->state, ctx->buf, 1);
 
 		/* The start of the final block is all zeroes. */
 		memset(&ctx->buf[0], 0, 56);
@@ -595,13 +729,14 @@ SHA256_Pad(SHA256_CTX * ctx)
 	be64enc(&ctx->buf[56], ctx->count);
 
 	/* Mix in the final block. */
-	SHA256_Transform(ctx->state, ctx->buf);
+	SHA256_Blocks(ctx->state, ctx->buf, 1);
 }
 
 /* SHA-256 initialization.  Begins a SHA-256 operation. */
 static void
 SHA256_Init(SHA256_CTX * ctx)
 {
+	pthread_once(&SHA256_Blocks_once, SHA256_Select);
 
 	/* Zero bits processed so far */
 	ctx->count = 0;
@@ -642,16 +777,14 @@ SHA256_Update(SHA256_CTX * ctx, const void *in, size_t len)
 
 	/* Finish the current block */
 	memcpy(&ctx->buf[r], src, 64 - r);
-	SHA256_Transform(ctx->state, ctx->buf);
+	SHA256_Blocks(ctx->state, ctx->buf, 1);
 	src += 64 - r;
 	len -= 64 - r;
 
 	/* Perform complete blocks */
-	while (len >= 64) {
-		SHA256_Transform(ctx->state, src);
-		src += 64;
-		len -= 64;
-	}
+	SHA256_Blocks(ctx->state, src, len / 64);
+	src += len & ~(size_t)63;
+	len &= 63;
 
 	/* Copy left over data into buffer */
 	memcpy(ctx->buf, src, len);
@@ -674,71 +807,127 @@ SHA256_Final(unsigned char digest[static SHA256_DIGEST_LENGTH], SHA256_CTX *ctx)
 	memset(ctx, 0, sizeof(*ctx));
 }
 
-static void *hash_buf(FILE *f, int *len)
-{
-	static char buf[1024];
+#define HASH_BUF_SIZE	(64 * 1024)
 
-	*len = fread(buf, 1, sizeof(buf), f);
+union hash_ctx {
+	MD5_CTX md5;
+	SHA256_CTX sha256;
+};
 
-	return *len > 0 ? buf : NULL;
+static void md5_init(union hash_ctx *ctx)
+{
+	MD5_begin(&ctx->md5);
 }
 
-static char *hash_string(unsigned char *buf, int len)
+static void md5_update(union hash_ctx *ctx, const void *data, size_t len)
 {
-	static char str[SHA256_DIGEST_LENGTH * 2 + 1];
-	int i;
+	MD5_hash(data, len, &ctx->md5);
+}
 
-	if (len * 2 + 1 > sizeof(str))
-		return NULL;
+static void md5_final(union hash_ctx *ctx, unsigned char *val)
+{
+	MD5_end(val, &ctx->md5);
+}
 
-	for (i = 0; i < len; i++)
-		sprintf(&str[i * 2], "%02x", buf[i]);
+static void sha256_init(union hash_ctx *ctx)
+{
+	SHA256_Init(&ctx->sha256);
+}
 
-	return str;
+static void sha256_update(union hash_ctx *ctx, const void *data, size_t len)
+{
+	SHA256_Update(&ctx->sha256, data, len);
 }
 
-static const char *md5_hash(FILE *f)
+static void sha256_final(union hash_ctx *ctx, unsigned char *val)
 {
-	MD5_CTX ctx;
-	unsigned char val[MD5_DIGEST_LENGTH];
-	void *buf;
+	SHA256_Final(val, &ctx->sha256);
+}
+
+
+struct hash_type {
+	const char *name;
+	void (*init)(union hash_ctx *ctx);
+	void (*update)(union hash_ctx *ctx, const void *data, size_t len);
+	void (*final)(union hash_ctx *ctx, unsigned char *val);
 	int len;
+};
+
+struct hash_type types[] = {
+	{ "md5", md5_init, md5_update, md5_final, MD5_DIGEST_LENGTH },
+	{ "sha256", sha256_init, sha256_update, sha256_final, SHA256_DIGEST_LENGTH },
+};
 
-	MD5_begin(&ctx);
-	while ((buf = hash_buf(f, &len)) != NULL)
-		MD5_hash(buf, len, &ctx);
-	MD5_end(val, &ctx);
+#ifndef MKHASH_NO_MAIN
+static void hash_string(char *str, const unsigned char *buf, int len)
+{
+	int i;
 
-	return hash_string(val, MD5_DIGEST_LENGTH);
+	for (i = 0; i < len; i++)
+		sprintf(&str[i * 2], "%02x", buf[i]);
 }
 
-static const char *sha256_hash(FILE *f)
+/*
+ * Hash everything that can be read from fd. Regular files are mapped and
+ * hashed in one go, anything else is read through a large buffer.
+ */
+static bool hash_fd(struct hash_type *t, int fd, char *str)
 {
-	SHA256_CTX ctx;
 	unsigned char val[SHA256_DIGEST_LENGTH];
+	union hash_ctx ctx;
+	struct stat st;
+	ssize_t len;
 	void *buf;
-	int len;
 
-	SHA256_Init(&ctx);
-	while ((buf = hash_buf(f, &len)) != NULL)
-		SHA256_Update(&ctx, buf, len);
-	SHA256_Final(val, &ctx);
+	t->init(&ctx);
 
-	return hash_string(val, SHA256_DIGEST_LENGTH);
-}
+	if (!fstat(fd, &st) && S_ISREG(st.st_mode) && st.st_size > 0 &&
+	    (uintmax_t) st.st_size <= SIZE_MAX) {
+		buf = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (buf != MAP_FAILED) {
+			posix_madvise(buf, st.st_size, POSIX_MADV_SEQUENTIAL);
+			t->update(&ctx, buf, st.st_size);
+			munmap(buf, st.st_size);
+			goto out;
+		}
+	}
 
+	buf = malloc(HASH_BUF_SIZE);
+	if (!buf)
+		return false;
 
-struct hash_type {
-	const char *name;
-	const char *(*func)(FILE *f);
-	int len;
+	while ((len = read(fd, buf, HASH_BUF_SIZE)) > 0)
+		t->update(&ctx, buf, len);
+	free(buf);
+
+	if (len < 0)
+		return false;
+
+out:
+	t->final(&ctx, val);
+	hash_string(str, val, t->len);
+	return true;
+}
+
+enum hash_status {
+	HASH_PENDING,
+	HASH_OK,
+	HASH_ERR_DIR,
+	HASH_ERR_OPEN,
+	HASH_ERR_HASH,
 };
 
-struct hash_type types[] = {
-	{ "md5", md5_hash, MD5_DIGEST_LENGTH },
-	{ "sha256", sha256_hash, SHA256_DIGEST_LENGTH },
+struct hash_job {
+	const char *filename;
+	enum hash_status status;
+	char str[SHA256_DIGEST_LENGTH * 2 + 1];
 };
 
+static struct hash_type *hash_job_type;
+static struct hash_job *hash_jobs;
+static int n_hash_jobs, next_hash_job;
+static pthread_mutex_t hash_job_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t hash_job_done = PTHREAD_COND_INITIALIZER;
 
 static int usage(const char *progname)
 {
@@ -748,6 +937,7 @@ static int usage(const char *progname)
 		"Options:\n"
 		"	-n		Print filename(s)\n"
 		"	-N		Suppress trailing newline\n"
+		"	-j <jobs>	Hash up to <jobs> files in parallel\n"
 		"\n"
 		"Supported hash types:", progname);
 
@@ -771,54 +961,97 @@ static struct hash_type *get_hash_type(const char *name)
 	return NULL;
 }
 
+static bool hash_job_stdin(struct hash_job *job)
+{
+	return !job->filename || !strcmp(job->filename, "-");
+}
 
-static int hash_file(struct hash_type *t, const char *filename, bool add_filename,
-	bool no_newline)
+static enum hash_status hash_file(struct hash_type *t, struct hash_job *job)
 {
-	const char *str;
+	struct stat path_stat;
+	bool ok;
+	int fd;
 
-	if (!filename || !strcmp(filename, "-")) {
-		str = t->func(stdin);
-	} else {
-		struct stat path_stat;
-		stat(filename, &path_stat);
-		if (S_ISDIR(path_stat.st_mode)) {
-			fprintf(stderr, "Failed to open '%s': Is a directory\n", filename);
-			return 1;
-		}
+	if (hash_job_stdin(job))
+		return hash_fd(t, STDIN_FILENO, job->str) ? HASH_OK : HASH_ERR_HASH;
 
-		FILE *f = fopen(filename, "r");
+	if (!stat(job->filename, &path_stat) && S_ISDIR(path_stat.st_mode))
+		return HASH_ERR_DIR;
 
-		if (!f) {
-			fprintf(stderr, "Failed to open '%s'\n", filename);
-			return 1;
-		}
-		str = t->func(f);
-		fclose(f);
-	}
+	fd = open(job->filename, O_RDONLY);
+	if (fd < 0)
+		return HASH_ERR_OPEN;
+
+	ok = hash_fd(t, fd, job->str);
+	close(fd);
+
+	return ok ? HASH_OK : HASH_ERR_HASH;
+}
 
-	if (!str) {
+static int print_hash(struct hash_job *job, bool add_filename, bool no_newline)
+{
+	switch (job->status) {
+	case HASH_ERR_DIR:
+		fprintf(stderr, "Failed to open '%s': Is a directory\n", job->filename);
+		return 1;
+	case HASH_ERR_OPEN:
+		fprintf(stderr, "Failed to open '%s'\n", job->filename);
+		return 1;
+	case HASH_OK:
+		break;
+	default:
 		fprintf(stderr, "Failed to generate hash\n");
 		return 1;
 	}
 
 	if (add_filename)
-		printf("%s %s%s", str, filename ? filename : "-",
+		printf("%s %s%s", job->str, job->filename ? job->filename : "-",
 			no_newline ? "" : "\n");
 	else
-		printf("%s%s", str, no_newline ? "" : "\n");
+		printf("%s%s", job->str, no_newline ? "" : "\n");
 	return 0;
 }
 
+/* files are hashed by the workers, stdin is left to the main thread */
+static void *hash_worker(void *arg)
+{
+	struct hash_job *job;
+	enum hash_status status;
+
+	(void) arg;
+
+	while (1) {
+		pthread_mutex_lock(&hash_job_lock);
+		while (next_hash_job < n_hash_jobs &&
+		       hash_job_stdin(&hash_jobs[next_hash_job]))
+			next_hash_job++;
+		job = next_hash_job < n_hash_jobs ? &hash_jobs[next_hash_job++] : NULL;
+		pthread_mutex_unlock(&hash_job_lock);
+
+		if (!job)
+			break;
+
+		status = hash_file(hash_job_type, job);
+
+		pthread_mutex_lock(&hash_job_lock);
+		job->status = status;
+		pthread_cond_broadcast(&hash_job_done);
+		pthread_mutex_unlock(&hash_job_lock);
+	}
+
+	return NULL;
+}
 
 int main(int argc, char **argv)
 {
 	struct hash_type *t;
 	const char *progname = argv[0];
-	int i, ch;
+	struct hash_job stdin_job = { .filename = NULL };
+	pthread_t thread;
+	int i, ch, jobs = 1;
 	bool add_filename = false, no_newline = false;
 
-	while ((ch = getopt(argc, argv, "nN")) != -1) {
+	while ((ch = getopt(argc, argv, "nNj:")) != -1) {
 		switch (ch) {
 		case 'n':
 			add_filename = true;
@@ -826,6 +1059,11 @@ int main(int argc, char **argv)
 		case 'N':
 			no_newline = true;
 			break;
+		case 'j':
+			jobs = atoi(optarg);
+			if (jobs < 1)
+				return usage(progname);
+			break;
 		default:
 			return usage(progname);
 		}
@@ -841,14 +1079,48 @@ int main(int argc, char **argv)
 	if (!t)
 		return usage(progname);
 
-	if (argc < 2)
-		return hash_file(t, NULL, add_filename, no_newline);
+	if (argc < 2) {
+		stdin_job.status = hash_file(t, &stdin_job);
+		return print_hash(&stdin_job, add_filename, no_newline);
+	}
+
+	hash_job_type = t;
+	n_hash_jobs = argc - 1;
+	hash_jobs = calloc(n_hash_jobs, sizeof(*hash_jobs));
+	if (!hash_jobs)
+		return 1;
+
+	for (i = 0; i < n_hash_jobs; i++)
+		hash_jobs[i].filename = argv[1 + i];
 
-	for (i = 0; i < argc - 1; i++) {
-		int ret = hash_file(t, argv[1 + i], add_filename, no_newline);
-		if (ret)
-			return ret;
+	if (jobs > n_hash_jobs)
+		jobs = n_hash_jobs;
+
+	for (i = 1; i < jobs; i++) {
+		if (pthread_create(&thread, NULL, hash_worker, NULL))
+			break;
+		pthread_detach(thread);
+	}
+	jobs = i;
+
+	for (i = 0; i < n_hash_jobs; i++) {
+		struct hash_job *job = &hash_jobs[i];
+
+		if (hash_job_stdin(job)) {
+			job->status = hash_file(t, job);
+		} else if (jobs == 1) {
+			job->status = hash_file(t, job);
+		} else {
+			pthread_mutex_lock(&hash_job_lock);
+			while (job->status == HASH_PENDING)
+				pthread_cond_wait(&hash_job_done, &hash_job_lock);
+			pthread_mutex_unlock(&hash_job_lock);
+		}
+
+		if (print_hash(job, add_filename, no_newline))
+			return 1;
 	}
 
 	return 0;
 }
+#endif
@@ -0,0 +1,163 @@
+#!/usr/bin/env perl
+#
+# Time package-metadata.pl on synthetic package metadata
+#
+# Generates a tmp/.packageinfo style file with the given number of packages,
+# then times the "config", "mk", "pkgaux" and "usergroup" commands one by one
+# and once through "multi". The multi outputs must be identical to the single
+# ones. With --reference, the outputs are also compared with those of another
+# copy of package-metadata.pl, e.g. one from before a change.
+#
+# By default a fifth of the packages are libraries in one menu with shallow
+# dependencies, used by the rest. --deep lets every package depend on any
+# earlier one with plain dependencies, the worst case for sorting menus by
+# dependency. --cyclic adds some dependencies on later packages.
+#
+# Run from the top of the tree:
+#   scripts/package-metadata-bench.pl [--packages 10000] [--deep] [--cyclic]
+#       [--seed 1] [--reference old/package-metadata.pl] [--keep dir]
+#
+use strict;
+use warnings;
+use File::Temp qw(tempdir);
+use Getopt::Long;
+use Time::HiRes qw(time);
+
+my $packages = 10000;
+my $cyclic = 0;
+my $deep = 0;
+my $seed = 1;
+my $reference;
+my $keep;
+
+GetOptions(
+	"packages=i" => \$packages,
+	"cyclic" => \$cyclic,
+	"deep" => \$deep,
+	"seed=i" => \$seed,
+	"reference=s" => \$reference,
+	"keep=s" => \$keep,
+) or die "Invalid arguments\n";
+
+my $script = "scripts/package-metadata.pl";
+my @commands = qw(config mk pkgaux usergroup);
+my $dir = $keep // tempdir(CLEANUP => 1);
+my $info = "$dir/packageinfo";
+
+# keep the output of equal entries stable between runs and scripts
+$ENV{PERL_HASH_SEED} = 0;
+$ENV{PERL_PERTURB_KEYS} = 0;
+
+sub gen_metadata() {
+	my @names = map { sprintf "pkg%05d", $_ } 0 .. $packages - 1;
+	my $libs = int($packages / 5);
+	my $pkg = 0;
+	my $src = 0;
+
+	srand($seed);
+	open my $fh, '>', $info or die "Cannot write '$info': $!\n";
+	while ($pkg < $packages) {
+		my $srcname = sprintf "src%05d", $src++;
+		# like in the real tree, all libraries share one big menu
+		my $cat = $pkg < $libs ? "Libraries" : sprintf "Category%02d", int(rand(12));
+		my $submenu = $pkg < $libs ? "" : sprintf "Submenu%02d", int(rand(8));
+
+		print $fh "Source-Makefile: package/$cat/$srcname/Makefile\n";
+		rand() < 0.2 and printf $fh "Build-Depends: src%05d\n", int(rand($src));
+		foreach (1 .. 1 + int(rand(3))) {
+			last if $pkg >= $packages;
+
+			my $name = $names[$pkg];
+			my @depends;
+
+			# the first fifth are libraries with few dependencies of their
+			# own, the rest are applications using some of them
+			my $n = $pkg < $libs && !$deep ? int(rand(3)) : int(rand(5));
+			foreach (1 .. $n) {
+				my $dep = $names[int(rand($pkg < $libs || $deep ? $pkg : $libs))];
+				my $r = $deep ? rand() / 5 : rand();
+
+				last if $dep eq $name;
+				# only plain dependencies order the packages of a menu
+				push @depends, $r < 0.5 ? $dep :
+					$r < 0.85 ? "+$dep" : "+PACKAGE_$name:$dep";
+			}
+			$cyclic and $pkg + 1 < $packages and rand() < 0.05 and
+				push @depends, "+$names[$pkg + 1 + int(rand($packages - $pkg - 1))]";
+			rand() < 0.1 and push @depends, sprintf "\@FEATURE_%d", int(rand(10));
+
+			print $fh "Package: $name\n";
+			rand() < 0.05 and printf $fh "Provides: virt%03d\n", int(rand(200));
+			print $fh "Submenu: $submenu\n" if $submenu && rand() < 0.5;
+			print $fh "Version: 1.0-1\n";
+			print $fh "Depends: +libc @depends\n";
+			print $fh "Conflicts: \n";
+			print $fh "Menu-Depends: \n";
+			print $fh "Provides: \n" unless rand() < 0.05;
+			rand() < 0.02 and print $fh "Require-User: user$pkg=" . (1000 + $pkg) . "\n";
+			print $fh "Section: utils\n";
+			print $fh "Category: $cat\n";
+			print $fh "Repository: base\n";
+			print $fh "Title: Synthetic package $name\n";
+			print $fh "Maintainer: Nobody <nobody\@example.org>\n";
+			print $fh "Source: $srcname-1.0.tar.xz\n";
+			print $fh "License: GPL-2.0\n";
+			print $fh "Type: ipkg\n";
+			print $fh "Description: Synthetic package $name\n";
+			print $fh "\@\@\n\n";
+			$pkg++;
+		}
+	}
+	# the base packages everything depends on
+	print $fh "Source-Makefile: package/libs/libc/Makefile\n";
+	print $fh "Package: libc\nVersion: 1\nDepends: \nCategory: Base system\nTitle: C library\nType: ipkg\nDescription: C library\n\@\@\n\n";
+	close $fh;
+}
+
+sub run($) {
+	my $cmd = shift;
+	my $start = time;
+
+	system($cmd) == 0 or die "Failed: $cmd\n";
+	return time - $start;
+}
+
+sub same($$) {
+	my ($a, $b) = @_;
+
+	return system("cmp -s '$a' '$b'") == 0;
+}
+
+gen_metadata();
+printf "%d packages%s%s, metadata in %s\n", $packages, $deep ? ", deep" : "",
+	$cyclic ? ", with cycles" : "", $info;
+
+my $total = 0;
+foreach my $cmd (@commands) {
+	my $t = run("$script $cmd $info > $dir/$cmd.single");
+	$total += $t;
+	printf "  %-10s %8.2fs\n", $cmd, $t;
+}
+printf "  %-10s %8.2fs\n", "total", $total;
+
+my $t = run("$script multi $info " . join(" ", map { "$_=$dir/$_.multi" } @commands));
+printf "  %-10s %8.2fs\n", "multi", $t;
+
+my $fail = 0;
+foreach my $cmd (@commands) {
+	same("$dir/$cmd.single", "$dir/$cmd.multi") and next;
+	print "  multi output of $cmd differs\n";
+	$fail = 1;
+}
+
+if ($reference) {
+	print "$reference:\n";
+	foreach my $cmd (@commands) {
+		printf "  %-10s %8.2fs\n", $cmd, run("$reference $cmd $info > $dir/$cmd.reference");
+		same("$dir/$cmd.single", "$dir/$cmd.reference") and next;
+		print "  $cmd output differs from $reference\n";
+		$fail = 1;
+	}
+}
+
+exit $fail;
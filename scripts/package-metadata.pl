@@ -97,47 +97,128 @@ sub gen_kconfig_overrides() {
 	}
 }
 
-my %dep_check;
-sub __find_package_dep($$) {
+# Strongly connected components of the package dependency graph, numbered
+# in the order Tarjan's algorithm completes them, so a component only
+# depends on components with a lower number.
+my %dep_scc;
+my @dep_scc_deps;
+my @dep_scc_cyclic;
+my %dep_index;
+my %dep_lowlink;
+my %dep_onstack;
+my @dep_stack;
+
+sub package_dep_list($) {
 	my $pkg = shift;
-	my $name = shift;
-	my $deps = $pkg->{depends};
-
-	return 0 unless defined $deps;
-	foreach my $vpkg (@{$deps}) {
-		foreach my $dep (@{$vpackage{$vpkg}}) {
-			next if $dep_check{$dep->{name}};
-			$dep_check{$dep->{name}} = 1;
-			return 1 if $dep->{name} eq $name;
-			return 1 if (__find_package_dep($dep, $name) == 1);
+
+	return map { @{$vpackage{$_} || []} } @{$pkg->{depends} || []};
+}
+
+sub __package_dep_scc($) {
+	my $pkg = shift;
+	my $name = $pkg->{name};
+
+	$dep_index{$name} = $dep_lowlink{$name} = scalar keys %dep_index;
+	push @dep_stack, $pkg;
+	$dep_onstack{$name} = 1;
+
+	foreach my $dep (package_dep_list($pkg)) {
+		my $dname = $dep->{name};
+
+		if (!defined $dep_index{$dname}) {
+			__package_dep_scc($dep);
+			$dep_lowlink{$dname} < $dep_lowlink{$name} and
+				$dep_lowlink{$name} = $dep_lowlink{$dname};
+		} elsif ($dep_onstack{$dname}) {
+			$dep_index{$dname} < $dep_lowlink{$name} and
+				$dep_lowlink{$name} = $dep_index{$dname};
 		}
 	}
-	return 0;
+	return unless $dep_lowlink{$name} == $dep_index{$name};
+
+	my $scc = scalar @dep_scc_deps;
+	my @members;
+	my $member;
+	do {
+		$member = pop @dep_stack;
+		delete $dep_onstack{$member->{name}};
+		$dep_scc{$member->{name}} = $scc;
+		push @members, $member;
+	} while ($member != $pkg);
+
+	my %deps;
+	foreach my $member (@members) {
+		foreach my $dep (package_dep_list($member)) {
+			my $dscc = $dep_scc{$dep->{name}};
+			$dscc == $scc or $deps{$dscc} = 1;
+		}
+	}
+	$dep_scc_deps[$scc] = [ keys %deps ];
+	$dep_scc_cyclic[$scc] = (@members > 1);
 }
 
-# wrapper to avoid infinite recursion
-sub find_package_dep($$) {
-	my $pkg = shift;
-	my $name = shift;
+sub package_dep_sccs() {
+	foreach my $name (sort keys %package) {
+		defined $dep_index{$name} or __package_dep_scc($package{$name});
+	}
+}
 
-	%dep_check = ();
-	return __find_package_dep($pkg, $name);
+# Calculate for every package of a menu which other packages of the same
+# menu it depends on, directly or indirectly, as a bit vector indexed by
+# the position in the menu. This replaces walking the dependency graph on
+# every comparison while sorting the menu.
+sub package_dep_matrix($) {
+	my $pkgs = shift;
+	my %index;
+	my %bits;
+	my %reach;
+	my %seen;
+	my @todo;
+
+	%dep_scc or package_dep_sccs();
+
+	foreach my $i (0 .. $#$pkgs) {
+		my $scc = $dep_scc{$pkgs->[$i]{name}};
+
+		$index{$pkgs->[$i]{name}} = $i;
+		vec($bits{$scc}, $i, 1) = 1;
+		$seen{$scc}++ or push @todo, $scc;
+	}
+
+	for (my $i = 0; $i < @todo; $i++) {
+		foreach my $dscc (@{$dep_scc_deps[$todo[$i]]}) {
+			$seen{$dscc}++ or push @todo, $dscc;
+		}
+	}
+
+	foreach my $scc (sort { $a <=> $b } @todo) {
+		my $r = $dep_scc_cyclic[$scc] && $bits{$scc} || '';
+
+		foreach my $dscc (@{$dep_scc_deps[$scc]}) {
+			$r |= $reach{$dscc};
+			defined $bits{$dscc} and $r |= $bits{$dscc};
+		}
+		$reach{$scc} = $r;
+	}
+
+	return {
+		index => \%index,
+		reach => { map { $_->{name} => $reach{$dep_scc{$_->{name}}} } @$pkgs },
+	};
 }
 
-sub package_depends($$) {
+sub package_depends($$$) {
+	my $matrix = shift;
 	my $a = shift;
 	my $b = shift;
-	my $ret;
 
 	return 0 if ($a->{submenu} ne $b->{submenu});
-	if (find_package_dep($a, $b->{name}) == 1) {
-		$ret = 1;
-	} elsif (find_package_dep($b, $a->{name}) == 1) {
-		$ret = -1;
-	} else {
-		return 0;
+	if (vec($matrix->{reach}{$a->{name}}, $matrix->{index}{$b->{name}}, 1)) {
+		return 1;
+	} elsif (vec($matrix->{reach}{$b->{name}}, $matrix->{index}{$a->{name}}, 1)) {
+		return -1;
 	}
-	return $ret;
+	return 0;
 }
 
 sub mconf_depends {
@@ -281,8 +362,9 @@ sub print_package_config_category($) {
 	} keys %menus;
 
 	foreach my $menu (@menus) {
+		my $deps = package_dep_matrix($menus{$menu});
 		my @pkgs = sort {
-			package_depends($a, $b) or
+			package_depends($deps, $a, $b) or
 			($a->{name} cmp $b->{name})
 		} @{$menus{$menu}};
 		if ($menu ne 'undef') {
@@ -344,8 +426,16 @@ sub print_package_overrides() {
 	print "\t\tdefault \"".join(" ", sort keys %overrides)."\"\n\n";
 }
 
+# The metadata is parsed once per run, so that "multi" can generate several
+# outputs from a single pass over the file.
+my $metadata_loaded;
+sub load_package_metadata() {
+	$metadata_loaded //= parse_package_metadata($ARGV[0]);
+	$metadata_loaded or exit 1;
+}
+
 sub gen_package_config() {
-	parse_package_metadata($ARGV[0]) or exit 1;
+	load_package_metadata();
 	print "menuconfig IMAGEOPT\n\tbool \"Image configuration\"\n\tdefault n\n";
 	print "source \"package/*/image-config.in\"\n";
 	if (scalar glob "package/feeds/*/*/image-config.in") {
@@ -391,16 +481,17 @@ sub get_conditional_dep($$) {
 sub gen_package_mk() {
 	my $line;
 
-	parse_package_metadata($ARGV[0]) or exit 1;
+	load_package_metadata();
 	foreach my $srcname (sort {uc($a) cmp uc($b)} keys %srcpackage) {
 		my $src = $srcpackage{$srcname};
 		my $variant_default;
 		my %deplines = ('' => {});
 
 		foreach my $pkg (@{$src->{packages}}) {
-			foreach my $dep (@{$pkg->{depends}}) {
-				next if ($dep =~ /@/);
+			foreach my $depspec (@{$pkg->{depends}}) {
+				next if ($depspec =~ /@/);
 
+				my $dep = $depspec;
 				my $condition;
 
 				$dep =~ s/\+//g;
@@ -469,7 +560,8 @@ sub gen_package_mk() {
 
 			defined $deplines{$suffix} or $deplines{$suffix} = {};
 
-			foreach my $dep (@{$src->{"builddepends$suffix"}}) {
+			foreach my $depspec (@{$src->{"builddepends$suffix"}}) {
+				my $dep = $depspec;
 				my $depsuffix = "";
 				my $deptype = "";
 				my $condition;
@@ -515,7 +607,7 @@ sub gen_package_mk() {
 }
 
 sub gen_package_source() {
-	parse_package_metadata($ARGV[0]) or exit 1;
+	load_package_metadata();
 	foreach my $name (sort {uc($a) cmp uc($b)} keys %package) {
 		my $pkg = $package{$name};
 		if ($pkg->{name} && $pkg->{source}) {
@@ -526,7 +618,7 @@ sub gen_package_source() {
 }
 
 sub gen_package_auxiliary() {
-	parse_package_metadata($ARGV[0]) or exit 1;
+	load_package_metadata();
 	foreach my $name (sort {uc($a) cmp uc($b)} keys %package) {
 		my $pkg = $package{$name};
 		if ($pkg->{name} && $pkg->{repository}) {
@@ -549,7 +641,7 @@ sub gen_package_auxiliary() {
 
 sub gen_package_license($) {
 	my $level = shift;
-	parse_package_metadata($ARGV[0]) or exit 1;
+	load_package_metadata();
 	foreach my $name (sort {uc($a) cmp uc($b)} keys %package) {
 		my $pkg = $package{$name};
 		if ($pkg->{name}) {
@@ -576,7 +668,7 @@ sub gen_version_filtered_list() {
 }
 
 sub gen_usergroup_list() {
-	parse_package_metadata($ARGV[0]) or exit 1;
+	load_package_metadata();
 	for my $name (keys %usernames) {
 		print "user $name $usernames{$name}{id} $usernames{$name}{makefile}\n";
 	}
@@ -587,7 +679,7 @@ sub gen_usergroup_list() {
 
 sub gen_package_manifest_json() {
 	my $json;
-	parse_package_metadata($ARGV[0]) or exit 1;
+	load_package_metadata();
 	foreach my $name (sort {uc($a) cmp uc($b)} keys %package) {
 		my %depends;
 		my $pkg = $package{$name};
@@ -619,6 +711,36 @@ END_JSON
 	print "[$json]";
 }
 
+my %multi_commands = (
+	mk => \&gen_package_mk,
+	config => \&gen_package_config,
+	source => \&gen_package_source,
+	pkgaux => \&gen_package_auxiliary,
+	pkgmanifestjson => \&gen_package_manifest_json,
+	license => sub { gen_package_license(0) },
+	licensefull => sub { gen_package_license(1) },
+	usergroup => \&gen_usergroup_list,
+);
+
+sub gen_multi() {
+	my @outputs = splice @ARGV, 1;
+
+	load_package_metadata();
+	foreach my $output (@outputs) {
+		my ($cmd, $file) = split /=/, $output, 2;
+		my $gen = $multi_commands{$cmd};
+		my $fh;
+
+		$gen and $file or die "Invalid output '$output'\n";
+		open $fh, '>', "$file.tmp" or die "Cannot write '$file.tmp': $!\n";
+		my $stdout = select $fh;
+		$gen->();
+		select $stdout;
+		close $fh or die "Cannot write '$file.tmp': $!\n";
+		rename "$file.tmp", $file or die "Cannot rename '$file.tmp': $!\n";
+	}
+}
+
 sub parse_command() {
 	GetOptions("ignore=s", \@ignore);
 	my $cmd = shift @ARGV;
@@ -633,6 +755,7 @@ sub parse_command() {
 		/^licensefull$/ and return gen_package_license(1);
 		/^usergroup$/ and return gen_usergroup_list();
 		/^version_filter$/ and return gen_version_filtered_list();
+		/^multi$/ and return gen_multi();
 	}
 	die <<EOF
 Available Commands:
@@ -646,6 +769,7 @@ Available Commands:
 	$0 licensefull [file] 			Package license information (full list)
 	$0 usergroup [file]			Package usergroup allocation list
 	$0 version_filter [patchver] [list...]	Filter list of version tagged strings
+	$0 multi [file] [command=output...]	Write several of the above from one parse
 
 Options:
 	--ignore <name>				Ignore the source package <name>
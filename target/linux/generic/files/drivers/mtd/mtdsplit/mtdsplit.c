@@ -19,17 +19,202 @@
 #include <linux/mtd/mtd.h>
 #include <linux/mtd/partitions.h>
 #include <linux/byteorder/generic.h>
+#include <linux/bitmap.h>
+#include <linux/list.h>
+#include <linux/mutex.h>
+#include <linux/slab.h>
+#include <linux/vmalloc.h>
 
 #include "mtdsplit.h"
 
 #define UBI_EC_MAGIC			0x55424923	/* UBI# */
 
+/* enough for the uImage, FIT, TRX and squashfs headers */
+#define MTDSPLIT_HEAD_LEN		64
+
 struct squashfs_super_block {
 	__le32 s_magic;
 	__le32 pad0[9];
 	__le64 bytes_used;
 };
 
+/*
+ * The split parsers all probe the first bytes of erase blocks, often the
+ * same ones several times (each parser looking for its own header, then
+ * mtd_find_rootfs_from() walking the rest of the partition). Keep the head
+ * of every erase block that has been read once, so that these lookups only
+ * hit the flash once per block.
+ *
+ * The cache is only used while the partitions are set up at boot, before
+ * anything can have written to the flash, and is dropped afterwards.
+ */
+struct mtdsplit_scan_cache {
+	struct list_head list;
+	struct mtd_info *mtd;
+	uint64_t size;
+	uint32_t erasesize;
+	unsigned int blocks;
+	unsigned int reads;
+	unsigned int hits;
+	unsigned long *cached;
+	int *err;
+	size_t *len;
+	u_char *data;
+};
+
+static LIST_HEAD(mtdsplit_scan_caches);
+static DEFINE_MUTEX(mtdsplit_scan_lock);
+static bool mtdsplit_scan_done;
+
+static void mtdsplit_scan_free(struct mtdsplit_scan_cache *c)
+{
+	pr_debug("scan cache for \"%s\": %u reads, %u hits\n",
+		 c->mtd->name, c->reads, c->hits);
+
+	list_del(&c->list);
+	bitmap_free(c->cached);
+	vfree(c->err);
+	vfree(c->len);
+	vfree(c->data);
+	kfree(c);
+}
+
+static struct mtdsplit_scan_cache *mtdsplit_scan_get(struct mtd_info *mtd)
+{
+	struct mtdsplit_scan_cache *c;
+
+	list_for_each_entry(c, &mtdsplit_scan_caches, list) {
+		if (c->mtd != mtd)
+			continue;
+
+		if (c->size == mtd->size && c->erasesize == mtd->erasesize)
+			return c;
+
+		mtdsplit_scan_free(c);
+		break;
+	}
+
+	if (mtdsplit_scan_done)
+		return NULL;
+
+	c = kzalloc(sizeof(*c), GFP_KERNEL);
+	if (!c)
+		return NULL;
+
+	c->mtd = mtd;
+	c->size = mtd->size;
+	c->erasesize = mtd->erasesize;
+	c->blocks = DIV_ROUND_UP_ULL(mtd->size, mtd->erasesize);
+	c->cached = bitmap_zalloc(c->blocks, GFP_KERNEL);
+	c->err = vmalloc(array_size(c->blocks, sizeof(*c->err)));
+	c->len = vmalloc(array_size(c->blocks, sizeof(*c->len)));
+	c->data = vmalloc(array_size(c->blocks, MTDSPLIT_HEAD_LEN));
+	INIT_LIST_HEAD(&c->list);
+
+	if (!c->cached || !c->err || !c->len || !c->data) {
+		mtdsplit_scan_free(c);
+		return NULL;
+	}
+
+	list_add(&c->list, &mtdsplit_scan_caches);
+
+	return c;
+}
+
+/*
+ * Drop-in replacement for mtd_read() for the header lookups of the split
+ * parsers. Reads of up to MTDSPLIT_HEAD_LEN bytes at the start of an erase
+ * block are answered from the scan cache, anything else goes to the flash.
+ */
+int mtd_read_cached(struct mtd_info *mtd, size_t from, size_t len,
+		    size_t *retlen, u_char *buf)
+{
+	struct mtdsplit_scan_cache *c;
+	unsigned int block;
+	u_char *head;
+	int ret;
+
+	if (len > MTDSPLIT_HEAD_LEN || from >= mtd->size ||
+	    mtd_mod_by_eb(from, mtd))
+		return mtd_read(mtd, from, len, retlen, buf);
+
+	mutex_lock(&mtdsplit_scan_lock);
+
+	c = mtdsplit_scan_get(mtd);
+	if (!c) {
+		mutex_unlock(&mtdsplit_scan_lock);
+		return mtd_read(mtd, from, len, retlen, buf);
+	}
+
+	block = mtd_div_by_eb(from, mtd);
+	head = c->data + block * MTDSPLIT_HEAD_LEN;
+	if (test_bit(block, c->cached)) {
+		c->hits++;
+	} else {
+		c->len[block] = 0;
+		c->err[block] = mtd_read(mtd, from,
+					 min_t(uint64_t, MTDSPLIT_HEAD_LEN,
+					       mtd->size - from),
+					 &c->len[block], head);
+		set_bit(block, c->cached);
+		c->reads++;
+	}
+
+	ret = c->err[block];
+	*retlen = min(len, c->len[block]);
+	memcpy(buf, head, *retlen);
+
+	mutex_unlock(&mtdsplit_scan_lock);
+
+	return ret;
+}
+EXPORT_SYMBOL_GPL(mtd_read_cached);
+
+static void mtdsplit_scan_add(struct mtd_info *mtd)
+{
+}
+
+static void mtdsplit_scan_remove(struct mtd_info *mtd)
+{
+	struct mtdsplit_scan_cache *c;
+
+	mutex_lock(&mtdsplit_scan_lock);
+	list_for_each_entry(c, &mtdsplit_scan_caches, list) {
+		if (c->mtd == mtd) {
+			mtdsplit_scan_free(c);
+			break;
+		}
+	}
+	mutex_unlock(&mtdsplit_scan_lock);
+}
+
+static struct mtd_notifier mtdsplit_scan_notifier = {
+	.add = mtdsplit_scan_add,
+	.remove = mtdsplit_scan_remove,
+};
+
+static int __init mtdsplit_scan_init(void)
+{
+	register_mtd_user(&mtdsplit_scan_notifier);
+
+	return 0;
+}
+subsys_initcall(mtdsplit_scan_init);
+
+static int __init mtdsplit_scan_release(void)
+{
+	struct mtdsplit_scan_cache *c, *tmp;
+
+	mutex_lock(&mtdsplit_scan_lock);
+	mtdsplit_scan_done = true;
+	list_for_each_entry_safe(c, tmp, &mtdsplit_scan_caches, list)
+		mtdsplit_scan_free(c);
+	mutex_unlock(&mtdsplit_scan_lock);
+
+	return 0;
+}
+late_initcall_sync(mtdsplit_scan_release);
+
 int mtd_get_squashfs_len(struct mtd_info *master,
 			 size_t offset,
 			 size_t *squashfs_len)
@@ -38,7 +223,7 @@ int mtd_get_squashfs_len(struct mtd_info *master,
 	size_t retlen;
 	int err;
 
-	err = mtd_read(master, offset, sizeof(sb), &retlen, (void *)&sb);
+	err = mtd_read_cached(master, offset, sizeof(sb), &retlen, (void *)&sb);
 	if (err || (retlen != sizeof(sb))) {
 		pr_alert("error occured while reading from \"%s\"\n",
 			 master->name);
@@ -79,8 +264,8 @@ int mtd_check_rootfs_magic(struct mtd_info *mtd, size_t offset,
 	size_t retlen;
 	int ret;
 
-	ret = mtd_read(mtd, offset, sizeof(magic), &retlen,
-		       (unsigned char *) &magic);
+	ret = mtd_read_cached(mtd, offset, sizeof(magic), &retlen,
+			      (unsigned char *) &magic);
 	if (ret)
 		return ret;
 
@@ -81,8 +81,8 @@ static int jffs2_find_file(struct mtd_info *mtd, uint8_t *buf,
 		unsigned int block_offs = 0;
 
 		/* Skip CFE erased blocks */
-		rc = mtd_read(mtd, *offs, sizeof(magic), &retlen,
-			      (void *) &magic);
+		rc = mtd_read_cached(mtd, *offs, sizeof(magic), &retlen,
+				     (void *) &magic);
 		if (rc || retlen != sizeof(magic)) {
 			continue;
 		}
@@ -141,8 +141,8 @@ static int ubifs_find(struct mtd_info *mtd, loff_t *offs, loff_t size)
 	int rc;
 
 	for (; *offs < end; *offs += mtd->erasesize) {
-		rc = mtd_read(mtd, *offs, sizeof(magic), &retlen,
-			      (unsigned char *) &magic);
+		rc = mtd_read_cached(mtd, *offs, sizeof(magic), &retlen,
+				     (unsigned char *) &magic);
 		if (rc || retlen != sizeof(magic))
 			continue;
 
@@ -1920,6 +1920,39 @@ ar8xxx_sw_get_port_stats(struct switch_dev *dev, int port,
 	return 0;
 }
 
+/* report the counters collected by mib_work, without a new capture */
+int
+ar8xxx_sw_get_port_mibs(struct switch_dev *dev, int port,
+			struct switch_port_mib *mibs, int n_mibs)
+{
+	struct ar8xxx_priv *priv = swdev_to_ar8xxx(dev);
+	const struct ar8xxx_chip *chip = priv->chip;
+	u64 *mib_stats;
+	int i, n = 0;
+
+	if (!ar8xxx_has_mib_counters(priv) || !priv->mib_poll_interval)
+		return -EOPNOTSUPP;
+
+	if (port >= dev->ports)
+		return -EINVAL;
+
+	mutex_lock(&priv->mib_lock);
+
+	mib_stats = &priv->mib_stats[port * chip->num_mibs];
+	for (i = 0; i < chip->num_mibs; i++) {
+		if (chip->mib_decs[i].type > priv->mib_type)
+			continue;
+		if (n < n_mibs) {
+			mibs[n].name = chip->mib_decs[i].name;
+			mibs[n].value = mib_stats[i];
+		}
+		n++;
+	}
+
+	mutex_unlock(&priv->mib_lock);
+	return n;
+}
+
 static int
 ar8xxx_phy_read(struct mii_bus *bus, int phy_addr, int reg_addr)
 {
@@ -2065,6 +2098,7 @@ static const struct switch_dev_ops ar8xxx_sw_ops = {
 	.reset_switch = ar8xxx_sw_reset_switch,
 	.get_port_link = ar8xxx_sw_get_port_link,
 	.get_port_stats = ar8xxx_sw_get_port_stats,
+	.get_port_mibs = ar8xxx_sw_get_port_mibs,
 };
 
 static const struct ar8xxx_chip ar7240sw_chip = {
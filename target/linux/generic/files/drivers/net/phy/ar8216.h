@@ -646,6 +646,9 @@ int
 ar8xxx_sw_get_port_stats(struct switch_dev *dev, int port,
 			struct switch_port_stats *stats);
 int
+ar8xxx_sw_get_port_mibs(struct switch_dev *dev, int port,
+			struct switch_port_mib *mibs, int n_mibs);
+int
 ar8216_wait_bit(struct ar8xxx_priv *priv, int reg, u32 mask, u32 val);
 
 static inline struct ar8xxx_priv *
@@ -907,6 +907,120 @@ error:
 	return err;
 }
 
+static int
+swconfig_send_port_mibs(struct swconfig_callback *cb, void *arg)
+{
+	const struct switch_port_mib *mibs = arg;
+	struct genl_info *info = cb->info;
+	struct sk_buff *msg = cb->msg;
+	struct nlattr *m, *p;
+	void *hdr;
+	int i;
+
+	hdr = genlmsg_put(msg, info->snd_portid, info->snd_seq, &switch_fam,
+			NLM_F_MULTI, SWITCH_CMD_GET_PORT_MIBS);
+	if (IS_ERR(hdr))
+		return -1;
+
+	if (nla_put_u32(msg, SWITCH_ATTR_OP_PORT, cb->args[0]))
+		goto nla_put_failure;
+
+	m = nla_nest_start(msg, SWITCH_ATTR_PORT_MIBS);
+	if (!m)
+		goto nla_put_failure;
+
+	for (i = 0; i < cb->args[1]; i++) {
+		p = nla_nest_start(msg, SWITCH_ATTR_MIB);
+		if (!p)
+			goto nla_put_failure;
+		if (nla_put_string(msg, SWITCH_MIB_NAME, mibs[i].name))
+			goto nla_put_failure;
+		if (nla_put_u64_64bit(msg, SWITCH_MIB_VALUE, mibs[i].value,
+				      SWITCH_MIB_PAD))
+			goto nla_put_failure;
+		nla_nest_end(msg, p);
+	}
+
+	nla_nest_end(msg, m);
+	genlmsg_end(msg, hdr);
+	return msg->len;
+nla_put_failure:
+	genlmsg_cancel(msg, hdr);
+	return -EMSGSIZE;
+}
+
+/* dump the counters of all ports in one request, one message per port */
+static int
+swconfig_get_port_mibs(struct sk_buff *skb, struct genl_info *info)
+{
+	struct switch_port_mib *mibs;
+	struct switch_dev *dev;
+	struct swconfig_callback cb;
+	int err = -EOPNOTSUPP;
+	int max = SWITCH_PORT_MIBS_MAX;
+	int i, n;
+
+	dev = swconfig_get_dev(info);
+	if (!dev)
+		return -EINVAL;
+
+	if (!dev->ops->get_port_mibs)
+		goto out;
+
+	err = -ENOMEM;
+	mibs = kmalloc_array(max, sizeof(*mibs), GFP_KERNEL);
+	if (!mibs)
+		goto out;
+
+	memset(&cb, 0, sizeof(cb));
+	cb.info = info;
+	cb.fill = swconfig_send_port_mibs;
+	for (i = 0; i < dev->ports; i++) {
+		n = dev->ops->get_port_mibs(dev, i, mibs, max);
+		if (n < 0) {
+			err = n;
+			goto error;
+		}
+
+		/* the port has more counters than fit, grow the buffer and retry */
+		if (n > max) {
+			kfree(mibs);
+			max = n;
+			mibs = kmalloc_array(max, sizeof(*mibs), GFP_KERNEL);
+			if (!mibs) {
+				err = -ENOMEM;
+				goto error;
+			}
+			i--;
+			continue;
+		}
+
+		cb.args[0] = i;
+		cb.args[1] = n;
+		err = swconfig_send_multipart(&cb, mibs);
+		if (err < 0) {
+			/* already freed by swconfig_send_multipart */
+			cb.msg = NULL;
+			goto error;
+		}
+	}
+	kfree(mibs);
+	swconfig_put_dev(dev);
+
+	if (!cb.msg)
+		return 0;
+
+	return genlmsg_reply(cb.msg, info);
+
+error:
+	if (cb.msg)
+		nlmsg_free(cb.msg);
+	kfree(mibs);
+out:
+	swconfig_put_dev(dev);
+	return err;
+}
+
 static int
 swconfig_send_switch(struct sk_buff *msg, u32 pid, u32 seq, int flags,
 		const struct switch_dev *dev)
@@ -1037,6 +1151,11 @@ static struct genl_ops swconfig_ops[] = {
 		.flags = GENL_ADMIN_PERM,
 		.doit = swconfig_set_attr,
 	},
+	{
+		.cmd = SWITCH_CMD_GET_PORT_MIBS,
+		.validate = GENL_DONT_VALIDATE_STRICT | GENL_DONT_VALIDATE_DUMP,
+		.doit = swconfig_get_port_mibs,
+	},
 	{
 		.cmd = SWITCH_CMD_GET_SWITCH,
 		.validate = GENL_DONT_VALIDATE_STRICT | GENL_DONT_VALIDATE_DUMP,
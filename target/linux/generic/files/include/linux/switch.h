@@ -63,6 +63,13 @@ struct switch_port_stats {
 	unsigned long long rx_bytes;
 };
 
+#define SWITCH_PORT_MIBS_MAX	64
+
+struct switch_port_mib {
+	const char *name;
+	u64 value;
+};
+
 /**
  * struct switch_dev_ops - switch driver operations
  *
@@ -80,6 +87,10 @@ struct switch_port_stats {
  *
  * @apply_config: apply all changed settings to the switch
  * @reset_switch: resetting the switch
+ *
+ * @get_port_mibs: fill in up to @n_mibs counters of a port from the last
+ *                 polled snapshot, returns the number of counters the port
+ *                 has, which is more than @n_mibs if they did not all fit
  */
 struct switch_dev_ops {
 	struct switch_attrlist attr_global, attr_port, attr_vlan;
@@ -99,6 +110,8 @@ struct switch_dev_ops {
 			     struct switch_port_link *link);
 	int (*get_port_stats)(struct switch_dev *dev, int port,
 			      struct switch_port_stats *stats);
+	int (*get_port_mibs)(struct switch_dev *dev, int port,
+			     struct switch_port_mib *mibs, int n_mibs);
 
 	int (*phy_read16)(struct switch_dev *dev, int addr, u8 reg, u16 *value);
 	int (*phy_write16)(struct switch_dev *dev, int addr, u8 reg, u16 value);